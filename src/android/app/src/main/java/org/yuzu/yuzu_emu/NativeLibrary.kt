@@ -181,6 +181,17 @@ object NativeLibrary {
      */
     external fun getPerfStats(): DoubleArray
 
+    /**
+     * Returns the current and peak memory usage in bytes of the application, the GPU device,
+     * the texture cache and the buffer cache, in that order
+     */
+    external fun getMemoryTelemetry(): LongArray
+
+    /**
+     * Asks the emulated GPU caches to give memory back, [level] is a ComponentCallbacks2 level
+     */
+    external fun trimMemory(level: Int)
+
     /**
      * Returns the number of shaders being built
      */
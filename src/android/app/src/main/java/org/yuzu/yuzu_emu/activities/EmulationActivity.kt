@@ -204,6 +204,11 @@ class EmulationActivity : AppCompatActivity(), SensorEventListener {
         stopMotionSensorListener()
     }
 
+    override fun onTrimMemory(level: Int) {
+        super.onTrimMemory(level)
+        NativeLibrary.trimMemory(level)
+    }
+
     override fun onDestroy() {
         super.onDestroy()
         stopForegroundService(this)
@@ -10,6 +10,8 @@ import org.yuzu.yuzu_emu.utils.NativeConfig
 
 enum class BooleanSetting(override val key: String) : AbstractBooleanSetting {
     AUDIO_MUTED("audio_muted"),
+    AUDIO_ADAPTIVE_LATENCY("audio_adaptive_latency"),
+    AUDIO_HOST_TIMING_VOICE_DROP("audio_host_timing_voice_drop"),
     FASTMEM("cpuopt_fastmem"),
     FASTMEM_EXCLUSIVES("cpuopt_fastmem_exclusives"),
     CORE_SYNC_CORE_SPEED("sync_core_speed"),
@@ -18,20 +20,24 @@ enum class BooleanSetting(override val key: String) : AbstractBooleanSetting {
     USE_CUSTOM_CPU_TICKS("use_custom_cpu_ticks"),
     SKIP_CPU_INNER_INVALIDATION("skip_cpu_inner_invalidation"),
     CPUOPT_UNSAFE_HOST_MMU("cpuopt_unsafe_host_mmu"),
+    CORE_TYPE_AFFINITY("core_type_affinity"),
     USE_DOCKED_MODE("use_docked_mode"),
     USE_AUTO_STUB("use_auto_stub"),
     RENDERER_USE_DISK_SHADER_CACHE("use_disk_shader_cache"),
     RENDERER_FORCE_MAX_CLOCK("force_max_clock"),
     RENDERER_ASYNCHRONOUS_SHADERS("use_asynchronous_shaders"),
+    RENDERER_AUTO_PERFORMANCE_PROFILE("auto_performance_profile"),
     RENDERER_FAST_GPU("use_fast_gpu_time"),
     RENDERER_REACTIVE_FLUSHING("use_reactive_flushing"),
     RENDERER_EARLY_RELEASE_FENCES("early_release_fences"),
     SYNC_MEMORY_OPERATIONS("sync_memory_operations"),
+    RENDERER_FRAME_GENERATION("frame_generation"),
     BUFFER_REORDER_DISABLE("disable_buffer_reorder"),
     RENDERER_DEBUG("debug"),
     RENDERER_VERTEX_INPUT_DYNAMIC_STATE("vertex_input_dynamic_state"),
     RENDERER_PROVOKING_VERTEX("provoking_vertex"),
     RENDERER_DESCRIPTOR_INDEXING("descriptor_indexing"),
+    RENDERER_FOVEATED_SHADING("foveated_shading"),
     RENDERER_SAMPLE_SHADING("sample_shading"),
     PICTURE_IN_PICTURE("picture_in_picture"),
     USE_CUSTOM_RTC("custom_rtc_enabled"),
@@ -63,8 +69,10 @@ enum class BooleanSetting(override val key: String) : AbstractBooleanSetting {
 
     SHOW_FPS("show_fps"),
     SHOW_FRAMETIME("show_frame_time"),
+    SHOW_AUDIO_LATENCY("show_audio_latency"),
     SHOW_APP_RAM_USAGE("show_app_ram_usage"),
     SHOW_SYSTEM_RAM_USAGE("show_system_ram_usage"),
+    SHOW_GPU_MEMORY_USAGE("show_gpu_memory_usage"),
     SHOW_BAT_TEMPERATURE("show_bat_temperature"),
     SHOW_POWER_INFO("show_power_info"),
     SHOW_SHADERS_BUILDING("show_shaders_building"),
@@ -160,6 +160,13 @@ abstract class SettingsItem(
                     descriptionId = R.string.descriptor_indexing_description
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.RENDERER_FOVEATED_SHADING,
+                    titleId = R.string.foveated_shading,
+                    descriptionId = R.string.foveated_shading_description
+                )
+            )
             put(
                 SwitchSetting(
                     BooleanSetting.RENDERER_SAMPLE_SHADING,
@@ -243,6 +250,13 @@ abstract class SettingsItem(
                     descriptionId = R.string.frame_interpolation_description
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.RENDERER_FRAME_GENERATION,
+                    titleId = R.string.frame_generation,
+                    descriptionId = R.string.frame_generation_description
+                )
+            )
 
 //            put(
 //                SwitchSetting(
@@ -441,6 +455,13 @@ abstract class SettingsItem(
                     descriptionId = R.string.show_frametime_description
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.SHOW_AUDIO_LATENCY,
+                    R.string.show_audio_latency,
+                    descriptionId = R.string.show_audio_latency_description
+                )
+            )
             put(
                 SwitchSetting(
                     BooleanSetting.SHOW_APP_RAM_USAGE,
@@ -455,6 +476,13 @@ abstract class SettingsItem(
                     descriptionId = R.string.show_system_ram_usage_description
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.SHOW_GPU_MEMORY_USAGE,
+                    R.string.show_gpu_memory_usage,
+                    descriptionId = R.string.show_gpu_memory_usage_description
+                )
+            )
             put(
                 SwitchSetting(
                     BooleanSetting.SHOW_BAT_TEMPERATURE,
@@ -595,6 +623,13 @@ abstract class SettingsItem(
                     valuesId = R.array.verticalAlignmentValues
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.RENDERER_AUTO_PERFORMANCE_PROFILE,
+                    titleId = R.string.auto_performance_profile,
+                    descriptionId = R.string.auto_performance_profile_description
+                )
+            )
             put(
                 SwitchSetting(
                     BooleanSetting.RENDERER_USE_DISK_SHADER_CACHE,
@@ -697,6 +732,13 @@ abstract class SettingsItem(
                     descriptionId = R.string.cpuopt_unsafe_host_mmu_description
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.CORE_TYPE_AFFINITY,
+                    titleId = R.string.core_type_affinity,
+                    descriptionId = R.string.core_type_affinity_description
+                )
+            )
             put(
                 SwitchSetting(
                     BooleanSetting.RENDERER_REACTIVE_FLUSHING,
@@ -750,6 +792,20 @@ abstract class SettingsItem(
                     units = "%"
                 )
             )
+            put(
+                SwitchSetting(
+                    BooleanSetting.AUDIO_ADAPTIVE_LATENCY,
+                    titleId = R.string.audio_adaptive_latency,
+                    descriptionId = R.string.audio_adaptive_latency_description
+                )
+            )
+            put(
+                SwitchSetting(
+                    BooleanSetting.AUDIO_HOST_TIMING_VOICE_DROP,
+                    titleId = R.string.audio_host_timing_voice_drop,
+                    descriptionId = R.string.audio_host_timing_voice_drop_description
+                )
+            )
             put(
                 SingleChoiceSetting(
                     IntSetting.RENDERER_BACKEND,
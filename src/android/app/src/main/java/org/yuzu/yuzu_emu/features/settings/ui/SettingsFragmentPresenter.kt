@@ -261,8 +261,10 @@ class SettingsFragmentPresenter(
             add(HeaderSetting(R.string.stats_overlay_items))
             add(BooleanSetting.SHOW_FPS.key)
             add(BooleanSetting.SHOW_FRAMETIME.key)
+            add(BooleanSetting.SHOW_AUDIO_LATENCY.key)
             add(BooleanSetting.SHOW_APP_RAM_USAGE.key)
             add(BooleanSetting.SHOW_SYSTEM_RAM_USAGE.key)
+            add(BooleanSetting.SHOW_GPU_MEMORY_USAGE.key)
             add(BooleanSetting.SHOW_BAT_TEMPERATURE.key)
             add(IntSetting.BAT_TEMPERATURE_UNIT.key)
             add(BooleanSetting.SHOW_POWER_INFO.key)
@@ -301,6 +303,8 @@ class SettingsFragmentPresenter(
         sl.apply {
             add(IntSetting.AUDIO_OUTPUT_ENGINE.key)
             add(ByteSetting.AUDIO_VOLUME.key)
+            add(BooleanSetting.AUDIO_ADAPTIVE_LATENCY.key)
+            add(BooleanSetting.AUDIO_HOST_TIMING_VOICE_DROP.key)
         }
     }
 
@@ -456,6 +460,7 @@ class SettingsFragmentPresenter(
             add(BooleanSetting.RENDERER_VERTEX_INPUT_DYNAMIC_STATE.key)
             add(BooleanSetting.RENDERER_PROVOKING_VERTEX.key)
             add(BooleanSetting.RENDERER_DESCRIPTOR_INDEXING.key)
+            add(BooleanSetting.RENDERER_FOVEATED_SHADING.key)
             add(BooleanSetting.RENDERER_SAMPLE_SHADING.key)
             add(IntSetting.RENDERER_SAMPLE_SHADING_FRACTION.key)
 
@@ -464,6 +469,7 @@ class SettingsFragmentPresenter(
             add(IntSetting.DMA_ACCURACY.key)
             add(BooleanSetting.BUFFER_REORDER_DISABLE.key)
             add(BooleanSetting.FRAME_INTERPOLATION.key)
+            add(BooleanSetting.RENDERER_FRAME_GENERATION.key)
             add(BooleanSetting.RENDERER_FAST_GPU.key)
             add(IntSetting.FAST_GPU_TIME.key)
             add(IntSetting.RENDERER_SHADER_BACKEND.key)
@@ -471,6 +477,7 @@ class SettingsFragmentPresenter(
             add(IntSetting.RENDERER_ASTC_DECODE_METHOD.key)
             add(IntSetting.RENDERER_ASTC_RECOMPRESSION.key)
             add(IntSetting.RENDERER_VRAM_USAGE_MODE.key)
+            add(BooleanSetting.RENDERER_AUTO_PERFORMANCE_PROFILE.key)
             add(IntSetting.RENDERER_OPTIMIZE_SPIRV_OUTPUT.key)
 
             add(HeaderSetting(R.string.veil_misc))
@@ -480,6 +487,7 @@ class SettingsFragmentPresenter(
             add(IntSetting.CPU_TICKS.key)
             add(BooleanSetting.SKIP_CPU_INNER_INVALIDATION.key)
             add(BooleanSetting.CPUOPT_UNSAFE_HOST_MMU.key)
+            add(BooleanSetting.CORE_TYPE_AFFINITY.key)
             add(BooleanSetting.USE_LRU_CACHE.key)
             add(BooleanSetting.CORE_SYNC_CORE_SPEED.key)
             add(BooleanSetting.SYNC_MEMORY_OPERATIONS.key)
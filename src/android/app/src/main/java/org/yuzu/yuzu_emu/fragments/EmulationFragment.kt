@@ -1115,6 +1115,12 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
             val FPS = 1
             val FRAMETIME = 2
             val SPEED = 3
+            val AUDIO_LATENCY = 4
+            val FRAMETIME_P99 = 5
+            val LOW_1_PERCENT_FPS = 6
+            val STUTTERS = 7
+            val TEXTURE_CACHE_BYTES = 4
+            val BUFFER_CACHE_BYTES = 6
             val sb = StringBuilder()
             perfStatsUpdater = {
                 if (emulationViewModel.emulationStarted.value &&
@@ -1148,8 +1154,21 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
                         if (sb.isNotEmpty()) sb.append(" | ")
                         sb.append(
                             String.format(
-                                "FT: %.1fms",
-                                (perfStats[FRAMETIME] * 1000.0f).toFloat()
+                                "FT: %.1fms (p99 %.1fms, 1%% low %.0f, stutters %d)",
+                                (perfStats[FRAMETIME] * 1000.0f).toFloat(),
+                                (perfStats[FRAMETIME_P99] * 1000.0f).toFloat(),
+                                perfStats[LOW_1_PERCENT_FPS],
+                                perfStats[STUTTERS].toInt()
+                            )
+                        )
+                    }
+
+                    if (BooleanSetting.SHOW_AUDIO_LATENCY.getBoolean(needsGlobal)) {
+                        if (sb.isNotEmpty()) sb.append(" | ")
+                        sb.append(
+                            String.format(
+                                "Audio: %.0fms",
+                                (perfStats[AUDIO_LATENCY] * 1000.0f).toFloat()
                             )
                         )
                     }
@@ -1173,6 +1192,18 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
                         }
                     }
 
+                    if (BooleanSetting.SHOW_GPU_MEMORY_USAGE.getBoolean(needsGlobal)) {
+                        if (sb.isNotEmpty()) sb.append(" | ")
+                        val memory = NativeLibrary.getMemoryTelemetry()
+                        sb.append(
+                            getString(
+                                R.string.gpu_cache_memory,
+                                memory[TEXTURE_CACHE_BYTES] / 1048576L,
+                                memory[BUFFER_CACHE_BYTES] / 1048576L
+                            )
+                        )
+                    }
+
                     if (BooleanSetting.SHOW_BAT_TEMPERATURE.getBoolean(needsGlobal)) {
                         if (sb.isNotEmpty()) sb.append(" | ")
 
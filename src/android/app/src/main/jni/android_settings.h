@@ -110,6 +110,10 @@ namespace AndroidSettings {
                                                 Settings::Category::Overlay,
                                                 Settings::Specialization::Default, true, true,
                                                 &show_performance_overlay};
+        Settings::Setting<bool> show_audio_latency{linkage, false, "show_audio_latency",
+                                                   Settings::Category::Overlay,
+                                                   Settings::Specialization::Default, true, true,
+                                                   &show_performance_overlay};
         Settings::Setting<bool> show_app_ram_usage{linkage, false, "show_app_ram_usage",
                                                    Settings::Category::Overlay,
                                                    Settings::Specialization::Default, true, true,
@@ -118,6 +122,10 @@ namespace AndroidSettings {
                                                       Settings::Category::Overlay,
                                                       Settings::Specialization::Default, true, true,
                                                       &show_performance_overlay};
+        Settings::Setting<bool> show_gpu_memory_usage{linkage, false, "show_gpu_memory_usage",
+                                                      Settings::Category::Overlay,
+                                                      Settings::Specialization::Default, true, true,
+                                                      &show_performance_overlay};
         Settings::Setting<bool> show_bat_temperature{linkage, false, "show_bat_temperature",
                                                      Settings::Category::Overlay,
                                                      Settings::Specialization::Default, true, true,
@@ -7,11 +7,13 @@
 #define VMA_IMPLEMENTATION
 #include "video_core/vulkan_common/vma.h"
 
+#include <array>
 #include <codecvt>
 #include <cstdio>
 #include <cstring>
 #include <locale>
 #include <map>
+#include <numeric>
 #include <set>
 #include <sstream>
 #include <span>
@@ -50,6 +52,7 @@
 #include "common/settings.h"
 #include "common/string_util.h"
 #include "frontend_common/play_time_manager.h"
+#include "core/boot_timeline.h"
 #include "core/core.h"
 #include "core/cpu_manager.h"
 #include "core/crypto/key_manager.h"
@@ -87,6 +90,7 @@
 #include "video_core/vulkan_common/vulkan_instance.h"
 #include "video_core/vulkan_common/vulkan_surface.h"
 #include "video_core/shader_notify.h"
+#include "video_core/texture_cache/memory_pressure.h"
 #include "network/announce_multiplayer_session.h"
 
 #define jconst [[maybe_unused]] const auto
@@ -191,12 +195,59 @@ const Core::PerfStatsResults& EmulationSession::PerfStats() {
     return m_perf_stats;
 }
 
+Core::MemoryTelemetry EmulationSession::MemoryTelemetry() {
+    return m_system.GetMemoryTelemetry();
+}
+
+f64 EmulationSession::MeanFrametime(size_t& next_frame) {
+    // Called from the thermal monitor, skip the sample instead of waiting while the session
+    // is being set up or torn down.
+    std::unique_lock lock(m_mutex, std::try_to_lock);
+    if (!lock || !IsRunning()) {
+        return 0.0;
+    }
+    const auto& perf_stats = m_system.GetPerfStats();
+    const size_t frame_count = perf_stats.GetSystemFrameCount();
+    const auto frametimes = perf_stats.GetFrametimes(next_frame, frame_count);
+    next_frame = frame_count;
+    if (frametimes.empty()) {
+        return 0.0;
+    }
+    return std::accumulate(frametimes.begin(), frametimes.end(), 0.0) /
+           static_cast<f64>(frametimes.size());
+}
+
 int EmulationSession::ShadersBuilding() {
     auto& shader_notify = m_system.GPU().ShaderNotify();
     m_shaders_building = shader_notify.ShadersBuilding();
     return m_shaders_building;
 }
 
+void EmulationSession::TrimMemory(int level) {
+    // Called from the UI thread, skip the request instead of waiting while the session is being
+    // set up or torn down.
+    std::unique_lock lock(m_mutex, std::try_to_lock);
+    if (!lock || !IsRunning()) {
+        return;
+    }
+    // Levels of ComponentCallbacks2
+    constexpr int TRIM_MEMORY_RUNNING_LOW = 10;
+    constexpr int TRIM_MEMORY_RUNNING_CRITICAL = 15;
+    constexpr int TRIM_MEMORY_MODERATE = 60;
+    constexpr int TRIM_MEMORY_COMPLETE = 80;
+    const auto pressure = [level] {
+        if (level == TRIM_MEMORY_RUNNING_CRITICAL || level >= TRIM_MEMORY_COMPLETE) {
+            return VideoCommon::MemoryPressure::Critical;
+        }
+        if (level == TRIM_MEMORY_RUNNING_LOW || level >= TRIM_MEMORY_MODERATE) {
+            return VideoCommon::MemoryPressure::High;
+        }
+        return VideoCommon::MemoryPressure::Low;
+    }();
+    LOG_INFO(Frontend, "Trimming memory, level {}", level);
+    m_system.GPU().TrimMemory(pressure);
+}
+
 void EmulationSession::SurfaceChanged() {
     if (!IsRunning()) {
         return;
@@ -256,6 +307,11 @@ void EmulationSession::InitializeSystem(bool reload) {
             m_thermal_monitor->Initialize(device_model);
             
             // Set callbacks for thermal events
+            m_thermal_monitor->SetOnWarningCallback(
+                [this]() { m_performance_recorder.ReportThermalThrottle(); });
+            m_thermal_monitor->SetFrametimeProvider(
+                [this, next_frame = size_t{0}]() mutable { return MeanFrametime(next_frame); });
+
             m_thermal_monitor->SetOnCriticalCallback([this]() {
                 LOG_CRITICAL(Frontend, "🔥 CRITICAL TEMPERATURE - Pausing emulation!");
                 PauseEmulation();
@@ -319,6 +375,15 @@ Core::SystemResultStatus EmulationSession::InitializeEmulation(const std::string
     // Initialize filesystem.
     ConfigureFilesystemProvider(filepath);
 
+    // Fill in the settings the per-game config leaves on global with the learned ones.
+    if (const auto file = m_system.GetFilesystem()->OpenFile(filepath, FileSys::OpenMode::Read)) {
+        u64 program_id = 0;
+        const auto loader = Loader::GetLoader(m_system, file, 0, program_index);
+        if (loader && loader->ReadProgramId(program_id) == Loader::ResultStatus::Success) {
+            PerformanceProfile::ApplyLearnedDefaults(program_id);
+        }
+    }
+
     // Load the ROM.
     Service::AM::FrontendAppletParameters params{
         .applet_id = static_cast<Service::AM::AppletId>(m_applet_id),
@@ -343,6 +408,8 @@ Core::SystemResultStatus EmulationSession::InitializeEmulation(const std::string
         EmulationSession::GetInstance().HaltEmulation();
     });
 
+    m_performance_recorder.Start(m_system, m_system.GetApplicationProcessProgramID());
+
     OnEmulationStarted();
     return Core::SystemResultStatus::Success;
 }
@@ -356,11 +423,11 @@ void EmulationSession::ShutdownEmulation() {
     }
 
     m_is_running = false;
+    m_performance_recorder.Stop();
     
-    // Stop thermal monitoring
+    // Keep monitoring for the next session, but give back what the governor took from this one
     if (m_thermal_monitor) {
-        m_thermal_monitor->StopMonitoring();
-        m_thermal_monitor.reset();
+        m_thermal_monitor->ResetGovernor();
     }
 
     // Unload user input.
@@ -411,6 +478,7 @@ void EmulationSession::RunEmulation() {
     // Load the disk shader cache.
     if (Settings::values.use_disk_shader_cache.GetValue()) {
         LoadDiskCacheProgress(VideoCore::LoadCallbackStage::Prepare, 0, 0);
+        const auto boot_stage = m_system.GetBootTimeline().MeasureStage("Pipeline cache");
         m_system.Renderer().ReadRasterizer()->LoadDiskResources(
             m_system.GetApplicationProcessProgramID(), std::stop_token{}, LoadDiskCacheProgress);
         LoadDiskCacheProgress(VideoCore::LoadCallbackStage::Complete, 0, 0);
@@ -892,21 +960,52 @@ void Java_org_yuzu_yuzu_1emu_NativeLibrary_initializeSystem(JNIEnv* env, jclass
 }
 
 jdoubleArray Java_org_yuzu_yuzu_1emu_NativeLibrary_getPerfStats(JNIEnv* env, jclass clazz) {
-    jdoubleArray j_stats = env->NewDoubleArray(4);
+    constexpr jsize num_stats = 8;
+    jdoubleArray j_stats = env->NewDoubleArray(num_stats);
 
     if (EmulationSession::GetInstance().IsRunning()) {
         jconst results = EmulationSession::GetInstance().PerfStats();
 
         // Converting the structure into an array makes it easier to pass it to the frontend
-        double stats[4] = {results.system_fps, results.average_game_fps, results.frametime,
-                           results.emulation_speed};
-
-        env->SetDoubleArrayRegion(j_stats, 0, 4, stats);
+        double stats[num_stats] = {results.system_fps,
+                                   results.average_game_fps,
+                                   results.frametime,
+                                   results.emulation_speed,
+                                   results.audio_latency,
+                                   results.frame_length_p99,
+                                   results.low_1_percent_fps,
+                                   static_cast<double>(results.stutters)};
+
+        env->SetDoubleArrayRegion(j_stats, 0, num_stats, stats);
     }
 
     return j_stats;
 }
 
+jlongArray Java_org_yuzu_yuzu_1emu_NativeLibrary_getMemoryTelemetry(JNIEnv* env, jclass clazz) {
+    constexpr size_t num_categories = static_cast<size_t>(Core::MemoryCategory::Count);
+    jlongArray j_telemetry = env->NewLongArray(num_categories * 2);
+
+    if (EmulationSession::GetInstance().IsRunning()) {
+        const auto telemetry = EmulationSession::GetInstance().MemoryTelemetry();
+
+        // Each category is stored as its current size followed by its peak, in bytes
+        std::array<jlong, num_categories * 2> values{};
+        for (size_t i = 0; i < num_categories; ++i) {
+            values[i * 2] = static_cast<jlong>(telemetry.categories[i].bytes);
+            values[i * 2 + 1] = static_cast<jlong>(telemetry.categories[i].peak_bytes);
+        }
+
+        env->SetLongArrayRegion(j_telemetry, 0, values.size(), values.data());
+    }
+
+    return j_telemetry;
+}
+
+void Java_org_yuzu_yuzu_1emu_NativeLibrary_trimMemory(JNIEnv* env, jclass clazz, jint level) {
+    EmulationSession::GetInstance().TrimMemory(static_cast<int>(level));
+}
+
 jint Java_org_yuzu_yuzu_1emu_NativeLibrary_getShadersBuilding(JNIEnv* env, jclass clazz) {
     jint j_shaders = 0;
 
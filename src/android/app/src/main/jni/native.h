@@ -9,6 +9,7 @@
 #include "core/hle/service/acc/profile_manager.h"
 #include "core/perf_stats.h"
 #include "frontend_common/content_manager.h"
+#include "frontend_common/performance_profile.h"
 #include "jni/emu_window/emu_window.h"
 #include "video_core/rasterizer_interface.h"
 
@@ -44,7 +45,12 @@ public:
     void ShutdownEmulation();
 
     const Core::PerfStatsResults& PerfStats();
+    Core::MemoryTelemetry MemoryTelemetry();
+    /// Mean frame time since next_frame in milliseconds, advances next_frame to the last frame
+    f64 MeanFrametime(size_t& next_frame);
     int ShadersBuilding();
+    /// Forwards a memory trim level of ComponentCallbacks2 to the GPU caches
+    void TrimMemory(int level);
     void ConfigureFilesystemProvider(const std::string& filepath);
     void InitializeSystem(bool reload);
     void SetAppletId(int applet_id);
@@ -94,4 +100,7 @@ private:
     
     // Thermal protection
     std::unique_ptr<class AndroidThermal::ThermalMonitor> m_thermal_monitor;
+
+    // Per-title statistics for the learned performance profiles
+    PerformanceProfile::Recorder m_performance_recorder;
 };
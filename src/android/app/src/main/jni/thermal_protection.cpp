@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "thermal_protection.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include "common/logging/log.h"
 #include "common/settings.h"
 
@@ -14,6 +18,76 @@
 
 namespace AndroidThermal {
 
+namespace {
+
+struct GovernorStep {
+    Settings::GpuAccuracy max_gpu_accuracy;
+    u16 max_speed_limit;
+};
+
+constexpr u16 NO_SPEED_LIMIT = std::numeric_limits<u16>::max();
+
+/// Steps from full quality to the most conservative state, accuracy is given up first
+constexpr std::array GOVERNOR_STEPS{
+    GovernorStep{Settings::GpuAccuracy::Extreme, NO_SPEED_LIMIT},
+    GovernorStep{Settings::GpuAccuracy::Normal, NO_SPEED_LIMIT},
+    GovernorStep{Settings::GpuAccuracy::Normal, 95},
+    GovernorStep{Settings::GpuAccuracy::Normal, 90},
+    GovernorStep{Settings::GpuAccuracy::Normal, 80},
+    GovernorStep{Settings::GpuAccuracy::Normal, 70},
+};
+
+/// Headroom above which the governor steps down
+constexpr f32 HOT_HEADROOM = 0.85f;
+/// Headroom above which the governor steps down when frames also miss their budget
+constexpr f32 WARM_HEADROOM = 0.7f;
+/// Headroom below which the governor may step back up
+constexpr f32 COOL_HEADROOM = 0.5f;
+/// Consecutive cool samples before stepping back up, 30 seconds at the check interval
+constexpr int COOL_SAMPLES_TO_RELAX = 10;
+/// Frame time of a full speed frame at 60 Hz, with some slack for timer jitter
+constexpr f64 FRAME_BUDGET_MS = 1000.0 / 60.0 * 1.1;
+
+} // Anonymous namespace
+
+bool ThermalGovernor::Update(const GovernorSample& sample) {
+    const bool over_budget = sample.frametime_ms > FRAME_BUDGET_MS;
+    if (sample.headroom >= HOT_HEADROOM || (sample.headroom >= WARM_HEADROOM && over_budget)) {
+        cool_samples = 0;
+        if (step + 1 < GOVERNOR_STEPS.size()) {
+            ++step;
+            Apply();
+            return true;
+        }
+        return false;
+    }
+    if (sample.headroom > COOL_HEADROOM) {
+        // Hold the current step, it is sustainable
+        cool_samples = 0;
+        return false;
+    }
+    if (step > 0 && ++cool_samples >= COOL_SAMPLES_TO_RELAX) {
+        cool_samples = 0;
+        --step;
+        Apply();
+        return true;
+    }
+    return false;
+}
+
+void ThermalGovernor::Reset() {
+    step = 0;
+    cool_samples = 0;
+    Apply();
+}
+
+void ThermalGovernor::Apply() const {
+    const GovernorStep& limits = GOVERNOR_STEPS[step];
+    Settings::values.max_gpu_accuracy.store(limits.max_gpu_accuracy, std::memory_order_relaxed);
+    Settings::values.max_speed_limit.store(limits.max_speed_limit, std::memory_order_relaxed);
+    Settings::PublishRuntimeSnapshot();
+}
+
 DeviceModel DetectDeviceModel() {
 #ifdef __ANDROID__
     char manufacturer[PROP_VALUE_MAX] = {0};
@@ -57,11 +131,32 @@ DeviceModel DetectDeviceModel() {
 }
 
 ThermalMonitor::ThermalMonitor() {
-    LOG_INFO(Frontend, "Thermal Monitor initialized");
+#ifdef __ANDROID__
+    if (android_library.Open("libandroid.so")) {
+        AThermalManager* (*acquire_thermal_manager)(){};
+        if (android_library.GetSymbol("AThermal_acquireManager", &acquire_thermal_manager) &&
+            android_library.GetSymbol("AThermal_releaseManager", &release_thermal_manager) &&
+            android_library.GetSymbol("AThermal_getThermalHeadroom", &get_thermal_headroom)) {
+            thermal_manager = acquire_thermal_manager();
+        }
+    }
+#endif
+    LOG_INFO(Frontend, "Thermal Monitor initialized, thermal headroom {}",
+             thermal_manager ? "available" : "estimated from temperature");
 }
 
 ThermalMonitor::~ThermalMonitor() {
     StopMonitoring();
+    monitor_thread = {};
+    ResetGovernor();
+    if (thermal_manager) {
+        release_thermal_manager(thermal_manager);
+    }
+}
+
+void ThermalMonitor::ResetGovernor() {
+    std::scoped_lock lock{governor_mutex};
+    governor.Reset();
 }
 
 void ThermalMonitor::Initialize(DeviceModel device) {
@@ -158,6 +253,17 @@ f32 ThermalMonitor::ReadTemperatureFromSensor() {
 #endif
 }
 
+f32 ThermalMonitor::ReadThermalHeadroom(f32 temp) {
+    if (thermal_manager) {
+        const f32 headroom = get_thermal_headroom(thermal_manager, HEADROOM_FORECAST_SECONDS);
+        if (!std::isnan(headroom)) {
+            return headroom;
+        }
+    }
+    // Without AThermal, place the temperature between the safe and critical limits
+    return std::max(0.0f, (temp - config.safe_temp) / (config.critical_temp - config.safe_temp));
+}
+
 void ThermalMonitor::ApplyThrottling(ThermalLevel level) {
     switch (level) {
         case ThermalLevel::Safe:
@@ -168,32 +274,19 @@ void ThermalMonitor::ApplyThrottling(ThermalLevel level) {
             LOG_WARNING(Frontend, "⚠️ Temperature WARNING: {:.1f}°C - Reducing quality", 
                        current_temp.load());
             
-            // Reduzir qualidade gradualmente
-            Settings::values.resolution_setup = Settings::ResolutionSetup::Res1_2X;
-            Settings::values.fps_limit = 25;
-            
+            // The governor lowers quality step by step from the thermal headroom
             if (on_warning) on_warning();
             break;
             
         case ThermalLevel::Hot:
             LOG_ERROR(Frontend, "🔥 Temperature HOT: {:.1f}°C - Aggressive throttling!", 
                      current_temp.load());
-            
-            // Throttle agressivo
-            Settings::values.resolution_setup = Settings::ResolutionSetup::Res1_4X;
-            Settings::values.fps_limit = 20;
-            Settings::values.use_asynchronous_shaders = false;
             break;
             
         case ThermalLevel::Critical:
             LOG_CRITICAL(Frontend, "🔥🔥 Temperature CRITICAL: {:.1f}°C - MAXIMUM THROTTLE!", 
                         current_temp.load());
             
-            // Throttle máximo
-            Settings::values.resolution_setup = Settings::ResolutionSetup::Res1_4X;
-            Settings::values.fps_limit = 15;
-            Settings::values.use_asynchronous_shaders = false;
-            
             if (on_critical) on_critical();
             break;
             
@@ -244,6 +337,18 @@ void ThermalMonitor::MonitorThread() {
                         static_cast<int>(old_level), static_cast<int>(new_level), temp);
                 ApplyThrottling(new_level);
             }
+
+            const GovernorSample sample{
+                .headroom = ReadThermalHeadroom(temp),
+                .frametime_ms = frametime_provider ? frametime_provider() : 0.0,
+            };
+            {
+                std::scoped_lock lock{governor_mutex};
+                if (governor.Update(sample)) {
+                    LOG_INFO(Frontend, "Thermal governor step {} (headroom {:.2f}, frame {:.1f} ms)",
+                             governor.Step(), sample.headroom, sample.frametime_ms);
+                }
+            }
             
             // Modo emergência: countdown para desligar
             if (new_level == ThermalLevel::Emergency) {
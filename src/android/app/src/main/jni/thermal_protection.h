@@ -4,11 +4,16 @@
 #pragma once
 
 #include "common/common_types.h"
+#include "common/dynamic_library.h"
 #include <atomic>
 #include <chrono>
+#include <functional>
+#include <mutex>
 #include <thread>
 #include <string>
 
+struct AThermalManager;
+
 namespace AndroidThermal {
 
 enum class DeviceModel {
@@ -55,6 +60,39 @@ struct ThermalConfig {
     }
 };
 
+/// State sampled on each governor step.
+struct GovernorSample {
+    /// Thermal headroom, 0 means no throttling and 1 means the device throttles severely
+    f32 headroom;
+    /// Mean frame time since the previous sample in milliseconds, 0 when no frame was presented
+    f64 frametime_ms;
+};
+
+/**
+ * Closed-loop governor that gives up GPU accuracy and then emulation speed one step at a time
+ * while the device runs out of thermal headroom, and gives them back once it has cooled down.
+ * Long sessions settle at a sustainable step instead of hitting the hard throttling limits.
+ * Steps are applied through the runtime caps of Settings, the configuration is never changed.
+ */
+class ThermalGovernor {
+public:
+    /// Moves at most one step from a sample, returns true when the step changed.
+    bool Update(const GovernorSample& sample);
+
+    /// Goes back to the first step and lifts the caps.
+    void Reset();
+
+    [[nodiscard]] size_t Step() const {
+        return step;
+    }
+
+private:
+    void Apply() const;
+
+    size_t step{};
+    int cool_samples{};
+};
+
 class ThermalMonitor {
 public:
     ThermalMonitor();
@@ -72,10 +110,17 @@ public:
     void SetOnWarningCallback(std::function<void()> callback) { on_warning = callback; }
     void SetOnCriticalCallback(std::function<void()> callback) { on_critical = callback; }
     void SetOnEmergencyCallback(std::function<void()> callback) { on_emergency = callback; }
+
+    /// Sets the source of the mean frame time fed to the governor, it may return 0 when idle.
+    void SetFrametimeProvider(std::function<f64()> provider) { frametime_provider = provider; }
+
+    /// Lifts the governor caps, has to be called when emulation stops.
+    void ResetGovernor();
     
 private:
     void MonitorThread();
     f32 ReadTemperatureFromSensor();
+    f32 ReadThermalHeadroom(f32 temp);
     void ApplyThrottling(ThermalLevel level);
     
     std::atomic<f32> current_temp{0.0f};
@@ -89,8 +134,19 @@ private:
     std::function<void()> on_warning;
     std::function<void()> on_critical;
     std::function<void()> on_emergency;
+    std::function<f64()> frametime_provider;
+
+    std::mutex governor_mutex;
+    ThermalGovernor governor;
+
+    // AThermal is only available since Android 11, it is looked up at runtime
+    Common::DynamicLibrary android_library;
+    AThermalManager* thermal_manager{};
+    void (*release_thermal_manager)(AThermalManager*){};
+    float (*get_thermal_headroom)(AThermalManager*, int){};
     
     static constexpr auto CHECK_INTERVAL = std::chrono::seconds(3);
+    static constexpr int HEADROOM_FORECAST_SECONDS = 10;
     static constexpr int EMERGENCY_COOLDOWN_SECONDS = 30;
 };
 
@@ -12,6 +12,7 @@
 #include "audio_core/common/common.h"
 #include "audio_core/sink/sink.h"
 #include "common/logging/log.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -119,6 +120,13 @@ u64 AudioRenderer::GetRenderingStartTick(s32 session_id) const noexcept {
     return (1000 * command_buffers[session_id].render_time_taken_us) + signalled_tick;
 }
 
+std::chrono::microseconds AudioRenderer::GetOutputLatency() const {
+    if (!streams[0]) {
+        return {};
+    }
+    return streams[0]->GetLatency();
+}
+
 void AudioRenderer::CreateSinkStreams() {
     u32 channels{sink.GetDeviceChannels()};
     for (u32 i = 0; i < MaxRendererSessions; i++) {
@@ -193,6 +201,10 @@ void AudioRenderer::Main(std::stop_token stop_token) {
 
                     max_time = (std::min)(command_buffer.time_limit, max_time);
                     command_list_processor.SetProcessTimeMax(max_time);
+                    command_list_processor.host_timings =
+                        Settings::values.audio_host_timing_voice_drop.GetValue()
+                            ? &host_command_timings
+                            : nullptr;
 
                     if (index == 0) {
                         streams[index]->WaitFreeSpace(stop_token);
@@ -211,6 +223,8 @@ void AudioRenderer::Main(std::stop_token stop_token) {
                     command_buffer.render_time_taken_us = end_time - start_time;
                 }
             }
+            // Fold this render's timings into the scales the next command lists are built with
+            host_command_timings.Update();
             mailbox.Send(Direction::Host, Message::RenderResponse);
         } break;
         default:
@@ -7,12 +7,14 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <memory>
 #include <thread>
 
 #include "audio_core/adsp/apps/audio_renderer/command_buffer.h"
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/adsp/mailbox.h"
+#include "audio_core/renderer/command/host_command_timings.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "common/thread.h"
@@ -81,6 +83,22 @@ public:
     void ClearRemainCommandCount(s32 session_id) noexcept;
     u64 GetRenderingStartTick(s32 session_id) const noexcept;
 
+    /**
+     * Get the output latency of the main session's stream.
+     *
+     * @return The latency, zero if the stream isn't open.
+     */
+    std::chrono::microseconds GetOutputLatency() const;
+
+    /**
+     * Get the host processing times measured for the commands.
+     *
+     * @return The host command timings.
+     */
+    Renderer::HostCommandTimings& GetHostCommandTimings() noexcept {
+        return host_command_timings;
+    }
+
 private:
     /**
      * Main AudioRenderer thread, responsible for processing the command lists.
@@ -112,6 +130,8 @@ private:
     std::array<Sink::SinkStream*, MaxRendererSessions> streams{};
     /// CPU Tick when the DSP was signalled to process, uses time rather than tick
     u64 signalled_tick{0};
+    /// Host processing times of the commands, calibrating their estimates for voice dropping
+    Renderer::HostCommandTimings host_command_timings{};
 };
 
 } // namespace ADSP::AudioRenderer
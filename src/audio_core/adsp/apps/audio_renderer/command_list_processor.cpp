@@ -1,18 +1,62 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <string>
+#include <thread>
 
 #include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "audio_core/renderer/command/commands.h"
+#include "audio_core/renderer/command/host_command_timings.h"
+#include "common/profiler.h"
 #include "common/settings.h"
+#include "common/steady_clock.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/memory.h"
 
 namespace AudioCore::ADSP::AudioRenderer {
+namespace {
+
+/// Voices are only spread over the workers past this count, it's not worth it for a few of them
+constexpr size_t MinParallelVoices = 8;
+constexpr u32 MaxWorkers = 3;
+
+/// Node ids hold their type in the top bits, same as the voice dropping in Renderer::System
+bool IsVoiceCommand(const Renderer::ICommand& command) {
+    return (command.node_id >> 28) == 1;
+}
+
+/// Commands only touching the voice state and the mix buffers, with the mixing done by adding
+bool IsParallelVoiceCommand(const Renderer::ICommand& command) {
+    switch (command.type) {
+    case Renderer::CommandId::DataSourcePcmInt16Version1:
+    case Renderer::CommandId::DataSourcePcmInt16Version2:
+    case Renderer::CommandId::DataSourcePcmFloatVersion1:
+    case Renderer::CommandId::DataSourcePcmFloatVersion2:
+    case Renderer::CommandId::DataSourceAdpcmVersion1:
+    case Renderer::CommandId::DataSourceAdpcmVersion2:
+    case Renderer::CommandId::Volume:
+    case Renderer::CommandId::VolumeRamp:
+    case Renderer::CommandId::BiquadFilter:
+    case Renderer::CommandId::MultiTapBiquadFilter:
+    case Renderer::CommandId::Mix:
+    case Renderer::CommandId::MixRamp:
+    case Renderer::CommandId::MixRampGrouped:
+    case Renderer::CommandId::DepopPrepare:
+        return true;
+    default:
+        // Performance commands increment counters shared by every voice
+        return false;
+    }
+}
+
+} // Anonymous namespace
 
 void CommandListProcessor::Initialize(Core::System& system_, Kernel::KProcess& process,
                                       CpuAddr buffer, u64 size, Sink::SinkStream* stream_) {
@@ -28,6 +72,18 @@ void CommandListProcessor::Initialize(Core::System& system_, Kernel::KProcess& p
     mix_buffers = header->samples_buffer;
     buffer_count = header->buffer_count;
     processed_command_count = 0;
+
+    if (!workers) {
+        const u32 num_workers = (std::min)(std::thread::hardware_concurrency() / 4, MaxWorkers);
+        if (num_workers == 0) {
+            return;
+        }
+        workers = std::make_unique<Common::ThreadWorker>(num_workers, "DSP_AudioRenderer_Voice");
+        worker_buffers.resize(num_workers);
+    }
+    for (auto& worker_buffer : worker_buffers) {
+        worker_buffer.resize(mix_buffers.size());
+    }
 }
 
 void CommandListProcessor::SetProcessTimeMax(const u64 time) {
@@ -43,6 +99,7 @@ Sink::SinkStream* CommandListProcessor::GetOutputSinkStream() const {
 }
 
 u64 CommandListProcessor::Process(u32 session_id) {
+    PROFILE_SCOPE("CommandListProcessor::Process");
     const auto start_time_{system->CoreTiming().GetGlobalTimeUs().count()};
     const auto command_base{CpuAddr(commands)};
 
@@ -82,8 +139,11 @@ u64 CommandListProcessor::Process(u32 session_id) {
             break;
         }
 
-        if (command.enabled) {
-            command.Process(*this);
+        if (command.enabled && workers && IsVoiceCommand(command)) {
+            QueueVoiceCommand(command);
+        } else if (command.enabled) {
+            FlushVoiceRuns();
+            ProcessCommand(*this, command, 1);
         } else {
             dump += fmt::format("\tDisabled!\n");
         }
@@ -91,6 +151,7 @@ u64 CommandListProcessor::Process(u32 session_id) {
         processed_command_count++;
         commands += command.size;
     }
+    FlushVoiceRuns();
 
     if (Settings::values.dump_audio_commands && dump != last_dump) {
         LOG_WARNING(Service_Audio, "{}", dump);
@@ -101,4 +162,128 @@ u64 CommandListProcessor::Process(u32 session_id) {
     return end_time - start_time_;
 }
 
+void CommandListProcessor::QueueVoiceCommand(Renderer::ICommand& command) {
+    if (voice_runs.empty() || voice_commands[voice_runs.back().first]->node_id != command.node_id) {
+        voice_runs.push_back({
+            .first = voice_commands.size(),
+            .count = 0,
+            .estimated_time = 0,
+            .parallel = true,
+        });
+    }
+    VoiceRun& run{voice_runs.back()};
+    voice_commands.push_back(&command);
+    run.count++;
+    run.estimated_time += command.estimated_process_time;
+    run.parallel &= IsParallelVoiceCommand(command);
+}
+
+void CommandListProcessor::FlushVoiceRuns() {
+    if (voice_runs.empty()) {
+        return;
+    }
+    const size_t num_parallel =
+        std::ranges::count_if(voice_runs, [](const VoiceRun& run) { return run.parallel; });
+    if (num_parallel < MinParallelVoices) {
+        for (const VoiceRun& run : voice_runs) {
+            ProcessVoiceRun(*this, run, false);
+        }
+        voice_runs.clear();
+        voice_commands.clear();
+        return;
+    }
+
+    // Depop preparation is the first thing done for a voice, it consumes the samples left in the
+    // voice state by the previous list and accumulates them in a buffer shared by every voice.
+    for (const VoiceRun& run : voice_runs) {
+        if (!run.parallel) {
+            continue;
+        }
+        for (size_t index = run.first; index < run.first + run.count; index++) {
+            if (voice_commands[index]->type == Renderer::CommandId::DepopPrepare) {
+                ProcessCommand(*this, *voice_commands[index], 1);
+            }
+        }
+    }
+
+    // Balance the estimated time of each thread, the renderer thread takes the first share.
+    const size_t num_threads = worker_buffers.size() + 1;
+    std::vector<std::vector<const VoiceRun*>> shares(num_threads);
+    std::vector<u64> share_times(num_threads);
+    for (const VoiceRun& run : voice_runs) {
+        if (!run.parallel) {
+            continue;
+        }
+        const size_t share = std::ranges::min_element(share_times) - share_times.begin();
+        shares[share].push_back(&run);
+        share_times[share] += run.estimated_time;
+    }
+
+    for (size_t worker = 0; worker < worker_buffers.size(); worker++) {
+        workers->QueueWork([this, worker, runs = std::move(shares[worker + 1])] {
+            std::vector<s32>& buffer{worker_buffers[worker]};
+            std::ranges::fill(buffer, 0);
+
+            CommandListProcessor worker_processor;
+            worker_processor.system = system;
+            worker_processor.memory = memory;
+            worker_processor.sample_count = sample_count;
+            worker_processor.target_sample_rate = target_sample_rate;
+            worker_processor.mix_buffers = buffer;
+            worker_processor.buffer_count = buffer_count;
+            worker_processor.start_time = start_time;
+            worker_processor.current_processing_time = current_processing_time;
+            for (const VoiceRun* run : runs) {
+                ProcessVoiceRun(worker_processor, *run, true);
+            }
+        });
+    }
+    for (const VoiceRun* run : shares[0]) {
+        ProcessVoiceRun(*this, *run, true);
+    }
+    for (const VoiceRun& run : voice_runs) {
+        if (!run.parallel) {
+            ProcessVoiceRun(*this, run, false);
+        }
+    }
+    workers->WaitForRequests();
+
+    // Mixing only adds wrapping 32-bit samples, the order voices are summed in doesn't matter.
+    for (const std::vector<s32>& buffer : worker_buffers) {
+        for (size_t i = 0; i < mix_buffers.size(); i++) {
+            mix_buffers[i] =
+                static_cast<s32>(static_cast<u32>(mix_buffers[i]) + static_cast<u32>(buffer[i]));
+        }
+    }
+    voice_runs.clear();
+    voice_commands.clear();
+}
+
+void CommandListProcessor::ProcessCommand(const CommandListProcessor& processor,
+                                          Renderer::ICommand& command, u64 num_threads) const {
+    if (!host_timings) {
+        command.Process(processor);
+        return;
+    }
+    const auto start{Common::SteadyClock::Now()};
+    command.Process(processor);
+    const auto end{Common::SteadyClock::Now()};
+    // The estimates add up to the time of the whole list, commands processed side by side on
+    // several threads only take their share of it.
+    const auto host_time_ns{static_cast<u64>((end - start).count())};
+    host_timings->Record(command.type, command.estimated_process_time, host_time_ns / num_threads);
+}
+
+void CommandListProcessor::ProcessVoiceRun(const CommandListProcessor& processor,
+                                           const VoiceRun& run, bool skip_depop) const {
+    const u64 num_threads{skip_depop ? worker_buffers.size() + 1 : 1};
+    for (size_t index = run.first; index < run.first + run.count; index++) {
+        Renderer::ICommand& command{*voice_commands[index]};
+        if (skip_depop && command.type == Renderer::CommandId::DepopPrepare) {
+            continue;
+        }
+        ProcessCommand(processor, command, num_threads);
+    }
+}
+
 } // namespace AudioCore::ADSP::AudioRenderer
@@ -1,13 +1,19 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <memory>
 #include <span>
+#include <vector>
 
 #include "audio_core/common/common.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "common/common_types.h"
+#include "common/thread_worker.h"
 
 namespace Core {
 namespace Memory {
@@ -27,12 +33,18 @@ class SinkStream;
 
 namespace Renderer {
 struct CommandListHeader;
-}
+class HostCommandTimings;
+struct ICommand;
+} // namespace Renderer
 
 namespace ADSP::AudioRenderer {
 
 /**
  * A processor for command lists given to the AudioRenderer.
+ *
+ * Voices don't depend on each other, only adding their samples to the mix buffers. When there are
+ * enough of them, they are spread over worker threads mixing into their own buffers, which are
+ * summed into the mix buffers before the first command depending on them.
  */
 class CommandListProcessor {
 public:
@@ -111,6 +123,63 @@ public:
     u64 end_time{};
     /// Last command list string generated, used for dumping audio commands to console
     std::string last_dump{};
+    /// Host processing times of the commands are recorded to it when not null
+    Renderer::HostCommandTimings* host_timings{};
+
+private:
+    /// Enabled commands of a single voice, processed in order on the same thread
+    struct VoiceRun {
+        /// Index of the first command in voice_commands
+        size_t first;
+        /// Number of commands
+        size_t count;
+        /// Sum of the estimated processing time of the commands
+        u64 estimated_time;
+        /// False if a command must be processed on the renderer thread
+        bool parallel;
+    };
+
+    /**
+     * Queue a voice command, to be processed by FlushVoiceRuns.
+     *
+     * @param command - The command to queue.
+     */
+    void QueueVoiceCommand(Renderer::ICommand& command);
+
+    /**
+     * Process the queued voice commands, spreading them over the workers when there are enough.
+     */
+    void FlushVoiceRuns();
+
+    /**
+     * Process a command, recording its host processing time if enabled.
+     *
+     * @param processor   - The processor holding the mix buffers to process into.
+     * @param command     - The command to process.
+     * @param num_threads - The number of threads processing commands alongside this one.
+     */
+    void ProcessCommand(const CommandListProcessor& processor, Renderer::ICommand& command,
+                        u64 num_threads) const;
+
+    /**
+     * Process the commands of a voice.
+     *
+     * @param processor  - The processor holding the mix buffers to process into.
+     * @param run        - The voice commands to process.
+     * @param skip_depop - Skip the depop prepare commands, processed beforehand, which also
+     *                     means the voices are spread over every thread.
+     */
+    void ProcessVoiceRun(const CommandListProcessor& processor, const VoiceRun& run,
+                         bool skip_depop) const;
+
+    /// Threads processing voices along with the renderer, null when voices are processed serially
+    std::unique_ptr<Common::ThreadWorker> workers;
+    /// Private mix buffers of each worker
+    std::vector<std::vector<s32>> worker_buffers;
+    /// Enabled voice commands waiting to be processed
+    std::vector<Renderer::ICommand*> voice_commands;
+    /// Voices waiting to be processed
+    std::vector<VoiceRun> voice_runs;
 };
 
 } // namespace ADSP::AudioRenderer
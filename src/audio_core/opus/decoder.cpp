@@ -117,13 +117,21 @@ Result OpusDecoder::DecodeInterleaved(u32* out_data_size, u64* out_time_taken,
         shared_memory_mapped = true;
     }
 
-    std::memcpy(in_data.data(), input_data.data() + sizeof(OpusPacketHeader), header.size);
-
-    R_TRY(hardware_opus.DecodeInterleaved(out_samples, out_data.data(), out_data.size_bytes(),
-                                          channel_count, in_data.data(), header.size,
-                                          shared_buffer.get(), time_taken, reset));
-
-    std::memcpy(output_data.data(), out_data.data(), out_samples * channel_count * sizeof(s16));
+    // The guest buffers stay valid while the DSP decodes, so read the packet in place and write
+    // straight to the output when it can hold a full frame, instead of staging both in the
+    // shared buffer.
+    const u8* packet{input_data.data() + sizeof(OpusPacketHeader)};
+    const bool direct_output{output_data.size_bytes() >= out_data.size_bytes()};
+    u8* decode_output{direct_output ? output_data.data() : out_data.data()};
+
+    R_TRY(hardware_opus.DecodeInterleaved(out_samples, decode_output, out_data.size_bytes(),
+                                          channel_count, packet, header.size, shared_buffer.get(),
+                                          time_taken, reset));
+
+    if (!direct_output) {
+        std::memcpy(output_data.data(), out_data.data(),
+                    out_samples * channel_count * sizeof(s16));
+    }
 
     *out_data_size = header.size + sizeof(OpusPacketHeader);
     *out_sample_count = out_samples;
@@ -163,13 +171,21 @@ Result OpusDecoder::DecodeInterleavedForMultiStream(u32* out_data_size, u64* out
         shared_memory_mapped = true;
     }
 
-    std::memcpy(in_data.data(), input_data.data() + sizeof(OpusPacketHeader), header.size);
+    // The guest buffers stay valid while the DSP decodes, so read the packet in place and write
+    // straight to the output when it can hold a full frame, instead of staging both in the
+    // shared buffer.
+    const u8* packet{input_data.data() + sizeof(OpusPacketHeader)};
+    const bool direct_output{output_data.size_bytes() >= out_data.size_bytes()};
+    u8* decode_output{direct_output ? output_data.data() : out_data.data()};
 
     R_TRY(hardware_opus.DecodeInterleavedForMultiStream(
-        out_samples, out_data.data(), out_data.size_bytes(), channel_count, in_data.data(),
-        header.size, shared_buffer.get(), time_taken, reset));
+        out_samples, decode_output, out_data.size_bytes(), channel_count, packet, header.size,
+        shared_buffer.get(), time_taken, reset));
 
-    std::memcpy(output_data.data(), out_data.data(), out_samples * channel_count * sizeof(s16));
+    if (!direct_output) {
+        std::memcpy(output_data.data(), out_data.data(),
+                    out_samples * channel_count * sizeof(s16));
+    }
 
     *out_data_size = header.size + sizeof(OpusPacketHeader);
     *out_sample_count = out_samples;
@@ -150,9 +150,9 @@ Result HardwareOpus::ShutdownMultiStreamDecodeObject(void* buffer, u64 buffer_si
 }
 
 Result HardwareOpus::DecodeInterleaved(u32& out_sample_count, void* output_data,
-                                       u64 output_data_size, u32 channel_count, void* input_data,
-                                       u64 input_data_size, void* buffer, u64& out_time_taken,
-                                       bool reset) {
+                                       u64 output_data_size, u32 channel_count,
+                                       const void* input_data, u64 input_data_size, void* buffer,
+                                       u64& out_time_taken, bool reset) {
     std::scoped_lock l{mutex};
     shared_memory.host_send_data[0] = (u64)buffer;
     shared_memory.host_send_data[1] = (u64)input_data;
@@ -180,7 +180,7 @@ Result HardwareOpus::DecodeInterleaved(u32& out_sample_count, void* output_data,
 
 Result HardwareOpus::DecodeInterleavedForMultiStream(u32& out_sample_count, void* output_data,
                                                      u64 output_data_size, u32 channel_count,
-                                                     void* input_data, u64 input_data_size,
+                                                     const void* input_data, u64 input_data_size,
                                                      void* buffer, u64& out_time_taken,
                                                      bool reset) {
     std::scoped_lock l{mutex};
@@ -27,12 +27,12 @@ public:
     Result ShutdownDecodeObject(void* buffer, u64 buffer_size);
     Result ShutdownMultiStreamDecodeObject(void* buffer, u64 buffer_size);
     Result DecodeInterleaved(u32& out_sample_count, void* output_data, u64 output_data_size,
-                             u32 channel_count, void* input_data, u64 input_data_size, void* buffer,
-                             u64& out_time_taken, bool reset);
+                             u32 channel_count, const void* input_data, u64 input_data_size,
+                             void* buffer, u64& out_time_taken, bool reset);
     Result DecodeInterleavedForMultiStream(u32& out_sample_count, void* output_data,
                                            u64 output_data_size, u32 channel_count,
-                                           void* input_data, u64 input_data_size, void* buffer,
-                                           u64& out_time_taken, bool reset);
+                                           const void* input_data, u64 input_data_size,
+                                           void* buffer, u64& out_time_taken, bool reset);
     Result MapMemory(void* buffer, u64 buffer_size);
     Result UnmapMemory(void* buffer, u64 buffer_size);
 
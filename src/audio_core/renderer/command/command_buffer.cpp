@@ -8,6 +8,7 @@
 #include "audio_core/renderer/command/command_buffer.h"
 #include "audio_core/renderer/command/command_list_header.h"
 #include "audio_core/renderer/command/command_processing_time_estimator.h"
+#include "audio_core/renderer/command/host_command_timings.h"
 #include "audio_core/renderer/effect/biquad_filter.h"
 #include "audio_core/renderer/effect/delay.h"
 #include "audio_core/renderer/effect/reverb.h"
@@ -44,6 +45,9 @@ T& CommandBuffer::GenerateStart(const s32 node_id) {
 template <typename T>
 void CommandBuffer::GenerateEnd(T& cmd) {
     cmd.estimated_process_time = time_estimator->Estimate(cmd);
+    if (host_timings) {
+        cmd.estimated_process_time = host_timings->Calibrate(cmd.type, cmd.estimated_process_time);
+    }
     estimated_process_time += cmd.estimated_process_time;
     size += sizeof(T);
     count++;
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -14,6 +17,7 @@ namespace AudioCore::Renderer {
 struct UpsamplerInfo;
 struct VoiceState;
 class EffectInfoBase;
+class HostCommandTimings;
 class ICommandProcessingTimeEstimator;
 class MixInfo;
 class MemoryPoolInfo;
@@ -455,6 +459,8 @@ public:
     MemoryPoolInfo* memory_pool{};
     /// Used for estimating command process times
     ICommandProcessingTimeEstimator* time_estimator{};
+    /// Used for calibrating the estimates to the host, if not null
+    const HostCommandTimings* host_timings{};
     /// Used to check which rendering features are currently enabled
     BehaviorInfo* behavior{};
 
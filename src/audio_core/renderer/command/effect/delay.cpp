@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -76,6 +79,37 @@ template <size_t NumChannels>
 static void ApplyDelay(const DelayInfo::ParameterVersion1& params, DelayInfo::State& state,
                        std::span<std::span<const s32>> inputs, std::span<std::span<s32>> outputs,
                        const u32 sample_count) {
+    // The feedback matrix only depends on the state, build it once rather than for every sample
+    // clang-format off
+    std::array<std::array<Common::FixedPoint<18, 14>, NumChannels>, NumChannels> matrix{};
+    if constexpr (NumChannels == 1) {
+        matrix = {{
+            {state.feedback_gain},
+        }};
+    } else if constexpr (NumChannels == 2) {
+        matrix = {{
+            {state.delay_feedback_gain, state.delay_feedback_cross_gain},
+            {state.delay_feedback_cross_gain, state.delay_feedback_gain},
+        }};
+    } else if constexpr (NumChannels == 4) {
+        matrix = {{
+            {state.delay_feedback_gain, state.delay_feedback_cross_gain, state.delay_feedback_cross_gain, 0.0f},
+            {state.delay_feedback_cross_gain, state.delay_feedback_gain, 0.0f, state.delay_feedback_cross_gain},
+            {state.delay_feedback_cross_gain, 0.0f, state.delay_feedback_gain, state.delay_feedback_cross_gain},
+            {0.0f, state.delay_feedback_cross_gain, state.delay_feedback_cross_gain, state.delay_feedback_gain},
+        }};
+    } else if constexpr (NumChannels == 6) {
+        matrix = {{
+            {state.delay_feedback_gain, 0.0f, state.delay_feedback_cross_gain, 0.0f, state.delay_feedback_cross_gain, 0.0f},
+            {0.0f, state.delay_feedback_gain, state.delay_feedback_cross_gain, 0.0f, 0.0f, state.delay_feedback_cross_gain},
+            {state.delay_feedback_cross_gain, state.delay_feedback_cross_gain, state.delay_feedback_gain, 0.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 0.0f, params.feedback_gain, 0.0f, 0.0f},
+            {state.delay_feedback_cross_gain, 0.0f, 0.0f, 0.0f, state.delay_feedback_gain, state.delay_feedback_cross_gain},
+            {0.0f, state.delay_feedback_cross_gain, 0.0f, 0.0f, state.delay_feedback_cross_gain, state.delay_feedback_gain},
+        }};
+    }
+    // clang-format on
+
     for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
         std::array<Common::FixedPoint<50, 14>, NumChannels> input_samples{};
         for (u32 channel = 0; channel < NumChannels; channel++) {
@@ -87,41 +121,14 @@ static void ApplyDelay(const DelayInfo::ParameterVersion1& params, DelayInfo::St
             delay_samples[channel] = state.delay_lines[channel].Read();
         }
 
-        // clang-format off
-        std::array<std::array<Common::FixedPoint<18, 14>, NumChannels>, NumChannels> matrix{};
-        if constexpr (NumChannels == 1) {
-            matrix = {{
-                {state.feedback_gain},
-            }};
-        } else if constexpr (NumChannels == 2) {
-            matrix = {{
-                {state.delay_feedback_gain, state.delay_feedback_cross_gain},
-                {state.delay_feedback_cross_gain, state.delay_feedback_gain},
-            }};
-        } else if constexpr (NumChannels == 4) {
-            matrix = {{
-                {state.delay_feedback_gain, state.delay_feedback_cross_gain, state.delay_feedback_cross_gain, 0.0f},
-                {state.delay_feedback_cross_gain, state.delay_feedback_gain, 0.0f, state.delay_feedback_cross_gain},
-                {state.delay_feedback_cross_gain, 0.0f, state.delay_feedback_gain, state.delay_feedback_cross_gain},
-                {0.0f, state.delay_feedback_cross_gain, state.delay_feedback_cross_gain, state.delay_feedback_gain},
-            }};
-        } else if constexpr (NumChannels == 6) {
-            matrix = {{
-                {state.delay_feedback_gain, 0.0f, state.delay_feedback_cross_gain, 0.0f, state.delay_feedback_cross_gain, 0.0f},
-                {0.0f, state.delay_feedback_gain, state.delay_feedback_cross_gain, 0.0f, 0.0f, state.delay_feedback_cross_gain},
-                {state.delay_feedback_cross_gain, state.delay_feedback_cross_gain, state.delay_feedback_gain, 0.0f, 0.0f, 0.0f},
-                {0.0f, 0.0f, 0.0f, params.feedback_gain, 0.0f, 0.0f},
-                {state.delay_feedback_cross_gain, 0.0f, 0.0f, 0.0f, state.delay_feedback_gain, state.delay_feedback_cross_gain},
-                {0.0f, state.delay_feedback_cross_gain, 0.0f, 0.0f, state.delay_feedback_cross_gain, state.delay_feedback_gain},
-            }};
-        }
-        // clang-format on
-
         std::array<Common::FixedPoint<50, 14>, NumChannels> gained_samples{};
         for (u32 channel = 0; channel < NumChannels; channel++) {
             Common::FixedPoint<50, 14> delay{};
             for (u32 j = 0; j < NumChannels; j++) {
-                delay += delay_samples[j] * matrix[j][channel];
+                // Most channels don't feed each other, a zero gain adds nothing to the sum
+                if (matrix[j][channel].to_raw() != 0) {
+                    delay += delay_samples[j] * matrix[j][channel];
+                }
             }
             gained_samples[channel] = input_samples[channel] * params.in_gain + delay;
         }
@@ -213,20 +213,24 @@ static void ApplyI3dl2ReverbEffectBypass(std::span<std::span<const s32>> inputs,
  * @param decay0 - The first decay line.
  * @param decay1 - The second decay line.
  * @param fdn    - Feedback delay network.
+ * @param gain0  - Wet gain of the first decay line, in fixed point.
+ * @param gain1  - Wet gain of the second decay line, in fixed point.
  * @param mix    - The new calculated sample to be written and decayed.
  * @return The next delayed and decayed sample.
  */
 static Common::FixedPoint<50, 14> Axfx2AllPassTick(I3dl2ReverbInfo::I3dl2DelayLine& decay0,
                                                    I3dl2ReverbInfo::I3dl2DelayLine& decay1,
                                                    I3dl2ReverbInfo::I3dl2DelayLine& fdn,
+                                                   const Common::FixedPoint<50, 14> gain0,
+                                                   const Common::FixedPoint<50, 14> gain1,
                                                    const Common::FixedPoint<50, 14> mix) {
     auto val{decay0.Read()};
-    auto mixed{mix - (val * decay0.wet_gain)};
-    auto out{decay0.Tick(mixed) + (mixed * decay0.wet_gain)};
+    auto mixed{mix - (val * gain0)};
+    auto out{decay0.Tick(mixed) + (mixed * gain0)};
 
     val = decay1.Read();
-    mixed = out - (val * decay1.wet_gain);
-    out = decay1.Tick(mixed) + (mixed * decay1.wet_gain);
+    mixed = out - (val * gain1);
+    out = decay1.Tick(mixed) + (mixed * gain1);
 
     fdn.Tick(out);
     return out;
@@ -271,19 +275,39 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
         tap_indexes = OutTapIndexes6Ch;
     }
 
+    // The gains are floats that only change with the parameters, every product with a sample used
+    // to convert them to fixed point again. Convert them once for the whole buffer instead.
+    std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayTaps> early_gains{};
+    for (u32 early_tap = 0; early_tap < I3dl2ReverbInfo::MaxDelayTaps; early_tap++) {
+        early_gains[early_tap] = EarlyGains[early_tap];
+    }
+    const Common::FixedPoint<50, 14> early_gain{state.early_gain};
+    const Common::FixedPoint<50, 14> late_gain{state.late_gain};
+    const Common::FixedPoint<50, 14> lowpass_gain{state.lowpass_2};
+    const Common::FixedPoint<50, 14> center_gain{0.5f};
+    std::array<std::array<Common::FixedPoint<50, 14>, 3>, I3dl2ReverbInfo::MaxDelayLines>
+        lowpass_coeff{};
+    std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> decay_gains0{};
+    std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> decay_gains1{};
+    for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+        for (u32 i = 0; i < 3; i++) {
+            lowpass_coeff[delay_line][i] = state.lowpass_coeff[delay_line][i];
+        }
+        decay_gains0[delay_line] = state.decay_delay_lines0[delay_line].wet_gain;
+        decay_gains1[delay_line] = state.decay_delay_lines1[delay_line].wet_gain;
+    }
+
     for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
         Common::FixedPoint<50, 14> early_to_late_tap{
             state.early_delay_line.TapOut(state.early_to_late_taps)};
         std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
 
         for (u32 early_tap = 0; early_tap < I3dl2ReverbInfo::MaxDelayTaps; early_tap++) {
-            output_samples[tap_indexes[early_tap]] +=
-                state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
-                EarlyGains[early_tap];
+            const auto sample{state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
+                              early_gains[early_tap]};
+            output_samples[tap_indexes[early_tap]] += sample;
             if constexpr (NumChannels == 6) {
-                output_samples[static_cast<u32>(Channels::LFE)] +=
-                    state.early_delay_line.TapOut(state.early_tap_steps[early_tap]) *
-                    EarlyGains[early_tap];
+                output_samples[static_cast<u32>(Channels::LFE)] += sample;
             }
         }
 
@@ -293,36 +317,39 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
         }
 
         state.lowpass_0 =
-            (current_sample * state.lowpass_2 + state.lowpass_0 * state.lowpass_1).to_float();
+            (current_sample * lowpass_gain + state.lowpass_0 * state.lowpass_1).to_float();
         state.early_delay_line.Tick(state.lowpass_0);
 
         for (u32 channel = 0; channel < NumChannels; channel++) {
-            output_samples[channel] *= state.early_gain;
+            output_samples[channel] *= early_gain;
         }
 
         std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> filtered_samples{};
         for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
+            const auto fdn_sample{state.fdn_delay_lines[delay_line].Read()};
             filtered_samples[delay_line] =
-                state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][0] +
-                state.shelf_filter[delay_line];
+                fdn_sample * lowpass_coeff[delay_line][0] + state.shelf_filter[delay_line];
             state.shelf_filter[delay_line] =
-                (filtered_samples[delay_line] * state.lowpass_coeff[delay_line][2] +
-                 state.fdn_delay_lines[delay_line].Read() * state.lowpass_coeff[delay_line][1])
+                (filtered_samples[delay_line] * lowpass_coeff[delay_line][2] +
+                 fdn_sample * lowpass_coeff[delay_line][1])
                     .to_float();
         }
 
+        const auto late_sample{early_to_late_tap * late_gain};
         const std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> mix_matrix{
-            filtered_samples[1] + filtered_samples[2] + early_to_late_tap * state.late_gain,
-            -filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[0] - filtered_samples[3] + early_to_late_tap * state.late_gain,
-            filtered_samples[1] - filtered_samples[2] + early_to_late_tap * state.late_gain,
+            filtered_samples[1] + filtered_samples[2] + late_sample,
+            -filtered_samples[0] - filtered_samples[3] + late_sample,
+            filtered_samples[0] - filtered_samples[3] + late_sample,
+            filtered_samples[1] - filtered_samples[2] + late_sample,
         };
 
         std::array<Common::FixedPoint<50, 14>, I3dl2ReverbInfo::MaxDelayLines> allpass_samples{};
         for (u32 delay_line = 0; delay_line < I3dl2ReverbInfo::MaxDelayLines; delay_line++) {
-            allpass_samples[delay_line] = Axfx2AllPassTick(
-                state.decay_delay_lines0[delay_line], state.decay_delay_lines1[delay_line],
-                state.fdn_delay_lines[delay_line], mix_matrix[delay_line]);
+            allpass_samples[delay_line] =
+                Axfx2AllPassTick(state.decay_delay_lines0[delay_line],
+                                 state.decay_delay_lines1[delay_line],
+                                 state.fdn_delay_lines[delay_line], decay_gains0[delay_line],
+                                 decay_gains1[delay_line], mix_matrix[delay_line]);
         }
 
         if constexpr (NumChannels == 6) {
@@ -335,7 +362,7 @@ static void ApplyI3dl2ReverbEffect(I3dl2ReverbInfo::State& state,
                 Common::FixedPoint<50, 14> allpass{};
 
                 if (channel == static_cast<u32>(Channels::Center)) {
-                    allpass = state.center_delay_line.Tick(allpass_outputs[channel] * 0.5f);
+                    allpass = state.center_delay_line.Tick(allpass_outputs[channel] * center_gain);
                 } else {
                     allpass = allpass_outputs[channel];
                 }
@@ -312,6 +312,19 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         tap_indexes = OutTapIndexes6Ch;
     }
 
+    // Gains are the same for every sample, convert them once instead of in the sample loop
+    const auto base_gain{Common::FixedPoint<50, 14>::from_base(params.base_gain)};
+    const auto late_gain{Common::FixedPoint<50, 14>::from_base(params.late_gain)};
+    const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
+    const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
+    const Common::FixedPoint<50, 14> lfe_gain{0.2f};
+    const Common::FixedPoint<50, 14> center_gain{0.5f};
+
+    // Dividing by 64 as a fixed point number widens to 128 bits, dividing the raw value is the same
+    const auto scale_down = [](Common::FixedPoint<50, 14> sample) {
+        return Common::FixedPoint<50, 14>::from_base(sample.to_raw() / 64);
+    };
+
     for (u32 sample_index = 0; sample_index < sample_count; sample_index++) {
         std::array<Common::FixedPoint<50, 14>, NumChannels> output_samples{};
 
@@ -325,7 +338,7 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         }
 
         if constexpr (NumChannels == 6) {
-            output_samples[static_cast<u32>(Channels::LFE)] *= 0.2f;
+            output_samples[static_cast<u32>(Channels::LFE)] *= lfe_gain;
         }
 
         Common::FixedPoint<50, 14> input_sample{};
@@ -334,7 +347,7 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         }
 
         input_sample *= 64;
-        input_sample *= Common::FixedPoint<50, 14>::from_base(params.base_gain);
+        input_sample *= base_gain;
         state.pre_delay_line.Write(input_sample);
 
         for (u32 i = 0; i < ReverbInfo::MaxDelayLines; i++) {
@@ -344,8 +357,7 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
         }
 
         Common::FixedPoint<50, 14> pre_delay_sample{
-            state.pre_delay_line.TapOut(state.pre_delay_time) *
-            Common::FixedPoint<50, 14>::from_base(params.late_gain)};
+            state.pre_delay_line.TapOut(state.pre_delay_time) * late_gain};
 
         std::array<Common::FixedPoint<50, 14>, ReverbInfo::MaxDelayLines> mix_matrix{
             state.prev_feedback_output[2] + state.prev_feedback_output[1] + pre_delay_sample,
@@ -360,9 +372,6 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
                                                   state.fdn_delay_lines[i], mix_matrix[i]);
         }
 
-        const auto dry_gain{Common::FixedPoint<50, 14>::from_base(params.dry_gain)};
-        const auto wet_gain{Common::FixedPoint<50, 14>::from_base(params.wet_gain)};
-
         if constexpr (NumChannels == 6) {
             const std::array<Common::FixedPoint<50, 14>, MaxChannels> allpass_outputs{
                 allpass_samples[0], allpass_samples[1], allpass_samples[2] - allpass_samples[3],
@@ -374,19 +383,19 @@ static void ApplyReverbEffect(const ReverbInfo::ParameterVersion2& params, Rever
 
                 Common::FixedPoint<50, 14> allpass{};
                 if (channel == static_cast<u32>(Channels::Center)) {
-                    allpass = state.center_delay_line.Tick(allpass_outputs[channel] * 0.5f);
+                    allpass = state.center_delay_line.Tick(allpass_outputs[channel] * center_gain);
                 } else {
                     allpass = allpass_outputs[channel];
                 }
 
-                auto out_sample{((output_samples[channel] + allpass) * wet_gain) / 64};
+                auto out_sample{scale_down((output_samples[channel] + allpass) * wet_gain)};
                 outputs[channel][sample_index] = (in_sample + out_sample).to_int();
             }
         } else {
             for (u32 channel = 0; channel < NumChannels; channel++) {
                 auto in_sample{inputs[channel][sample_index] * dry_gain};
-                auto out_sample{((output_samples[channel] + allpass_samples[channel]) * wet_gain) /
-                                64};
+                auto out_sample{
+                    scale_down((output_samples[channel] + allpass_samples[channel]) * wet_gain)};
                 outputs[channel][sample_index] = (in_sample + out_sample).to_int();
             }
         }
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+
+#include "audio_core/renderer/command/host_command_timings.h"
+
+namespace AudioCore::Renderer {
+
+HostCommandTimings::HostCommandTimings() {
+    // Trust the hardware model until the host has been measured
+    for (auto& scale : scales) {
+        scale.store(1.0f, std::memory_order_relaxed);
+    }
+}
+
+void HostCommandTimings::Record(CommandId type, u32 estimated, u64 host_time_ns) {
+    const auto index = static_cast<size_t>(type);
+    if (index >= NumCommandTypes || estimated == 0) {
+        return;
+    }
+    const auto host_cycles = static_cast<u64>(static_cast<f64>(host_time_ns) * CyclesPerNs);
+    samples[index].estimated.fetch_add(estimated, std::memory_order_relaxed);
+    samples[index].host_cycles.fetch_add(host_cycles, std::memory_order_relaxed);
+}
+
+void HostCommandTimings::Update() {
+    for (size_t index = 0; index < NumCommandTypes; index++) {
+        const u64 estimated = samples[index].estimated.exchange(0, std::memory_order_relaxed);
+        const u64 host_cycles = samples[index].host_cycles.exchange(0, std::memory_order_relaxed);
+        if (estimated == 0) {
+            continue;
+        }
+        // The recorded estimates were calibrated already, by about the current scale
+        const f32 scale = scales[index].load(std::memory_order_relaxed);
+        const auto measured = static_cast<f32>(static_cast<f64>(host_cycles) /
+                                               static_cast<f64>(estimated)) *
+                              scale;
+        scales[index].store(std::clamp(scale + (measured - scale) * UpdateWeight, MinScale,
+                                       MaxScale),
+                            std::memory_order_relaxed);
+    }
+}
+
+u32 HostCommandTimings::Calibrate(CommandId type, u32 estimated) const {
+    const auto index = static_cast<size_t>(type);
+    if (index >= NumCommandTypes) {
+        return estimated;
+    }
+    const f32 scale = scales[index].load(std::memory_order_relaxed);
+    return static_cast<u32>(static_cast<f32>(estimated) * scale);
+}
+
+} // namespace AudioCore::Renderer
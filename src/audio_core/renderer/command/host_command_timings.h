@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+
+#include "audio_core/renderer/command/icommand.h"
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+/**
+ * Learns how much longer, or shorter, each type of command takes to process on the host than the
+ * hardware model of the processing time estimator says. The estimates of new commands are scaled
+ * by it, so voice dropping kicks in when the host can't keep up rather than never.
+ */
+class HostCommandTimings {
+public:
+    /// DSP cycles estimates are counted in per nanosecond, 2'880'000 per 5ms audio frame
+    static constexpr f64 CyclesPerNs = 0.576;
+    /// Weight of the latest render in the scale of a command type
+    static constexpr f32 UpdateWeight = 0.05f;
+    static constexpr f32 MinScale = 1.0f / 64.0f;
+    static constexpr f32 MaxScale = 64.0f;
+
+    HostCommandTimings();
+
+    /**
+     * Record the host time taken by a processed command. Thread-safe.
+     *
+     * @param type          - Type of the command.
+     * @param estimated     - Its estimated processing time, in DSP cycles, as calibrated.
+     * @param host_time_ns  - Its measured processing time on the host.
+     */
+    void Record(CommandId type, u32 estimated, u64 host_time_ns);
+
+    /**
+     * Fold the commands recorded since the last update into the scales, called once per render.
+     */
+    void Update();
+
+    /**
+     * Scale an estimate from the hardware model to the host.
+     *
+     * @param type      - Type of the command.
+     * @param estimated - Its estimated processing time, in DSP cycles.
+     * @return The estimated processing time of the command on the host, in DSP cycles.
+     */
+    u32 Calibrate(CommandId type, u32 estimated) const;
+
+private:
+    static constexpr size_t NumCommandTypes = static_cast<size_t>(CommandId::Compressor) + 1;
+
+    struct Samples {
+        std::atomic<u64> estimated{};
+        std::atomic<u64> host_cycles{};
+    };
+
+    std::array<Samples, NumCommandTypes> samples{};
+    std::array<std::atomic<f32>, NumCommandTypes> scales{};
+};
+
+} // namespace AudioCore::Renderer
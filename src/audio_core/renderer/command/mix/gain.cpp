@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <limits>
+
+#include "audio_core/renderer/command/mix/gain.h"
+#include "common/fixed_point.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace AudioCore::Renderer {
+namespace {
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define SSE41_TARGET __attribute__((target("sse4.1")))
+#else
+#define SSE41_TARGET
+#endif
+
+constexpr u32 LANES = 4;
+
+/**
+ * The vector kernels multiply 32-bit lanes, only use them when the raw fixed point volume fits in
+ * 32 bits for every sample. It's the case for any volume from games, both ends of the ramp are
+ * enough to check as it's linear.
+ */
+bool FitsInLanes(s64 volume, s64 ramp, u32 sample_count) {
+    const s64 last = volume + ramp * static_cast<s64>(sample_count - 1);
+    const auto fits = [](s64 value) {
+        return value >= std::numeric_limits<s32>::min() &&
+               value <= std::numeric_limits<s32>::max();
+    };
+    return fits(volume) && fits(ramp) && fits(last);
+}
+
+#ifdef ARCHITECTURE_x86_64
+template <size_t Q>
+SSE41_TARGET __m128i GainLanes(__m128i input, __m128i volume) {
+    // Same rounding as FixedPoint::to_int, only the low 32 bits of each result are kept so the
+    // logical shift gives the same value as an arithmetic one.
+    const __m128i fractional_mask = _mm_set1_epi64x((s64{1} << Q) - 1);
+    const auto round = [&](__m128i product) {
+        const __m128i fraction = _mm_and_si128(product, fractional_mask);
+        product = _mm_add_epi64(product, _mm_srli_epi64(fraction, 1));
+        return _mm_srli_epi64(product, Q);
+    };
+    const __m128i even = round(_mm_mul_epi32(input, volume));
+    const __m128i odd =
+        round(_mm_mul_epi32(_mm_srli_epi64(input, 32), _mm_srli_epi64(volume, 32)));
+    return _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+}
+
+template <size_t Q, bool ACCUMULATE>
+SSE41_TARGET void ApplyGainSSE41(s32* output, const s32* input, s32 volume, s32 ramp,
+                                 u32 count) {
+    const __m128i lane_ramp = _mm_mullo_epi32(_mm_set1_epi32(ramp), _mm_setr_epi32(0, 1, 2, 3));
+    __m128i volumes = _mm_add_epi32(_mm_set1_epi32(volume), lane_ramp);
+    const __m128i step = _mm_set1_epi32(static_cast<s32>(static_cast<u32>(ramp) * LANES));
+    for (u32 i = 0; i < count; i += LANES) {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i result = GainLanes<Q>(samples, volumes);
+        if constexpr (ACCUMULATE) {
+            result = _mm_add_epi32(result,
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+        volumes = _mm_add_epi32(volumes, step);
+    }
+}
+#elif defined(__ARM_NEON)
+template <size_t Q>
+int32x2_t GainLanes(int32x2_t input, int32x2_t volume) {
+    // Same rounding as FixedPoint::to_int, narrowing keeps the low 32 bits like the cast does.
+    const int64x2_t fractional_mask = vdupq_n_s64((s64{1} << Q) - 1);
+    int64x2_t product = vmull_s32(input, volume);
+    product = vaddq_s64(product, vshrq_n_s64(vandq_s64(product, fractional_mask), 1));
+    return vmovn_s64(vshrq_n_s64(product, Q));
+}
+
+template <size_t Q, bool ACCUMULATE>
+void ApplyGainNEON(s32* output, const s32* input, s32 volume, s32 ramp, u32 count) {
+    static constexpr s32 lane_index[LANES]{0, 1, 2, 3};
+    int32x4_t volumes = vmlaq_n_s32(vdupq_n_s32(volume), vld1q_s32(lane_index), ramp);
+    const int32x4_t step = vdupq_n_s32(static_cast<s32>(static_cast<u32>(ramp) * LANES));
+    for (u32 i = 0; i < count; i += LANES) {
+        const int32x4_t samples = vld1q_s32(input + i);
+        const int32x2_t low = GainLanes<Q>(vget_low_s32(samples), vget_low_s32(volumes));
+        const int32x2_t high = GainLanes<Q>(vget_high_s32(samples), vget_high_s32(volumes));
+        int32x4_t result = vcombine_s32(low, high);
+        if constexpr (ACCUMULATE) {
+            result = vaddq_s32(result, vld1q_s32(output + i));
+        }
+        vst1q_s32(output + i, result);
+        volumes = vaddq_s32(volumes, step);
+    }
+}
+#endif
+
+/// Processes as many samples as possible with the vector kernels, returns how many were done.
+template <size_t Q, bool ACCUMULATE>
+u32 ApplyGainVector(s32* output, const s32* input, s64 volume, s64 ramp, u32 sample_count) {
+    // The last sample is always left to the scalar loop, it's the one returned for depopping.
+    const u32 count = (sample_count - 1) & ~(LANES - 1);
+    if (count == 0 || !FitsInLanes(volume, ramp, sample_count)) {
+        return 0;
+    }
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::GetCPUCaps().sse4_1) {
+        ApplyGainSSE41<Q, ACCUMULATE>(output, input, static_cast<s32>(volume),
+                                      static_cast<s32>(ramp), count);
+        return count;
+    }
+    return 0;
+#elif defined(__ARM_NEON)
+    ApplyGainNEON<Q, ACCUMULATE>(output, input, static_cast<s32>(volume), static_cast<s32>(ramp),
+                                 count);
+    return count;
+#else
+    return 0;
+#endif
+}
+
+} // Anonymous namespace
+
+template <size_t Q, bool ACCUMULATE>
+s32 ApplyGain(std::span<s32> output, std::span<const s32> input, const f32 volume_,
+              const f32 ramp_, const u32 sample_count) {
+    using Fixed = Common::FixedPoint<64 - Q, Q>;
+    const Fixed ramp{ramp_};
+    Fixed volume{volume_};
+    Fixed sample{0};
+    if (sample_count == 0) {
+        return sample.to_int();
+    }
+
+    const u32 first = ApplyGainVector<Q, ACCUMULATE>(output.data(), input.data(),
+                                                      volume.to_raw(), ramp.to_raw(), sample_count);
+    volume = Fixed::from_base(volume.to_raw() + ramp.to_raw() * static_cast<s64>(first));
+    for (u32 i = first; i < sample_count; i++) {
+        sample = input[i] * volume;
+        if constexpr (ACCUMULATE) {
+            output[i] = (output[i] + sample).to_int();
+        } else {
+            Fixed gained{sample};
+            output[i] = gained.to_int();
+        }
+        volume += ramp;
+    }
+    return sample.to_int();
+}
+
+template s32 ApplyGain<15, true>(std::span<s32>, std::span<const s32>, f32, f32, u32);
+template s32 ApplyGain<15, false>(std::span<s32>, std::span<const s32>, f32, f32, u32);
+template s32 ApplyGain<23, true>(std::span<s32>, std::span<const s32>, f32, f32, u32);
+template s32 ApplyGain<23, false>(std::span<s32>, std::span<const s32>, f32, f32, u32);
+
+} // namespace AudioCore::Renderer
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+/**
+ * Apply a ramped volume to the input mix buffer, either mixing the result into the output mix
+ * buffer or replacing it.
+ * Results are bit-exact with the fixed point arithmetic used by the mix and volume commands,
+ * using SIMD when the host supports it.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @tparam ACCUMULATE  - True to add the gained input to the output, false to overwrite it.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer.
+ * @param volume       - Volume applied to the first input sample.
+ * @param ramp         - Ramp applied to volume every sample.
+ * @param sample_count - Number of samples to process.
+ * @return The final gained input sample, used for depopping.
+ */
+template <size_t Q, bool ACCUMULATE>
+s32 ApplyGain(std::span<s32> output, std::span<const s32> input, f32 volume, f32 ramp,
+              u32 sample_count);
+
+} // namespace AudioCore::Renderer
@@ -32,6 +32,7 @@
 #include "audio_core/renderer/voice/voice_info.h"
 #include "audio_core/renderer/voice/voice_state.h"
 #include "common/alignment.h"
+#include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_event.h"
@@ -669,6 +670,10 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
         .memory_pool_info{&memory_pool_info},
     };
 
+    // Voices are also dropped when the host can't keep up, going by the measured command timings
+    const bool host_timed{Settings::values.audio_host_timing_voice_drop.GetValue() &&
+                          execution_mode == ExecutionMode::Auto};
+
     CommandBuffer command_buffer{
         .command_list{in_command_buffer},
         .sample_count{sample_count},
@@ -678,6 +683,7 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
         .estimated_process_time{0},
         .memory_pool{&memory_pool_info},
         .time_estimator{command_processing_time_estimator.get()},
+        .host_timings{host_timed ? &audio_renderer.GetHostCommandTimings() : nullptr},
         .behavior{&behavior},
     };
 
@@ -700,7 +706,7 @@ u64 System::GenerateCommand(std::span<u8> in_command_buffer,
     command_generator.GenerateFinalMixCommands();
     command_generator.GenerateSinkCommands();
 
-    if (drop_voice) {
+    if (drop_voice || host_timed) {
         f32 time_limit_percent{70.0f};
         if (render_context.behavior->IsAudioRendererProcessingTimeLimit80PercentSupported()) {
             time_limit_percent = 80.0f;
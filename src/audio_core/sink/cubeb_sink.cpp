@@ -74,6 +74,7 @@ public:
         }
 
         minimum_latency = (std::max)(minimum_latency, TargetSampleCount * 2);
+        device_latency_frames = minimum_latency;
 
         LOG_INFO(Service_Audio,
                  "Opening cubeb stream {} type {} with: rate {} channels {} (system channels {}) "
@@ -165,6 +165,7 @@ private:
 
         m_stream->setBufferSizeInFrames(TargetSampleCount * 2);
         device_channels = m_stream->getChannelCount();
+        device_latency_frames = static_cast<u32>(m_stream->getBufferSizeInFrames());
 
         const auto sample_rate = m_stream->getSampleRate();
         const auto buffer_capacity = m_stream->getBufferCapacityInFrames();
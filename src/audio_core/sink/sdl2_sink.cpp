@@ -66,6 +66,8 @@ public:
             return;
         }
 
+        device_latency_frames = obtained.samples;
+
         LOG_INFO(Service_Audio,
                  "Opening SDL stream {} with: rate {} channels {} (system channels {}) "
                  " samples {}",
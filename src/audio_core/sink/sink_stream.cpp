@@ -15,12 +15,21 @@
 #include "audio_core/sink/sink_stream.h"
 #include "common/common_types.h"
 #include "common/fixed_point.h"
+#include "common/logging/log.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
 namespace AudioCore::Sink {
+namespace {
+
+/// Fewest buffers the adaptive latency keeps queued
+constexpr u32 MinAdaptiveQueueSize = 2;
+/// Frames played without underruns before trying a shorter queue
+constexpr u64 AdaptiveWindowFrames = TargetSampleRate;
+
+} // Anonymous namespace
 
 void SinkStream::AppendBuffer(SinkBuffer& buffer, std::span<s16> samples) {
     if (type == StreamType::In)
@@ -161,6 +170,8 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
     const std::size_t frame_size_bytes = frame_size * sizeof(s16);
     size_t frames_written{0};
     size_t actual_frames_written{0};
+    const u32 queued_at_start = queued_buffers;
+    bool underrun{false};
 
     if (system.IsPaused() || system.IsShuttingDown()) {
         if (system.IsShuttingDown()) {
@@ -181,6 +192,7 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
 
             if (!queue.TryPop(playing_buffer)) {
                 lk.unlock();
+                underrun = true;
                 for (size_t i = frames_written; i < num_frames; i++)
                     std::memcpy(&output_buffer[i * frame_size], last_frame.data(), frame_size_bytes);
                 frames_written = num_frames;
@@ -206,6 +218,10 @@ void SinkStream::ProcessAudioOutAndRender(std::span<s16> output_buffer, std::siz
 
     std::memcpy(last_frame.data(), &output_buffer[(frames_written - 1) * frame_size], frame_size_bytes);
 
+    // Nothing was ever queued yet, the stream is starting rather than starving
+    if (max_played_sample_count != 0)
+        UpdateQueueTarget(queued_at_start, underrun, num_frames);
+
     {
         std::scoped_lock lk{sample_count_lock};
         last_sample_count_update_time = system.CoreTiming().GetGlobalTimeNs();
@@ -227,17 +243,58 @@ u64 SinkStream::GetExpectedPlayedSampleCount() {
 void SinkStream::WaitFreeSpace(std::stop_token stop_token) {
     std::unique_lock lk{release_mutex};
 
-    auto can_continue = [this]() {
-        return paused || queued_buffers < max_queue_size;
+    const u32 queue_size = Settings::values.audio_adaptive_latency.GetValue()
+                               ? target_queue_size.load()
+                               : max_queue_size;
+    auto can_continue = [this, queue_size]() {
+        return paused || queued_buffers < queue_size;
     };
 
     release_cv.wait_for(lk, std::chrono::milliseconds(7), can_continue);
 
-    if (queued_buffers > max_queue_size + 3) {
+    if (queued_buffers > queue_size + 3) {
+        ++overrun_count;
         release_cv.wait(lk, stop_token, can_continue);
     }
 }
 
+std::chrono::microseconds SinkStream::GetLatency() const {
+    const u64 queued_frames = samples_buffer.Size() / (std::max)(device_channels, 1U);
+    return std::chrono::microseconds{(queued_frames + device_latency_frames) * 1'000'000 /
+                                     TargetSampleRate};
+}
+
+void SinkStream::UpdateQueueTarget(u32 queued, bool underrun, std::size_t frames) {
+    const auto reset_window = [this] {
+        window_min_queued = (std::numeric_limits<u32>::max)();
+        window_frames = 0;
+    };
+    if (underrun) {
+        ++underrun_count;
+        if (target_queue_size < max_queue_size) {
+            ++target_queue_size;
+            LOG_DEBUG(Audio_Sink,
+                      "Stream {} underran, queueing {} buffers ({} underruns, {} overruns)", name,
+                      target_queue_size.load(), underrun_count.load(), overrun_count.load());
+        }
+        reset_window();
+        return;
+    }
+
+    window_min_queued = (std::min)(window_min_queued, queued);
+    window_frames += frames;
+    if (window_frames < AdaptiveWindowFrames)
+        return;
+
+    // There was a buffer to spare at every callback of the window, try with one less
+    if (window_min_queued > 0 && target_queue_size > MinAdaptiveQueueSize) {
+        --target_queue_size;
+        LOG_DEBUG(Audio_Sink, "Stream {} stable, queueing {} buffers", name,
+                  target_queue_size.load());
+    }
+    reset_window();
+}
+
 void SinkStream::SignalPause() {
     {
         std::scoped_lock lk{release_mutex};
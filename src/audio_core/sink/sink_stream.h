@@ -9,6 +9,7 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <span>
@@ -165,6 +166,7 @@ public:
      */
     void SetRingSize(u32 ring_size) {
         max_queue_size = ring_size;
+        target_queue_size = ring_size;
     }
 
     /**
@@ -216,12 +218,30 @@ public:
      */
     void WaitFreeSpace(std::stop_token stop_token);
 
+    /**
+     * Get the time a queued sample takes to be played, from the samples waiting in the queue and
+     * the buffer of the device.
+     *
+     * @return The output latency.
+     */
+    std::chrono::microseconds GetLatency() const;
+
 protected:
     /**
      * Unblocks the ADSP if the stream is paused.
      */
     void SignalPause();
 
+private:
+    /**
+     * Adapt the number of buffers the renderer keeps queued to the playback stability.
+     *
+     * @param queued   - Buffers queued when the callback started.
+     * @param underrun - Whether the callback ran out of buffers.
+     * @param frames   - Frames requested by the callback.
+     */
+    void UpdateQueueTarget(u32 queued, bool underrun, std::size_t frames);
+
 protected:
     /// Core system
     Core::System& system;
@@ -235,6 +255,8 @@ protected:
     std::atomic<bool> paused{true};
     /// Name of this stream
     std::string name{};
+    /// Frames buffered by the device after the callback, set by the backend when opening
+    u32 device_latency_frames{};
 
 private:
     /// Ring buffer of the samples waiting to be played or consumed
@@ -249,6 +271,16 @@ private:
     std::atomic<u32> queued_buffers{};
     /// The ring size for audio out buffers (usually 4, rarely 2 or 8)
     u32 max_queue_size{};
+    /// Buffers the renderer keeps queued with the adaptive latency, at most max_queue_size
+    std::atomic<u32> target_queue_size{};
+    /// Fewest buffers queued at the start of a callback in the current adaptation window
+    u32 window_min_queued{(std::numeric_limits<u32>::max)()};
+    /// Frames played in the current adaptation window
+    u64 window_frames{};
+    /// Number of times the callback ran out of buffers
+    std::atomic<u64> underrun_count{};
+    /// Number of times the renderer had to block on a full queue
+    std::atomic<u64> overrun_count{};
     /// Locks access to sample count tracking info
     std::mutex sample_count_lock;
     /// Minimum number of total samples that have been played since the last callback
@@ -1,16 +1,78 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <mutex>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/fiber.h"
+#include "common/logging/log.h"
 #define MCO_USE_VMEM_ALLOCATOR
 #define MINICORO_IMPL
 #include "common/minicoro.h"
 
 namespace Common {
 
+namespace {
+
+/// Keeps the memory of destroyed coroutines, stack included, to be reused by new fibers. Guest
+/// threads come and go frequently, this saves mapping and unmapping a stack for each of them.
+class CoroutinePool {
+public:
+    void* Acquire(const mco_desc& desc) {
+        {
+            std::scoped_lock lock{mutex};
+            ++num_live;
+            if (num_live > peak_live) {
+                peak_live = num_live;
+                if (peak_live % REPORT_INTERVAL == 0) {
+                    LOG_DEBUG(Common, "{} fibers alive, {} stacks pooled", peak_live,
+                              free_blocks.size());
+                }
+            }
+            if (!free_blocks.empty() && block_size == desc.coro_size) {
+                void* const block = free_blocks.back();
+                free_blocks.pop_back();
+                return block;
+            }
+        }
+        return desc.alloc_cb(desc.coro_size, desc.allocator_data);
+    }
+
+    void Release(mco_coro* coro) {
+        {
+            std::scoped_lock lock{mutex};
+            --num_live;
+            if (free_blocks.empty()) {
+                block_size = coro->coro_size;
+            }
+            if (free_blocks.size() < MAX_POOLED_BLOCKS && block_size == coro->coro_size) {
+                free_blocks.push_back(coro);
+                return;
+            }
+        }
+        coro->dealloc_cb(coro, coro->coro_size, coro->allocator_data);
+    }
+
+private:
+    static constexpr size_t MAX_POOLED_BLOCKS = 64;
+    static constexpr size_t REPORT_INTERVAL = 32;
+
+    std::mutex mutex;
+    std::vector<void*> free_blocks;
+    size_t block_size = 0;
+    size_t num_live = 0;
+    size_t peak_live = 0;
+};
+
+// Leaked on purpose, fibers may still be destroyed during static destruction
+CoroutinePool& coroutine_pool = *new CoroutinePool;
+
+} // Anonymous namespace
+
 struct Fiber::FiberImpl {
     FiberImpl() {}
 
@@ -33,7 +95,9 @@ Fiber::Fiber(std::function<void()>&& entry_point_func) : impl{std::make_unique<F
     auto desc = mco_desc_init(
         [](mco_coro* coro) { reinterpret_cast<Fiber*>(coro->user_data)->impl->entry_point(); }, 0);
     desc.user_data = this;
-    mco_result res = mco_create(&impl->context, &desc);
+    impl->context = static_cast<mco_coro*>(coroutine_pool.Acquire(desc));
+    ASSERT(impl->context != nullptr);
+    mco_result res = mco_init(impl->context, &desc);
     ASSERT(res == MCO_SUCCESS);
 }
 
@@ -69,8 +133,9 @@ void Fiber::DestroyPre() {
 }
 
 void Fiber::DestroyWorkFiber() {
-    mco_result res = mco_destroy(impl->context);
+    mco_result res = mco_uninit(impl->context);
     ASSERT(res == MCO_SUCCESS);
+    coroutine_pool.Release(impl->context);
 }
 
 void Fiber::DestroyThreadFiber() {
@@ -80,7 +145,14 @@ void Fiber::DestroyThreadFiber() {
 }
 
 void Fiber::YieldTo(std::weak_ptr<Fiber> weak_from, Fiber& to) {
-    if (auto from = weak_from.lock()) {
+    if (const auto from = weak_from.lock()) {
+        YieldTo(from, to);
+    }
+}
+
+void Fiber::YieldTo(const std::shared_ptr<Fiber>& from_ptr, Fiber& to) {
+    // Keep the fiber alive while it is suspended, the caller's reference may be reset meanwhile
+    if (const auto from = from_ptr) {
         if (!from->impl->is_thread_fiber) {
             // Set next fiber
             from->impl->next_fiber = &to;
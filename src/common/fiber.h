@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -37,6 +40,8 @@ public:
     Fiber& operator=(Fiber&&) = default;
 
     static void YieldTo(std::weak_ptr<Fiber> weak_from, Fiber& to);
+    /// Same as above for callers that own the fiber, without going through a weak reference.
+    static void YieldTo(const std::shared_ptr<Fiber>& from, Fiber& to);
     [[nodiscard]] static std::shared_ptr<Fiber> ThreadToFiber();
 
     /// Only call from main thread's fiber
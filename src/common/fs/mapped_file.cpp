@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "common/fs/mapped_file.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include "common/string_util.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/vfs.h>
+#endif
+#ifdef ANDROID
+#include "common/fs/fs_android.h"
+#endif
+
+namespace Common::FS {
+
+namespace {
+
+using namespace Common::Literals;
+
+/// Address space that mapped files may use at once.
+#ifdef ANDROID
+constexpr u64 MAX_MAPPED_BYTES = 8_GiB;
+#else
+constexpr u64 MAX_MAPPED_BYTES = sizeof(void*) < 8 ? 512_MiB : 64_GiB;
+#endif
+
+/// Reads at least this large hint the kernel to fetch the whole range at once.
+constexpr size_t WILLNEED_THRESHOLD = 1_MiB;
+
+std::atomic<u64> mapped_bytes;
+
+bool ReserveAddressSpace(u64 size) {
+    u64 current = mapped_bytes.load(std::memory_order_relaxed);
+    do {
+        if (size > MAX_MAPPED_BYTES - current) {
+            return false;
+        }
+    } while (!mapped_bytes.compare_exchange_weak(current, current + size,
+                                                 std::memory_order_relaxed));
+    return true;
+}
+
+#ifdef __linux__
+bool IsNetworkFilesystem(int fd) {
+    // Magic numbers from linux/magic.h and fs/smb/client.
+    static constexpr long NFS_SUPER_MAGIC = 0x6969;
+    static constexpr long SMB_SUPER_MAGIC = 0x517B;
+    static constexpr long CIFS_SUPER_MAGIC = 0xFF534D42;
+    static constexpr long SMB2_SUPER_MAGIC = 0xFE534D42;
+    static constexpr long FUSE_SUPER_MAGIC = 0x65735546;
+    static constexpr long CODA_SUPER_MAGIC = 0x73757245;
+    static constexpr long AFS_SUPER_MAGIC = 0x5346414F;
+
+    struct statfs info {};
+    if (fstatfs(fd, &info) != 0) {
+        return true;
+    }
+    switch (static_cast<long>(info.f_type) & 0xFFFFFFFF) {
+    case NFS_SUPER_MAGIC:
+    case SMB_SUPER_MAGIC:
+    case CIFS_SUPER_MAGIC:
+    case SMB2_SUPER_MAGIC:
+    case FUSE_SUPER_MAGIC:
+    case CODA_SUPER_MAGIC:
+    case AFS_SUPER_MAGIC:
+        return true;
+    default:
+        return false;
+    }
+}
+#endif
+
+} // Anonymous namespace
+
+MappedFile::MappedFile(const u8* data_, size_t size_, void* handle_)
+    : data{data_}, size{size_}, handle{handle_} {}
+
+MappedFile::~MappedFile() {
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(handle);
+#else
+    munmap(const_cast<u8*>(data), size);
+#endif
+    mapped_bytes -= size;
+}
+
+size_t MappedFile::Read(u8* dest, size_t length, size_t offset) const {
+    if (offset >= size) {
+        return 0;
+    }
+    const size_t count = (std::min)(length, size - offset);
+#ifndef _WIN32
+    if (count >= WILLNEED_THRESHOLD) {
+        static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t begin = offset & ~(page_size - 1);
+        madvise(const_cast<u8*>(data) + begin, offset + count - begin, MADV_WILLNEED);
+    }
+#endif
+    std::memcpy(dest, data + offset, count);
+    return count;
+}
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path) {
+#ifdef _WIN32
+    const std::wstring wide_path = Common::UTF8ToUTF16W(path);
+    if (wide_path.starts_with(L"\\\\")) {
+        // UNC paths point to network shares.
+        return nullptr;
+    }
+    if (wide_path.size() >= 3 && wide_path[1] == L':') {
+        if (GetDriveTypeW(wide_path.substr(0, 3).c_str()) == DRIVE_REMOTE) {
+            return nullptr;
+        }
+    }
+    const HANDLE file = CreateFileW(wide_path.c_str(), GENERIC_READ,
+                                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 ||
+        !ReserveAddressSpace(static_cast<size_t>(file_size.QuadPart))) {
+        CloseHandle(file);
+        return nullptr;
+    }
+    const size_t size = static_cast<size_t>(file_size.QuadPart);
+    // The mapping keeps the file open by itself.
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    void* const view =
+        mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+        }
+        mapped_bytes -= size;
+        LOG_WARNING(Common_Filesystem, "Failed to map {}, error {}", path, GetLastError());
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(new MappedFile(static_cast<const u8*>(view), size, mapping));
+#else
+    int fd = -1;
+#ifdef ANDROID
+    if (Android::IsContentUri(path)) {
+        fd = Android::OpenContentUri(path, Android::OpenMode::Read);
+    } else
+#endif
+    {
+        fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+    if (fd == -1) {
+        return nullptr;
+    }
+    struct stat info {};
+    const bool can_map = fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0
+#ifdef __linux__
+                         && !IsNetworkFilesystem(fd)
+#endif
+        ;
+    if (!can_map || !ReserveAddressSpace(static_cast<size_t>(info.st_size))) {
+        close(fd);
+        return nullptr;
+    }
+    const size_t size = static_cast<size_t>(info.st_size);
+    void* const view = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the file open by itself.
+    close(fd);
+    if (view == MAP_FAILED) {
+        mapped_bytes -= size;
+        LOG_WARNING(Common_Filesystem, "Failed to map {}, errno {}", path, errno);
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(new MappedFile(static_cast<const u8*>(view), size, nullptr));
+#endif
+}
+
+} // namespace Common::FS
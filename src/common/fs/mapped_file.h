@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "common/common_types.h"
+
+namespace Common::FS {
+
+/**
+ * A read-only view of a whole file mapped into the address space of the process. Reading from it
+ * costs no system call, the page cache of the host backs the data.
+ */
+class MappedFile {
+public:
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Maps a file for reading.
+     * Files on network mounts are never mapped, since a failing read would crash instead of
+     * returning an error. The total size of the mapped files is capped to keep address space
+     * available on constrained hosts.
+     *
+     * @returns The mapping, or nullptr if the file can't or shouldn't be mapped.
+     */
+    [[nodiscard]] static std::unique_ptr<MappedFile> Open(const std::string& path);
+
+    [[nodiscard]] const u8* Data() const {
+        return data;
+    }
+
+    [[nodiscard]] size_t Size() const {
+        return size;
+    }
+
+    /// Copies a range of the file, returning the number of bytes read.
+    size_t Read(u8* dest, size_t length, size_t offset) const;
+
+private:
+    MappedFile(const u8* data, size_t size, void* handle);
+
+    const u8* data;
+    size_t size;
+    void* handle; ///< Mapping object on Windows
+};
+
+} // namespace Common::FS
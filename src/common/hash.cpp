@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "common/hash.h"
+#include "common/uint128.h"
+
+namespace Common {
+namespace {
+
+constexpr u64 WySecret[4]{0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL,
+                          0x4d5a2da51de1aa47ULL};
+
+void WyMultiply(u64& a, u64& b) {
+    const u128 product = Multiply64Into128(a, b);
+    a = product[0];
+    b = product[1];
+}
+
+u64 WyMix(u64 a, u64 b) {
+    WyMultiply(a, b);
+    return a ^ b;
+}
+
+u64 WyRead8(const u8* p) {
+    u64 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+u64 WyRead4(const u8* p) {
+    u32 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+u64 WyRead3(const u8* p, size_t size) {
+    return (u64{p[0]} << 16) | (u64{p[size >> 1]} << 8) | p[size - 1];
+}
+
+} // Anonymous namespace
+
+u64 WyHash64(const void* data, size_t size, u64 seed) noexcept {
+    const u8* p = static_cast<const u8*>(data);
+    seed ^= WyMix(seed ^ WySecret[0], WySecret[1]);
+    u64 a;
+    u64 b;
+    if (size <= 16) [[likely]] {
+        if (size >= 4) [[likely]] {
+            const size_t middle = (size >> 3) << 2;
+            a = (WyRead4(p) << 32) | WyRead4(p + middle);
+            b = (WyRead4(p + size - 4) << 32) | WyRead4(p + size - 4 - middle);
+        } else if (size > 0) {
+            a = WyRead3(p, size);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t remaining = size;
+        if (remaining >= 48) {
+            u64 seed1 = seed;
+            u64 seed2 = seed;
+            do {
+                seed = WyMix(WyRead8(p) ^ WySecret[1], WyRead8(p + 8) ^ seed);
+                seed1 = WyMix(WyRead8(p + 16) ^ WySecret[2], WyRead8(p + 24) ^ seed1);
+                seed2 = WyMix(WyRead8(p + 32) ^ WySecret[3], WyRead8(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining >= 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = WyMix(WyRead8(p) ^ WySecret[1], WyRead8(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        a = WyRead8(p + remaining - 16);
+        b = WyRead8(p + remaining - 8);
+    }
+    a ^= WySecret[1];
+    b ^= seed;
+    WyMultiply(a, b);
+    return WyMix(a ^ WySecret[0] ^ size, b ^ WySecret[1]);
+}
+
+} // namespace Common
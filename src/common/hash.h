@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2015 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,6 +10,9 @@
 #include <utility>
 #include <boost/functional/hash.hpp>
 
+#include "common/cityhash.h"
+#include "common/common_types.h"
+
 namespace Common {
 
 struct PairHash {
@@ -25,4 +31,26 @@ struct IdentityHash {
     }
 };
 
+/// Hash functions a cache can key its entries with. Caches storing their hashes have to bump
+/// their version when switching to another one.
+enum class HashAlgorithm {
+    CityHash64, ///< Hashes shown to the user, e.g. naming dumped shaders
+    WyHash64,   ///< Faster, on small keys above all
+};
+
+/**
+ * wyhash final version 4 by Wang Yi, released in the public domain.
+ * It mixes the input 16 bytes at a time with a 64-bit by 64-bit multiplication.
+ */
+[[nodiscard]] u64 WyHash64(const void* data, size_t size, u64 seed = 0) noexcept;
+
+template <HashAlgorithm algorithm>
+[[nodiscard]] u64 Hash64(const void* data, size_t size) noexcept {
+    if constexpr (algorithm == HashAlgorithm::WyHash64) {
+        return WyHash64(data, size);
+    } else {
+        return CityHash64(static_cast<const char*>(data), size);
+    }
+}
+
 } // namespace Common
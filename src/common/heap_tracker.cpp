@@ -112,6 +112,7 @@ void HeapTracker::Protect(size_t virtual_offset, size_t size, MemoryPermission p
     // Declare tracking variables.
     const VAddr end = virtual_offset + size;
     VAddr cur = virtual_offset;
+    bool has_separate_heap = false;
 
     while (cur < end) {
         VAddr next = cur;
@@ -132,6 +133,8 @@ void HeapTracker::Protect(size_t virtual_offset, size_t size, MemoryPermission p
                 next = end;
                 should_protect = true;
             } else if (it->vaddr == cur) {
+                has_separate_heap = true;
+
                 // We are in range.
                 // Update permission bits.
                 it->perm = perm;
@@ -156,6 +159,12 @@ void HeapTracker::Protect(size_t virtual_offset, size_t size, MemoryPermission p
         // Advance.
         cur = next;
     }
+
+    // Separate heap mappings can be evicted once the rebuild lock is released, don't leave
+    // protection changes of their region to be applied after that.
+    if (has_separate_heap) {
+        ScopedProtectBatch::Flush();
+    }
 }
 
 bool HeapTracker::DeferredMapSeparateHeap(u8* fault_address) {
@@ -22,6 +22,12 @@
 #include <sys/mman.h>
 #include <unistd.h>
 #include "common/scope_exit.h"
+#ifdef __linux__
+#include <linux/fs.h>
+#include <linux/userfaultfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
 
 #if defined(__linux__)
 #include <sys/random.h>
@@ -47,8 +53,14 @@
 
 #endif // ^^^ POSIX ^^^
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
 #include <mutex>
 #include <random>
+#include <string>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/assert.h"
@@ -71,6 +83,13 @@ namespace Common {
 constexpr size_t PageAlignment = 0x1000;
 constexpr size_t HugePageSize = 0x200000;
 
+/// Faults in every page of a region by writing to it, the memory must still be zeroed.
+[[maybe_unused]] static void TouchPages(u8* base, size_t size) {
+    for (size_t offset = 0; offset < size; offset += PageAlignment) {
+        *reinterpret_cast<volatile u8*>(base + offset) = 0;
+    }
+}
+
 #ifdef _WIN32
 
 // Manually imported for MinGW compatibility
@@ -224,11 +243,41 @@ public:
         return false;
     }
 
+    bool DiscardBackingRegion(size_t physical_offset, size_t length) {
+        return false;
+    }
+
     void EnableDirectMappedAddress() {
         // TODO
         UNREACHABLE();
     }
 
+    bool EnableHugePages() {
+        // Large page sections can only be mapped at large page granularity, but guest memory is
+        // mapped at 4 KiB granularity into the placeholders.
+        LOG_INFO(HW_Memory, "Large pages aren't supported by the Windows fastmem arena");
+        return false;
+    }
+
+    void Prefault() {
+        TouchPages(backing_base, backing_size);
+    }
+
+    size_t GetHugePageMappedSize() const {
+        return 0;
+    }
+
+    bool EnableWriteWatch() {
+        // GetWriteWatch only tracks memory allocated with MEM_WRITE_WATCH, not views of the
+        // section backing guest memory.
+        LOG_INFO(HW_Memory, "Write watching isn't supported by the Windows fastmem arena");
+        return false;
+    }
+
+    void WatchWrites(size_t virtual_offset, size_t length, bool watch) {}
+
+    void CollectWrites(const std::function<void(size_t, size_t)>& func) {}
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -496,6 +545,86 @@ static int shm_open_anon(int flags, mode_t mode) {
 }
 #endif
 
+#ifdef __linux__
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
+// Asynchronous write protection of userfaultfd and PAGEMAP_SCAN were added in Linux 6.7, declare
+// them for older kernel headers.
+#ifndef UFFD_USER_MODE_ONLY
+#define UFFD_USER_MODE_ONLY 1
+#endif
+#ifndef UFFD_FEATURE_WP_UNPOPULATED
+#define UFFD_FEATURE_WP_UNPOPULATED (1 << 13)
+#endif
+#ifndef UFFD_FEATURE_WP_ASYNC
+#define UFFD_FEATURE_WP_ASYNC (1 << 15)
+#endif
+#ifndef PAGEMAP_SCAN
+struct page_region {
+    __u64 start;
+    __u64 end;
+    __u64 categories;
+};
+
+struct pm_scan_arg {
+    __u64 size;
+    __u64 flags;
+    __u64 start;
+    __u64 end;
+    __u64 walk_end;
+    __u64 vec;
+    __u64 vec_len;
+    __u64 max_pages;
+    __u64 category_inverted;
+    __u64 category_mask;
+    __u64 category_anyof_mask;
+    __u64 return_mask;
+};
+
+#define PAGEMAP_SCAN _IOWR('f', 16, struct pm_scan_arg)
+#define PM_SCAN_WP_MATCHING (1 << 0)
+#define PAGE_IS_WRITTEN (1 << 1)
+#endif
+
+/// Checks if the transparent huge page mode selected in a sysfs file allows madvise requests.
+static bool IsTransparentHugePageModeEnabled(const char* path) {
+    std::ifstream file{path};
+    std::string modes;
+    if (!std::getline(file, modes)) {
+        return false;
+    }
+    return modes.find("[never]") == std::string::npos && modes.find("[deny]") == std::string::npos;
+}
+
+/// Sums the huge page counters of the mapping starting at an address in /proc/self/smaps.
+static size_t ReadHugePageMappedSize(const void* base) {
+    std::ifstream smaps{"/proc/self/smaps"};
+    const std::string start = fmt::format("{:x}-", reinterpret_cast<uintptr_t>(base));
+    std::string line;
+    bool in_mapping = false;
+    size_t size = 0;
+    while (std::getline(smaps, line)) {
+        const size_t colon = line.find(':');
+        const bool is_field = colon != std::string::npos && line.find(' ') == colon + 1;
+        if (!is_field) {
+            if (in_mapping) {
+                break;
+            }
+            in_mapping = line.starts_with(start);
+            continue;
+        }
+        if (in_mapping && (line.starts_with("AnonHugePages:") ||
+                           line.starts_with("ShmemPmdMapped:") ||
+                           line.starts_with("FilePmdMapped:"))) {
+            size += std::strtoull(line.c_str() + colon + 1, nullptr, 10) * 1024;
+        }
+    }
+    return size;
+}
+#endif
+
 class HostMemory::Impl {
 public:
     explicit Impl(size_t backing_size_, size_t virtual_size_)
@@ -579,6 +708,15 @@ public:
         int flags = (fd > 0 ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED;
         void* ret = mmap(virtual_base + virtual_offset, length, prot_flags, flags, fd, host_offset);
         ASSERT_MSG(ret != MAP_FAILED, "mmap: {}", strerror(errno));
+#ifdef __linux__
+        // Each view is a new mapping, it has to ask for huge pages again to be mapped with them.
+        if (use_huge_pages && length >= HugePageSize) {
+            madvise(ret, length, MADV_HUGEPAGE);
+        }
+        if (uffd != -1) {
+            RegisterWriteWatch(virtual_offset, length);
+        }
+#endif
     }
 
     void Unmap(size_t virtual_offset, size_t length) {
@@ -595,6 +733,12 @@ public:
         void* ret = mmap(merged_pointer, merged_size, PROT_NONE,
                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
         ASSERT_MSG(ret != MAP_FAILED, "mmap failed: {}", strerror(errno));
+#ifdef __linux__
+        if (uffd != -1) {
+            std::scoped_lock lk{watch_mutex};
+            mapped_ranges.subtract({virtual_offset, virtual_offset + length});
+        }
+#endif
     }
 
     void Protect(size_t virtual_offset, size_t length, bool read, bool write, bool execute) {
@@ -635,10 +779,137 @@ public:
 #endif
     }
 
+    bool DiscardBackingRegion(size_t physical_offset, size_t length) {
+#ifdef __linux__
+        // Anonymous backing memory can't have holes punched into it, dropping the pages is enough
+        const int advice = fd > 0 ? MADV_REMOVE : MADV_DONTNEED;
+        return madvise(backing_base + physical_offset, length, advice) == 0;
+#else
+        return false;
+#endif
+    }
+
     void EnableDirectMappedAddress() {
         virtual_base = nullptr;
     }
 
+    bool EnableHugePages() {
+#ifdef __linux__
+        // The backing memory is usually a memfd, which follows the shmem policy instead.
+        const char* const policy = fd > 0 ? "/sys/kernel/mm/transparent_hugepage/shmem_enabled"
+                                          : "/sys/kernel/mm/transparent_hugepage/enabled";
+        if (!IsTransparentHugePageModeEnabled(policy)) {
+            LOG_INFO(HW_Memory, "Transparent huge pages are disabled by {}", policy);
+            return false;
+        }
+        if (madvise(backing_base, backing_size, MADV_HUGEPAGE) != 0) {
+            LOG_WARNING(HW_Memory, "madvise(MADV_HUGEPAGE) failed: {}", strerror(errno));
+            return false;
+        }
+        use_huge_pages = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void Prefault() {
+#ifdef __linux__
+        if (madvise(backing_base, backing_size, MADV_POPULATE_WRITE) == 0) {
+            return;
+        }
+        // Kernels before 5.14 don't support populating through madvise.
+#endif
+        TouchPages(backing_base, backing_size);
+    }
+
+    size_t GetHugePageMappedSize() const {
+#ifdef __linux__
+        return ReadHugePageMappedSize(backing_base);
+#else
+        return 0;
+#endif
+    }
+
+    bool EnableWriteWatch() {
+#ifdef __linux__
+        // User mode only descriptors don't need privileges, and the asynchronous mode never
+        // reports faults through them anyway.
+        uffd = static_cast<int>(
+            syscall(SYS_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+        if (uffd == -1) {
+            LOG_INFO(HW_Memory, "userfaultfd is unavailable: {}", strerror(errno));
+            return false;
+        }
+        uffdio_api api{
+            .api = UFFD_API,
+            .features = UFFD_FEATURE_WP_ASYNC | UFFD_FEATURE_WP_HUGETLBFS_SHMEM |
+                        UFFD_FEATURE_WP_UNPOPULATED,
+        };
+        pagemap_fd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+        pm_scan_arg probe{
+            .size = sizeof(probe),
+            .start = reinterpret_cast<uintptr_t>(virtual_map_base),
+            .end = reinterpret_cast<uintptr_t>(virtual_map_base),
+        };
+        if (ioctl(uffd, UFFDIO_API, &api) != 0 || pagemap_fd == -1 ||
+            ioctl(pagemap_fd, PAGEMAP_SCAN, &probe) != 0) {
+            LOG_INFO(HW_Memory, "Asynchronous write protection is unavailable, it needs Linux 6.7");
+            DisableWriteWatch();
+            return false;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void WatchWrites(size_t virtual_offset, size_t length, bool watch) {
+#ifdef __linux__
+        AdjustMap(&virtual_offset, &length);
+        const auto range = boost::icl::interval_set<size_t>::interval_type::right_open(
+            virtual_offset, virtual_offset + length);
+        std::scoped_lock lk{watch_mutex};
+        if (watch) {
+            watched_ranges.add(range);
+        } else {
+            watched_ranges.subtract(range);
+        }
+        for (const auto& mapped : mapped_ranges & range) {
+            WriteProtect(mapped.lower(), mapped.upper() - mapped.lower(), watch);
+        }
+#endif
+    }
+
+    void CollectWrites(const std::function<void(size_t, size_t)>& func) {
+#ifdef __linux__
+        std::array<page_region, 64> regions;
+        std::scoped_lock lk{watch_mutex};
+        for (const auto& watched : watched_ranges & mapped_ranges) {
+            // Write protects the pages found again as they are reported.
+            pm_scan_arg scan{
+                .size = sizeof(scan),
+                .flags = PM_SCAN_WP_MATCHING,
+                .start = reinterpret_cast<uintptr_t>(virtual_base + watched.lower()),
+                .end = reinterpret_cast<uintptr_t>(virtual_base + watched.upper()),
+                .vec = reinterpret_cast<uintptr_t>(regions.data()),
+                .vec_len = regions.size(),
+                .category_mask = PAGE_IS_WRITTEN,
+                .return_mask = PAGE_IS_WRITTEN,
+            };
+            while (scan.start < scan.end) {
+                const int count = ioctl(pagemap_fd, PAGEMAP_SCAN, &scan);
+                ASSERT_MSG(count >= 0, "PAGEMAP_SCAN failed: {}", strerror(errno));
+                for (int i = 0; i < count; ++i) {
+                    func(regions[i].start - reinterpret_cast<uintptr_t>(virtual_base),
+                         regions[i].end - regions[i].start);
+                }
+                scan.start = scan.walk_end;
+            }
+        }
+#endif
+    }
+
     const size_t backing_size; ///< Size of the backing memory in bytes
     const size_t virtual_size; ///< Size of the virtual address placeholder in bytes
 
@@ -663,8 +934,51 @@ private:
             int ret = close(fd);
             ASSERT_MSG(ret == 0, "close failed: {}", strerror(errno));
         }
+#ifdef __linux__
+        DisableWriteWatch();
+#endif
     }
 
+#ifdef __linux__
+    void DisableWriteWatch() {
+        if (pagemap_fd != -1) {
+            close(pagemap_fd);
+            pagemap_fd = -1;
+        }
+        if (uffd != -1) {
+            close(uffd);
+            uffd = -1;
+        }
+    }
+
+    void RegisterWriteWatch(size_t virtual_offset, size_t length) {
+        uffdio_register reg{
+            .range = {reinterpret_cast<uintptr_t>(virtual_base + virtual_offset), length},
+            .mode = UFFDIO_REGISTER_MODE_WP,
+        };
+        int ret = ioctl(uffd, UFFDIO_REGISTER, &reg);
+        ASSERT_MSG(ret == 0, "UFFDIO_REGISTER failed: {}", strerror(errno));
+
+        // A new view is not protected, arm it again where writes were being watched.
+        const auto range = boost::icl::interval_set<size_t>::interval_type::right_open(
+            virtual_offset, virtual_offset + length);
+        std::scoped_lock lk{watch_mutex};
+        mapped_ranges.add(range);
+        for (const auto& watched : watched_ranges & range) {
+            WriteProtect(watched.lower(), watched.upper() - watched.lower(), true);
+        }
+    }
+
+    void WriteProtect(size_t virtual_offset, size_t length, bool protect) {
+        uffdio_writeprotect wp{
+            .range = {reinterpret_cast<uintptr_t>(virtual_base + virtual_offset), length},
+            .mode = protect ? UFFDIO_WRITEPROTECT_MODE_WP : 0,
+        };
+        int ret = ioctl(uffd, UFFDIO_WRITEPROTECT, &wp);
+        ASSERT_MSG(ret == 0, "UFFDIO_WRITEPROTECT failed: {}", strerror(errno));
+    }
+#endif
+
     void AdjustMap(size_t* virtual_offset, size_t* length) {
         if (virtual_base != nullptr) {
             return;
@@ -687,12 +1001,22 @@ private:
     }
 
     int fd{-1}; // memfd file descriptor, -1 is the error value of memfd_create
+    bool use_huge_pages{};
     FreeRegionManager free_manager{};
+
+#ifdef __linux__
+    int uffd{-1};       ///< userfaultfd registered on the views when writes are watched
+    int pagemap_fd{-1}; ///< /proc/self/pagemap, scanned for the pages written to
+    std::mutex watch_mutex;
+    boost::icl::interval_set<size_t> mapped_ranges;
+    boost::icl::interval_set<size_t> watched_ranges;
+#endif
 };
 
 #endif // ^^^ POSIX ^^^
 
-HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
+HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_, bool huge_pages,
+                       bool prefault)
     : backing_size(backing_size_), virtual_size(virtual_size_) {
     try {
         // Try to allocate a fastmem arena.
@@ -710,6 +1034,14 @@ HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
             virtual_base_offset = virtual_base - impl->virtual_base;
         }
 
+        if (huge_pages && impl->EnableHugePages()) {
+            pages = HostMemoryPages::TransparentHuge;
+        }
+        if (prefault) {
+            impl->Prefault();
+            prefaulted = true;
+        }
+
     } catch (const std::bad_alloc&) {
         LOG_CRITICAL(HW_Memory,
                      "Fastmem unavailable, falling back to VirtualBuffer for memory allocation");
@@ -719,8 +1051,75 @@ HostMemory::HostMemory(size_t backing_size_, size_t virtual_size_)
     }
 }
 
+namespace {
+
+struct PendingProtect {
+    HostMemory* memory;
+    size_t virtual_offset;
+    size_t length;
+    MemoryPermission perm;
+};
+
+struct ProtectBatch {
+    u32 depth{};
+    std::vector<PendingProtect> pending;
+};
+
+thread_local ProtectBatch protect_batch;
+
+std::atomic<u64> protect_requested{};
+std::atomic<u64> protect_issued{};
+std::atomic<u64> discarded_bytes{};
+
+} // Anonymous namespace
+
+ScopedProtectBatch::ScopedProtectBatch() noexcept {
+    ++protect_batch.depth;
+}
+
+ScopedProtectBatch::~ScopedProtectBatch() {
+    if (--protect_batch.depth == 0) {
+        Flush();
+    }
+}
+
+void ScopedProtectBatch::Flush() {
+    for (const PendingProtect& protect : protect_batch.pending) {
+        protect.memory->ApplyProtect(protect.virtual_offset, protect.length, protect.perm);
+    }
+    protect_batch.pending.clear();
+}
+
 HostMemory::~HostMemory() = default;
 
+size_t HostMemory::GetHugePageMappedSize() const {
+    return impl ? impl->GetHugePageMappedSize() : 0;
+}
+
+bool HostMemory::EnableWriteWatch() {
+    write_watch = virtual_base && impl && impl->EnableWriteWatch();
+    return write_watch;
+}
+
+void HostMemory::WatchWrites(size_t virtual_offset, size_t length, bool watch) {
+    ASSERT(virtual_offset % PageAlignment == 0);
+    ASSERT(length % PageAlignment == 0);
+    ASSERT(virtual_offset + length <= virtual_size);
+    if (length == 0 || !write_watch) {
+        return;
+    }
+    impl->WatchWrites(virtual_offset + virtual_base_offset, length, watch);
+}
+
+void HostMemory::CollectWrites(const std::function<void(size_t, size_t)>& func) {
+    if (!write_watch) {
+        return;
+    }
+    impl->CollectWrites([&](size_t offset, size_t length) {
+        func(offset - virtual_base_offset, length);
+    });
+}
+
 HostMemory::HostMemory(HostMemory&&) noexcept = default;
 
 HostMemory& HostMemory::operator=(HostMemory&&) noexcept = default;
@@ -755,6 +1154,37 @@ void HostMemory::Protect(size_t virtual_offset, size_t length, MemoryPermission
     if (length == 0 || !virtual_base || !impl) {
         return;
     }
+    protect_requested.fetch_add(1, std::memory_order_relaxed);
+    if (protect_batch.depth == 0) {
+        ApplyProtect(virtual_offset, length, perm);
+        return;
+    }
+    // Only the last change can be extended, merging with older ones could reorder changes
+    // made to overlapping ranges.
+    auto& pending = protect_batch.pending;
+    if (!pending.empty()) {
+        PendingProtect& last = pending.back();
+        if (last.memory == this && last.perm == perm &&
+            virtual_offset <= last.virtual_offset + last.length &&
+            last.virtual_offset <= virtual_offset + length) {
+            const size_t end = std::max(last.virtual_offset + last.length, virtual_offset + length);
+            last.virtual_offset = std::min(last.virtual_offset, virtual_offset);
+            last.length = end - last.virtual_offset;
+            return;
+        }
+    }
+    pending.push_back({this, virtual_offset, length, perm});
+}
+
+ProtectStatistics HostMemory::GetProtectStatistics() {
+    return {
+        .requested = protect_requested.load(std::memory_order_relaxed),
+        .issued = protect_issued.load(std::memory_order_relaxed),
+    };
+}
+
+void HostMemory::ApplyProtect(size_t virtual_offset, size_t length, MemoryPermission perm) {
+    protect_issued.fetch_add(1, std::memory_order_relaxed);
     const bool read = True(perm & MemoryPermission::Read);
     const bool write = True(perm & MemoryPermission::Write);
     const bool execute = True(perm & MemoryPermission::Execute);
@@ -767,6 +1197,18 @@ void HostMemory::ClearBackingRegion(size_t physical_offset, size_t length, u32 f
     }
 }
 
+bool HostMemory::DiscardBackingRegion(size_t physical_offset, size_t length) {
+    if (!impl || !impl->DiscardBackingRegion(physical_offset, length)) {
+        return false;
+    }
+    discarded_bytes.fetch_add(length, std::memory_order_relaxed);
+    return true;
+}
+
+u64 HostMemory::GetDiscardedBytes() {
+    return discarded_bytes.load(std::memory_order_relaxed);
+}
+
 void HostMemory::EnableDirectMappedAddress() {
     if (impl) {
         impl->EnableDirectMappedAddress();
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include "common/common_funcs.h"
 #include "common/common_types.h"
@@ -18,13 +19,30 @@ enum class MemoryPermission : u32 {
 };
 DECLARE_ENUM_FLAG_OPERATORS(MemoryPermission)
 
+/// Kind of host pages requested for the backing memory.
+enum class HostMemoryPages : u32 {
+    Standard,        ///< 4 KiB pages
+    TransparentHuge, ///< The kernel was asked to use 2 MiB pages where it can
+};
+
+/// Counters of the protection changes made through every HostMemory.
+struct ProtectStatistics {
+    u64 requested; ///< Protect calls made by the callers
+    u64 issued;    ///< Protection changes sent to the host after coalescing
+};
+
 /**
  * A low level linear memory buffer, which supports multiple mappings
  * Its purpose is to rebuild a given sparse memory layout, including mirrors.
  */
 class HostMemory {
 public:
-    explicit HostMemory(size_t backing_size_, size_t virtual_size_);
+    /**
+     * @param huge_pages Asks the host to back the memory with huge pages, to reduce TLB misses.
+     * @param prefault Faults in all of the backing memory now instead of on first access.
+     */
+    explicit HostMemory(size_t backing_size_, size_t virtual_size_, bool huge_pages = false,
+                        bool prefault = false);
     ~HostMemory();
 
     /**
@@ -51,6 +69,15 @@ public:
 
     void ClearBackingRegion(size_t physical_offset, size_t length, u32 fill_value);
 
+    /**
+     * Gives the host memory behind a backing region back to the host, it reads as zero after.
+     * Returns false when the host doesn't support it, the contents are untouched then.
+     */
+    bool DiscardBackingRegion(size_t physical_offset, size_t length);
+
+    /// Returns how many bytes of backing memory were given back to the host so far.
+    [[nodiscard]] static u64 GetDiscardedBytes();
+
     [[nodiscard]] u8* BackingBasePointer() noexcept {
         return backing_base;
     }
@@ -69,7 +96,42 @@ public:
         return address >= virtual_base && address < virtual_base + virtual_size;
     }
 
+    [[nodiscard]] HostMemoryPages GetPages() const noexcept {
+        return pages;
+    }
+
+    [[nodiscard]] bool IsPrefaulted() const noexcept {
+        return prefaulted;
+    }
+
+    /// Returns how much of the backing memory is mapped with huge pages, or 0 if unknown.
+    [[nodiscard]] size_t GetHugePageMappedSize() const;
+
+    /**
+     * Tracks writes through the virtual mappings without trapping them, instead of write
+     * protecting them. Must be called before anything is mapped.
+     * Returns false when the host doesn't support it.
+     */
+    bool EnableWriteWatch();
+
+    [[nodiscard]] bool IsWriteWatchEnabled() const noexcept {
+        return write_watch;
+    }
+
+    /// Starts or stops watching writes to a virtual range, including what is mapped there later.
+    void WatchWrites(size_t virtual_offset, size_t length, bool watch);
+
+    /// Calls func with each watched range written since it was last collected, and rearms it.
+    void CollectWrites(const std::function<void(size_t offset, size_t length)>& func);
+
+    /// Returns the protection counters accumulated so far.
+    [[nodiscard]] static ProtectStatistics GetProtectStatistics();
+
 private:
+    friend class ScopedProtectBatch;
+
+    void ApplyProtect(size_t virtual_offset, size_t length, MemoryPermission perm);
+
     size_t backing_size{};
     size_t virtual_size{};
 
@@ -79,9 +141,32 @@ private:
     u8* backing_base{};
     u8* virtual_base{};
     size_t virtual_base_offset{};
+    HostMemoryPages pages{HostMemoryPages::Standard};
+    bool prefaulted{};
+    bool write_watch{};
 
     // Fallback if fastmem is not supported on this platform
     std::unique_ptr<Common::VirtualBuffer<u8>> fallback_buffer;
 };
 
+/**
+ * Defers the HostMemory::Protect calls made by the current thread while it's alive, merging
+ * adjacent ranges that get the same permissions, and applies them when the outermost batch is
+ * destroyed. Batches can be nested.
+ *
+ * The deferred changes are not visible to other threads until they are applied, so a batch must
+ * not outlive the lock that orders the protection changes of the ranges it covers.
+ */
+class ScopedProtectBatch {
+public:
+    ScopedProtectBatch() noexcept;
+    ~ScopedProtectBatch();
+
+    ScopedProtectBatch(const ScopedProtectBatch&) = delete;
+    ScopedProtectBatch& operator=(const ScopedProtectBatch&) = delete;
+
+    /// Applies the changes deferred by the batches of the current thread now.
+    static void Flush();
+};
+
 } // namespace Common
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <map>
+#include <type_traits>
+
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Index of possibly overlapping half-open intervals, queried for the intervals overlapping a
+ * range.
+ *
+ * Intervals are bucketed by the bit width of their size and ordered by their start within a
+ * bucket. An interval of bucket n is shorter than 2^n, so the ones overlapping [begin, end) start
+ * in [begin - 2^n + 1, end) and a query only walks that window of each non-empty bucket. Lookups
+ * cost the same for large and small ranges, unlike walking the pages of the range.
+ *
+ * @tparam Address Unsigned address type
+ * @tparam Value   Value stored with each interval, compared when erasing
+ */
+template <typename Address, typename Value>
+class IntervalIndex {
+    static_assert(std::is_unsigned_v<Address>, "Address must be unsigned.");
+
+    static constexpr size_t NUM_BUCKETS = sizeof(Address) * 8;
+
+    struct Entry {
+        Address end;
+        Value value;
+    };
+
+public:
+    void Insert(Address begin, Address end, Value value) {
+        const size_t bucket = BucketIndex(begin, end);
+        buckets[bucket].emplace(begin, Entry{end, value});
+        used_buckets |= BucketBit(bucket);
+    }
+
+    /// Removes an interval inserted with the same bounds and value, returns false if there is none.
+    bool Erase(Address begin, Address end, const Value& value) {
+        const size_t bucket = BucketIndex(begin, end);
+        auto& intervals = buckets[bucket];
+        const auto [first, last] = intervals.equal_range(begin);
+        for (auto it = first; it != last; ++it) {
+            if (it->second.end != end || !(it->second.value == value)) {
+                continue;
+            }
+            intervals.erase(it);
+            if (intervals.empty()) {
+                used_buckets &= ~BucketBit(bucket);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Calls func(value) for every interval overlapping [begin, end). Intervals are visited in
+     * order of their start within a bucket, but not across buckets. When func returns a bool,
+     * returning true stops the query. The index must not be modified during the query.
+     */
+    template <typename Func>
+    void ForEachOverlap(Address begin, Address end, Func&& func) const {
+        using FuncReturn = std::invoke_result_t<Func, const Value&>;
+        static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
+        if (begin >= end) {
+            return;
+        }
+        for (u64 mask = used_buckets; mask != 0; mask &= mask - 1) {
+            const size_t bucket = static_cast<size_t>(std::countr_zero(mask));
+            const Address max_size = MaxSize(bucket);
+            const Address first_begin = begin > max_size ? begin - max_size + 1 : 0;
+            const auto& intervals = buckets[bucket];
+            for (auto it = intervals.lower_bound(first_begin);
+                 it != intervals.end() && it->first < end; ++it) {
+                if (it->second.end <= begin) {
+                    continue;
+                }
+                if constexpr (BOOL_BREAK) {
+                    if (func(it->second.value)) {
+                        return;
+                    }
+                } else {
+                    func(it->second.value);
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] bool Empty() const noexcept {
+        return used_buckets == 0;
+    }
+
+    void Clear() {
+        for (auto& intervals : buckets) {
+            intervals.clear();
+        }
+        used_buckets = 0;
+    }
+
+private:
+    static constexpr u64 BucketBit(size_t bucket) noexcept {
+        return u64{1} << bucket;
+    }
+
+    /// The last bucket also holds the intervals as long as the whole address space.
+    static constexpr size_t BucketIndex(Address begin, Address end) noexcept {
+        const auto width = static_cast<size_t>(std::bit_width(static_cast<Address>(end - begin)));
+        return width < NUM_BUCKETS ? width : NUM_BUCKETS - 1;
+    }
+
+    /// Largest interval size that fits in a bucket.
+    static constexpr Address MaxSize(size_t bucket) noexcept {
+        if (bucket == NUM_BUCKETS - 1) {
+            return static_cast<Address>(~Address{0});
+        }
+        return static_cast<Address>((Address{1} << bucket) - 1);
+    }
+
+    static_assert(NUM_BUCKETS <= 64, "Buckets must fit in the mask.");
+
+    std::array<std::multimap<Address, Entry>, NUM_BUCKETS> buckets;
+    u64 used_buckets{};
+};
+
+} // namespace Common
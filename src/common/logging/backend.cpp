@@ -4,13 +4,20 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <climits>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <thread>
+#include <type_traits>
+#include <vector>
 
 #include <boost/algorithm/string/replace.hpp>
+#include <fmt/args.h>
 #include <fmt/ranges.h>
 
 #ifdef _WIN32
@@ -23,6 +30,7 @@
 #include "common/fs/path_util.h"
 #include "common/literals.h"
 #include "common/polyfill_thread.h"
+#include "common/spsc_ring.h"
 #include "common/thread.h"
 
 #include "common/logging/backend.h"
@@ -49,6 +57,197 @@ constexpr const char* TrimSourcePath(std::string_view source) {
     return source.data() + idx;
 }
 
+/// Most arguments a record can capture, messages with more are formatted by the caller
+constexpr size_t MAX_RECORD_ARGS = 12;
+/// Storage for the captured strings, or for the message when the caller formatted it
+constexpr size_t RECORD_TEXT_SIZE = 320;
+/// Records each thread can have in flight before new ones are dropped
+constexpr size_t THREAD_RING_CAPACITY = 1024;
+
+enum class ArgType : u8 {
+    Int,
+    UInt,
+    Bool,
+    Char,
+    Float,
+    Double,
+    String,
+    Pointer,
+};
+
+struct RecordArg {
+    ArgType type;
+    u16 text_offset;
+    u16 text_size;
+    union {
+        s64 int_value;
+        u64 uint_value;
+        double double_value;
+        const void* pointer;
+    };
+};
+
+/**
+ * Fixed-size binary log record. The format string, file and function names have static storage,
+ * so only the argument values are captured and the message is formatted on the logging thread.
+ * Arguments that can't be captured, like types with their own formatter, make the caller format
+ * the message into the text instead.
+ */
+struct Record {
+    std::chrono::microseconds timestamp;
+    const char* filename;
+    const char* function;
+    fmt::string_view format;
+    unsigned int line_num;
+    Class log_class;
+    Level log_level;
+    bool is_formatted;
+    u8 num_args;
+    u16 text_size;
+    std::array<RecordArg, MAX_RECORD_ARGS> args;
+    std::array<char, RECORD_TEXT_SIZE> text;
+};
+
+template <typename Visitor>
+bool VisitFormatArg(Visitor&& visitor, const fmt::basic_format_arg<fmt::format_context>& arg) {
+#if FMT_VERSION >= 110000
+    return arg.visit(std::forward<Visitor>(visitor));
+#else
+    return fmt::visit_format_arg(std::forward<Visitor>(visitor), arg);
+#endif
+}
+
+/// Copies a format argument into a record, returns false when it can't be captured.
+class ArgCapture {
+public:
+    explicit ArgCapture(Record& record_) : record{record_} {}
+
+    template <typename T>
+    bool operator()(T value) {
+        RecordArg& arg = record.args[record.num_args];
+        if constexpr (std::is_same_v<T, bool>) {
+            arg.type = ArgType::Bool;
+            arg.uint_value = value ? 1 : 0;
+        } else if constexpr (std::is_same_v<T, char>) {
+            arg.type = ArgType::Char;
+            arg.int_value = value;
+        } else if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(u64)) {
+            if constexpr (std::is_signed_v<T>) {
+                arg.type = ArgType::Int;
+                arg.int_value = value;
+            } else {
+                arg.type = ArgType::UInt;
+                arg.uint_value = value;
+            }
+        } else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+            arg.type = std::is_same_v<T, float> ? ArgType::Float : ArgType::Double;
+            arg.double_value = value;
+        } else if constexpr (std::is_same_v<T, const char*>) {
+            return CaptureString(arg, value ? std::string_view{value} : std::string_view{});
+        } else if constexpr (std::is_same_v<T, fmt::string_view>) {
+            return CaptureString(arg, std::string_view{value.data(), value.size()});
+        } else if constexpr (std::is_same_v<T, const void*>) {
+            arg.type = ArgType::Pointer;
+            arg.pointer = value;
+        } else {
+            // Custom formatters, 128-bit integers and long doubles
+            return false;
+        }
+        return true;
+    }
+
+private:
+    bool CaptureString(RecordArg& arg, std::string_view value) {
+        if (value.size() > RECORD_TEXT_SIZE - record.text_size) {
+            return false;
+        }
+        arg.type = ArgType::String;
+        arg.text_offset = record.text_size;
+        arg.text_size = static_cast<u16>(value.size());
+        std::copy(value.begin(), value.end(), record.text.begin() + record.text_size);
+        record.text_size += static_cast<u16>(value.size());
+        return true;
+    }
+
+    Record& record;
+};
+
+/// Captures all the arguments of a message, returns false when the caller has to format it.
+bool CaptureArgs(Record& record, const fmt::format_args& args) {
+    for (int i = 0;; ++i) {
+        const auto arg = args.get(i);
+        if (!arg) {
+            return true;
+        }
+        if (record.num_args == MAX_RECORD_ARGS || !VisitFormatArg(ArgCapture{record}, arg)) {
+            return false;
+        }
+        ++record.num_args;
+    }
+}
+
+std::string FormatRecord(const Record& record) {
+    if (record.is_formatted) {
+        return std::string(record.text.data(), record.text_size);
+    }
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    for (size_t i = 0; i < record.num_args; ++i) {
+        const RecordArg& arg = record.args[i];
+        switch (arg.type) {
+        case ArgType::Int:
+            store.push_back(arg.int_value);
+            break;
+        case ArgType::UInt:
+            store.push_back(arg.uint_value);
+            break;
+        case ArgType::Bool:
+            store.push_back(arg.uint_value != 0);
+            break;
+        case ArgType::Char:
+            store.push_back(static_cast<char>(arg.int_value));
+            break;
+        case ArgType::Float:
+            store.push_back(static_cast<float>(arg.double_value));
+            break;
+        case ArgType::Double:
+            store.push_back(arg.double_value);
+            break;
+        case ArgType::String:
+            store.push_back(std::string_view{record.text.data() + arg.text_offset, arg.text_size});
+            break;
+        case ArgType::Pointer:
+            store.push_back(arg.pointer);
+            break;
+        }
+    }
+    try {
+        return fmt::vformat(record.format, store);
+    } catch (const fmt::format_error&) {
+        // A spec only valid for the original type, like a pointer presentation for a C string
+        return std::string(record.format.data(), record.format.size());
+    }
+}
+
+/// Records of a single thread, the thread is the only producer and the logging thread consumes.
+struct ThreadRing {
+    SPSCRing<Record, THREAD_RING_CAPACITY> ring;
+    std::atomic<u64> num_dropped{0};
+    std::atomic_bool is_closed{false};
+};
+
+/// Marks the ring of the thread as closed when it exits, the logging thread drains and frees it.
+struct ThreadRingHolder {
+    ~ThreadRingHolder() {
+        if (ring) {
+            ring->is_closed.store(true, std::memory_order_release);
+        }
+    }
+
+    std::shared_ptr<ThreadRing> ring;
+};
+
+thread_local ThreadRingHolder thread_ring;
+
 /// @brief Interface for logging backends.
 class Backend {
 public:
@@ -260,9 +459,40 @@ public:
     }
 
     void PushEntry(Class log_class, Level log_level, const char* filename, unsigned int line_num,
-                   const char* function, std::string&& message) noexcept {
-        message_queue.EmplaceWait(
-            CreateEntry(log_class, log_level, TrimSourcePath(filename), line_num, function, std::move(message)));
+                   const char* function, fmt::string_view format,
+                   const fmt::format_args& args) noexcept {
+        Record record;
+        record.timestamp = Timestamp();
+        record.filename = TrimSourcePath(filename);
+        record.function = function;
+        record.format = format;
+        record.line_num = line_num;
+        record.log_class = log_class;
+        record.log_level = log_level;
+        record.is_formatted = false;
+        record.num_args = 0;
+        record.text_size = 0;
+        if (!CaptureArgs(record, args)) {
+            const auto result =
+                fmt::vformat_to_n(record.text.data(), record.text.size(), format, args);
+            if (result.size > record.text.size()) {
+                // Too long for a record, these are rare enough to take the locked queue.
+                queued_entries.fetch_add(1, std::memory_order_relaxed);
+                message_queue.EmplaceWait(CreateEntry(log_class, log_level, record.filename,
+                                                      line_num, function,
+                                                      fmt::vformat(format, args)));
+                WakeBackendThread();
+                return;
+            }
+            record.is_formatted = true;
+            record.text_size = static_cast<u16>(result.size);
+        }
+        ThreadRing& ring = GetThreadRing();
+        if (!ring.ring.TryEmplace(record)) {
+            ring.num_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        WakeBackendThread();
     }
 
 private:
@@ -274,23 +504,106 @@ private:
     void StartBackendThread() {
         backend_thread = std::jthread([this](std::stop_token stop_token) {
             Common::SetCurrentThreadName("Logger");
-            Entry entry;
-            const auto write_logs = [this, &entry]() {
-                ForEachBackend([&entry](Backend& backend) { backend.Write(entry); });
-            };
             while (!stop_token.stop_requested()) {
-                message_queue.PopWait(entry, stop_token);
-                if (entry.filename != nullptr)
-                    write_logs();
+                if (!WriteAvailableEntries()) {
+                    WaitForEntries(stop_token);
+                }
             }
-            // Drain the logging queue. Only writes out up to MAX_LOGS_TO_WRITE to prevent a
-            // case where a system is repeatedly spamming logs even on close.
-            int max_logs_to_write = filter.IsDebug() ? INT_MAX : 100;
-            while (max_logs_to_write-- && message_queue.TryPop(entry))
-                write_logs();
+            // Drain what is left once. Every ring is bounded and only drained up to its capacity,
+            // so a system that keeps spamming logs on close can't stall the shutdown.
+            WriteAvailableEntries();
         });
     }
 
+    ThreadRing& GetThreadRing() {
+        if (!thread_ring.ring) {
+            thread_ring.ring = std::make_shared<ThreadRing>();
+            std::scoped_lock lock{rings_mutex};
+            rings.push_back(thread_ring.ring);
+        }
+        return *thread_ring.ring;
+    }
+
+    void WakeBackendThread() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (backend_waiting.load(std::memory_order_relaxed)) {
+            data_epoch.fetch_add(1, std::memory_order_release);
+            data_epoch.notify_one();
+        }
+    }
+
+    void WaitForEntries(std::stop_token stop_token) {
+        const u32 epoch = data_epoch.load(std::memory_order_acquire);
+        backend_waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!HasPendingEntries()) {
+            std::stop_callback callback{stop_token, [this] {
+                data_epoch.fetch_add(1, std::memory_order_release);
+                data_epoch.notify_all();
+            }};
+            data_epoch.wait(epoch, std::memory_order_acquire);
+        }
+        backend_waiting.store(false, std::memory_order_relaxed);
+    }
+
+    bool HasPendingEntries() {
+        std::scoped_lock lock{rings_mutex};
+        return queued_entries.load(std::memory_order_relaxed) != 0 ||
+               std::ranges::any_of(rings, [](const std::shared_ptr<ThreadRing>& ring) {
+                   return !ring->ring.Empty() ||
+                          ring->num_dropped.load(std::memory_order_relaxed) != 0;
+               });
+    }
+
+    /// Writes the entries of every thread in timestamp order, returns false if there were none.
+    bool WriteAvailableEntries() {
+        {
+            std::scoped_lock lock{rings_mutex};
+            backend_rings = rings;
+            // Rings of threads that exited are dropped once drained, the backend keeps its copy
+            // alive until the end of this pass.
+            std::erase_if(rings, [](const std::shared_ptr<ThreadRing>& ring) {
+                return ring->is_closed.load(std::memory_order_acquire) && ring->ring.Empty();
+            });
+        }
+        pending_entries.clear();
+        for (const auto& ring : backend_rings) {
+            for (size_t i = 0; i < THREAD_RING_CAPACITY; ++i) {
+                const bool consumed = ring->ring.TryConsume([this](Record& record) {
+                    pending_entries.push_back(Entry{
+                        .timestamp = record.timestamp,
+                        .log_class = record.log_class,
+                        .log_level = record.log_level,
+                        .filename = record.filename,
+                        .line_num = record.line_num,
+                        .function = record.function,
+                        .message = FormatRecord(record),
+                    });
+                });
+                if (!consumed) {
+                    break;
+                }
+            }
+            if (const u64 num_dropped = ring->num_dropped.exchange(0, std::memory_order_relaxed)) {
+                pending_entries.push_back(CreateEntry(
+                    Class::Log, Level::Warning, TrimSourcePath(__FILE__), __LINE__, __func__,
+                    fmt::format("Dropped {} log messages from a thread that logged too fast",
+                                num_dropped)));
+            }
+        }
+        backend_rings.clear();
+        Entry entry;
+        for (size_t i = 0; i < THREAD_RING_CAPACITY && message_queue.TryPop(entry); ++i) {
+            queued_entries.fetch_sub(1, std::memory_order_relaxed);
+            pending_entries.push_back(std::move(entry));
+        }
+        std::ranges::stable_sort(pending_entries, {}, &Entry::timestamp);
+        for (const Entry& pending_entry : pending_entries) {
+            ForEachBackend([&pending_entry](Backend& backend) { backend.Write(pending_entry); });
+        }
+        return !pending_entries.empty();
+    }
+
     void StopBackendThread() {
         backend_thread.request_stop();
         if (backend_thread.joinable())
@@ -298,13 +611,17 @@ private:
         ForEachBackend([](Backend& backend) { backend.Flush(); });
     }
 
-    Entry CreateEntry(Class log_class, Level log_level, const char* filename, unsigned int line_nr,
-                      const char* function, std::string&& message) const {
+    std::chrono::microseconds Timestamp() const {
         using std::chrono::duration_cast;
         using std::chrono::microseconds;
         using std::chrono::steady_clock;
+        return duration_cast<microseconds>(steady_clock::now() - time_origin);
+    }
+
+    Entry CreateEntry(Class log_class, Level log_level, const char* filename, unsigned int line_nr,
+                      const char* function, std::string&& message) const {
         return {
-            .timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin),
+            .timestamp = Timestamp(),
             .log_class = log_class,
             .log_level = log_level,
             .filename = filename,
@@ -337,7 +654,19 @@ private:
     LogcatBackend lc_backend{};
 #endif
 
+    /// Messages too long for a record
     MPSCQueue<Entry> message_queue{};
+    std::atomic_size_t queued_entries{0};
+
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    std::atomic<u32> data_epoch{0};
+    std::atomic_bool backend_waiting{false};
+
+    // Only used by the backend thread
+    std::vector<std::shared_ptr<ThreadRing>> backend_rings;
+    std::vector<Entry> pending_entries;
+
     std::chrono::steady_clock::time_point time_origin{std::chrono::steady_clock::now()};
     std::jthread backend_thread;
 };
@@ -363,6 +692,11 @@ void SetGlobalFilter(const Filter& filter) {
     Impl::Instance().SetGlobalFilter(filter);
 }
 
+bool IsLogEnabled(Class log_class, Level log_level) {
+    return !initialization_in_progress_suppress_logging &&
+           Impl::Instance().CanPushEntry(log_class, log_level);
+}
+
 void SetColorConsoleBackendEnabled(bool enabled) {
     Impl::Instance().SetColorConsoleBackendEnabled(enabled);
 }
@@ -373,7 +707,7 @@ void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
     if (!initialization_in_progress_suppress_logging) {
         auto& instance = Impl::Instance();
         if (instance.CanPushEntry(log_class, log_level))
-            instance.PushEntry(log_class, log_level, filename, line_num, function, fmt::vformat(format, args));
+            instance.PushEntry(log_class, log_level, filename, line_num, function, format, args);
     }
 }
 } // namespace Common::Log
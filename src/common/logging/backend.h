@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -24,5 +27,9 @@ void DisableLoggingInTests();
  */
 void SetGlobalFilter(const Filter& filter);
 
+/// Returns whether messages of the class and level pass the global filter, so costly ones can be
+/// skipped before they are formatted.
+[[nodiscard]] bool IsLogEnabled(Class log_class, Level log_level);
+
 void SetColorConsoleBackendEnabled(bool enabled);
 } // namespace Common::Log
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+
+namespace Common {
+
+/**
+ * Bounded lock-free multi-producer single-consumer ring with preallocated slots.
+ *
+ * Producers claim a slot with a single CAS and construct the element in place, the consumer
+ * processes it in place without moving it out. Sleeping is done through futex-style atomic waits
+ * that are only signaled when the other side is actually asleep, so a push never takes a lock.
+ *
+ * @tparam T        Element type
+ * @tparam Capacity Number of slots, must be a power of two
+ */
+template <typename T, size_t Capacity>
+class MPSCRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+    static constexpr size_t Mask = Capacity - 1;
+
+public:
+    // Slots are default initialized so their storage is not touched until it is first used.
+    MPSCRing() : slots{new Slot[Capacity]} {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MPSCRing() {
+        while (TryConsume([](T&) {})) {
+        }
+    }
+
+    MPSCRing(const MPSCRing&) = delete;
+    MPSCRing& operator=(const MPSCRing&) = delete;
+
+    /**
+     * Constructs an element at the back of the ring, waiting for a free slot if it is full.
+     * @returns Position of the element, strictly increasing in the order elements are consumed
+     */
+    template <typename... Args>
+    u64 EmplaceWait(Args&&... args) {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &slots[pos & Mask];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The ring is full, wait until the consumer releases this slot.
+                WaitForSpace(*slot, pos);
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        std::construct_at(slot->Get(), std::forward<Args>(args)...);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumer_waiting.load(std::memory_order_relaxed)) {
+            Wake(data_epoch, false);
+        }
+        return pos;
+    }
+
+    /// Processes the element at the front of the ring in place, if there is any.
+    template <typename Func>
+    bool TryConsume(Func&& func) {
+        Slot& slot = slots[dequeue_pos & Mask];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos + 1) {
+            return false;
+        }
+        T* const value = slot.Get();
+        func(*value);
+        std::destroy_at(value);
+        slot.sequence.store(dequeue_pos + Capacity, std::memory_order_release);
+        ++dequeue_pos;
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (producers_waiting.load(std::memory_order_relaxed) != 0) {
+            Wake(space_epoch, true);
+        }
+        return true;
+    }
+
+    /**
+     * Processes the element at the front of the ring in place, sleeping until there is one.
+     * @returns False when the stop token was signaled before an element was available
+     */
+    template <typename Func>
+    bool ConsumeWait(Func&& func, std::stop_token stop_token) {
+        while (!TryConsume(func)) {
+            if (stop_token.stop_requested()) {
+                return false;
+            }
+            const u32 epoch = data_epoch.load(std::memory_order_acquire);
+            consumer_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (Empty()) {
+                std::stop_callback callback{stop_token, [this] { Wake(data_epoch, true); }};
+                data_epoch.wait(epoch, std::memory_order_acquire);
+            }
+            consumer_waiting.store(false, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /// Returns true when the consumer has nothing to process. Only valid on the consumer thread.
+    [[nodiscard]] bool Empty() const {
+        const Slot& slot = slots[dequeue_pos & Mask];
+        return slot.sequence.load(std::memory_order_acquire) != dequeue_pos + 1;
+    }
+
+private:
+    struct Slot {
+        T* Get() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        alignas(64) std::atomic_size_t sequence{};
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    void WaitForSpace(const Slot& slot, size_t pos) {
+        const u32 epoch = space_epoch.load(std::memory_order_acquire);
+        producers_waiting.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (static_cast<std::ptrdiff_t>(slot.sequence.load(std::memory_order_acquire) - pos) < 0) {
+            space_epoch.wait(epoch, std::memory_order_acquire);
+        }
+        producers_waiting.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    static void Wake(std::atomic<u32>& epoch, bool all) {
+        epoch.fetch_add(1, std::memory_order_release);
+        if (all) {
+            epoch.notify_all();
+        } else {
+            epoch.notify_one();
+        }
+    }
+
+    std::unique_ptr<Slot[]> slots;
+
+    alignas(64) std::atomic_size_t enqueue_pos{0};
+    std::atomic<u32> space_epoch{0};
+    std::atomic<u32> producers_waiting{0};
+
+    alignas(64) size_t dequeue_pos{0};
+    std::atomic<u32> data_epoch{0};
+    std::atomic_bool consumer_waiting{false};
+};
+
+} // namespace Common
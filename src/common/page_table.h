@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -74,8 +77,9 @@ struct PageTable {
         }
 
         /// Write a page pointer and type pair atomically
-        void Store(uintptr_t pointer, PageType type) noexcept {
-            raw.store(pointer | static_cast<uintptr_t>(type));
+        void Store(uintptr_t pointer, PageType type,
+                   std::memory_order order = std::memory_order_seq_cst) noexcept {
+            raw.store(pointer | static_cast<uintptr_t>(type), order);
         }
 
         /// Unpack a pointer from a page info raw representation
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/profiler.h"
+#include "common/spin_lock.h"
+#include "common/steady_clock.h"
+
+namespace Common::Profiler {
+namespace {
+
+// Zones kept per thread, the oldest ones are overwritten once it's full
+constexpr size_t ZONES_PER_THREAD = 1 << 20;
+
+struct Zone {
+    const char* name;
+    s64 begin;
+    s64 end;
+};
+
+struct Timeline {
+    SpinLock lock;
+    std::string name;
+    u32 id{};
+    std::vector<Zone> zones; ///< Ring allocated on the first zone
+    size_t next{};
+    bool wrapped{};
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Timeline>> timelines;
+    s64 origin{};
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+Timeline& CurrentTimeline() {
+    // Shared with the registry, so timelines of finished threads can still be written
+    thread_local const std::shared_ptr<Timeline> timeline = [] {
+        auto new_timeline = std::make_shared<Timeline>();
+        Registry& registry = GetRegistry();
+        std::scoped_lock lock{registry.mutex};
+        new_timeline->id = static_cast<u32>(registry.timelines.size() + 1);
+        new_timeline->name = fmt::format("Thread {}", new_timeline->id);
+        registry.timelines.push_back(new_timeline);
+        return new_timeline;
+    }();
+    return *timeline;
+}
+
+std::string EscapeJson(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped.push_back('\\');
+        }
+        if (static_cast<unsigned char>(c) >= 0x20) {
+            escaped.push_back(c);
+        }
+    }
+    return escaped;
+}
+
+void WriteTimeline(std::string& out, const Timeline& timeline, s64 origin) {
+    fmt::format_to(std::back_inserter(out),
+                   "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},"
+                   "\"args\":{{\"name\":\"{}\"}}}},\n",
+                   timeline.id, EscapeJson(timeline.name));
+    const size_t count = timeline.wrapped ? timeline.zones.size() : timeline.next;
+    const size_t first = timeline.wrapped ? timeline.next : 0;
+    for (size_t i = 0; i < count; ++i) {
+        const Zone& zone = timeline.zones[(first + i) % timeline.zones.size()];
+        if (zone.begin < origin) {
+            continue;
+        }
+        // Timestamps are in microseconds
+        fmt::format_to(std::back_inserter(out),
+                       "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},"
+                       "\"dur\":{:.3f}}},\n",
+                       zone.name, timeline.id, static_cast<double>(zone.begin - origin) / 1000.0,
+                       static_cast<double>(zone.end - zone.begin) / 1000.0);
+    }
+}
+
+} // Anonymous namespace
+
+namespace Detail {
+std::atomic_bool is_recording{};
+
+s64 Now() noexcept {
+    return SteadyClock::Now().time_since_epoch().count();
+}
+
+void RecordZone(const char* name, s64 begin, s64 end) noexcept {
+    Timeline& timeline = CurrentTimeline();
+    std::scoped_lock lock{timeline.lock};
+    if (timeline.zones.empty()) {
+        timeline.zones.resize(ZONES_PER_THREAD);
+    }
+    timeline.zones[timeline.next] = Zone{name, begin, end};
+    if (++timeline.next == timeline.zones.size()) {
+        timeline.next = 0;
+        timeline.wrapped = true;
+    }
+}
+} // namespace Detail
+
+void Start() {
+    Registry& registry = GetRegistry();
+    std::scoped_lock lock{registry.mutex};
+    for (const auto& timeline : registry.timelines) {
+        std::scoped_lock timeline_lock{timeline->lock};
+        timeline->next = 0;
+        timeline->wrapped = false;
+    }
+    registry.origin = Detail::Now();
+    Detail::is_recording.store(true, std::memory_order_relaxed);
+}
+
+bool Stop(const std::filesystem::path& path) {
+    if (!Detail::is_recording.exchange(false, std::memory_order_relaxed)) {
+        return false;
+    }
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    {
+        Registry& registry = GetRegistry();
+        std::scoped_lock lock{registry.mutex};
+        for (const auto& timeline : registry.timelines) {
+            std::scoped_lock timeline_lock{timeline->lock};
+            WriteTimeline(out, *timeline, registry.origin);
+        }
+    }
+    // Drop the trailing comma of the last event
+    if (out.ends_with(",\n")) {
+        out.erase(out.size() - 2, 1);
+    }
+    out += "]}\n";
+
+    if (!FS::CreateParentDir(path)) {
+        return false;
+    }
+    FS::IOFile file(path, FS::FileAccessMode::Write, FS::FileType::TextFile);
+    return file.WriteString(out) == out.size();
+}
+
+void SetThreadName(std::string_view name) {
+    Timeline& timeline = CurrentTimeline();
+    std::scoped_lock lock{timeline.lock};
+    timeline.name = name;
+}
+
+} // namespace Common::Profiler
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <string_view>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+
+namespace Common::Profiler {
+
+namespace Detail {
+extern std::atomic_bool is_recording;
+
+[[nodiscard]] s64 Now() noexcept;
+void RecordZone(const char* name, s64 begin, s64 end) noexcept;
+} // namespace Detail
+
+/// Returns true while zones are being recorded.
+[[nodiscard]] inline bool IsRecording() noexcept {
+    return Detail::is_recording.load(std::memory_order_relaxed);
+}
+
+/// Discards previous timelines and starts recording zones from every thread.
+void Start();
+
+/**
+ * Stops recording and writes the timelines of every thread to a file in the Chrome trace event
+ * format, which can be opened in Perfetto or chrome://tracing.
+ * @returns True if the file was written.
+ */
+bool Stop(const std::filesystem::path& path);
+
+/// Names the timeline of the current thread.
+void SetThreadName(std::string_view name);
+
+/**
+ * Records the time spent in a scope to the timeline of the current thread.
+ * It costs a relaxed load when not recording. The scope must not switch fibers, or the zone would
+ * end on another thread.
+ */
+class ScopedZone {
+public:
+    /// @param name_ Name of the zone, it has to outlive the recording
+    explicit ScopedZone(const char* name_) noexcept
+        : name{name_}, begin{IsRecording() ? Detail::Now() : 0} {}
+
+    ~ScopedZone() {
+        if (begin != 0) {
+            Detail::RecordZone(name, begin, Detail::Now());
+        }
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    const char* name;
+    s64 begin;
+};
+
+} // namespace Common::Profiler
+
+/// Records the rest of the enclosing scope as a zone named after a string literal.
+#define PROFILE_SCOPE(name)                                                                        \
+    const ::Common::Profiler::ScopedZone CONCAT2(profile_zone_, __LINE__) {                        \
+        name                                                                                       \
+    }
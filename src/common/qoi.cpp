@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+
+#include "common/assert.h"
+#include "common/qoi.h"
+
+namespace Common::Qoi {
+
+namespace {
+
+constexpr u8 OP_INDEX = 0x00;
+constexpr u8 OP_DIFF = 0x40;
+constexpr u8 OP_LUMA = 0x80;
+constexpr u8 OP_RUN = 0xc0;
+constexpr u8 OP_RGB = 0xfe;
+
+constexpr u32 MAX_RUN = 62;
+constexpr size_t HEADER_SIZE = 14;
+constexpr std::array<u8, 8> END_MARKER{0, 0, 0, 0, 0, 0, 0, 1};
+
+struct Pixel {
+    bool operator==(const Pixel&) const noexcept = default;
+
+    u8 r;
+    u8 g;
+    u8 b;
+    u8 a;
+};
+
+u32 Hash(const Pixel& px) {
+    return (px.r * 3 + px.g * 5 + px.b * 7 + px.a * 11) % 64;
+}
+
+void PushU32(std::vector<u8>& out, u32 value) {
+    out.push_back(static_cast<u8>(value >> 24));
+    out.push_back(static_cast<u8>(value >> 16));
+    out.push_back(static_cast<u8>(value >> 8));
+    out.push_back(static_cast<u8>(value));
+}
+
+} // Anonymous namespace
+
+std::vector<u8> EncodeBgra8(std::span<const u8> pixels, u32 width, u32 height, bool flip_y) {
+    const size_t num_pixels = static_cast<size_t>(width) * height;
+    ASSERT(pixels.size() >= num_pixels * 4);
+
+    std::vector<u8> out;
+    // Worst case is every pixel taking an RGB op
+    out.reserve(HEADER_SIZE + num_pixels * 4 + END_MARKER.size());
+    out.insert(out.end(), {'q', 'o', 'i', 'f'});
+    PushU32(out, width);
+    PushU32(out, height);
+    out.push_back(3); // Channels
+    out.push_back(0); // sRGB with linear alpha
+
+    // Decoders start with a transparent black index, so an opaque black pixel is never in it
+    std::array<Pixel, 64> index;
+    index.fill(Pixel{0, 0, 0, 0});
+    Pixel prev{0, 0, 0, 255};
+    u32 run = 0;
+    size_t remaining = num_pixels;
+    for (u32 y = 0; y < height; ++y) {
+        const u32 row = flip_y ? height - 1 - y : y;
+        const u8* src = pixels.data() + static_cast<size_t>(row) * width * 4;
+        for (u32 x = 0; x < width; ++x, src += 4) {
+            const Pixel px{.r = src[2], .g = src[1], .b = src[0], .a = 255};
+            --remaining;
+            if (px == prev) {
+                if (++run == MAX_RUN || remaining == 0) {
+                    out.push_back(static_cast<u8>(OP_RUN | (run - 1)));
+                    run = 0;
+                }
+                continue;
+            }
+            if (run > 0) {
+                out.push_back(static_cast<u8>(OP_RUN | (run - 1)));
+                run = 0;
+            }
+            const u32 hash = Hash(px);
+            if (index[hash] == px) {
+                out.push_back(static_cast<u8>(OP_INDEX | hash));
+                prev = px;
+                continue;
+            }
+            index[hash] = px;
+
+            const s32 vr = static_cast<s8>(px.r - prev.r);
+            const s32 vg = static_cast<s8>(px.g - prev.g);
+            const s32 vb = static_cast<s8>(px.b - prev.b);
+            const s32 vg_r = vr - vg;
+            const s32 vg_b = vb - vg;
+            if (vr >= -2 && vr <= 1 && vg >= -2 && vg <= 1 && vb >= -2 && vb <= 1) {
+                out.push_back(static_cast<u8>(OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+            } else if (vg_r >= -8 && vg_r <= 7 && vg >= -32 && vg <= 31 && vg_b >= -8 &&
+                       vg_b <= 7) {
+                out.push_back(static_cast<u8>(OP_LUMA | (vg + 32)));
+                out.push_back(static_cast<u8>((vg_r + 8) << 4 | (vg_b + 8)));
+            } else {
+                out.insert(out.end(), {OP_RGB, px.r, px.g, px.b});
+            }
+            prev = px;
+        }
+    }
+    out.insert(out.end(), END_MARKER.begin(), END_MARKER.end());
+    return out;
+}
+
+} // namespace Common::Qoi
@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Common::Qoi {
+
+/// Encodes BGRA8 pixels as an opaque QOI image, a lossless format that encodes several times
+/// faster than PNG at a slightly larger size. Rows are written bottom to top when flip_y is set.
+[[nodiscard]] std::vector<u8> EncodeBgra8(std::span<const u8> pixels, u32 width, u32 height,
+                                          bool flip_y);
+
+} // namespace Common::Qoi
@@ -11,10 +11,12 @@
 #include <exception>
 #include <stdexcept>
 #endif
+#include <array>
 #include <compare>
 #include <cstddef>
 #include <filesystem>
 #include <functional>
+#include <mutex>
 #include <string_view>
 #include <type_traits>
 #include <fmt/core.h>
@@ -141,25 +143,84 @@ void LogSettings() {
     log_path("DataStorage_SDMCDir", Common::FS::GetEdenPath(Common::FS::EdenPath::SDMCDir));
 }
 
+static RuntimeSettingsSnapshot MakeRuntimeSnapshot() {
+    return RuntimeSettingsSnapshot{
+        .cpu_ticks = values.cpu_ticks.GetValue(),
+        .query_result_tolerance = values.query_result_tolerance.GetValue(),
+        .speed_limit = SpeedLimit(),
+        .gpu_accuracy = values.current_gpu_accuracy,
+        .dma_accuracy = values.dma_accuracy.GetValue(),
+        .fast_cpu_time = values.fast_cpu_time.GetValue(),
+        .fast_gpu_time = values.fast_gpu_time.GetValue(),
+        .use_custom_cpu_ticks = values.use_custom_cpu_ticks.GetValue(),
+        .use_fast_cpu_time = values.use_fast_cpu_time.GetValue(),
+        .sync_core_speed = values.sync_core_speed.GetValue(),
+        .use_fast_gpu_time = values.use_fast_gpu_time.GetValue(),
+        .use_reactive_flushing = values.use_reactive_flushing.GetValue(),
+        .barrier_feedback_loops = values.barrier_feedback_loops.GetValue(),
+        .sync_memory_operations = values.sync_memory_operations.GetValue(),
+#ifdef ANDROID
+        .early_release_fences = values.early_release_fences.GetValue(),
+#endif
+        .batched_query_readback = values.batched_query_readback.GetValue(),
+    };
+}
+
+// Built from the values defined above, so it starts with the defaults of the settings
+static const RuntimeSettingsSnapshot default_runtime_snapshot{MakeRuntimeSnapshot()};
+std::atomic<const RuntimeSettingsSnapshot*> runtime_snapshot{&default_runtime_snapshot};
+
+static std::mutex runtime_snapshot_mutex;
+// Readers don't pin snapshots, so slots are reused oldest first. A reader would have to hold a
+// snapshot across this many publishes of distinct settings for its slot to be overwritten.
+static constexpr size_t MAX_RUNTIME_SNAPSHOTS = 64;
+static std::array<RuntimeSettingsSnapshot, MAX_RUNTIME_SNAPSHOTS> runtime_snapshots;
+static size_t num_runtime_snapshots = 0;
+
+void PublishRuntimeSnapshot() {
+    const RuntimeSettingsSnapshot snapshot{MakeRuntimeSnapshot()};
+    std::scoped_lock lk{runtime_snapshot_mutex};
+    if (snapshot == *runtime_snapshot.load(std::memory_order_relaxed)) {
+        return;
+    }
+    // Settings usually toggle between a few values, point to the slot of an earlier publish
+    if (snapshot == default_runtime_snapshot) {
+        runtime_snapshot.store(&default_runtime_snapshot, std::memory_order_release);
+        return;
+    }
+    const size_t num_written = (std::min)(num_runtime_snapshots, MAX_RUNTIME_SNAPSHOTS);
+    for (size_t index = 0; index < num_written; ++index) {
+        if (runtime_snapshots[index] == snapshot) {
+            runtime_snapshot.store(&runtime_snapshots[index], std::memory_order_release);
+            return;
+        }
+    }
+    RuntimeSettingsSnapshot& slot =
+        runtime_snapshots[num_runtime_snapshots++ % MAX_RUNTIME_SNAPSHOTS];
+    slot = snapshot;
+    runtime_snapshot.store(&slot, std::memory_order_release);
+}
+
 void UpdateGPUAccuracy() {
-    values.current_gpu_accuracy = values.gpu_accuracy.GetValue();
+    values.current_gpu_accuracy = (std::min)(values.gpu_accuracy.GetValue(),
+                                             values.max_gpu_accuracy.load(std::memory_order_relaxed));
 }
 
 bool IsGPULevelExtreme() {
-    return values.current_gpu_accuracy == GpuAccuracy::Extreme;
+    return RuntimeSnapshot().gpu_accuracy == GpuAccuracy::Extreme;
 }
 
 bool IsGPULevelHigh() {
-    return values.current_gpu_accuracy == GpuAccuracy::Extreme ||
-           values.current_gpu_accuracy == GpuAccuracy::High;
+    const GpuAccuracy gpu_accuracy = RuntimeSnapshot().gpu_accuracy;
+    return gpu_accuracy == GpuAccuracy::Extreme || gpu_accuracy == GpuAccuracy::High;
 }
 
 bool IsDMALevelDefault() {
-    return values.dma_accuracy.GetValue() == DmaAccuracy::Default;
+    return RuntimeSnapshot().dma_accuracy == DmaAccuracy::Default;
 }
 
 bool IsDMALevelSafe() {
-    return values.dma_accuracy.GetValue() == DmaAccuracy::Safe;
+    return RuntimeSnapshot().dma_accuracy == DmaAccuracy::Safe;
 }
 
 bool IsFastmemEnabled() {
@@ -207,6 +268,11 @@ float Volume() {
     return values.volume.GetValue() / static_cast<f32>(values.volume.GetDefault());
 }
 
+u16 SpeedLimit() {
+    return (std::min)(values.speed_limit.GetValue(),
+                      values.max_speed_limit.load(std::memory_order_relaxed));
+}
+
 const char* TranslateCategory(Category category) {
     switch (category) {
     case Category::Android:
@@ -348,6 +414,7 @@ void UpdateRescalingInfo() {
     const auto setup = values.resolution_setup.GetValue();
     auto& info = values.resolution_info;
     TranslateResolutionInfo(setup, info);
+    PublishRuntimeSnapshot();
 }
 
 void RestoreGlobalState(bool is_powered_on) {
@@ -362,6 +429,7 @@ void RestoreGlobalState(bool is_powered_on) {
 
     // Reset per-game flags
     values.use_squashed_iterated_blend = false;
+    PublishRuntimeSnapshot();
 }
 
 static bool configuring_global = true;
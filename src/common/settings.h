@@ -8,6 +8,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <limits>
 #include <map>
 #include <memory>
 #include <stdexcept>
@@ -190,6 +192,11 @@ struct Values {
                                        Specialization::Scalar | Specialization::Percentage,
                                        true,
                                        true};
+    SwitchableSetting<bool> audio_adaptive_latency{linkage, false, "audio_adaptive_latency",
+                                                   Category::Audio};
+    SwitchableSetting<bool> audio_host_timing_voice_drop{linkage, false,
+                                                         "audio_host_timing_voice_drop",
+                                                         Category::Audio};
     Setting<bool, false> audio_muted{
                                      linkage, false, "audio_muted", Category::Audio, Specialization::Default, true, true};
     Setting<bool, false> dump_audio_commands{
@@ -217,8 +224,31 @@ struct Values {
                                              &use_speed_limit};
     SwitchableSetting<bool> sync_core_speed{linkage, false, "sync_core_speed", Category::Core,
                                             Specialization::Default};
+    Setting<bool> core_timing_batching{linkage, false, "core_timing_batching", Category::Core,
+                                       Specialization::Paired};
+    Setting<u16, true> core_timing_slack{linkage,
+                                         100,
+                                         0,
+                                         1000,
+                                         "core_timing_slack",
+                                         Category::Core,
+                                         Specialization::Default,
+                                         true,
+                                         false,
+                                         &core_timing_batching};
+    Setting<u8, true> service_threads{linkage, 0, 0, 7, "service_threads", Category::Core};
 
     // Memory
+    Setting<bool> use_huge_pages{linkage, false, "use_huge_pages", Category::Core};
+    Setting<bool> prefault_memory{linkage, false, "prefault_memory", Category::Core};
+    Setting<bool> use_write_watch{linkage, false, "use_write_watch", Category::Core};
+    Setting<bool> release_freed_memory{linkage,
+#ifdef __ANDROID__
+                                       true,
+#else
+                                       false,
+#endif
+                                       "release_freed_memory", Category::Core};
 #ifdef HAS_NCE
     SwitchableSetting<bool> lru_cache_enabled{linkage, false, "use_lru_cache", Category::System};
 #endif
@@ -241,6 +271,14 @@ struct Values {
     SwitchableSetting<CpuAccuracy, true> cpu_accuracy{linkage, CpuAccuracy::Auto,
                                                       "cpu_accuracy", Category::Cpu};
     SwitchableSetting<bool> vtable_bouncing{linkage, true, "vtable_bouncing", Category::Cpu};
+    SwitchableSetting<bool> cpu_block_cache{linkage, false, "cpu_block_cache", Category::Cpu};
+    Setting<bool> core_type_affinity{linkage,
+#ifdef __ANDROID__
+                                     true,
+#else
+                                     false,
+#endif
+                                     "core_type_affinity", Category::Cpu};
     SwitchableSetting<bool> use_fast_cpu_time{linkage,
                                               false,
                                               "use_fast_cpu_time",
@@ -294,6 +332,12 @@ struct Values {
                                               Category::CpuDebug};
     Setting<bool> cpuopt_ignore_memory_aborts{linkage, true, "cpuopt_ignore_memory_aborts",
                                               Category::CpuDebug};
+    Setting<bool> cpuopt_tiered_compilation{linkage, false, "cpuopt_tiered_compilation",
+                                            Category::CpuDebug};
+    Setting<bool> cpuopt_live_range_spilling{linkage, false, "cpuopt_live_range_spilling",
+                                             Category::CpuDebug};
+    Setting<bool> cpuopt_background_translation{linkage, false, "cpuopt_background_translation",
+                                                Category::CpuDebug};
 
     SwitchableSetting<bool> cpuopt_unsafe_host_mmu{linkage,
 #if !defined(__APPLE__) && !defined(__linux__) && !defined(__ANDROID__) && !defined(_WIN32)
@@ -374,6 +418,11 @@ struct Values {
                                                             Specialization::Default,
                                                             true,
                                                             true};
+    SwitchableSetting<bool> native_presentation{linkage, false, "native_presentation",
+                                                Category::Renderer};
+
+    // Set by the frontend while the swapchain presents to a fullscreen top-level window. Not saved.
+    std::atomic<bool> native_presentation_active{false};
     SwitchableSetting<AspectRatio, true> aspect_ratio{linkage,
                                                       AspectRatio::R16_9,
                                                       "aspect_ratio",
@@ -431,6 +480,10 @@ struct Values {
 
     GpuAccuracy current_gpu_accuracy{GpuAccuracy::High};
 
+    // Runtime caps on top of the configured values, lowered by the thermal governor. Not saved.
+    std::atomic<GpuAccuracy> max_gpu_accuracy{GpuAccuracy::Extreme};
+    std::atomic<u16> max_speed_limit{std::numeric_limits<u16>::max()};
+
     SwitchableSetting<DmaAccuracy, true> dma_accuracy{linkage,
                                                       DmaAccuracy::Default,
                                                       "dma_accuracy",
@@ -455,6 +508,8 @@ struct Values {
                                                            VramUsageMode::Conservative,
                                                            "vram_usage_mode",
                                                            Category::RendererAdvanced};
+    SwitchableSetting<bool> auto_performance_profile{linkage, false, "auto_performance_profile",
+                                                     Category::RendererAdvanced};
     SwitchableSetting<bool> skip_cpu_inner_invalidation{linkage,
                                                         false,
                                                         "skip_cpu_inner_invalidation",
@@ -485,8 +540,50 @@ struct Values {
                                                false,
 #endif
                                                "async_presentation", Category::RendererAdvanced};
+    SwitchableSetting<bool> present_wait{linkage, false, "present_wait",
+                                         Category::RendererAdvanced};
+    SwitchableSetting<bool> frame_generation{linkage, false, "frame_generation",
+                                             Category::RendererAdvanced};
+    SwitchableSetting<bool> async_compute_queue{linkage,
+#ifdef ANDROID
+                                                false,
+#else
+                                                true,
+#endif
+                                                "async_compute_queue", Category::RendererAdvanced};
+    SwitchableSetting<bool> batched_query_readback{linkage, true, "batched_query_readback",
+                                                   Category::RendererAdvanced};
+    SwitchableSetting<u32, true> query_result_tolerance{linkage,
+                                                        0,
+                                                        0,
+                                                        8,
+                                                        "query_result_tolerance",
+                                                        Category::RendererAdvanced,
+                                                        Specialization::Countable};
+    SwitchableSetting<bool> async_transfer_queue{linkage,
+                                                 true,
+                                                 "async_transfer_queue",
+                                                 Category::RendererAdvanced,
+                                                 Specialization::Paired,
+                                                 true,
+                                                 true};
+    SwitchableSetting<u32, true> transfer_queue_threshold_kb{linkage,
+                                                             256,
+                                                             4,
+                                                             65536,
+                                                             "transfer_queue_threshold_kb",
+                                                             Category::RendererAdvanced,
+                                                             Specialization::Countable,
+                                                             true,
+                                                             true,
+                                                             &async_transfer_queue};
+    SwitchableSetting<bool> sparse_texture_residency{linkage, false, "sparse_texture_residency",
+                                                     Category::RendererAdvanced};
     SwitchableSetting<bool> renderer_force_max_clock{linkage, false, "force_max_clock",
                                                      Category::RendererAdvanced};
+    SwitchableSetting<u8, true> vulkan_recording_threads{linkage, 1, 1, 8,
+                                                         "vulkan_recording_threads",
+                                                         Category::RendererAdvanced};
     SwitchableSetting<bool> use_reactive_flushing{linkage,
 #ifdef ANDROID
                                                   false,
@@ -562,6 +659,11 @@ struct Values {
 
     SwitchableSetting<bool> vertex_input_dynamic_state{linkage, true, "vertex_input_dynamic_state", Category::RendererExtensions};
     SwitchableSetting<bool> provoking_vertex{linkage, false, "provoking_vertex", Category::RendererExtensions};
+    SwitchableSetting<bool> graphics_pipeline_library{linkage, true, "graphics_pipeline_library", Category::RendererExtensions};
+    SwitchableSetting<bool> descriptor_buffer{linkage, true, "descriptor_buffer", Category::RendererExtensions};
+    SwitchableSetting<bool> dynamic_rendering{linkage, true, "dynamic_rendering", Category::RendererExtensions};
+    SwitchableSetting<bool> foveated_shading{linkage, false, "foveated_shading", Category::RendererExtensions};
+    SwitchableSetting<bool> host_image_copy{linkage, true, "host_image_copy", Category::RendererExtensions};
     SwitchableSetting<bool> descriptor_indexing{linkage, false, "descriptor_indexing", Category::RendererExtensions};
     SwitchableSetting<bool> sample_shading{linkage, false, "sample_shading", Category::RendererExtensions, Specialization::Paired};
     SwitchableSetting<u32, true> sample_shading_fraction{linkage,
@@ -582,6 +684,8 @@ struct Values {
                                           Category::RendererDebug};
     Setting<bool> disable_shader_loop_safety_checks{
                                                     linkage, false, "disable_shader_loop_safety_checks", Category::RendererDebug};
+    Setting<bool> disable_shader_value_numbering{linkage, false, "disable_shader_value_numbering",
+                                                 Category::RendererDebug};
     Setting<bool> enable_renderdoc_hotkey{linkage, false, "renderdoc_hotkey",
                                           Category::RendererDebug};
     SwitchableSetting<bool> disable_buffer_reorder{linkage, false, "disable_buffer_reorder",
@@ -657,6 +761,7 @@ struct Values {
     Setting<bool> controller_navigation{linkage, true, "controller_navigation", Category::Controls};
     Setting<bool> enable_joycon_driver{linkage, true, "enable_joycon_driver", Category::Controls};
     Setting<bool> enable_procon_driver{linkage, false, "enable_procon_driver", Category::Controls};
+    Setting<bool> event_driven_input{linkage, false, "event_driven_input", Category::Controls};
 
     SwitchableSetting<bool> vibration_enabled{linkage, true, "vibration_enabled",
                                               Category::Controls};
@@ -722,6 +827,11 @@ struct Values {
                                         Category::DataStorage};
     Setting<std::string> gamecard_path{linkage, std::string(), "gamecard_path",
                                        Category::DataStorage};
+    Setting<bool> mapped_file_reads{linkage, true, "mapped_file_reads", Category::DataStorage};
+    Setting<u16, true> nca_block_cache_size{linkage, 256,   0, 4096, "nca_block_cache_size",
+                                            Category::DataStorage};
+    Setting<std::string> shared_nca_cache_dir{linkage, std::string(), "shared_nca_cache_dir",
+                                              Category::DataStorage};
 
     // Debugging
     bool record_frame_times;
@@ -735,7 +845,12 @@ struct Values {
                                false};
     Setting<bool> dump_macros{
                               linkage, false, "dump_macros", Category::DebuggingGraphics, Specialization::Default, false};
+    Setting<bool> capture_gpu_commands{linkage, false, "capture_gpu_commands",
+                                       Category::DebuggingGraphics};
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
+    Setting<bool> record_frame_profile{linkage, false, "record_frame_profile", Category::Debugging};
+    Setting<bool> guest_sampling_profiler{linkage, false, "guest_sampling_profiler",
+                                          Category::Debugging};
     Setting<bool> reporting_services{
                                      linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
     Setting<bool> quest_flag{linkage, false, "quest_flag", Category::Debugging};
@@ -743,6 +858,10 @@ struct Values {
                                     Category::DebuggingGraphics};
     Setting<bool> disable_macro_hle{linkage, false, "disable_macro_hle",
                                     Category::DebuggingGraphics};
+    Setting<bool> log_macro_profile{linkage, false, "log_macro_profile",
+                                    Category::DebuggingGraphics};
+    Setting<bool> gpu_pass_profiling{linkage, false, "gpu_pass_profiling",
+                                     Category::DebuggingGraphics};
     Setting<bool> extended_logging{
                                    linkage, false, "extended_logging", Category::Debugging, Specialization::Default, false};
     Setting<bool> use_debug_asserts{linkage, false, "use_debug_asserts", Category::Debugging};
@@ -781,6 +900,41 @@ struct Values {
 
 extern Values values;
 
+/// Settings read on hot paths, copied out of the values once per frame so reading one doesn't go
+/// through the per-game switching of a setting. Published snapshots are left as they are until
+/// their slot is reused.
+struct alignas(64) RuntimeSettingsSnapshot {
+    bool operator==(const RuntimeSettingsSnapshot&) const = default;
+
+    u32 cpu_ticks{};
+    u32 query_result_tolerance{};
+    u16 speed_limit{}; ///< After the runtime cap
+    GpuAccuracy gpu_accuracy{};
+    DmaAccuracy dma_accuracy{};
+    CpuClock fast_cpu_time{};
+    GpuOverclock fast_gpu_time{};
+    bool use_custom_cpu_ticks{};
+    bool use_fast_cpu_time{};
+    bool sync_core_speed{};
+    bool use_fast_gpu_time{};
+    bool use_reactive_flushing{};
+    bool barrier_feedback_loops{};
+    bool sync_memory_operations{};
+    bool early_release_fences{}; ///< Android only
+    bool batched_query_readback{};
+};
+static_assert(sizeof(RuntimeSettingsSnapshot) == 64, "Snapshot should fit in a cache line");
+
+extern std::atomic<const RuntimeSettingsSnapshot*> runtime_snapshot;
+
+/// Returns the latest snapshot, it stays valid after a new one is published.
+[[nodiscard]] inline const RuntimeSettingsSnapshot& RuntimeSnapshot() {
+    return *runtime_snapshot.load(std::memory_order_acquire);
+}
+
+/// Copies the hot settings into a new snapshot if any of them changed.
+void PublishRuntimeSnapshot();
+
 void UpdateGPUAccuracy();
 bool IsGPULevelExtreme();
 bool IsGPULevelHigh();
@@ -796,6 +950,9 @@ bool IsDockedMode();
 
 float Volume();
 
+/// Returns the speed limit in percent, after the runtime cap
+u16 SpeedLimit();
+
 std::string GetTimeZoneString(TimeZone time_zone);
 
 void LogSettings();
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Common {
+
+/**
+ * Bounded lock-free single-producer single-consumer ring with preallocated slots.
+ *
+ * The producer constructs elements in place and never waits, a push fails when the ring is full.
+ * The consumer processes elements in place without moving them out.
+ *
+ * @tparam T        Element type
+ * @tparam Capacity Number of slots, must be a power of two
+ */
+template <typename T, size_t Capacity>
+class SPSCRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+    static constexpr size_t Mask = Capacity - 1;
+
+public:
+    // Slots are default initialized so their storage is not touched until it is first used.
+    SPSCRing() : slots{new Slot[Capacity]} {}
+
+    ~SPSCRing() {
+        while (TryConsume([](T&) {})) {
+        }
+    }
+
+    SPSCRing(const SPSCRing&) = delete;
+    SPSCRing& operator=(const SPSCRing&) = delete;
+
+    /// Constructs an element at the back of the ring, returns false when it is full.
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        const size_t pos = write_pos.load(std::memory_order_relaxed);
+        if (pos - cached_read_pos == Capacity) {
+            cached_read_pos = read_pos.load(std::memory_order_acquire);
+            if (pos - cached_read_pos == Capacity) {
+                return false;
+            }
+        }
+        std::construct_at(slots[pos & Mask].Get(), std::forward<Args>(args)...);
+        write_pos.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Processes the element at the front of the ring in place, if there is any.
+    template <typename Func>
+    bool TryConsume(Func&& func) {
+        const size_t pos = read_pos.load(std::memory_order_relaxed);
+        if (pos == cached_write_pos) {
+            cached_write_pos = write_pos.load(std::memory_order_acquire);
+            if (pos == cached_write_pos) {
+                return false;
+            }
+        }
+        T* const value = slots[pos & Mask].Get();
+        func(*value);
+        std::destroy_at(value);
+        read_pos.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Returns true when the consumer has nothing to process. Only valid on the consumer thread.
+    [[nodiscard]] bool Empty() const {
+        return read_pos.load(std::memory_order_relaxed) ==
+               write_pos.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Slot {
+        T* Get() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::unique_ptr<Slot[]> slots;
+
+    // Each side keeps a copy of the other side's position, so it only touches the shared cache
+    // line when the ring looks full or empty.
+    alignas(64) std::atomic_size_t write_pos{0};
+    size_t cached_read_pos{0};
+
+    alignas(64) std::atomic_size_t read_pos{0};
+    size_t cached_write_pos{0};
+};
+
+} // namespace Common
@@ -4,13 +4,20 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cstdio>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "common/error.h"
 #include "common/logging/log.h"
+#include "common/profiler.h"
 #include "common/thread.h"
 #ifdef __APPLE__
 #include <mach/mach.h>
+#include <pthread.h>
 #elif defined(__HAIKU__)
 #include <kernel/OS.h>
 #elif defined(_WIN32)
@@ -77,10 +84,167 @@ void SetCurrentThreadPriority(ThreadPriority new_priority) {
 #endif
 }
 
+namespace {
+
+#if defined(_WIN32)
+using CoreId = ULONG;
+#else
+using CoreId = u32;
+#endif
+
+/// Cores of each kind, both are empty when the processor only has one kind of core.
+struct CoreTypes {
+    std::vector<CoreId> performance;
+    std::vector<CoreId> efficiency;
+};
+
+/// Splits cores ranked by performance into the slowest ones and all the others.
+CoreTypes SplitCores(std::vector<std::pair<CoreId, u64>> ranked_cores) {
+    if (ranked_cores.size() < 2) {
+        return {};
+    }
+    const auto [min, max] = std::ranges::minmax(ranked_cores, {}, &std::pair<CoreId, u64>::second);
+    if (min.second == max.second) {
+        return {};
+    }
+    CoreTypes types;
+    for (const auto& [core, rank] : ranked_cores) {
+        (rank == min.second ? types.efficiency : types.performance).push_back(core);
+    }
+    return types;
+}
+
+#if defined(__linux__)
+
+std::optional<u64> ReadCpuNode(u32 cpu, const char* node) {
+    const std::string path = fmt::format("/sys/devices/system/cpu/cpu{}/{}", cpu, node);
+    std::FILE* const file = std::fopen(path.c_str(), "r");
+    if (!file) {
+        return std::nullopt;
+    }
+    unsigned long long value{};
+    const bool read = std::fscanf(file, "%llu", &value) == 1;
+    std::fclose(file);
+    return read ? std::optional<u64>{value} : std::nullopt;
+}
+
+CoreTypes DetectCoreTypes() {
+    const u32 num_cpus =
+        static_cast<u32>((std::min)(sysconf(_SC_NPROCESSORS_CONF), long{CPU_SETSIZE}));
+    // ARM reports the relative capacity of each core, other architectures only their frequency
+    for (const char* node : {"cpu_capacity", "cpufreq/cpuinfo_max_freq"}) {
+        std::vector<std::pair<CoreId, u64>> ranked_cores;
+        for (u32 cpu = 0; cpu < num_cpus; ++cpu) {
+            // Offline cores are missing some nodes, they are skipped
+            if (const auto value = ReadCpuNode(cpu, node)) {
+                ranked_cores.emplace_back(cpu, *value);
+            }
+        }
+        if (!ranked_cores.empty()) {
+            return SplitCores(std::move(ranked_cores));
+        }
+    }
+    return {};
+}
+
+#elif defined(_WIN32)
+
+CoreTypes DetectCoreTypes() {
+    ULONG length{};
+    GetSystemCpuSetInformation(nullptr, 0, &length, GetCurrentProcess(), 0);
+    std::vector<u8> buffer(length);
+    auto* const information = reinterpret_cast<PSYSTEM_CPU_SET_INFORMATION>(buffer.data());
+    if (length == 0 ||
+        !GetSystemCpuSetInformation(information, length, &length, GetCurrentProcess(), 0)) {
+        return {};
+    }
+    // Higher efficiency classes are given to the faster cores
+    std::vector<std::pair<CoreId, u64>> ranked_cores;
+    for (size_t offset = 0; offset < length;) {
+        const auto* const entry =
+            reinterpret_cast<const SYSTEM_CPU_SET_INFORMATION*>(buffer.data() + offset);
+        if (entry->Type == CpuSetInformation) {
+            ranked_cores.emplace_back(entry->CpuSet.Id, entry->CpuSet.EfficiencyClass);
+        }
+        offset += entry->Size;
+    }
+    return SplitCores(std::move(ranked_cores));
+}
+
+#else
+
+CoreTypes DetectCoreTypes() {
+    return {};
+}
+
+#endif
+
+const CoreTypes& GetCoreTypes() {
+    static const CoreTypes core_types = [] {
+        CoreTypes types = DetectCoreTypes();
+        if (!types.performance.empty()) {
+            LOG_INFO(Common, "Detected {} performance and {} efficiency cores",
+                     types.performance.size(), types.efficiency.size());
+        }
+        return types;
+    }();
+    return core_types;
+}
+
+} // Anonymous namespace
+
+void SetCurrentThreadCoreType(CoreType core_type) {
+#ifdef __APPLE__
+    // The scheduler picks the cores from the quality of service class of the thread
+    const qos_class_t qos_class = [&] {
+        switch (core_type) {
+        case CoreType::Performance: return QOS_CLASS_USER_INTERACTIVE;
+        case CoreType::Efficiency: return QOS_CLASS_UTILITY;
+        default: return QOS_CLASS_DEFAULT;
+        }
+    }();
+    pthread_set_qos_class_self_np(qos_class, 0);
+#elif defined(__linux__) || defined(_WIN32)
+    const CoreTypes& core_types = GetCoreTypes();
+    if (core_types.performance.empty()) {
+        return;
+    }
+    std::vector<CoreId> cores;
+    if (core_type != CoreType::Efficiency) {
+        cores.insert(cores.end(), core_types.performance.begin(), core_types.performance.end());
+    }
+    if (core_type != CoreType::Performance) {
+        cores.insert(cores.end(), core_types.efficiency.begin(), core_types.efficiency.end());
+    }
+#ifdef _WIN32
+    if (core_type == CoreType::Any) {
+        cores.clear();
+    }
+    if (!SetThreadSelectedCpuSets(GetCurrentThread(), cores.data(),
+                                  static_cast<ULONG>(cores.size()))) {
+        LOG_WARNING(Common, "Failed to set the thread core type: {}", GetLastErrorMsg());
+    }
+#else
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const CoreId core : cores) {
+        CPU_SET(core, &cpu_set);
+    }
+    // On Linux the affinity of thread id 0 is the one of the calling thread
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+        LOG_WARNING(Common, "Failed to set the thread core type: {}", GetLastErrorMsg());
+    }
+#endif
+#else
+    (void)core_type;
+#endif
+}
+
 #ifdef _MSC_VER
 
 // Sets the debugger-visible name of the current thread.
 void SetCurrentThreadName(const char* name) {
+    Profiler::SetThreadName(name);
     if (auto pf = (decltype(&SetThreadDescription))(void*)GetProcAddress(GetModuleHandle(TEXT("KernelBase.dll")), "SetThreadDescription"); pf)
         pf(GetCurrentThread(), UTF8ToUTF16W(name).data()); // Windows 10+
     else
@@ -91,6 +255,7 @@ void SetCurrentThreadName(const char* name) {
 
 // MinGW with the POSIX threading model does not support pthread_setname_np
 void SetCurrentThreadName(const char* name) {
+    Profiler::SetThreadName(name);
     // See for reference
     // https://gitlab.freedesktop.org/mesa/mesa/-/blame/main/src/util/u_thread.c?ref_type=heads#L75
 #ifdef __APPLE__
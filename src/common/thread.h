@@ -107,6 +107,19 @@ enum class ThreadPriority : u32 {
 
 void SetCurrentThreadPriority(ThreadPriority new_priority);
 
+/// Kind of core a thread prefers to run on, on processors with cores of different performance.
+enum class CoreType : u32 {
+    Any = 0,
+    Performance = 1,
+    Efficiency = 2,
+};
+
+/**
+ * Restricts the current thread to the performance or the efficiency cores of the processor.
+ * Does nothing when all cores are of the same kind or their kind can not be detected.
+ */
+void SetCurrentThreadCoreType(CoreType core_type);
+
 void SetCurrentThreadName(const char* name);
 
 } // namespace Common
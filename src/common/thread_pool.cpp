@@ -0,0 +1,246 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <thread>
+
+#include "common/thread_pool.h"
+
+namespace Common {
+
+namespace {
+
+thread_local const ThreadPool* current_pool{};
+thread_local size_t current_queue{};
+
+size_t DefaultNumThreads() {
+    const size_t max_core_threads =
+        (std::max)(static_cast<size_t>(std::thread::hardware_concurrency()), size_t{2}) - 1;
+#ifdef ANDROID
+    // Leave at least a few cores free in android
+    constexpr size_t free_cores = 3;
+    if (max_core_threads <= free_cores) {
+        return 1;
+    }
+    return max_core_threads - free_cores;
+#else
+    return max_core_threads;
+#endif
+}
+
+} // Anonymous namespace
+
+ThreadPool::ThreadPool(size_t num_threads, std::string name, CoreType core_type_)
+    : thread_name{std::move(name)}, core_type{core_type_} {
+    num_threads = (std::max)(num_threads, size_t{1});
+    queues.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back([this, i](std::stop_token stop_token) { ThreadLoop(stop_token, i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    for (auto& thread : threads) {
+        thread.request_stop();
+    }
+    threads.clear();
+}
+
+ThreadPool& ThreadPool::Shared(CoreType core_type) {
+    switch (core_type) {
+    case CoreType::Performance: {
+        static ThreadPool pool{DefaultNumThreads(), "ThreadPool", CoreType::Performance};
+        return pool;
+    }
+    case CoreType::Efficiency: {
+        static ThreadPool pool{DefaultNumThreads(), "ThreadPool", CoreType::Efficiency};
+        return pool;
+    }
+    case CoreType::Any:
+    default: {
+        static ThreadPool pool{DefaultNumThreads(), "ThreadPool"};
+        return pool;
+    }
+    }
+}
+
+void ThreadPool::Submit(Job job, WorkPriority priority) {
+    const size_t index = IsPoolThread()
+                             ? current_queue
+                             : next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        WorkerQueue& queue = *queues[index];
+        std::scoped_lock lock{queue.mutex};
+        queue.jobs[static_cast<size_t>(priority)].push_back(std::move(job));
+    }
+    num_pending.fetch_add(1, std::memory_order_release);
+    {
+        // Pairs with the check of sleeping threads, so the notification can not be missed
+        std::scoped_lock lock{sleep_mutex};
+    }
+    sleep_condition.notify_one();
+}
+
+bool ThreadPool::RunPendingJob() {
+    Job job;
+    if (!TryPop(IsPoolThread() ? current_queue : 0, job)) {
+        return false;
+    }
+    job();
+    return true;
+}
+
+bool ThreadPool::IsPoolThread() const noexcept {
+    return current_pool == this;
+}
+
+void ThreadPool::ThreadLoop(std::stop_token stop_token, size_t index) {
+    SetCurrentThreadName(thread_name.c_str());
+    if (core_type != CoreType::Any) {
+        SetCurrentThreadCoreType(core_type);
+    }
+    current_pool = this;
+    current_queue = index;
+
+    while (!stop_token.stop_requested()) {
+        Job job;
+        if (TryPop(index, job)) {
+            job();
+            continue;
+        }
+        std::unique_lock lock{sleep_mutex};
+        sleep_condition.wait(lock, stop_token, [this] {
+            return num_pending.load(std::memory_order_acquire) != 0;
+        });
+    }
+    current_pool = nullptr;
+}
+
+bool ThreadPool::TryPop(size_t index, Job& job) {
+    if (num_pending.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    const size_t num_queues = queues.size();
+    for (size_t priority = 0; priority < NUM_PRIORITIES; ++priority) {
+        // The own queue runs in submission order, stealing takes the newest work of the others
+        for (size_t offset = 0; offset < num_queues; ++offset) {
+            WorkerQueue& queue = *queues[(index + offset) % num_queues];
+            std::scoped_lock lock{queue.mutex};
+            auto& jobs = queue.jobs[priority];
+            if (jobs.empty()) {
+                continue;
+            }
+            if (offset == 0) {
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            } else {
+                job = std::move(jobs.back());
+                jobs.pop_back();
+            }
+            num_pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+PooledWorker::PooledWorker(ThreadPool& pool_, size_t max_concurrency_)
+    : pool{pool_}, max_concurrency{(std::max)(max_concurrency_, size_t{1})} {}
+
+template <typename Predicate>
+void PooledWorker::Wait(Predicate&& pred) {
+    std::unique_lock lock{mutex};
+    if (!pool.IsPoolThread()) {
+        wait_condition.wait(lock, pred);
+        return;
+    }
+    // Blocking a pool thread could leave no thread to run the work being waited for
+    while (!pred()) {
+        lock.unlock();
+        if (!pool.RunPendingJob()) {
+            std::this_thread::yield();
+        }
+        lock.lock();
+    }
+}
+
+PooledWorker::~PooledWorker() {
+    Stop();
+    // Submitted jobs point to this worker, wait until all of them have returned
+    Wait([this] { return num_jobs == 0; });
+}
+
+void PooledWorker::QueueWork(Task work, WorkPriority priority) {
+    std::scoped_lock lock{mutex};
+    if (stopped) {
+        return;
+    }
+    requests[static_cast<size_t>(priority)].push(std::move(work));
+    ++num_requests;
+    ++work_scheduled;
+    if (num_jobs < max_concurrency) {
+        ++num_jobs;
+        SubmitJob();
+    }
+}
+
+void PooledWorker::WaitForRequests(std::stop_token stop_token) {
+    std::stop_callback callback(stop_token, [this] { Stop(); });
+    Wait([this] { return work_done >= work_scheduled; });
+}
+
+void PooledWorker::SubmitJob() {
+    // The job takes the most urgent request once it runs, so it is as urgent as that one
+    size_t priority = 0;
+    while (priority < NUM_PRIORITIES - 1 && requests[priority].empty()) {
+        ++priority;
+    }
+    pool.Submit([this] { RunJob(); }, static_cast<WorkPriority>(priority));
+}
+
+void PooledWorker::RunJob() {
+    Task task;
+    {
+        std::scoped_lock lock{mutex};
+        for (auto& queue : requests) {
+            if (!stopped && !queue.empty()) {
+                task = std::move(queue.front());
+                queue.pop();
+                --num_requests;
+                break;
+            }
+        }
+    }
+    if (task) {
+        task();
+    }
+
+    std::scoped_lock lock{mutex};
+    if (task) {
+        ++work_done;
+    }
+    // Keep a job going while there is work left that the other jobs are not going to take
+    if (!stopped && num_requests >= num_jobs) {
+        SubmitJob();
+    } else {
+        --num_jobs;
+    }
+    wait_condition.notify_all();
+}
+
+void PooledWorker::Stop() {
+    std::scoped_lock lock{mutex};
+    stopped = true;
+    for (auto& queue : requests) {
+        work_done += queue.size();
+        queue = {};
+    }
+    num_requests = 0;
+    wait_condition.notify_all();
+}
+
+} // namespace Common
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/polyfill_thread.h"
+#include "common/thread.h"
+#include "common/thread_worker.h"
+#include "common/unique_function.h"
+
+namespace Common {
+
+/**
+ * Pool of host threads shared by the subsystems that run work in the background.
+ *
+ * Each thread owns a deque per priority. Jobs submitted from a pool thread go to its own deques,
+ * the others are spread over the threads. A thread runs the oldest job of its highest non-empty
+ * priority and steals the newest one of the same priority from the other threads when it has
+ * none, so a priority is drained on every thread before lower ones start.
+ */
+class ThreadPool {
+public:
+    using Job = UniqueFunction<void>;
+
+    explicit ThreadPool(size_t num_threads, std::string name, CoreType core_type = CoreType::Any);
+    ~ThreadPool();
+
+    YUZU_NON_COPYABLE(ThreadPool);
+    YUZU_NON_MOVEABLE(ThreadPool);
+
+    /// Returns the process wide pool of the given affinity class, created on first use.
+    [[nodiscard]] static ThreadPool& Shared(CoreType core_type);
+
+    void Submit(Job job, WorkPriority priority = WorkPriority::Normal);
+
+    /// Runs one pending job on the calling thread, returns false when there was none.
+    bool RunPendingJob();
+
+    /// Returns true when called from one of the threads of this pool.
+    [[nodiscard]] bool IsPoolThread() const noexcept;
+
+    [[nodiscard]] size_t NumThreads() const noexcept {
+        return queues.size();
+    }
+
+private:
+    static constexpr size_t NUM_PRIORITIES = static_cast<size_t>(WorkPriority::Low) + 1;
+
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::array<std::deque<Job>, NUM_PRIORITIES> jobs;
+    };
+
+    void ThreadLoop(std::stop_token stop_token, size_t index);
+
+    bool TryPop(size_t index, Job& job);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::atomic<size_t> next_queue{};
+    std::atomic<size_t> num_pending{};
+    std::mutex sleep_mutex;
+    std::condition_variable_any sleep_condition;
+    std::string thread_name;
+    CoreType core_type;
+    std::vector<std::jthread> threads;
+};
+
+/**
+ * Queue of work run on a thread pool with at most max_concurrency jobs at a time, a drop-in
+ * replacement for ThreadWorker without threads of its own. With a concurrency of one, work runs
+ * in the order it was queued like on a single thread.
+ */
+class PooledWorker {
+public:
+    using Task = UniqueFunction<void>;
+
+    explicit PooledWorker(ThreadPool& pool, size_t max_concurrency);
+    ~PooledWorker();
+
+    YUZU_NON_COPYABLE(PooledWorker);
+    YUZU_NON_MOVEABLE(PooledWorker);
+
+    void QueueWork(Task work, WorkPriority priority = WorkPriority::Normal);
+
+    /**
+     * Waits until the work queued so far is done. Stopping drops the work that has not started,
+     * after which new work is ignored. Waiting from a pool thread runs other jobs meanwhile.
+     */
+    void WaitForRequests(std::stop_token stop_token = {});
+
+private:
+    static constexpr size_t NUM_PRIORITIES = static_cast<size_t>(WorkPriority::Low) + 1;
+
+    /// Submits a job to run the next request, the mutex has to be held.
+    void SubmitJob();
+    void RunJob();
+    void Stop();
+
+    /// Waits until pred holds, helping the pool when called from one of its threads.
+    template <typename Predicate>
+    void Wait(Predicate&& pred);
+
+    ThreadPool& pool;
+    const size_t max_concurrency;
+
+    std::mutex mutex;
+    std::condition_variable wait_condition;
+    std::array<std::queue<Task>, NUM_PRIORITIES> requests;
+    size_t num_requests{};
+    /// Jobs submitted to the pool that have not finished yet
+    size_t num_jobs{};
+    size_t work_scheduled{};
+    size_t work_done{};
+    bool stopped{};
+};
+
+} // namespace Common
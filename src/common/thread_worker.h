@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
@@ -22,6 +23,15 @@
 
 namespace Common {
 
+/// Order in which queued work is picked up, work of the same priority runs in the order queued.
+enum class WorkPriority : u32 {
+    /// Work something is already waiting for
+    High = 0,
+    Normal = 1,
+    /// Speculative work that only pays off later
+    Low = 2,
+};
+
 template <class StateType = void>
 class StatefulThreadWorker {
     static constexpr bool with_state = !std::is_same_v<StateType, void>;
@@ -37,26 +47,28 @@ class StatefulThreadWorker {
     using StateMaker = std::conditional_t<with_state, std::function<StateType()>, DummyCallable>;
 
 public:
-    explicit StatefulThreadWorker(size_t num_workers, std::string name, StateMaker func = {})
+    explicit StatefulThreadWorker(size_t num_workers, std::string name, StateMaker func = {},
+                                  CoreType core_type = CoreType::Any)
         : workers_queued{num_workers}, thread_name{std::move(name)} {
-        const auto lambda = [this, func](std::stop_token stop_token) {
+        const auto lambda = [this, func, core_type](std::stop_token stop_token) {
             Common::SetCurrentThreadName(thread_name.c_str());
+            if (core_type != CoreType::Any) {
+                Common::SetCurrentThreadCoreType(core_type);
+            }
             {
                 [[maybe_unused]] std::conditional_t<with_state, StateType, int> state{func()};
                 while (!stop_token.stop_requested()) {
                     Task task;
                     {
                         std::unique_lock lock{queue_mutex};
-                        if (requests.empty()) {
+                        if (num_requests == 0) {
                             wait_condition.notify_all();
                         }
-                        condition.wait(lock, stop_token,
-                                       [this] { return !requests.empty(); });
+                        condition.wait(lock, stop_token, [this] { return num_requests != 0; });
                         if (stop_token.stop_requested()) {
                             break;
                         }
-                        task = std::move(requests.front());
-                        requests.pop();
+                        task = PopRequest();
                     }
                     if constexpr (with_state) {
                         task(&state);
@@ -81,10 +93,11 @@ public:
     StatefulThreadWorker& operator=(StatefulThreadWorker&&) = delete;
     StatefulThreadWorker(StatefulThreadWorker&&) = delete;
 
-    void QueueWork(Task work) {
+    void QueueWork(Task work, WorkPriority priority = WorkPriority::Normal) {
         {
             std::unique_lock lock{queue_mutex};
-            requests.emplace(std::move(work));
+            requests[static_cast<size_t>(priority)].emplace(std::move(work));
+            ++num_requests;
             ++work_scheduled;
         }
         condition.notify_one();
@@ -103,7 +116,23 @@ public:
     }
 
 private:
-    std::queue<Task> requests;
+    static constexpr size_t NUM_PRIORITIES = static_cast<size_t>(WorkPriority::Low) + 1;
+
+    /// Takes the oldest request of the highest priority, the queue mutex has to be held.
+    Task PopRequest() {
+        for (auto& queue : requests) {
+            if (!queue.empty()) {
+                Task task = std::move(queue.front());
+                queue.pop();
+                --num_requests;
+                return task;
+            }
+        }
+        return {};
+    }
+
+    std::array<std::queue<Task>, NUM_PRIORITIES> requests;
+    size_t num_requests{};
     std::mutex queue_mutex;
     std::condition_variable_any condition;
     std::condition_variable wait_condition;
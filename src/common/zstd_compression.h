@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -42,4 +45,17 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed);
 
+/**
+ * Decompresses a source memory region with Zstandard into a destination memory region.
+ *
+ * @param dst      the destination memory region.
+ * @param dst_size the size of the destination memory region.
+ * @param src      the compressed source memory region.
+ * @param src_size the size of the compressed source memory region.
+ *
+ * @return the size of the decompressed data, or zero if decompression failed.
+ */
+[[nodiscard]] std::size_t DecompressDataZSTD(void* dst, std::size_t dst_size, const void* src,
+                                             std::size_t src_size);
+
 } // namespace Common::Compression
@@ -121,55 +121,49 @@ void SymbolicateBacktrace(Kernel::KProcess* process, std::vector<BacktraceEntry>
     }
 }
 
-std::vector<BacktraceEntry> GetAArch64Backtrace(Kernel::KProcess* process,
-                                                const Kernel::Svc::ThreadContext& ctx) {
-    std::vector<BacktraceEntry> out;
-    auto& memory = process->GetMemory();
+std::vector<u64> GetAArch64BacktraceAddresses(Core::Memory::Memory& memory,
+                                              const Kernel::Svc::ThreadContext& ctx,
+                                              size_t max_frames) {
+    std::vector<u64> out;
     auto pc = ctx.pc, lr = ctx.lr, fp = ctx.fp;
 
-    out.push_back({"", 0, pc, 0, ""});
+    out.push_back(pc);
 
     // fp (= x29) points to the previous frame record.
     // Frame records are two words long:
     // fp+0 : pointer to previous frame record
     // fp+8 : value of lr for frame
-    for (size_t i = 0; i < 256; i++) {
-        out.push_back({"", 0, lr, 0, ""});
+    for (size_t i = 0; i < max_frames; i++) {
+        out.push_back(lr);
         if (!fp || (fp % 4 != 0) || !memory.IsValidVirtualAddressRange(fp, 16)) {
             break;
         }
         lr = memory.Read64(fp + 8);
         fp = memory.Read64(fp);
     }
-
-    SymbolicateBacktrace(process, out);
-
     return out;
 }
 
-std::vector<BacktraceEntry> GetAArch32Backtrace(Kernel::KProcess* process,
-                                                const Kernel::Svc::ThreadContext& ctx) {
-    std::vector<BacktraceEntry> out;
-    auto& memory = process->GetMemory();
+std::vector<u64> GetAArch32BacktraceAddresses(Core::Memory::Memory& memory,
+                                              const Kernel::Svc::ThreadContext& ctx,
+                                              size_t max_frames) {
+    std::vector<u64> out;
     auto pc = ctx.pc, lr = ctx.lr, fp = ctx.fp;
 
-    out.push_back({"", 0, pc, 0, ""});
+    out.push_back(pc);
 
     // fp (= r11) points to the last frame record.
     // Frame records are two words long:
     // fp+0 : pointer to previous frame record
     // fp+4 : value of lr for frame
-    for (size_t i = 0; i < 256; i++) {
-        out.push_back({"", 0, lr, 0, ""});
+    for (size_t i = 0; i < max_frames; i++) {
+        out.push_back(lr);
         if (!fp || (fp % 4 != 0) || !memory.IsValidVirtualAddressRange(fp, 8)) {
             break;
         }
         lr = memory.Read32(fp + 4);
         fp = memory.Read32(fp);
     }
-
-    SymbolicateBacktrace(process, out);
-
     return out;
 }
 
@@ -340,13 +334,29 @@ void InvalidateInstructionCacheRange(const Kernel::KProcess* process, u64 addres
     }
 }
 
-std::vector<BacktraceEntry> GetBacktraceFromContext(Kernel::KProcess* process,
-                                                    const Kernel::Svc::ThreadContext& ctx) {
+std::vector<u64> GetBacktraceAddresses(Kernel::KProcess* process,
+                                       const Kernel::Svc::ThreadContext& ctx, size_t max_frames) {
     if (process->Is64Bit()) {
-        return GetAArch64Backtrace(process, ctx);
+        return GetAArch64BacktraceAddresses(process->GetMemory(), ctx, max_frames);
     } else {
-        return GetAArch32Backtrace(process, ctx);
+        return GetAArch32BacktraceAddresses(process->GetMemory(), ctx, max_frames);
+    }
+}
+
+std::vector<BacktraceEntry> SymbolicateAddresses(Kernel::KProcess* process,
+                                                 std::span<const u64> addresses) {
+    std::vector<BacktraceEntry> out;
+    out.reserve(addresses.size());
+    for (const u64 address : addresses) {
+        out.push_back({"", 0, address, 0, ""});
     }
+    SymbolicateBacktrace(process, out);
+    return out;
+}
+
+std::vector<BacktraceEntry> GetBacktraceFromContext(Kernel::KProcess* process,
+                                                    const Kernel::Svc::ThreadContext& ctx) {
+    return SymbolicateAddresses(process, GetBacktraceAddresses(process, ctx, 256));
 }
 
 std::vector<BacktraceEntry> GetBacktrace(const Kernel::KThread* thread) {
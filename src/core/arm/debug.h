@@ -1,9 +1,14 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <optional>
+#include <span>
+#include <vector>
 
 #include "core/hle/kernel/k_thread.h"
 #include "core/loader/loader.h"
@@ -28,6 +33,14 @@ struct BacktraceEntry {
     std::string name;
 };
 
+/// Returns the program counter of a guest context followed by the return addresses of up to
+/// max_frames frame records, innermost first.
+std::vector<u64> GetBacktraceAddresses(Kernel::KProcess* process,
+                                       const Kernel::Svc::ThreadContext& ctx, size_t max_frames);
+/// Resolves the modules, offsets and symbol names of guest addresses.
+std::vector<BacktraceEntry> SymbolicateAddresses(Kernel::KProcess* process,
+                                                 std::span<const u64> addresses);
+
 std::vector<BacktraceEntry> GetBacktraceFromContext(Kernel::KProcess* process,
                                                     const Kernel::Svc::ThreadContext& ctx);
 std::vector<BacktraceEntry> GetBacktrace(const Kernel::KThread* thread);
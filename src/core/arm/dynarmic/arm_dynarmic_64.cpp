@@ -4,12 +4,17 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
+
+#include "common/page_table.h"
 #include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
 #include "core/arm/dynarmic/arm_dynarmic_64.h"
+#include "core/arm/dynarmic/dynarmic_block_cache.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 #include "core/core_timing.h"
 #include "core/hle/kernel/k_process.h"
+#include "core/memory.h"
 
 namespace Core {
 
@@ -20,25 +25,30 @@ class DynarmicCallbacks64 : public Dynarmic::A64::UserCallbacks {
 public:
     explicit DynarmicCallbacks64(ArmDynarmic64& parent, Kernel::KProcess* process)
         : m_parent{parent}, m_memory(process->GetMemory()),
+          m_page_table{process->GetPageTable().GetBasePageTable().GetImpl()},
           m_process(process), m_debugger_enabled{parent.m_system.DebuggerEnabled()},
           m_check_memory_access{m_debugger_enabled ||
                                 !Settings::values.cpuopt_ignore_memory_aborts.GetValue()} {}
 
     u8 MemoryRead8(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Read);
-        return m_memory.Read8(vaddr);
+        const u8* const pointer = PlainMemoryPointer(vaddr, 1);
+        return pointer ? Load<u8>(pointer) : m_memory.Read8(vaddr);
     }
     u16 MemoryRead16(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 2, Kernel::DebugWatchpointType::Read);
-        return m_memory.Read16(vaddr);
+        const u8* const pointer = PlainMemoryPointer(vaddr, 2);
+        return pointer ? Load<u16>(pointer) : m_memory.Read16(vaddr);
     }
     u32 MemoryRead32(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 4, Kernel::DebugWatchpointType::Read);
-        return m_memory.Read32(vaddr);
+        const u8* const pointer = PlainMemoryPointer(vaddr, 4);
+        return pointer ? Load<u32>(pointer) : m_memory.Read32(vaddr);
     }
     u64 MemoryRead64(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 8, Kernel::DebugWatchpointType::Read);
-        return m_memory.Read64(vaddr);
+        const u8* const pointer = PlainMemoryPointer(vaddr, 8);
+        return pointer ? Load<u64>(pointer) : m_memory.Read64(vaddr);
     }
     Vector MemoryRead128(u64 vaddr) override {
         CheckMemoryAccess(vaddr, 16, Kernel::DebugWatchpointType::Read);
@@ -52,22 +62,42 @@ public:
     }
 
     void MemoryWrite8(u64 vaddr, u8 value) override {
-        if (CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Write)) {
+        if (!CheckMemoryAccess(vaddr, 1, Kernel::DebugWatchpointType::Write)) {
+            return;
+        }
+        if (u8* const pointer = PlainMemoryPointer(vaddr, 1)) {
+            std::memcpy(pointer, &value, sizeof(value));
+        } else {
             m_memory.Write8(vaddr, value);
         }
     }
     void MemoryWrite16(u64 vaddr, u16 value) override {
-        if (CheckMemoryAccess(vaddr, 2, Kernel::DebugWatchpointType::Write)) {
+        if (!CheckMemoryAccess(vaddr, 2, Kernel::DebugWatchpointType::Write)) {
+            return;
+        }
+        if (u8* const pointer = PlainMemoryPointer(vaddr, 2)) {
+            std::memcpy(pointer, &value, sizeof(value));
+        } else {
             m_memory.Write16(vaddr, value);
         }
     }
     void MemoryWrite32(u64 vaddr, u32 value) override {
-        if (CheckMemoryAccess(vaddr, 4, Kernel::DebugWatchpointType::Write)) {
+        if (!CheckMemoryAccess(vaddr, 4, Kernel::DebugWatchpointType::Write)) {
+            return;
+        }
+        if (u8* const pointer = PlainMemoryPointer(vaddr, 4)) {
+            std::memcpy(pointer, &value, sizeof(value));
+        } else {
             m_memory.Write32(vaddr, value);
         }
     }
     void MemoryWrite64(u64 vaddr, u64 value) override {
-        if (CheckMemoryAccess(vaddr, 8, Kernel::DebugWatchpointType::Write)) {
+        if (!CheckMemoryAccess(vaddr, 8, Kernel::DebugWatchpointType::Write)) {
+            return;
+        }
+        if (u8* const pointer = PlainMemoryPointer(vaddr, 8)) {
+            std::memcpy(pointer, &value, sizeof(value));
+        } else {
             m_memory.Write64(vaddr, value);
         }
     }
@@ -208,6 +238,29 @@ public:
         return true;
     }
 
+    /// Returns the host pointer of an access within a single page backed by plain memory.
+    /// Pages without a pointer (unmapped, rasterizer cached or debug memory) return null and
+    /// have to go through the memory system. The page table entry is read on every access, so
+    /// remaps and protection changes are seen immediately.
+    u8* PlainMemoryPointer(u64 vaddr, u64 size) const {
+        // AARCH64 masks the upper 16 bit of all memory accesses
+        vaddr &= 0xffffffffffffULL;
+        if ((vaddr >> m_page_table.GetAddressSpaceBits()) != 0 ||
+            (vaddr & Memory::YUZU_PAGEMASK) + size > Memory::YUZU_PAGESIZE) [[unlikely]] {
+            return nullptr;
+        }
+        const uintptr_t raw = m_page_table.pointers[vaddr >> Memory::YUZU_PAGEBITS].Raw();
+        const uintptr_t pointer = Common::PageTable::PageInfo::ExtractPointer(raw);
+        return pointer ? reinterpret_cast<u8*>(pointer + vaddr) : nullptr;
+    }
+
+    template <typename T>
+    static T Load(const u8* pointer) {
+        T value;
+        std::memcpy(&value, pointer, sizeof(value));
+        return value;
+    }
+
     void ReturnException(u64 pc, Dynarmic::HaltReason hr) {
         m_parent.GetContext(m_parent.m_breakpoint_context);
         m_parent.m_breakpoint_context.pc = pc;
@@ -216,6 +269,7 @@ public:
 
     ArmDynarmic64& m_parent;
     Core::Memory::Memory& m_memory;
+    const Common::PageTable& m_page_table;
     u64 m_tpidrro_el0{};
     u64 m_tpidr_el0{};
     Kernel::KProcess* m_process{};
@@ -224,6 +278,9 @@ public:
     static constexpr u64 MinimumRunCycles = 10000U;
 };
 
+/// Executions of a block before it is recompiled with every optimization, when tiering is enabled
+constexpr u32 TieredCompilationThreshold = 1000;
+
 std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* page_table,
                                                            std::size_t address_space_bits) const {
     Dynarmic::A64::UserConfig config;
@@ -327,6 +384,15 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
         if (!Settings::values.cpuopt_ignore_memory_aborts) {
             config.check_halt_on_memory_access = true;
         }
+        if (Settings::values.cpuopt_tiered_compilation) {
+            config.tiered_compilation_threshold = TieredCompilationThreshold;
+        }
+        if (Settings::values.cpuopt_live_range_spilling) {
+            config.live_range_spilling = true;
+        }
+        if (Settings::values.cpuopt_background_translation) {
+            config.background_translation = true;
+        }
         break;
     // Unsafe optimizations
     case Settings::CpuAccuracy::Unsafe:
@@ -375,6 +441,11 @@ std::shared_ptr<Dynarmic::A64::Jit> ArmDynarmic64::MakeJit(Common::PageTable* pa
 }
 
 HaltReason ArmDynarmic64::RunThread(Kernel::KThread* thread) {
+    if (m_needs_precompile) {
+        // Modules are only loaded after the interfaces were created, wait until code runs.
+        m_block_cache->Precompile(*m_jit);
+        m_needs_precompile = false;
+    }
     m_jit->ClearExclusiveState();
     return TranslateHaltReason(m_jit->Run());
 }
@@ -413,15 +484,26 @@ void ArmDynarmic64::RewindBreakpointInstruction() {
 }
 
 ArmDynarmic64::ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index)
+                             DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                             DynarmicBlockCache* block_cache)
     : ArmInterface{uses_wall_clock}, m_system{system}, m_exclusive_monitor{exclusive_monitor},
-      m_cb(std::make_unique<DynarmicCallbacks64>(*this, process)), m_core_index{core_index} {
+      m_cb(std::make_unique<DynarmicCallbacks64>(*this, process)), m_core_index{core_index},
+      m_block_cache{block_cache}, m_needs_precompile{block_cache != nullptr} {
     auto& page_table = process->GetPageTable().GetBasePageTable();
     auto& page_table_impl = page_table.GetImpl();
     m_jit = MakeJit(&page_table_impl, page_table.GetAddressSpaceWidth());
 }
 
-ArmDynarmic64::~ArmDynarmic64() = default;
+ArmDynarmic64::~ArmDynarmic64() {
+    if (m_block_cache) {
+        m_block_cache->Record(*m_jit);
+    }
+    const auto statistics = m_jit->GetCodeCacheStatistics();
+    if (statistics.evictions != 0 || statistics.full_clears != 0) {
+        LOG_INFO(Core_ARM, "Code cache of core {} ran out of space: {} evictions, {} full clears",
+                 m_core_index, statistics.evictions, statistics.full_clears);
+    }
+}
 
 void ArmDynarmic64::SetTpidrroEl0(u64 value) {
     m_cb->m_tpidrro_el0 = value;
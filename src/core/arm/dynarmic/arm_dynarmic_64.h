@@ -19,6 +19,7 @@ class Memory;
 
 namespace Core {
 
+class DynarmicBlockCache;
 class DynarmicCallbacks64;
 class DynarmicExclusiveMonitor;
 class System;
@@ -26,7 +27,8 @@ class System;
 class ArmDynarmic64 final : public ArmInterface {
 public:
     ArmDynarmic64(System& system, bool uses_wall_clock, Kernel::KProcess* process,
-                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index);
+                  DynarmicExclusiveMonitor& exclusive_monitor, std::size_t core_index,
+                  DynarmicBlockCache* block_cache = nullptr);
     ~ArmDynarmic64() override;
 
     Architecture GetArchitecture() const override {
@@ -66,6 +68,10 @@ private:
 
     std::shared_ptr<Dynarmic::A64::Jit> m_jit{};
 
+    // Blocks compiled by previous runs, precompiled before the first thread runs
+    DynarmicBlockCache* m_block_cache{};
+    bool m_needs_precompile{};
+
     // SVC callback
     u32 m_svc{};
 
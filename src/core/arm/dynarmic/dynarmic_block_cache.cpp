@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/hex_util.h"
+#include "common/logging/log.h"
+#include "core/arm/dynarmic/dynarmic_block_cache.h"
+#include "core/core.h"
+#include "core/hle/kernel/k_process.h"
+
+namespace Core {
+
+namespace {
+
+using BlockLocation = Dynarmic::A64::Jit::BlockLocation;
+
+constexpr u32 BLOCK_CACHE_MAGIC = Common::MakeMagic('D', 'B', 'L', 'K');
+constexpr u32 BLOCK_CACHE_VERSION = 1;
+constexpr u64 MAX_BLOCKS = 0x100000;
+
+struct BlockCacheHeader {
+    u32 magic;
+    u32 version;
+    u64 num_blocks;
+};
+static_assert(sizeof(BlockCacheHeader) == 16);
+
+struct BlockCacheEntry {
+    u64 offset; ///< Offset of the block from the start of the code region
+    u32 fpcr;
+    u32 reserved;
+};
+static_assert(sizeof(BlockCacheEntry) == 16);
+
+constexpr auto BlockKey = [](const BlockLocation& block) {
+    return std::make_pair(block.pc, block.fpcr);
+};
+
+} // Anonymous namespace
+
+DynarmicBlockCache::DynarmicBlockCache(System& system_, Kernel::KProcess& process_)
+    : system{system_}, process{process_} {}
+
+DynarmicBlockCache::~DynarmicBlockCache() {
+    Save();
+}
+
+void DynarmicBlockCache::Precompile(Dynarmic::A64::Jit& jit) {
+    {
+        std::scoped_lock lock{mutex};
+        if (!is_loaded) {
+            Load();
+            is_loaded = true;
+        }
+    }
+    // The loaded blocks are not modified after this point, every core can compile them at once.
+    if (!loaded_blocks.empty()) {
+        jit.PrecompileBlocks(loaded_blocks);
+    }
+}
+
+void DynarmicBlockCache::Record(const Dynarmic::A64::Jit& jit) {
+    const u64 code_address = GetInteger(process.GetEntryPoint());
+    std::vector<BlockLocation> blocks = jit.GetCompiledBlocks(code_address, process.GetCodeSize());
+
+    std::scoped_lock lock{mutex};
+    for (BlockLocation& block : blocks) {
+        block.pc -= code_address;
+    }
+    recorded_blocks.insert(recorded_blocks.end(), blocks.begin(), blocks.end());
+}
+
+void DynarmicBlockCache::Load() {
+    const auto& build_id = system.GetApplicationProcessBuildID();
+    if (std::ranges::all_of(build_id, [](u8 value) { return value == 0; })) {
+        return;
+    }
+    const auto cache_dir{Common::FS::GetEdenPath(Common::FS::EdenPath::CacheDir) / "dynarmic"};
+    if (!Common::FS::CreateDirs(cache_dir)) {
+        LOG_ERROR(Core_ARM, "Failed to create the block cache directory");
+        return;
+    }
+    filename = cache_dir / fmt::format("{:016x}_{}.bin", process.GetProgramId(),
+                                       Common::HexToString(build_id, false));
+
+    Common::FS::IOFile file{filename, Common::FS::FileAccessMode::Read,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return;
+    }
+    BlockCacheHeader header{};
+    if (!file.ReadObject(header) || header.magic != BLOCK_CACHE_MAGIC ||
+        header.version != BLOCK_CACHE_VERSION || header.num_blocks > MAX_BLOCKS) {
+        LOG_WARNING(Core_ARM, "Ignoring invalid block cache {}", filename.string());
+        return;
+    }
+    std::vector<BlockCacheEntry> entries(header.num_blocks);
+    if (file.ReadSpan<BlockCacheEntry>(entries) != entries.size()) {
+        LOG_WARNING(Core_ARM, "Ignoring truncated block cache {}", filename.string());
+        return;
+    }
+
+    const u64 code_address = GetInteger(process.GetEntryPoint());
+    const u64 code_size = process.GetCodeSize();
+    loaded_blocks.reserve(entries.size());
+    for (const BlockCacheEntry& entry : entries) {
+        if (entry.offset < code_size) {
+            loaded_blocks.push_back({code_address + entry.offset, entry.fpcr});
+        }
+    }
+    LOG_INFO(Core_ARM, "Precompiling {} blocks from the block cache", loaded_blocks.size());
+}
+
+void DynarmicBlockCache::Save() {
+    if (filename.empty() || recorded_blocks.empty()) {
+        return;
+    }
+    // Keep the blocks of previous runs, they might not have been reached this time.
+    const u64 code_address = GetInteger(process.GetEntryPoint());
+    std::vector<BlockLocation> blocks = std::move(recorded_blocks);
+    for (const BlockLocation& block : loaded_blocks) {
+        blocks.push_back({block.pc - code_address, block.fpcr});
+    }
+    std::ranges::sort(blocks, {}, BlockKey);
+    const auto [first, last] = std::ranges::unique(blocks, {}, BlockKey);
+    blocks.erase(first, last);
+    if (blocks.size() > MAX_BLOCKS) {
+        blocks.resize(MAX_BLOCKS);
+    }
+
+    std::vector<BlockCacheEntry> entries;
+    entries.reserve(blocks.size());
+    for (const BlockLocation& block : blocks) {
+        entries.push_back({block.pc, block.fpcr, 0});
+    }
+    const BlockCacheHeader header{
+        .magic = BLOCK_CACHE_MAGIC,
+        .version = BLOCK_CACHE_VERSION,
+        .num_blocks = entries.size(),
+    };
+    Common::FS::IOFile file{filename, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen() || !file.WriteObject(header) ||
+        file.WriteSpan<BlockCacheEntry>(entries) != entries.size()) {
+        LOG_ERROR(Core_ARM, "Failed to write block cache {}", filename.string());
+    }
+}
+
+} // namespace Core
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+#include <dynarmic/interface/A64/a64.h>
+#include "common/common_types.h"
+
+namespace Kernel {
+class KProcess;
+}
+
+namespace Core {
+
+class System;
+
+/**
+ * Remembers which guest blocks the 64-bit JIT compiled for an application, so the next boot can
+ * translate them before they are first executed.
+ *
+ * Emitted host code embeds absolute pointers to the JIT state and the page table, so it can't be
+ * reused by another run. Instead the guest location of each block is stored relative to the code
+ * region of the process, in a file keyed on the build ID of the main module.
+ */
+class DynarmicBlockCache {
+public:
+    explicit DynarmicBlockCache(System& system, Kernel::KProcess& process);
+    ~DynarmicBlockCache();
+
+    DynarmicBlockCache(const DynarmicBlockCache&) = delete;
+    DynarmicBlockCache& operator=(const DynarmicBlockCache&) = delete;
+
+    /// Compiles the blocks recorded by previous runs, loading them the first time it's called.
+    void Precompile(Dynarmic::A64::Jit& jit);
+
+    /// Adds the blocks compiled by a JIT to the ones saved when the cache is destroyed.
+    void Record(const Dynarmic::A64::Jit& jit);
+
+private:
+    void Load();
+    void Save();
+
+    System& system;
+    Kernel::KProcess& process;
+
+    std::mutex mutex;
+    bool is_loaded{};
+    std::filesystem::path filename;
+    std::vector<Dynarmic::A64::Jit::BlockLocation> loaded_blocks;
+    std::vector<Dynarmic::A64::Jit::BlockLocation> recorded_blocks;
+};
+
+} // namespace Core
@@ -6,7 +6,9 @@
 
 #include <cinttypes>
 #include <memory>
+#include <utility>
 
+#include "common/logging/log.h"
 #include "common/signal_chain.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/interpreter_visitor.h"
@@ -147,7 +149,8 @@ bool ArmNce::HandleGuestAlignmentFault(GuestContext* guest_ctx, void* raw_info,
     auto& memory = guest_ctx->system->ApplicationMemory();
 
     // Match and execute an instruction.
-    auto next_pc = MatchAndExecuteOneInstruction(memory, &host_ctx, fpctx);
+    auto next_pc =
+        MatchAndExecuteOneInstruction(memory, &host_ctx, fpctx, *guest_ctx->parent->m_decode_cache);
     if (next_pc) {
         host_ctx.pc = *next_pc;
         return true;
@@ -159,6 +162,7 @@ bool ArmNce::HandleGuestAlignmentFault(GuestContext* guest_ctx, void* raw_info,
 
 bool ArmNce::HandleGuestAccessFault(GuestContext* guest_ctx, void* raw_info, void* raw_context) {
     auto* info = static_cast<siginfo_t*>(raw_info);
+    ++guest_ctx->parent->m_num_access_faults;
 
     // Try to handle an invalid access.
     // TODO: handle accesses which split a page?
@@ -243,11 +247,31 @@ HaltReason ArmNce::RunThread(Kernel::KThread* thread) {
 
     // Non-critical updates can happen after releasing the thread
     m_guest_ctx.tpidr_el0 = final_tpidr_el0;
+    ReportFaults();
 
     // Return the halt reason.
     return hr;
 }
 
+void ArmNce::ReportFaults() {
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - m_last_fault_report;
+    if (elapsed < std::chrono::seconds{1}) {
+        return;
+    }
+    m_last_fault_report = now;
+    const auto [num_decodes, num_cached] = m_decode_cache->TakeStatistics();
+    const u64 num_access_faults = std::exchange(m_num_access_faults, 0);
+    if (num_decodes == 0 && num_access_faults == 0) {
+        return;
+    }
+    LOG_DEBUG(Core_ARM,
+              "Core {} handled {:.0f} interpreted faults/s ({} of {} decoded from cache) and "
+              "{:.0f} access faults/s",
+              m_core_index, static_cast<double>(num_decodes) / elapsed.count(), num_cached,
+              num_decodes, static_cast<double>(num_access_faults) / elapsed.count());
+}
+
 HaltReason ArmNce::StepThread(Kernel::KThread* thread) {
     return HaltReason::StepThread;
 }
@@ -269,7 +293,8 @@ void ArmNce::SetSvcArguments(std::span<const uint64_t, 8> args) {
 }
 
 ArmNce::ArmNce(System& system, bool uses_wall_clock, std::size_t core_index)
-    : ArmInterface{uses_wall_clock}, m_system{system}, m_core_index{core_index} {
+    : ArmInterface{uses_wall_clock}, m_system{system}, m_core_index{core_index},
+      m_decode_cache{std::make_unique<DecodeCache>()} {
     m_guest_ctx.system = &m_system;
 }
 
@@ -1,8 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <chrono>
+#include <memory>
 #include <mutex>
 
 #include "core/arm/arm_interface.h"
@@ -14,6 +19,7 @@ class Memory;
 
 namespace Core {
 
+class DecodeCache;
 class System;
 
 class ArmNce final : public ArmInterface {
@@ -77,6 +83,9 @@ private:
     static void HandleHostAlignmentFault(int sig, void* info, void* raw_context);
     static void HandleHostAccessFault(int sig, void* info, void* raw_context);
 
+    /// Logs the rate of the faults handled by the core about once a second.
+    void ReportFaults();
+
 public:
     Core::System& m_system;
 
@@ -90,6 +99,11 @@ public:
 
     // Stack for signal processing.
     std::unique_ptr<u8[]> m_stack{};
+
+    // Fault handling, only touched by the host thread of the core.
+    std::unique_ptr<DecodeCache> m_decode_cache;
+    u64 m_num_access_faults{};
+    std::chrono::steady_clock::time_point m_last_fault_report{std::chrono::steady_clock::now()};
 };
 
 } // namespace Core
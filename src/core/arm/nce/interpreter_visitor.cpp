@@ -761,8 +761,26 @@ bool InterpreterVisitor::LDR_reg_fpsimd(Imm<2> size, Imm<1> opc_1, Reg Rm, Imm<3
     return this->SIMDOffset(scale, shift, opc_0, Rm, option, Rn, Vt);
 }
 
+const DecodeCache::Matcher* DecodeCache::Decode(u64 pc, u32 instruction) {
+    ++num_lookups;
+    Entry& entry = entries[(pc >> 2) % NUM_ENTRIES];
+    // Comparing the instruction too catches code modified or loaded since it was cached
+    if (entry.pc == pc && entry.instruction == instruction) {
+        ++num_hits;
+        return entry.matcher;
+    }
+    const auto decoder = Dynarmic::A64::Decode<VisitorBase>(instruction);
+    entry = {
+        .pc = pc,
+        .instruction = instruction,
+        .matcher = decoder ? &decoder->get() : nullptr,
+    };
+    return entry.matcher;
+}
+
 std::optional<u64> MatchAndExecuteOneInstruction(Core::Memory::Memory& memory, mcontext_t* context,
-                                                 fpsimd_context* fpsimd_context) {
+                                                 fpsimd_context* fpsimd_context,
+                                                 DecodeCache& decode_cache) {
     std::span<u64, 31> regs(reinterpret_cast<u64*>(context->regs), 31);
     std::span<u128, 32> vregs(reinterpret_cast<u128*>(fpsimd_context->vregs), 32);
     u64& sp = *reinterpret_cast<u64*>(&context->sp);
@@ -772,8 +790,8 @@ std::optional<u64> MatchAndExecuteOneInstruction(Core::Memory::Memory& memory, m
     u32 instruction = memory.Read32(pc);
     bool was_executed = false;
 
-    if (auto decoder = Dynarmic::A64::Decode<VisitorBase>(instruction)) {
-        was_executed = decoder->get().call(visitor, instruction);
+    if (const auto* matcher = decode_cache.Decode(pc, instruction)) {
+        was_executed = matcher->call(visitor, instruction);
     } else {
         LOG_ERROR(Core_ARM, "Unallocated encoding: {:#x}", instruction);
     }
@@ -7,10 +7,12 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <signal.h>
 #include <unistd.h>
 #include <span>
+#include <utility>
 
 #include "core/hle/kernel/k_thread.h"
 #include "core/memory.h"
@@ -105,7 +107,39 @@ private:
     const u64& m_pc;
 };
 
+/**
+ * Remembers the decoded handlers of the instructions that faulted last by their address, as hot
+ * loops writing to tracked memory fault on the same few instructions over and over. A cache
+ * belongs to one core and is used from its signal handler, so it neither locks nor allocates.
+ */
+class DecodeCache {
+public:
+    using Matcher = Dynarmic::A64::Matcher<VisitorBase>;
+
+    /// Returns the handler of the instruction at an address, nullptr when it's unallocated.
+    const Matcher* Decode(u64 pc, u32 instruction);
+
+    /// Returns the number of lookups and hits since the last call and resets them.
+    std::pair<u64, u64> TakeStatistics() {
+        return {std::exchange(num_lookups, 0), std::exchange(num_hits, 0)};
+    }
+
+private:
+    static constexpr size_t NUM_ENTRIES = 256;
+
+    struct Entry {
+        u64 pc{~u64{0}};
+        u32 instruction{};
+        const Matcher* matcher{};
+    };
+
+    std::array<Entry, NUM_ENTRIES> entries{};
+    u64 num_lookups{};
+    u64 num_hits{};
+};
+
 std::optional<u64> MatchAndExecuteOneInstruction(Core::Memory::Memory& memory, mcontext_t* context,
-                                                 fpsimd_context* fpsimd_context);
+                                                 fpsimd_context* fpsimd_context,
+                                                 DecodeCache& decode_cache);
 
 } // namespace Core
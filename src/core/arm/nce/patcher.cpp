@@ -1,9 +1,17 @@
 // SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
 #include <numeric>
 #include <bit>
+#include <fmt/format.h>
 #include "common/arm64/native_clock.h"
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/hex_util.h"
 #include "common/literals.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/guest_context.h"
@@ -42,6 +50,30 @@ using NativeExecutionParameters = Kernel::KThread::NativeExecutionParameters;
 constexpr size_t MaxRelativeBranch = 128_MiB;
 constexpr u32 ModuleCodeIndex = 0x24 / sizeof(u32);
 
+// Bump the version whenever the generated patch code changes.
+constexpr u32 PatchCacheMagic = Common::MakeMagic('N', 'C', 'E', 'P');
+constexpr u32 PatchCacheVersion = 1;
+
+struct PatchCacheHeader {
+    u32 magic;
+    u32 version;
+    u64 patch_start;    ///< Offset of the module's code in the patch section it was generated for.
+    u64 text_size;
+    u64 text_hash;
+    std::array<u64, 2> cntfrq_factor;
+    u64 num_instructions;
+    u64 num_trampolines;
+    u64 num_branch_to_patch;
+    u64 num_branch_to_module;
+    u64 num_write_module_pc;
+    u64 num_exclusives;
+};
+
+Common::Arm64::NativeClock::FactorType GetCntfrqFactor() {
+    static Common::Arm64::NativeClock clock{};
+    return clock.GetGuestCNTFRQFactor();
+}
+
 Patcher::Patcher() : c(m_patch_instructions) {
     LOG_WARNING(Core_ARM, "Patcher initialized with LRU cache {}",
         patch_cache.isEnabled() ? "enabled" : "disabled");
@@ -81,8 +113,12 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
     const auto text_words =
         std::span<const u32>{reinterpret_cast<const u32*>(text.data()), text.size() / sizeof(u32)};
 
+    // Reuse the patch generated by a previous boot if the module hasn't changed.
+    const auto patch_start = static_cast<size_t>(c.offset());
+    const bool is_cached = LoadCachedPatch(text, patch_start);
+
     // Loop through instructions, patching as needed.
-    for (u32 i = ModuleCodeIndex; i < static_cast<u32>(text_words.size()); i++) {
+    for (u32 i = ModuleCodeIndex; !is_cached && i < static_cast<u32>(text_words.size()); i++) {
         const u32 inst = text_words[i];
 
         const auto AddRelocations = [&] {
@@ -134,6 +170,9 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
             curr_patch->m_exclusives.push_back(i);
         }
     }
+    if (!is_cached) {
+        SaveCachedPatch(text, patch_start);
+    }
 
     // Determine patching mode for the final relocation step
     total_program_size += image_size;
@@ -234,6 +273,108 @@ bool Patcher::RelocateAndCopy(Common::ProcessAddress load_base,
     return false;
 }
 
+std::filesystem::path Patcher::GetCachePath() const {
+    if (std::ranges::all_of(module_id, [](u8 value) { return value == 0; })) {
+        return {};
+    }
+    const auto cache_dir{Common::FS::GetEdenPath(Common::FS::EdenPath::CacheDir) / "nce"};
+    if (!Common::FS::CreateDirs(cache_dir)) {
+        LOG_ERROR(Core_ARM, "Failed to create the NCE patch cache directory");
+        return {};
+    }
+    return cache_dir / fmt::format("{}.bin", Common::HexToString(module_id, false));
+}
+
+bool Patcher::LoadCachedPatch(std::span<const u8> text, size_t patch_start) {
+    const auto path = GetCachePath();
+    if (path.empty()) {
+        return false;
+    }
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return false;
+    }
+    // The patch code calls the context helpers at the start of the section and embeds the host
+    // counter frequency, so it can only be reused at the same offset and on the same host.
+    PatchCacheHeader header{};
+    if (!file.ReadObject(header) || header.magic != PatchCacheMagic ||
+        header.version != PatchCacheVersion || header.patch_start != patch_start ||
+        header.text_size != text.size() ||
+        header.cntfrq_factor != std::bit_cast<std::array<u64, 2>>(GetCntfrqFactor())) {
+        return false;
+    }
+    const u64 text_hash =
+        Common::CityHash64(reinterpret_cast<const char*>(text.data()), text.size());
+    if (header.text_hash != text_hash) {
+        return false;
+    }
+
+    const auto read_vector = [&file]<typename T>(std::vector<T>& out, u64 count) {
+        if (count > file.GetSize() / sizeof(T)) {
+            return false;
+        }
+        out.resize(count);
+        return file.ReadSpan<T>(out) == count;
+    };
+    std::vector<u32> instructions;
+    ModulePatch patch;
+    if (!read_vector(instructions, header.num_instructions) ||
+        !read_vector(patch.m_trampolines, header.num_trampolines) ||
+        !read_vector(patch.m_branch_to_patch_relocations, header.num_branch_to_patch) ||
+        !read_vector(patch.m_branch_to_module_relocations, header.num_branch_to_module) ||
+        !read_vector(patch.m_write_module_pc_relocations, header.num_write_module_pc) ||
+        !read_vector(patch.m_exclusives, header.num_exclusives)) {
+        LOG_WARNING(Core_ARM, "Ignoring truncated NCE patch cache {}", path.string());
+        return false;
+    }
+
+    for (const u32 instruction : instructions) {
+        c.dw(instruction);
+    }
+    *curr_patch = std::move(patch);
+    LOG_INFO(Core_ARM, "Loaded NCE patch of module {} from the cache",
+             Common::HexToString(module_id, false));
+    return true;
+}
+
+void Patcher::SaveCachedPatch(std::span<const u8> text, size_t patch_start) const {
+    const auto path = GetCachePath();
+    if (path.empty()) {
+        return;
+    }
+    const std::span<const u32> instructions =
+        std::span{m_patch_instructions}.subspan(patch_start / sizeof(u32));
+    const PatchCacheHeader header{
+        .magic = PatchCacheMagic,
+        .version = PatchCacheVersion,
+        .patch_start = patch_start,
+        .text_size = text.size(),
+        .text_hash = Common::CityHash64(reinterpret_cast<const char*>(text.data()), text.size()),
+        .cntfrq_factor = std::bit_cast<std::array<u64, 2>>(GetCntfrqFactor()),
+        .num_instructions = instructions.size(),
+        .num_trampolines = curr_patch->m_trampolines.size(),
+        .num_branch_to_patch = curr_patch->m_branch_to_patch_relocations.size(),
+        .num_branch_to_module = curr_patch->m_branch_to_module_relocations.size(),
+        .num_write_module_pc = curr_patch->m_write_module_pc_relocations.size(),
+        .num_exclusives = curr_patch->m_exclusives.size(),
+    };
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen() || !file.WriteObject(header) ||
+        file.WriteSpan(instructions) != instructions.size() ||
+        file.WriteSpan<Trampoline>(curr_patch->m_trampolines) != header.num_trampolines ||
+        file.WriteSpan<Relocation>(curr_patch->m_branch_to_patch_relocations) !=
+            header.num_branch_to_patch ||
+        file.WriteSpan<Relocation>(curr_patch->m_branch_to_module_relocations) !=
+            header.num_branch_to_module ||
+        file.WriteSpan<Relocation>(curr_patch->m_write_module_pc_relocations) !=
+            header.num_write_module_pc ||
+        file.WriteSpan<ModuleTextAddress>(curr_patch->m_exclusives) != header.num_exclusives) {
+        LOG_ERROR(Core_ARM, "Failed to write NCE patch cache {}", path.string());
+    }
+}
+
 size_t Patcher::GetSectionSize() const noexcept {
     return Common::AlignUp(m_patch_instructions.size() * sizeof(u32), Core::Memory::YUZU_PAGESIZE);
 }
@@ -434,8 +575,7 @@ void Patcher::WriteMsrHandler(ModuleDestLabel module_dest, oaknut::XReg src_reg)
 }
 
 void Patcher::WriteCntpctHandler(ModuleDestLabel module_dest, oaknut::XReg dest_reg) {
-    static Common::Arm64::NativeClock clock{};
-    const auto factor = clock.GetGuestCNTFRQFactor();
+    const auto factor = GetCntfrqFactor();
     const auto raw_factor = std::bit_cast<std::array<u64, 2>>(factor);
 
     const auto use_x2_x3 = dest_reg.index() == 0 || dest_reg.index() == 1;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <span>
 #include <unordered_map>
 #include <vector>
@@ -76,6 +77,10 @@ private:
         uintptr_t module_offset;
     };
 
+    std::filesystem::path GetCachePath() const;
+    bool LoadCachedPatch(std::span<const u8> text, size_t patch_start);
+    void SaveCachedPatch(std::span<const u8> text, size_t patch_start) const;
+
     void WriteLoadContext();
     void WriteSaveContext();
     void LockContext();
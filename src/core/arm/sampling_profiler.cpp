@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/arm/debug.h"
+#include "core/arm/sampling_profiler.h"
+#include "core/hardware_properties.h"
+#include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/physical_core.h"
+
+namespace Core {
+
+namespace {
+
+struct FunctionSamples {
+    u64 self = 0;
+    u64 total = 0;
+};
+
+std::string FrameName(const BacktraceEntry& entry) {
+    if (entry.name.empty()) {
+        return fmt::format("{}+{:#x}", entry.module, entry.offset);
+    }
+    return fmt::format("{}!{}", entry.module, entry.name);
+}
+
+} // Anonymous namespace
+
+SamplingProfiler::SamplingProfiler(Kernel::KernelCore& kernel_) : kernel{kernel_} {
+    thread = std::jthread([this](std::stop_token stop_token) { Run(stop_token); });
+}
+
+SamplingProfiler::~SamplingProfiler() = default;
+
+void SamplingProfiler::Run(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("GuestSampler");
+    while (Common::StoppableTimedWait(stop_token, SAMPLE_PERIOD)) {
+        for (size_t core = 0; core < Hardware::NUM_CPU_CORES; ++core) {
+            kernel.PhysicalCore(core).RequestSample();
+        }
+    }
+}
+
+void SamplingProfiler::Record(Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx) {
+    if (process != kernel.ApplicationProcess()) {
+        return;
+    }
+    auto backtrace = GetBacktraceAddresses(process, ctx, MAX_FRAMES);
+    std::scoped_lock lock{mutex};
+    ++stacks[std::move(backtrace)];
+    ++num_samples;
+}
+
+void SamplingProfiler::Report(Kernel::KProcess* process) {
+    thread.request_stop();
+    thread.join();
+
+    std::scoped_lock lock{mutex};
+    if (num_samples == 0 || process == nullptr) {
+        return;
+    }
+    // Symbolize every address once, the symbol tables are read for each call
+    std::vector<u64> addresses;
+    for (const auto& [backtrace, count] : stacks) {
+        addresses.insert(addresses.end(), backtrace.begin(), backtrace.end());
+    }
+    std::ranges::sort(addresses);
+    const auto [first, last] = std::ranges::unique(addresses);
+    addresses.erase(first, last);
+    const std::vector<BacktraceEntry> entries = SymbolicateAddresses(process, addresses);
+    std::unordered_map<u64, std::string> names;
+    for (size_t index = 0; index < addresses.size(); ++index) {
+        names.emplace(addresses[index], FrameName(entries[index]));
+    }
+
+    std::unordered_map<std::string_view, FunctionSamples> functions;
+    std::string folded;
+    for (const auto& [backtrace, count] : stacks) {
+        functions[names[backtrace.front()]].self += count;
+        // Recursion is only counted once in the total of a function
+        std::unordered_set<std::string_view> seen;
+        for (const u64 address : backtrace) {
+            const std::string_view name = names[address];
+            if (seen.insert(name).second) {
+                functions[name].total += count;
+            }
+        }
+        // Folded stacks list the outermost frame first
+        for (auto it = backtrace.rbegin(); it != backtrace.rend(); ++it) {
+            folded += names[*it];
+            folded += it + 1 != backtrace.rend() ? ';' : ' ';
+        }
+        folded += fmt::format("{}\n", count);
+    }
+
+    std::vector<std::pair<std::string_view, FunctionSamples>> sorted(functions.begin(),
+                                                                      functions.end());
+    const size_t num_reported = (std::min)(sorted.size(), NUM_REPORTED_FUNCTIONS);
+    std::ranges::partial_sort(sorted, sorted.begin() + num_reported,
+                              [](const auto& a, const auto& b) {
+                                  return a.second.self > b.second.self;
+                              });
+    const auto percent = [this](u64 count) {
+        return 100.0 * static_cast<double>(count) / static_cast<double>(num_samples);
+    };
+    LOG_INFO(Core_ARM, "Hottest guest functions over {} samples (self%, total%):", num_samples);
+    for (size_t index = 0; index < num_reported; ++index) {
+        const auto& [name, samples] = sorted[index];
+        LOG_INFO(Core_ARM, "  {:5.1f}% {:5.1f}% {}", percent(samples.self), percent(samples.total),
+                 name);
+    }
+
+    const auto path = Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) /
+                      fmt::format("{:016X}.guest.folded", process->GetProgramId());
+    if (Common::FS::CreateParentDir(path)) {
+        Common::FS::IOFile file(path, Common::FS::FileAccessMode::Write,
+                                Common::FS::FileType::TextFile);
+        if (file.WriteString(folded) == folded.size()) {
+            LOG_INFO(Core_ARM, "Guest profile written to {}", Common::FS::PathToUTF8String(path));
+            return;
+        }
+    }
+    LOG_ERROR(Core_ARM, "Failed to write the guest profile");
+}
+
+} // namespace Core
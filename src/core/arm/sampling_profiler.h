@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+
+namespace Kernel {
+class KernelCore;
+class KProcess;
+namespace Svc {
+struct ThreadContext;
+}
+} // namespace Kernel
+
+namespace Core {
+
+/// Periodically halts the emulated cores to sample the guest code they run. The backtraces of
+/// the application are symbolized when the session ends, logging the hottest functions and
+/// writing them as folded stacks for flame graph tools.
+class SamplingProfiler {
+public:
+    static constexpr std::chrono::microseconds SAMPLE_PERIOD{1000};
+    static constexpr size_t MAX_FRAMES = 64;             ///< Frame records followed per sample
+    static constexpr size_t NUM_REPORTED_FUNCTIONS = 20; ///< Functions shown in the log
+
+    explicit SamplingProfiler(Kernel::KernelCore& kernel);
+    ~SamplingProfiler();
+
+    /// Records the backtrace of a context halted for a sample, called from the core running it.
+    void Record(Kernel::KProcess* process, const Kernel::Svc::ThreadContext& ctx);
+
+    /// Stops sampling, then logs the report and writes the folded stacks of the application.
+    void Report(Kernel::KProcess* process);
+
+private:
+    void Run(std::stop_token stop_token);
+
+    Kernel::KernelCore& kernel;
+
+    std::mutex mutex;
+    /// Sample counts by backtrace, innermost address first
+    std::map<std::vector<u64>, u64> stacks;
+    u64 num_samples = 0;
+
+    std::jthread thread;
+};
+
+} // namespace Core
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "common/logging/log.h"
+#include "core/boot_timeline.h"
+
+namespace Core {
+
+namespace {
+double ToMilliseconds(std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+} // Anonymous namespace
+
+BootTimeline::Stage::Stage(BootTimeline& timeline_, std::string_view name_)
+    : timeline{timeline_}, name{name_}, begin{Clock::now()} {}
+
+BootTimeline::Stage::~Stage() {
+    timeline.AddStage(std::move(name), begin, Clock::now());
+}
+
+void BootTimeline::Begin() {
+    std::scoped_lock lk{mutex};
+    start = Clock::now();
+    stages.clear();
+    is_booting.store(true, std::memory_order_release);
+}
+
+bool BootTimeline::MarkFirstFrame() {
+    // Called every frame, only the first one takes the lock
+    if (!is_booting.load(std::memory_order_relaxed) ||
+        !is_booting.exchange(false, std::memory_order_acq_rel)) {
+        return false;
+    }
+    std::scoped_lock lk{mutex};
+    const auto first_frame = Clock::now() - start;
+    std::vector<StageInfo> sorted = stages;
+    std::ranges::sort(sorted, {}, &StageInfo::begin);
+
+    LOG_INFO(Core, "First frame presented {:.1f} ms after boot started",
+             ToMilliseconds(first_frame));
+    for (const StageInfo& stage : sorted) {
+        LOG_INFO(Core, "  {}: {:.1f} ms to {:.1f} ms ({:.1f} ms)", stage.name,
+                 ToMilliseconds(stage.begin), ToMilliseconds(stage.end),
+                 ToMilliseconds(stage.end - stage.begin));
+    }
+    return true;
+}
+
+std::vector<BootTimeline::StageInfo> BootTimeline::GetStages() const {
+    std::scoped_lock lk{mutex};
+    return stages;
+}
+
+void BootTimeline::AddStage(std::string name, Clock::time_point begin, Clock::time_point end) {
+    std::scoped_lock lk{mutex};
+    stages.push_back({
+        .name = std::move(name),
+        .begin = begin - start,
+        .end = end - start,
+    });
+}
+
+} // namespace Core
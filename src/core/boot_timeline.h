@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Core {
+
+/**
+ * Records the stages of booting an application, from the start of System::Load to the first
+ * frame presented by the guest. Stages may run concurrently on different threads, the timeline
+ * is logged once the first frame is presented.
+ */
+class BootTimeline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct StageInfo {
+        std::string name;
+        std::chrono::nanoseconds begin; ///< Offset from the start of the boot
+        std::chrono::nanoseconds end;
+    };
+
+    /// Measures a stage until it is destroyed.
+    class Stage {
+    public:
+        explicit Stage(BootTimeline& timeline, std::string_view name);
+        ~Stage();
+
+        Stage(const Stage&) = delete;
+        Stage& operator=(const Stage&) = delete;
+
+    private:
+        BootTimeline& timeline;
+        std::string name;
+        Clock::time_point begin;
+    };
+
+    /// Starts a new boot, discarding the stages of the previous one.
+    void Begin();
+
+    /// Returns a guard measuring a stage of the boot until it goes out of scope.
+    [[nodiscard]] Stage MeasureStage(std::string_view name) {
+        return Stage{*this, name};
+    }
+
+    /// Ends the boot when called for the first time since Begin, logging the timeline.
+    /// Returns true when the boot was ended by this call.
+    bool MarkFirstFrame();
+
+    /// Returns the stages measured so far, in the order they ended.
+    [[nodiscard]] std::vector<StageInfo> GetStages() const;
+
+private:
+    void AddStage(std::string name, Clock::time_point begin, Clock::time_point end);
+
+    mutable std::mutex mutex;
+    Clock::time_point start{Clock::now()};
+    std::vector<StageInfo> stages;
+    std::atomic_bool is_booting{false};
+};
+
+} // namespace Core
@@ -1,9 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "audio_core/audio_core.h"
@@ -12,7 +15,9 @@
 #include "common/settings.h"
 #include "common/settings_enums.h"
 #include "common/string_util.h"
+#include "common/thread.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/boot_timeline.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -26,6 +31,7 @@
 #include "core/file_sys/vfs/vfs_concat.h"
 #include "core/file_sys/vfs/vfs_real.h"
 #include "core/gpu_dirty_memory_manager.h"
+#include "core/hle/kernel/global_scheduler_context.h"
 #include "core/hle/kernel/k_memory_manager.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_resource_limit.h"
@@ -266,15 +272,22 @@ struct System::Impl {
         cpu_manager.Initialize();
     }
 
-    SystemResultStatus SetupForApplicationProcess(System& system, Frontend::EmuWindow& emu_window) {
-        host1x_core = std::make_unique<Tegra::Host1x::Host1x>(system);
-        gpu_core = VideoCore::CreateGPU(emu_window, system);
-        if (!gpu_core) {
-            return SystemResultStatus::ErrorVideoCore;
+    SystemResultStatus InitializeDevices(System& system, Frontend::EmuWindow& emu_window) {
+        {
+            const auto stage = boot_timeline.MeasureStage("Video core");
+            host1x_core = std::make_unique<Tegra::Host1x::Host1x>(system);
+            gpu_core = VideoCore::CreateGPU(emu_window, system);
+            if (!gpu_core) {
+                return SystemResultStatus::ErrorVideoCore;
+            }
         }
-
+        const auto stage = boot_timeline.MeasureStage("Audio core");
         audio_core = std::make_unique<AudioCore::AudioCore>(system);
+        return SystemResultStatus::Success;
+    }
 
+    SystemResultStatus SetupForApplicationProcess(System& system) {
+        const auto stage = boot_timeline.MeasureStage("Services");
         service_manager = std::make_shared<Service::SM::ServiceManager>(kernel);
         services =
             std::make_unique<Service::Services>(service_manager, system, stop_event.get_token());
@@ -337,16 +350,33 @@ struct System::Impl {
     SystemResultStatus Load(System& system, Frontend::EmuWindow& emu_window,
                             const std::string& filepath,
                             Service::AM::FrontendAppletParameters& params) {
-        InitializeKernel(system);
-
-        const auto file = GetGameFileFromPath(virtual_filesystem, filepath);
+        boot_timeline.Begin();
+        {
+            const auto stage = boot_timeline.MeasureStage("Kernel");
+            InitializeKernel(system);
+        }
 
-        // Create the application process
+        // Create the application process. Reading the game, resolving its patches and loading its
+        // modules doesn't depend on the video and audio cores, so it runs while they initialize.
         Loader::ResultStatus load_result{};
         std::vector<u8> control;
-        auto process =
-            Service::AM::CreateApplicationProcess(control, app_loader, load_result, system, file,
-                                                  params.program_id, params.program_index);
+        auto process_future = std::async(std::launch::async, [&] {
+            Common::SetCurrentThreadName("ProcessLoader");
+            const auto stage = boot_timeline.MeasureStage("Application process");
+            const auto file = GetGameFileFromPath(virtual_filesystem, filepath);
+            return Service::AM::CreateApplicationProcess(control, app_loader, load_result, system,
+                                                         file, params.program_id,
+                                                         params.program_index);
+        });
+        const SystemResultStatus devices_result{InitializeDevices(system, emu_window)};
+        auto process = process_future.get();
+
+        if (devices_result != SystemResultStatus::Success) {
+            LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
+                         static_cast<int>(devices_result));
+            ShutdownMainProcess();
+            return devices_result;
+        }
 
         if (load_result != Loader::ResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to load ROM (Error {})!", load_result);
@@ -376,7 +406,7 @@ struct System::Impl {
         kernel.MakeApplicationProcess(process->GetHandle());
 
         // Set up the rest of the system.
-        SystemResultStatus init_result{SetupForApplicationProcess(system, emu_window)};
+        SystemResultStatus init_result{SetupForApplicationProcess(system)};
         if (init_result != SystemResultStatus::Success) {
             LOG_CRITICAL(Core, "Failed to initialize system (Error {})!",
                          static_cast<int>(init_result));
@@ -462,6 +492,10 @@ struct System::Impl {
         gpu_core.reset();
         host1x_core.reset();
         perf_stats.reset();
+        {
+            std::scoped_lock lk{memory_peaks_mutex};
+            memory_peaks.fill(0);
+        }
         cpu_manager.Shutdown();
         debugger.reset();
         kernel.Shutdown();
@@ -501,7 +535,42 @@ struct System::Impl {
     }
 
     PerfStatsResults GetAndResetPerfStats() {
-        return perf_stats->GetAndResetStats(core_timing.GetGlobalTimeUs());
+        const auto audio_latency = audio_core
+                                       ? audio_core->ADSP().AudioRenderer().GetOutputLatency()
+                                       : std::chrono::microseconds{};
+        PerfStats::CoreIdleTimes core_idle_times{};
+        if (kernel.IsMulticore()) {
+            for (size_t core = 0; core < core_idle_times.size(); ++core) {
+                core_idle_times[core] = kernel.PhysicalCore(core).GetAndResetIdleTime();
+            }
+        }
+        return perf_stats->GetAndResetStats(
+            core_timing.GetGlobalTimeUs(),
+            kernel.GlobalSchedulerContext().SchedulerLock().GetAndResetContentionCount(),
+            audio_latency, core_idle_times, hid_core.GetAndResetInputLatency().average);
+    }
+
+    MemoryTelemetry GetMemoryTelemetry() {
+        MemoryTelemetry telemetry{};
+        if (auto* const process = kernel.ApplicationProcess()) {
+            telemetry[MemoryCategory::GuestMemory].bytes = process->GetUsedUserPhysicalMemorySize();
+        }
+        if (gpu_core) {
+            auto& renderer = gpu_core->Renderer();
+            telemetry[MemoryCategory::GpuDeviceMemory].bytes =
+                renderer.GetDeviceMemoryUsage().value_or(0);
+            const auto cache_usage = renderer.ReadRasterizer()->GetCacheMemoryUsage();
+            telemetry[MemoryCategory::TextureCache].bytes = cache_usage.texture_cache;
+            telemetry[MemoryCategory::BufferCache].bytes = cache_usage.buffer_cache;
+        }
+
+        std::scoped_lock lk{memory_peaks_mutex};
+        for (size_t i = 0; i < memory_peaks.size(); ++i) {
+            auto& usage = telemetry.categories[i];
+            memory_peaks[i] = (std::max)(memory_peaks[i], usage.bytes);
+            usage.peak_bytes = memory_peaks[i];
+        }
+        return telemetry;
     }
 
     mutable std::mutex suspend_guard;
@@ -565,6 +634,11 @@ struct System::Impl {
 
     std::unique_ptr<Core::PerfStats> perf_stats;
     Core::SpeedLimiter speed_limiter;
+    Core::BootTimeline boot_timeline;
+
+    /// Highest memory usage sampled per category since the application started
+    std::mutex memory_peaks_mutex;
+    std::array<u64, static_cast<size_t>(MemoryCategory::Count)> memory_peaks{};
 
     bool is_multicore{};
     bool is_async_gpu{};
@@ -679,6 +753,10 @@ PerfStatsResults System::GetAndResetPerfStats() {
     return impl->GetAndResetPerfStats();
 }
 
+MemoryTelemetry System::GetMemoryTelemetry() {
+    return impl->GetMemoryTelemetry();
+}
+
 Kernel::PhysicalCore& System::CurrentPhysicalCore() {
     return impl->kernel.CurrentPhysicalCore();
 }
@@ -785,6 +863,10 @@ const Core::PerfStats& System::GetPerfStats() const {
     return *impl->perf_stats;
 }
 
+Core::BootTimeline& System::GetBootTimeline() {
+    return impl->boot_timeline;
+}
+
 Core::SpeedLimiter& System::SpeedLimiter() {
     return impl->speed_limiter;
 }
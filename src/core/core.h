@@ -113,6 +113,7 @@ class RenderdocAPI;
 
 namespace Core {
 
+class BootTimeline;
 class CpuManager;
 class Debugger;
 class DeviceMemory;
@@ -123,6 +124,7 @@ class Reporter;
 class SpeedLimiter;
 
 struct PerfStatsResults;
+struct MemoryTelemetry;
 
 FileSys::VirtualFile GetGameFileFromPath(const FileSys::VirtualFilesystem& vfs,
                                          const std::string& path);
@@ -228,6 +230,9 @@ public:
     /// Gets and resets core performance statistics
     [[nodiscard]] PerfStatsResults GetAndResetPerfStats();
 
+    /// Samples the memory usage of the application, the emulated GPU and its caches
+    [[nodiscard]] MemoryTelemetry GetMemoryTelemetry();
+
     /// Gets the physical core for the CPU core that is currently running
     [[nodiscard]] Kernel::PhysicalCore& CurrentPhysicalCore();
 
@@ -312,6 +317,9 @@ public:
     /// Provides a constant reference to the internal PerfStats instance.
     [[nodiscard]] const Core::PerfStats& GetPerfStats() const;
 
+    /// Provides a reference to the timeline of the application boot.
+    [[nodiscard]] Core::BootTimeline& GetBootTimeline();
+
     /// Provides a reference to the speed limiter;
     [[nodiscard]] Core::SpeedLimiter& SpeedLimiter();
 
@@ -17,6 +17,7 @@
 #include "common/x64/cpu_wait.h"
 #endif
 
+#include "common/logging/log.h"
 #include "common/settings.h"
 #include "core/core_timing.h"
 #include "core/hardware_properties.h"
@@ -29,6 +30,13 @@ std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callbac
     return std::make_shared<EventType>(std::move(callback), std::move(name));
 }
 
+static void RecordCallback(EventType& event_type, s64 latency_ns, s64 runtime_ns) {
+    ++event_type.call_count;
+    event_type.total_latency_ns += latency_ns;
+    event_type.max_latency_ns = std::max(event_type.max_latency_ns, latency_ns);
+    event_type.total_runtime_ns += runtime_ns;
+}
+
 struct CoreTiming::Event {
     s64 time;
     u64 fifo_order;
@@ -66,13 +74,22 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
     event_fifo_id = 0;
     shutting_down = false;
     cpu_ticks = 0;
+    use_batching = Settings::values.core_timing_batching.GetValue();
+    slack_ns = use_batching ? s64{Settings::values.core_timing_slack.GetValue()} * 1000 : 0;
     if (is_multicore) {
         timer_thread = std::make_unique<std::jthread>(ThreadEntry, std::ref(*this));
     }
 }
 
 void CoreTiming::ClearPendingEvents() {
+    for (const EventStatistics& stats : GetEventStatistics()) {
+        LOG_DEBUG(Core_Timing, "{}: {} calls, {} ns average latency, {} ns max latency, {} ns average runtime",
+                  stats.name, stats.call_count, stats.average_latency.count(),
+                  stats.max_latency.count(), stats.average_runtime.count());
+    }
+
     std::scoped_lock lock{advance_lock, basic_lock};
+    InsertPendingEvents();
     event_queue.clear();
     event.Set();
 }
@@ -112,18 +129,13 @@ bool CoreTiming::IsRunning() const {
 
 bool CoreTiming::HasPendingEvents() const {
     std::scoped_lock lock{basic_lock};
-    return !(wait_set && event_queue.empty());
+    return !(wait_set && event_queue.empty() && pending_events.Empty());
 }
 
 void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
                                const std::shared_ptr<EventType>& event_type, bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
-
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
-    }
+    const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
+    QueueEvent(next_time.count(), event_type, 0);
 
     event.Set();
 }
@@ -132,22 +144,49 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
                                       std::chrono::nanoseconds resched_time,
                                       const std::shared_ptr<EventType>& event_type,
                                       bool absolute_time) {
-    {
-        std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
+    const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
+    QueueEvent(next_time.count(), event_type, resched_time.count());
+
+    event.Set();
+}
 
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
+void CoreTiming::QueueEvent(s64 time, const std::shared_ptr<EventType>& event_type,
+                            s64 reschedule_time) {
+    if (use_batching) {
+        // Don't wait for the timer thread while it runs callbacks, it inserts the event the next
+        // time it takes the lock.
+        std::unique_lock lock{basic_lock, std::try_to_lock};
+        if (!lock) {
+            pending_events.EmplaceWait(PendingEvent{time, event_type, reschedule_time});
+            return;
+        }
+        InsertPendingEvents();
+        InsertEvent(time, event_type, reschedule_time);
+        return;
     }
+    std::scoped_lock scope{basic_lock};
+    InsertEvent(time, event_type, reschedule_time);
+}
 
-    event.Set();
+void CoreTiming::InsertEvent(s64 time, const std::weak_ptr<EventType>& event_type,
+                             s64 reschedule_time) {
+    auto h{event_queue.emplace(Event{time, event_fifo_id++, event_type, reschedule_time})};
+    (*h).handle = h;
+}
+
+void CoreTiming::InsertPendingEvents() {
+    // Only called with the lock held, so there is a single consumer at a time.
+    while (pending_events.TryConsume([this](PendingEvent& pending) {
+        InsertEvent(pending.time, pending.type, pending.reschedule_time);
+    })) {
+    }
 }
 
 void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
                                  UnscheduleEventType type) {
     {
         std::scoped_lock lk{basic_lock};
+        InsertPendingEvents();
 
         std::vector<heap_t::handle_type> to_remove;
         for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
@@ -171,8 +210,9 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
 }
 
 static u64 GetNextTickCount(u64 next_ticks) {
-    if (Settings::values.use_custom_cpu_ticks.GetValue()) {
-        return Settings::values.cpu_ticks.GetValue();
+    const auto& settings = Settings::RuntimeSnapshot();
+    if (settings.use_custom_cpu_ticks) {
+        return settings.cpu_ticks;
     }
     return next_ticks;
 }
@@ -199,14 +239,15 @@ u64 CoreTiming::GetClockTicks() const {
          fres = Common::WallClock::CPUTickToCNTPCT(cpu_ticks);
      }
 
-     if (Settings::values.use_fast_cpu_time) {
+     const auto& settings = Settings::RuntimeSnapshot();
+     if (settings.use_fast_cpu_time) {
          fres = (u64) ((double) fres
-                       * (1.7 + 0.3 * (u32) Settings::values.fast_cpu_time.GetValue()));
+                       * (1.7 + 0.3 * (u32) settings.fast_cpu_time));
      }
 
-     if (Settings::values.sync_core_speed.GetValue()) {
+     if (settings.sync_core_speed) {
          const double ticks = static_cast<double>(fres);
-         const double speed_limit = static_cast<double>(Settings::values.speed_limit.GetValue())*0.01;
+         const double speed_limit = static_cast<double>(settings.speed_limit)*0.01;
          return static_cast<u64>(ticks/speed_limit);
      } else {
          return fres;
@@ -222,9 +263,10 @@ u64 CoreTiming::GetGPUTicks() const {
 
 std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock lock{advance_lock, basic_lock};
+    InsertPendingEvents();
     global_timer = GetGlobalTimeNs().count();
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
+    while (!event_queue.empty() && event_queue.top().time <= global_timer + slack_ns) {
         const Event& evt = event_queue.top();
 
         if (const auto event_type{evt.type.lock()}) {
@@ -236,17 +278,24 @@ std::optional<s64> CoreTiming::Advance() {
 
                 basic_lock.unlock();
 
-                event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time});
+                const s64 start_time = GetGlobalTimeNs().count();
+                event_type->callback(evt_time, std::chrono::nanoseconds{start_time - evt_time});
+                const s64 end_time = GetGlobalTimeNs().count();
 
                 basic_lock.lock();
+                RecordCallback(*event_type, start_time - evt_time, end_time - start_time);
+                InsertPendingEvents();
             } else {
                 basic_lock.unlock();
 
+                const s64 start_time = GetGlobalTimeNs().count();
                 const auto new_schedule_time{event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
+                    evt_time, std::chrono::nanoseconds{start_time - evt_time})};
+                const s64 end_time = GetGlobalTimeNs().count();
 
                 basic_lock.lock();
+                RecordCallback(*event_type, start_time - evt_time, end_time - start_time);
+                InsertPendingEvents();
 
                 if (evt_sequence_num != event_type->sequence_number) {
                     // Heap handle is invalidated after external modification.
@@ -336,6 +385,29 @@ void CoreTiming::Reset() {
     has_started = false;
 }
 
+std::vector<EventStatistics> CoreTiming::GetEventStatistics() const {
+    std::scoped_lock lock{basic_lock};
+    std::vector<const EventType*> seen_types;
+    std::vector<EventStatistics> statistics;
+    for (const Event& evt : event_queue) {
+        const auto event_type{evt.type.lock()};
+        if (!event_type || event_type->call_count == 0 ||
+            std::ranges::find(seen_types, event_type.get()) != seen_types.end()) {
+            continue;
+        }
+        seen_types.push_back(event_type.get());
+        const auto count = static_cast<s64>(event_type->call_count);
+        statistics.push_back({
+            .name = event_type->name,
+            .call_count = event_type->call_count,
+            .average_latency = std::chrono::nanoseconds{event_type->total_latency_ns / count},
+            .max_latency = std::chrono::nanoseconds{event_type->max_latency_ns},
+            .average_runtime = std::chrono::nanoseconds{event_type->total_runtime_ns / count},
+        });
+    }
+    return statistics;
+}
+
 std::chrono::nanoseconds CoreTiming::GetGlobalTimeNs() const {
     if (is_multicore) [[likely]] {
         return clock->GetTimeNS();
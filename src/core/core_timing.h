@@ -11,10 +11,12 @@
 #include <optional>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <boost/heap/fibonacci_heap.hpp>
 
 #include "common/common_types.h"
+#include "common/mpsc_ring.h"
 #include "common/thread.h"
 #include "common/wall_clock.h"
 
@@ -36,6 +38,21 @@ struct EventType {
     /// A monotonic sequence number, incremented when this event is
     /// changed externally.
     size_t sequence_number;
+
+    /// Callback statistics, only accessed by CoreTiming with its lock held.
+    u64 call_count{};
+    s64 total_latency_ns{};
+    s64 max_latency_ns{};
+    s64 total_runtime_ns{};
+};
+
+/// Callback latency statistics of an event type.
+struct EventStatistics {
+    std::string name;
+    u64 call_count;
+    std::chrono::nanoseconds average_latency;
+    std::chrono::nanoseconds max_latency;
+    std::chrono::nanoseconds average_runtime;
 };
 
 enum class UnscheduleEventType {
@@ -134,6 +151,9 @@ public:
     /// Checks for events manually and returns time in nanoseconds for next event, threadsafe.
     std::optional<s64> Advance();
 
+    /// Returns the callback statistics of the event types that are currently scheduled.
+    std::vector<EventStatistics> GetEventStatistics() const;
+
 #ifdef _WIN32
     void SetTimerResolutionNs(std::chrono::nanoseconds ns);
 #endif
@@ -141,11 +161,23 @@ public:
 private:
     struct Event;
 
+    /// An event scheduled while the timer thread was holding the lock, inserted the next time the
+    /// lock is taken.
+    struct PendingEvent {
+        s64 time;
+        std::weak_ptr<EventType> type;
+        s64 reschedule_time;
+    };
+
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
     void Reset();
 
+    void QueueEvent(s64 time, const std::shared_ptr<EventType>& event_type, s64 reschedule_time);
+    void InsertEvent(s64 time, const std::weak_ptr<EventType>& event_type, s64 reschedule_time);
+    void InsertPendingEvents();
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
@@ -160,6 +192,12 @@ private:
     heap_t event_queue;
     u64 event_fifo_id = 0;
 
+    /// When batching, events due within the slack window are run together and scheduling an
+    /// event never waits on the timer thread.
+    bool use_batching{};
+    s64 slack_ns{};
+    Common::MPSCRing<PendingEvent, 1024> pending_events;
+
     Common::Event event{};
     Common::Event pause_event{};
     mutable std::mutex basic_lock;
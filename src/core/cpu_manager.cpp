@@ -5,7 +5,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/fiber.h"
+#include "common/profiler.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -100,6 +102,7 @@ void CpuManager::MultiCoreRunIdleThread() {
     while (true) {
         auto& physical_core = kernel.CurrentPhysicalCore();
         if (!physical_core.IsInterrupted()) {
+            PROFILE_SCOPE("CpuManager::Idle");
             physical_core.Idle();
         }
 
@@ -195,6 +198,9 @@ void CpuManager::RunThread(std::stop_token token, std::size_t core) {
         name = "CPUThread";
     }
     Common::SetCurrentThreadName(name.c_str());
+    if (Settings::values.core_type_affinity.GetValue()) {
+        Common::SetCurrentThreadCoreType(Common::CoreType::Performance);
+    }
     Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
     auto& data = core_data[core];
     data.host_context = Common::Fiber::ThreadToFiber();
@@ -0,0 +1,325 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "common/swap.h"
+#include "core/crypto/aes_accel.h"
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+#include <arm_neon.h>
+#define HAS_ARM_AES
+#endif
+
+namespace Core::Crypto::Accel {
+
+namespace {
+
+/// Number of blocks processed together, enough to cover the latency of one round.
+constexpr std::size_t LANES = 8;
+constexpr std::size_t BLOCK_SIZE = 16;
+
+constexpr u8 GaloisMultiply(u8 a, u8 b) {
+    u8 result = 0;
+    while (b != 0) {
+        if ((b & 1) != 0) {
+            result ^= a;
+        }
+        a = static_cast<u8>((a << 1) ^ ((a & 0x80) != 0 ? 0x1B : 0));
+        b >>= 1;
+    }
+    return result;
+}
+
+constexpr std::array<u8, 256> SBOX = [] {
+    std::array<u8, 256> sbox{};
+    for (u32 x = 0; x < 256; ++x) {
+        u8 inverse = 0;
+        for (u32 y = 1; y < 256 && x != 0; ++y) {
+            if (GaloisMultiply(static_cast<u8>(x), static_cast<u8>(y)) == 1) {
+                inverse = static_cast<u8>(y);
+                break;
+            }
+        }
+        u8 value = inverse;
+        for (u32 shift = 1; shift < 5; ++shift) {
+            value ^= static_cast<u8>((inverse << shift) | (inverse >> (8 - shift)));
+        }
+        sbox[x] = value ^ 0x63;
+    }
+    return sbox;
+}();
+static_assert(SBOX[0x00] == 0x63 && SBOX[0x53] == 0xED);
+
+std::array<u8, 16> InverseMixColumns(const std::array<u8, 16>& key) {
+    std::array<u8, 16> result{};
+    for (std::size_t column = 0; column < 4; ++column) {
+        const u8* const in = key.data() + column * 4;
+        u8* const out = result.data() + column * 4;
+        for (std::size_t row = 0; row < 4; ++row) {
+            out[row] = GaloisMultiply(in[row], 0x0E) ^ GaloisMultiply(in[(row + 1) % 4], 0x0B) ^
+                       GaloisMultiply(in[(row + 2) % 4], 0x0D) ^
+                       GaloisMultiply(in[(row + 3) % 4], 0x09);
+        }
+    }
+    return result;
+}
+
+/// Multiplies an XTS tweak by x in GF(2^128).
+void NextTweak(u64& low, u64& high) {
+    const u64 carry = high >> 63;
+    high = (high << 1) | (low >> 63);
+    low = (low << 1) ^ (carry * 0x87);
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AES_TARGET __attribute__((target("aes,sse4.1")))
+#else
+#define AES_TARGET
+#endif
+
+using Block = __m128i;
+
+AES_TARGET inline Block Load(const u8* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+AES_TARGET inline void Store(u8* data, Block block) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), block);
+}
+
+AES_TARGET inline Block Xor(Block a, Block b) {
+    return _mm_xor_si128(a, b);
+}
+
+template <std::size_t N>
+AES_TARGET inline void EncryptBlocks(const KeySchedule& key, Block* blocks) {
+    Block round_key = Load(key.encrypt[0].data());
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_xor_si128(blocks[i], round_key);
+    }
+    for (std::size_t round = 1; round < 10; ++round) {
+        round_key = Load(key.encrypt[round].data());
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = _mm_aesenc_si128(blocks[i], round_key);
+        }
+    }
+    round_key = Load(key.encrypt[10].data());
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_aesenclast_si128(blocks[i], round_key);
+    }
+}
+
+template <std::size_t N>
+AES_TARGET inline void DecryptBlocks(const KeySchedule& key, Block* blocks) {
+    Block round_key = Load(key.decrypt[0].data());
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_xor_si128(blocks[i], round_key);
+    }
+    for (std::size_t round = 1; round < 10; ++round) {
+        round_key = Load(key.decrypt[round].data());
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = _mm_aesdec_si128(blocks[i], round_key);
+        }
+    }
+    round_key = Load(key.decrypt[10].data());
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_aesdeclast_si128(blocks[i], round_key);
+    }
+}
+
+#elif defined(HAS_ARM_AES)
+
+#define AES_TARGET
+
+using Block = uint8x16_t;
+
+inline Block Load(const u8* data) {
+    return vld1q_u8(data);
+}
+
+inline void Store(u8* data, Block block) {
+    vst1q_u8(data, block);
+}
+
+inline Block Xor(Block a, Block b) {
+    return veorq_u8(a, b);
+}
+
+template <std::size_t N>
+inline void EncryptBlocks(const KeySchedule& key, Block* blocks) {
+    for (std::size_t round = 0; round < 9; ++round) {
+        const Block round_key = Load(key.encrypt[round].data());
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = vaesmcq_u8(vaeseq_u8(blocks[i], round_key));
+        }
+    }
+    const Block round_key = Load(key.encrypt[9].data());
+    const Block last_key = Load(key.encrypt[10].data());
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = veorq_u8(vaeseq_u8(blocks[i], round_key), last_key);
+    }
+}
+
+template <std::size_t N>
+inline void DecryptBlocks(const KeySchedule& key, Block* blocks) {
+    for (std::size_t round = 0; round < 9; ++round) {
+        const Block round_key = Load(key.decrypt[round].data());
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = vaesimcq_u8(vaesdq_u8(blocks[i], round_key));
+        }
+    }
+    const Block round_key = Load(key.decrypt[9].data());
+    const Block last_key = Load(key.decrypt[10].data());
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = veorq_u8(vaesdq_u8(blocks[i], round_key), last_key);
+    }
+}
+
+#endif
+
+#if defined(ARCHITECTURE_x86_64) || defined(HAS_ARM_AES)
+
+template <std::size_t N>
+AES_TARGET inline void CtrBlocks(const KeySchedule& key, u64& high, u64& low, const u8* src,
+                                 u8* dest) {
+    std::array<std::array<u8, BLOCK_SIZE>, N> counters;
+    for (std::size_t i = 0; i < N; ++i) {
+        const u64 values[2]{Common::swap64(high), Common::swap64(low)};
+        std::memcpy(counters[i].data(), values, BLOCK_SIZE);
+        high += ++low == 0 ? 1 : 0;
+    }
+    Block blocks[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = Load(counters[i].data());
+    }
+    EncryptBlocks<N>(key, blocks);
+    for (std::size_t i = 0; i < N; ++i) {
+        Store(dest + i * BLOCK_SIZE, Xor(blocks[i], Load(src + i * BLOCK_SIZE)));
+    }
+}
+
+template <std::size_t N>
+AES_TARGET inline void XtsBlocks(const KeySchedule& key, u64& low, u64& high, const u8* src,
+                                 u8* dest, bool decrypt) {
+    std::array<std::array<u8, BLOCK_SIZE>, N> tweaks;
+    for (std::size_t i = 0; i < N; ++i) {
+        const u64 values[2]{low, high};
+        std::memcpy(tweaks[i].data(), values, BLOCK_SIZE);
+        NextTweak(low, high);
+    }
+    Block blocks[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = Xor(Load(src + i * BLOCK_SIZE), Load(tweaks[i].data()));
+    }
+    if (decrypt) {
+        DecryptBlocks<N>(key, blocks);
+    } else {
+        EncryptBlocks<N>(key, blocks);
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        Store(dest + i * BLOCK_SIZE, Xor(blocks[i], Load(tweaks[i].data())));
+    }
+}
+
+#endif
+
+} // Anonymous namespace
+
+bool IsSupported() {
+#if defined(ARCHITECTURE_x86_64)
+    const auto& caps = Common::GetCPUCaps();
+    return caps.aes && caps.sse4_1;
+#elif defined(HAS_ARM_AES)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ExpandKey(const u8* key, KeySchedule& out) {
+    static constexpr std::array<u8, 10> ROUND_CONSTANTS{0x01, 0x02, 0x04, 0x08, 0x10,
+                                                        0x20, 0x40, 0x80, 0x1B, 0x36};
+    std::memcpy(out.encrypt[0].data(), key, BLOCK_SIZE);
+    for (std::size_t round = 1; round < out.encrypt.size(); ++round) {
+        const auto& previous = out.encrypt[round - 1];
+        auto& current = out.encrypt[round];
+        const u8* const last_word = previous.data() + 12;
+        current[0] = previous[0] ^ SBOX[last_word[1]] ^ ROUND_CONSTANTS[round - 1];
+        current[1] = previous[1] ^ SBOX[last_word[2]];
+        current[2] = previous[2] ^ SBOX[last_word[3]];
+        current[3] = previous[3] ^ SBOX[last_word[0]];
+        for (std::size_t i = 4; i < BLOCK_SIZE; ++i) {
+            current[i] = previous[i] ^ current[i - 4];
+        }
+    }
+    // Round keys of the equivalent inverse cipher.
+    out.decrypt[0] = out.encrypt[10];
+    for (std::size_t round = 1; round < 10; ++round) {
+        out.decrypt[round] = InverseMixColumns(out.encrypt[10 - round]);
+    }
+    out.decrypt[10] = out.encrypt[0];
+}
+
+#if defined(ARCHITECTURE_x86_64) || defined(HAS_ARM_AES)
+
+AES_TARGET void CtrTranscode(const KeySchedule& key, std::array<u8, 16>& counter, const u8* src,
+                             std::size_t size, u8* dest) {
+    u64 values[2];
+    std::memcpy(values, counter.data(), BLOCK_SIZE);
+    u64 high = Common::swap64(values[0]);
+    u64 low = Common::swap64(values[1]);
+
+    std::size_t offset = 0;
+    for (; offset + LANES * BLOCK_SIZE <= size; offset += LANES * BLOCK_SIZE) {
+        CtrBlocks<LANES>(key, high, low, src + offset, dest + offset);
+    }
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE) {
+        CtrBlocks<1>(key, high, low, src + offset, dest + offset);
+    }
+    if (offset < size) {
+        std::array<u8, BLOCK_SIZE> tail{};
+        std::memcpy(tail.data(), src + offset, size - offset);
+        CtrBlocks<1>(key, high, low, tail.data(), tail.data());
+        std::memcpy(dest + offset, tail.data(), size - offset);
+    }
+
+    values[0] = Common::swap64(high);
+    values[1] = Common::swap64(low);
+    std::memcpy(counter.data(), values, BLOCK_SIZE);
+}
+
+AES_TARGET void XtsTranscode(const KeySchedule& data_key, const KeySchedule& tweak_key,
+                             const std::array<u8, 16>& tweak, const u8* src, std::size_t size,
+                             u8* dest, bool decrypt) {
+    Block initial = Load(tweak.data());
+    EncryptBlocks<1>(tweak_key, &initial);
+    u64 values[2];
+    Store(reinterpret_cast<u8*>(values), initial);
+    u64 low = values[0];
+    u64 high = values[1];
+
+    std::size_t offset = 0;
+    for (; offset + LANES * BLOCK_SIZE <= size; offset += LANES * BLOCK_SIZE) {
+        XtsBlocks<LANES>(data_key, low, high, src + offset, dest + offset, decrypt);
+    }
+    for (; offset + BLOCK_SIZE <= size; offset += BLOCK_SIZE) {
+        XtsBlocks<1>(data_key, low, high, src + offset, dest + offset, decrypt);
+    }
+}
+
+#else
+
+void CtrTranscode(const KeySchedule&, std::array<u8, 16>&, const u8*, std::size_t, u8*) {}
+
+void XtsTranscode(const KeySchedule&, const KeySchedule&, const std::array<u8, 16>&, const u8*,
+                  std::size_t, u8*, bool) {}
+
+#endif
+
+} // namespace Core::Crypto::Accel
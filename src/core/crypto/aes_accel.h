@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+/// AES-128 primitives using the AES instructions of the host (AES-NI, ARMv8 Crypto Extensions).
+/// They process several blocks at once to hide the latency of each round.
+namespace Core::Crypto::Accel {
+
+struct KeySchedule {
+    std::array<std::array<u8, 16>, 11> encrypt;
+    std::array<std::array<u8, 16>, 11> decrypt;
+};
+
+/// Returns true if the host supports the AES instructions these functions were built with.
+[[nodiscard]] bool IsSupported();
+
+/// Expands a 128-bit key into the round keys of both directions. Requires IsSupported().
+void ExpandKey(const u8* key, KeySchedule& out);
+
+/**
+ * Transcodes data in CTR mode, src and dest may alias.
+ * The big endian counter is advanced by the number of blocks used, including a final partial one.
+ */
+void CtrTranscode(const KeySchedule& key, std::array<u8, 16>& counter, const u8* src,
+                  std::size_t size, u8* dest);
+
+/**
+ * Transcodes one XTS data unit whose size is a multiple of the block size, src and dest may alias.
+ * The tweak is encrypted with the second key to get the tweak of the first block.
+ */
+void XtsTranscode(const KeySchedule& data_key, const KeySchedule& tweak_key,
+                  const std::array<u8, 16>& tweak, const u8* src, std::size_t size, u8* dest,
+                  bool decrypt);
+
+} // namespace Core::Crypto::Accel
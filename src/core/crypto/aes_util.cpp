@@ -7,9 +7,11 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <optional>
 #include <mbedtls/cipher.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "core/crypto/aes_accel.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/key_manager.h"
 
@@ -42,6 +44,12 @@ static_assert(static_cast<std::size_t>(Mode::XTS) ==
 struct CipherContext {
     mbedtls_cipher_context_t encryption_context;
     mbedtls_cipher_context_t decryption_context;
+
+    // Round keys of the CTR and XTS modes when the host has AES instructions. The IV is kept here
+    // as well, CTR advances it across calls like mbedtls does.
+    std::optional<Accel::KeySchedule> accel_key;
+    std::optional<Accel::KeySchedule> accel_tweak_key;
+    std::array<u8, AesBlockBytes> iv{};
 };
 
 template <typename Key, std::size_t KeySize>
@@ -63,6 +71,16 @@ Crypto::AESCipher<Key, KeySize>::AESCipher(Key key, Mode mode)
     ASSERT(
         !mbedtls_cipher_setkey(&ctx->decryption_context, key.data(), KeySize * 8, MBEDTLS_DECRYPT));
     //"Failed to set key on mbedtls ciphers.");
+
+    if (!Accel::IsSupported()) {
+        return;
+    }
+    if (mode == Mode::CTR && KeySize == 0x10) {
+        Accel::ExpandKey(key.data(), ctx->accel_key.emplace());
+    } else if (mode == Mode::XTS && KeySize == 0x20) {
+        Accel::ExpandKey(key.data(), ctx->accel_key.emplace());
+        Accel::ExpandKey(key.data() + 0x10, ctx->accel_tweak_key.emplace());
+    }
 }
 
 template <typename Key, std::size_t KeySize>
@@ -73,6 +91,18 @@ AESCipher<Key, KeySize>::~AESCipher() {
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* dest, Op op) const {
+    if (ctx->accel_key) {
+        if (!ctx->accel_tweak_key) {
+            Accel::CtrTranscode(*ctx->accel_key, ctx->iv, src, size, dest);
+            return;
+        }
+        if (size != 0 && size % AesBlockBytes == 0) {
+            Accel::XtsTranscode(*ctx->accel_key, *ctx->accel_tweak_key, ctx->iv, src, size, dest,
+                                op == Op::Decrypt);
+            return;
+        }
+    }
+
     auto* const context = op == Op::Encrypt ? &ctx->encryption_context : &ctx->decryption_context;
 
     mbedtls_cipher_reset(context);
@@ -137,6 +167,10 @@ void AESCipher<Key, KeySize>::XTSTranscode(const u8* src, std::size_t size, u8*
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::SetIV(std::span<const u8> data) {
+    if (ctx->accel_key) {
+        ASSERT(data.size() == ctx->iv.size());
+        std::memcpy(ctx->iv.data(), data.data(), data.size());
+    }
     ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, data.data(), data.size()) ||
                 mbedtls_cipher_set_iv(&ctx->decryption_context, data.data(), data.size())) == 0,
                "Failed to set IV on mbedtls ciphers.");
@@ -1,6 +1,11 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/device_memory.h"
 #include "hle/kernel/board/nintendo/nx/k_system_control.h"
 
@@ -14,8 +19,31 @@ constexpr size_t VirtualReserveSize = 1ULL << 39;
 
 DeviceMemory::DeviceMemory()
     : buffer{Kernel::Board::Nintendo::Nx::KSystemControl::Init::GetIntendedMemorySize(),
-             VirtualReserveSize} {}
+             VirtualReserveSize, Settings::values.use_huge_pages.GetValue(),
+             Settings::values.prefault_memory.GetValue()} {
+    if (buffer.GetPages() == Common::HostMemoryPages::Standard) {
+        LOG_INFO(HW_Memory, "DRAM is backed by 4 KiB pages");
+    } else if (buffer.IsPrefaulted()) {
+        LOG_INFO(HW_Memory, "DRAM is backed by transparent huge pages, {} MiB mapped with them",
+                 buffer.GetHugePageMappedSize() >> 20);
+    } else {
+        LOG_INFO(HW_Memory, "DRAM is backed by transparent huge pages when the host allows it");
+    }
+    if (Settings::values.use_write_watch.GetValue() && buffer.EnableWriteWatch()) {
+        LOG_INFO(HW_Memory, "Writes to GPU cached memory are watched instead of trapped");
+    }
+}
 
-DeviceMemory::~DeviceMemory() = default;
+DeviceMemory::~DeviceMemory() {
+    const Common::ProtectStatistics stats = Common::HostMemory::GetProtectStatistics();
+    if (stats.requested > 0) {
+        LOG_INFO(HW_Memory, "Applied {} of {} requested fastmem protection changes",
+                 stats.issued, stats.requested);
+    }
+    if (const u64 discarded = Common::HostMemory::GetDiscardedBytes(); discarded > 0) {
+        LOG_INFO(HW_Memory, "Gave {} MiB of freed guest memory back to the host",
+                 discarded >> 20);
+    }
+}
 
 } // namespace Core
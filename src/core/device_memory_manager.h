@@ -9,6 +9,7 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <span>
 
 #include "common/common_types.h"
 #include "common/range_mutex.h"
@@ -107,6 +108,11 @@ public:
     u8* GetSpan(const DAddr src_addr, const std::size_t size);
     const u8* GetSpan(const DAddr src_addr, const std::size_t size) const;
 
+    /// Returns the host memory of the contiguous range starting at src_addr, up to size bytes.
+    /// The span is empty when src_addr is not mapped.
+    std::span<u8> GetLargestSpan(const DAddr src_addr, const std::size_t size);
+    std::span<const u8> GetLargestSpan(const DAddr src_addr, const std::size_t size) const;
+
     void ReadBlock(DAddr address, void* dest_pointer, size_t size);
     void ReadBlockUnsafe(DAddr address, void* dest_pointer, size_t size);
     void WriteBlock(DAddr address, const void* src_pointer, size_t size);
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -296,16 +299,18 @@ Loader::ResultStatus XCI::AddNCAFromPartition(XCIPartition part) {
         if (nca->IsUpdate()) {
             continue;
         }
-        if (nca->GetType() == NCAContentType::Program) {
-            program_nca_status = nca->GetStatus();
+        // The logo and other contents of these partitions are opened once something reads them.
+        const bool is_program = nca->GetType() == NCAContentType::Program;
+        const auto nca_status = is_program ? nca->GetStatus() : nca->GetHeaderStatus();
+        if (is_program) {
+            program_nca_status = nca_status;
         }
-        if (nca->GetStatus() == Loader::ResultStatus::Success) {
+        if (nca_status == Loader::ResultStatus::Success) {
             ncas.push_back(std::move(nca));
         } else {
-            const u16 error_id = static_cast<u16>(nca->GetStatus());
+            const u16 error_id = static_cast<u16>(nca_status);
             LOG_CRITICAL(Loader, "Could not load NCA {}/{}, failed with error code {:04X} ({})",
-                         partition_names[partition_index], nca->GetName(), error_id,
-                         nca->GetStatus());
+                         partition_names[partition_index], nca->GetName(), error_id, nca_status);
         }
     }
 
@@ -32,20 +32,20 @@ static u8 MasterKeyIdForKeyGeneration(u8 key_generation) {
 NCA::NCA(VirtualFile file_, const NCA* base_nca)
     : file(std::move(file_)), keys{Core::Crypto::KeyManager::Instance()} {
     if (file == nullptr) {
-        status = Loader::ResultStatus::ErrorNullFile;
+        header_status = Loader::ResultStatus::ErrorNullFile;
         return;
     }
 
     reader = std::make_shared<NcaReader>();
     if (Result rc = reader->Initialize(file, GetCryptoConfiguration(), GetNcaCompressionConfiguration()); R_FAILED(rc)) {
-        status = Loader::ResultStatus::ErrorBadNCAHeader;
+        header_status = Loader::ResultStatus::ErrorBadNCAHeader;
         return;
     }
 
     // Ensure we have the proper key area keys to continue.
     const u8 master_key_id = MasterKeyIdForKeyGeneration(reader->GetKeyGeneration());
     if (!keys.HasKey(Core::Crypto::S128KeyType::KeyArea, master_key_id, reader->GetKeyIndex())) {
-        status = Loader::ResultStatus::ErrorMissingKeyAreaKey;
+        header_status = Loader::ResultStatus::ErrorMissingKeyAreaKey;
         return;
     }
 
@@ -59,12 +59,12 @@ NCA::NCA(VirtualFile file_, const NCA* base_nca)
         auto titlekey =
             keys.GetKey(Core::Crypto::S128KeyType::Titlekey, rights_id_u128[1], rights_id_u128[0]);
         if (titlekey == Core::Crypto::Key128{}) {
-            status = Loader::ResultStatus::ErrorMissingTitlekey;
+            header_status = Loader::ResultStatus::ErrorMissingTitlekey;
             return;
         }
 
         if (!keys.HasKey(Core::Crypto::S128KeyType::Titlekek, master_key_id)) {
-            status = Loader::ResultStatus::ErrorMissingTitlekek;
+            header_status = Loader::ResultStatus::ErrorMissingTitlekek;
             return;
         }
 
@@ -76,54 +76,81 @@ NCA::NCA(VirtualFile file_, const NCA* base_nca)
         reader->SetExternalDecryptionKey(titlekey.data(), titlekey.size());
     }
 
+    // Patches are told apart by the encryption of their section headers, which are part of the
+    // NCA header. This keeps opening the storages until they are used.
     const s32 fs_count = reader->GetFsCount();
-    NcaFileSystemDriver fs(base_nca ? base_nca->reader : nullptr, reader);
-    std::vector<VirtualFile> filesystems(fs_count);
     for (s32 i = 0; i < fs_count; i++) {
         NcaFsHeaderReader header_reader;
-        if (Result rc = fs.OpenStorage(&filesystems[i], &header_reader, i); R_FAILED(rc)) {
-            status = Loader::ResultStatus::ErrorBadNCAHeader;
+        if (Result rc = header_reader.Initialize(*reader, i); R_FAILED(rc)) {
+            header_status = Loader::ResultStatus::ErrorBadNCAHeader;
             return;
         }
-
-        if (header_reader.GetFsType() == NcaFsHeader::FsType::RomFs) {
-            files.push_back(filesystems[i]);
-            romfs = files.back();
-        }
-
-        if (header_reader.GetFsType() == NcaFsHeader::FsType::PartitionFs) {
-            auto npfs = std::make_shared<PartitionFilesystem>(filesystems[i]);
-            if (npfs->GetStatus() == Loader::ResultStatus::Success) {
-                dirs.push_back(npfs);
-                if (IsDirectoryExeFS(npfs)) {
-                    exefs = dirs.back();
-                } else if (IsDirectoryLogoPartition(npfs)) {
-                    logo = dirs.back();
-                } else {
-                    continue;
-                }
-            }
-        }
-
         if (header_reader.GetEncryptionType() == NcaFsHeader::EncryptionType::AesCtrEx) {
             is_update = true;
         }
     }
 
+    if (base_nca != nullptr) {
+        base_reader = base_nca->reader;
+    }
     if (is_update && base_nca == nullptr) {
-        status = Loader::ResultStatus::ErrorMissingBKTRBaseRomFS;
+        header_status = Loader::ResultStatus::ErrorMissingBKTRBaseRomFS;
     } else {
-        status = Loader::ResultStatus::Success;
+        header_status = Loader::ResultStatus::Success;
     }
 }
 
 NCA::~NCA() = default;
 
+void NCA::OpenSections() const {
+    std::call_once(sections_opened, [this] {
+        status = header_status;
+        if (status != Loader::ResultStatus::Success &&
+            status != Loader::ResultStatus::ErrorMissingBKTRBaseRomFS) {
+            return;
+        }
+
+        const s32 fs_count = reader->GetFsCount();
+        NcaFileSystemDriver fs(base_reader, reader);
+        std::vector<VirtualFile> filesystems(fs_count);
+        for (s32 i = 0; i < fs_count; i++) {
+            NcaFsHeaderReader header_reader;
+            if (Result rc = fs.OpenStorage(&filesystems[i], &header_reader, i); R_FAILED(rc)) {
+                status = Loader::ResultStatus::ErrorBadNCAHeader;
+                return;
+            }
+
+            if (header_reader.GetFsType() == NcaFsHeader::FsType::RomFs) {
+                files.push_back(filesystems[i]);
+                romfs = files.back();
+            }
+
+            if (header_reader.GetFsType() == NcaFsHeader::FsType::PartitionFs) {
+                auto npfs = std::make_shared<PartitionFilesystem>(filesystems[i]);
+                if (npfs->GetStatus() == Loader::ResultStatus::Success) {
+                    dirs.push_back(npfs);
+                    if (IsDirectoryExeFS(npfs)) {
+                        exefs = dirs.back();
+                    } else if (IsDirectoryLogoPartition(npfs)) {
+                        logo = dirs.back();
+                    }
+                }
+            }
+        }
+    });
+}
+
 Loader::ResultStatus NCA::GetStatus() const {
+    OpenSections();
     return status;
 }
 
+Loader::ResultStatus NCA::GetHeaderStatus() const {
+    return header_status;
+}
+
 std::vector<VirtualFile> NCA::GetFiles() const {
+    OpenSections();
     if (status != Loader::ResultStatus::Success) {
         return {};
     }
@@ -131,6 +158,7 @@ std::vector<VirtualFile> NCA::GetFiles() const {
 }
 
 std::vector<VirtualDir> NCA::GetSubdirectories() const {
+    OpenSections();
     if (status != Loader::ResultStatus::Success) {
         return {};
     }
@@ -175,10 +203,12 @@ bool NCA::IsUpdate() const {
 }
 
 VirtualFile NCA::GetRomFS() const {
+    OpenSections();
     return romfs;
 }
 
 VirtualDir NCA::GetExeFS() const {
+    OpenSections();
     return exefs;
 }
 
@@ -187,6 +217,7 @@ VirtualFile NCA::GetBaseFile() const {
 }
 
 VirtualDir NCA::GetLogoPartition() const {
+    OpenSections();
     return logo;
 }
 
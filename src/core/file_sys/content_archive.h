@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -5,6 +8,7 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -61,12 +65,17 @@ inline bool IsDirectoryLogoPartition(const VirtualDir& pfs) {
 
 // An implementation of VfsDirectory that represents a Nintendo Content Archive (NCA) container.
 // After construction, use GetStatus to determine if the file is valid and ready to be used.
+// Only the header is read on construction, the sections are opened the first time they or the
+// status are queried.
 class NCA : public ReadOnlyVfsDirectory {
 public:
     explicit NCA(VirtualFile file, const NCA* base_nca = nullptr);
     ~NCA() override;
 
     Loader::ResultStatus GetStatus() const;
+    // Status of the header and keys, without opening the sections. Errors of the sections are
+    // only reported by GetStatus.
+    Loader::ResultStatus GetHeaderStatus() const;
 
     std::vector<VirtualFile> GetFiles() const override;
     std::vector<VirtualDir> GetSubdirectories() const override;
@@ -88,21 +97,26 @@ public:
     VirtualDir GetLogoPartition() const;
 
 private:
-    std::vector<VirtualDir> dirs;
-    std::vector<VirtualFile> files;
+    void OpenSections() const;
+
+    mutable std::once_flag sections_opened;
+    mutable std::vector<VirtualDir> dirs;
+    mutable std::vector<VirtualFile> files;
 
-    VirtualFile romfs = nullptr;
-    VirtualDir exefs = nullptr;
-    VirtualDir logo = nullptr;
+    mutable VirtualFile romfs = nullptr;
+    mutable VirtualDir exefs = nullptr;
+    mutable VirtualDir logo = nullptr;
     VirtualFile file;
 
-    Loader::ResultStatus status{};
+    Loader::ResultStatus header_status{};
+    mutable Loader::ResultStatus status{};
 
     bool encrypted = false;
     bool is_update = false;
 
     Core::Crypto::KeyManager& keys;
     std::shared_ptr<NcaReader> reader;
+    std::shared_ptr<NcaReader> base_reader;
 };
 
 } // namespace FileSys
@@ -1,9 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstring>
 #include <span>
 #include <string_view>
+#include <unordered_map>
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "core/file_sys/fsmitm_romfsbuild.h"
@@ -108,6 +112,22 @@ static u64 romfs_get_hash_table_count(u64 num_entries) {
 
 void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
                                        std::shared_ptr<RomFSBuildDirectoryContext> parent) {
+    // Index the extension directory once, every entry of the base directory is looked up in it
+    std::unordered_map<std::string, VirtualFile> ext_files;
+    std::unordered_map<std::string, VirtualDir> ext_subdirs;
+    if (ext_dir != nullptr) {
+        for (auto& ext_file : ext_dir->GetFiles()) {
+            ext_files.emplace(ext_file->GetName(), std::move(ext_file));
+        }
+        for (auto& ext_subdir : ext_dir->GetSubdirectories()) {
+            ext_subdirs.emplace(ext_subdir->GetName(), std::move(ext_subdir));
+        }
+    }
+    const auto find_ext_file = [&ext_files](const std::string& ext_name) -> VirtualFile {
+        const auto it = ext_files.find(ext_name);
+        return it != ext_files.end() ? it->second : nullptr;
+    };
+
     for (auto& child_romfs_file : romfs_dir->GetFiles()) {
         const auto name = child_romfs_file->GetName();
         const auto child = std::make_shared<RomFSBuildFileContext>();
@@ -116,7 +136,7 @@ void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
         child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
         child->path = parent->path + "/" + name;
 
-        if (ext_dir != nullptr && ext_dir->GetFile(name + ".stub") != nullptr) {
+        if (find_ext_file(name + ".stub") != nullptr) {
             continue;
         }
 
@@ -125,11 +145,9 @@ void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
 
         child->source = std::move(child_romfs_file);
 
-        if (ext_dir != nullptr) {
-            if (const auto ips = ext_dir->GetFile(name + ".ips")) {
-                if (auto patched = PatchIPS(child->source, ips)) {
-                    child->source = std::move(patched);
-                }
+        if (const auto ips = find_ext_file(name + ".ips")) {
+            if (auto patched = PatchIPS(child->source, ips)) {
+                child->source = std::move(patched);
             }
         }
 
@@ -146,7 +164,7 @@ void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
         child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
         child->path = parent->path + "/" + name;
 
-        if (ext_dir != nullptr && ext_dir->GetFile(name + ".stub") != nullptr) {
+        if (find_ext_file(name + ".stub") != nullptr) {
             continue;
         }
 
@@ -157,8 +175,9 @@ void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
             continue;
         }
 
-        auto child_ext_dir = ext_dir != nullptr ? ext_dir->GetSubdirectory(name) : nullptr;
-        this->VisitDirectory(child_romfs_dir, child_ext_dir, child);
+        const auto ext_it = ext_subdirs.find(name);
+        auto child_ext_dir = ext_it != ext_subdirs.end() ? ext_it->second : nullptr;
+        this->VisitDirectory(child_romfs_dir, std::move(child_ext_dir), child);
     }
 }
 
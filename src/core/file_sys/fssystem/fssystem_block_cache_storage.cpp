@@ -0,0 +1,304 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/div_ceil.h"
+#include "common/fs/fs.h"
+#include "common/hex_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FileSys {
+
+namespace {
+
+using namespace Common::Literals;
+
+class BlockCache {
+public:
+    /// Copies up to size bytes of a cached block, returns false if the block isn't cached.
+    bool Read(u64 id, u64 block, size_t offset, u8* buffer, size_t size, size_t* out_copied) {
+        std::scoped_lock lk{m_mutex};
+        const auto it = m_map.find(Key(id, block));
+        if (it == m_map.end()) {
+            return false;
+        }
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        *out_copied = CopyFrom(it->second->data, offset, buffer, size);
+        return true;
+    }
+
+    void Insert(u64 id, u64 block, std::vector<u8>&& data, size_t capacity) {
+        std::scoped_lock lk{m_mutex};
+        const u64 key = Key(id, block);
+        if (m_map.contains(key)) {
+            return;
+        }
+        m_size += data.size();
+        m_lru.push_front({key, id, std::move(data)});
+        m_map.emplace(key, m_lru.begin());
+        while (m_size > capacity && !m_lru.empty()) {
+            this->EvictLocked(std::prev(m_lru.end()));
+        }
+    }
+
+    void Erase(u64 id) {
+        std::scoped_lock lk{m_mutex};
+        for (auto it = m_lru.begin(); it != m_lru.end();) {
+            const auto next = std::next(it);
+            if (it->id == id) {
+                this->EvictLocked(it);
+            }
+            it = next;
+        }
+    }
+
+    static size_t CopyFrom(const std::vector<u8>& data, size_t offset, u8* buffer, size_t size) {
+        if (offset >= data.size()) {
+            return 0;
+        }
+        const size_t copied = (std::min)(size, data.size() - offset);
+        std::memcpy(buffer, data.data() + offset, copied);
+        return copied;
+    }
+
+private:
+    struct Entry {
+        u64 key;
+        u64 id;
+        std::vector<u8> data;
+    };
+
+    static u64 Key(u64 id, u64 block) {
+        // Storages are far smaller than 2^40 blocks, leaving room for the storage id.
+        return (id << 40) | block;
+    }
+
+    void EvictLocked(std::list<Entry>::iterator it) {
+        m_size -= it->data.size();
+        m_map.erase(it->key);
+        m_lru.erase(it);
+    }
+
+    std::mutex m_mutex;
+    std::list<Entry> m_lru;
+    std::unordered_map<u64, std::list<Entry>::iterator> m_map;
+    size_t m_size{};
+};
+
+BlockCache& GetBlockCache() {
+    static BlockCache cache;
+    return cache;
+}
+
+std::atomic<u64> g_next_id{1};
+
+} // namespace
+
+#ifndef _WIN32
+
+/**
+ * Blocks of one storage in <shared_nca_cache_dir>/<content hash>_<size>.blocks, at their offset in
+ * the storage. A bitmap of the published blocks is mapped from the .valid file next to it. A bit
+ * is only set once its block has been written, so a reader seeing it finds the whole block in the
+ * page cache. Processes may race to publish the same block, they write identical data.
+ */
+class BlockCacheStorage::SharedBlockStore {
+public:
+    static std::unique_ptr<SharedBlockStore> Open(const Hash& content_hash, u64 size) {
+        const std::string& dir = Settings::values.shared_nca_cache_dir.GetValue();
+        if (dir.empty() || size == 0 || !Common::FS::CreateDirs(dir)) {
+            return nullptr;
+        }
+        const std::string base_path =
+            fmt::format("{}/{}_{:x}", dir, Common::HexToString(content_hash.value, false), size);
+
+        const int data_fd = OpenSized(base_path + ".blocks", size);
+        if (data_fd == -1) {
+            return nullptr;
+        }
+        const u64 num_words = Common::DivCeil(Common::DivCeil(size, u64{BlockSize}), u64{32});
+        const size_t valid_size = static_cast<size_t>(num_words * sizeof(u32));
+        const int valid_fd = OpenSized(base_path + ".valid", valid_size);
+        if (valid_fd == -1) {
+            close(data_fd);
+            return nullptr;
+        }
+        void* const valid =
+            mmap(nullptr, valid_size, PROT_READ | PROT_WRITE, MAP_SHARED, valid_fd, 0);
+        close(valid_fd);
+        if (valid == MAP_FAILED) {
+            LOG_WARNING(Service_FS, "Failed to map {}.valid, errno {}", base_path, errno);
+            close(data_fd);
+            return nullptr;
+        }
+        return std::unique_ptr<SharedBlockStore>(
+            new SharedBlockStore(data_fd, static_cast<u32*>(valid), valid_size, size));
+    }
+
+    ~SharedBlockStore() {
+        munmap(m_valid, m_valid_size);
+        close(m_data_fd);
+    }
+
+    /// Reads a published block, returns false if no process has published it yet.
+    bool Read(u64 block, std::vector<u8>& out) const {
+        if ((ValidWord(block).load(std::memory_order_acquire) & ValidBit(block)) == 0) {
+            return false;
+        }
+        out.resize(BlockLength(block));
+        const ssize_t result =
+            pread(m_data_fd, out.data(), out.size(), static_cast<off_t>(block * BlockSize));
+        return result == static_cast<ssize_t>(out.size());
+    }
+
+    /// Publishes a block read from the storage, ignoring blocks cut short by a failed read.
+    void Write(u64 block, const std::vector<u8>& data) const {
+        if (data.size() != BlockLength(block)) {
+            return;
+        }
+        const ssize_t result =
+            pwrite(m_data_fd, data.data(), data.size(), static_cast<off_t>(block * BlockSize));
+        if (result == static_cast<ssize_t>(data.size())) {
+            ValidWord(block).fetch_or(ValidBit(block), std::memory_order_release);
+        }
+    }
+
+private:
+    SharedBlockStore(int data_fd, u32* valid, size_t valid_size, u64 size)
+        : m_data_fd{data_fd}, m_valid{valid}, m_valid_size{valid_size}, m_size{size} {}
+
+    /// Opens a file shared with other processes, growing it to size if a process hasn't yet.
+    static int OpenSized(const std::string& path, u64 size) {
+        const int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd == -1) {
+            LOG_WARNING(Service_FS, "Failed to open {}, errno {}", path, errno);
+            return -1;
+        }
+        struct stat info {};
+        const bool is_sized = fstat(fd, &info) == 0 &&
+                              (static_cast<u64>(info.st_size) >= size ||
+                               ftruncate(fd, static_cast<off_t>(size)) == 0);
+        if (!is_sized) {
+            LOG_WARNING(Service_FS, "Failed to size {}, errno {}", path, errno);
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    std::atomic_ref<u32> ValidWord(u64 block) const {
+        return std::atomic_ref<u32>{m_valid[block / 32]};
+    }
+
+    static u32 ValidBit(u64 block) {
+        return 1U << (block % 32);
+    }
+
+    size_t BlockLength(u64 block) const {
+        return static_cast<size_t>((std::min)(u64{BlockSize}, m_size - block * BlockSize));
+    }
+
+    int m_data_fd;
+    u32* m_valid;
+    size_t m_valid_size;
+    u64 m_size;
+};
+
+#else
+
+class BlockCacheStorage::SharedBlockStore {
+public:
+    static std::unique_ptr<SharedBlockStore> Open(const Hash&, u64) {
+        if (!Settings::values.shared_nca_cache_dir.GetValue().empty()) {
+            LOG_WARNING(Service_FS, "Shared NCA caches aren't supported on this platform");
+        }
+        return nullptr;
+    }
+
+    bool Read(u64, std::vector<u8>&) const {
+        return false;
+    }
+
+    void Write(u64, const std::vector<u8>&) const {}
+};
+
+#endif
+
+BlockCacheStorage::BlockCacheStorage(VirtualFile base, std::optional<Hash> content_hash)
+    : m_base_storage(std::move(base)), m_id(g_next_id++) {
+    if (content_hash) {
+        m_shared_store = SharedBlockStore::Open(*content_hash, m_base_storage->GetSize());
+    }
+}
+
+BlockCacheStorage::~BlockCacheStorage() {
+    GetBlockCache().Erase(m_id);
+}
+
+size_t BlockCacheStorage::Read(u8* buffer, size_t size, size_t offset) const {
+    const size_t capacity =
+        static_cast<size_t>(Settings::values.nca_block_cache_size.GetValue()) * 1_MiB;
+    if (capacity == 0 && !m_shared_store) {
+        return m_base_storage->Read(buffer, size, offset);
+    }
+
+    auto& cache = GetBlockCache();
+    size_t read = 0;
+    while (read < size) {
+        const size_t position = offset + read;
+        const u64 block = position / BlockSize;
+        const size_t block_offset = position % BlockSize;
+
+        size_t copied = 0;
+        if (capacity == 0 ||
+            !cache.Read(m_id, block, block_offset, buffer + read, size - read, &copied)) {
+            std::vector<u8> data = this->LoadBlock(block);
+            copied = BlockCache::CopyFrom(data, block_offset, buffer + read, size - read);
+            if (capacity != 0) {
+                cache.Insert(m_id, block, std::move(data), capacity);
+            }
+        }
+        if (copied == 0) {
+            // Reached the end of the storage.
+            break;
+        }
+        read += copied;
+    }
+    return read;
+}
+
+std::vector<u8> BlockCacheStorage::LoadBlock(u64 block) const {
+    std::vector<u8> data;
+    if (m_shared_store && m_shared_store->Read(block, data)) {
+        return data;
+    }
+    data.resize(BlockSize);
+    data.resize(m_base_storage->Read(data.data(), BlockSize, block * BlockSize));
+    if (m_shared_store) {
+        m_shared_store->Write(block, data);
+    }
+    return data;
+}
+
+size_t BlockCacheStorage::GetSize() const {
+    return m_base_storage->GetSize();
+}
+
+} // namespace FileSys
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "core/file_sys/fssystem/fs_i_storage.h"
+#include "core/file_sys/fssystem/fssystem_nca_header.h"
+
+namespace FileSys {
+
+/**
+ * Keeps the most recently read blocks of a storage in memory, so repeated reads of the same
+ * region skip the decryption and verification layers below it. Blocks of every cached storage
+ * share one LRU list, bounded by the nca_block_cache_size setting (in MiB).
+ *
+ * When the shared_nca_cache_dir setting names a directory and the content hash of the storage is
+ * known, blocks missing from memory are also published to files in that directory. Every instance
+ * reading the same content then shares the host page cache of those files, and only the first one
+ * pays for decrypting and verifying a block.
+ */
+class BlockCacheStorage : public IReadOnlyStorage {
+    YUZU_NON_COPYABLE(BlockCacheStorage);
+    YUZU_NON_MOVEABLE(BlockCacheStorage);
+
+public:
+    static constexpr size_t BlockSize = 0x10000;
+
+public:
+    explicit BlockCacheStorage(VirtualFile base, std::optional<Hash> content_hash = std::nullopt);
+    ~BlockCacheStorage() override;
+
+    virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
+    virtual size_t GetSize() const override;
+
+private:
+    class SharedBlockStore;
+
+    std::vector<u8> LoadBlock(u64 block) const;
+
+    VirtualFile m_base_storage;
+    std::unique_ptr<SharedBlockStore> m_shared_store;
+    u64 m_id;
+};
+
+} // namespace FileSys
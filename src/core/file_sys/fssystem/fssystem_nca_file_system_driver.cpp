@@ -8,6 +8,7 @@
 #include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
 #include "core/file_sys/fssystem/fssystem_aes_xts_storage.h"
 #include "core/file_sys/fssystem/fssystem_alignment_matching_storage.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
 #include "core/file_sys/fssystem/fssystem_compressed_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_integrity_verification_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_sha256_storage.h"
@@ -320,6 +321,14 @@ Result NcaFileSystemDriver::CreateStorageByRawStorage(VirtualFile* out,
         R_THROW(ResultInvalidNcaFsHeaderHashType);
     }
 
+    // Cache the decrypted and verified data, the master hash identifies it across processes.
+    const auto& hash_data = header_reader->GetHashData();
+    const Hash& master_hash =
+        header_reader->GetHashType() == NcaFsHeader::HashType::HierarchicalIntegrityHash
+            ? hash_data.integrity_meta_info.master_hash
+            : hash_data.hierarchical_sha256_data.fs_data_master_hash;
+    storage = std::make_shared<BlockCacheStorage>(std::move(storage), master_hash);
+    R_UNLESS(storage != nullptr, ResultAllocationMemoryFailedAllocateShared);
 
     // Process compression layer.
     if (header_reader->ExistsCompressionLayer()) {
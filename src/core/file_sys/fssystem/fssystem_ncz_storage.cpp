@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/div_ceil.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/thread_pool.h"
+#include "common/zstd_compression.h"
+#include "core/crypto/aes_util.h"
+#include "core/file_sys/fssystem/fssystem_nca_header.h"
+#include "core/file_sys/fssystem/fssystem_ncz_storage.h"
+
+namespace FileSys {
+
+namespace {
+
+using namespace Common::Literals;
+
+constexpr std::array<char, 8> SectionMagic{'N', 'C', 'Z', 'S', 'E', 'C', 'T', 'N'};
+constexpr std::array<char, 8> BlockMagic{'N', 'C', 'Z', 'B', 'L', 'O', 'C', 'K'};
+
+/// Sanity limit, an NCA has at most four sections
+constexpr u64 MaxSections = 0x100;
+
+constexpr u32 MinBlockSizeExponent = 14;
+constexpr u32 MaxBlockSizeExponent = 32;
+
+/// Memory the decompressed blocks of one storage are allowed to keep
+constexpr size_t CacheSize = 16_MiB;
+
+struct SectionTableHeader {
+    std::array<char, 8> magic;
+    u64 section_count;
+};
+static_assert(sizeof(SectionTableHeader) == 0x10);
+
+struct BlockHeader {
+    std::array<char, 8> magic;
+    u8 version;
+    u8 type;
+    u8 unused;
+    u8 block_size_exponent;
+    u32 block_count;
+    u64 decompressed_size;
+};
+static_assert(sizeof(BlockHeader) == 0x18);
+
+bool IsEncrypted(u64 crypto_type) {
+    using EncryptionType = NcaFsHeader::EncryptionType;
+    return crypto_type == static_cast<u64>(EncryptionType::AesCtr) ||
+           crypto_type == static_cast<u64>(EncryptionType::AesCtrEx);
+}
+
+} // Anonymous namespace
+
+std::shared_ptr<NczStorage> NczStorage::Open(VirtualFile base, std::string name) {
+    SectionTableHeader table{};
+    if (base->ReadObject(&table, HeaderSize) != sizeof(table) || table.magic != SectionMagic ||
+        table.section_count > MaxSections) {
+        LOG_ERROR(Service_FS, "{} is not a valid NCZ", name);
+        return nullptr;
+    }
+    size_t offset = HeaderSize + sizeof(SectionTableHeader);
+    std::vector<Section> sections(table.section_count);
+    const size_t sections_size = sections.size() * sizeof(Section);
+    if (base->Read(reinterpret_cast<u8*>(sections.data()), sections_size, offset) !=
+        sections_size) {
+        LOG_ERROR(Service_FS, "{} has a truncated NCZ section table", name);
+        return nullptr;
+    }
+    offset += sections_size;
+
+    BlockHeader header{};
+    if (base->ReadObject(&header, offset) != sizeof(header) || header.magic != BlockMagic) {
+        // Solid streams can only be read from the start, which NCA accesses can't live with
+        LOG_ERROR(Service_FS, "{} is a solid NCZ, only block compressed NCZs can be loaded", name);
+        return nullptr;
+    }
+    const u32 exponent = header.block_size_exponent;
+    if (exponent < MinBlockSizeExponent || exponent > MaxBlockSizeExponent ||
+        header.block_count != Common::DivCeil(header.decompressed_size, u64{1} << exponent)) {
+        LOG_ERROR(Service_FS, "{} has an invalid NCZ block header", name);
+        return nullptr;
+    }
+    offset += sizeof(BlockHeader);
+
+    std::vector<u32> compressed_sizes(header.block_count);
+    const size_t sizes_size = compressed_sizes.size() * sizeof(u32);
+    if (base->Read(reinterpret_cast<u8*>(compressed_sizes.data()), sizes_size, offset) !=
+        sizes_size) {
+        LOG_ERROR(Service_FS, "{} has a truncated NCZ block table", name);
+        return nullptr;
+    }
+    offset += sizes_size;
+
+    std::vector<u64> block_offsets;
+    block_offsets.reserve(compressed_sizes.size() + 1);
+    block_offsets.push_back(offset);
+    for (const u32 compressed_size : compressed_sizes) {
+        block_offsets.push_back(block_offsets.back() + compressed_size);
+    }
+    if (block_offsets.back() > base->GetSize()) {
+        LOG_ERROR(Service_FS, "{} is a truncated NCZ", name);
+        return nullptr;
+    }
+    return std::shared_ptr<NczStorage>(new NczStorage(std::move(base), std::move(name),
+                                                      std::move(sections), exponent,
+                                                      header.decompressed_size,
+                                                      std::move(block_offsets)));
+}
+
+NczStorage::NczStorage(VirtualFile base, std::string name, std::vector<Section> sections,
+                       u32 block_size_exponent, u64 decompressed_size,
+                       std::vector<u64> block_offsets)
+    : m_base(std::move(base)), m_name(std::move(name)), m_sections(std::move(sections)),
+      m_block_size_exponent(block_size_exponent), m_decompressed_size(decompressed_size),
+      m_block_offsets(std::move(block_offsets)),
+      m_max_cached_blocks((std::max)(CacheSize >> block_size_exponent, size_t{2})) {}
+
+NczStorage::~NczStorage() = default;
+
+size_t NczStorage::Read(u8* buffer, size_t size, size_t offset) const {
+    const size_t total_size = this->GetSize();
+    if (offset >= total_size) {
+        return 0;
+    }
+    size = (std::min)(size, total_size - offset);
+
+    size_t read = 0;
+    if (offset < HeaderSize) {
+        const size_t header_size = (std::min)(size, HeaderSize - offset);
+        read = m_base->Read(buffer, header_size, offset);
+        if (read != header_size) {
+            return read;
+        }
+    }
+    if (read == size) {
+        return read;
+    }
+
+    const u64 body_offset = offset + read - HeaderSize;
+    const u64 first = body_offset >> m_block_size_exponent;
+    const u64 last = (body_offset + (size - read) - 1) >> m_block_size_exponent;
+    const std::vector<Block> blocks = this->GetBlocks(first, last);
+    for (u64 index = first; index <= last; ++index) {
+        const Block& block = blocks[index - first];
+        if (!block) {
+            break;
+        }
+        const u64 position = offset + read - HeaderSize;
+        const size_t block_offset = position - (index << m_block_size_exponent);
+        const size_t copied = (std::min)(size - read, block->size() - block_offset);
+        std::memcpy(buffer + read, block->data() + block_offset, copied);
+        read += copied;
+    }
+    return read;
+}
+
+size_t NczStorage::GetSize() const {
+    return HeaderSize + m_decompressed_size;
+}
+
+std::string NczStorage::GetName() const {
+    return m_name;
+}
+
+std::vector<NczStorage::Block> NczStorage::GetBlocks(u64 first, u64 last) const {
+    std::vector<Block> blocks(last - first + 1);
+    std::vector<u64> missing;
+    {
+        std::scoped_lock lk{m_mutex};
+        for (u64 index = first; index <= last; ++index) {
+            const auto it = m_cache.find(index);
+            if (it == m_cache.end()) {
+                missing.push_back(index);
+                continue;
+            }
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            blocks[index - first] = it->second->data;
+        }
+    }
+    if (missing.empty()) {
+        return blocks;
+    }
+
+    this->DecompressBlocks(missing, first, blocks);
+
+    std::scoped_lock lk{m_mutex};
+    for (const u64 index : missing) {
+        const Block& block = blocks[index - first];
+        if (!block || m_cache.contains(index)) {
+            continue;
+        }
+        m_lru.push_front({index, block});
+        m_cache.emplace(index, m_lru.begin());
+        if (m_lru.size() > m_max_cached_blocks) {
+            m_cache.erase(m_lru.back().index);
+            m_lru.pop_back();
+        }
+    }
+    return blocks;
+}
+
+void NczStorage::DecompressBlocks(std::span<const u64> indices, u64 first,
+                                  std::vector<Block>& out_blocks) const {
+    // Read the compressed data at once, the blocks in between that are cached are skipped later
+    const u64 compressed_begin = m_block_offsets[indices.front()];
+    const u64 compressed_end = m_block_offsets[indices.back() + 1];
+    std::vector<u8> compressed(compressed_end - compressed_begin);
+    if (m_base->Read(compressed.data(), compressed.size(), compressed_begin) !=
+        compressed.size()) {
+        LOG_ERROR(Service_FS, "Failed to read the compressed blocks of {}", m_name);
+        return;
+    }
+    const auto decompress = [&](u64 index) {
+        const std::span<const u8> block_data{
+            compressed.data() + (m_block_offsets[index] - compressed_begin),
+            m_block_offsets[index + 1] - m_block_offsets[index]};
+        out_blocks[index - first] = this->DecompressBlock(index, block_data);
+    };
+    if (indices.size() == 1) {
+        decompress(indices.front());
+        return;
+    }
+    auto& pool = Common::ThreadPool::Shared(Common::CoreType::Any);
+    Common::PooledWorker worker{pool, pool.NumThreads()};
+    for (const u64 index : indices) {
+        worker.QueueWork([&decompress, index] { decompress(index); });
+    }
+    worker.WaitForRequests();
+}
+
+NczStorage::Block NczStorage::DecompressBlock(u64 index, std::span<const u8> compressed) const {
+    auto data = std::make_shared<std::vector<u8>>(this->DecompressedBlockSize(index));
+    if (compressed.size() < data->size()) {
+        const size_t decompressed_size = Common::Compression::DecompressDataZSTD(
+            data->data(), data->size(), compressed.data(), compressed.size());
+        if (decompressed_size != data->size()) {
+            LOG_ERROR(Service_FS, "Failed to decompress block {} of {}", index, m_name);
+            return nullptr;
+        }
+    } else if (compressed.size() == data->size()) {
+        // Blocks that don't shrink are stored as is
+        std::memcpy(data->data(), compressed.data(), data->size());
+    } else {
+        LOG_ERROR(Service_FS, "Block {} of {} is larger than its decompressed size", index,
+                  m_name);
+        return nullptr;
+    }
+    this->EncryptSections(*data, HeaderSize + (index << m_block_size_exponent));
+    return data;
+}
+
+void NczStorage::EncryptSections(std::span<u8> data, u64 offset) const {
+    const u64 end = offset + data.size();
+    for (const Section& section : m_sections) {
+        const u64 section_begin = (std::max)(offset, section.offset);
+        const u64 section_end = (std::min)(end, section.offset + section.size);
+        if (section_begin >= section_end || !IsEncrypted(section.crypto_type)) {
+            continue;
+        }
+        // The counter of an NCA section holds the offset of the AES block in its low half
+        std::array<u8, 0x10> iv = section.counter;
+        u64 ctr = section_begin >> 4;
+        for (size_t i = 0; i < 8; ++i) {
+            iv[iv.size() - i - 1] = static_cast<u8>(ctr & 0xFF);
+            ctr >>= 8;
+        }
+        Core::Crypto::AESCipher<std::array<u8, 0x10>> cipher(section.key,
+                                                             Core::Crypto::Mode::CTR);
+        cipher.SetIV(iv);
+        u8* const section_data = data.data() + (section_begin - offset);
+        cipher.Transcode(section_data, section_end - section_begin, section_data,
+                         Core::Crypto::Op::Encrypt);
+    }
+}
+
+size_t NczStorage::DecompressedBlockSize(u64 index) const {
+    const u64 block_size = u64{1} << m_block_size_exponent;
+    return static_cast<size_t>(
+        (std::min)(block_size, m_decompressed_size - (index << m_block_size_exponent)));
+}
+
+} // namespace FileSys
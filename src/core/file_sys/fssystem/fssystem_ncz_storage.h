@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/file_sys/fssystem/fs_i_storage.h"
+
+namespace FileSys {
+
+/**
+ * Presents an NCZ, the block compressed NCA found in NSZ and XCZ files, as the NCA it was made
+ * from. Blocks are decompressed on demand, reads spanning several blocks decompress them in
+ * parallel, and the sections that were decrypted before compression are encrypted again. The
+ * most recently read blocks are kept decompressed.
+ */
+class NczStorage : public IReadOnlyStorage {
+    YUZU_NON_COPYABLE(NczStorage);
+    YUZU_NON_MOVEABLE(NczStorage);
+
+public:
+    /// Size of the NCA header stored as is at the start of an NCZ
+    static constexpr size_t HeaderSize = 0x4000;
+
+    /// Returns nullptr if the file is not a block compressed NCZ.
+    [[nodiscard]] static std::shared_ptr<NczStorage> Open(VirtualFile base, std::string name);
+
+    ~NczStorage() override;
+
+    virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
+    virtual size_t GetSize() const override;
+    virtual std::string GetName() const override;
+
+private:
+    struct Section {
+        u64 offset;
+        u64 size;
+        u64 crypto_type;
+        u64 padding;
+        std::array<u8, 0x10> key;
+        std::array<u8, 0x10> counter;
+    };
+    static_assert(sizeof(Section) == 0x40);
+
+    using Block = std::shared_ptr<const std::vector<u8>>;
+
+    struct CachedBlock {
+        u64 index;
+        Block data;
+    };
+
+    explicit NczStorage(VirtualFile base, std::string name, std::vector<Section> sections,
+                        u32 block_size_exponent, u64 decompressed_size,
+                        std::vector<u64> block_offsets);
+
+    /// Returns the blocks in [first, last], a null block means it failed to decompress.
+    std::vector<Block> GetBlocks(u64 first, u64 last) const;
+
+    /// Decompresses the given blocks into their place in out_blocks, starting at first.
+    void DecompressBlocks(std::span<const u64> indices, u64 first,
+                          std::vector<Block>& out_blocks) const;
+
+    Block DecompressBlock(u64 index, std::span<const u8> compressed) const;
+
+    /// Encrypts the sections of a decompressed block again, offset is relative to the NCA.
+    void EncryptSections(std::span<u8> data, u64 offset) const;
+
+    size_t DecompressedBlockSize(u64 index) const;
+
+    VirtualFile m_base;
+    std::string m_name;
+    std::vector<Section> m_sections;
+    u32 m_block_size_exponent;
+    u64 m_decompressed_size;
+    /// Offset of every compressed block in the base file, followed by the end of the last one
+    std::vector<u64> m_block_offsets;
+    size_t m_max_cached_blocks;
+
+    mutable std::mutex m_mutex;
+    mutable std::list<CachedBlock> m_lru;
+    mutable std::unordered_map<u64, std::list<CachedBlock>::iterator> m_cache;
+};
+
+} // namespace FileSys
@@ -8,13 +8,12 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <mutex>
 
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
-#ifndef _WIN32
 #include "common/string_util.h"
-#endif
 
 #include "core/core.h"
 #include "core/file_sys/common_funcs.h"
@@ -82,6 +81,16 @@ VirtualDir FindSubdirectoryCaseless(const VirtualDir dir, std::string_view name)
 #endif
 }
 
+// Version of FindSubdirectoryCaseless for a directory whose subdirectories were already listed.
+VirtualDir FindSubdirectoryCaseless(const std::vector<VirtualDir>& subdirs, std::string_view name) {
+    for (const auto& subdir : subdirs) {
+        if (Common::ToLower(subdir->GetName()) == name) {
+            return subdir;
+        }
+    }
+    return nullptr;
+}
+
 std::optional<std::vector<Core::Memory::CheatEntry>> ReadCheatFileFromFolder(
     u64 title_id, const PatchManager::BuildID& build_id_, const VirtualDir& base_path, bool upper) {
     const auto build_id_raw = Common::HexToString(build_id_, upper);
@@ -119,10 +128,25 @@ bool IsDirValidAndNonEmpty(const VirtualDir& dir) {
 }
 } // Anonymous namespace
 
+struct PatchManager::NSOPatch {
+    VirtualFile file;
+    std::string mod_name;
+    /// Build ID the patch applies to, as hex padded to 64 digits
+    std::string build_id;
+    /// Parsed IPSwitch patch, null for IPS patches
+    std::shared_ptr<const IPSwitchCompiler> ipswitch;
+};
+
+struct PatchManager::NSOPatchCache {
+    std::once_flag scanned;
+    std::vector<NSOPatch> patches;
+};
+
 PatchManager::PatchManager(u64 title_id_,
                            const Service::FileSystem::FileSystemController& fs_controller_,
                            const ContentProvider& content_provider_)
-    : title_id{title_id_}, fs_controller{fs_controller_}, content_provider{content_provider_} {}
+    : title_id{title_id_}, fs_controller{fs_controller_}, content_provider{content_provider_},
+      nso_patch_cache{std::make_shared<NSOPatchCache>()} {}
 
 PatchManager::~PatchManager() = default;
 
@@ -193,41 +217,49 @@ VirtualDir PatchManager::PatchExeFS(VirtualDir exefs) const {
     return exefs;
 }
 
-std::vector<VirtualFile> PatchManager::CollectPatches(const std::vector<VirtualDir>& patch_dirs,
-                                                      const std::string& build_id) const {
-    const auto& disabled = Settings::values.disabled_addons[title_id];
-    const auto nso_build_id = fmt::format("{:0<64}", build_id);
+const std::vector<PatchManager::NSOPatch>& PatchManager::GetNSOPatches() const {
+    std::call_once(nso_patch_cache->scanned, [this] {
+        const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
+        if (load_dir == nullptr) {
+            LOG_ERROR(Loader, "Cannot load mods for invalid title_id={:016X}", title_id);
+            return;
+        }
 
-    std::vector<VirtualFile> out;
-    out.reserve(patch_dirs.size());
-    for (const auto& subdir : patch_dirs) {
-        if (std::find(disabled.cbegin(), disabled.cend(), subdir->GetName()) != disabled.cend())
-            continue;
+        auto patch_dirs = load_dir->GetSubdirectories();
+        std::sort(patch_dirs.begin(), patch_dirs.end(),
+                  [](const VirtualDir& l, const VirtualDir& r) {
+                      return l->GetName() < r->GetName();
+                  });
+
+        const auto& disabled = Settings::values.disabled_addons[title_id];
+        auto& out = nso_patch_cache->patches;
+        for (const auto& subdir : patch_dirs) {
+            auto mod_name = subdir->GetName();
+            if (std::find(disabled.cbegin(), disabled.cend(), mod_name) != disabled.cend())
+                continue;
 
-        auto exefs_dir = FindSubdirectoryCaseless(subdir, "exefs");
-        if (exefs_dir != nullptr) {
-            for (const auto& file : exefs_dir->GetFiles()) {
-                if (file->GetExtension() == "ips") {
-                    auto name = file->GetName();
+            auto exefs_dir = FindSubdirectoryCaseless(subdir, "exefs");
+            if (exefs_dir == nullptr)
+                continue;
 
-                    const auto this_build_id =
-                        fmt::format("{:0<64}", name.substr(0, name.find('.')));
-                    if (nso_build_id == this_build_id)
-                        out.push_back(file);
+            for (auto& file : exefs_dir->GetFiles()) {
+                if (file->GetExtension() == "ips") {
+                    const auto name = file->GetName();
+                    auto build_id = fmt::format("{:0<64}", name.substr(0, name.find('.')));
+                    out.push_back({std::move(file), mod_name, std::move(build_id), nullptr});
                 } else if (file->GetExtension() == "pchtxt") {
-                    IPSwitchCompiler compiler{file};
-                    if (!compiler.IsValid())
+                    auto compiler = std::make_shared<const IPSwitchCompiler>(file);
+                    if (!compiler->IsValid())
                         continue;
 
-                    const auto this_build_id = Common::HexToString(compiler.GetBuildID());
-                    if (nso_build_id == this_build_id)
-                        out.push_back(file);
+                    auto build_id = Common::HexToString(compiler->GetBuildID());
+                    out.push_back(
+                        {std::move(file), mod_name, std::move(build_id), std::move(compiler)});
                 }
             }
         }
-    }
-
-    return out;
+    });
+    return nso_patch_cache->patches;
 }
 
 std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::string& name) const {
@@ -260,30 +292,21 @@ std::vector<u8> PatchManager::PatchNSO(const std::vector<u8>& nso, const std::st
 
     LOG_INFO(Loader, "Patching NSO for name={}, build_id={}", name, build_id);
 
-    const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
-    if (load_dir == nullptr) {
-        LOG_ERROR(Loader, "Cannot load mods for invalid title_id={:016X}", title_id);
-        return nso;
-    }
-
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-    const auto patches = CollectPatches(patch_dirs, build_id);
+    const auto nso_build_id = fmt::format("{:0<64}", build_id);
 
     auto out = nso;
-    for (const auto& patch_file : patches) {
-        if (patch_file->GetExtension() == "ips") {
-            LOG_INFO(Loader, "    - Applying IPS patch from mod \"{}\"",
-                     patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const auto patched = PatchIPS(std::make_shared<VectorVfsFile>(out), patch_file);
+    for (const auto& patch : GetNSOPatches()) {
+        if (patch.build_id != nso_build_id)
+            continue;
+
+        if (patch.ipswitch == nullptr) {
+            LOG_INFO(Loader, "    - Applying IPS patch from mod \"{}\"", patch.mod_name);
+            const auto patched = PatchIPS(std::make_shared<VectorVfsFile>(out), patch.file);
             if (patched != nullptr)
                 out = patched->ReadAllBytes();
-        } else if (patch_file->GetExtension() == "pchtxt") {
-            LOG_INFO(Loader, "    - Applying IPSwitch patch from mod \"{}\"",
-                     patch_file->GetContainingDirectory()->GetParentDirectory()->GetName());
-            const IPSwitchCompiler compiler{patch_file};
-            const auto patched = compiler.Apply(std::make_shared<VectorVfsFile>(out));
+        } else {
+            LOG_INFO(Loader, "    - Applying IPSwitch patch from mod \"{}\"", patch.mod_name);
+            const auto patched = patch.ipswitch->Apply(std::make_shared<VectorVfsFile>(out));
             if (patched != nullptr)
                 out = patched->ReadAllBytes();
         }
@@ -303,17 +326,11 @@ bool PatchManager::HasNSOPatch(const BuildID& build_id_, std::string_view name)
 
     LOG_INFO(Loader, "Querying NSO patch existence for build_id={}, name={}", build_id, name);
 
-    const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
-    if (load_dir == nullptr) {
-        LOG_ERROR(Loader, "Cannot load mods for invalid title_id={:016X}", title_id);
-        return false;
-    }
-
-    auto patch_dirs = load_dir->GetSubdirectories();
-    std::sort(patch_dirs.begin(), patch_dirs.end(),
-              [](const VirtualDir& l, const VirtualDir& r) { return l->GetName() < r->GetName(); });
-
-    return !CollectPatches(patch_dirs, build_id).empty();
+    const auto nso_build_id = fmt::format("{:0<64}", build_id);
+    const auto& patches = GetNSOPatches();
+    return std::any_of(patches.begin(), patches.end(), [&nso_build_id](const NSOPatch& patch) {
+        return patch.build_id == nso_build_id;
+    });
 }
 
 std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(const BuildID& build_id_) const {
@@ -527,8 +544,9 @@ std::vector<Patch> PatchManager::GetPatches(VirtualFile update_raw) const {
     if (mod_dir != nullptr) {
         for (const auto& mod : mod_dir->GetSubdirectories()) {
             std::string types;
+            const auto mod_subdirs = mod->GetSubdirectories();
 
-            const auto exefs_dir = FindSubdirectoryCaseless(mod, "exefs");
+            const auto exefs_dir = FindSubdirectoryCaseless(mod_subdirs, "exefs");
             if (IsDirValidAndNonEmpty(exefs_dir)) {
                 bool ips = false;
                 bool ipswitch = false;
@@ -552,10 +570,10 @@ std::vector<Patch> PatchManager::GetPatches(VirtualFile update_raw) const {
                 if (layeredfs)
                     AppendCommaIfNotEmpty(types, "LayeredExeFS");
             }
-            if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod, "romfs")) ||
-                IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod, "romfslite")))
+            if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod_subdirs, "romfs")) ||
+                IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod_subdirs, "romfslite")))
                 AppendCommaIfNotEmpty(types, "LayeredFS");
-            if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod, "cheats")))
+            if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(mod_subdirs, "cheats")))
                 AppendCommaIfNotEmpty(types, "Cheats");
 
             if (types.empty())
@@ -576,11 +594,12 @@ std::vector<Patch> PatchManager::GetPatches(VirtualFile update_raw) const {
     const auto sdmc_mod_dir = fs_controller.GetSDMCModificationLoadRoot(title_id);
     if (sdmc_mod_dir != nullptr) {
         std::string types;
-        if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(sdmc_mod_dir, "exefs"))) {
+        const auto sdmc_subdirs = sdmc_mod_dir->GetSubdirectories();
+        if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(sdmc_subdirs, "exefs"))) {
             AppendCommaIfNotEmpty(types, "LayeredExeFS");
         }
-        if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(sdmc_mod_dir, "romfs")) ||
-            IsDirValidAndNonEmpty(FindSubdirectoryCaseless(sdmc_mod_dir, "romfslite"))) {
+        if (IsDirValidAndNonEmpty(FindSubdirectoryCaseless(sdmc_subdirs, "romfs")) ||
+            IsDirValidAndNonEmpty(FindSubdirectoryCaseless(sdmc_subdirs, "romfslite"))) {
             AppendCommaIfNotEmpty(types, "LayeredFS");
         }
 
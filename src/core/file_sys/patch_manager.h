@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -92,12 +95,17 @@ public:
     [[nodiscard]] Metadata ParseControlNCA(const NCA& nca) const;
 
 private:
-    [[nodiscard]] std::vector<VirtualFile> CollectPatches(const std::vector<VirtualDir>& patch_dirs,
-                                                          const std::string& build_id) const;
+    struct NSOPatch;
+    struct NSOPatchCache;
+
+    // Returns the IPS and IPSwitch patches of the enabled mods, in the order they are applied.
+    // The mods are scanned once, the result is shared by the copies of this manager.
+    [[nodiscard]] const std::vector<NSOPatch>& GetNSOPatches() const;
 
     u64 title_id;
     const Service::FileSystem::FileSystemController& fs_controller;
     const ContentProvider& content_provider;
+    std::shared_ptr<NSOPatchCache> nso_patch_cache;
 };
 
 } // namespace FileSys
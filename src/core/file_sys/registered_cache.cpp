@@ -5,14 +5,18 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <atomic>
 #include <random>
 #include <regex>
+#include <thread>
 #include <mbedtls/sha256.h>
 #include "common/assert.h"
+#include "common/bounded_threadsafe_queue.h"
 #include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/virtual_buffer.h"
 #include "core/crypto/key_manager.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/common_funcs.h"
@@ -28,6 +32,9 @@ namespace FileSys {
 // The size of blocks to use when vfs raw copying into nand.
 constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
 
+// The number of blocks in flight in VfsPipelinedCopy, enough for each stage to have one.
+constexpr size_t NUM_PIPELINED_COPY_BLOCKS = 4;
+
 std::string ContentProviderEntry::DebugInfo() const {
     return fmt::format("title_id={:016X}, content_type={:02X}", title_id, static_cast<u8>(type));
 }
@@ -117,6 +124,99 @@ ContentRecordType GetCRTypeFromNCAType(NCAContentType type) {
     }
 }
 
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest, size_t block_size,
+                      Core::Crypto::SHA256Hash* hash, const VfsCopyProgressCallback& progress) {
+    if (src == nullptr || dest == nullptr || !src->IsReadable() || !dest->IsWritable()) {
+        return false;
+    }
+    const size_t total_size = src->GetSize();
+    if (!dest->Resize(total_size)) {
+        return false;
+    }
+
+    struct CopyBlock {
+        size_t index;
+        size_t offset;
+        size_t size; ///< Zero once the reader is done
+    };
+    const size_t buffer_size = std::max<size_t>(std::min(block_size, total_size), 1);
+    std::array<Common::VirtualBuffer<u8>, NUM_PIPELINED_COPY_BLOCKS> buffers;
+    Common::SPSCQueue<size_t, NUM_PIPELINED_COPY_BLOCKS> free_blocks;
+    for (size_t i = 0; i < NUM_PIPELINED_COPY_BLOCKS; ++i) {
+        buffers[i] = Common::VirtualBuffer<u8>(buffer_size);
+        free_blocks.EmplaceWait(i);
+    }
+    Common::SPSCQueue<CopyBlock, NUM_PIPELINED_COPY_BLOCKS> read_blocks;
+    Common::SPSCQueue<CopyBlock, NUM_PIPELINED_COPY_BLOCKS> hashed_blocks;
+    std::atomic_bool write_failed{};
+
+    // Blocks go from the reader to the hasher, when there is one, then to the writer.
+    std::jthread hasher;
+    if (hash != nullptr) {
+        hasher = std::jthread([&] {
+            mbedtls_sha256_context ctx;
+            mbedtls_sha256_init(&ctx);
+            mbedtls_sha256_starts(&ctx, 0);
+            while (true) {
+                const CopyBlock block = read_blocks.PopWait();
+                if (block.size == 0) {
+                    mbedtls_sha256_finish(&ctx, hash->data());
+                    mbedtls_sha256_free(&ctx);
+                    hashed_blocks.EmplaceWait(block);
+                    return;
+                }
+                mbedtls_sha256_update(&ctx, buffers[block.index].data(), block.size);
+                hashed_blocks.EmplaceWait(block);
+            }
+        });
+    }
+    auto& write_blocks = hash != nullptr ? hashed_blocks : read_blocks;
+    std::jthread writer([&] {
+        while (true) {
+            const CopyBlock block = write_blocks.PopWait();
+            if (block.size == 0) {
+                return;
+            }
+            if (!write_failed &&
+                dest->Write(buffers[block.index].data(), block.size, block.offset) != block.size) {
+                write_failed = true;
+            }
+            free_blocks.EmplaceWait(block.index);
+        }
+    });
+
+    bool success = true;
+    bool cancelled = false;
+    for (size_t offset = 0; offset < total_size; offset += buffer_size) {
+        if (write_failed) {
+            success = false;
+            break;
+        }
+        if (progress && progress(total_size, offset)) {
+            success = false;
+            cancelled = true;
+            break;
+        }
+        const size_t index = free_blocks.PopWait();
+        const size_t size = std::min(buffer_size, total_size - offset);
+        if (src->Read(buffers[index].data(), size, offset) != size) {
+            success = false;
+            break;
+        }
+        read_blocks.EmplaceWait(CopyBlock{index, offset, size});
+    }
+    read_blocks.EmplaceWait(CopyBlock{0, 0, 0});
+    if (hasher.joinable()) {
+        hasher.join();
+    }
+    writer.join();
+
+    if (cancelled) {
+        dest->Resize(0);
+    }
+    return success && !write_failed;
+}
+
 ContentProvider::~ContentProvider() = default;
 
 bool ContentProvider::HasEntry(ContentProviderEntry entry) const {
@@ -207,7 +307,7 @@ bool PlaceholderCache::Register(RegisteredCache* cache, const NcaID& placeholder
     if (file == nullptr)
         return false;
 
-    const auto res = cache->RawInstallNCA(NCA{file}, &VfsRawCopy, false, install);
+    const auto res = cache->RawInstallNCA(NCA{file}, {}, false, install);
 
     if (res != InstallResult::Success)
         return false;
@@ -636,7 +736,8 @@ InstallResult RegisteredCache::InstallEntry(const NSP& nsp, bool overwrite_if_ex
             }
             continue;
         }
-        const auto nca_result = RawInstallNCA(*nca, copy, overwrite_if_exists, record.nca_id);
+        const auto nca_result =
+            RawInstallNCA(*nca, copy, overwrite_if_exists, record.nca_id, &record.hash);
         if (nca_result != InstallResult::Success) {
             return nca_result;
         }
@@ -699,7 +800,7 @@ InstallResult RegisteredCache::InstallEntry(const NCA& nca, const CNMTHeader& ba
     if (!RawInstallYuzuMeta(new_cnmt)) {
         return InstallResult::ErrorMetaFailed;
     }
-    return RawInstallNCA(nca, copy, overwrite_if_exists, base_record.nca_id);
+    return RawInstallNCA(nca, copy, overwrite_if_exists, base_record.nca_id, &base_record.hash);
 }
 
 bool RegisteredCache::RemoveExistingEntry(u64 title_id) const {
@@ -766,7 +867,8 @@ bool RegisteredCache::RemoveExistingEntry(u64 title_id) const {
 
 InstallResult RegisteredCache::RawInstallNCA(const NCA& nca, const VfsCopyFunction& copy,
                                              bool overwrite_if_exists,
-                                             std::optional<NcaID> override_id) {
+                                             std::optional<NcaID> override_id,
+                                             const Core::Crypto::SHA256Hash* expected_hash) {
     const auto in = nca.GetBaseFile();
     Core::Crypto::SHA256Hash hash{};
 
@@ -801,8 +903,20 @@ InstallResult RegisteredCache::RawInstallNCA(const NCA& nca, const VfsCopyFuncti
     if (out == nullptr) {
         return InstallResult::ErrorCopyFailed;
     }
-    return copy(in, out, VFS_RC_LARGE_COPY_BLOCK) ? InstallResult::Success
-                                                  : InstallResult::ErrorCopyFailed;
+    // The hash is computed while copying, so it doesn't need another pass over the NCA.
+    Core::Crypto::SHA256Hash copied_hash{};
+    Core::Crypto::SHA256Hash* const out_hash = expected_hash != nullptr ? &copied_hash : nullptr;
+    const bool copied = copy ? copy(in, out, VFS_RC_LARGE_COPY_BLOCK, out_hash)
+                             : VfsPipelinedCopy(in, out, VFS_RC_LARGE_COPY_BLOCK, out_hash);
+    if (!copied) {
+        return InstallResult::ErrorCopyFailed;
+    }
+    if (expected_hash != nullptr && copied_hash != *expected_hash) {
+        // Dumps with modified NCAs still install, "Verify installed contents" reports them
+        LOG_WARNING(Loader, "NCA {} doesn't match the hash of its content record",
+                    Common::HexToString(id, false));
+    }
+    return InstallResult::Success;
 }
 
 bool RegisteredCache::RawInstallYuzuMeta(const CNMT& cnmt) {
@@ -30,7 +30,18 @@ class RegisteredCache;
 
 using NcaID = std::array<u8, 0x10>;
 using ContentProviderParsingFunction = std::function<VirtualFile(const VirtualFile&, const NcaID&)>;
-using VfsCopyFunction = std::function<bool(const VirtualFile&, const VirtualFile&, size_t)>;
+// Copies the whole source file to the destination. When the hash isn't null, it must receive the
+// SHA-256 of the copied data.
+using VfsCopyFunction = std::function<bool(const VirtualFile& src, const VirtualFile& dest,
+                                           size_t block_size, Core::Crypto::SHA256Hash* hash)>;
+using VfsCopyProgressCallback = std::function<bool(size_t total_size, size_t copied_size)>;
+
+// Copies a file like VfsRawCopy, but the next blocks are read while the previous ones are hashed
+// and written on worker threads. The progress callback runs on the calling thread before each
+// block, returning true from it cancels the copy and truncates the destination.
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest, size_t block_size,
+                      Core::Crypto::SHA256Hash* hash = nullptr,
+                      const VfsCopyProgressCallback& progress = {});
 
 enum class InstallResult {
     Success,
@@ -157,22 +168,23 @@ public:
         std::optional<u64> title_id = {}) const override;
 
     // Raw copies all the ncas from the xci/nsp to the csache. Does some quick checks to make sure
-    // there is a meta NCA and all of them are accessible.
+    // there is a meta NCA and all of them are accessible. The NCAs are checked against the hashes
+    // of the CNMT while they are copied. An empty copy function uses VfsPipelinedCopy.
     InstallResult InstallEntry(const XCI& xci, bool overwrite_if_exists = false,
-                               const VfsCopyFunction& copy = &VfsRawCopy);
+                               const VfsCopyFunction& copy = {});
     InstallResult InstallEntry(const NSP& nsp, bool overwrite_if_exists = false,
-                               const VfsCopyFunction& copy = &VfsRawCopy);
+                               const VfsCopyFunction& copy = {});
 
     // Due to the fact that we must use Meta-type NCAs to determine the existence of files, this
     // poses quite a challenge. Instead of creating a new meta NCA for this file, yuzu will create a
     // dir inside the NAND called 'yuzu_meta' and store the raw CNMT there.
     // TODO(DarkLordZach): Author real meta-type NCAs and install those.
     InstallResult InstallEntry(const NCA& nca, TitleType type, bool overwrite_if_exists = false,
-                               const VfsCopyFunction& copy = &VfsRawCopy);
+                               const VfsCopyFunction& copy = {});
 
     InstallResult InstallEntry(const NCA& nca, const CNMTHeader& base_header,
                                const ContentRecord& base_record, bool overwrite_if_exists = false,
-                               const VfsCopyFunction& copy = &VfsRawCopy);
+                               const VfsCopyFunction& copy = {});
 
     // Removes an existing entry based on title id
     bool RemoveExistingEntry(u64 title_id) const;
@@ -189,7 +201,8 @@ private:
     VirtualFile GetFileAtID(NcaID id) const;
     VirtualFile OpenFileOrDirectoryConcat(const VirtualDir& open_dir, std::string_view path) const;
     InstallResult RawInstallNCA(const NCA& nca, const VfsCopyFunction& copy,
-                                bool overwrite_if_exists, std::optional<NcaID> override_id = {});
+                                bool overwrite_if_exists, std::optional<NcaID> override_id = {},
+                                const Core::Crypto::SHA256Hash* expected_hash = nullptr);
     bool RawInstallYuzuMeta(const CNMT& cnmt);
 
     VirtualDir dir;
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -10,6 +13,7 @@
 #include "common/logging/log.h"
 #include "core/crypto/key_manager.h"
 #include "core/file_sys/content_archive.h"
+#include "core/file_sys/fssystem/fssystem_ncz_storage.h"
 #include "core/file_sys/nca_metadata.h"
 #include "core/file_sys/partition_filesystem.h"
 #include "core/file_sys/program_metadata.h"
@@ -239,6 +243,13 @@ void NSP::ReadNCAs(const std::vector<VirtualFile>& files) {
             for (const auto& rec : cnmt.GetContentRecords()) {
                 const auto id_string = Common::HexToString(rec.nca_id, false);
                 auto next_file = pfs->GetFile(fmt::format("{}.nca", id_string));
+                if (next_file == nullptr) {
+                    // NSZ and XCZ files hold compressed NCAs
+                    if (auto ncz_file = pfs->GetFile(fmt::format("{}.ncz", id_string))) {
+                        next_file = NczStorage::Open(std::move(ncz_file),
+                                                     fmt::format("{}.nca", id_string));
+                    }
+                }
 
                 if (next_file == nullptr) {
                     if (rec.type != ContentRecordType::DeltaFragment) {
@@ -253,20 +264,25 @@ void NSP::ReadNCAs(const std::vector<VirtualFile>& files) {
 
                 auto next_nca = std::make_shared<NCA>(std::move(next_file));
 
-                if (next_nca->GetType() == NCAContentType::Program) {
-                    program_status[next_nca->GetTitleId()] = next_nca->GetStatus();
+                // Only the program is opened now, the sections of the other contents (manuals,
+                // control data, add-ons) are opened once something reads them.
+                const bool is_program = next_nca->GetType() == NCAContentType::Program;
+                const auto nca_status =
+                    is_program ? next_nca->GetStatus() : next_nca->GetHeaderStatus();
+                if (is_program) {
+                    program_status[next_nca->GetTitleId()] = nca_status;
                     program_ids.insert(next_nca->GetTitleId() & 0xFFFFFFFFFFFFF000);
                 }
 
-                if (next_nca->GetStatus() != Loader::ResultStatus::Success &&
-                    next_nca->GetStatus() != Loader::ResultStatus::ErrorMissingBKTRBaseRomFS) {
+                if (nca_status != Loader::ResultStatus::Success &&
+                    nca_status != Loader::ResultStatus::ErrorMissingBKTRBaseRomFS) {
                     continue;
                 }
 
                 // If the last 3 hexadecimal digits of the CNMT TitleID is 0x800 or is missing the
                 // BKTRBaseRomFS, this is an update NCA. Otherwise, this is a base NCA.
                 if ((cnmt.GetTitleID() & 0x800) != 0 ||
-                    next_nca->GetStatus() == Loader::ResultStatus::ErrorMissingBKTRBaseRomFS) {
+                    nca_status == Loader::ResultStatus::ErrorMissingBKTRBaseRomFS) {
                     // If the last 3 hexadecimal digits of the NCA's TitleID is between 0x1 and
                     // 0x7FF, this is a multi-program update NCA. Otherwise, this is a regular
                     // update NCA.
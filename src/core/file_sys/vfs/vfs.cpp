@@ -194,6 +194,10 @@ std::size_t VfsFile::WriteBytes(const std::vector<u8>& data, std::size_t offset)
     return Write(data.data(), data.size(), offset);
 }
 
+bool VfsFile::Flush() {
+    return true;
+}
+
 std::string VfsFile::GetFullPath() const {
     if (GetContainingDirectory() == nullptr)
         return '/' + GetName();
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -176,6 +179,9 @@ public:
 
     // Renames the file to name. Returns whether or not the operation was successful.
     virtual bool Rename(std::string_view name) = 0;
+    // Hands the data written to the file so far to the host. Returns whether or not the operation
+    // was successful.
+    virtual bool Flush();
 
     // Returns the full path of this file as a string, recursively
     virtual std::string GetFullPath() const;
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -22,7 +25,7 @@ bool ConcatenatedVfsFile::VerifyContinuity() const {
             return false;
         }
 
-        last_offset = entry.offset + entry.file->GetSize();
+        last_offset = entry.offset + entry.size;
     }
 
     return true;
@@ -48,8 +51,14 @@ VirtualFile ConcatenatedVfsFile::MakeConcatenatedFile(std::string&& name,
     for (auto& file : files) {
         const auto size = file->GetSize();
 
+        // Empty parts would share their offset with the next one.
+        if (size == 0) {
+            continue;
+        }
+
         concatenation_map.emplace_back(ConcatenationEntry{
             .offset = last_offset,
+            .size = size,
             .file = std::move(file),
         });
 
@@ -82,14 +91,18 @@ VirtualFile ConcatenatedVfsFile::MakeConcatenatedFile(
         if (offset > last_offset) {
             concatenation_map.emplace_back(ConcatenationEntry{
                 .offset = last_offset,
+                .size = offset - last_offset,
                 .file = std::make_shared<StaticVfsFile>(filler_byte, offset - last_offset),
             });
         }
 
-        concatenation_map.emplace_back(ConcatenationEntry{
-            .offset = offset,
-            .file = std::move(file),
-        });
+        if (size != 0) {
+            concatenation_map.emplace_back(ConcatenationEntry{
+                .offset = offset,
+                .size = size,
+                .file = std::move(file),
+            });
+        }
 
         last_offset = offset + size;
     }
@@ -111,7 +124,7 @@ std::size_t ConcatenatedVfsFile::GetSize() const {
     if (concatenation_map.empty()) {
         return 0;
     }
-    return concatenation_map.back().offset + concatenation_map.back().file->GetSize();
+    return concatenation_map.back().offset + concatenation_map.back().size;
 }
 
 bool ConcatenatedVfsFile::Resize(std::size_t new_size) {
@@ -136,6 +149,7 @@ bool ConcatenatedVfsFile::IsReadable() const {
 std::size_t ConcatenatedVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
     const ConcatenationEntry key{
         .offset = offset,
+        .size = 0,
         .file = nullptr,
     };
 
@@ -154,9 +168,9 @@ std::size_t ConcatenatedVfsFile::Read(u8* data, std::size_t length, std::size_t
         // Check if we can read the file at this position.
         const auto& file = it->file;
         const u64 map_offset = it->offset;
-        const u64 file_size = file->GetSize();
+        const u64 file_size = it->size;
 
-        if (cur_offset > map_offset + file_size) {
+        if (cur_offset >= map_offset + file_size) {
             // Entirely out of bounds read.
             break;
         }
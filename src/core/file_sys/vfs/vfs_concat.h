@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -11,11 +14,12 @@
 namespace FileSys {
 
 // Class that wraps multiple vfs files and concatenates them, making reads seamless. Currently
-// read-only.
+// read-only. The sizes of the parts are sampled on construction, they must not change afterwards.
 class ConcatenatedVfsFile : public VfsFile {
 private:
     struct ConcatenationEntry {
         u64 offset;
+        u64 size;
         VirtualFile file;
 
         auto operator<=>(const ConcatenationEntry& other) const {
@@ -11,8 +11,11 @@
 #include "common/assert.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
 #include "common/fs/path_util.h"
+#include "common/literals.h"
 #include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/file_sys/vfs/vfs.h"
 #include "core/file_sys/vfs/vfs_real.h"
 
@@ -33,8 +36,13 @@ namespace FS = Common::FS;
 
 namespace {
 
+using namespace Common::Literals;
+
 constexpr size_t MaxOpenFiles = 512;
 
+// Game images and other large files are mapped, small ones gain little from it.
+constexpr size_t MinMappedFileSize = 16_MiB;
+
 constexpr FS::FileAccessMode ModeFlagsToFileAccessMode(OpenMode mode) {
     switch (mode) {
     case OpenMode::Read:
@@ -318,6 +326,9 @@ bool RealVfsFile::IsReadable() const {
 }
 
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    if (const auto* const mapped = GetMapping()) {
+        return mapped->Read(data, length, offset);
+    }
     auto lk = base.RefreshReference(path, perms, *reference);
     if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
         return 0;
@@ -334,10 +345,28 @@ std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t o
     return reference->file->WriteSpan(std::span{data, length});
 }
 
+const FS::MappedFile* RealVfsFile::GetMapping() const {
+    // Writable files could be resized under the mapping, they are always read through the file.
+    if (perms != OpenMode::Read || !Settings::values.mapped_file_reads.GetValue()) {
+        return nullptr;
+    }
+    std::call_once(mapping_flag, [this] {
+        if (GetSize() >= MinMappedFileSize) {
+            mapping = FS::MappedFile::Open(path);
+        }
+    });
+    return mapping.get();
+}
+
 bool RealVfsFile::Rename(std::string_view name) {
     return base.MoveFile(path, parent_path + '/' + std::string(name)) != nullptr;
 }
 
+bool RealVfsFile::Flush() {
+    auto lk = base.RefreshReference(path, perms, *reference);
+    return reference->file ? reference->file->Flush() : false;
+}
+
 // TODO(DarkLordZach): MSVC would not let me combine the following two functions using 'if
 // constexpr' because there is a compile error in the branch not used.
 
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -59,7 +62,7 @@ private:
     Result WaitIfEqual(uint64_t addr, s32 value, s64 timeout);
 
 private:
-    ThreadTree m_tree;
+    KConditionVariable::ThreadTreeBuckets m_trees;
     Core::System& m_system;
     KernelCore& m_kernel;
 };
@@ -249,12 +249,13 @@ void KConditionVariable::Signal(u64 cv_key, s32 count) {
     {
         KScopedSchedulerLock sl(m_kernel);
 
-        auto it = m_tree.nfind_key({cv_key, -1});
-        while ((it != m_tree.end()) && (count <= 0 || num_waiters < count) &&
+        ThreadTree& tree = m_trees.Get(cv_key);
+        auto it = tree.nfind_key({cv_key, -1});
+        while ((it != tree.end()) && (count <= 0 || num_waiters < count) &&
                (it->GetConditionVariableKey() == cv_key)) {
             KThread* target_thread = std::addressof(*it);
 
-            it = m_tree.erase(it);
+            it = tree.erase(it);
             target_thread->ClearConditionVariable();
 
             this->SignalImpl(target_thread);
@@ -263,7 +264,7 @@ void KConditionVariable::Signal(u64 cv_key, s32 count) {
         }
 
         // If we have no waiters, clear the has waiter flag.
-        if (it == m_tree.end() || it->GetConditionVariableKey() != cv_key) {
+        if (it == tree.end() || it->GetConditionVariableKey() != cv_key) {
             constexpr u32 HasNoWaiterFlag = 0;
             WriteToUser(m_kernel, cv_key, HasNoWaiterFlag);
         }
@@ -274,8 +275,9 @@ Result KConditionVariable::Wait(KProcessAddress addr, u64 key, u32 value, s64 ti
     // Prepare to wait.
     KThread* cur_thread = GetCurrentThreadPointer(m_kernel);
     KHardwareTimer* timer{};
+    ThreadTree& tree = m_trees.Get(key);
     ThreadQueueImplForKConditionVariableWaitConditionVariable wait_queue(m_kernel,
-                                                                         std::addressof(m_tree));
+                                                                         std::addressof(tree));
 
     {
         KScopedSchedulerLockAndSleep slp(m_kernel, std::addressof(timer), cur_thread, timeout);
@@ -324,8 +326,8 @@ Result KConditionVariable::Wait(KProcessAddress addr, u64 key, u32 value, s64 ti
         R_UNLESS(timeout != 0, ResultTimedOut);
 
         // Update condition variable tracking.
-        cur_thread->SetConditionVariable(std::addressof(m_tree), addr, key, value);
-        m_tree.insert(*cur_thread);
+        cur_thread->SetConditionVariable(std::addressof(tree), addr, key, value);
+        tree.insert(*cur_thread);
 
         // Begin waiting.
         wait_queue.SetHardwareTimer(timer);
@@ -1,8 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
+
 #include "common/assert.h"
 
 #include "core/hle/kernel/k_scheduler.h"
@@ -21,6 +26,20 @@ class KConditionVariable {
 public:
     using ThreadTree = typename KThread::ConditionVariableThreadTreeType;
 
+    /// Waiting threads split across trees by key, so signaling a key only walks the threads
+    /// waiting on keys that share its bucket. Each thread keeps a pointer to its own tree.
+    class ThreadTreeBuckets {
+    public:
+        ThreadTree& Get(u64 key) {
+            return m_trees[((key >> 2) ^ (key >> 12)) % NumBuckets];
+        }
+
+    private:
+        static constexpr size_t NumBuckets = 16;
+
+        std::array<ThreadTree, NumBuckets> m_trees{};
+    };
+
     explicit KConditionVariable(Core::System& system);
     ~KConditionVariable();
 
@@ -39,7 +58,7 @@ private:
 private:
     Core::System& m_system;
     KernelCore& m_kernel;
-    ThreadTree m_tree{};
+    ThreadTreeBuckets m_trees{};
 };
 
 inline void BeforeUpdatePriority(KernelCore& kernel, KConditionVariable::ThreadTree* tree,
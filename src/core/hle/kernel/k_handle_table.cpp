@@ -17,11 +17,16 @@ void KHandleTable::Finalize() {
         KScopedSpinLock lk(m_lock);
 
         std::swap(m_table_size, saved_table_size);
+
+        // Stop lock-free lookups from finding the entries.
+        for (size_t i = 0; i < saved_table_size; i++) {
+            m_linear_ids[i].store(0, std::memory_order_relaxed);
+        }
     }
 
     // Close and free all entries.
     for (size_t i = 0; i < saved_table_size; i++) {
-        if (KAutoObject* obj = m_objects[i]; obj != nullptr) {
+        if (KAutoObject* obj = m_objects[i].load(std::memory_order_relaxed); obj != nullptr) {
             obj->Close();
         }
     }
@@ -48,7 +53,7 @@ bool KHandleTable::Remove(Handle handle) {
         if (this->IsValidHandle(handle)) [[likely]] {
             const auto index = handle_pack.index;
 
-            obj = m_objects[index];
+            obj = m_objects[index].load(std::memory_order_relaxed);
             this->FreeEntry(index);
         } else {
             return false;
@@ -73,10 +78,8 @@ Result KHandleTable::Add(Handle* out_handle, KAutoObject* obj) {
         const auto linear_id = this->AllocateLinearId();
         const auto index = this->AllocateEntry();
 
-        m_entry_infos[index].linear_id = linear_id;
-        m_objects[index] = obj;
-
         obj->Open();
+        this->SetEntry(index, linear_id, obj);
 
         *out_handle = EncodeHandle(static_cast<u16>(index), linear_id);
     }
@@ -125,7 +128,7 @@ void KHandleTable::Unreserve(Handle handle) {
 
     if (index < m_table_size) [[likely]] {
         // NOTE: This code does not check the linear id.
-        ASSERT(m_objects[index] == nullptr);
+        ASSERT(m_objects[index].load(std::memory_order_relaxed) == nullptr);
         this->FreeEntry(index);
     }
 }
@@ -144,12 +147,10 @@ void KHandleTable::Register(Handle handle, KAutoObject* obj) {
 
     if (index < m_table_size) [[likely]] {
         // Set the entry.
-        ASSERT(m_objects[index] == nullptr);
-
-        m_entry_infos[index].linear_id = static_cast<u16>(linear_id);
-        m_objects[index] = obj;
+        ASSERT(m_objects[index].load(std::memory_order_relaxed) == nullptr);
 
         obj->Open();
+        this->SetEntry(index, static_cast<u16>(linear_id), obj);
     }
 }
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 
 #include "common/assert.h"
 #include "common/bit_field.h"
@@ -50,7 +51,8 @@ public:
 
         // Free all entries.
         for (s32 i = 0; i < static_cast<s32>(m_table_size); ++i) {
-            m_objects[i] = nullptr;
+            m_linear_ids[i].store(0, std::memory_order_relaxed);
+            m_objects[i].store(nullptr, std::memory_order_release);
             m_entry_infos[i].next_free_index = static_cast<s16>(i - 1);
             m_free_head_index = i;
         }
@@ -73,19 +75,8 @@ public:
 
     template <typename T = KAutoObject>
     KScopedAutoObject<T> GetObjectWithoutPseudoHandle(Handle handle) const {
-        // Lock and look up in table.
-        KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
-
-        if constexpr (std::is_same_v<T, KAutoObject>) {
-            return this->GetObjectImpl(handle);
-        } else {
-            if (auto* obj = this->GetObjectImpl(handle); obj != nullptr) [[likely]] {
-                return obj->DynamicCast<T*>();
-            } else {
-                return nullptr;
-            }
-        }
+        // Look up in table, converting to the requested type.
+        return KScopedAutoObject<T>(this->GetObjectLockFree(handle));
     }
 
     template <typename T = KAutoObject>
@@ -109,11 +100,7 @@ public:
     }
 
     KScopedAutoObject<KAutoObject> GetObjectForIpcWithoutPseudoHandle(Handle handle) const {
-        // Lock and look up in table.
-        KScopedDisableDispatch dd{m_kernel};
-        KScopedSpinLock lk(m_lock);
-
-        return this->GetObjectImpl(handle);
+        return this->GetObjectLockFree(handle);
     }
 
     KScopedAutoObject<KAutoObject> GetObjectForIpc(Handle handle, KThread* cur_thread) const;
@@ -135,30 +122,15 @@ public:
     bool GetMultipleObjects(T** out, const Handle* handles, size_t num_handles) const {
         // Try to convert and open all the handles.
         size_t num_opened;
-        {
-            // Lock the table.
-            KScopedDisableDispatch dd{m_kernel};
-            KScopedSpinLock lk(m_lock);
-            for (num_opened = 0; num_opened < num_handles; num_opened++) {
-                // Get the current handle.
-                const auto cur_handle = handles[num_opened];
-
-                // Get the object for the current handle.
-                KAutoObject* cur_object = this->GetObjectImpl(cur_handle);
-                if (cur_object == nullptr) [[unlikely]] {
-                    break;
-                }
-
-                // Cast the current object to the desired type.
-                T* cur_t = cur_object->DynamicCast<T*>();
-                if (cur_t == nullptr) [[unlikely]] {
-                    break;
-                }
-
-                // Open a reference to the current object.
-                cur_t->Open();
-                out[num_opened] = cur_t;
+        for (num_opened = 0; num_opened < num_handles; num_opened++) {
+            // Get the object for the current handle, cast to the desired type.
+            KScopedAutoObject<T> cur_t(this->GetObjectLockFree(handles[num_opened]));
+            if (cur_t.IsNull()) [[unlikely]] {
+                break;
             }
+
+            // Keep the reference to the current object.
+            out[num_opened] = cur_t.ReleasePointerUnsafe();
         }
 
         // If we converted every object, succeed.
@@ -187,10 +159,20 @@ private:
         return index;
     }
 
+    void SetEntry(s32 index, u16 linear_id, KAutoObject* obj) {
+        m_entry_infos[index].linear_id = linear_id;
+
+        // Publish the object before the linear id lock-free lookups validate it with.
+        m_objects[index].store(obj, std::memory_order_relaxed);
+        m_linear_ids[index].store(linear_id, std::memory_order_release);
+    }
+
     void FreeEntry(s32 index) {
         ASSERT(m_count > 0);
 
-        m_objects[index] = nullptr;
+        // Invalidate the linear id before the object lock-free lookups read.
+        m_linear_ids[index].store(0, std::memory_order_relaxed);
+        m_objects[index].store(nullptr, std::memory_order_release);
         m_entry_infos[index].next_free_index = static_cast<s16>(m_free_head_index);
 
         m_free_head_index = index;
@@ -227,7 +209,7 @@ private:
         }
 
         // Check that there's an object, and our serial id is correct.
-        if (m_objects[index] == nullptr) [[unlikely]] {
+        if (m_objects[index].load(std::memory_order_relaxed) == nullptr) [[unlikely]] {
             return false;
         }
         if (m_entry_infos[index].GetLinearId() != linear_id) [[unlikely]] {
@@ -245,12 +227,56 @@ private:
         }
 
         if (this->IsValidHandle(handle)) [[likely]] {
-            return m_objects[handle_pack.index];
+            return m_objects[handle_pack.index].load(std::memory_order_relaxed);
         } else {
             return nullptr;
         }
     }
 
+    /// Opens the object of a handle without taking the lock. The linear id of an entry is only
+    /// set while it holds an object, so an unchanged id around reading and opening the object
+    /// proves it still belongs to the handle. Objects live in slab heaps that are never unmapped,
+    /// which keeps opening one that was freed in the meantime safe.
+    KScopedAutoObject<KAutoObject> GetObjectLockFree(Handle handle) const {
+        // Handles must not have reserved bits set.
+        const auto handle_pack = HandlePack(handle);
+        const u16 linear_id = static_cast<u16>(handle_pack.linear_id.Value());
+        const size_t index = handle_pack.index;
+        if (handle_pack.reserved != 0 || linear_id == 0 || index >= MaxTableSize) [[unlikely]] {
+            return nullptr;
+        }
+
+        // Read the object, checking the entry wasn't replaced meanwhile.
+        const auto& entry_linear_id = m_linear_ids[index];
+        if (entry_linear_id.load(std::memory_order_acquire) != linear_id) [[unlikely]] {
+            return nullptr;
+        }
+        KAutoObject* const obj = m_objects[index].load(std::memory_order_acquire);
+        if (obj == nullptr) [[unlikely]] {
+            return nullptr;
+        }
+        if (entry_linear_id.load(std::memory_order_relaxed) != linear_id) [[unlikely]] {
+            return nullptr;
+        }
+
+        // Open the object unless it's being destroyed, then check the handle still refers to it,
+        // as its memory may have been reused for another object.
+        if (!obj->Open()) [[unlikely]] {
+            return nullptr;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (entry_linear_id.load(std::memory_order_relaxed) != linear_id ||
+            m_objects[index].load(std::memory_order_relaxed) != obj) [[unlikely]] {
+            obj->Close();
+            return nullptr;
+        }
+
+        // Hand the reference we opened over to the scoped object.
+        KScopedAutoObject<KAutoObject> result(obj);
+        obj->Close();
+        return result;
+    }
+
     KAutoObject* GetObjectByIndexImpl(Handle* out_handle, size_t index) const {
         // Index must be in bounds.
         if (index >= m_table_size) [[unlikely]] {
@@ -258,7 +284,7 @@ private:
         }
 
         // Ensure entry has an object.
-        if (KAutoObject* obj = m_objects[index]; obj != nullptr) {
+        if (KAutoObject* obj = m_objects[index].load(std::memory_order_relaxed); obj != nullptr) {
             *out_handle = EncodeHandle(static_cast<u16>(index), m_entry_infos[index].GetLinearId());
             return obj;
         } else {
@@ -304,7 +330,8 @@ private:
 private:
     KernelCore& m_kernel;
     std::array<EntryInfo, MaxTableSize> m_entry_infos{};
-    std::array<KAutoObject*, MaxTableSize> m_objects{};
+    std::array<std::atomic<KAutoObject*>, MaxTableSize> m_objects{};
+    std::array<std::atomic<u16>, MaxTableSize> m_linear_ids{}; ///< Zero while an entry is empty
     mutable KSpinLock m_lock;
     s32 m_free_head_index{};
     u16 m_table_size{};
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -37,6 +40,7 @@ void KMemoryBlockManager::Finalize(KMemoryBlockSlabManager* slab_manager,
         block_callback(block->GetAddress(), block->GetSize());
         slab_manager->Free(block);
     }
+    m_find_hint = m_memory_block_tree.end();
 
     ASSERT(m_memory_block_tree.empty());
 }
@@ -100,6 +104,7 @@ void KMemoryBlockManager::CoalesceForUpdate(KMemoryBlockManagerUpdateAllocator*
             prev->Add(*block);
             allocator->Free(block);
             it = prev;
+            m_find_hint = prev;
         }
 
         if (address + num_pages * PageSize < it->GetMemoryInfo().GetEndAddress()) {
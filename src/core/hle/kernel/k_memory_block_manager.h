@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -5,6 +8,7 @@
 
 #include <array>
 #include <functional>
+#include <iterator>
 
 #include "common/common_funcs.h"
 #include "core/hle/kernel/k_dynamic_resource_manager.h"
@@ -122,8 +126,21 @@ public:
                          size_t num_pages, KMemoryAttribute mask, KMemoryAttribute attr);
 
     iterator FindIterator(KProcessAddress address) const {
-        return m_memory_block_tree.find(KMemoryBlock(
+        // Walks over the address space look up neighbouring blocks, so the block found last and
+        // the one after it are checked before searching the tree.
+        if (m_find_hint != m_memory_block_tree.end()) {
+            if (ContainsAddress(*m_find_hint, address)) {
+                return m_find_hint;
+            }
+            if (const iterator next = std::next(m_find_hint);
+                next != m_memory_block_tree.end() && ContainsAddress(*next, address)) {
+                m_find_hint = next;
+                return next;
+            }
+        }
+        m_find_hint = m_memory_block_tree.find(KMemoryBlock(
             address, 1, KMemoryState::Free, KMemoryPermission::None, KMemoryAttribute::None));
+        return m_find_hint;
     }
 
     const KMemoryBlock* FindBlock(KProcessAddress address) const {
@@ -141,7 +158,13 @@ private:
     void CoalesceForUpdate(KMemoryBlockManagerUpdateAllocator* allocator, KProcessAddress address,
                            size_t num_pages);
 
+    static bool ContainsAddress(const KMemoryBlock& block, KProcessAddress address) {
+        return block.GetAddress() <= address && address < block.GetEndAddress();
+    }
+
     MemoryBlockTree m_memory_block_tree;
+    /// Block found by the last lookup, end() when none. Blocks are erased only when coalescing.
+    mutable iterator m_find_hint{m_memory_block_tree.end()};
     KProcessAddress m_start_address{};
     KProcessAddress m_end_address{};
 };
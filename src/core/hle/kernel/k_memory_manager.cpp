@@ -9,6 +9,7 @@
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "core/core.h"
 #include "core/device_memory.h"
 #include "core/hle/kernel/initial_process.h"
@@ -169,6 +170,14 @@ void KMemoryManager::Initialize(KVirtualAddress management_region, size_t manage
     for (size_t i = 0; i < m_num_managers; ++i) {
         m_managers[i].SetInitialUsedHeapSize(reserved_sizes[i]);
     }
+
+    // Return the host memory of pages the guest frees, unless all of it is meant to stay mapped.
+    Common::HostMemory& backing = m_system.DeviceMemory().buffer;
+    if (Settings::values.release_freed_memory.GetValue() && !backing.IsPrefaulted()) {
+        for (size_t i = 0; i < m_num_managers; ++i) {
+            m_managers[i].SetReleasedBacking(std::addressof(backing));
+        }
+    }
 }
 
 Result KMemoryManager::InitializeOptimizedMemory(u64 process_id, Pool pool) {
@@ -433,6 +442,11 @@ Result KMemoryManager::AllocateForProcess(KPageGroup* out, size_t num_pages, u32
     R_SUCCEED();
 }
 
+void KMemoryManager::Impl::ReleaseBacking(KPhysicalAddress addr, size_t num_pages) {
+    m_released_backing->DiscardBackingRegion(GetInteger(addr) - Core::DramMemoryMap::Base,
+                                             num_pages * PageSize);
+}
+
 size_t KMemoryManager::Impl::Initialize(KPhysicalAddress address, size_t size,
                                         KVirtualAddress management, KVirtualAddress management_end,
                                         Pool p) {
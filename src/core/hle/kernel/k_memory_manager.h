@@ -16,6 +16,10 @@
 #include "core/hle/kernel/k_typed_address.h"
 #include "core/hle/result.h"
 
+namespace Common {
+class HostMemory;
+}
+
 namespace Core {
 class System;
 }
@@ -213,6 +217,14 @@ private:
         }
         void Free(KPhysicalAddress addr, size_t num_pages) {
             m_heap.Free(addr, num_pages);
+            if (m_released_backing != nullptr && num_pages >= MinimumReleasedPages) {
+                this->ReleaseBacking(addr, num_pages);
+            }
+        }
+
+        /// Gives the host memory of pages freed from now on back to the host.
+        void SetReleasedBacking(Common::HostMemory* backing) {
+            m_released_backing = backing;
         }
 
         void SetInitialUsedHeapSize(size_t reserved_size) {
@@ -322,6 +334,11 @@ private:
         }
 
     private:
+        /// Smaller frees are left resident, they would cost more syscalls than they save
+        static constexpr size_t MinimumReleasedPages = 16;
+
+        void ReleaseBacking(KPhysicalAddress addr, size_t num_pages);
+
         using RefCount = u16;
 
         KPageHeap m_heap;
@@ -330,6 +347,7 @@ private:
         Pool m_pool{};
         Impl* m_next{};
         Impl* m_prev{};
+        Common::HostMemory* m_released_backing{};
     };
 
 private:
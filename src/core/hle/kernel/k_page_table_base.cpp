@@ -5784,14 +5784,29 @@ Result KPageTableBase::Operate(PageLinkedList* page_list, KProcessAddress virt_a
         // We want to maintain a new reference to every page in the group.
         KScopedPageGroup spg(page_group, operation == OperationType::MapGroup);
 
+        // Physically adjacent blocks are mapped as one region, each region is a host mapping.
+        const auto perm = ConvertToMemoryPermission(properties.perm);
+        KPhysicalAddress run_address{};
+        size_t run_size{};
+        const auto map_run = [&] {
+            m_memory->MapMemoryRegion(*m_impl, virt_addr, run_size, run_address, perm,
+                                      separate_heap);
+            virt_addr += run_size;
+        };
         for (const auto& node : page_group) {
             const size_t size{node.GetNumPages() * PageSize};
-
-            // Map the pages.
-            m_memory->MapMemoryRegion(*m_impl, virt_addr, size, node.GetAddress(),
-                                      ConvertToMemoryPermission(properties.perm), separate_heap);
-
-            virt_addr += size;
+            if (run_size != 0 && node.GetAddress() == run_address + run_size) {
+                run_size += size;
+                continue;
+            }
+            if (run_size != 0) {
+                map_run();
+            }
+            run_address = node.GetAddress();
+            run_size = size;
+        }
+        if (run_size != 0) {
+            map_run();
         }
 
         // We succeeded! We want to persist the reference to the pages.
@@ -8,6 +8,7 @@
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
+#include "core/arm/dynarmic/dynarmic_block_cache.h"
 #include "core/arm/dynarmic/dynarmic_exclusive_monitor.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
@@ -182,6 +183,7 @@ void KProcess::Finalize() {
     for (auto& interface : m_arm_interfaces) {
         interface.reset();
     }
+    m_block_cache.reset();
     m_exclusive_monitor.reset();
 
     // Perform inherited finalization.
@@ -1273,10 +1275,14 @@ void KProcess::InitializeInterfaces() {
     } else
 #endif
         if (this->Is64Bit()) {
+        if (this->IsApplication() && Settings::values.cpu_block_cache.GetValue()) {
+            m_block_cache = std::make_unique<Core::DynarmicBlockCache>(m_kernel.System(), *this);
+        }
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
             m_arm_interfaces[i] = std::make_unique<Core::ArmDynarmic64>(
                 m_kernel.System(), m_kernel.IsMulticore(), this,
-                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i);
+                static_cast<Core::DynarmicExclusiveMonitor&>(*m_exclusive_monitor), i,
+                m_block_cache.get());
         }
     } else {
         for (size_t i = 0; i < Core::Hardware::NUM_CPU_CORES; i++) {
@@ -22,6 +22,10 @@
 #include "core/hle/kernel/k_thread_local_page.h"
 #include "core/memory.h"
 
+namespace Core {
+class DynarmicBlockCache;
+}
+
 namespace Kernel {
 
 enum class DebugWatchpointType : u8 {
@@ -132,6 +136,7 @@ private:
     std::unordered_map<u64, u64> m_post_handlers{};
 #endif
     std::unique_ptr<Core::ExclusiveMonitor> m_exclusive_monitor;
+    std::unique_ptr<Core::DynarmicBlockCache> m_block_cache;
     Core::Memory::Memory m_memory;
 
 private:
@@ -216,6 +221,10 @@ public:
         return m_code_address;
     }
 
+    size_t GetCodeSize() const {
+        return m_code_size;
+    }
+
     size_t GetMainStackSize() const {
         return m_main_thread_stack_size;
     }
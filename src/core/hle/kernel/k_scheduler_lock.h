@@ -33,7 +33,11 @@ public:
         } else {
             // Otherwise, we want to disable scheduling and acquire the spinlock.
             SchedulerType::DisableScheduling(m_kernel);
-            m_spin_lock.Lock();
+            if (!m_spin_lock.TryLock()) {
+                // Another core holds the lock, note it so contention can be measured.
+                m_contention_count.fetch_add(1, std::memory_order_relaxed);
+                m_spin_lock.Lock();
+            }
 
             ASSERT(m_lock_count == 0);
             ASSERT(m_owner_thread == nullptr);
@@ -68,6 +72,11 @@ public:
         }
     }
 
+    /// Returns how many times the lock was already held by another thread since the last call.
+    u64 GetAndResetContentionCount() {
+        return m_contention_count.exchange(0, std::memory_order_relaxed);
+    }
+
 private:
     friend class GlobalSchedulerContext;
 
@@ -75,6 +84,7 @@ private:
     KAlignedSpinLock m_spin_lock{};
     s32 m_lock_count{};
     std::atomic<KThread*> m_owner_thread{};
+    std::atomic<u64> m_contention_count{};
 };
 
 } // namespace Kernel
@@ -16,10 +16,12 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/arm/sampling_profiler.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -81,6 +83,9 @@ struct KernelCore::Impl {
         InitializeMemoryLayout();
         InitializeShutdownThreads();
         InitializePhysicalCores();
+        if (Settings::values.guest_sampling_profiler.GetValue()) {
+            sampling_profiler = std::make_unique<Core::SamplingProfiler>(kernel);
+        }
         InitializePreemption(kernel);
         InitializeGlobalData(kernel);
 
@@ -115,6 +120,16 @@ struct KernelCore::Impl {
 
         CloseServices();
 
+        for (const auto& core : cores) {
+            if (core) {
+                core->LogSvcStatistics();
+            }
+        }
+        if (sampling_profiler) {
+            sampling_profiler->Report(application_process);
+            sampling_profiler.reset();
+        }
+
         if (application_process) {
             application_process->Close();
             application_process = nullptr;
@@ -800,6 +815,8 @@ struct KernelCore::Impl {
     std::vector<std::unique_ptr<Service::ServerManager>> server_managers;
 
     std::array<std::unique_ptr<Kernel::PhysicalCore>, Core::Hardware::NUM_CPU_CORES> cores;
+    // Samples the cores above, it has to be destroyed first
+    std::unique_ptr<Core::SamplingProfiler> sampling_profiler;
 
     // Next host thead ID to use, 0-3 IDs represent core threads, >3 represent others
     std::atomic<u32> next_host_thread_id{Core::Hardware::NUM_CPU_CORES};
@@ -936,6 +953,10 @@ const Kernel::PhysicalCore& KernelCore::PhysicalCore(std::size_t id) const {
     return *impl->cores[id];
 }
 
+Core::SamplingProfiler* KernelCore::SamplingProfiler() {
+    return impl->sampling_profiler.get();
+}
+
 size_t KernelCore::CurrentPhysicalCoreIndex() const {
     const u32 core_id = impl->GetCurrentHostThreadID();
     if (core_id >= Core::Hardware::NUM_CPU_CORES) {
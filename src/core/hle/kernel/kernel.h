@@ -23,6 +23,7 @@
 
 namespace Core {
 class ExclusiveMonitor;
+class SamplingProfiler;
 class System;
 } // namespace Core
 
@@ -154,6 +155,9 @@ public:
     /// Gets the an instance of the respective physical CPU core.
     const Kernel::PhysicalCore& PhysicalCore(std::size_t id) const;
 
+    /// Gets the guest sampling profiler, nullptr when it is disabled.
+    Core::SamplingProfiler* SamplingProfiler();
+
     /// Gets the current physical core index for the running host thread.
     std::size_t CurrentPhysicalCoreIndex() const;
 
@@ -4,8 +4,14 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <array>
+
+#include "common/logging/log.h"
+#include "common/profiler.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
+#include "core/arm/sampling_profiler.h"
 #include "core/core.h"
 #include "core/debugger/debugger.h"
 #include "core/hle/kernel/k_process.h"
@@ -83,6 +89,8 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
                 return;
             }
 
+            // Guest code can't switch fibers until it halts, unlike the supervisor calls after
+            PROFILE_SCOPE("PhysicalCore::RunGuest");
             if (thread->GetStepState() == StepState::StepPending) {
                 hr = interface->StepThread(thread);
 
@@ -91,11 +99,25 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
                 }
             } else {
                 hr = interface->RunThread(thread);
+
+                // Non-blocking supervisor calls return to the guest without leaving the context
+                while (hr == Core::HaltReason::SupervisorCall && TryFastCall(thread, interface)) {
+                    hr = interface->RunThread(thread);
+                }
             }
 
             ExitContext();
         }
 
+        // Record the sample requested by the profiler, before a supervisor call moves on.
+        const bool sampled = m_is_sample_requested.load(std::memory_order_relaxed) &&
+                             m_is_sample_requested.exchange(false, std::memory_order_relaxed);
+        if (sampled) {
+            Svc::ThreadContext ctx;
+            interface->GetContext(ctx);
+            m_kernel.SamplingProfiler()->Record(process, ctx);
+        }
+
         // Determine why we stopped.
         const bool supervisor_call = True(hr & Core::HaltReason::SupervisorCall);
         const bool prefetch_abort = True(hr & Core::HaltReason::PrefetchAbort);
@@ -147,17 +169,82 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
         // Handle system calls.
         if (supervisor_call) {
             // Perform call.
-            Svc::Call(system, interface->GetSvcNumber());
+            const u32 svc_number = interface->GetSvcNumber();
+            const auto begin = std::chrono::steady_clock::now();
+            Svc::Call(system, svc_number);
+            RecordSvc(svc_number, begin);
             return;
         }
 
         // Handle external interrupt sources.
-        if (interrupt || m_is_single_core) {
+        // Halts requested by the profiler alone resume the guest right away.
+        const bool sample_only = sampled && !m_is_interrupted;
+        if ((interrupt && !sample_only) || m_is_single_core) {
             return;
         }
     }
 }
 
+bool PhysicalCore::TryFastCall(KThread* thread, Core::ArmInterface* interface) {
+    // Single core mode has to advance the timing between calls, pending interrupts and
+    // termination requests have to be looked at outside of the guest context.
+    if (m_is_single_core || m_is_interrupted || thread->HasDpc()) {
+        return false;
+    }
+    const u32 svc_number = interface->GetSvcNumber();
+    std::array<uint64_t, 8> args;
+    interface->GetSvcArguments(args);
+    if (!Svc::IsFastCall(svc_number, args)) {
+        return false;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    Svc::CallFast(m_kernel.System(), svc_number, args);
+    interface->SetSvcArguments(args);
+    RecordSvc(svc_number, begin);
+    return true;
+}
+
+void PhysicalCore::RecordSvc(u32 imm, std::chrono::steady_clock::time_point begin) {
+    if (imm >= m_svc_counters.size()) {
+        return;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    auto& counter = m_svc_counters[imm];
+    counter.count.fetch_add(1, std::memory_order_relaxed);
+    counter.total_ns.fetch_add(
+        static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+        std::memory_order_relaxed);
+}
+
+PhysicalCore::SvcStatistics PhysicalCore::GetSvcStatistics(u32 imm) const {
+    if (imm >= m_svc_counters.size()) {
+        return {};
+    }
+    const auto& counter = m_svc_counters[imm];
+    return {
+        .count = counter.count.load(std::memory_order_relaxed),
+        .total_ns = counter.total_ns.load(std::memory_order_relaxed),
+    };
+}
+
+void PhysicalCore::LogSvcStatistics() const {
+    std::array<u32, Svc::NumSupervisorCalls> ids;
+    for (u32 imm = 0; imm < ids.size(); ++imm) {
+        ids[imm] = imm;
+    }
+    std::ranges::sort(ids, [this](u32 lhs, u32 rhs) {
+        return GetSvcStatistics(lhs).count > GetSvcStatistics(rhs).count;
+    });
+    for (const u32 imm : ids) {
+        const SvcStatistics statistics = GetSvcStatistics(imm);
+        if (statistics.count == 0) {
+            break;
+        }
+        LOG_DEBUG(Kernel_SVC, "Core {} SVC {:#x}: {} calls, {} ns on average", m_core_index, imm,
+                  statistics.count, statistics.total_ns / statistics.count);
+    }
+}
+
 void PhysicalCore::LoadContext(const KThread* thread) {
     auto* const process = thread->GetOwnerProcess();
     if (!process) {
@@ -216,9 +303,37 @@ void PhysicalCore::LogBacktrace() {
     }
 }
 
+namespace {
+s64 IdleClockNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // Anonymous namespace
+
 void PhysicalCore::Idle() {
     std::unique_lock lk{m_guard};
-    m_on_interrupt.wait(lk, [this] { return m_is_interrupted; });
+    if (m_is_interrupted) {
+        return;
+    }
+    m_idle_since_ns.store(IdleClockNs(), std::memory_order_relaxed);
+    m_on_interrupt.wait(lk, [this] { return m_is_interrupted.load(); });
+
+    // The statistics reader may have moved the start forward to account for the wait so far.
+    const s64 since = m_idle_since_ns.exchange(0, std::memory_order_relaxed);
+    m_idle_ns.fetch_add(IdleClockNs() - since, std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds PhysicalCore::GetAndResetIdleTime() {
+    s64 idle_ns = m_idle_ns.exchange(0, std::memory_order_relaxed);
+    // Count the wait in progress up to now, cores idling for longer than the interval report it
+    const s64 now = IdleClockNs();
+    s64 since = m_idle_since_ns.load(std::memory_order_relaxed);
+    if (since != 0 &&
+        m_idle_since_ns.compare_exchange_strong(since, now, std::memory_order_relaxed)) {
+        idle_ns += now - since;
+    }
+    return std::chrono::nanoseconds{idle_ns};
 }
 
 bool PhysicalCore::IsInterrupted() const {
@@ -226,6 +341,13 @@ bool PhysicalCore::IsInterrupted() const {
 }
 
 void PhysicalCore::Interrupt() {
+    // If an interrupt is already pending, the core has not acknowledged it yet. It reads the
+    // scheduling state after clearing the flag, so it will see ours as well and there is nothing
+    // else to signal.
+    if (m_is_interrupted) {
+        return;
+    }
+
     // Lock core context.
     std::scoped_lock lk{m_guard};
 
@@ -248,6 +370,17 @@ void PhysicalCore::Interrupt() {
     arm_interface->SignalInterrupt(thread);
 }
 
+void PhysicalCore::RequestSample() {
+    std::scoped_lock lk{m_guard};
+
+    // Idle cores and kernel threads have no guest code to sample.
+    if (m_arm_interface == nullptr) {
+        return;
+    }
+    m_is_sample_requested = true;
+    m_arm_interface->SignalInterrupt(m_current_thread);
+}
+
 void PhysicalCore::ClearInterrupt() {
     std::scoped_lock lk{m_guard};
     m_is_interrupted = false;
@@ -1,14 +1,21 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <memory>
 #include <mutex>
 
 #include "core/arm/arm_interface.h"
+#include "core/hle/kernel/svc.h"
 
 namespace Kernel {
 class KernelCore;
@@ -58,11 +65,38 @@ public:
     // Check if this core is interrupted.
     bool IsInterrupted() const;
 
+    // Halt the guest code running on this core to record a sample of it.
+    void RequestSample();
+
+    // Host time this core spent waiting for an interrupt since the last call.
+    std::chrono::nanoseconds GetAndResetIdleTime();
+
     std::size_t CoreIndex() const {
         return m_core_index;
     }
 
+    // Number of supervisor calls made on this core and the host time spent in them.
+    struct SvcStatistics {
+        u64 count;
+        u64 total_ns;
+    };
+    SvcStatistics GetSvcStatistics(u32 imm) const;
+
+    // Log the supervisor calls made on this core, most frequent first.
+    void LogSvcStatistics() const;
+
 private:
+    // Run a non-blocking supervisor call without leaving the guest context.
+    // Returns false when the call has to go through the regular path.
+    bool TryFastCall(KThread* thread, Core::ArmInterface* interface);
+
+    void RecordSvc(u32 imm, std::chrono::steady_clock::time_point begin);
+
+    struct SvcCounter {
+        std::atomic<u64> count{};
+        std::atomic<u64> total_ns{};
+    };
+
     KernelCore& m_kernel;
     const std::size_t m_core_index;
 
@@ -70,8 +104,16 @@ private:
     std::condition_variable m_on_interrupt;
     Core::ArmInterface* m_arm_interface{};
     KThread* m_current_thread{};
-    bool m_is_interrupted{};
+    std::atomic<bool> m_is_interrupted{};
+    std::atomic<bool> m_is_sample_requested{};
     bool m_is_single_core{};
+
+    // Idle time of the finished waits, and the start of the current one or zero.
+    std::atomic<s64> m_idle_ns{};
+    std::atomic<s64> m_idle_since_ns{};
+
+    // Calls blocking in the kernel may complete on another core, hence the atomics.
+    std::array<SvcCounter, Svc::NumSupervisorCalls> m_svc_counters{};
 };
 
 } // namespace Kernel
@@ -2500,6 +2500,60 @@ static void Call64(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
         break;
     }
 }
+bool IsFastCall(u32 imm, std::span<const uint64_t, 8> args) {
+    // Looking up a real handle opens and closes a reference to its object. Closing it may destroy
+    // the object, which has to happen through a proper supervisor call exit. Only the
+    // pseudo-handles of the current thread and process are served from the guest context.
+    const auto is_pseudo_handle = [args](size_t index) {
+        return IsPseudoHandle(static_cast<Handle>(args[index]));
+    };
+    switch (static_cast<SvcId>(imm)) {
+    case SvcId::GetCurrentProcessorNumber:
+    case SvcId::GetSystemTick:
+        return true;
+    case SvcId::GetThreadPriority:
+    case SvcId::GetProcessId:
+    case SvcId::GetThreadId:
+        return is_pseudo_handle(1);
+    case SvcId::GetThreadCoreMask:
+        return is_pseudo_handle(2);
+    case SvcId::GetInfo:
+        // The info type is in the second register and the handle in the third on both 32-bit and
+        // 64-bit processes. Only plain getters qualify, the memory usages take blocking page table
+        // locks.
+        if (!is_pseudo_handle(2)) {
+            return false;
+        }
+        switch (static_cast<InfoType>(static_cast<uint32_t>(args[1]))) {
+        case InfoType::CoreMask:
+        case InfoType::PriorityMask:
+        case InfoType::AliasRegionAddress:
+        case InfoType::AliasRegionSize:
+        case InfoType::HeapRegionAddress:
+        case InfoType::HeapRegionSize:
+        case InfoType::AslrRegionAddress:
+        case InfoType::AslrRegionSize:
+        case InfoType::StackRegionAddress:
+        case InfoType::StackRegionSize:
+        case InfoType::ProgramId:
+        case InfoType::UserExceptionContextAddress:
+        case InfoType::IsApplication:
+            return true;
+        default:
+            return false;
+        }
+    default:
+        return false;
+    }
+}
+
+void CallFast(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
+    if (GetCurrentProcess(system.Kernel()).Is64Bit())
+        Call64(system, imm, args);
+    else
+        Call32(system, imm, args);
+}
+
 void Call(Core::System& system, u32 imm) {
     auto& kernel = system.Kernel();
     auto& process = GetCurrentProcess(kernel);
@@ -534,4 +534,12 @@ void SvcWrap_CallSecureMonitor64(Core::System& system, std::span<uint64_t, 8> ar
 // Perform a supervisor call by index.
 void Call(Core::System& system, u32 imm);
 
+// Check if a supervisor call can run without leaving the guest context of the core.
+// Such calls never block, reschedule nor take the scheduler lock. The arguments are the
+// registers of the call, as some calls are only classified as fast for some of their operands.
+bool IsFastCall(u32 imm, std::span<const uint64_t, 8> args);
+
+// Perform a supervisor call classified by IsFastCall on arguments read from the core.
+void CallFast(Core::System& system, u32 imm, std::span<uint64_t, 8> args);
+
 } // namespace Kernel::Svc
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -29,6 +32,7 @@ void LoopProcess(Core::System& system) {
                                          std::make_shared<IAudioRendererManager>(system));
     server_manager->RegisterNamedService("hwopus",
                                          std::make_shared<IHardwareOpusDecoderManager>(system));
+    server_manager->StartConfiguredHostThreads("audio");
     ServerManager::RunServer(std::move(server_manager));
 }
 
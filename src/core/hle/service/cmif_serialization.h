@@ -342,16 +342,21 @@ void ReadInArgument(bool is_domain, CallArguments& args, const u8* raw_data, HLE
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
             using ElementType = typename ArgType::Type;
 
-            // Set up scratch buffer.
+            // Map the guest buffer directly when possible, otherwise set up scratch buffer.
             auto& buffer = temp[OutBufferIndex];
-            if (ctx.CanWriteBuffer(OutBufferIndex)) {
-                buffer.resize_destructive(ctx.GetWriteBufferSize(OutBufferIndex));
-            } else {
+            std::span<u8> out;
+            if (!ctx.CanWriteBuffer(OutBufferIndex)) {
                 buffer.resize_destructive(0);
+            } else if constexpr (ArgType::Attr & BufferAttr_HipcAutoSelect) {
+                out = ctx.GetWriteBuffer(buffer, OutBufferIndex);
+            } else if constexpr (ArgType::Attr & BufferAttr_HipcMapAlias) {
+                out = ctx.GetWriteBufferB(buffer, OutBufferIndex);
+            } else /* if (ArgType::Attr & BufferAttr_HipcPointer) */ {
+                out = ctx.GetWriteBufferC(buffer, OutBufferIndex);
             }
 
-            ElementType* ptr = (ElementType*) buffer.data();
-            size_t size = buffer.size() / sizeof(ElementType);
+            ElementType* ptr = (ElementType*) out.data();
+            size_t size = out.size() / sizeof(ElementType);
 
             std::get<ArgIndex>(args) = std::span(ptr, size);
 
@@ -416,6 +421,7 @@ void WriteOutArgument(bool is_domain, CallArguments& args, u8* raw_data, HLERequ
 
             return WriteOutArgument<MethodArguments, CallArguments, PrevAlign, DataOffset, OutBufferIndex + 1, RawDataFinished, ArgIndex + 1>(is_domain, args, raw_data, ctx, temp);
         } else if constexpr (ArgumentTraits<ArgType>::Type == ArgumentType::OutBuffer) {
+            // Buffers mapped in place were already written, only the scratch ones are copied.
             auto& buffer = temp[OutBufferIndex];
             const size_t size = buffer.size();
 
@@ -4,14 +4,23 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/overflow.h"
 #include "core/file_sys/errors.h"
 #include "core/hle/service/cmif_serialization.h"
 #include "core/hle/service/filesystem/fsp/fs_i_file.h"
 
 namespace Service::FileSystem {
 
-IFile::IFile(Core::System& system_, FileSys::VirtualFile file_)
-    : ServiceFramework{system_, "IFile"}, backend{std::make_unique<FileSys::Fsa::IFile>(file_)} {
+IFile::IFile(Core::System& system_, FileSys::VirtualFile file_,
+             std::shared_ptr<WriteBehindQueue> write_queue_)
+    : ServiceFramework{system_, "IFile"}, file{file_},
+      backend{std::make_unique<FileSys::Fsa::IFile>(file_)} {
+    if (!file_->IsWritable()) {
+        read_ahead = std::make_unique<ReadAheadFile>(file_);
+    } else {
+        write_queue = std::move(write_queue_);
+    }
+
     // clang-format off
     static const FunctionInfo functions[] = {
         {0, D<&IFile::Read>, "Read"},
@@ -33,7 +42,16 @@ Result IFile::Read(
     LOG_DEBUG(Service_FS, "called, option={}, offset={:#X}, length={}", option.value, offset,
               size);
 
+    if (read_ahead) {
+        R_UNLESS(size >= 0, FileSys::ResultInvalidSize);
+        R_UNLESS(offset >= 0, FileSys::ResultOutOfRange);
+        *out_size = static_cast<s64>(
+            read_ahead->Read(out_buffer.data(), static_cast<std::size_t>(size), offset));
+        R_SUCCEED();
+    }
+
     // Read the data from the Storage backend
+    WaitForQueuedWrites();
     R_RETURN(
         backend->Read(reinterpret_cast<size_t*>(out_size.Get()), offset, out_buffer.data(), size));
 }
@@ -44,25 +62,44 @@ Result IFile::Write(
     LOG_DEBUG(Service_FS, "called, option={}, offset={:#X}, length={}", option.value, offset,
               size);
 
-    R_RETURN(backend->Write(offset, buffer.data(), size, option));
+    if (!write_queue || size == 0) {
+        R_RETURN(backend->Write(offset, buffer.data(), size, option));
+    }
+
+    // Same checks as the backend, the data is then written in the background
+    R_UNLESS(size > 0 && static_cast<u64>(size) <= buffer.size(), FileSys::ResultInvalidSize);
+    R_UNLESS(offset >= 0, FileSys::ResultOutOfRange);
+    R_UNLESS(Common::CanAddWithoutOverflow<s64>(offset, size), FileSys::ResultOutOfRange);
+    write_queue->QueueWrite(file, offset,
+                            std::vector<u8>(buffer.begin(), buffer.begin() + size));
+    R_SUCCEED();
 }
 
 Result IFile::Flush() {
     LOG_DEBUG(Service_FS, "called");
 
+    WaitForQueuedWrites();
     R_RETURN(backend->Flush());
 }
 
 Result IFile::SetSize(s64 size) {
     LOG_DEBUG(Service_FS, "called, size={}", size);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->SetSize(size));
 }
 
 Result IFile::GetSize(Out<s64> out_size) {
     LOG_DEBUG(Service_FS, "called");
 
+    WaitForQueuedWrites();
     R_RETURN(backend->GetSize(out_size));
 }
 
+void IFile::WaitForQueuedWrites() {
+    if (write_queue) {
+        write_queue->Wait();
+    }
+}
+
 } // namespace Service::FileSystem
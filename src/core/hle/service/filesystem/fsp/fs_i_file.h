@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -6,16 +9,25 @@
 #include "core/file_sys/fsa/fs_i_file.h"
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/filesystem/filesystem.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
+#include "core/hle/service/filesystem/fsp/fs_write_behind.h"
 #include "core/hle/service/service.h"
 
 namespace Service::FileSystem {
 
 class IFile final : public ServiceFramework<IFile> {
 public:
-    explicit IFile(Core::System& system_, FileSys::VirtualFile file_);
+    explicit IFile(Core::System& system_, FileSys::VirtualFile file_,
+                   std::shared_ptr<WriteBehindQueue> write_queue_ = nullptr);
 
 private:
+    /// Waits for the writes queued in the background before the file is accessed otherwise.
+    void WaitForQueuedWrites();
+
+    FileSys::VirtualFile file;
     std::unique_ptr<FileSys::Fsa::IFile> backend;
+    std::unique_ptr<ReadAheadFile> read_ahead; ///< Only used for files that can't be written
+    std::shared_ptr<WriteBehindQueue> write_queue; ///< Only used for writable save data files
 
     Result Read(FileSys::ReadOption option, Out<s64> out_size, s64 offset,
                 const OutBuffer<BufferAttr_HipcMapAlias | BufferAttr_HipcMapTransferAllowsNonSecure>
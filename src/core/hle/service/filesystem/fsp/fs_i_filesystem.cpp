@@ -13,10 +13,11 @@
 
 namespace Service::FileSystem {
 
-IFileSystem::IFileSystem(Core::System& system_, FileSys::VirtualDir dir_, SizeGetter size_getter_)
+IFileSystem::IFileSystem(Core::System& system_, FileSys::VirtualDir dir_, SizeGetter size_getter_,
+                         std::shared_ptr<WriteBehindQueue> write_queue_)
     : ServiceFramework{system_, "IFileSystem"}, backend{std::make_unique<FileSys::Fsa::IFileSystem>(
                                                     dir_)},
-      size_getter{std::move(size_getter_)} {
+      size_getter{std::move(size_getter_)}, write_queue{std::move(write_queue_)} {
     static const FunctionInfo functions[] = {
         {0, D<&IFileSystem::CreateFile>, "CreateFile"},
         {1, D<&IFileSystem::DeleteFile>, "DeleteFile"},
@@ -43,12 +44,14 @@ Result IFileSystem::CreateFile(const InLargeData<FileSys::Sf::Path, BufferAttr_H
                                s32 option, s64 size) {
     LOG_DEBUG(Service_FS, "called. file={}, option={:#X}, size=0x{:08X}", path->str, option, size);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->CreateFile(FileSys::Path(path->str), size));
 }
 
 Result IFileSystem::DeleteFile(const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. file={}", path->str);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->DeleteFile(FileSys::Path(path->str)));
 }
 
@@ -56,6 +59,7 @@ Result IFileSystem::CreateDirectory(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. directory={}", path->str);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->CreateDirectory(FileSys::Path(path->str)));
 }
 
@@ -63,6 +67,7 @@ Result IFileSystem::DeleteDirectory(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. directory={}", path->str);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->DeleteDirectory(FileSys::Path(path->str)));
 }
 
@@ -70,6 +75,7 @@ Result IFileSystem::DeleteDirectoryRecursively(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. directory={}", path->str);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->DeleteDirectoryRecursively(FileSys::Path(path->str)));
 }
 
@@ -77,6 +83,7 @@ Result IFileSystem::CleanDirectoryRecursively(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. Directory: {}", path->str);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->CleanDirectoryRecursively(FileSys::Path(path->str)));
 }
 
@@ -85,6 +92,7 @@ Result IFileSystem::RenameFile(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> new_path) {
     LOG_DEBUG(Service_FS, "called. file '{}' to file '{}'", old_path->str, new_path->str);
 
+    WaitForQueuedWrites();
     R_RETURN(backend->RenameFile(FileSys::Path(old_path->str), FileSys::Path(new_path->str)));
 }
 
@@ -93,11 +101,12 @@ Result IFileSystem::OpenFile(OutInterface<IFile> out_interface,
                              u32 mode) {
     LOG_DEBUG(Service_FS, "called. file={}, mode={}", path->str, mode);
 
+    WaitForQueuedWrites();
     FileSys::VirtualFile vfs_file{};
     R_TRY(backend->OpenFile(&vfs_file, FileSys::Path(path->str),
                             static_cast<FileSys::OpenMode>(mode)));
 
-    *out_interface = std::make_shared<IFile>(system, vfs_file);
+    *out_interface = std::make_shared<IFile>(system, vfs_file, write_queue);
     R_SUCCEED();
 }
 
@@ -106,6 +115,7 @@ Result IFileSystem::OpenDirectory(OutInterface<IDirectory> out_interface,
                                   u32 mode) {
     LOG_DEBUG(Service_FS, "called. directory={}, mode={}", path->str, mode);
 
+    WaitForQueuedWrites();
     FileSys::VirtualDir vfs_dir{};
     R_TRY(backend->OpenDirectory(&vfs_dir, FileSys::Path(path->str),
                                  static_cast<FileSys::OpenDirectoryMode>(mode)));
@@ -119,6 +129,7 @@ Result IFileSystem::GetEntryType(
     Out<u32> out_type, const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_DEBUG(Service_FS, "called. file={}", path->str);
 
+    WaitForQueuedWrites();
     FileSys::DirectoryEntryType vfs_entry_type{};
     R_TRY(backend->GetEntryType(&vfs_entry_type, FileSys::Path(path->str)));
 
@@ -129,6 +140,7 @@ Result IFileSystem::GetEntryType(
 Result IFileSystem::Commit() {
     LOG_WARNING(Service_FS, "(STUBBED) called");
 
+    WaitForQueuedWrites();
     R_SUCCEED();
 }
 
@@ -153,6 +165,7 @@ Result IFileSystem::GetFileTimeStampRaw(
     const InLargeData<FileSys::Sf::Path, BufferAttr_HipcPointer> path) {
     LOG_WARNING(Service_FS, "(Partial Implementation) called. file={}", path->str);
 
+    WaitForQueuedWrites();
     FileSys::FileTimeStampRaw vfs_timestamp{};
     R_TRY(backend->GetFileTimeStampRaw(&vfs_timestamp, FileSys::Path(path->str)));
 
@@ -173,4 +186,10 @@ Result IFileSystem::GetFileSystemAttribute(Out<FileSys::FileSystemAttribute> out
     R_SUCCEED();
 }
 
+void IFileSystem::WaitForQueuedWrites() {
+    if (write_queue) {
+        write_queue->Wait();
+    }
+}
+
 } // namespace Service::FileSystem
@@ -11,7 +11,7 @@
 namespace Service::FileSystem {
 
 IStorage::IStorage(Core::System& system_, FileSys::VirtualFile backend_)
-    : ServiceFramework{system_, "IStorage"}, backend(std::move(backend_)) {
+    : ServiceFramework{system_, "IStorage"}, backend(std::move(backend_)), read_ahead(backend) {
     static const FunctionInfo functions[] = {
         {0, D<&IStorage::Read>, "Read"},
         {1, nullptr, "Write"},
@@ -32,7 +32,7 @@ Result IStorage::Read(
     R_UNLESS(offset >= 0, FileSys::ResultInvalidOffset);
 
     // Read the data from the Storage backend
-    backend->Read(out_bytes.data(), length, offset);
+    read_ahead.Read(out_bytes.data(), static_cast<std::size_t>(length), offset);
 
     R_SUCCEED();
 }
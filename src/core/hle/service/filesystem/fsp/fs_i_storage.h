@@ -6,6 +6,7 @@
 #include "core/file_sys/vfs/vfs.h"
 #include "core/hle/service/cmif_types.h"
 #include "core/hle/service/filesystem/filesystem.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
 #include "core/hle/service/service.h"
 
 namespace Service::FileSystem {
@@ -16,6 +17,7 @@ public:
 
 private:
     FileSys::VirtualFile backend;
+    ReadAheadFile read_ahead;
 
     Result Read(
         OutBuffer<BufferAttr_HipcMapAlias | BufferAttr_HipcMapTransferAllowsNonSecure> out_bytes,
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/thread_worker.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/hle/service/filesystem/fsp/fs_read_ahead.h"
+
+namespace Service::FileSystem {
+
+namespace {
+
+using namespace Common::Literals;
+
+/// Number of back to back reads before a file is considered to be streamed.
+constexpr u32 SEQUENTIAL_THRESHOLD = 2;
+constexpr std::size_t MIN_CHUNK_SIZE = 256_KiB;
+constexpr std::size_t MAX_CHUNK_SIZE = 4_MiB;
+
+std::atomic<u64> total_bytes_read;
+std::atomic<u64> total_read_nanoseconds;
+std::atomic<u64> total_hits;
+std::atomic<u64> total_misses;
+
+/// The storage layers below a file (AES-CTR, compression, bucket trees) keep mutable state and
+/// can't be read from two threads at once, so reads from the service thread and the I/O thread
+/// are serialized.
+std::mutex io_mutex;
+
+Common::ThreadWorker& IoThread() {
+    static Common::ThreadWorker worker{1, "FS:ReadAhead"};
+    return worker;
+}
+
+} // Anonymous namespace
+
+ReadAheadFile::ReadAheadFile(FileSys::VirtualFile file_)
+    : file{std::move(file_)}, file_size{static_cast<s64>(file->GetSize())} {}
+
+ReadAheadFile::~ReadAheadFile() {
+    if (hits + misses == 0) {
+        return;
+    }
+    const ReadAheadStatistics stats = GetStatistics();
+    const double seconds = static_cast<double>(stats.read_nanoseconds) / 1e9;
+    LOG_DEBUG(Service_FS,
+              "{}: {} reads, {} served by read-ahead (overall {:.1f} MiB/s, {:.1f}% hit rate)",
+              file->GetName(), hits + misses, hits,
+              seconds > 0.0 ? static_cast<double>(stats.bytes_read) / 1_MiB / seconds : 0.0,
+              100.0 * static_cast<double>(stats.hits) /
+                  static_cast<double>(std::max<u64>(stats.hits + stats.misses, 1)));
+}
+
+std::size_t ReadAheadFile::Read(u8* data, std::size_t length, s64 offset) {
+    const auto start_time = std::chrono::steady_clock::now();
+    if (offset == next_offset) {
+        ++sequential_reads;
+    } else {
+        // Random access, the chunk in flight is unlikely to be used.
+        sequential_reads = 0;
+        pending = {};
+    }
+
+    std::size_t read = ReadBuffered(data, length, offset);
+    if (read == length || offset + static_cast<s64>(read) >= file_size) {
+        ++hits;
+        ++total_hits;
+    } else {
+        std::scoped_lock lock{io_mutex};
+        read += file->Read(data + read, length - read, static_cast<std::size_t>(offset) + read);
+        ++misses;
+        ++total_misses;
+    }
+    next_offset = offset + static_cast<s64>(read);
+
+    if (sequential_reads >= SEQUENTIAL_THRESHOLD && !pending.valid()) {
+        // Keep one chunk in flight past the data that is already available.
+        const s64 buffer_end = buffer_offset + static_cast<s64>(buffer.size());
+        const bool in_buffer = next_offset >= buffer_offset && next_offset < buffer_end;
+        const s64 prefetch_offset = in_buffer ? buffer_end : next_offset;
+        if (prefetch_offset < file_size) {
+            const std::size_t chunk_size = std::clamp(length * 4, MIN_CHUNK_SIZE, MAX_CHUNK_SIZE);
+            Prefetch(prefetch_offset,
+                     std::min(chunk_size, static_cast<std::size_t>(file_size - prefetch_offset)));
+        }
+    }
+
+    total_bytes_read += read;
+    total_read_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - start_time)
+                                  .count();
+    return read;
+}
+
+ReadAheadStatistics ReadAheadFile::GetStatistics() {
+    return {
+        .bytes_read = total_bytes_read.load(std::memory_order_relaxed),
+        .read_nanoseconds = total_read_nanoseconds.load(std::memory_order_relaxed),
+        .hits = total_hits.load(std::memory_order_relaxed),
+        .misses = total_misses.load(std::memory_order_relaxed),
+    };
+}
+
+std::size_t ReadAheadFile::ReadBuffered(u8* data, std::size_t length, s64 offset) {
+    std::size_t copied = 0;
+    while (copied < length) {
+        const s64 position = offset + static_cast<s64>(copied);
+        if (pending.valid() && position >= pending_offset &&
+            position < pending_offset + static_cast<s64>(pending_length)) {
+            buffer = pending.get();
+            buffer_offset = pending_offset;
+        }
+        const s64 buffer_end = buffer_offset + static_cast<s64>(buffer.size());
+        if (position < buffer_offset || position >= buffer_end) {
+            break;
+        }
+        const std::size_t count =
+            std::min(length - copied, static_cast<std::size_t>(buffer_end - position));
+        std::memcpy(data + copied, buffer.data() + (position - buffer_offset), count);
+        copied += count;
+    }
+    return copied;
+}
+
+void ReadAheadFile::Prefetch(s64 offset, std::size_t length) {
+    std::promise<std::vector<u8>> promise;
+    pending = promise.get_future();
+    pending_offset = offset;
+    pending_length = length;
+    IoThread().QueueWork([file = file, offset, length, promise = std::move(promise)]() mutable {
+        std::vector<u8> data(length);
+        {
+            std::scoped_lock lock{io_mutex};
+            data.resize(file->Read(data.data(), length, static_cast<std::size_t>(offset)));
+        }
+        promise.set_value(std::move(data));
+    });
+}
+
+} // namespace Service::FileSystem
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <future>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs_types.h"
+
+namespace Service::FileSystem {
+
+struct ReadAheadStatistics {
+    u64 bytes_read;       ///< Bytes returned to the guest by read-ahead files
+    u64 read_nanoseconds; ///< Time the service thread spent in their reads
+    u64 hits;             ///< Reads fully served from a prefetched chunk
+    u64 misses;           ///< Reads that had to go to the file
+};
+
+/**
+ * Wraps a read-only file, detecting sequential reads and prefetching the following chunk on a
+ * worker thread. Host disk I/O and decryption of streamed assets then overlap with guest
+ * execution between two reads instead of stalling the service thread.
+ */
+class ReadAheadFile {
+public:
+    explicit ReadAheadFile(FileSys::VirtualFile file);
+    ~ReadAheadFile();
+
+    ReadAheadFile(const ReadAheadFile&) = delete;
+    ReadAheadFile& operator=(const ReadAheadFile&) = delete;
+
+    /// Reads from the file, using the prefetched data when it covers the requested range.
+    std::size_t Read(u8* data, std::size_t length, s64 offset);
+
+    /// Returns the counters accumulated by every read-ahead file so far.
+    [[nodiscard]] static ReadAheadStatistics GetStatistics();
+
+private:
+    /// Copies the prefetched data available at offset, returning the number of bytes copied.
+    std::size_t ReadBuffered(u8* data, std::size_t length, s64 offset);
+    void Prefetch(s64 offset, std::size_t length);
+
+    FileSys::VirtualFile file;
+    s64 file_size{};
+
+    std::vector<u8> buffer;
+    s64 buffer_offset{};
+
+    std::future<std::vector<u8>> pending;
+    s64 pending_offset{};
+    std::size_t pending_length{};
+
+    s64 next_offset{-1};
+    u32 sequential_reads{};
+    u64 hits{};
+    u64 misses{};
+};
+
+} // namespace Service::FileSystem
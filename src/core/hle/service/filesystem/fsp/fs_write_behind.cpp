@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/thread_worker.h"
+#include "core/file_sys/vfs/vfs.h"
+#include "core/hle/service/filesystem/fsp/fs_write_behind.h"
+
+namespace Service::FileSystem {
+
+namespace {
+
+using namespace Common::Literals;
+
+/// Queued data past which guest writes wait, bounds the memory held by a burst of writes.
+constexpr std::size_t MAX_PENDING_BYTES = 64_MiB;
+
+/// Longest time written data stays unflushed while writes keep arriving.
+constexpr std::chrono::seconds MAX_UNFLUSHED_TIME{1};
+
+/// A single thread keeps the writes of every queue in order.
+Common::ThreadWorker& WriterThread() {
+    static Common::ThreadWorker worker{1, "FS:WriteBehind"};
+    return worker;
+}
+
+} // Anonymous namespace
+
+WriteBehindQueue::WriteBehindQueue() = default;
+
+WriteBehindQueue::~WriteBehindQueue() {
+    Wait();
+}
+
+void WriteBehindQueue::QueueWrite(FileSys::VirtualFile file, s64 offset, std::vector<u8> data) {
+    const std::size_t size = data.size();
+    {
+        std::unique_lock lock{mutex};
+        condition.wait(lock, [this, size] {
+            return pending_writes == 0 || pending_bytes + size <= MAX_PENDING_BYTES;
+        });
+        ++pending_writes;
+        pending_bytes += size;
+    }
+    WriterThread().QueueWork(
+        [this, file = std::move(file), offset, data = std::move(data)]() {
+            const std::size_t written =
+                file->Write(data.data(), data.size(), static_cast<std::size_t>(offset));
+            if (written != data.size()) {
+                LOG_ERROR(Service_FS,
+                          "Could not write all bytes to {} (requested={:016X}, actual={:016X})",
+                          file->GetName(), data.size(), written);
+            }
+
+            if (std::ranges::find(unflushed_files, file) == unflushed_files.end()) {
+                unflushed_files.push_back(file);
+            }
+            bool drained;
+            {
+                std::scoped_lock lock{mutex};
+                drained = pending_writes == 1;
+            }
+            const auto now = std::chrono::steady_clock::now();
+            if (drained || now - last_flush >= MAX_UNFLUSHED_TIME) {
+                for (const auto& unflushed : unflushed_files) {
+                    unflushed->Flush();
+                }
+                unflushed_files.clear();
+                last_flush = now;
+            }
+
+            std::scoped_lock lock{mutex};
+            --pending_writes;
+            pending_bytes -= data.size();
+            condition.notify_all();
+        });
+}
+
+void WriteBehindQueue::Wait() {
+    std::unique_lock lock{mutex};
+    condition.wait(lock, [this] { return pending_writes == 0; });
+}
+
+} // namespace Service::FileSystem
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs_types.h"
+
+namespace Service::FileSystem {
+
+/**
+ * Writes of the guest to save data files, performed on a background thread so a guest write
+ * returns once its data is copied instead of waiting for the host disk. Writes run in the order
+ * they were queued. Any other access to the save data first waits for the queued writes, so the
+ * guest never observes a file that is behind its own writes. Written files are flushed to the
+ * host once the queue drains, and at least every MAX_UNFLUSHED_TIME during a long burst, so a
+ * crash loses at most that much of the queued data.
+ */
+class WriteBehindQueue {
+public:
+    WriteBehindQueue();
+    /// Waits for the queued writes, so they are on the disk once the save data is released.
+    ~WriteBehindQueue();
+
+    WriteBehindQueue(const WriteBehindQueue&) = delete;
+    WriteBehindQueue& operator=(const WriteBehindQueue&) = delete;
+
+    /// Queues a write of data to the file at offset, waiting when too much data is queued.
+    void QueueWrite(FileSys::VirtualFile file, s64 offset, std::vector<u8> data);
+
+    /// Waits until every write queued so far has been performed.
+    void Wait();
+
+private:
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t pending_writes{};
+    std::size_t pending_bytes{};
+
+    /// Only touched by the writer thread.
+    std::vector<FileSys::VirtualFile> unflushed_files;
+    std::chrono::steady_clock::time_point last_flush{std::chrono::steady_clock::now()};
+};
+
+} // namespace Service::FileSystem
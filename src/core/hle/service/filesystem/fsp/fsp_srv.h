@@ -23,6 +23,8 @@ class FileSystemBackend;
 
 namespace Service::FileSystem {
 
+class WriteBehindQueue;
+
 class RomFsController;
 class SaveDataController;
 
@@ -124,6 +126,8 @@ private:
     u64 program_id = 0;
     std::shared_ptr<SaveDataController> save_data_controller;
     std::shared_ptr<RomFsController> romfs_controller;
+    /// Shared by the writable save data filesystems of the process, keeping their writes ordered
+    std::shared_ptr<WriteBehindQueue> save_data_write_queue;
 };
 
 } // namespace Service::FileSystem
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -134,6 +137,39 @@ HLERequestContext::HLERequestContext(Kernel::KernelCore& kernel_, Core::Memory::
 
 HLERequestContext::~HLERequestContext() = default;
 
+void HLERequestContext::Reset(Kernel::KServerSession* server_session_, Kernel::KThread* thread_) {
+    cmd_buf[0] = 0;
+    server_session = server_session_;
+    client_handle_table = nullptr;
+    thread = thread_;
+
+    incoming_move_handles.clear();
+    incoming_copy_handles.clear();
+    outgoing_move_objects.clear();
+    outgoing_copy_objects.clear();
+    outgoing_domain_objects.clear();
+
+    command_header.reset();
+    handle_descriptor_header.reset();
+    data_payload_header.reset();
+    domain_message_header.reset();
+    buffer_x_descriptors.clear();
+    buffer_a_descriptors.clear();
+    buffer_b_descriptors.clear();
+    buffer_w_descriptors.clear();
+    buffer_c_descriptors.clear();
+
+    command = 0;
+    pid = 0;
+    write_size = 0;
+    data_payload_offset = 0;
+    handles_offset = 0;
+    domain_offset = 0;
+
+    manager.reset();
+    is_deferred = false;
+}
+
 void HLERequestContext::ParseCommandBuffer(u32_le* src_cmdbuf, bool incoming) {
     IPC::RequestParser rp(src_cmdbuf);
     command_header = rp.PopRaw<IPC::CommandHeader>();
@@ -450,6 +486,44 @@ std::size_t HLERequestContext::WriteBufferC(const void* buffer, std::size_t size
     return size;
 }
 
+std::span<u8> HLERequestContext::GetWriteBuffer(Common::ScratchBuffer<u8>& backup,
+                                                std::size_t buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() > buffer_index &&
+                           BufferDescriptorB()[buffer_index].Size()};
+    return is_buffer_b ? GetWriteBufferB(backup, buffer_index)
+                       : GetWriteBufferC(backup, buffer_index);
+}
+
+std::span<u8> HLERequestContext::GetWriteBufferB(Common::ScratchBuffer<u8>& backup,
+                                                 std::size_t buffer_index) const {
+    if (buffer_index >= BufferDescriptorB().size()) {
+        backup.resize_destructive(0);
+        return {};
+    }
+    return MapWriteBuffer(BufferDescriptorB()[buffer_index].Address(),
+                          BufferDescriptorB()[buffer_index].Size(), backup);
+}
+
+std::span<u8> HLERequestContext::GetWriteBufferC(Common::ScratchBuffer<u8>& backup,
+                                                 std::size_t buffer_index) const {
+    if (buffer_index >= BufferDescriptorC().size()) {
+        backup.resize_destructive(0);
+        return {};
+    }
+    return MapWriteBuffer(BufferDescriptorC()[buffer_index].Address(),
+                          BufferDescriptorC()[buffer_index].Size(), backup);
+}
+
+std::span<u8> HLERequestContext::MapWriteBuffer(VAddr address, std::size_t size,
+                                                Common::ScratchBuffer<u8>& backup) const {
+    if (u8* const ptr = memory.GetWritableSpan(address, size)) {
+        backup.resize_destructive(0);
+        return {ptr, size};
+    }
+    backup.resize_destructive(size);
+    return backup;
+}
+
 std::size_t HLERequestContext::GetReadBufferSize(std::size_t buffer_index) const {
     const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
                            BufferDescriptorA()[buffer_index].Size()};
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -15,6 +18,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/concepts.h"
+#include "common/scratch_buffer.h"
 #include "common/swap.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/k_handle_table.h"
@@ -185,6 +189,12 @@ public:
                                Kernel::KServerSession* session, Kernel::KThread* thread);
     ~HLERequestContext();
 
+    /**
+     * Prepares the context for a new request from the same client process. The descriptor arrays
+     * and the read buffers keep their capacity, so a session does not allocate for each request.
+     */
+    void Reset(Kernel::KServerSession* session, Kernel::KThread* thread);
+
     /// Returns a pointer to the IPC command buffer for this request.
     [[nodiscard]] u32* CommandBuffer() {
         return cmd_buf.data();
@@ -281,6 +291,18 @@ public:
     std::size_t WriteBufferC(const void* buffer, std::size_t size,
                              std::size_t buffer_index = 0) const;
 
+    /**
+     * Helper functions to get a span to fill an output buffer in place. The span refers to guest
+     * memory when the buffer can be written directly, otherwise it refers to the resized backup
+     * and its contents must be written back with the matching WriteBuffer function.
+     */
+    [[nodiscard]] std::span<u8> GetWriteBuffer(Common::ScratchBuffer<u8>& backup,
+                                               std::size_t buffer_index = 0) const;
+    [[nodiscard]] std::span<u8> GetWriteBufferB(Common::ScratchBuffer<u8>& backup,
+                                                std::size_t buffer_index = 0) const;
+    [[nodiscard]] std::span<u8> GetWriteBufferC(Common::ScratchBuffer<u8>& backup,
+                                                std::size_t buffer_index = 0) const;
+
     /* Helper function to write a buffer using the appropriate buffer descriptor
      *
      * @tparam T an arbitrary container that satisfies the
@@ -394,6 +416,9 @@ private:
 
     void ParseCommandBuffer(u32_le* src_cmdbuf, bool incoming);
 
+    std::span<u8> MapWriteBuffer(VAddr address, std::size_t size,
+                                 Common::ScratchBuffer<u8>& backup) const;
+
     std::array<u32, IPC::COMMAND_BUFFER_LENGTH> cmd_buf;
     Kernel::KServerSession* server_session{};
     Kernel::KHandleTable* client_handle_table{};
@@ -9,6 +9,15 @@
 
 namespace Service::LDN {
 
+namespace {
+/// Longest time a scan waits for the hosts to reply
+constexpr auto ScanTimeout = std::chrono::seconds{1};
+/// A scan that has replies completes once no new network replied for this long
+constexpr auto ScanSettleTime = std::chrono::milliseconds{200};
+/// Longest time a connection attempt waits for the host to sync its network
+constexpr auto ConnectTimeout = std::chrono::seconds{1};
+} // Anonymous namespace
+
 LanStation::LanStation(s8 node_id_, LANDiscovery* discovery_)
     : node_info(nullptr), status(NodeStatus::Disconnected), node_id(node_id_),
       discovery(discovery_) {}
@@ -109,17 +118,28 @@ DisconnectReason LANDiscovery::GetDisconnectReason() const {
 
 Result LANDiscovery::Scan(std::span<NetworkInfo> out_networks, s16& out_count,
                           const ScanFilter& filter) {
-    {
-        std::scoped_lock lock{packet_mutex};
-        scan_results.clear();
+    std::unique_lock lock{packet_mutex};
+    scan_results.clear();
 
-        SendBroadcast(Network::LDNPacketType::Scan);
-    }
+    SendBroadcast(Network::LDNPacketType::Scan);
 
     LOG_INFO(Service_LDN, "Waiting for scan replies");
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    // Replies wake the wait, it ends once they stopped coming instead of always taking the timeout
+    const auto deadline = std::chrono::steady_clock::now() + ScanTimeout;
+    std::size_t num_results = 0;
+    while (true) {
+        const auto wait_until =
+            num_results == 0
+                ? deadline
+                : (std::min)(deadline, std::chrono::steady_clock::now() + ScanSettleTime);
+        if (!packet_condition.wait_until(lock, wait_until, [this, num_results] {
+                return scan_results.size() != num_results;
+            })) {
+            break;
+        }
+        num_results = scan_results.size();
+    }
 
-    std::scoped_lock lock{packet_mutex};
     for (const auto& [key, info] : scan_results) {
         if (out_count >= static_cast<s16>(out_networks.size())) {
             break;
@@ -165,6 +185,12 @@ Result LANDiscovery::SetAdvertiseData(std::span<const u8> data) {
         return ResultAdvertiseDataTooLarge;
     }
 
+    // Games set the same data over and over, only changes have to be synced to the stations
+    if (network_info.ldn.advertise_data_size == size &&
+        std::memcmp(network_info.ldn.advertise_data.data(), data.data(), size) == 0) {
+        return ResultSuccess;
+    }
+
     std::memcpy(network_info.ldn.advertise_data.data(), data.data(), size);
     network_info.ldn.advertise_data_size = static_cast<u16>(size);
 
@@ -285,7 +311,7 @@ Result LANDiscovery::DestroyNetwork() {
 
 Result LANDiscovery::Connect(const NetworkInfo& network_info_, const UserConfig& user_config,
                              u16 local_communication_version) {
-    std::scoped_lock lock{packet_mutex};
+    std::unique_lock lock{packet_mutex};
     if (network_info_.ldn.node_count == 0) {
         return ResultInvalidNodeCount;
     }
@@ -302,7 +328,9 @@ Result LANDiscovery::Connect(const NetworkInfo& network_info_, const UserConfig&
 
     InitNodeStateChange();
 
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+    // The host answers with its network, which connects the station
+    packet_condition.wait_for(lock, ConnectTimeout,
+                              [this] { return state == State::StationConnected; });
 
     return ResultSuccess;
 }
@@ -493,6 +521,7 @@ void LANDiscovery::ReceivePacket(const Network::LDNPacket& packet) {
         NetworkInfo info{};
         std::memcpy(&info, packet.data.data(), sizeof(NetworkInfo));
         scan_results.insert({info.common.bssid, info});
+        packet_condition.notify_all();
 
         break;
     }
@@ -548,6 +577,7 @@ void LANDiscovery::ReceivePacket(const Network::LDNPacket& packet) {
             std::memcpy(&info, packet.data.data(), sizeof(NetworkInfo));
 
             OnSyncNetwork(info);
+            packet_condition.notify_all();
         } else {
             LOG_INFO(Frontend, "SyncNetwork packet received but in wrong State!");
         }
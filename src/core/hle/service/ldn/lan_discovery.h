@@ -7,6 +7,7 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <cstring>
 #include <functional>
 #include <memory>
@@ -116,6 +117,8 @@ protected:
 
     bool inited{};
     std::mutex packet_mutex;
+    /// Notified when a scan reply or the network of the host was received
+    std::condition_variable packet_condition;
     std::array<LanStation, StationCountMax> stations;
     std::array<NodeLatestUpdate, NodeCountMax> node_changes{};
     std::array<u8, NodeCountMax> node_last_states{};
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2022 yuzu Emulator Project
 // SPDX-FileCopyrightText: 2022 Skyline Team and Contributors
 // SPDX-License-Identifier: GPL-3.0-or-later
@@ -71,10 +74,16 @@ NvResult NvMap::Handle::Duplicate(bool internal_session) {
 
 NvMap::NvMap(Container& core_, Tegra::Host1x::Host1x& host1x_) : host1x{host1x_}, core{core_} {}
 
-void NvMap::AddHandle(std::shared_ptr<Handle> handle_description) {
-    std::scoped_lock lock(handles_lock);
-
-    handles.emplace(handle_description->id, std::move(handle_description));
+NvMap::HandleSlot* NvMap::FindHandleSlot(Handle::Id handle) {
+    const u32 index{(handle >> HandleIdShift) & HandleSlotMask};
+    if (index >= handle_slots.size()) {
+        return nullptr;
+    }
+    HandleSlot& slot{handle_slots[index]};
+    if (!slot.handle || slot.handle->id != handle) {
+        return nullptr;
+    }
+    return &slot;
 }
 
 void NvMap::UnmapHandle(Handle& handle_description) {
@@ -113,11 +122,12 @@ void NvMap::UnmapHandle(Handle& handle_description) {
 bool NvMap::TryRemoveHandle(const Handle& handle_description) {
     // No dupes left, we can remove from handle map
     if (handle_description.dupes == 0 && handle_description.internal_dupes == 0) {
-        std::scoped_lock lock(handles_lock);
+        std::unique_lock lock(handles_lock);
 
-        auto it{handles.find(handle_description.id)};
-        if (it != handles.end()) {
-            handles.erase(it);
+        if (HandleSlot* const slot{FindHandleSlot(handle_description.id)}) {
+            slot->handle.reset();
+            slot->generation = (slot->generation + 1) & HandleGenerationMask;
+            free_handle_slots.push_back(static_cast<u32>(slot - handle_slots.data()));
         }
 
         return true;
@@ -131,30 +141,40 @@ NvResult NvMap::CreateHandle(u64 size, std::shared_ptr<NvMap::Handle>& result_ou
         return NvResult::BadValue;
     }
 
-    u32 id{next_handle_id.fetch_add(HandleIdIncrement, std::memory_order_relaxed)};
-    auto handle_description{std::make_shared<Handle>(size, id)};
-    AddHandle(handle_description);
+    std::unique_lock lock(handles_lock);
+
+    u32 index;
+    if (!free_handle_slots.empty()) {
+        index = free_handle_slots.back();
+        free_handle_slots.pop_back();
+    } else {
+        index = static_cast<u32>(handle_slots.size());
+        if (index > HandleSlotMask) [[unlikely]] {
+            LOG_ERROR(Service_NVDRV, "Ran out of nvmap handles");
+            return NvResult::InsufficientMemory;
+        }
+        handle_slots.emplace_back();
+    }
+
+    HandleSlot& slot{handle_slots[index]};
+    const Handle::Id id{(slot.generation << (HandleSlotBits + HandleIdShift)) |
+                        (index << HandleIdShift)};
+    slot.handle = std::make_shared<Handle>(size, id);
 
-    result_out = handle_description;
+    result_out = slot.handle;
     return NvResult::Success;
 }
 
 std::shared_ptr<NvMap::Handle> NvMap::GetHandle(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle);
-    } catch (std::out_of_range&) {
-        return nullptr;
-    }
+    std::shared_lock lock(handles_lock);
+    const HandleSlot* const slot{FindHandleSlot(handle)};
+    return slot ? slot->handle : nullptr;
 }
 
 DAddr NvMap::GetHandleAddress(Handle::Id handle) {
-    std::scoped_lock lock(handles_lock);
-    try {
-        return handles.at(handle)->d_address;
-    } catch (std::out_of_range&) {
-        return 0;
-    }
+    std::shared_lock lock(handles_lock);
+    const HandleSlot* const slot{FindHandleSlot(handle)};
+    return slot ? slot->handle->d_address : 0;
 }
 
 DAddr NvMap::PinHandle(NvMap::Handle::Id handle, bool low_area_pin) {
@@ -328,18 +348,25 @@ std::optional<NvMap::FreeInfo> NvMap::FreeHandle(Handle::Id handle, bool interna
 
 void NvMap::UnmapAllHandles(NvCore::SessionId session_id) {
     auto handles_copy = [&] {
-        std::scoped_lock lk{handles_lock};
-        return handles;
+        std::shared_lock lk{handles_lock};
+        std::vector<std::shared_ptr<Handle>> result;
+        result.reserve(handle_slots.size());
+        for (const HandleSlot& slot : handle_slots) {
+            if (slot.handle) {
+                result.push_back(slot.handle);
+            }
+        }
+        return result;
     }();
 
-    for (auto& [id, handle] : handles_copy) {
+    for (auto& handle : handles_copy) {
         {
             std::scoped_lock lk{handle->mutex};
             if (handle->session_id.id != session_id.id || handle->dupes <= 0) {
                 continue;
             }
         }
-        FreeHandle(id, false);
+        FreeHandle(handle->id, false);
     }
 }
 
@@ -1,15 +1,18 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2022 yuzu Emulator Project
 // SPDX-FileCopyrightText: 2022 Skyline Team and Contributors
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #pragma once
 
-#include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <unordered_map>
+#include <shared_mutex>
+#include <vector>
 #include <assert.h>
 
 #include "common/bit_field.h"
@@ -158,16 +161,32 @@ private:
     std::list<std::shared_ptr<Handle>> unmap_queue{};
     std::mutex unmap_queue_lock{}; //!< Protects access to `unmap_queue`
 
-    std::unordered_map<Handle::Id, std::shared_ptr<Handle>>
-        handles{};           //!< Main owning map of handles
-    std::mutex handles_lock; //!< Protects access to `handles`
+    /**
+     * @brief Slot of the handle table, handle IDs hold the index of their slot and the generation
+     * of the slot so that the IDs of freed handles are not found once their slot is reused
+     */
+    struct HandleSlot {
+        std::shared_ptr<Handle> handle;
+        u32 generation{};
+    };
+
+    static constexpr u32 HandleIdShift{2}; //!< Handle IDs are multiples of 4
+    static constexpr u32 HandleSlotBits{18};
+    static constexpr u32 HandleSlotMask{(1U << HandleSlotBits) - 1};
+    static constexpr u32 HandleGenerationBits{32 - HandleSlotBits - HandleIdShift};
+    static constexpr u32 HandleGenerationMask{(1U << HandleGenerationBits) - 1};
+
+    std::vector<HandleSlot> handle_slots{1}; //!< Main owning table of handles, slot 0 is unused
+    std::vector<u32> free_handle_slots;      //!< Slots of freed handles, reused first
+    std::shared_mutex handles_lock; //!< Protects access to `handle_slots` and `free_handle_slots`
 
-    static constexpr u32 HandleIdIncrement{
-        4}; //!< Each new handle ID is an increment of 4 from the previous
-    std::atomic<u32> next_handle_id{HandleIdIncrement};
     Tegra::Host1x::Host1x& host1x;
 
-    void AddHandle(std::shared_ptr<Handle> handle);
+    /**
+     * @brief Finds the slot holding a handle
+     * @note `handles_lock` MUST be locked when calling this
+     */
+    HandleSlot* FindHandleSlot(Handle::Id handle);
 
     /**
      * @brief Unmaps and frees the SMMU memory region a handle is mapped to
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -34,8 +37,9 @@ public:
     void OnOpen(NvCore::SessionId session_id, DeviceFD fd) override;
     void OnClose(DeviceFD fd) override;
 
-    /// Performs a screen flip, compositing each buffer.
-    void Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers);
+    /// Performs a screen flip, compositing each buffer. The swap interval is the number of vsync
+    /// periods the game shows each frame for.
+    void Composite(std::span<const Nvnflinger::HwcLayer> sorted_layers, s32 swap_interval);
 
     Kernel::KEvent* QueryEvent(u32 event_id) override;
 
@@ -11,6 +11,7 @@
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/hle/service/nvdrv/core/container.h"
 #include "core/hle/service/nvdrv/core/nvmap.h"
@@ -273,6 +274,12 @@ NvResult nvhost_as_gpu::Remap(std::span<IoctlRemapEntry> entries) {
         return NvResult::BadValue;
     }
 
+    // Streamed sparse textures remap many adjacent pages, the caches are told about them once
+    gmmu->BeginBatchedUpdate();
+    SCOPE_EXIT {
+        gmmu->EndBatchedUpdate();
+    };
+
     for (const auto& entry : entries) {
         GPUVAddr virtual_address{static_cast<u64>(entry.as_offset_big_pages)
                                  << vm.big_page_size_bits};
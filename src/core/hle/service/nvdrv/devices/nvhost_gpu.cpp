@@ -4,7 +4,6 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <cstring>
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "core/core.h"
@@ -355,13 +354,20 @@ NvResult nvhost_gpu::SubmitGPFIFOImpl(IoctlSubmitGpfifo& params, Tegra::CommandL
 
     auto& flags = params.flags;
 
+    // The fence commands travel with the entries, so the whole submission is a single list
+    auto& prefetch_commands = entries.prefetch_command_list;
+    const auto append = [&prefetch_commands](const auto& commands) {
+        prefetch_commands.insert(prefetch_commands.end(), commands.begin(), commands.end());
+    };
+
     if (flags.fence_wait.Value()) {
         if (flags.increment_value.Value()) {
             return NvResult::BadParameter;
         }
 
         if (!syncpoint_manager.IsFenceSignalled(params.fence)) {
-            gpu.PushGPUEntries(bind_id, Tegra::CommandList{BuildWaitCommandList(params.fence)});
+            append(BuildWaitCommandList(params.fence));
+            entries.num_leading_prefetch_commands = static_cast<u32>(prefetch_commands.size());
         }
     }
 
@@ -370,18 +376,19 @@ NvResult nvhost_gpu::SubmitGPFIFOImpl(IoctlSubmitGpfifo& params, Tegra::CommandL
     u32 increment{(flags.fence_increment.Value() != 0 ? 2 : 0) +
                   (flags.increment_value.Value() != 0 ? params.fence.value : 0)};
     params.fence.value = syncpoint_manager.IncrementSyncpointMaxExt(channel_syncpoint, increment);
-    gpu.PushGPUEntries(bind_id, std::move(entries));
 
     if (flags.fence_increment.Value()) {
         if (flags.suppress_wfi.Value()) {
-            gpu.PushGPUEntries(bind_id,
-                               Tegra::CommandList{BuildIncrementCommandList(params.fence)});
+            append(BuildIncrementCommandList(params.fence));
         } else {
-            gpu.PushGPUEntries(bind_id,
-                               Tegra::CommandList{BuildIncrementWithWfiCommandList(params.fence)});
+            append(BuildIncrementWithWfiCommandList(params.fence));
         }
     }
 
+    if (!entries.command_lists.empty() || !prefetch_commands.empty()) {
+        gpu.PushGPUEntries(bind_id, std::move(entries));
+    }
+
     flags.raw = 0;
 
     return NvResult::Success;
@@ -394,13 +401,13 @@ NvResult nvhost_gpu::SubmitGPFIFOBase1(IoctlSubmitGpfifo& params,
         return NvResult::InvalidSize;
     }
 
-    Tegra::CommandList entries(params.num_entries);
+    Tegra::CommandList entries;
     if (kickoff) {
+        entries.command_lists.resize(params.num_entries, boost::container::default_init);
         system.ApplicationMemory().ReadBlock(params.address, entries.command_lists.data(),
                                              params.num_entries * sizeof(Tegra::CommandListHeader));
     } else {
-        std::memcpy(entries.command_lists.data(), commands.data(),
-                    params.num_entries * sizeof(Tegra::CommandListHeader));
+        entries.command_lists.assign(commands.begin(), commands.begin() + params.num_entries);
     }
 
     return SubmitGPFIFOImpl(params, std::move(entries));
@@ -413,9 +420,8 @@ NvResult nvhost_gpu::SubmitGPFIFOBase2(IoctlSubmitGpfifo& params,
         return NvResult::InvalidSize;
     }
 
-    Tegra::CommandList entries(params.num_entries);
-    std::memcpy(entries.command_lists.data(), commands.data(),
-                params.num_entries * sizeof(Tegra::CommandListHeader));
+    Tegra::CommandList entries;
+    entries.command_lists.assign(commands.begin(), commands.begin() + params.num_entries);
     return SubmitGPFIFOImpl(params, std::move(entries));
 }
 
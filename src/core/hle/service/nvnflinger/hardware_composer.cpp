@@ -133,7 +133,7 @@ u32 HardwareComposer::ComposeLocked(f32* out_speed_scale, Display& display,
                          [&](auto& l, auto& r) { return l.z_index < r.z_index; });
 
         // Composite.
-        nvdisp.Composite(composition_stack);
+        nvdisp.Composite(composition_stack, swap_interval.value_or(1));
     }
 
     // Batch framebuffer releases, instead of one-into-one.
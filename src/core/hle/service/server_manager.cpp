@@ -1,7 +1,11 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/scope_exit.h"
+#include "common/settings.h"
 
 #include "core/core.h"
 #include "core/hle/kernel/k_client_port.h"
@@ -242,6 +246,10 @@ void ServerManager::StartAdditionalHostThreads(const char* name, size_t num_thre
     }
 }
 
+void ServerManager::StartConfiguredHostThreads(const char* name) {
+    this->StartAdditionalHostThreads(name, Settings::values.service_threads.GetValue());
+}
+
 Result ServerManager::LoopProcess() {
     SCOPE_EXIT {
         m_stopped.Set();
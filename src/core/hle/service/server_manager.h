@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -48,8 +51,17 @@ public:
     Result ManageDeferral(Kernel::KEvent** out_event);
 
     Result LoopProcess();
+
+    /**
+     * Starts host threads that wait on and process requests alongside the loop thread. A session
+     * is unlinked from the wait list until its reply is sent, so the requests of a session are
+     * still handled in order while different sessions are handled concurrently.
+     */
     void StartAdditionalHostThreads(const char* name, size_t num_threads);
 
+    /// Starts the number of additional host threads set by the service_threads setting.
+    void StartConfiguredHostThreads(const char* name);
+
     static void RunServer(std::unique_ptr<ServerManager>&& server);
 
 private:
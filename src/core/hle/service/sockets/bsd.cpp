@@ -16,6 +16,7 @@
 #include "core/hle/kernel/k_thread.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/sockets/bsd.h"
+#include "core/hle/service/sockets/socket_poller.h"
 #include "core/hle/service/sockets/sockets_translate.h"
 #include "core/internal_network/network.h"
 #include "core/internal_network/socket_proxy.h"
@@ -103,7 +104,9 @@ void BSD::RecvWork::Execute(BSD* bsd) {
 }
 
 void BSD::RecvWork::Response(HLERequestContext& ctx) {
-    ctx.WriteBuffer(message);
+    if (message_backup->size() != 0) {
+        ctx.WriteBuffer(message);
+    }
 
     IPC::ResponseBuilder rb{ctx, 4};
     rb.Push(ResultSuccess);
@@ -116,7 +119,9 @@ void BSD::RecvFromWork::Execute(BSD* bsd) {
 }
 
 void BSD::RecvFromWork::Response(HLERequestContext& ctx) {
-    ctx.WriteBuffer(message, 0);
+    if (message_backup->size() != 0) {
+        ctx.WriteBuffer(message, 0);
+    }
     if (!addr.empty()) {
         ctx.WriteBuffer(addr, 1);
     }
@@ -358,11 +363,16 @@ void BSD::Recv(HLERequestContext& ctx) {
 
     LOG_DEBUG(Service, "called. fd={} flags=0x{:x} len={}", fd, flags, ctx.GetWriteBufferSize());
 
-    ExecuteWork(ctx, RecvWork{
-                         .fd = fd,
-                         .flags = flags,
-                         .message = std::vector<u8>(ctx.GetWriteBufferSize()),
-                     });
+    // Receive straight into guest memory when the buffer is contiguous
+    Common::ScratchBuffer<u8> message_backup;
+    ExecuteBlockingWork(ctx,
+                        RecvWork{
+                            .fd = fd,
+                            .flags = flags,
+                            .message = ctx.GetWriteBuffer(message_backup),
+                            .message_backup = &message_backup,
+                        },
+                        Network::PollEvents::In);
 }
 
 void BSD::RecvFrom(HLERequestContext& ctx) {
@@ -374,12 +384,16 @@ void BSD::RecvFrom(HLERequestContext& ctx) {
     LOG_DEBUG(Service, "called. fd={} flags=0x{:x} len={} addrlen={}", fd, flags,
               ctx.GetWriteBufferSize(0), ctx.GetWriteBufferSize(1));
 
-    ExecuteWork(ctx, RecvFromWork{
-                         .fd = fd,
-                         .flags = flags,
-                         .message = std::vector<u8>(ctx.GetWriteBufferSize(0)),
-                         .addr = std::vector<u8>(ctx.GetWriteBufferSize(1)),
-                     });
+    Common::ScratchBuffer<u8> message_backup;
+    ExecuteBlockingWork(ctx,
+                        RecvFromWork{
+                            .fd = fd,
+                            .flags = flags,
+                            .message = ctx.GetWriteBuffer(message_backup, 0),
+                            .message_backup = &message_backup,
+                            .addr = std::vector<u8>(ctx.GetWriteBufferSize(1)),
+                        },
+                        Network::PollEvents::In);
 }
 
 void BSD::Send(HLERequestContext& ctx) {
@@ -488,6 +502,40 @@ void BSD::ExecuteWork(HLERequestContext& ctx, Work work) {
     work.Response(ctx);
 }
 
+template <typename Work>
+void BSD::ExecuteBlockingWork(HLERequestContext& ctx, Work work, Network::PollEvents events) {
+    const std::shared_ptr<Network::Socket> socket = GetDeferrableSocket(work.fd, work.flags);
+    if (!socket) {
+        ExecuteWork(ctx, std::move(work));
+        return;
+    }
+    socket_poller->Unwatch(socket.get());
+
+    work.flags |= Network::FLAG_MSG_DONTWAIT;
+    work.Execute(this);
+    if (work.bsd_errno == Errno::AGAIN) {
+        // Leave the command buffer untouched, the request is parsed again when it is retried
+        socket_poller->Watch(socket, events);
+        ctx.SetIsDeferred();
+        return;
+    }
+    work.Response(ctx);
+}
+
+std::shared_ptr<Network::Socket> BSD::GetDeferrableSocket(s32 fd, u32 flags) {
+    if (!socket_poller || !socket_poller->IsEnabled() || fd < 0 ||
+        fd >= static_cast<s32>(MAX_FD) || !file_descriptors[fd]) {
+        return nullptr;
+    }
+    const FileDescriptor& descriptor = *file_descriptors[fd];
+    if ((flags & Network::FLAG_MSG_DONTWAIT) != 0 ||
+        (descriptor.flags & Network::FLAG_O_NONBLOCK) != 0 || descriptor.has_recv_timeout) {
+        return nullptr;
+    }
+    // Proxy sockets of LDN rooms have no host socket to wait on
+    return std::dynamic_pointer_cast<Network::Socket>(descriptor.socket);
+}
+
 std::pair<s32, Errno> BSD::SocketImpl(Domain domain, Type type, Protocol protocol) {
 
     if (type == Type::SEQPACKET) {
@@ -784,6 +832,8 @@ Errno BSD::SetSockOptImpl(s32 fd, u32 level, OptName optname, std::span<const u8
     case OptName::SNDTIMEO:
         return Translate(socket->SetSndTimeo(value));
     case OptName::RCVTIMEO:
+        // Receives that time out have to block, the socket poller has no timeouts
+        file_descriptors[fd]->has_recv_timeout = value != 0;
         return Translate(socket->SetRcvTimeo(value));
     case OptName::NOSIGPIPE:
         LOG_WARNING(Service, "(STUBBED) setting NOSIGPIPE to {}", value);
@@ -802,7 +852,7 @@ Errno BSD::ShutdownImpl(s32 fd, s32 how) {
     return Translate(file_descriptors[fd]->socket->Shutdown(host_how));
 }
 
-std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::vector<u8>& message) {
+std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::span<u8> message) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
     }
@@ -829,7 +879,7 @@ std::pair<s32, Errno> BSD::RecvImpl(s32 fd, u32 flags, std::vector<u8>& message)
     return {ret, bsd_errno};
 }
 
-std::pair<s32, Errno> BSD::RecvFromImpl(s32 fd, u32 flags, std::vector<u8>& message,
+std::pair<s32, Errno> BSD::RecvFromImpl(s32 fd, u32 flags, std::span<u8> message,
                                         std::vector<u8>& addr) {
     if (!IsFileDescriptorValid(fd)) {
         return {-1, Errno::BADF};
@@ -910,6 +960,11 @@ Errno BSD::CloseImpl(s32 fd) {
     if (bsd_errno != Errno::SUCCESS) {
         return bsd_errno;
     }
+    if (socket_poller) {
+        // Deferred requests on the socket fail now that it is closed
+        socket_poller->Unwatch(file_descriptors[fd]->socket.get());
+        socket_poller->SignalCompletion();
+    }
 
     LOG_INFO(Service, "Close socket fd={}", fd);
 
@@ -978,8 +1033,8 @@ void BSD::OnProxyPacketReceived(const Network::ProxyPacket& packet) {
     }
 }
 
-BSD::BSD(Core::System& system_, const char* name)
-    : ServiceFramework{system_, name} {
+BSD::BSD(Core::System& system_, const char* name, std::shared_ptr<SocketPoller> socket_poller_)
+    : ServiceFramework{system_, name}, socket_poller{std::move(socket_poller_)} {
     // clang-format off
     static const FunctionInfo functions[] = {
         {0, &BSD::RegisterClient, "RegisterClient"},
@@ -11,6 +11,7 @@
 
 #include "common/common_types.h"
 #include "common/expected.h"
+#include "common/scratch_buffer.h"
 #include "common/socket_types.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/sockets/sockets.h"
@@ -23,13 +24,17 @@ class System;
 namespace Network {
 class SocketBase;
 class Socket;
+enum class PollEvents : u16;
 } // namespace Network
 
 namespace Service::Sockets {
 
+class SocketPoller;
+
 class BSD final : public ServiceFramework<BSD> {
 public:
-    explicit BSD(Core::System& system_, const char* name);
+    explicit BSD(Core::System& system_, const char* name,
+                 std::shared_ptr<SocketPoller> socket_poller_ = nullptr);
     ~BSD() override;
 
     // These methods are called from SSL; the first two are also called from
@@ -47,6 +52,7 @@ private:
         std::shared_ptr<Network::SocketBase> socket;
         s32 flags = 0;
         bool is_connection_based = false;
+        bool has_recv_timeout = false;
     };
 
     struct PollWork {
@@ -86,7 +92,9 @@ private:
 
         s32 fd;
         u32 flags;
-        std::vector<u8> message;
+        std::span<u8> message;
+        /// Holds the message when the guest buffer can not be written in place
+        const Common::ScratchBuffer<u8>* message_backup;
         s32 ret{};
         Errno bsd_errno{};
     };
@@ -97,7 +105,8 @@ private:
 
         s32 fd;
         u32 flags;
-        std::vector<u8> message;
+        std::span<u8> message;
+        const Common::ScratchBuffer<u8>* message_backup;
         std::vector<u8> addr;
         s32 ret{};
         Errno bsd_errno{};
@@ -154,6 +163,16 @@ private:
     template <typename Work>
     void ExecuteWork(HLERequestContext& ctx, Work work);
 
+    /**
+     * Executes work that blocks until the socket has the given events. Instead of blocking the
+     * service thread, the request is deferred and tried again once the socket poller saw them.
+     */
+    template <typename Work>
+    void ExecuteBlockingWork(HLERequestContext& ctx, Work work, Network::PollEvents events);
+
+    /// Returns the host socket of fd when a blocking receive on it can be deferred
+    std::shared_ptr<Network::Socket> GetDeferrableSocket(s32 fd, u32 flags);
+
     std::pair<s32, Errno> SocketImpl(Domain domain, Type type, Protocol protocol);
     std::pair<s32, Errno> PollImpl(std::vector<u8>& write_buffer, std::span<const u8> read_buffer,
                                    s32 nfds, s32 timeout);
@@ -167,8 +186,8 @@ private:
     Errno GetSockOptImpl(s32 fd, u32 level, OptName optname, std::vector<u8>& optval);
     Errno SetSockOptImpl(s32 fd, u32 level, OptName optname, std::span<const u8> optval);
     Errno ShutdownImpl(s32 fd, s32 how);
-    std::pair<s32, Errno> RecvImpl(s32 fd, u32 flags, std::vector<u8>& message);
-    std::pair<s32, Errno> RecvFromImpl(s32 fd, u32 flags, std::vector<u8>& message,
+    std::pair<s32, Errno> RecvImpl(s32 fd, u32 flags, std::span<u8> message);
+    std::pair<s32, Errno> RecvFromImpl(s32 fd, u32 flags, std::span<u8> message,
                                        std::vector<u8>& addr);
     std::pair<s32, Errno> SendImpl(s32 fd, u32 flags, std::span<const u8> message);
     std::pair<s32, Errno> SendToImpl(s32 fd, u32 flags, std::span<const u8> message,
@@ -181,6 +200,9 @@ private:
 
     std::array<std::optional<FileDescriptor>, MAX_FD> file_descriptors;
 
+    /// Waits for the sockets of deferred requests, shared by the services of the same server
+    std::shared_ptr<SocketPoller> socket_poller;
+
     /// Callback to parse and handle a received wifi packet.
     void OnProxyPacketReceived(const Network::ProxyPacket& packet);
 
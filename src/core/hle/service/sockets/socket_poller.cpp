@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/core.h"
+#include "core/hle/kernel/k_event.h"
+#include "core/hle/service/sockets/socket_poller.h"
+
+namespace Service::Sockets {
+
+namespace {
+// The deferral event can fire before the server manager queued the request that is waiting for
+// it, in which case retrying finds nothing to do. Ready sockets are signaled again until their
+// request runs, for a while, in case that happened.
+constexpr auto RetryInterval = std::chrono::milliseconds{2};
+constexpr auto RetryTimeout = std::chrono::milliseconds{100};
+} // Anonymous namespace
+
+SocketPoller::SocketPoller(Core::System& system_, Kernel::KEvent* completion_event_)
+    : system{system_}, completion_event{completion_event_} {
+    const Network::SockAddrIn loopback{
+        .family = Network::Domain::INET,
+        .ip = {127, 0, 0, 1},
+        .portno = 0,
+    };
+    if (wakeup_socket.Initialize(Network::Domain::INET, Network::Type::DGRAM,
+                                 Network::Protocol::UDP) != Network::Errno::SUCCESS ||
+        wakeup_socket.Bind(loopback) != Network::Errno::SUCCESS) {
+        LOG_WARNING(Service, "Failed to create the socket poller, blocking calls will block");
+        return;
+    }
+    const auto [address, name_errno] = wakeup_socket.GetSockName();
+    if (name_errno != Network::Errno::SUCCESS ||
+        wakeup_socket.Connect(address) != Network::Errno::SUCCESS ||
+        wakeup_socket.SetNonBlock(true) != Network::Errno::SUCCESS) {
+        LOG_WARNING(Service, "Failed to connect the socket poller, blocking calls will block");
+        return;
+    }
+    is_enabled = true;
+    thread = std::jthread([this](std::stop_token stop_token) { ThreadLoop(stop_token); });
+}
+
+SocketPoller::~SocketPoller() {
+    if (thread.joinable()) {
+        thread.request_stop();
+        Wakeup();
+        thread.join();
+    }
+    // The server manager only closes the readable side
+    completion_event->Close();
+}
+
+void SocketPoller::Watch(std::shared_ptr<Network::Socket> socket, Network::PollEvents events) {
+    {
+        std::scoped_lock lock{mutex};
+        entries.push_back(Entry{
+            .socket = std::move(socket),
+            .events = events,
+        });
+    }
+    Wakeup();
+}
+
+void SocketPoller::Unwatch(const Network::SocketBase* socket) {
+    std::scoped_lock lock{mutex};
+    std::erase_if(entries, [socket](const Entry& entry) { return entry.socket.get() == socket; });
+}
+
+void SocketPoller::SignalCompletion() {
+    completion_event->Signal();
+}
+
+void SocketPoller::Wakeup() {
+    static constexpr std::array<u8, 1> wakeup_message{};
+    wakeup_socket.Send(wakeup_message, 0);
+}
+
+void SocketPoller::ThreadLoop(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("SocketPoller");
+    system.RegisterHostThread();
+
+    std::vector<Network::PollFD> pollfds;
+    // Keeps the polled sockets alive when they are unwatched during the poll
+    std::vector<std::shared_ptr<Network::Socket>> polled_sockets;
+    while (!stop_token.stop_requested()) {
+        bool has_signaled{};
+        pollfds.clear();
+        polled_sockets.clear();
+        pollfds.push_back({&wakeup_socket, Network::PollEvents::In, Network::PollEvents{}});
+        {
+            std::scoped_lock lock{mutex};
+            for (const Entry& entry : entries) {
+                if (entry.is_signaled) {
+                    has_signaled = true;
+                    continue;
+                }
+                pollfds.push_back({entry.socket.get(), entry.events, Network::PollEvents{}});
+                polled_sockets.push_back(entry.socket);
+            }
+        }
+
+        const s32 timeout = has_signaled ? static_cast<s32>(RetryInterval.count()) : -1;
+        const auto [result, poll_errno] = Network::Poll(pollfds, timeout);
+        if (stop_token.stop_requested()) {
+            break;
+        }
+        if (result < 0) {
+            LOG_ERROR(Service, "Socket poll failed, errno={}", poll_errno);
+            std::this_thread::sleep_for(RetryInterval);
+            continue;
+        }
+        if (pollfds.front().revents != Network::PollEvents{}) {
+            std::array<u8, 16> drain;
+            while (wakeup_socket.Recv(0, drain).first > 0) {
+            }
+        }
+
+        bool signal = has_signaled;
+        const auto now = std::chrono::steady_clock::now();
+        {
+            std::scoped_lock lock{mutex};
+            for (auto it = pollfds.begin() + 1; it != pollfds.end(); ++it) {
+                if (it->revents == Network::PollEvents{}) {
+                    continue;
+                }
+                for (Entry& entry : entries) {
+                    if (entry.socket.get() == it->socket && !entry.is_signaled) {
+                        entry.is_signaled = true;
+                        entry.signaled_at = now;
+                        signal = true;
+                    }
+                }
+            }
+            std::erase_if(entries, [now](const Entry& entry) {
+                return entry.is_signaled && now - entry.signaled_at > RetryTimeout;
+            });
+        }
+        if (signal) {
+            completion_event->Signal();
+        }
+    }
+}
+
+} // namespace Service::Sockets
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/polyfill_thread.h"
+#include "core/internal_network/network.h"
+#include "core/internal_network/sockets.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel {
+class KEvent;
+}
+
+namespace Service::Sockets {
+
+/**
+ * Waits for host sockets to become ready on behalf of deferred BSD requests, so a blocking call
+ * does not hold a service thread while it waits. Readiness signals the deferral event of the
+ * server manager, which retries the deferred requests.
+ */
+class SocketPoller {
+public:
+    explicit SocketPoller(Core::System& system_, Kernel::KEvent* completion_event_);
+    ~SocketPoller();
+
+    YUZU_NON_COPYABLE(SocketPoller);
+    YUZU_NON_MOVEABLE(SocketPoller);
+
+    /// Returns false when the poller could not be set up and blocking calls have to block.
+    [[nodiscard]] bool IsEnabled() const noexcept {
+        return is_enabled;
+    }
+
+    /// Signals the completion event once the socket has any of the events or an error.
+    void Watch(std::shared_ptr<Network::Socket> socket, Network::PollEvents events);
+
+    /// Stops waiting for the socket, called before a deferred request on it is tried again.
+    void Unwatch(const Network::SocketBase* socket);
+
+    /// Makes the server manager retry the deferred requests now, e.g. after a socket was closed.
+    void SignalCompletion();
+
+private:
+    struct Entry {
+        std::shared_ptr<Network::Socket> socket;
+        Network::PollEvents events;
+        /// Set once the socket became ready, until the deferred request is tried again
+        std::chrono::steady_clock::time_point signaled_at{};
+        bool is_signaled{};
+    };
+
+    void ThreadLoop(std::stop_token stop_token);
+
+    /// Interrupts the host poll so it picks up the new entries.
+    void Wakeup();
+
+    Core::System& system;
+    Kernel::KEvent* const completion_event;
+
+    /// Loopback socket connected to itself, written to interrupt the host poll
+    Network::Socket wakeup_socket;
+    bool is_enabled{};
+
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    std::jthread thread;
+};
+
+} // namespace Service::Sockets
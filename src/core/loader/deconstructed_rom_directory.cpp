@@ -4,7 +4,9 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cstring>
+#include <thread>
 #include "common/logging/log.h"
 #include "common/settings.h"
 #include "core/core.h"
@@ -188,6 +190,25 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
                                        "subsdk3", "subsdk4", "subsdk5", "subsdk6", "subsdk7",
                                        "subsdk8", "subsdk9", "sdk"};
 
+    // Decompress every module up front, both passes below need them. The files are read in order
+    // while the segments that were already read decompress on the workers.
+    std::array<std::optional<NSOSegments>, static_modules.size()> module_segments;
+    {
+        Common::ThreadWorker workers{std::clamp(std::thread::hardware_concurrency(), 1U, 8U),
+                                     "NSOLoader"};
+        for (size_t i = 0; i < static_modules.size(); i++) {
+            const FileSys::VirtualFile module_file{dir->GetFile(static_modules[i])};
+            if (!module_file) {
+                continue;
+            }
+            if (!AppLoader_NSO::ReadSegments(*module_file, module_segments[i].emplace(),
+                                             &workers)) {
+                return {ResultStatus::ErrorLoadingNSO, {}};
+            }
+        }
+        workers.WaitForRequests();
+    }
+
     std::size_t code_size{};
 
     // Define an nce patch context for each potential module.
@@ -196,14 +217,13 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
     // Use the NSO module loader to figure out the code layout
     for (size_t i = 0; i < static_modules.size(); i++) {
         const auto& module = static_modules[i];
-        const FileSys::VirtualFile module_file{dir->GetFile(module)};
-        if (!module_file) {
+        if (!module_segments[i]) {
             continue;
         }
 
         const bool should_pass_arguments = std::strcmp(module, "rtld") == 0;
         const auto tentative_next_load_addr = AppLoader_NSO::LoadModule(
-            process, system, *module_file, code_size, should_pass_arguments, false, {},
+            process, system, *module_segments[i], code_size, should_pass_arguments, false, {},
             patch_ctx.GetPatchers(), patch_ctx.GetLastIndex());
         if (!tentative_next_load_addr) {
             return {ResultStatus::ErrorLoadingNSO, {}};
@@ -244,15 +264,14 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
                                    system.GetContentProvider()};
     for (size_t i = 0; i < static_modules.size(); i++) {
         const auto& module = static_modules[i];
-        const FileSys::VirtualFile module_file{dir->GetFile(module)};
-        if (!module_file) {
+        if (!module_segments[i]) {
             continue;
         }
 
         const VAddr load_addr{next_load_addr};
         const bool should_pass_arguments = std::strcmp(module, "rtld") == 0;
         const auto tentative_next_load_addr = AppLoader_NSO::LoadModule(
-            process, system, *module_file, load_addr, should_pass_arguments, true, pm,
+            process, system, *module_segments[i], load_addr, should_pass_arguments, true, pm,
             patch_ctx.GetPatchers(), patch_ctx.GetIndex(i));
         if (!tentative_next_load_addr) {
             return {ResultStatus::ErrorLoadingNSO, {}};
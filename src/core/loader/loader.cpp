@@ -76,9 +76,9 @@ FileType GuessFromFilename(const std::string& name) {
         return FileType::NSO;
     else if (extension == "nca")
         return FileType::NCA;
-    else if (extension == "xci")
+    else if (extension == "xci" || extension == "xcz")
         return FileType::XCI;
-    else if (extension == "nsp")
+    else if (extension == "nsp" || extension == "nsz")
         return FileType::NSP;
     else if (extension == "kip")
         return FileType::KIP;
@@ -4,8 +4,13 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <stop_token>
+#include <thread>
 #include <utility>
+#include <vector>
 
+#include "common/bounded_threadsafe_queue.h"
 #include "common/hex_util.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
@@ -147,9 +152,6 @@ ResultStatus AppLoader_NCA::VerifyIntegrity(std::function<bool(size_t, size_t)>
     const auto input_hash =
         Common::HexStringToVector(file->GetName().substr(0, NcaFileNameHashLength), false);
 
-    // Declare buffer to read into.
-    std::vector<u8> buffer(4_MiB);
-
     // Initialize sha256 verification context.
     mbedtls_sha256_context ctx;
     mbedtls_sha256_init(&ctx);
@@ -164,17 +166,53 @@ ResultStatus AppLoader_NCA::VerifyIntegrity(std::function<bool(size_t, size_t)>
     const size_t total_size = file->GetSize();
     size_t processed_size = 0;
 
+    // Declare buffers to read into, the next ones are read while the current one is hashed.
+    struct HashBlock {
+        size_t index;
+        size_t size; ///< Zero once the reader is done
+    };
+    constexpr size_t NumBlocks = 4;
+    std::array<std::vector<u8>, NumBlocks> buffers;
+    Common::SPSCQueue<size_t, NumBlocks> free_blocks;
+    // Room for every block and the end marker, so the reader never waits to push them.
+    Common::SPSCQueue<HashBlock, NumBlocks * 2> read_blocks;
+    for (size_t i = 0; i < NumBlocks; ++i) {
+        buffers[i].resize(4_MiB);
+        free_blocks.EmplaceWait(i);
+    }
+
     // Begin iterating the file.
-    while (processed_size < total_size) {
-        // Refill the buffer.
-        const size_t intended_read_size = (std::min)(buffer.size(), total_size - processed_size);
-        const size_t read_size = file->Read(buffer.data(), intended_read_size, processed_size);
+    std::jthread reader([&](std::stop_token stop_token) {
+        size_t offset = 0;
+        while (offset < total_size) {
+            const size_t index = free_blocks.PopWait(stop_token);
+            if (stop_token.stop_requested()) {
+                return;
+            }
+            std::vector<u8>& buffer = buffers[index];
+            const size_t intended_read_size = (std::min)(buffer.size(), total_size - offset);
+            const size_t read_size = file->Read(buffer.data(), intended_read_size, offset);
+            if (read_size == 0) {
+                break;
+            }
+            read_blocks.EmplaceWait(HashBlock{.index = index, .size = read_size});
+            offset += read_size;
+        }
+        read_blocks.EmplaceWait(HashBlock{.index = 0, .size = 0});
+    });
+
+    while (true) {
+        const HashBlock block = read_blocks.PopWait();
+        if (block.size == 0) {
+            break;
+        }
 
         // Update the hash function with the buffer contents.
-        mbedtls_sha256_update(&ctx, buffer.data(), read_size);
+        mbedtls_sha256_update(&ctx, buffers[block.index].data(), block.size);
+        free_blocks.EmplaceWait(block.index);
 
         // Update counters.
-        processed_size += read_size;
+        processed_size += block.size;
 
         // Call the progress function.
         if (!progress_callback(processed_size, total_size)) {
@@ -182,6 +220,11 @@ ResultStatus AppLoader_NCA::VerifyIntegrity(std::function<bool(size_t, size_t)>
         }
     }
 
+    if (processed_size != total_size) {
+        LOG_ERROR(Loader, "Failed to read NCA {} past offset {:#x}", name, processed_size);
+        return ResultStatus::ErrorIntegrityVerificationFailed;
+    }
+
     // Finalize context and compute the output hash.
     std::array<u8, NcaSha256HashLength> output_hash;
     mbedtls_sha256_finish(&ctx, output_hash.data());
@@ -8,6 +8,8 @@
 #include <cstring>
 #include <vector>
 
+#include <mbedtls/sha256.h>
+
 #include "common/common_funcs.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
@@ -51,6 +53,15 @@ std::vector<u8> DecompressSegment(const std::vector<u8>& compressed_data,
     return uncompressed_data;
 }
 
+void VerifySegmentHash(const std::vector<u8>& data, const NSOHeader& header, size_t segment_num,
+                       const std::string& name) {
+    NSOHeader::SHA256Hash hash{};
+    mbedtls_sha256(data.data(), data.size(), hash.data(), 0);
+    if (hash != header.segment_hashes[segment_num]) {
+        LOG_WARNING(Loader, "Segment {} of {} doesn't match its hash", segment_num, name);
+    }
+}
+
 constexpr u32 PageAlignSize(u32 size) {
     return static_cast<u32>((size + Core::Memory::YUZU_PAGEMASK) & ~Core::Memory::YUZU_PAGEMASK);
 }
@@ -61,6 +72,11 @@ bool NSOHeader::IsSegmentCompressed(size_t segment_num) const {
     return ((flags >> segment_num) & 1) != 0;
 }
 
+bool NSOHeader::IsSegmentHashChecked(size_t segment_num) const {
+    ASSERT_MSG(segment_num < 3, "Invalid segment {}", segment_num);
+    return ((flags >> (segment_num + 3)) & 1) != 0;
+}
+
 AppLoader_NSO::AppLoader_NSO(FileSys::VirtualFile file_) : AppLoader(std::move(file_)) {}
 
 FileType AppLoader_NSO::IdentifyType(const FileSys::VirtualFile& in_file) {
@@ -76,24 +92,68 @@ FileType AppLoader_NSO::IdentifyType(const FileSys::VirtualFile& in_file) {
     return FileType::NSO;
 }
 
-std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::System& system,
-                                               const FileSys::VfsFile& nso_file, VAddr load_base,
-                                               bool should_pass_arguments, bool load_into_process,
-                                               std::optional<FileSys::PatchManager> pm,
-                                               std::vector<Core::NCE::Patcher>* patches,
-                                               s32 patch_index) {
+bool AppLoader_NSO::ReadSegments(const FileSys::VfsFile& nso_file, NSOSegments& out_segments,
+                                 Common::ThreadWorker* workers) {
     if (nso_file.GetSize() < sizeof(NSOHeader)) {
-        return std::nullopt;
+        return false;
     }
 
-    NSOHeader nso_header{};
+    NSOHeader& nso_header = out_segments.header;
     if (sizeof(NSOHeader) != nso_file.ReadObject(&nso_header)) {
-        return std::nullopt;
+        return false;
     }
 
     if (nso_header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
+        return false;
+    }
+
+    out_segments.name = nso_file.GetName();
+    for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
+        out_segments.data[i] = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
+                                                  nso_header.segments[i].offset);
+        if (!nso_header.IsSegmentCompressed(i) && !nso_header.IsSegmentHashChecked(i)) {
+            continue;
+        }
+        // The segments are independent once read, decompress and hash them concurrently.
+        auto decompress = [&out_segments, i] {
+            std::vector<u8>& data = out_segments.data[i];
+            if (out_segments.header.IsSegmentCompressed(i)) {
+                data = DecompressSegment(data, out_segments.header.segments[i]);
+            }
+            if (out_segments.header.IsSegmentHashChecked(i)) {
+                VerifySegmentHash(data, out_segments.header, i, out_segments.name);
+            }
+        };
+        if (workers) {
+            workers->QueueWork(std::move(decompress));
+        } else {
+            decompress();
+        }
+    }
+    return true;
+}
+
+std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::System& system,
+                                               const FileSys::VfsFile& nso_file, VAddr load_base,
+                                               bool should_pass_arguments, bool load_into_process,
+                                               std::optional<FileSys::PatchManager> pm,
+                                               std::vector<Core::NCE::Patcher>* patches,
+                                               s32 patch_index) {
+    NSOSegments nso;
+    if (!ReadSegments(nso_file, nso)) {
         return std::nullopt;
     }
+    return LoadModule(process, system, nso, load_base, should_pass_arguments, load_into_process,
+                      std::move(pm), patches, patch_index);
+}
+
+std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::System& system,
+                                               const NSOSegments& nso, VAddr load_base,
+                                               bool should_pass_arguments, bool load_into_process,
+                                               std::optional<FileSys::PatchManager> pm,
+                                               std::vector<Core::NCE::Patcher>* patches,
+                                               s32 patch_index) {
+    const NSOHeader& nso_header = nso.header;
 
     // Allocate some space at the beginning if we are patching in PreText mode.
     const size_t module_start = [&]() -> size_t {
@@ -112,11 +172,7 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     Kernel::CodeSet codeset;
     Kernel::PhysicalMemory program_image;
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
-                                                  nso_header.segments[i].offset);
-        if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
-        }
+        const std::vector<u8>& data = nso.data[i];
         program_image.resize(module_start + nso_header.segments[i].location +
                              static_cast<u32>(data.size()));
         std::memcpy(program_image.data() + module_start + nso_header.segments[i].location,
@@ -150,7 +206,7 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     }
 
     // Apply patches if necessary
-    const auto name = nso_file.GetName();
+    const auto& name = nso.name;
     if (pm && (pm->HasNSOPatch(nso_header.build_id, name) || Settings::values.dump_nso)) {
         std::span<u8> patchable_section(program_image.data() + module_start,
                                         program_image.size() - module_start);
@@ -5,9 +5,12 @@
 
 #include <array>
 #include <optional>
+#include <string>
 #include <type_traits>
+#include <vector>
 #include "common/common_types.h"
 #include "common/swap.h"
+#include "common/thread_worker.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/loader/loader.h"
 
@@ -58,6 +61,7 @@ struct NSOHeader {
     std::array<SHA256Hash, 3> segment_hashes;
 
     bool IsSegmentCompressed(size_t segment_num) const;
+    bool IsSegmentHashChecked(size_t segment_num) const;
 };
 static_assert(sizeof(NSOHeader) == 0x100, "NSOHeader has incorrect size.");
 static_assert(std::is_trivially_copyable_v<NSOHeader>, "NSOHeader must be trivially copyable.");
@@ -71,6 +75,13 @@ struct NSOArgumentHeader {
 };
 static_assert(sizeof(NSOArgumentHeader) == 0x20, "NSOArgumentHeader has incorrect size.");
 
+/// Decompressed segments of an NSO file, read ahead of loading the module.
+struct NSOSegments {
+    std::string name;
+    NSOHeader header;
+    std::array<std::vector<u8>, 3> data;
+};
+
 /// Loads an NSO file
 class AppLoader_NSO final : public AppLoader {
 public:
@@ -89,6 +100,16 @@ public:
         return IdentifyType(file);
     }
 
+    /**
+     * Reads the segments of an NSO file, then decompresses them and verifies the hashes that the
+     * header asks for. The file is read on the calling thread. When workers isn't null, the
+     * decompression is queued on it and the segments are only complete after WaitForRequests.
+     *
+     * @return false if the file isn't a valid NSO.
+     */
+    static bool ReadSegments(const FileSys::VfsFile& nso_file, NSOSegments& out_segments,
+                             Common::ThreadWorker* workers = nullptr);
+
     static std::optional<VAddr> LoadModule(Kernel::KProcess& process, Core::System& system,
                                            const FileSys::VfsFile& nso_file, VAddr load_base,
                                            bool should_pass_arguments, bool load_into_process,
@@ -96,6 +117,13 @@ public:
                                            std::vector<Core::NCE::Patcher>* patches = nullptr,
                                            s32 patch_index = -1);
 
+    static std::optional<VAddr> LoadModule(Kernel::KProcess& process, Core::System& system,
+                                           const NSOSegments& nso, VAddr load_base,
+                                           bool should_pass_arguments, bool load_into_process,
+                                           std::optional<FileSys::PatchManager> pm = {},
+                                           std::vector<Core::NCE::Patcher>* patches = nullptr,
+                                           s32 patch_index = -1);
+
     LoadResult Load(Kernel::KProcess& process, Core::System& system) override;
 
     ResultStatus ReadNSOModules(Modules& out_modules) override;
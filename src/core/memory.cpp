@@ -59,6 +59,12 @@ struct Memory::Impl {
         } else {
             current_page_table->fastmem_arena = nullptr;
         }
+        // Watched writes are not seen until they are gathered, reactive flushing needs reads to
+        // be trapped and native code handles its own faults.
+        write_watch = current_page_table->fastmem_arena &&
+                      system.DeviceMemory().buffer.IsWriteWatchEnabled() &&
+                      !Settings::values.use_reactive_flushing.GetValue() &&
+                      !Settings::IsNceEnabled();
 
 #ifdef __linux__
         heap_tracker.emplace(system.DeviceMemory().buffer);
@@ -358,6 +364,21 @@ struct Memory::Impl {
         return nullptr;
     }
 
+    u8* GetWritableSpan(const VAddr dest_addr, const std::size_t size) {
+        u8* const span = GetSpan(dest_addr, size);
+        if (span == nullptr || size == 0) {
+            return nullptr;
+        }
+        // Writes through the span bypass the rasterizer, so only regular memory can be handed out.
+        const u64 last_page = (dest_addr + size - 1) >> YUZU_PAGEBITS;
+        for (u64 page = dest_addr >> YUZU_PAGEBITS; page <= last_page; ++page) {
+            if (current_page_table->pointers[page].Type() != Common::PageType::Memory) {
+                return nullptr;
+            }
+        }
+        return span;
+    }
+
     template <bool UNSAFE>
     bool WriteBlockImpl(const Common::ProcessAddress dest_addr, const void* src_buffer,
                         const std::size_t size) {
@@ -558,9 +579,11 @@ struct Memory::Impl {
             return;
         }
 
-        if (current_page_table->fastmem_arena) {
+        if (write_watch) {
+            system.DeviceMemory().buffer.WatchWrites(vaddr, size, cached);
+        } else if (current_page_table->fastmem_arena) {
             Common::MemoryPermission perm{};
-            if (!Settings::values.use_reactive_flushing.GetValue() || !cached) {
+            if (!Settings::RuntimeSnapshot().use_reactive_flushing || !cached) {
                 perm |= Common::MemoryPermission::Read;
             }
             if (!cached) {
@@ -662,21 +685,21 @@ struct Memory::Impl {
                 base += 1;
             }
         } else {
-            auto orig_base = base;
+            // The backing is linear, so every page of the range stores the same offsets
+            const auto host_ptr =
+                reinterpret_cast<uintptr_t>(system.DeviceMemory().GetPointer<u8>(target)) -
+                (base << YUZU_PAGEBITS);
+            const auto backing = GetInteger(target) - (base << YUZU_PAGEBITS);
+            const auto block = base << YUZU_PAGEBITS;
+            ASSERT_MSG(Common::PageTable::PageInfo::ExtractPointer(host_ptr),
+                       "memory mapping base yield a nullptr within the table");
+
+            // Readers load the entries relaxed, large heaps are mapped without a fence per page
             while (base != end) {
-                auto host_ptr =
-                    reinterpret_cast<uintptr_t>(system.DeviceMemory().GetPointer<u8>(target)) -
-                    (base << YUZU_PAGEBITS);
-                auto backing = GetInteger(target) - (base << YUZU_PAGEBITS);
-                page_table.pointers[base].Store(host_ptr, type);
+                page_table.pointers[base].Store(host_ptr, type, std::memory_order_release);
                 page_table.backing_addr[base] = backing;
-                page_table.blocks[base] = orig_base << YUZU_PAGEBITS;
-
-                ASSERT_MSG(page_table.pointers[base].Pointer(),
-                           "memory mapping base yield a nullptr within the table");
-
+                page_table.blocks[base] = block;
                 base += 1;
-                target += YUZU_PAGESIZE;
             }
         }
     }
@@ -987,6 +1010,17 @@ struct Memory::Impl {
         PAddr last_address;
     };
 
+    void GatherWatchedWrites() {
+        if (!write_watch) {
+            return;
+        }
+        system.DeviceMemory().buffer.CollectWrites([this](size_t offset, size_t length) {
+            for (u64 vaddr = offset; vaddr < offset + length; vaddr += YUZU_PAGESIZE) {
+                HandleRasterizerWrite(vaddr, YUZU_PAGESIZE);
+            }
+        });
+    }
+
     void InvalidateGPUMemory(u8* p, size_t size) {
         constexpr size_t sys_core = Core::Hardware::NUM_CPU_CORES - 1;
         const size_t core = (std::min)(system.GetCurrentHostThreadID(),
@@ -1011,6 +1045,7 @@ struct Memory::Impl {
     Core::System& system;
     Tegra::MaxwellDeviceMemoryManager* gpu_device_memory{};
     Common::PageTable* current_page_table = nullptr;
+    bool write_watch{};
 
     // Number of threads to use for parallel memory operations
     unsigned int thread_count = 2;
@@ -1172,6 +1207,10 @@ u8* Memory::GetSpan(const VAddr src_addr, const std::size_t size) {
     return impl->GetSpan(src_addr, size);
 }
 
+u8* Memory::GetWritableSpan(const VAddr dest_addr, const std::size_t size) {
+    return impl->GetWritableSpan(dest_addr, size);
+}
+
 bool Memory::WriteBlock(const Common::ProcessAddress dest_addr, const void* src_buffer,
                         const std::size_t size) {
     return impl->WriteBlock(dest_addr, src_buffer, size);
@@ -1211,6 +1250,10 @@ void Memory::RasterizerMarkRegionCached(Common::ProcessAddress vaddr, u64 size,
     impl->RasterizerMarkRegionCached(GetInteger(vaddr), size, cached);
 }
 
+void Memory::GatherWatchedWrites() {
+    impl->GatherWatchedWrites();
+}
+
 void Memory::MarkRegionDebug(Common::ProcessAddress vaddr, u64 size, bool debug) {
     impl->MarkRegionDebug(GetInteger(vaddr), size, debug);
 }
@@ -374,6 +374,18 @@ public:
     const u8* GetSpan(const VAddr src_addr, const std::size_t size) const;
     u8* GetSpan(const VAddr src_addr, const std::size_t size);
 
+    /**
+     * Gets a pointer to a range of the current process' address space that can be written to
+     * directly, as long as the range is contiguous in host memory and no page of it is cached by
+     * the rasterizer.
+     *
+     * @param dest_addr The virtual address of the start of the range.
+     * @param size      The size of the range, in bytes.
+     *
+     * @returns The host pointer of the range, or nullptr if it must be written with WriteBlock.
+     */
+    u8* GetWritableSpan(VAddr dest_addr, std::size_t size);
+
     /**
      * Writes a range of bytes into the current process' address space at the specified
      * virtual address.
@@ -491,6 +503,12 @@ public:
      */
     void MarkRegionDebug(Common::ProcessAddress vaddr, u64 size, bool debug);
 
+    /**
+     * Reports the CPU writes to cached memory found since the last call, when they are watched
+     * instead of trapped by the fastmem arena.
+     */
+    void GatherWatchedWrites();
+
     void SetGPUDirtyManagers(std::span<Core::GPUDirtyMemoryManager> managers);
 
     bool InvalidateNCE(Common::ProcessAddress vaddr, size_t size);
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -634,30 +637,69 @@ bool DmntCheatVm::DecodeNextOpcode(CheatVmOpcode& out) {
     return valid;
 }
 
-void DmntCheatVm::SkipConditionalBlock(bool is_if) {
-    if (condition_depth > 0) {
-        // We want to continue until we're out of the current block.
-        const std::size_t desired_depth = condition_depth - 1;
+void DmntCheatVm::CompileProgram() {
+    compiled_program.clear();
+    instruction_ptr = 0;
+    decode_success = true;
 
-        CheatVmOpcode skip_opcode{};
-        while (condition_depth > desired_depth && DecodeNextOpcode(skip_opcode)) {
-            // Decode instructions until we see end of the current conditional block.
-            // NOTE: This is broken in gateway's implementation.
-            // Gateway currently checks for "0x2" instead of "0x20000000"
-            // In addition, they do a linear scan instead of correctly decoding opcodes.
-            // This causes issues if "0x2" appears as an immediate in the conditional block...
+    // Opcodes are decoded in program order whichever way they run, so the program is decoded once
+    // up to the first invalid opcode, where execution would stop.
+    CheatVmOpcode opcode{};
+    while (DecodeNextOpcode(opcode)) {
+        compiled_program.push_back({
+            .opcode = opcode,
+            .next_instruction_ptr = instruction_ptr,
+        });
+    }
+
+    // Resolve the opcode after each conditional block and else branch. Blocks support nesting
+    // and a block that is never closed runs until the end of the program.
+    // NOTE: This is broken in gateway's implementation.
+    // Gateway currently checks for "0x2" instead of "0x20000000"
+    // In addition, they do a linear scan instead of correctly decoding opcodes.
+    // This causes issues if "0x2" appears as an immediate in the conditional block...
+    const std::size_t num_compiled = compiled_program.size();
+    for (std::size_t i = 0; i < num_compiled; i++) {
+        CompiledOpcode& compiled = compiled_program[i];
+        const auto end_cond = std::get_if<EndConditionalOpcode>(&compiled.opcode.opcode);
+        const bool is_if = compiled.opcode.begin_conditional_block;
+        if (!is_if && !(end_cond && end_cond->is_else)) {
+            continue;
+        }
 
-            // We also support nesting of conditional blocks, and Gateway does not.
+        compiled.skip_target = num_compiled;
+        std::size_t depth = 1;
+        for (std::size_t j = i + 1; j < num_compiled; j++) {
+            const CheatVmOpcode& skip_opcode = compiled_program[j].opcode;
             if (skip_opcode.begin_conditional_block) {
-                condition_depth++;
-            } else if (auto end_cond = std::get_if<EndConditionalOpcode>(&skip_opcode.opcode)) {
-                if (!end_cond->is_else) {
-                    condition_depth--;
-                } else if (is_if && condition_depth - 1 == desired_depth) {
+                depth++;
+                continue;
+            }
+            const auto skip_end = std::get_if<EndConditionalOpcode>(&skip_opcode.opcode);
+            if (skip_end == nullptr) {
+                continue;
+            }
+            if (!skip_end->is_else) {
+                if (--depth == 0) {
+                    compiled.skip_target = j + 1;
                     break;
                 }
+            } else if (is_if && depth == 1) {
+                compiled.skip_target = j + 1;
+                compiled.skip_enters_else = true;
+                break;
             }
         }
+    }
+}
+
+void DmntCheatVm::SkipConditionalBlock(const CompiledOpcode& opcode, bool is_if) {
+    if (condition_depth > 0) {
+        // Continue after the current block, or in its else branch at the same depth.
+        opcode_index = opcode.skip_target;
+        if (!is_if || !opcode.skip_enters_else) {
+            condition_depth--;
+        }
     } else {
         // Skipping, but condition_depth = 0.
         // This is an error condition.
@@ -704,6 +746,7 @@ void DmntCheatVm::ResetState() {
     saved_values.fill(0);
     loop_tops.fill(0);
     instruction_ptr = 0;
+    opcode_index = 0;
     condition_depth = 0;
     decode_success = true;
 }
@@ -717,6 +760,7 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
             // Bounds check.
             if (entries[i].definition.num_opcodes + num_opcodes > MaximumProgramOpcodeCount) {
                 num_opcodes = 0;
+                compiled_program.clear();
                 return false;
             }
 
@@ -726,36 +770,47 @@ bool DmntCheatVm::LoadProgram(const std::vector<CheatEntry>& entries) {
         }
     }
 
+    CompileProgram();
     return true;
 }
 
 void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
-    CheatVmOpcode cur_opcode{};
-
     // Get Keys down.
     u64 kDown = callbacks->HidKeysDown();
 
-    callbacks->CommandLog("Started VM execution.");
-    callbacks->CommandLog(fmt::format("Main NSO:  {:012X}", metadata.main_nso_extents.base));
-    callbacks->CommandLog(fmt::format("Heap:      {:012X}", metadata.main_nso_extents.base));
-    callbacks->CommandLog(fmt::format("Keys Down: {:08X}", static_cast<u32>(kDown & 0x0FFFFFFF)));
+    // The trace formats every register for every opcode, only build it when it is logged.
+    const bool log_commands = callbacks->IsCommandLogEnabled();
+    if (log_commands) {
+        callbacks->CommandLog("Started VM execution.");
+        callbacks->CommandLog(fmt::format("Main NSO:  {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(fmt::format("Heap:      {:012X}", metadata.main_nso_extents.base));
+        callbacks->CommandLog(
+            fmt::format("Keys Down: {:08X}", static_cast<u32>(kDown & 0x0FFFFFFF)));
+    }
 
     // Clear VM state.
     ResetState();
 
     // Loop until program finishes.
-    while (DecodeNextOpcode(cur_opcode)) {
-        callbacks->CommandLog(
-            fmt::format("Instruction Ptr: {:04X}", static_cast<u32>(instruction_ptr)));
+    while (opcode_index < compiled_program.size()) {
+        const CompiledOpcode& compiled = compiled_program[opcode_index++];
+        const CheatVmOpcode& cur_opcode = compiled.opcode;
+        instruction_ptr = compiled.next_instruction_ptr;
 
-        for (std::size_t i = 0; i < NumRegisters; i++) {
-            callbacks->CommandLog(fmt::format("Registers[{:02X}]: {:016X}", i, registers[i]));
-        }
+        if (log_commands) {
+            callbacks->CommandLog(
+                fmt::format("Instruction Ptr: {:04X}", static_cast<u32>(instruction_ptr)));
 
-        for (std::size_t i = 0; i < NumRegisters; i++) {
-            callbacks->CommandLog(fmt::format("SavedRegs[{:02X}]: {:016X}", i, saved_values[i]));
+            for (std::size_t i = 0; i < NumRegisters; i++) {
+                callbacks->CommandLog(fmt::format("Registers[{:02X}]: {:016X}", i, registers[i]));
+            }
+
+            for (std::size_t i = 0; i < NumRegisters; i++) {
+                callbacks->CommandLog(
+                    fmt::format("SavedRegs[{:02X}]: {:016X}", i, saved_values[i]));
+            }
+            LogOpcode(cur_opcode);
         }
-        LogOpcode(cur_opcode);
 
         // Increment conditional depth, if relevant.
         if (cur_opcode.begin_conditional_block) {
@@ -814,12 +869,12 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
             }
             // Skip conditional block if condition not met.
             if (!cond_met) {
-                SkipConditionalBlock(true);
+                SkipConditionalBlock(compiled, true);
             }
         } else if (auto end_cond = std::get_if<EndConditionalOpcode>(&cur_opcode.opcode)) {
             if (end_cond->is_else) {
                 /* Skip to the end of the conditional block. */
-                this->SkipConditionalBlock(false);
+                SkipConditionalBlock(compiled, false);
             } else {
                 /* Decrement the condition depth. */
                 /* We will assume, graciously, that mismatched conditional block ends are a nop. */
@@ -831,12 +886,12 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
             if (ctrl_loop->start_loop) {
                 // Start a loop.
                 registers[ctrl_loop->reg_index] = ctrl_loop->num_iters;
-                loop_tops[ctrl_loop->reg_index] = instruction_ptr;
+                loop_tops[ctrl_loop->reg_index] = opcode_index;
             } else {
                 // End a loop.
                 registers[ctrl_loop->reg_index]--;
                 if (registers[ctrl_loop->reg_index] != 0) {
-                    instruction_ptr = loop_tops[ctrl_loop->reg_index];
+                    opcode_index = loop_tops[ctrl_loop->reg_index];
                 }
             }
         } else if (auto ldr_static = std::get_if<LoadRegisterStaticOpcode>(&cur_opcode.opcode)) {
@@ -933,7 +988,7 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
             // Check for keypress.
             if ((begin_keypress_cond->key_mask & kDown) != begin_keypress_cond->key_mask) {
                 // Keys not pressed. Skip conditional block.
-                SkipConditionalBlock(true);
+                SkipConditionalBlock(compiled, true);
             }
         } else if (auto perform_math_reg =
                        std::get_if<PerformArithmeticRegisterOpcode>(&cur_opcode.opcode)) {
@@ -1142,7 +1197,7 @@ void DmntCheatVm::Execute(const CheatProcessMetadata& metadata) {
 
             // Skip conditional block if condition not met.
             if (!cond_met) {
-                SkipConditionalBlock(true);
+                SkipConditionalBlock(compiled, true);
             }
         } else if (auto save_restore_reg =
                        std::get_if<SaveRestoreRegisterOpcode>(&cur_opcode.opcode)) {
@@ -281,6 +281,8 @@ public:
 
         virtual void DebugLog(u8 id, u64 value) = 0;
         virtual void CommandLog(std::string_view data) = 0;
+        /// Returns whether CommandLog output is wanted, the trace is not built otherwise.
+        virtual bool IsCommandLogEnabled() const = 0;
     };
 
     static constexpr std::size_t MaximumProgramOpcodeCount = 0x400;
@@ -301,10 +303,22 @@ public:
     void Execute(const CheatProcessMetadata& metadata);
 
 private:
+    /// Opcode of the loaded program, decoded once when the program is loaded
+    struct CompiledOpcode {
+        CheatVmOpcode opcode;
+        /// Instruction pointer after the opcode, kept for the command log
+        std::size_t next_instruction_ptr{};
+        /// Opcode that runs next when a conditional block or an else branch is skipped
+        std::size_t skip_target{};
+        /// Whether skipping a failed conditional block continues in its else branch
+        bool skip_enters_else{};
+    };
+
     std::unique_ptr<Callbacks> callbacks;
 
     std::size_t num_opcodes = 0;
     std::size_t instruction_ptr = 0;
+    std::size_t opcode_index = 0;
     std::size_t condition_depth = 0;
     bool decode_success = false;
     std::array<u32, MaximumProgramOpcodeCount> program{};
@@ -312,9 +326,12 @@ private:
     std::array<u64, NumRegisters> saved_values{};
     std::array<u64, NumStaticRegisters> static_registers{};
     std::array<std::size_t, NumRegisters> loop_tops{};
+    std::vector<CompiledOpcode> compiled_program;
 
     bool DecodeNextOpcode(CheatVmOpcode& out);
-    void SkipConditionalBlock(bool is_if);
+    /// Decodes the loaded program and resolves where its conditional blocks end.
+    void CompileProgram();
+    void SkipConditionalBlock(const CompiledOpcode& opcode, bool is_if);
     void ResetState();
 
     // For implementing the DebugLog opcode.
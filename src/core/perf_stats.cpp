@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iterator>
 #include <mutex>
 #include <numeric>
@@ -15,7 +16,10 @@
 #include <fmt/ranges.h>
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
+#include "common/fs/fs_util.h"
 #include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/profiler.h"
 #include "common/settings.h"
 #include "core/perf_stats.h"
 
@@ -23,6 +27,7 @@ using namespace std::chrono_literals;
 using DoubleSecs = std::chrono::duration<double, std::chrono::seconds::period>;
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
+using std::chrono::nanoseconds;
 
 // Purposefully ignore the first five frames, as there's a significant amount of overhead in
 // booting that we shouldn't account for
@@ -30,29 +35,48 @@ constexpr std::size_t IgnoreFrames = 5;
 
 namespace Core {
 
-PerfStats::PerfStats(u64 title_id_) : title_id(title_id_) {}
+namespace {
+/// Returns the path of a log file named after the current time and the title.
+std::filesystem::path LogFilePath(u64 title_id, std::string_view extension) {
+    const std::time_t t = std::time(nullptr);
+    const auto path = Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir);
+    // %F Date format expanded is "%Y-%m-%d"
+    const auto filename = fmt::format("{}_{:016X}{}",
+        [&] {
+            std::ostringstream oss;
+            oss << std::put_time(std::localtime(&t), "%F-%H-%M");
+            return oss.str();
+        }(),
+        title_id, extension);
+    return path / filename;
+}
+} // Anonymous namespace
+
+PerfStats::PerfStats(u64 title_id_) : title_id(title_id_) {
+    if (Settings::values.record_frame_profile.GetValue()) {
+        Common::Profiler::Start();
+    }
+}
 
 PerfStats::~PerfStats() {
+    if (Common::Profiler::IsRecording()) {
+        const auto filepath = LogFilePath(title_id, ".trace.json");
+        if (Common::Profiler::Stop(filepath)) {
+            LOG_INFO(Core, "Frame profile written to {}", Common::FS::PathToUTF8String(filepath));
+        } else {
+            LOG_ERROR(Core, "Failed to write the frame profile");
+        }
+    }
+
     if (!Settings::values.record_frame_times || title_id == 0) {
         return;
     }
 
-    const std::time_t t = std::time(nullptr);
     std::ostringstream stream;
     std::copy(perf_history.begin() + IgnoreFrames, perf_history.begin() + current_index,
               std::ostream_iterator<double>(stream, "\n"));
 
-    const auto path = Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir);
-    // %F Date format expanded is "%Y-%m-%d"
-    const auto filename = fmt::format("{}_{:016X}.csv",
-        [&] {
-            std::ostringstream oss;
-            oss << std::put_time(std::localtime(&t), "%F-%H-%M");
-            return oss.str();
-        }(),
-        title_id);
-
-    const auto filepath = path / filename;
+    const auto filepath = LogFilePath(title_id, ".csv");
 
     if (Common::FS::CreateParentDir(filepath)) {
         Common::FS::IOFile file(filepath, Common::FS::FileAccessMode::Write,
@@ -61,6 +85,36 @@ PerfStats::~PerfStats() {
     }
 }
 
+void FrameTimeHistogram::Add(double seconds) {
+    const auto bucket = static_cast<std::size_t>(std::max(seconds, 0.0) / BUCKET_WIDTH);
+    ++buckets[(std::min)(bucket, NUM_BUCKETS - 1)];
+    ++count;
+    longest = std::max(longest, seconds);
+}
+
+void FrameTimeHistogram::Reset() {
+    buckets.fill(0);
+    count = 0;
+    longest = 0;
+}
+
+double FrameTimeHistogram::Percentile(double fraction) const {
+    if (count == 0) {
+        return 0;
+    }
+    const auto rank = std::max<u64>(
+        static_cast<u64>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(count))),
+        1);
+    u64 seen = 0;
+    for (std::size_t bucket = 0; bucket < NUM_BUCKETS - 1; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            return std::min(static_cast<double>(bucket + 1) * BUCKET_WIDTH, longest);
+        }
+    }
+    return longest;
+}
+
 void PerfStats::BeginSystemFrame() {
     std::scoped_lock lock{object_mutex};
 
@@ -81,6 +135,16 @@ void PerfStats::EndSystemFrame() {
 
     previous_frame_length = frame_end - previous_frame_end;
     previous_frame_end = frame_end;
+
+    const double frame_length = duration_cast<DoubleSecs>(previous_frame_length).count();
+    accumulated_frame_length += frame_length;
+    accumulated_frame_length_squared += frame_length * frame_length;
+
+    constexpr double STUTTER_LENGTH = 2.0 / 60;
+    frame_length_histogram.Add(frame_length);
+    if (frame_length > STUTTER_LENGTH) {
+        ++stutters;
+    }
 }
 
 void PerfStats::EndGameFrame() {
@@ -99,7 +163,11 @@ double PerfStats::GetMeanFrametime() const {
     return sum / static_cast<double>(current_index - IgnoreFrames);
 }
 
-PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us) {
+PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us,
+                                             u64 scheduler_lock_contention,
+                                             microseconds audio_latency,
+                                             const CoreIdleTimes& core_idle_times,
+                                             nanoseconds input_latency) {
     std::scoped_lock lock{object_mutex};
 
     const auto now = Clock::now();
@@ -109,12 +177,32 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     const auto system_us_per_second = (current_system_time_us - reset_point_system_us) / interval;
     const auto current_frames = static_cast<double>(game_frames.load(std::memory_order_relaxed));
     const auto current_fps = current_frames / interval;
+    const auto frames = static_cast<double>(system_frames);
+    const auto mean_frame_length = accumulated_frame_length / frames;
+    const auto frame_length_variance =
+        accumulated_frame_length_squared / frames - mean_frame_length * mean_frame_length;
+    std::array<double, Hardware::NUM_CPU_CORES> core_idle{};
+    for (size_t core = 0; core < core_idle.size(); ++core) {
+        core_idle[core] =
+            std::min(duration_cast<DoubleSecs>(core_idle_times[core]).count() / interval, 1.0);
+    }
+    const double frame_length_p99 = frame_length_histogram.Percentile(0.99);
     const PerfStatsResults results{
         .system_fps = static_cast<double>(system_frames) / interval,
         .average_game_fps = (current_fps + previous_fps) / 2.0,
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
+        .frametime_deviation = std::sqrt(std::max(frame_length_variance, 0.0)),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .scheduler_lock_contention = static_cast<double>(scheduler_lock_contention) / interval,
+        .audio_latency = duration_cast<DoubleSecs>(audio_latency).count(),
+        .core_idle = core_idle,
+        .input_latency = duration_cast<DoubleSecs>(input_latency).count(),
+        .frame_length_p50 = frame_length_histogram.Percentile(0.50),
+        .frame_length_p95 = frame_length_histogram.Percentile(0.95),
+        .frame_length_p99 = frame_length_p99,
+        .low_1_percent_fps = frame_length_p99 > 0 ? 1.0 / frame_length_p99 : 0.0,
+        .stutters = stutters,
     };
 
     // Reset counters
@@ -122,6 +210,10 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     reset_point_system_us = current_system_time_us;
     accumulated_frametime = Clock::duration::zero();
     system_frames = 0;
+    accumulated_frame_length = 0;
+    accumulated_frame_length_squared = 0;
+    frame_length_histogram.Reset();
+    stutters = 0;
     game_frames.store(0, std::memory_order_relaxed);
     previous_fps = current_fps;
 
@@ -135,6 +227,18 @@ double PerfStats::GetLastFrameTimeScale() const {
     return duration_cast<DoubleSecs>(previous_frame_length).count() / FRAME_LENGTH;
 }
 
+std::size_t PerfStats::GetSystemFrameCount() const {
+    std::scoped_lock lock{object_mutex};
+    return current_index;
+}
+
+std::vector<double> PerfStats::GetFrametimes(std::size_t first, std::size_t last) const {
+    std::scoped_lock lock{object_mutex};
+    last = (std::min)(last, current_index);
+    first = (std::min)(first, last);
+    return std::vector<double>(perf_history.begin() + first, perf_history.begin() + last);
+}
+
 void SpeedLimiter::DoSpeedLimiting(microseconds current_system_time_us) {
     if (Settings::values.use_multi_core.GetValue() ||
         !Settings::values.use_speed_limit.GetValue()) {
@@ -143,7 +247,7 @@ void SpeedLimiter::DoSpeedLimiting(microseconds current_system_time_us) {
 
     auto now = Clock::now();
 
-    const double sleep_scale = Settings::values.speed_limit.GetValue() / 100.0;
+    const double sleep_scale = Settings::SpeedLimit() / 100.0;
 
     // Max lag caused by slow frames. Shouldn't be more than the length of a frame at the current
     // speed percent or it will clamp too much and prevent this from properly limiting to that
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2017 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -8,7 +11,9 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <vector>
 #include "common/common_types.h"
+#include "core/hardware_properties.h"
 
 namespace Core {
 
@@ -19,8 +24,89 @@ struct PerfStatsResults {
     double average_game_fps;
     /// Walltime per system frame, in seconds, excluding any waits
     double frametime;
+    /// Standard deviation of the walltime between system frames, in seconds
+    double frametime_deviation;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Times per second a core had to wait for the kernel scheduler lock
+    double scheduler_lock_contention;
+    /// Time for rendered audio to reach the output device, in seconds
+    double audio_latency;
+    /// Share of the walltime each emulated core spent waiting for guest work, from 0 to 1
+    std::array<double, Hardware::NUM_CPU_CORES> core_idle;
+    /// Mean time for an input change to become visible to the guest, in seconds
+    double input_latency;
+    /// Percentiles of the walltime between system frames, in seconds
+    double frame_length_p50;
+    double frame_length_p95;
+    double frame_length_p99;
+    /// Rate of the slowest percent of system frames ("1% low"), in Hz
+    double low_1_percent_fps;
+    /// System frames that took more than twice as long as a 60 Hz frame
+    u32 stutters;
+};
+
+/// Histogram of frame lengths, in buckets of half a millisecond up to 100 ms and one above that.
+class FrameTimeHistogram {
+public:
+    static constexpr double BUCKET_WIDTH = 0.0005;
+    static constexpr std::size_t NUM_BUCKETS = 201;
+
+    /// Records a frame that took the given number of seconds.
+    void Add(double seconds);
+
+    void Reset();
+
+    /**
+     * Returns the length in seconds below which the given fraction of the frames fall, rounded
+     * up to the end of its bucket. Frames past the last bucket report the longest one. Returns 0
+     * when no frame was recorded.
+     */
+    [[nodiscard]] double Percentile(double fraction) const;
+
+    [[nodiscard]] u32 Count() const noexcept {
+        return count;
+    }
+
+    [[nodiscard]] const std::array<u32, NUM_BUCKETS>& Buckets() const noexcept {
+        return buckets;
+    }
+
+private:
+    std::array<u32, NUM_BUCKETS> buckets{};
+    u32 count = 0;
+    double longest = 0;
+};
+
+enum class MemoryCategory : u32 {
+    /// Physical memory used by the application process
+    GuestMemory,
+    /// Host GPU memory in use as reported by the driver, including other applications on some
+    GpuDeviceMemory,
+    /// Memory owned by the images of the texture cache
+    TextureCache,
+    /// Memory owned by the buffers of the buffer cache
+    BufferCache,
+    Count,
+};
+
+struct MemoryUsage {
+    u64 bytes;
+    /// Highest value sampled since the application started
+    u64 peak_bytes;
+};
+
+/// Memory usage per category, sampled when System::GetMemoryTelemetry is called.
+struct MemoryTelemetry {
+    std::array<MemoryUsage, static_cast<size_t>(MemoryCategory::Count)> categories;
+
+    [[nodiscard]] const MemoryUsage& operator[](MemoryCategory category) const {
+        return categories[static_cast<size_t>(category)];
+    }
+
+    [[nodiscard]] MemoryUsage& operator[](MemoryCategory category) {
+        return categories[static_cast<size_t>(category)];
+    }
 };
 
 /**
@@ -29,6 +115,8 @@ struct PerfStatsResults {
  */
 class PerfStats {
 public:
+    using CoreIdleTimes = std::array<std::chrono::nanoseconds, Hardware::NUM_CPU_CORES>;
+
     explicit PerfStats(u64 title_id_);
     ~PerfStats();
 
@@ -38,7 +126,11 @@ public:
     void EndSystemFrame();
     void EndGameFrame();
 
-    PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
+    PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us,
+                                      u64 scheduler_lock_contention,
+                                      std::chrono::microseconds audio_latency,
+                                      const CoreIdleTimes& core_idle_times,
+                                      std::chrono::nanoseconds input_latency);
 
     /**
      * Returns the arithmetic mean of all frametime values stored in the performance history.
@@ -51,6 +143,22 @@ public:
      */
     double GetLastFrameTimeScale() const;
 
+    /// Returns the number of system frames recorded in the frametime history.
+    std::size_t GetSystemFrameCount() const;
+
+    /// Returns the frametimes in milliseconds of the system frames in [first, last).
+    std::vector<double> GetFrametimes(std::size_t first, std::size_t last) const;
+
+    /// Sets the time between the frames the game presents at, from its swap interval.
+    void SetTargetFrameTime(std::chrono::nanoseconds frame_time) {
+        target_frame_time_ns.store(frame_time.count(), std::memory_order_relaxed);
+    }
+
+    /// Returns the time between the frames the game presents at.
+    std::chrono::nanoseconds GetTargetFrameTime() const {
+        return std::chrono::nanoseconds{target_frame_time_ns.load(std::memory_order_relaxed)};
+    }
+
 private:
     mutable std::mutex object_mutex;
 
@@ -71,6 +179,12 @@ private:
     Clock::duration accumulated_frametime = Clock::duration::zero();
     /// Cumulative number of system frames (LCD VBlanks) presented since last reset
     u32 system_frames = 0;
+    /// Sum and sum of squares of the visible system frame lengths since last reset, in seconds
+    double accumulated_frame_length = 0;
+    double accumulated_frame_length_squared = 0;
+    /// Visible system frame lengths and the stutters among them since last reset
+    FrameTimeHistogram frame_length_histogram;
+    u32 stutters = 0;
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     std::atomic<u32> game_frames = 0;
 
@@ -82,6 +196,8 @@ private:
     Clock::duration previous_frame_length = Clock::duration::zero();
     /// Previously computed fps
     double previous_fps = 0;
+    /// Time between the frames the game presents at, 60 FPS until the game picks its interval
+    std::atomic<s64> target_frame_time_ns = 1'000'000'000 / 60;
 };
 
 class SpeedLimiter {
@@ -387,6 +387,8 @@ EmitConfig A32AddressSpace::GetEmitConfig() {
 
         .always_little_endian = conf.always_little_endian,
 
+        .live_range_spilling = false,
+
         .descriptor_to_fpcr = [](const IR::LocationDescriptor& location) { return FP::FPCR{A32::LocationDescriptor{location}.FPSCR().Value()}; },
         .emit_cond = EmitA32Cond,
         .emit_condition_failed_terminal = EmitA32ConditionFailedTerminal,
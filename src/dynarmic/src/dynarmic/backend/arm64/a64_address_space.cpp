@@ -562,6 +562,8 @@ EmitConfig A64AddressSpace::GetEmitConfig() {
 
         .always_little_endian = true,
 
+        .live_range_spilling = conf.live_range_spilling,
+
         .descriptor_to_fpcr = [](const IR::LocationDescriptor& location) { return A64::LocationDescriptor{location}.FPCR(); },
         .emit_cond = EmitA64Cond,
         .emit_condition_failed_terminal = EmitA64ConditionFailedTerminal,
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <boost/icl/interval_set.hpp>
 #include "dynarmic/common/assert.h"
@@ -18,6 +19,7 @@
 #include "dynarmic/backend/arm64/a64_core.h"
 #include "dynarmic/backend/arm64/a64_jitstate.h"
 #include "dynarmic/common/atomic.h"
+#include "dynarmic/frontend/A64/a64_location_descriptor.h"
 #include "dynarmic/interface/A64/a64.h"
 #include "dynarmic/interface/A64/config.h"
 
@@ -75,6 +77,37 @@ struct Jit::Impl final {
         HaltExecution(HaltReason::CacheInvalidation);
     }
 
+    std::vector<Jit::BlockLocation> GetCompiledBlocks(std::uint64_t start_address, std::size_t length) const {
+        std::vector<Jit::BlockLocation> blocks;
+        for (const IR::LocationDescriptor location : current_address_space.GetBlockLocations()) {
+            const A64::LocationDescriptor descriptor{location};
+            if (descriptor.SingleStepping() || descriptor.PC() - start_address >= length) {
+                continue;
+            }
+            blocks.push_back({descriptor.PC(), descriptor.FPCR().Value()});
+        }
+        return blocks;
+    }
+
+    void PrecompileBlocks(const std::vector<Jit::BlockLocation>& blocks) {
+        ASSERT(!is_executing);
+        PerformRequestedCacheInvalidation(static_cast<HaltReason>(Atomic::Load(&halt_reason)));
+
+        for (const Jit::BlockLocation& block : blocks) {
+            // Keep room for the code compiled at runtime instead of evacuating the cache.
+            if (current_address_space.GetRemainingSize() < conf.code_cache_size / 4) {
+                break;
+            }
+            current_address_space.GetOrEmit(A64::LocationDescriptor{block.pc, FP::FPCR{block.fpcr}});
+        }
+    }
+
+    Jit::CodeCacheStatistics GetCodeCacheStatistics() const {
+        // Blocks are linked by relocations that aren't tracked per code range, so the whole
+        // cache is cleared when it fills up.
+        return {.evictions = 0, .full_clears = current_address_space.GetNumFullClears()};
+    }
+
     void Reset() {
         current_state = {};
     }
@@ -214,6 +247,18 @@ void Jit::InvalidateCacheRange(std::uint64_t start_address, std::size_t length)
     impl->InvalidateCacheRange(start_address, length);
 }
 
+std::vector<Jit::BlockLocation> Jit::GetCompiledBlocks(std::uint64_t start_address, std::size_t length) const {
+    return impl->GetCompiledBlocks(start_address, length);
+}
+
+void Jit::PrecompileBlocks(const std::vector<BlockLocation>& blocks) {
+    impl->PrecompileBlocks(blocks);
+}
+
+Jit::CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->GetCodeCacheStatistics();
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
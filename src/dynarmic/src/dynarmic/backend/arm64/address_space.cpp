@@ -73,6 +73,15 @@ CodePtr AddressSpace::GetOrEmit(IR::LocationDescriptor descriptor) {
     return block_info.entry_point;
 }
 
+std::vector<IR::LocationDescriptor> AddressSpace::GetBlockLocations() const {
+    std::vector<IR::LocationDescriptor> locations;
+    locations.reserve(block_entries.size());
+    for (const auto& [location, entry_point] : block_entries) {
+        locations.push_back(location);
+    }
+    return locations;
+}
+
 void AddressSpace::InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& descriptors) {
     UnprotectCodeMemory();
 
@@ -106,6 +115,7 @@ size_t AddressSpace::GetRemainingSize() {
 
 EmittedBlockInfo AddressSpace::Emit(IR::Block block) {
     if (GetRemainingSize() < 1024 * 1024) {
+        ++num_full_clears;
         ClearCache();
     }
 
@@ -10,6 +10,7 @@
 
 #include <map>
 #include <optional>
+#include <vector>
 
 #include "dynarmic/common/common_types.h"
 #include <oaknut/code_block.hpp>
@@ -41,6 +42,14 @@ public:
 
     CodePtr GetOrEmit(IR::LocationDescriptor descriptor);
 
+    // Returns the locations of every block that currently has emitted code
+    std::vector<IR::LocationDescriptor> GetBlockLocations() const;
+
+    size_t GetRemainingSize();
+
+    // Returns how many times the cache was cleared because it ran out of space
+    size_t GetNumFullClears() const { return num_full_clears; }
+
     void InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& descriptors);
 
     void ClearCache();
@@ -60,7 +69,6 @@ protected:
 #endif
     }
 
-    size_t GetRemainingSize();
     EmittedBlockInfo Emit(IR::Block ir_block);
     void Link(EmittedBlockInfo& block);
     void LinkBlockLinks(const CodePtr entry_point, const CodePtr target_ptr, const std::vector<BlockRelocation>& block_relocations_list);
@@ -69,6 +77,7 @@ protected:
     FakeCall FastmemCallback(u64 host_pc);
 
     const size_t code_cache_size;
+    size_t num_full_clears = 0;
     oaknut::CodeBlock mem;
     oaknut::CodeGenerator code;
 
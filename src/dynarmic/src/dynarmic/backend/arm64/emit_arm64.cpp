@@ -15,6 +15,7 @@
 #include "dynarmic/backend/arm64/fpsr_manager.h"
 #include "dynarmic/backend/arm64/reg_alloc.h"
 #include "dynarmic/backend/arm64/verbose_debugging_output.h"
+#include "dynarmic/backend/live_range_analysis.h"
 #include "dynarmic/ir/basic_block.h"
 #include "dynarmic/ir/microinstruction.h"
 #include "dynarmic/ir/opcodes.h"
@@ -200,7 +201,11 @@ EmittedBlockInfo EmitArm64(oaknut::CodeGenerator& code, IR::Block block, const E
     EmittedBlockInfo ebi;
 
     FpsrManager fpsr_manager{code, conf.state_fpsr_offset};
-    RegAlloc reg_alloc{code, fpsr_manager, GPR_ORDER, FPR_ORDER};
+    LiveRangeAnalysis live_ranges;
+    if (conf.live_range_spilling) {
+        live_ranges.Analyze(block);
+    }
+    RegAlloc reg_alloc{code, fpsr_manager, GPR_ORDER, FPR_ORDER, conf.live_range_spilling ? &live_ranges : nullptr};
     EmitContext ctx{block, reg_alloc, conf, ebi, fpsr_manager, fastmem_manager, {}};
 
     ebi.entry_point = code.xptr<CodePtr>();
@@ -218,8 +223,10 @@ EmittedBlockInfo EmitArm64(oaknut::CodeGenerator& code, IR::Block block, const E
         code.l(pass);
     }
 
+    size_t position = 0;
     for (auto iter = block.begin(); iter != block.end(); ++iter) {
         IR::Inst* inst = &*iter;
+        live_ranges.SetPosition(position++);
 
         switch (inst->GetOpcode()) {
 #define OPCODE(name, type, ...)                    \
@@ -147,6 +147,9 @@ struct EmitConfig {
     // Endianness
     bool always_little_endian;
 
+    // Register allocation
+    bool live_range_spilling;
+
     // Frontend specific callbacks
     FP::FPCR (*descriptor_to_fpcr)(const IR::LocationDescriptor& descriptor);
     oaknut::Label (*emit_cond)(oaknut::CodeGenerator& code, EmitContext& ctx, IR::Cond cond);
@@ -567,49 +567,55 @@ void EmitIR<IR::Opcode::FPVectorRecipStepFused64>(oaknut::CodeGenerator& code, E
     EmitThreeOpArranged<64>(code, ctx, inst, [&](auto Vresult, auto Va, auto Vb) { code.FRECPS(Vresult, Va, Vb); });
 }
 
-/// @brief Assembly thunk "parameters" are in template parameters
-/// TODO: we have space for a 5th parameter? :)
-template<typename FPT, FP::RoundingMode rounding_mode, bool exact>
-static void EmitIRVectorRoundInt16Thunk(VectorArray<FPT>& output, const VectorArray<FPT>& input, FP::FPCR fpcr, FP::FPSR& fpsr) {
-    for (size_t i = 0; i < output.size(); ++i)
-        output[i] = FPT(FP::FPRoundInt<FPT>(input[i], fpcr, rounding_mode, exact, fpsr));
-}
-
 template<>
 void EmitIR<IR::Opcode::FPVectorRoundInt16>(oaknut::CodeGenerator& code, EmitContext& ctx, IR::Inst* inst) {
-    const auto rounding = FP::RoundingMode(inst->GetArg(1).GetU8());
+    const auto rounding_mode = static_cast<FP::RoundingMode>(inst->GetArg(1).GetU8());
     const bool exact = inst->GetArg(2).GetU1();
-    // Don't even think about making this a LUT -- it's bad
-    using FPT = u16; // Yes it's u16, no fsize madness
-    switch (rounding) {
-    case FP::RoundingMode::ToNearest_TieEven:
-        exact
-            ? EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::ToNearest_TieEven, true>)
-            : EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::ToNearest_TieEven, false>);
-        break;
-    case FP::RoundingMode::TowardsPlusInfinity:
-        exact
-            ? EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::TowardsPlusInfinity, true>)
-            : EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::TowardsPlusInfinity, false>);
-        break;
-    case FP::RoundingMode::TowardsMinusInfinity:
-        exact
-            ? EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::TowardsMinusInfinity, true>)
-            : EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::TowardsMinusInfinity, false>);
-        break;
-    case FP::RoundingMode::TowardsZero:
-        exact
-            ? EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::TowardsZero, true>)
-            : EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::TowardsZero, false>);
-        break;
-    case FP::RoundingMode::ToNearest_TieAwayFromZero:
-        exact
-            ? EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::ToNearest_TieAwayFromZero, true>)
-            : EmitTwoOpFallback<3>(code, ctx, inst, EmitIRVectorRoundInt16Thunk<FPT, FP::RoundingMode::ToNearest_TieAwayFromZero, false>);
-        break;
-    default:
-        UNREACHABLE();
-    }
+    const bool fpcr_controlled = inst->GetArg(3).GetU1();
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Qresult = ctx.reg_alloc.WriteQ(inst);
+    auto Qoperand = ctx.reg_alloc.ReadQ(args[0]);
+    RegAlloc::Realize(Qresult, Qoperand);
+    ctx.fpsr.Load();
+
+    // Half precision values and their integral roundings are exact in single precision, so this
+    // rounds the widened lanes instead of requiring FEAT_FP16 from the host.
+    const auto round = [&](oaknut::VReg_4S Vlanes) {
+        if (exact) {
+            ASSERT(ctx.FPCR(fpcr_controlled).RMode() == rounding_mode);
+            code.FRINTX(Vlanes, Vlanes);
+            return;
+        }
+        switch (rounding_mode) {
+        case FP::RoundingMode::ToNearest_TieEven:
+            code.FRINTN(Vlanes, Vlanes);
+            break;
+        case FP::RoundingMode::TowardsPlusInfinity:
+            code.FRINTP(Vlanes, Vlanes);
+            break;
+        case FP::RoundingMode::TowardsMinusInfinity:
+            code.FRINTM(Vlanes, Vlanes);
+            break;
+        case FP::RoundingMode::TowardsZero:
+            code.FRINTZ(Vlanes, Vlanes);
+            break;
+        case FP::RoundingMode::ToNearest_TieAwayFromZero:
+            code.FRINTA(Vlanes, Vlanes);
+            break;
+        default:
+            UNREACHABLE();
+        }
+    };
+
+    MaybeStandardFPSCRValue(code, ctx, fpcr_controlled, [&] {
+        code.FCVTL(V0.S4(), Qoperand->toD().H4());
+        code.FCVTL2(V1.S4(), Qoperand->H8());
+        round(V0.S4());
+        round(V1.S4());
+        code.FCVTN(Qresult->toD().H4(), V0.S4());
+        code.FCVTN2(Qresult->H8(), V1.S4());
+    });
 }
 
 template<>
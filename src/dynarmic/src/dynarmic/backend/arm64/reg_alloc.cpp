@@ -437,6 +437,18 @@ int RegAlloc::AllocateRegister(const std::array<HostLocInfo, 32>& regs, const st
     std::vector<int> candidates;
     std::copy_if(order.begin(), order.end(), std::back_inserter(candidates), [&](int i) { return regs[i].MaybeAllocatable(); });
 
+    if (live_ranges) {
+        // Spill whatever is needed the furthest away, a location is needed as soon as any of its values is
+        const auto next_use = [&](int i) {
+            size_t result = LiveRangeAnalysis::NoUse;
+            for (const IR::Inst* value : regs[i].values) {
+                result = std::min(result, live_ranges->NextUse(value));
+            }
+            return result;
+        };
+        return *std::max_element(candidates.begin(), candidates.end(), [&](int a, int b) { return next_use(a) < next_use(b); });
+    }
+
     // TODO: LRU
     std::uniform_int_distribution<size_t> dis{0, candidates.size() - 1};
     return candidates[dis(rand_gen)];
@@ -8,6 +8,8 @@
 
 #include "dynarmic/backend/block_range_information.h"
 
+#include <vector>
+
 #include <boost/icl/interval_map.hpp>
 #include <boost/icl/interval_set.hpp>
 #include "dynarmic/common/common_types.h"
@@ -25,6 +27,29 @@ void BlockRangeInformation<ProgramCounterType>::ClearCache() {
     block_ranges.clear();
 }
 
+template<typename ProgramCounterType>
+void BlockRangeInformation<ProgramCounterType>::RemoveLocations(const ankerl::unordered_dense::set<IR::LocationDescriptor>& locations) {
+    if (locations.empty()) {
+        return;
+    }
+    std::vector<std::pair<boost::icl::discrete_interval<ProgramCounterType>, std::set<IR::LocationDescriptor>>> removed;
+    for (const auto& [interval, descriptors] : block_ranges) {
+        std::set<IR::LocationDescriptor> intersection;
+        for (const auto& descriptor : descriptors) {
+            if (locations.contains(descriptor)) {
+                intersection.insert(descriptor);
+            }
+        }
+        if (!intersection.empty()) {
+            removed.emplace_back(interval, std::move(intersection));
+        }
+    }
+    // Subtracting the last location of an interval drops the interval
+    for (const auto& range : removed) {
+        block_ranges.subtract(range);
+    }
+}
+
 template<typename ProgramCounterType>
 ankerl::unordered_dense::set<IR::LocationDescriptor> BlockRangeInformation<ProgramCounterType>::InvalidateRanges(const boost::icl::interval_set<ProgramCounterType>& ranges) {
     ankerl::unordered_dense::set<IR::LocationDescriptor> erase_locations;
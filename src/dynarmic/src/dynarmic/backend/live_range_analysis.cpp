@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "dynarmic/backend/live_range_analysis.h"
+
+#include <algorithm>
+
+#include "dynarmic/ir/basic_block.h"
+#include "dynarmic/ir/microinstruction.h"
+#include "dynarmic/ir/value.h"
+
+namespace Dynarmic::Backend {
+
+void LiveRangeAnalysis::Analyze(const IR::Block& block) {
+    uses.clear();
+    position = 0;
+
+    u32 index = 0;
+    for (const IR::Inst& inst : block) {
+        for (size_t i = 0; i < inst.NumArgs(); i++) {
+            const IR::Value arg = inst.GetArg(i);
+            if (!arg.IsImmediate()) {
+                // Positions are pushed in increasing order, the lists stay sorted.
+                uses[arg.GetInst()].push_back(index);
+            }
+        }
+        index++;
+    }
+}
+
+size_t LiveRangeAnalysis::NextUse(const IR::Inst* value) const noexcept {
+    const auto iter = uses.find(value);
+    if (iter == uses.end()) {
+        return NoUse;
+    }
+    const auto next = std::lower_bound(iter->second.begin(), iter->second.end(), position);
+    return next != iter->second.end() ? size_t(*next) : NoUse;
+}
+
+}  // namespace Dynarmic::Backend
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+#include <ankerl/unordered_dense.h>
+#include <boost/container/small_vector.hpp>
+
+#include "dynarmic/common/common_types.h"
+
+namespace Dynarmic::IR {
+class Block;
+class Inst;
+}  // namespace Dynarmic::IR
+
+namespace Dynarmic::Backend {
+
+/// Records where each value of a block is used, so the register allocators can spill the value
+/// whose next use is the furthest away once they run out of registers.
+class LiveRangeAnalysis {
+public:
+    static constexpr size_t NoUse = std::numeric_limits<size_t>::max();
+
+    /// Analyzes a block. Positions are the indices of its instructions in emission order.
+    void Analyze(const IR::Block& block);
+
+    /// Sets the position of the instruction being emitted.
+    void SetPosition(size_t new_position) noexcept {
+        position = new_position;
+    }
+
+    /// Returns the position of the first use of a value at or after the current instruction.
+    size_t NextUse(const IR::Inst* value) const noexcept;
+
+private:
+    ankerl::unordered_dense::map<const IR::Inst*, boost::container::small_vector<u32, 4>> uses;
+    size_t position = 0;
+};
+
+}  // namespace Dynarmic::Backend
@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <algorithm>
+
 #include <biscuit/assembler.hpp>
 #include <fmt/ostream.h>
 
@@ -18,8 +20,17 @@
 namespace Dynarmic::Backend::RV64 {
 
 template<>
-void EmitIR<IR::Opcode::Pack2x32To1x64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Pack2x32To1x64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.SLLI(Xscratch0, Xa, 32);
+    as.SRLI(Xscratch0, Xscratch0, 32);
+    as.SLLI(Xresult, Xb, 32);
+    as.OR(Xresult, Xresult, Xscratch0);
 }
 
 template<>
@@ -28,43 +39,98 @@ void EmitIR<IR::Opcode::Pack2x64To1x128>(biscuit::Assembler&, EmitContext&, IR::
 }
 
 template<>
-void EmitIR<IR::Opcode::LeastSignificantWord>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LeastSignificantWord>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.ADDW(Xresult, Xoperand, biscuit::zero);
 }
 
 template<>
-void EmitIR<IR::Opcode::LeastSignificantHalf>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LeastSignificantHalf>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 48);
+    as.SRLI(Xresult, Xresult, 48);
 }
 
 template<>
-void EmitIR<IR::Opcode::LeastSignificantByte>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LeastSignificantByte>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.ANDI(Xresult, Xoperand, 0xFF);
 }
 
 template<>
-void EmitIR<IR::Opcode::MostSignificantWord>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::MostSignificantWord>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    const auto carry_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+
+    if (carry_inst) {
+        auto Xcarry_out = ctx.reg_alloc.WriteX(carry_inst);
+        RegAlloc::Realize(Xresult, Xcarry_out, Xoperand);
+
+        as.SRLI(Xcarry_out, Xoperand, 31);
+        as.ANDI(Xcarry_out, Xcarry_out, 1);
+    } else {
+        RegAlloc::Realize(Xresult, Xoperand);
+    }
+    as.SRLI(Xresult, Xoperand, 32);
 }
 
 template<>
-void EmitIR<IR::Opcode::MostSignificantBit>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::MostSignificantBit>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SRLIW(Xresult, Xoperand, 31);
 }
 
 template<>
-void EmitIR<IR::Opcode::IsZero32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::IsZero32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 32);
+    as.SEQZ(Xresult, Xresult);
 }
 
 template<>
-void EmitIR<IR::Opcode::IsZero64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::IsZero64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SEQZ(Xresult, Xoperand);
 }
 
 template<>
-void EmitIR<IR::Opcode::TestBit>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::TestBit>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    ASSERT(args[1].IsImmediate());
+
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SRLI(Xresult, Xoperand, args[1].GetImmediateU8());
+    as.ANDI(Xresult, Xresult, 1);
 }
 
 template<>
@@ -119,9 +185,59 @@ void EmitIR<IR::Opcode::LogicalShiftLeft32>(biscuit::Assembler& as, EmitContext&
     }
 }
 
+/// Emits a shift of a 64-bit value by an unmasked amount, amounts of 64 or more shift out every bit.
+template<IR::Opcode op>
+static void EmitShift64(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    ASSERT(inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp) == nullptr);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto& operand_arg = args[0];
+    auto& shift_arg = args[1];
+
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(operand_arg);
+
+    if (shift_arg.IsImmediate()) {
+        RegAlloc::Realize(Xresult, Xoperand);
+
+        const u8 shift = shift_arg.GetImmediateU8();
+        if constexpr (op == IR::Opcode::ArithmeticShiftRight64) {
+            as.SRAI(Xresult, Xoperand, std::min<u8>(shift, 63));
+        } else if (shift > 63) {
+            as.MV(Xresult, biscuit::zero);
+        } else if constexpr (op == IR::Opcode::LogicalShiftLeft64) {
+            as.SLLI(Xresult, Xoperand, shift);
+        } else {
+            as.SRLI(Xresult, Xoperand, shift);
+        }
+        return;
+    }
+
+    auto Xshift = ctx.reg_alloc.ReadX(shift_arg);
+    RegAlloc::Realize(Xresult, Xoperand, Xshift);
+
+    as.ANDI(Xscratch0, Xshift, 0xFF);
+    as.SLTIU(Xscratch1, Xscratch0, 64);
+    if constexpr (op == IR::Opcode::ArithmeticShiftRight64) {
+        // Clamp the amount to 63, which replicates the sign bit
+        as.ADDI(Xscratch1, Xscratch1, -1);
+        as.OR(Xscratch0, Xscratch0, Xscratch1);
+        as.SRA(Xresult, Xoperand, Xscratch0);
+    } else {
+        // Mask the result to zero when the amount is 64 or more
+        as.NEG(Xscratch1, Xscratch1);
+        if constexpr (op == IR::Opcode::LogicalShiftLeft64) {
+            as.SLL(Xresult, Xoperand, Xscratch0);
+        } else {
+            as.SRL(Xresult, Xoperand, Xscratch0);
+        }
+        as.AND(Xresult, Xresult, Xscratch1);
+    }
+}
+
 template<>
-void EmitIR<IR::Opcode::LogicalShiftLeft64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LogicalShiftLeft64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitShift64<IR::Opcode::LogicalShiftLeft64>(as, ctx, inst);
 }
 
 template<>
@@ -149,28 +265,91 @@ void EmitIR<IR::Opcode::LogicalShiftRight32>(biscuit::Assembler& as, EmitContext
 }
 
 template<>
-void EmitIR<IR::Opcode::LogicalShiftRight64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LogicalShiftRight64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitShift64<IR::Opcode::LogicalShiftRight64>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::ArithmeticShiftRight32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ArithmeticShiftRight32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    const auto carry_inst = inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto& operand_arg = args[0];
+    auto& shift_arg = args[1];
+
+    // TODO: Add full implementation
+    ASSERT(carry_inst == nullptr);
+    ASSERT(shift_arg.IsImmediate());
+
+    const u8 shift = shift_arg.GetImmediateU8();
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(operand_arg);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SRAIW(Xresult, Xoperand, std::min<u8>(shift, 31));
 }
 
 template<>
-void EmitIR<IR::Opcode::ArithmeticShiftRight64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ArithmeticShiftRight64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitShift64<IR::Opcode::ArithmeticShiftRight64>(as, ctx, inst);
+}
+
+template<size_t bitsize>
+static void EmitRotateRight(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    static_assert(bitsize == 32 || bitsize == 64);
+
+    // TODO: Add full implementation
+    ASSERT(inst->GetAssociatedPseudoOperation(IR::Opcode::GetCarryFromOp) == nullptr);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto& operand_arg = args[0];
+    auto& shift_arg = args[1];
+
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(operand_arg);
+
+    if (shift_arg.IsImmediate()) {
+        RegAlloc::Realize(Xresult, Xoperand);
+
+        const u8 shift = shift_arg.GetImmediateU8() % bitsize;
+        if (shift == 0) {
+            bitsize == 32 ? as.ADDW(Xresult, Xoperand, biscuit::zero) : as.MV(Xresult, Xoperand);
+        } else if constexpr (bitsize == 32) {
+            as.SRLIW(Xscratch0, Xoperand, shift);
+            as.SLLIW(Xresult, Xoperand, 32 - shift);
+            as.OR(Xresult, Xresult, Xscratch0);
+        } else {
+            as.SRLI(Xscratch0, Xoperand, shift);
+            as.SLLI(Xresult, Xoperand, 64 - shift);
+            as.OR(Xresult, Xresult, Xscratch0);
+        }
+        return;
+    }
+
+    auto Xshift = ctx.reg_alloc.ReadX(shift_arg);
+    RegAlloc::Realize(Xresult, Xoperand, Xshift);
+
+    // Register shifts only use the low bits of the amount, so shifting left by its negation
+    // shifts by bitsize - amount, and leaves the operand unchanged for an amount of zero.
+    as.NEG(Xscratch1, Xshift);
+    if constexpr (bitsize == 32) {
+        as.SRLW(Xscratch0, Xoperand, Xshift);
+        as.SLLW(Xresult, Xoperand, Xscratch1);
+    } else {
+        as.SRL(Xscratch0, Xoperand, Xshift);
+        as.SLL(Xresult, Xoperand, Xscratch1);
+    }
+    as.OR(Xresult, Xresult, Xscratch0);
 }
 
 template<>
-void EmitIR<IR::Opcode::RotateRight32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::RotateRight32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitRotateRight<32>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::RotateRight64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::RotateRight64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitRotateRight<64>(as, ctx, inst);
 }
 
 template<>
@@ -179,43 +358,79 @@ void EmitIR<IR::Opcode::RotateRightExtended>(biscuit::Assembler&, EmitContext&,
 }
 
 template<>
-void EmitIR<IR::Opcode::LogicalShiftLeftMasked32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LogicalShiftLeftMasked32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.SLLW(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::LogicalShiftLeftMasked64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LogicalShiftLeftMasked64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.SLL(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::LogicalShiftRightMasked32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LogicalShiftRightMasked32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.SRLW(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::LogicalShiftRightMasked64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::LogicalShiftRightMasked64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.SRL(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::ArithmeticShiftRightMasked32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ArithmeticShiftRightMasked32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.SRAW(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::ArithmeticShiftRightMasked64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ArithmeticShiftRightMasked64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.SRA(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::RotateRightMasked32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::RotateRightMasked32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitRotateRight<32>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::RotateRightMasked64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::RotateRightMasked64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitRotateRight<64>(as, ctx, inst);
 }
 
 template<size_t bitsize>
@@ -286,9 +501,9 @@ static void EmitAddSub(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst)
                 RegAlloc::Realize(Xresult, Xflags, Xa);
 
                 if (args[2].GetImmediateU1()) {
-                    AddImmWithFlags<bitsize>(as, *Xresult, *Xa, sub ? ~imm : imm + 1, *Xflags);
+                    AddImmWithFlags<bitsize>(as, *Xresult, *Xa, sub ? -imm : imm + 1, *Xflags);
                 } else {
-                    AddImmWithFlags<bitsize>(as, *Xresult, *Xa, sub ? -imm : imm, *Xflags);
+                    AddImmWithFlags<bitsize>(as, *Xresult, *Xa, sub ? ~imm : imm, *Xflags);
                 }
             } else {
                 UNIMPLEMENTED();
@@ -297,11 +512,15 @@ static void EmitAddSub(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst)
             UNIMPLEMENTED();
         }
     } else {
+        // result = a + (sub ? ~b : b) + carry
         if (args[1].IsImmediate()) {
             const u64 imm = args[1].GetImmediateU64();
 
             if (args[2].IsImmediate()) {
-                UNIMPLEMENTED();
+                RegAlloc::Realize(Xresult, Xa);
+
+                as.LI(Xscratch0, (sub ? ~imm : imm) + (args[2].GetImmediateU1() ? 1 : 0));
+                bitsize == 32 ? as.ADDW(Xresult, Xa, Xscratch0) : as.ADD(Xresult, Xa, Xscratch0);
             } else {
                 auto Xnzcv = ctx.reg_alloc.ReadX(args[2]);
                 RegAlloc::Realize(Xresult, Xa, Xnzcv);
@@ -309,9 +528,25 @@ static void EmitAddSub(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst)
                 as.LUI(Xscratch0, 0x20000);
                 as.AND(Xscratch0, Xnzcv, Xscratch0);
                 as.SRLI(Xscratch0, Xscratch0, 29);
-                as.LI(Xscratch1, imm);
+                as.LI(Xscratch1, sub ? ~imm : imm);
                 as.ADD(Xscratch0, Xscratch0, Xscratch1);
-                as.ADDW(Xresult, Xa, Xscratch0);
+                bitsize == 32 ? as.ADDW(Xresult, Xa, Xscratch0) : as.ADD(Xresult, Xa, Xscratch0);
+            }
+        } else if (args[2].IsImmediate()) {
+            auto Xb = ctx.reg_alloc.ReadX(args[1]);
+            RegAlloc::Realize(Xresult, Xa, Xb);
+
+            const bool carry = args[2].GetImmediateU1();
+            if (sub && carry) {
+                bitsize == 32 ? as.SUBW(Xresult, Xa, Xb) : as.SUB(Xresult, Xa, Xb);
+            } else if (sub) {
+                as.NOT(Xscratch0, Xb);
+                bitsize == 32 ? as.ADDW(Xresult, Xa, Xscratch0) : as.ADD(Xresult, Xa, Xscratch0);
+            } else if (carry) {
+                as.ADDI(Xscratch0, Xb, 1);
+                bitsize == 32 ? as.ADDW(Xresult, Xa, Xscratch0) : as.ADD(Xresult, Xa, Xscratch0);
+            } else {
+                bitsize == 32 ? as.ADDW(Xresult, Xa, Xb) : as.ADD(Xresult, Xa, Xb);
             }
         } else {
             UNIMPLEMENTED();
@@ -325,8 +560,8 @@ void EmitIR<IR::Opcode::Add32>(biscuit::Assembler& as, EmitContext& ctx, IR::Ins
 }
 
 template<>
-void EmitIR<IR::Opcode::Add64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Add64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitAddSub<64, false>(as, ctx, inst);
 }
 
 template<>
@@ -335,148 +570,313 @@ void EmitIR<IR::Opcode::Sub32>(biscuit::Assembler& as, EmitContext& ctx, IR::Ins
 }
 
 template<>
-void EmitIR<IR::Opcode::Sub64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Sub64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitAddSub<64, true>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::Mul32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Mul32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.MULW(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::Mul64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Mul64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.MUL(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignedMultiplyHigh64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignedMultiplyHigh64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.MULH(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::UnsignedMultiplyHigh64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::UnsignedMultiplyHigh64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.MULHU(Xresult, Xa, Xb);
+}
+
+/// Emits a division, RISC-V returns all ones when dividing by zero where ARM returns zero.
+/// Signed overflow already matches, the quotient is the dividend.
+template<size_t bitsize, bool is_signed>
+static void EmitDiv(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    static_assert(bitsize == 32 || bitsize == 64);
+
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    if constexpr (bitsize == 32) {
+        as.SLLI(Xscratch0, Xb, 32);
+        as.SNEZ(Xscratch0, Xscratch0);
+        is_signed ? as.DIVW(Xresult, Xa, Xb) : as.DIVUW(Xresult, Xa, Xb);
+    } else {
+        as.SNEZ(Xscratch0, Xb);
+        is_signed ? as.DIV(Xresult, Xa, Xb) : as.DIVU(Xresult, Xa, Xb);
+    }
+    as.NEG(Xscratch0, Xscratch0);
+    as.AND(Xresult, Xresult, Xscratch0);
 }
 
 template<>
-void EmitIR<IR::Opcode::UnsignedDiv32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::UnsignedDiv32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitDiv<32, false>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::UnsignedDiv64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::UnsignedDiv64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitDiv<64, false>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignedDiv32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignedDiv32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitDiv<32, true>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignedDiv64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignedDiv64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    EmitDiv<64, true>(as, ctx, inst);
 }
 
 template<>
-void EmitIR<IR::Opcode::And32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::And32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.AND(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::And64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::And64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.AND(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::AndNot32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::AndNot32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.NOT(Xscratch0, Xb);
+    as.AND(Xresult, Xa, Xscratch0);
 }
 
 template<>
-void EmitIR<IR::Opcode::AndNot64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::AndNot64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.NOT(Xscratch0, Xb);
+    as.AND(Xresult, Xa, Xscratch0);
 }
 
 template<>
-void EmitIR<IR::Opcode::Eor32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Eor32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.XOR(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::Eor64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Eor64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.XOR(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::Or32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Or32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.OR(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::Or64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Or64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xa = ctx.reg_alloc.ReadX(args[0]);
+    auto Xb = ctx.reg_alloc.ReadX(args[1]);
+    RegAlloc::Realize(Xresult, Xa, Xb);
+
+    as.OR(Xresult, Xa, Xb);
 }
 
 template<>
-void EmitIR<IR::Opcode::Not32>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Not32>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.NOT(Xresult, Xoperand);
 }
 
 template<>
-void EmitIR<IR::Opcode::Not64>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::Not64>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.NOT(Xresult, Xoperand);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignExtendByteToWord>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignExtendByteToWord>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 56);
+    as.SRAI(Xresult, Xresult, 56);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignExtendHalfToWord>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignExtendHalfToWord>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 48);
+    as.SRAI(Xresult, Xresult, 48);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignExtendByteToLong>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignExtendByteToLong>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 56);
+    as.SRAI(Xresult, Xresult, 56);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignExtendHalfToLong>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignExtendHalfToLong>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 48);
+    as.SRAI(Xresult, Xresult, 48);
 }
 
 template<>
-void EmitIR<IR::Opcode::SignExtendWordToLong>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::SignExtendWordToLong>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.ADDIW(Xresult, Xoperand, 0);
 }
 
 template<>
-void EmitIR<IR::Opcode::ZeroExtendByteToWord>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ZeroExtendByteToWord>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.ANDI(Xresult, Xoperand, 0xFF);
 }
 
 template<>
-void EmitIR<IR::Opcode::ZeroExtendHalfToWord>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ZeroExtendHalfToWord>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 48);
+    as.SRLI(Xresult, Xresult, 48);
 }
 
 template<>
-void EmitIR<IR::Opcode::ZeroExtendByteToLong>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ZeroExtendByteToLong>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.ANDI(Xresult, Xoperand, 0xFF);
 }
 
 template<>
-void EmitIR<IR::Opcode::ZeroExtendHalfToLong>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ZeroExtendHalfToLong>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 48);
+    as.SRLI(Xresult, Xresult, 48);
 }
 
 template<>
-void EmitIR<IR::Opcode::ZeroExtendWordToLong>(biscuit::Assembler&, EmitContext&, IR::Inst*) {
-    UNIMPLEMENTED();
+void EmitIR<IR::Opcode::ZeroExtendWordToLong>(biscuit::Assembler& as, EmitContext& ctx, IR::Inst* inst) {
+    auto args = ctx.reg_alloc.GetArgumentInfo(inst);
+    auto Xresult = ctx.reg_alloc.WriteX(inst);
+    auto Xoperand = ctx.reg_alloc.ReadX(args[0]);
+    RegAlloc::Realize(Xresult, Xoperand);
+
+    as.SLLI(Xresult, Xoperand, 32);
+    as.SRLI(Xresult, Xresult, 32);
 }
 
 template<>
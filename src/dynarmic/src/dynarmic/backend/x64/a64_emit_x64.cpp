@@ -68,7 +68,7 @@ A64EmitX64::A64EmitX64(BlockOfCode& code, A64::UserConfig conf, A64::Jit* jit_in
 
 A64EmitX64::~A64EmitX64() = default;
 
-A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
+A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block, bool is_baseline) noexcept {
     if (conf.very_verbose_debugging_output) [[unlikely]] {
         std::puts(IR::DumpBlock(block).c_str());
     }
@@ -89,13 +89,30 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
         return gprs;
     }();
 
-    new (&this->reg_alloc) RegAlloc{&code, gpr_order, any_xmm};
+    if (conf.live_range_spilling) {
+        live_ranges.Analyze(block);
+    }
+    new (&this->reg_alloc) RegAlloc{&code, gpr_order, any_xmm, conf.live_range_spilling ? &live_ranges : nullptr};
     A64EmitContext ctx{conf, reg_alloc, block};
 
     // Start emitting.
     code.align();
     const auto* const entrypoint = code.getCurr();
 
+    u32* execution_counter = nullptr;
+    if (is_baseline) {
+        // No guest state lives in host registers yet, so rax is free to use.
+        execution_counter = &execution_counters.emplace_back(conf.tiered_compilation_threshold);
+        Xbyak::Label run_block;
+        code.mov(rax, reinterpret_cast<u64>(execution_counter));
+        code.sub(dword[rax], 1);
+        code.jnz(run_block);
+        code.mov(rax, A64::LocationDescriptor{block.Location()}.PC());
+        code.mov(qword[code.ABI_JIT_PTR + offsetof(A64JitState, pc)], rax);
+        code.ReturnFromRunCode();
+        code.L(run_block);
+    }
+
     DEBUG_ASSERT(block.GetCondition() == IR::Cond::AL);
     typedef void (EmitX64::*EmitHandlerFn)(EmitContext& context, IR::Inst* inst);
     constexpr EmitHandlerFn opcode_handlers[] = {
@@ -118,7 +135,9 @@ A64EmitX64::BlockDescriptor A64EmitX64::Emit(IR::Block& block) noexcept {
 #undef A64OPC
     };
 
+    size_t position = 0;
     for (auto& inst : block) {
+        live_ranges.SetPosition(position++);
         auto const opcode = inst.GetOpcode();
         // Call the relevant Emit* member function.
         switch (opcode) {
@@ -165,7 +184,7 @@ finish_this_inst:
     const auto range = boost::icl::discrete_interval<u64>::closed(descriptor.PC(), end_location.PC() - 1);
     block_ranges.AddRange(range, descriptor);
 
-    return RegisterBlock(descriptor, entrypoint, size);
+    return RegisterBlock(descriptor, entrypoint, size, reg_alloc, execution_counter);
 }
 
 void A64EmitX64::ClearCache() {
@@ -175,6 +194,24 @@ void A64EmitX64::ClearCache() {
     fastmem_patch_info.clear();
 }
 
+ankerl::unordered_dense::set<IR::LocationDescriptor> A64EmitX64::EvictBlocks(CodePtr begin, CodePtr end) {
+    auto evicted = EmitX64::EvictBlocks(begin, end);
+    block_ranges.RemoveLocations(evicted);
+    // Memory accesses emitted in the evicted code will be replaced by the ones emitted in its place.
+    const u64 begin_rip = reinterpret_cast<u64>(begin);
+    const u64 end_rip = reinterpret_cast<u64>(end);
+    std::vector<u64> evicted_rips;
+    for (const auto& [rip, info] : fastmem_patch_info) {
+        if (rip >= begin_rip && rip < end_rip) {
+            evicted_rips.push_back(rip);
+        }
+    }
+    for (const u64 rip : evicted_rips) {
+        fastmem_patch_info.erase(rip);
+    }
+    return evicted;
+}
+
 void A64EmitX64::InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges) {
     InvalidateBasicBlocks(block_ranges.InvalidateRanges(ranges));
 }
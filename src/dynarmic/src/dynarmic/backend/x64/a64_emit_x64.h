@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2016 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -13,6 +16,7 @@
 #include <boost/container/static_vector.hpp>
 
 #include "dynarmic/backend/block_range_information.h"
+#include "dynarmic/backend/live_range_analysis.h"
 #include "dynarmic/backend/x64/a64_jitstate.h"
 #include "dynarmic/backend/x64/emit_x64.h"
 #include "dynarmic/backend/x64/reg_alloc.h"
@@ -44,10 +48,16 @@ public:
 
     /// Emit host machine code for a basic block with intermediate representation `block`.
     /// @note block is modified.
-    BlockDescriptor Emit(IR::Block& block) noexcept;
+    /**
+     * Emits a block. Baseline blocks count their executions and return to the dispatcher once
+     * they reach the tiered compilation threshold, so they can be replaced by an optimized block.
+     */
+    BlockDescriptor Emit(IR::Block& block, bool is_baseline = false) noexcept;
 
     void ClearCache() override;
 
+    ankerl::unordered_dense::set<IR::LocationDescriptor> EvictBlocks(CodePtr begin, CodePtr end) override;
+
     void InvalidateCacheRanges(const boost::icl::interval_set<u64>& ranges);
 
 protected:
@@ -125,6 +135,7 @@ protected:
     const A64::UserConfig conf;
     RegAlloc reg_alloc; //reusable reg alloc
     BlockRangeInformation<u64> block_ranges;
+    LiveRangeAnalysis live_ranges;
     std::array<FastDispatchEntry, fast_dispatch_table_size> fast_dispatch_table;
     ankerl::unordered_dense::map<u64, FastmemPatchInfo> fastmem_patch_info;
     ankerl::unordered_dense::map<std::tuple<bool, size_t, int, int>, void (*)()> read_fallbacks;
@@ -6,10 +6,15 @@
  * SPDX-License-Identifier: 0BSD
  */
 
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
+#include <ankerl/unordered_dense.h>
 #include <boost/icl/interval_set.hpp>
 #include "dynarmic/common/assert.h"
 #include "dynarmic/common/llvm_disassemble.h"
@@ -51,6 +56,23 @@ static std::function<void(BlockOfCode&)> GenRCP(const A64::UserConfig& conf) {
     };
 }
 
+/// Appends the locations a terminal branches to directly.
+static void CollectSuccessors(const IR::Terminal& terminal, std::vector<IR::LocationDescriptor>& successors) {
+    if (const auto* link = boost::get<IR::Term::LinkBlock>(&terminal)) {
+        successors.push_back(link->next);
+    } else if (const auto* link_fast = boost::get<IR::Term::LinkBlockFast>(&terminal)) {
+        successors.push_back(link_fast->next);
+    } else if (const auto* if_ = boost::get<IR::Term::If>(&terminal)) {
+        CollectSuccessors(if_->then_, successors);
+        CollectSuccessors(if_->else_, successors);
+    } else if (const auto* check_bit = boost::get<IR::Term::CheckBit>(&terminal)) {
+        CollectSuccessors(check_bit->then_, successors);
+        CollectSuccessors(check_bit->else_, successors);
+    } else if (const auto* check_halt = boost::get<IR::Term::CheckHalt>(&terminal)) {
+        CollectSuccessors(check_halt->else_, successors);
+    }
+}
+
 static Optimization::PolyfillOptions GenPolyfillOptions(const BlockOfCode& code) {
     return Optimization::PolyfillOptions{
         .sha256 = !code.HasHostFeature(HostFeature::SHA),
@@ -66,9 +88,21 @@ public:
             , emitter(block_of_code, conf, jit)
             , polyfill_options(GenPolyfillOptions(block_of_code)) {
         ASSERT(conf.page_table_address_space_bits >= 12 && conf.page_table_address_space_bits <= 64);
+        if (conf.background_translation || conf.tiered_compilation_threshold != 0) {
+            translation_thread = std::thread{[this] { BackgroundTranslationThread(); }};
+        }
     }
 
-    ~Impl() = default;
+    ~Impl() {
+        if (translation_thread.joinable()) {
+            {
+                std::scoped_lock lock{translation_mutex};
+                stop_translation = true;
+            }
+            translation_cv.notify_one();
+            translation_thread.join();
+        }
+    }
 
     HaltReason Run() {
         ASSERT(!is_executing);
@@ -115,19 +149,50 @@ public:
     }
 
     void ClearCache() {
+        DiscardTranslatedBlocks(0, ~u64{0});
         std::unique_lock lock{invalidation_mutex};
         invalidate_entire_cache = true;
         HaltExecution(HaltReason::CacheInvalidation);
     }
 
     void InvalidateCacheRange(u64 start_address, size_t length) {
-        std::unique_lock lock{invalidation_mutex};
         const auto end_address = static_cast<u64>(start_address + length - 1);
+        DiscardTranslatedBlocks(start_address, end_address);
+        std::unique_lock lock{invalidation_mutex};
         const auto range = boost::icl::discrete_interval<u64>::closed(start_address, end_address);
         invalid_cache_ranges.add(range);
         HaltExecution(HaltReason::CacheInvalidation);
     }
 
+    std::vector<Jit::BlockLocation> GetCompiledBlocks(u64 start_address, size_t length) const {
+        std::vector<Jit::BlockLocation> blocks;
+        for (const IR::LocationDescriptor location : emitter.GetBasicBlockLocations()) {
+            const A64::LocationDescriptor descriptor{location};
+            if (descriptor.SingleStepping() || descriptor.PC() - start_address >= length) {
+                continue;
+            }
+            blocks.push_back({descriptor.PC(), descriptor.FPCR().Value()});
+        }
+        return blocks;
+    }
+
+    void PrecompileBlocks(const std::vector<Jit::BlockLocation>& blocks) {
+        ASSERT(!is_executing);
+        PerformRequestedCacheInvalidation(static_cast<HaltReason>(Atomic::Load(&jit_state.halt_reason)));
+
+        for (const Jit::BlockLocation& block : blocks) {
+            // Keep room for the code compiled at runtime instead of evacuating the cache.
+            if (block_of_code.SpaceRemaining() < conf.code_cache_size / 4) {
+                break;
+            }
+            GetBlock(A64::LocationDescriptor{block.pc, FP::FPCR{block.fpcr}});
+        }
+    }
+
+    Jit::CodeCacheStatistics GetCodeCacheStatistics() const {
+        return code_cache_statistics;
+    }
+
     void Reset() {
         ASSERT(!is_executing);
         jit_state = {};
@@ -255,23 +320,214 @@ private:
     }
 
     CodePtr GetBlock(IR::LocationDescriptor current_location) {
-        if (auto block = emitter.GetBasicBlock(current_location))
-            return block->entrypoint;
+        const bool is_baseline = conf.tiered_compilation_threshold != 0 && !A64::LocationDescriptor{current_location}.SingleStepping();
+        if (auto block = emitter.GetBasicBlock(current_location)) {
+            if (!block->execution_counter || *block->execution_counter != 0)
+                return block->entrypoint;
+            // The baseline block got hot. The optimized tier is translated on the background
+            // thread, the baseline keeps running until it is ready.
+            std::unique_ptr<IR::Block> optimized = TakeTranslatedBlock(current_location, false);
+            if (!optimized) {
+                QueueTranslation(current_location, false);
+                *block->execution_counter = TIER_UP_POLL_INTERVAL;
+                return block->entrypoint;
+            }
+            // Unlink the baseline block and emit the optimized tier in its place.
+            // Emitting relinks every block that jumped to it.
+            emitter.InvalidateBasicBlocks({current_location});
+            jit_state.ResetRSB();
+            ReserveCodeSpace();
+            return emitter.Emit(*optimized, false).entrypoint;
+        }
 
-        constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
-        if (block_of_code.SpaceRemaining() < MINIMUM_REMAINING_CODESIZE) {
-            // Immediately evacuate cache
-            invalidate_entire_cache = true;
-            PerformRequestedCacheInvalidation(HaltReason::CacheInvalidation);
+        ReserveCodeSpace();
+
+        if (conf.background_translation) {
+            if (const std::unique_ptr<IR::Block> translated = TakeTranslatedBlock(current_location, is_baseline)) {
+                QueueSuccessors(*translated);
+                return emitter.Emit(*translated, is_baseline).entrypoint;
+            }
         }
-        block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
 
         // JIT Compile
         const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
         IR::Block ir_block = A64::Translate(A64::LocationDescriptor{current_location}, get_code,
                                             {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct});
-        Optimization::Optimize(ir_block, conf, polyfill_options);
-        return emitter.Emit(ir_block).entrypoint;
+        if (is_baseline) {
+            Optimization::OptimizeBaseline(ir_block, conf, polyfill_options);
+        } else {
+            Optimization::Optimize(ir_block, conf, polyfill_options);
+        }
+        if (conf.background_translation) {
+            QueueSuccessors(ir_block);
+        }
+        return emitter.Emit(ir_block, is_baseline).entrypoint;
+    }
+
+    /// Makes sure the current code segment has room for another block.
+    void ReserveCodeSpace() {
+        const u8* const segment_end = CodeSegmentEnd(current_code_segment);
+        if (static_cast<size_t>(segment_end - block_of_code.getCurr<const u8*>()) < MINIMUM_REMAINING_CODESIZE) {
+            MakeCodeSpace();
+        }
+        block_of_code.EnsureMemoryCommitted(MINIMUM_REMAINING_CODESIZE);
+    }
+
+    /// Queues a location for background translation, unless it is already queued or translated.
+    void QueueTranslation(IR::LocationDescriptor location, bool is_baseline) {
+        {
+            std::scoped_lock lock{translation_mutex};
+            if (translation_queue.size() >= MAX_QUEUED_TRANSLATIONS || !pending_translations.insert(location).second) {
+                return;
+            }
+            translation_queue.push_back({location, is_baseline});
+        }
+        translation_cv.notify_one();
+    }
+
+    /// Queues the blocks a new block branches or returns to for background translation.
+    void QueueSuccessors(const IR::Block& ir_block) {
+        std::vector<IR::LocationDescriptor> successors;
+        CollectSuccessors(ir_block.GetTerminal(), successors);
+        for (const IR::Inst& inst : ir_block) {
+            if (inst.GetOpcode() == IR::Opcode::PushRSB) {
+                successors.push_back(IR::LocationDescriptor{inst.GetArg(0).GetU64()});
+            }
+        }
+        bool has_queued = false;
+        {
+            std::scoped_lock lock{translation_mutex};
+            for (const IR::LocationDescriptor successor : successors) {
+                if (translation_queue.size() >= MAX_QUEUED_TRANSLATIONS) {
+                    break;
+                }
+                if (emitter.GetBasicBlock(successor) || !pending_translations.insert(successor).second) {
+                    continue;
+                }
+                const bool is_baseline = conf.tiered_compilation_threshold != 0 && !A64::LocationDescriptor{successor}.SingleStepping();
+                translation_queue.push_back({successor, is_baseline});
+                has_queued = true;
+            }
+        }
+        if (has_queued) {
+            translation_cv.notify_one();
+        }
+    }
+
+    /// Returns the block translated in the background for a location, null when there is none.
+    std::unique_ptr<IR::Block> TakeTranslatedBlock(IR::LocationDescriptor location, bool is_baseline) {
+        std::scoped_lock lock{translation_mutex};
+        const auto it = translated_blocks.find(location);
+        if (it == translated_blocks.end()) {
+            return nullptr;
+        }
+        TranslatedBlock translated = std::move(it->second);
+        translated_blocks.erase(it);
+        pending_translations.erase(location);
+        if (translated.is_baseline != is_baseline) {
+            return nullptr;
+        }
+        return std::move(translated.ir_block);
+    }
+
+    /// Drops the background translations of blocks overlapping [start_address, end_address], guest
+    /// code may have changed since they were made. Translations still in flight are all dropped.
+    void DiscardTranslatedBlocks(u64 start_address, u64 end_address) {
+        if (!translation_thread.joinable()) {
+            return;
+        }
+        std::scoped_lock lock{translation_mutex};
+        ++translation_generation;
+        translation_queue.clear();
+        pending_translations.clear();
+        for (auto it = translated_blocks.begin(); it != translated_blocks.end();) {
+            const u64 begin = A64::LocationDescriptor{it->second.ir_block->Location()}.PC();
+            const u64 end = A64::LocationDescriptor{it->second.ir_block->EndLocation()}.PC();
+            if (begin <= end_address && end > start_address) {
+                it = translated_blocks.erase(it);
+            } else {
+                pending_translations.insert(it->first);
+                ++it;
+            }
+        }
+    }
+
+    void BackgroundTranslationThread() {
+        const auto get_code = [this](u64 vaddr) { return conf.callbacks->MemoryReadCode(vaddr); };
+        std::unique_lock lock{translation_mutex};
+        while (true) {
+            translation_cv.wait(lock, [this] { return stop_translation || !translation_queue.empty(); });
+            if (stop_translation) {
+                return;
+            }
+            const QueuedTranslation queued = translation_queue.front();
+            translation_queue.pop_front();
+            const u64 generation = translation_generation;
+            lock.unlock();
+
+            // Blocks keep pointers to their inline instructions, construct them in place
+            std::unique_ptr<IR::Block> ir_block{new IR::Block(A64::Translate(A64::LocationDescriptor{queued.location}, get_code,
+                                                                             {conf.define_unpredictable_behaviour, conf.wall_clock_cntpct}))};
+            if (queued.is_baseline) {
+                Optimization::OptimizeBaseline(*ir_block, conf, polyfill_options);
+            } else {
+                Optimization::Optimize(*ir_block, conf, polyfill_options);
+            }
+
+            lock.lock();
+            if (generation != translation_generation) {
+                continue;
+            }
+            if (translated_blocks.size() >= MAX_TRANSLATED_BLOCKS) {
+                // Make room by dropping an older translation execution never reached
+                const auto stale = translated_blocks.begin();
+                pending_translations.erase(stale->first);
+                translated_blocks.erase(stale);
+            }
+            translated_blocks.insert_or_assign(queued.location, TranslatedBlock{std::move(ir_block), queued.is_baseline});
+        }
+    }
+
+    size_t CodeSegmentSize() const {
+        const size_t prelude_size = static_cast<const u8*>(block_of_code.GetCodeBegin()) - block_of_code.getCode();
+        return (block_of_code.GetTotalCodeSize() - prelude_size) / NUM_CODE_SEGMENTS;
+    }
+
+    const u8* CodeSegmentBegin(size_t segment) const {
+        return static_cast<const u8*>(block_of_code.GetCodeBegin()) + segment * CodeSegmentSize();
+    }
+
+    /// Small caches would have segments too small to be useful, they're cleared entirely instead.
+    bool UsesCodeSegments() const {
+        return CodeSegmentSize() >= MINIMUM_CODE_SEGMENT_SIZE;
+    }
+
+    const u8* CodeSegmentEnd(size_t segment) const {
+        if (segment == NUM_CODE_SEGMENTS - 1 || !UsesCodeSegments()) {
+            return block_of_code.getCode() + block_of_code.GetTotalCodeSize();
+        }
+        return CodeSegmentBegin(segment + 1);
+    }
+
+    /// Moves emission to the next code segment, evicting the blocks it holds since it was last filled.
+    void MakeCodeSpace() {
+        if (!UsesCodeSegments()) {
+            ++code_cache_statistics.full_clears;
+            invalidate_entire_cache = true;
+            PerformRequestedCacheInvalidation(HaltReason::CacheInvalidation);
+            return;
+        }
+        current_code_segment = (current_code_segment + 1) % NUM_CODE_SEGMENTS;
+        if (current_code_segment == 0) {
+            is_code_cache_full = true;
+        }
+        const u8* const begin = CodeSegmentBegin(current_code_segment);
+        if (is_code_cache_full) {
+            ++code_cache_statistics.evictions;
+            jit_state.ResetRSB();
+            emitter.EvictBlocks(begin, CodeSegmentEnd(current_code_segment));
+        }
+        block_of_code.SetCodePtr(begin);
     }
 
     void PerformRequestedCacheInvalidation(HaltReason hr) {
@@ -288,6 +544,8 @@ private:
             if (invalidate_entire_cache) {
                 block_of_code.ClearCache();
                 emitter.ClearCache();
+                current_code_segment = 0;
+                is_code_cache_full = false;
             } else {
                 emitter.InvalidateCacheRanges(invalid_cache_ranges);
             }
@@ -307,6 +565,36 @@ private:
     bool invalidate_entire_cache = false;
     boost::icl::interval_set<u64> invalid_cache_ranges;
     std::mutex invalidation_mutex;
+
+    // The code cache is filled one segment after another. Once the last one is full, the oldest
+    // segment is evicted to make room, so hot code in the other segments survives.
+    static constexpr size_t MINIMUM_REMAINING_CODESIZE = 1 * 1024 * 1024;
+    static constexpr size_t NUM_CODE_SEGMENTS = 4;
+    static constexpr size_t MINIMUM_CODE_SEGMENT_SIZE = 4 * MINIMUM_REMAINING_CODESIZE;
+    size_t current_code_segment = 0;
+    bool is_code_cache_full = false;
+    Jit::CodeCacheStatistics code_cache_statistics{};
+
+    // Background translation state, guarded by translation_mutex
+    static constexpr u32 TIER_UP_POLL_INTERVAL = 64;  ///< Executions between checks for an optimized tier
+    static constexpr size_t MAX_QUEUED_TRANSLATIONS = 256;
+    static constexpr size_t MAX_TRANSLATED_BLOCKS = 1024;
+    struct QueuedTranslation {
+        IR::LocationDescriptor location;
+        bool is_baseline;
+    };
+    struct TranslatedBlock {
+        std::unique_ptr<IR::Block> ir_block;
+        bool is_baseline;
+    };
+    std::deque<QueuedTranslation> translation_queue;
+    ankerl::unordered_dense::map<IR::LocationDescriptor, TranslatedBlock> translated_blocks;
+    ankerl::unordered_dense::set<IR::LocationDescriptor> pending_translations; ///< Queued or translated
+    u64 translation_generation = 0;
+    bool stop_translation = false;
+    std::mutex translation_mutex;
+    std::condition_variable translation_cv;
+    std::thread translation_thread;
 };
 
 Jit::Jit(UserConfig conf)
@@ -330,6 +618,18 @@ void Jit::InvalidateCacheRange(u64 start_address, size_t length) {
     impl->InvalidateCacheRange(start_address, length);
 }
 
+std::vector<Jit::BlockLocation> Jit::GetCompiledBlocks(u64 start_address, size_t length) const {
+    return impl->GetCompiledBlocks(start_address, length);
+}
+
+void Jit::PrecompileBlocks(const std::vector<BlockLocation>& blocks) {
+    impl->PrecompileBlocks(blocks);
+}
+
+Jit::CodeCacheStatistics Jit::GetCodeCacheStatistics() const {
+    return impl->GetCodeCacheStatistics();
+}
+
 void Jit::Reset() {
     impl->Reset();
 }
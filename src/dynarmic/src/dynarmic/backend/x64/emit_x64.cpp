@@ -8,6 +8,7 @@
 
 #include "dynarmic/backend/x64/emit_x64.h"
 
+#include <algorithm>
 #include <iterator>
 
 #include "dynarmic/common/assert.h"
@@ -58,6 +59,15 @@ std::optional<EmitX64::BlockDescriptor> EmitX64::GetBasicBlock(IR::LocationDescr
     return iter->second;
 }
 
+std::vector<IR::LocationDescriptor> EmitX64::GetBasicBlockLocations() const {
+    std::vector<IR::LocationDescriptor> locations;
+    locations.reserve(block_descriptors.size());
+    for (const auto& [location, block] : block_descriptors) {
+        locations.push_back(location);
+    }
+    return locations;
+}
+
 void EmitX64::EmitInvalid(EmitContext&, IR::Inst* inst) {
     UNREACHABLE();
 }
@@ -337,11 +347,11 @@ Xbyak::Label EmitX64::EmitCond(IR::Cond cond) {
     return pass;
 }
 
-EmitX64::BlockDescriptor EmitX64::RegisterBlock(const IR::LocationDescriptor& descriptor, CodePtr entrypoint, size_t size) {
-    PerfMapRegister(entrypoint, code.getCurr(), LocationDescriptorToFriendlyName(descriptor));
+EmitX64::BlockDescriptor EmitX64::RegisterBlock(const IR::LocationDescriptor& descriptor, CodePtr entrypoint, size_t size, const RegAlloc& reg_alloc, u32* execution_counter) {
+    PerfMapRegister(entrypoint, code.getCurr(), LocationDescriptorToFriendlyName(descriptor), reg_alloc.GetSpillCount(), reg_alloc.GetFillCount());
     Patch(descriptor, entrypoint);
 
-    BlockDescriptor block_desc{entrypoint, size};
+    BlockDescriptor block_desc{entrypoint, size, execution_counter};
     block_descriptors.insert({IR::LocationDescriptor{descriptor.Value()}, block_desc});
     return block_desc;
 }
@@ -393,6 +403,7 @@ void EmitX64::Unpatch(const IR::LocationDescriptor& target_desc) {
 void EmitX64::ClearCache() {
     block_descriptors.clear();
     patch_information.clear();
+    execution_counters.clear();
 
     PerfMapClear();
 }
@@ -415,4 +426,24 @@ void EmitX64::InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::Locat
     }
 }
 
+ankerl::unordered_dense::set<IR::LocationDescriptor> EmitX64::EvictBlocks(CodePtr begin, CodePtr end) {
+    const auto is_evicted = [begin, end](CodePtr ptr) {
+        return static_cast<const u8*>(ptr) >= static_cast<const u8*>(begin) && static_cast<const u8*>(ptr) < static_cast<const u8*>(end);
+    };
+    // Drop the patch locations within the evicted code first, unpatching must only rewrite code that stays.
+    for (auto& [target_desc, patch_info] : patch_information) {
+        for (auto* locations : {&patch_info.jg, &patch_info.jz, &patch_info.jmp, &patch_info.mov_rcx}) {
+            locations->erase(std::remove_if(locations->begin(), locations->end(), is_evicted), locations->end());
+        }
+    }
+    ankerl::unordered_dense::set<IR::LocationDescriptor> evicted;
+    for (const auto& [descriptor, block] : block_descriptors) {
+        if (is_evicted(block.entrypoint)) {
+            evicted.insert(descriptor);
+        }
+    }
+    InvalidateBasicBlocks(evicted);
+    return evicted;
+}
+
 }  // namespace Dynarmic::Backend::X64
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 /* This file is part of the dynarmic project.
  * Copyright (c) 2016 MerryMage
  * SPDX-License-Identifier: 0BSD
@@ -6,6 +9,7 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -77,8 +81,9 @@ public:
     struct BlockDescriptor {
         CodePtr entrypoint;  // Entrypoint of emitted code
         size_t size;         // Length in bytes of emitted code
+        u32* execution_counter;  // Executions left before a baseline block is recompiled, null when optimized
     };
-    static_assert(sizeof(BlockDescriptor) == 16);
+    static_assert(sizeof(BlockDescriptor) == 24);
 
     explicit EmitX64(BlockOfCode& code);
     virtual ~EmitX64();
@@ -86,12 +91,19 @@ public:
     /// Looks up an emitted host block in the cache.
     std::optional<BlockDescriptor> GetBasicBlock(IR::LocationDescriptor descriptor) const;
 
+    /// Returns the locations of every emitted host block.
+    std::vector<IR::LocationDescriptor> GetBasicBlockLocations() const;
+
     /// Empties the entire cache.
     virtual void ClearCache();
 
     /// Invalidates a selection of basic blocks.
     void InvalidateBasicBlocks(const ankerl::unordered_dense::set<IR::LocationDescriptor>& locations);
 
+    /// Invalidates the basic blocks emitted within [begin, end), so the memory can be emitted to again.
+    /// Returns the locations of the evicted blocks.
+    virtual ankerl::unordered_dense::set<IR::LocationDescriptor> EvictBlocks(CodePtr begin, CodePtr end);
+
 protected:
     // Microinstruction emitters
 #define OPCODE(name, type, ...) void Emit##name(EmitContext& ctx, IR::Inst* inst);
@@ -107,7 +119,7 @@ protected:
     virtual std::string LocationDescriptorToFriendlyName(const IR::LocationDescriptor&) const = 0;
     void EmitAddCycles(size_t cycles);
     Xbyak::Label EmitCond(IR::Cond cond);
-    BlockDescriptor RegisterBlock(const IR::LocationDescriptor& location_descriptor, CodePtr entrypoint, size_t size);
+    BlockDescriptor RegisterBlock(const IR::LocationDescriptor& location_descriptor, CodePtr entrypoint, size_t size, const RegAlloc& reg_alloc, u32* execution_counter = nullptr);
     void PushRSBHelper(Xbyak::Reg64 loc_desc_reg, Xbyak::Reg64 index_reg, IR::LocationDescriptor target);
 
     void EmitVerboseDebuggingOutput(RegAlloc& reg_alloc);
@@ -143,6 +155,7 @@ protected:
     ExceptionHandler exception_handler;
     ankerl::unordered_dense::map<IR::LocationDescriptor, BlockDescriptor> block_descriptors;
     ankerl::unordered_dense::map<IR::LocationDescriptor, PatchInformation> patch_information;
+    std::deque<u32> execution_counters;
 
     // We need materialized protected members
     friend class A64EmitX64;
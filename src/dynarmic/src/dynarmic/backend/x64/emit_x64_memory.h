@@ -340,43 +340,52 @@ const void* EmitWriteMemoryMov(BlockOfCode& code, const Xbyak::RegExp& addr, int
 }
 
 template<typename UserConfig>
-void EmitExclusiveLock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
+void EmitExclusiveLockPointer(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
+    code.mov(tmp.cvt64(), std::bit_cast<u64>(GetExclusiveMonitorLockPointer(conf.global_monitor, 0)));
+    code.mov(pointer.cvt32(), vaddr.cvt32());
+    code.and_(pointer.cvt32(), GetExclusiveMonitorLockOffsetMask());
+    code.add(pointer, tmp.cvt64());
+}
+
+template<typename UserConfig>
+void EmitExclusiveLock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
     if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
         return;
     }
 
-    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorLockPointer(conf.global_monitor)));
+    EmitExclusiveLockPointer(code, conf, vaddr, pointer, tmp);
     EmitSpinLockLock(code, pointer, tmp);
 }
 
 template<typename UserConfig>
-void EmitExclusiveUnlock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
+void EmitExclusiveUnlock(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg32 tmp) {
     if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
         return;
     }
 
-    code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorLockPointer(conf.global_monitor)));
+    EmitExclusiveLockPointer(code, conf, vaddr, pointer, tmp);
     EmitSpinLockUnlock(code, pointer, tmp);
 }
 
 template<typename UserConfig>
-void EmitExclusiveTestAndClear(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 tmp) {
+void EmitExclusiveTestAndClear(BlockOfCode& code, const UserConfig& conf, Xbyak::Reg64 vaddr, Xbyak::Reg64 pointer, Xbyak::Reg64 invalid, Xbyak::Reg64 tmp) {
     if (conf.HasOptimization(OptimizationFlag::Unsafe_IgnoreGlobalMonitor)) {
         return;
     }
 
-    code.mov(tmp, 0xDEAD'DEAD'DEAD'DEAD);
+    // Only the lock of vaddr is held, other processors may be marking a different address at the
+    // same time so their reservations are cleared with a compare and swap.
+    ASSERT(tmp.getIdx() == Xbyak::Operand::RAX);
+    code.mov(invalid, 0xDEAD'DEAD'DEAD'DEAD);
     const size_t processor_count = GetExclusiveMonitorProcessorCount(conf.global_monitor);
     for (size_t processor_index = 0; processor_index < processor_count; processor_index++) {
         if (processor_index == conf.processor_id) {
             continue;
         }
-        Xbyak::Label ok;
         code.mov(pointer, std::bit_cast<u64>(GetExclusiveMonitorAddressPointer(conf.global_monitor, processor_index)));
-        code.cmp(qword[pointer], vaddr);
-        code.jne(ok, code.T_NEAR);
-        code.mov(qword[pointer], tmp);
-        code.L(ok);
+        code.mov(tmp, vaddr);
+        code.lock();
+        code.cmpxchg(qword[pointer], invalid);
     }
 }
 
@@ -21,37 +21,37 @@ size_t ExclusiveMonitor::GetProcessorCount() const {
     return exclusive_addresses.size();
 }
 
-void ExclusiveMonitor::Lock() {
-    lock.Lock();
+void ExclusiveMonitor::Lock(VAddr masked_address) {
+    locks[LockIndex(masked_address)].lock.Lock();
 }
 
-void ExclusiveMonitor::Unlock() {
-    lock.Unlock();
+void ExclusiveMonitor::Unlock(VAddr masked_address) {
+    locks[LockIndex(masked_address)].lock.Unlock();
 }
 
 bool ExclusiveMonitor::CheckAndClear(std::size_t processor_id, VAddr address) {
     const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
-    Lock();
-    if (exclusive_addresses[processor_id] != masked_address) {
-        Unlock();
+    Lock(masked_address);
+    if (std::atomic_ref{exclusive_addresses[processor_id]}.load(std::memory_order_relaxed) != masked_address) {
+        Unlock(masked_address);
         return false;
     }
-    for (VAddr& other_address : exclusive_addresses)
-        if (other_address == masked_address)
-            other_address = INVALID_EXCLUSIVE_ADDRESS;
+    for (VAddr& other_address : exclusive_addresses) {
+        // Other processors may be marking a different address at the same time
+        VAddr expected = masked_address;
+        std::atomic_ref{other_address}.compare_exchange_strong(expected, INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
+    }
     return true;
 }
 
 void ExclusiveMonitor::Clear() {
-    Lock();
-    std::fill(exclusive_addresses.begin(), exclusive_addresses.end(), INVALID_EXCLUSIVE_ADDRESS);
-    Unlock();
+    for (VAddr& address : exclusive_addresses) {
+        std::atomic_ref{address}.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
+    }
 }
 
 void ExclusiveMonitor::ClearProcessor(size_t processor_id) {
-    Lock();
-    exclusive_addresses[processor_id] = INVALID_EXCLUSIVE_ADDRESS;
-    Unlock();
+    std::atomic_ref{exclusive_addresses[processor_id]}.store(INVALID_EXCLUSIVE_ADDRESS, std::memory_order_relaxed);
 }
 
 }  // namespace Dynarmic
@@ -9,8 +9,14 @@
 
 namespace Dynarmic {
 
-inline volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor* monitor) {
-    return &monitor->lock.storage;
+inline volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor* monitor, size_t index) {
+    return &monitor->locks[index].lock.storage;
+}
+
+/// The lock of an address is at GetExclusiveMonitorLockPointer(monitor, 0) + (address & mask)
+constexpr std::uint32_t GetExclusiveMonitorLockOffsetMask() {
+    static_assert(sizeof(ExclusiveMonitor::PaddedSpinLock) == 1 << ExclusiveMonitor::LOCK_GRANULE_SHIFT);
+    return std::uint32_t(ExclusiveMonitor::LOCK_COUNT - 1) << ExclusiveMonitor::LOCK_GRANULE_SHIFT;
 }
 
 inline size_t GetExclusiveMonitorProcessorCount(ExclusiveMonitor* monitor) {
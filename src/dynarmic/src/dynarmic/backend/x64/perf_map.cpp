@@ -46,7 +46,7 @@ void OpenFile() {
 }  // anonymous namespace
 
 namespace detail {
-void PerfMapRegister(const void* start, const void* end, std::string_view friendly_name) {
+void PerfMapRegister(const void* start, const void* end, std::string_view friendly_name, u32 spill_count, u32 fill_count) {
     if (start == end) {
         // Nothing to register
         return;
@@ -61,7 +61,10 @@ void PerfMapRegister(const void* start, const void* end, std::string_view friend
         }
     }
 
-    const std::string line = fmt::format("{:016x} {:016x} {:s}\n", reinterpret_cast<u64>(start), reinterpret_cast<u64>(end) - reinterpret_cast<u64>(start), friendly_name);
+    const u64 size = reinterpret_cast<u64>(end) - reinterpret_cast<u64>(start);
+    const std::string line = spill_count == 0 && fill_count == 0
+        ? fmt::format("{:016x} {:016x} {:s}\n", reinterpret_cast<u64>(start), size, friendly_name)
+        : fmt::format("{:016x} {:016x} {:s} [spills: {:d}, fills: {:d}]\n", reinterpret_cast<u64>(start), size, friendly_name, spill_count, fill_count);
     std::fwrite(line.data(), sizeof *line.data(), line.size(), file);
 }
 }  // namespace detail
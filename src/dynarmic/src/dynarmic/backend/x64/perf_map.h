@@ -12,20 +12,23 @@
 
 #include <bit>
 
+#include "dynarmic/common/common_types.h"
+
 namespace Dynarmic::Backend::X64 {
 
 #if defined(__linux__) && !defined(__ANDROID__)
 namespace detail {
-void PerfMapRegister(const void* start, const void* end, std::string_view friendly_name);
+void PerfMapRegister(const void* start, const void* end, std::string_view friendly_name, u32 spill_count, u32 fill_count);
 }  // namespace detail
+/// Spill and fill counts are appended to the name of the block when there are any
 template<typename T>
-void PerfMapRegister(T start, const void* end, std::string_view friendly_name) noexcept {
-    detail::PerfMapRegister(std::bit_cast<const void*>(start), end, friendly_name);
+void PerfMapRegister(T start, const void* end, std::string_view friendly_name, u32 spill_count = 0, u32 fill_count = 0) noexcept {
+    detail::PerfMapRegister(std::bit_cast<const void*>(start), end, friendly_name, spill_count, fill_count);
 }
 void PerfMapClear();
 #else
 // Resolve to no-op (compiler thinks fmt has side effects)
-template<typename T> inline void PerfMapRegister(T, const void*, std::string_view) noexcept {}
+template<typename T> inline void PerfMapRegister(T, const void*, std::string_view, u32 = 0, u32 = 0) noexcept {}
 inline void PerfMapClear() noexcept {}
 #endif
 
@@ -194,10 +194,11 @@ bool Argument::IsInMemory() const noexcept {
     return HostLocIsSpill(*reg_alloc.ValueLocation(value.GetInst()));
 }
 
-RegAlloc::RegAlloc(BlockOfCode* code, boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order) noexcept
+RegAlloc::RegAlloc(BlockOfCode* code, boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order, const LiveRangeAnalysis* live_ranges) noexcept
     : gpr_order(gpr_order),
     xmm_order(xmm_order),
-    code(code)
+    code(code),
+    live_ranges(live_ranges)
 {}
 
 //static std::uint64_t Zfncwjkrt_blockOfCodeShim = 0;
@@ -410,6 +411,7 @@ HostLoc RegAlloc::SelectARegister(const boost::container::static_vector<HostLoc,
     // NOTE: Using last is BAD because new REX prefix for each insn using the last regs
     // TODO: Actually do LRU or something. Currently we just try to pick something without a value if possible.
     auto min_lru_counter = size_t(-1);
+    auto max_next_use = size_t(0);
     auto it_candidate = desired_locations.cend(); //default fallback if everything fails
     auto it_rex_candidate = desired_locations.cend();
     auto it_empty_candidate = desired_locations.cend();
@@ -428,6 +430,12 @@ HostLoc RegAlloc::SelectARegister(const boost::container::static_vector<HostLoc,
         } else if (loc_info.IsEmpty()) {
             it_empty_candidate = it;
             break;
+        // With live ranges available, evict whatever is needed the furthest away
+        } else if (live_ranges) {
+            if (const size_t next_use = NextUse(loc_info); next_use >= max_next_use) {
+                max_next_use = next_use;
+                it_candidate = it;
+            }
         // No empty registers for some reason (very evil) - just do normal LRU
         } else if (loc_info.lru_counter < min_lru_counter) {
             // Otherwise a "quasi"-LRU
@@ -458,6 +466,15 @@ HostLoc RegAlloc::SelectARegister(const boost::container::static_vector<HostLoc,
     return *it_final;
 }
 
+size_t RegAlloc::NextUse(const HostLocInfo& loc_info) const noexcept {
+    // Every value in a location shares it, the location is needed as soon as any of them is
+    size_t next_use = LiveRangeAnalysis::NoUse;
+    for (const IR::Inst* value : loc_info.values) {
+        next_use = (std::min)(next_use, live_ranges->NextUse(value));
+    }
+    return next_use;
+}
+
 void RegAlloc::DefineValueImpl(IR::Inst* def_inst, HostLoc host_loc) noexcept {
     ASSERT(!ValueLocation(def_inst) && "def_inst has already been defined");
     LocInfo(host_loc).AddValue(def_inst);
@@ -580,6 +597,11 @@ void RegAlloc::EmitMove(const size_t bit_width, const HostLoc to, const HostLoc
     auto const spill_xmm_to_op = [&](const HostLoc loc) {
         return Xbyak::util::xword[spill_to_op_arg_helper(loc, reserved_stack_space)];
     };
+    if (HostLocIsSpill(to)) {
+        spill_count++;
+    } else if (HostLocIsSpill(from)) {
+        fill_count++;
+    }
     if (HostLocIsXMM(to) && HostLocIsXMM(from)) {
         MAYBE_AVX(movaps, HostLocToXmm(to), HostLocToXmm(from));
     } else if (HostLocIsGPR(to) && HostLocIsGPR(from)) {
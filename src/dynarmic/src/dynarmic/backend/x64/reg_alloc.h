@@ -22,6 +22,7 @@
 #include "dynarmic/backend/x64/block_of_code.h"
 #include "dynarmic/backend/x64/hostloc.h"
 #include "dynarmic/backend/x64/stack_layout.h"
+#include "dynarmic/backend/live_range_analysis.h"
 #include "dynarmic/backend/x64/oparg.h"
 #include "dynarmic/backend/x64/abi.h"
 #include "dynarmic/ir/cond.h"
@@ -146,7 +147,7 @@ class RegAlloc final {
 public:
     using ArgumentInfo = std::array<Argument, IR::max_arg_count>;
     RegAlloc() noexcept = default;
-    RegAlloc(BlockOfCode* code, boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order) noexcept;
+    RegAlloc(BlockOfCode* code, boost::container::static_vector<HostLoc, 28> gpr_order, boost::container::static_vector<HostLoc, 28> xmm_order, const LiveRangeAnalysis* live_ranges = nullptr) noexcept;
 
     ArgumentInfo GetArgumentInfo(const IR::Inst* inst) noexcept;
     void RegisterPseudoOperation(const IR::Inst* inst) noexcept;
@@ -218,10 +219,20 @@ public:
             hostloc_info[i].EmitVerboseDebuggingOutput(code, i);
         }
     }
+
+    /// Number of values moved from a register to the stack since the start of the block
+    inline u32 GetSpillCount() const noexcept {
+        return spill_count;
+    }
+    /// Number of values moved from the stack back to a register since the start of the block
+    inline u32 GetFillCount() const noexcept {
+        return fill_count;
+    }
 private:
     friend struct Argument;
 
     HostLoc SelectARegister(const boost::container::static_vector<HostLoc, 28>& desired_locations) const noexcept;
+    size_t NextUse(const HostLocInfo& loc_info) const noexcept;
     inline std::optional<HostLoc> ValueLocation(const IR::Inst* value) const noexcept {
         for (size_t i = 0; i < hostloc_info.size(); i++) {
             if (hostloc_info[i].ContainsValue(value)) {
@@ -263,7 +274,10 @@ private:
     alignas(64) boost::container::static_vector<HostLoc, 28> xmm_order;
     alignas(64) std::array<HostLocInfo, NonSpillHostLocCount + SpillCount> hostloc_info;
     BlockOfCode* code = nullptr;
+    const LiveRangeAnalysis* live_ranges = nullptr;
     size_t reserved_stack_space = 0;
+    u32 spill_count = 0;
+    u32 fill_count = 0;
 };
 // Ensure a cache line (or less) is used, this is primordial
 static_assert(sizeof(boost::container::static_vector<HostLoc, 28>) == 40);
@@ -51,6 +51,38 @@ public:
      */
     void InvalidateCacheRange(std::uint64_t start_address, std::size_t length);
 
+    /// Guest location of a translated block, independent of where its host code was emitted.
+    struct BlockLocation {
+        std::uint64_t pc;
+        std::uint32_t fpcr;
+    };
+
+    /**
+     * Returns the locations of the blocks in the code cache that start within a range.
+     * Single stepping blocks are not included.
+     * @param start_address The starting address of the range.
+     * @param length The length (in bytes) of the range.
+     */
+    std::vector<BlockLocation> GetCompiledBlocks(std::uint64_t start_address, std::size_t length) const;
+
+    /**
+     * Translates and emits blocks ahead of their first execution, blocks that are already in
+     * the code cache are skipped. Cannot be called from a callback.
+     */
+    void PrecompileBlocks(const std::vector<BlockLocation>& blocks);
+
+    /// Counts how the code cache made room for new code once it was full.
+    struct CodeCacheStatistics {
+        std::uint64_t evictions;    ///< Times only the oldest part of the cache was evicted
+        std::uint64_t full_clears;  ///< Times the whole cache was cleared
+    };
+
+    /**
+     * Returns how often the code cache ran out of space. Clears requested through ClearCache
+     * are not counted.
+     */
+    CodeCacheStatistics GetCodeCacheStatistics() const;
+
     /**
      * Reset CPU state to state at startup. Does not clear code cache.
      * Cannot be called from a callback.
@@ -293,6 +293,22 @@ struct UserConfig {
     /// AddTicks and GetTicksRemaining are never called, and no cycle counting is done.
     bool enable_cycle_counting = true;
 
+    /// Enables tiered compilation when non-zero. Blocks are first translated with only the
+    /// passes required for correctness, and are recompiled with every enabled optimization
+    /// once they have been executed this many times. The optimized tier is translated on a
+    /// background thread, which then also calls MemoryReadCode. Only supported by the x64 backend.
+    std::uint32_t tiered_compilation_threshold = 0;
+
+    /// Translates the direct branch targets and return addresses of newly compiled blocks on a
+    /// background thread, so their IR is ready once execution reaches them. MemoryReadCode is
+    /// then also called from that thread. Only supported by the x64 backend.
+    bool background_translation = false;
+
+    /// When the register allocator runs out of registers, spill the value whose next use is the
+    /// furthest away, found by a live range analysis of the block, rather than the least
+    /// recently allocated register. Helps long blocks with many vector values live at once.
+    bool live_range_spilling = false;
+
     /// Internal use only
     bool very_verbose_debugging_output = false;
 
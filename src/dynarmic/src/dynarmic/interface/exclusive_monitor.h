@@ -6,6 +6,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -34,11 +35,11 @@ public:
         static_assert(std::is_trivially_copyable_v<T>);
         const VAddr masked_address = address & RESERVATION_GRANULE_MASK;
 
-        Lock();
-        exclusive_addresses[processor_id] = masked_address;
+        Lock(masked_address);
+        std::atomic_ref{exclusive_addresses[processor_id]}.store(masked_address, std::memory_order_relaxed);
         const T value = op();
         std::memcpy(exclusive_values[processor_id].data(), &value, sizeof(T));
-        Unlock();
+        Unlock(masked_address);
         return value;
     }
 
@@ -57,7 +58,7 @@ public:
         std::memcpy(&saved_value, exclusive_values[processor_id].data(), sizeof(T));
         const bool result = op(saved_value);
 
-        Unlock();
+        Unlock(address & RESERVATION_GRANULE_MASK);
         return result;
     }
 
@@ -69,10 +70,11 @@ public:
 private:
     bool CheckAndClear(size_t processor_id, VAddr address);
 
-    void Lock();
-    void Unlock();
+    void Lock(VAddr masked_address);
+    void Unlock(VAddr masked_address);
 
-    friend volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor*);
+    friend volatile int* GetExclusiveMonitorLockPointer(ExclusiveMonitor*, size_t index);
+    friend constexpr std::uint32_t GetExclusiveMonitorLockOffsetMask();
     friend size_t GetExclusiveMonitorProcessorCount(ExclusiveMonitor*);
     friend VAddr* GetExclusiveMonitorAddressPointer(ExclusiveMonitor*, size_t index);
     friend Vector* GetExclusiveMonitorValuePointer(ExclusiveMonitor*, size_t index);
@@ -82,7 +84,20 @@ private:
     static constexpr size_t MAX_NUM_CPU_CORES = 4; // Sync with src/core/hardware_properties
     boost::container::static_vector<VAddr, MAX_NUM_CPU_CORES> exclusive_addresses;
     boost::container::static_vector<Vector, MAX_NUM_CPU_CORES> exclusive_values;
-    SpinLock lock;
+
+    // Exclusive accesses to different addresses don't have to wait on each other, so instead of
+    // one global lock there is one for every cache line in a page, each in a line of its own.
+    // Reservations of other processors are only ever cleared with a compare and swap, so taking
+    // the lock of the address being accessed is enough.
+    static constexpr size_t LOCK_GRANULE_SHIFT = 6;
+    static constexpr size_t LOCK_COUNT = 64;
+    struct alignas(1 << LOCK_GRANULE_SHIFT) PaddedSpinLock {
+        SpinLock lock;
+    };
+    static constexpr size_t LockIndex(VAddr masked_address) {
+        return (masked_address >> LOCK_GRANULE_SHIFT) & (LOCK_COUNT - 1);
+    }
+    std::array<PaddedSpinLock, LOCK_COUNT> locks;
 };
 
 }  // namespace Dynarmic
@@ -1517,4 +1517,13 @@ void Optimize(IR::Block& block, const A64::UserConfig& conf, const Optimization:
     }
 }
 
+void OptimizeBaseline(IR::Block& block, const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options) {
+    Optimization::PolyfillPass(block, polyfill_options);
+    Optimization::A64CallbackConfigPass(block, conf);
+    Optimization::NamingPass(block);
+    if (!conf.HasOptimization(OptimizationFlag::DisableVerification)) {
+        Optimization::VerificationPass(block);
+    }
+}
+
 }  // namespace Dynarmic::Optimization
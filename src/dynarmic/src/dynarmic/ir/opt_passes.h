@@ -33,5 +33,7 @@ struct PolyfillOptions {
 
 void Optimize(IR::Block& block, const A32::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
 void Optimize(IR::Block& block, const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
+/// Only runs the passes required for the block to be emitted, used by the first compilation tier.
+void OptimizeBaseline(IR::Block& block, const A64::UserConfig& conf, const Optimization::PolyfillOptions& polyfill_options);
 
 }  // namespace Dynarmic::Optimization
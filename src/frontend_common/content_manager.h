@@ -138,27 +138,10 @@ inline bool RemoveMod(const Service::FileSystem::FileSystemController& fs_contro
 inline InstallResult InstallNSP(Core::System& system, FileSys::VfsFilesystem& vfs,
                                 const std::string& filename,
                                 const std::function<bool(size_t, size_t)>& callback) {
-    const auto copy = [callback](const FileSys::VirtualFile& src, const FileSys::VirtualFile& dest,
-                                 std::size_t block_size) {
-        if (src == nullptr || dest == nullptr) {
-            return false;
-        }
-        if (!dest->Resize(src->GetSize())) {
-            return false;
-        }
-
-        using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
-
-        for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
-            if (callback(src->GetSize(), i)) {
-                dest->Resize(0);
-                return false;
-            }
-            const auto read = src->Read(buffer.data(), buffer.size(), i);
-            dest->Write(buffer.data(), read, i);
-        }
-        return true;
+    const auto copy = [&callback](const FileSys::VirtualFile& src,
+                                  const FileSys::VirtualFile& dest, std::size_t block_size,
+                                  Core::Crypto::SHA256Hash* hash) {
+        return FileSys::VfsPipelinedCopy(src, dest, block_size, hash, callback);
     };
 
     std::shared_ptr<FileSys::NSP> nsp;
@@ -204,27 +187,10 @@ inline InstallResult InstallNCA(FileSys::VfsFilesystem& vfs, const std::string&
                                 FileSys::RegisteredCache& registered_cache,
                                 const FileSys::TitleType title_type,
                                 const std::function<bool(size_t, size_t)>& callback) {
-    const auto copy = [callback](const FileSys::VirtualFile& src, const FileSys::VirtualFile& dest,
-                                 std::size_t block_size) {
-        if (src == nullptr || dest == nullptr) {
-            return false;
-        }
-        if (!dest->Resize(src->GetSize())) {
-            return false;
-        }
-
-        using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
-
-        for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
-            if (callback(src->GetSize(), i)) {
-                dest->Resize(0);
-                return false;
-            }
-            const auto read = src->Read(buffer.data(), buffer.size(), i);
-            dest->Write(buffer.data(), read, i);
-        }
-        return true;
+    const auto copy = [&callback](const FileSys::VirtualFile& src,
+                                  const FileSys::VirtualFile& dest, std::size_t block_size,
+                                  Core::Crypto::SHA256Hash* hash) {
+        return FileSys::VfsPipelinedCopy(src, dest, block_size, hash, callback);
     };
 
     const auto nca =
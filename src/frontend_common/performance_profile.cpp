@@ -0,0 +1,331 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/thread.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
+#include "frontend_common/performance_profile.h"
+#include "video_core/gpu.h"
+#include "video_core/shader_notify.h"
+
+namespace PerformanceProfile {
+
+namespace {
+
+using namespace Common::Literals;
+
+constexpr u32 PROFILE_MAGIC = 0x464F5250; // "PROF"
+constexpr u32 PROFILE_VERSION = 1;
+
+/// Frame time of a full speed frame at 60 Hz, with some slack for timer jitter
+constexpr double SLOW_FRAME_MS = 1000.0 / 60.0 * 1.1;
+/// Frames longer than this while shaders are being built are counted as shader stutter
+constexpr double STUTTER_FRAME_MS = 50.0;
+
+/// Sessions shorter than a minute at full speed are too noisy to learn from
+constexpr u64 MIN_SESSION_FRAMES = 60 * 60;
+/// Share of slow frames above which a title is considered to be struggling
+constexpr double STRUGGLING_RATIO = 0.2;
+/// Share of slow frames below which a title has headroom to get quality back
+constexpr double HEADROOM_RATIO = 0.02;
+/// One shader stutter every this many frames enables asynchronous shaders
+constexpr u64 FRAMES_PER_STUTTER = 1000;
+
+#ifdef ANDROID
+constexpr u64 HIGH_CACHE_MEMORY = 1_GiB;
+#else
+constexpr u64 HIGH_CACHE_MEMORY = 3_GiB;
+#endif
+
+/// Value stored for the learned defaults that are left to the global configuration
+constexpr s32 UNSET = -1;
+
+struct ProfileHeader {
+    u32 magic;
+    u32 version;
+};
+
+struct ProfileElement {
+    TitleStatistics statistics;
+    s32 resolution_setup;
+    s32 use_asynchronous_shaders;
+    s32 astc_recompression;
+    s32 gpu_accuracy;
+};
+
+std::filesystem::path GetProfilePath(u64 program_id) {
+    return Common::FS::GetEdenPath(Common::FS::EdenPath::ConfigDir) / "custom" /
+           fmt::format("{:016X}.perf", program_id);
+}
+
+template <typename T>
+s32 Store(const std::optional<T>& value) {
+    return value ? static_cast<s32>(*value) : UNSET;
+}
+
+template <typename T>
+std::optional<T> Restore(s32 value) {
+    if (value == UNSET) {
+        return std::nullopt;
+    }
+    return static_cast<T>(value);
+}
+
+template <typename T>
+T StepDown(T value) {
+    return static_cast<T>(static_cast<s32>(value) - 1);
+}
+
+template <typename T>
+T StepUp(T value) {
+    return static_cast<T>(static_cast<s32>(value) + 1);
+}
+
+/// Only keeps the learned value when it differs from the global one.
+template <typename T>
+std::optional<T> LearnedOrUnset(T value, T global_value) {
+    if (value == global_value) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+} // Anonymous namespace
+
+std::optional<TitleProfile> LoadProfile(u64 program_id) {
+    const auto path = GetProfilePath(program_id);
+    if (!Common::FS::Exists(path)) {
+        return std::nullopt;
+    }
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                            Common::FS::FileType::BinaryFile};
+    ProfileHeader header{};
+    ProfileElement element{};
+    if (!file.ReadObject(header) || header.magic != PROFILE_MAGIC ||
+        header.version != PROFILE_VERSION || !file.ReadObject(element)) {
+        LOG_WARNING(Frontend, "Ignoring invalid performance profile: {}",
+                    Common::FS::PathToUTF8String(path));
+        return std::nullopt;
+    }
+    return TitleProfile{
+        .statistics = element.statistics,
+        .defaults{
+            .resolution_setup = Restore<Settings::ResolutionSetup>(element.resolution_setup),
+            .use_asynchronous_shaders = Restore<bool>(element.use_asynchronous_shaders),
+            .astc_recompression =
+                Restore<Settings::AstcRecompression>(element.astc_recompression),
+            .gpu_accuracy = Restore<Settings::GpuAccuracy>(element.gpu_accuracy),
+        },
+    };
+}
+
+bool SaveProfile(u64 program_id, const TitleProfile& profile) {
+    const auto path = GetProfilePath(program_id);
+    if (!Common::FS::CreateParentDirs(path)) {
+        return false;
+    }
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Frontend, "Failed to open performance profile: {}",
+                  Common::FS::PathToUTF8String(path));
+        return false;
+    }
+    const ProfileHeader header{
+        .magic = PROFILE_MAGIC,
+        .version = PROFILE_VERSION,
+    };
+    const ProfileElement element{
+        .statistics = profile.statistics,
+        .resolution_setup = Store(profile.defaults.resolution_setup),
+        .use_asynchronous_shaders = Store(profile.defaults.use_asynchronous_shaders),
+        .astc_recompression = Store(profile.defaults.astc_recompression),
+        .gpu_accuracy = Store(profile.defaults.gpu_accuracy),
+    };
+    return file.WriteObject(header) && file.WriteObject(element);
+}
+
+void Learn(LearnedDefaults& defaults, const TitleStatistics& session) {
+    if (session.frames < MIN_SESSION_FRAMES) {
+        return;
+    }
+    const auto& values = Settings::values;
+    const auto global_resolution = values.resolution_setup.GetValue(true);
+    const auto global_accuracy = values.gpu_accuracy.GetValue(true);
+    auto resolution = defaults.resolution_setup.value_or(global_resolution);
+    auto accuracy = defaults.gpu_accuracy.value_or(global_accuracy);
+
+    const double slow_ratio =
+        static_cast<double>(session.slow_frames) / static_cast<double>(session.frames);
+    const bool throttled = session.thermal_throttle_events > 0;
+    // Only go below native resolution when the device is overheating
+    const auto minimum_resolution =
+        throttled ? Settings::ResolutionSetup::Res1_2X : Settings::ResolutionSetup::Res1X;
+
+    if (slow_ratio >= STRUGGLING_RATIO || throttled) {
+        // Accuracy goes first, it costs less image quality than the resolution
+        if (accuracy > Settings::GpuAccuracy::Normal) {
+            accuracy = StepDown(accuracy);
+        } else if (resolution > minimum_resolution) {
+            resolution = StepDown(resolution);
+        }
+    } else if (slow_ratio <= HEADROOM_RATIO) {
+        if (resolution < global_resolution) {
+            resolution = StepUp(resolution);
+        } else if (accuracy < global_accuracy) {
+            accuracy = StepUp(accuracy);
+        }
+    }
+    defaults.resolution_setup = LearnedOrUnset(resolution, global_resolution);
+    defaults.gpu_accuracy = LearnedOrUnset(accuracy, global_accuracy);
+
+    if (session.shader_stutters * FRAMES_PER_STUTTER >= session.frames &&
+        !values.use_asynchronous_shaders.GetValue(true)) {
+        defaults.use_asynchronous_shaders = true;
+    }
+    if (session.cache_memory_peak >= HIGH_CACHE_MEMORY &&
+        values.astc_recompression.GetValue(true) == Settings::AstcRecompression::Uncompressed) {
+        defaults.astc_recompression = Settings::AstcRecompression::Bc3;
+    }
+}
+
+void ApplyLearnedDefaults(u64 program_id) {
+    if (program_id == 0 || !Settings::values.auto_performance_profile.GetValue()) {
+        return;
+    }
+    const auto profile = LoadProfile(program_id);
+    if (!profile) {
+        return;
+    }
+    const auto apply = [](auto& setting, const auto& value) {
+        // Settings chosen in the per-game configuration always win
+        if (!value || !setting.UsingGlobal()) {
+            return;
+        }
+        setting.SetGlobal(false);
+        setting.SetValue(*value);
+        LOG_INFO(Frontend, "Using learned {}={} for this title", setting.GetLabel(),
+                 setting.ToString());
+    };
+    auto& values = Settings::values;
+    const auto& defaults = profile->defaults;
+    apply(values.resolution_setup, defaults.resolution_setup);
+    apply(values.use_asynchronous_shaders, defaults.use_asynchronous_shaders);
+    apply(values.astc_recompression, defaults.astc_recompression);
+    apply(values.gpu_accuracy, defaults.gpu_accuracy);
+}
+
+Recorder::Recorder() = default;
+
+Recorder::~Recorder() {
+    Stop();
+}
+
+void Recorder::Start(Core::System& system, u64 program_id) {
+    Stop();
+    if (program_id == 0 || !Settings::values.auto_performance_profile.GetValue()) {
+        return;
+    }
+    {
+        std::scoped_lock lk{mutex};
+        running_program_id = program_id;
+        session = {};
+        next_frame = system.GetPerfStats().GetSystemFrameCount();
+    }
+    sample_thread = std::jthread(
+        [this, &system](std::stop_token stop_token) { SampleThread(stop_token, system); });
+}
+
+void Recorder::Stop() {
+    if (!sample_thread.joinable()) {
+        return;
+    }
+    sample_thread = {};
+    Save();
+}
+
+void Recorder::ReportThermalThrottle() {
+    std::scoped_lock lk{mutex};
+    if (running_program_id != 0) {
+        ++session.thermal_throttle_events;
+    }
+}
+
+void Recorder::SampleThread(std::stop_token stop_token, Core::System& system) {
+    Common::SetCurrentThreadName("PerfProfile");
+
+    using namespace std::literals::chrono_literals;
+    auto& shader_notify = system.GPU().ShaderNotify();
+    while (!stop_token.stop_requested()) {
+        Common::StoppableTimedWait(stop_token, 1s);
+        Sample(system, shader_notify.ShadersBuilding());
+    }
+}
+
+void Recorder::Sample(Core::System& system, int shaders_building) {
+    const auto& perf_stats = system.GetPerfStats();
+    const auto memory = system.GetMemoryTelemetry();
+    const u64 cache_memory = memory[Core::MemoryCategory::TextureCache].bytes +
+                             memory[Core::MemoryCategory::BufferCache].bytes;
+
+    std::scoped_lock lk{mutex};
+    // The frame time history holds the first hour of emulation, later frames are not sampled
+    const size_t frame_count = perf_stats.GetSystemFrameCount();
+    const auto frametimes = perf_stats.GetFrametimes(next_frame, frame_count);
+    next_frame = frame_count;
+
+    for (const double frametime : frametimes) {
+        ++session.frames;
+        session.frametime_sum_ms += frametime;
+        if (frametime > SLOW_FRAME_MS) {
+            ++session.slow_frames;
+        }
+        // Shader builds are sampled once per interval, attribute its long frames to them
+        if (shaders_building > 0 && frametime > STUTTER_FRAME_MS) {
+            ++session.shader_stutters;
+        }
+    }
+    session.cache_memory_peak = (std::max)(session.cache_memory_peak, cache_memory);
+}
+
+void Recorder::Save() {
+    u64 program_id;
+    TitleStatistics recorded;
+    {
+        std::scoped_lock lk{mutex};
+        program_id = std::exchange(running_program_id, 0);
+        recorded = std::exchange(session, {});
+    }
+    if (program_id == 0 || (recorded.frames == 0 && recorded.thermal_throttle_events == 0)) {
+        return;
+    }
+    auto profile = LoadProfile(program_id).value_or(TitleProfile{});
+    auto& statistics = profile.statistics;
+    statistics.frames += recorded.frames;
+    statistics.frametime_sum_ms += recorded.frametime_sum_ms;
+    statistics.slow_frames += recorded.slow_frames;
+    statistics.shader_stutters += recorded.shader_stutters;
+    statistics.cache_memory_peak = (std::max)(statistics.cache_memory_peak,
+                                              recorded.cache_memory_peak);
+    statistics.thermal_throttle_events += recorded.thermal_throttle_events;
+    Learn(profile.defaults, recorded);
+
+    if (!SaveProfile(program_id, profile)) {
+        LOG_ERROR(Frontend, "Failed to save the performance profile of {:016X}", program_id);
+    }
+}
+
+} // namespace PerformanceProfile
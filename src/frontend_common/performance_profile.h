@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "common/settings_enums.h"
+
+namespace Core {
+class System;
+}
+
+namespace PerformanceProfile {
+
+/// Runtime statistics of a title, accumulated over all of its sessions.
+struct TitleStatistics {
+    /// Number of system frames recorded
+    u64 frames;
+    /// Sum of the recorded frame times in milliseconds
+    double frametime_sum_ms;
+    /// Frames that took longer than a full speed frame
+    u64 slow_frames;
+    /// Frames that hitched while shaders were being built
+    u64 shader_stutters;
+    /// Highest memory used by the texture and buffer caches, in bytes
+    u64 cache_memory_peak;
+    /// Times the device reported it was throttling because of its temperature
+    u64 thermal_throttle_events;
+};
+
+/// Settings learned for a title, empty fields are left to the global configuration.
+struct LearnedDefaults {
+    std::optional<Settings::ResolutionSetup> resolution_setup;
+    std::optional<bool> use_asynchronous_shaders;
+    std::optional<Settings::AstcRecompression> astc_recompression;
+    std::optional<Settings::GpuAccuracy> gpu_accuracy;
+};
+
+struct TitleProfile {
+    TitleStatistics statistics;
+    LearnedDefaults defaults;
+};
+
+/// Reads the profile stored next to the per-game configuration of a title.
+[[nodiscard]] std::optional<TitleProfile> LoadProfile(u64 program_id);
+
+bool SaveProfile(u64 program_id, const TitleProfile& profile);
+
+/**
+ * Adjusts the learned defaults of a title from the statistics of one session. Each session moves
+ * the GPU accuracy or the resolution scale by at most one step, lowering them when the title
+ * struggled and giving them back towards the global values once it runs with headroom.
+ */
+void Learn(LearnedDefaults& defaults, const TitleStatistics& session);
+
+/**
+ * Applies the defaults learned for a title to the settings its per-game configuration leaves on
+ * global. Has to be called after the per-game configuration is loaded and before the title is.
+ * Does nothing unless auto_performance_profile is enabled.
+ */
+void ApplyLearnedDefaults(u64 program_id);
+
+/**
+ * Samples the statistics of the running title on its own thread. Stopping merges the session
+ * into the profile of the title and learns new defaults from it.
+ */
+class Recorder {
+public:
+    explicit Recorder();
+    ~Recorder();
+
+    YUZU_NON_COPYABLE(Recorder);
+    YUZU_NON_MOVEABLE(Recorder);
+
+    /// Starts sampling, the system must stay powered on until Stop is called.
+    void Start(Core::System& system, u64 program_id);
+
+    void Stop();
+
+    /// Counts a thermal throttling event for the running title, callable from any thread.
+    void ReportThermalThrottle();
+
+private:
+    void SampleThread(std::stop_token stop_token, Core::System& system);
+    void Sample(Core::System& system, int shaders_building);
+    void Save();
+
+    std::mutex mutex;
+    u64 running_program_id{};
+    size_t next_frame{};
+    TitleStatistics session{};
+    std::jthread sample_thread;
+};
+
+} // namespace PerformanceProfile
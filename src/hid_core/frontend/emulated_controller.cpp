@@ -15,6 +15,14 @@
 #include "hid_core/hid_util.h"
 
 namespace Core::HID {
+namespace {
+s64 HostTimeNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+} // Anonymous namespace
+
 constexpr s32 HID_JOYSTICK_MAX = 0x7fff;
 constexpr s32 HID_TRIGGER_MAX = 0x7fff;
 constexpr u32 TURBO_BUTTON_DELAY = 4;
@@ -1959,6 +1967,14 @@ NpadColor EmulatedController::GetNpadColor(u32 color) {
 }
 
 void EmulatedController::TriggerOnChange(ControllerTriggerType type, bool is_npad_service_update) {
+    if (is_npad_service_update &&
+        (type == ControllerTriggerType::Button || type == ControllerTriggerType::Stick ||
+         type == ControllerTriggerType::Trigger)) {
+        // Only the first change matters, later ones become visible to the guest with it
+        s64 expected{};
+        pending_input_ns.compare_exchange_strong(expected, HostTimeNs(),
+                                                 std::memory_order_relaxed);
+    }
     std::unique_lock lock{callback_mutex};
     for (const auto& poller_pair : callback_list) {
         const ControllerUpdateCallback& poller = poller_pair.second;
@@ -1987,6 +2003,14 @@ void EmulatedController::DeleteCallback(int key) {
     callback_list.erase(iterator);
 }
 
+std::optional<std::chrono::nanoseconds> EmulatedController::TakeInputAge() {
+    const s64 input_ns = pending_input_ns.exchange(0, std::memory_order_relaxed);
+    if (input_ns == 0) {
+        return std::nullopt;
+    }
+    return std::chrono::nanoseconds{HostTimeNs() - input_ns};
+}
+
 void EmulatedController::StatusUpdate() {
     turbo_button_state = (turbo_button_state + 1) % (TURBO_BUTTON_DELAY * 2);
 
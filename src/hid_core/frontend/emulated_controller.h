@@ -7,9 +7,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_map>
 #include <vector>
@@ -470,6 +473,12 @@ public:
      */
     void DeleteCallback(int key);
 
+    /**
+     * Returns how long ago the oldest input change not taken yet happened and clears it.
+     * Button, stick and trigger changes from the input drivers are stamped when they arrive.
+     */
+    std::optional<std::chrono::nanoseconds> TakeInputAge();
+
     /// Swaps the state of the turbo buttons and updates motion input
     void StatusUpdate();
 
@@ -639,6 +648,9 @@ private:
     std::unordered_map<int, ControllerUpdateCallback> callback_list;
     int last_callback_key = 0;
 
+    // Host time in nanoseconds of the oldest input change not taken yet, zero when there is none
+    std::atomic<s64> pending_input_ns{};
+
     // Stores the current status of all controller input
     ControllerStatus controller;
 };
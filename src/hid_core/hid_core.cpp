@@ -1,6 +1,11 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/assert.h"
 #include "hid_core/frontend/emulated_console.h"
 #include "hid_core/frontend/emulated_controller.h"
@@ -219,4 +224,28 @@ void HIDCore::UnloadInputDevices() {
     devices->UnloadInput();
 }
 
+void HIDCore::RecordInputLatency(std::chrono::nanoseconds latency) {
+    const auto latency_ns = static_cast<u64>((std::max)(latency.count(), s64{0}));
+    latency_total_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    latency_samples.fetch_add(1, std::memory_order_relaxed);
+    u64 max_ns = latency_max_ns.load(std::memory_order_relaxed);
+    while (latency_ns > max_ns &&
+           !latency_max_ns.compare_exchange_weak(max_ns, latency_ns, std::memory_order_relaxed)) {
+    }
+}
+
+InputLatency HIDCore::GetAndResetInputLatency() {
+    const u64 samples = latency_samples.exchange(0, std::memory_order_relaxed);
+    const u64 total_ns = latency_total_ns.exchange(0, std::memory_order_relaxed);
+    const u64 max_ns = latency_max_ns.exchange(0, std::memory_order_relaxed);
+    if (samples == 0) {
+        return {};
+    }
+    return {
+        .average = std::chrono::nanoseconds{static_cast<s64>(total_ns / samples)},
+        .max = std::chrono::nanoseconds{static_cast<s64>(max_ns)},
+        .samples = samples,
+    };
+}
+
 } // namespace Core::HID
@@ -1,8 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "common/common_funcs.h"
@@ -16,6 +21,13 @@ class EmulatedDevices;
 
 namespace Core::HID {
 
+/// Time from an input change to the guest seeing it in shared memory
+struct InputLatency {
+    std::chrono::nanoseconds average{};
+    std::chrono::nanoseconds max{};
+    u64 samples{};
+};
+
 class HIDCore {
 public:
     explicit HIDCore();
@@ -66,6 +78,12 @@ public:
     /// Removes all callbacks from input common
     void UnloadInputDevices();
 
+    /// Accounts an input change that was just written to shared memory
+    void RecordInputLatency(std::chrono::nanoseconds latency);
+
+    /// Returns the latency of the input changes recorded since the last call
+    InputLatency GetAndResetInputLatency();
+
     /// Number of emulated controllers
     static constexpr std::size_t available_controllers{10};
 
@@ -84,6 +102,9 @@ private:
     std::unique_ptr<EmulatedDevices> devices;
     NpadStyleTag supported_style_tag{NpadStyleSet::All};
     NpadIdType last_active_controller{NpadIdType::Handheld};
+    std::atomic<u64> latency_total_ns{};
+    std::atomic<u64> latency_max_ns{};
+    std::atomic<u64> latency_samples{};
 };
 
 } // namespace Core::HID
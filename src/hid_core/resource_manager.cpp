@@ -1,12 +1,17 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "common/logging/log.h"
+#include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/set/system_settings_server.h"
 #include "core/hle/service/sm/sm.h"
+#include "hid_core/frontend/emulated_controller.h"
 #include "hid_core/hid_core.h"
 #include "hid_core/hid_util.h"
 #include "hid_core/resource_manager.h"
@@ -44,6 +49,9 @@ namespace Service::HID {
 // Correct npad_update_ns is 4ms this is overclocked to lower input lag
 constexpr auto npad_update_ns = std::chrono::nanoseconds{1 * 1000 * 1000};    // (1ms, 1000Hz)
 constexpr auto default_update_ns = std::chrono::nanoseconds{4 * 1000 * 1000}; // (4ms, 1000Hz)
+// With event driven input the pad is sampled at the hardware rate and input changes are pushed
+// as they happen, at most once per npad_update_ns
+constexpr auto npad_event_driven_update_ns = std::chrono::nanoseconds{4 * 1000 * 1000}; // (4ms)
 constexpr auto mouse_keyboard_update_ns = std::chrono::nanoseconds{8 * 1000 * 1000}; // (8ms, 125Hz)
 constexpr auto motion_update_ns = std::chrono::nanoseconds{5 * 1000 * 1000};         // (5ms, 200Hz)
 
@@ -59,6 +67,15 @@ ResourceManager::ResourceManager(Core::System& system_,
                                                       UpdateNpad(ns_late);
                                                       return std::nullopt;
                                                   });
+    npad_request_event = Core::Timing::CreateEvent(
+        "HID::RequestPadCallback",
+        [this](s64 time,
+               std::chrono::nanoseconds ns_late) -> std::optional<std::chrono::nanoseconds> {
+            // Cleared first so changes arriving during the update request another one
+            npad_update_requested.store(false);
+            UpdateNpad(ns_late);
+            return std::nullopt;
+        });
     default_update_event = Core::Timing::CreateEvent(
         "HID::UpdateDefaultCallback",
         [this](s64 time,
@@ -83,7 +100,14 @@ ResourceManager::ResourceManager(Core::System& system_,
 }
 
 ResourceManager::~ResourceManager() {
+    if (is_event_driven_input) {
+        for (std::size_t i = 0; i < npad_input_callback_keys.size(); ++i) {
+            system.HIDCore().GetEmulatedControllerByIndex(i)->DeleteCallback(
+                npad_input_callback_keys[i]);
+        }
+    }
     system.CoreTiming().UnscheduleEvent(npad_update_event);
+    system.CoreTiming().UnscheduleEvent(npad_request_event);
     system.CoreTiming().UnscheduleEvent(default_update_event);
     system.CoreTiming().UnscheduleEvent(mouse_keyboard_update_event);
     system.CoreTiming().UnscheduleEvent(motion_update_event);
@@ -248,7 +272,26 @@ void ResourceManager::InitializeHidCommonSampler() {
     sleep_button->SetAppletResource(applet_resource, &shared_mutex);
     capture_button->SetAppletResource(applet_resource, &shared_mutex);
 
-    system.CoreTiming().ScheduleLoopingEvent(npad_update_ns, npad_update_ns, npad_update_event);
+    is_event_driven_input = Settings::values.event_driven_input.GetValue();
+    if (is_event_driven_input) {
+        for (std::size_t i = 0; i < npad_input_callback_keys.size(); ++i) {
+            Core::HID::ControllerUpdateCallback engine_callback{
+                .on_change =
+                    [this](Core::HID::ControllerTriggerType type) {
+                        if (type == Core::HID::ControllerTriggerType::Button ||
+                            type == Core::HID::ControllerTriggerType::Stick ||
+                            type == Core::HID::ControllerTriggerType::Trigger) {
+                            RequestNpadUpdate();
+                        }
+                    },
+                .is_npad_service = true,
+            };
+            npad_input_callback_keys[i] =
+                system.HIDCore().GetEmulatedControllerByIndex(i)->SetCallback(engine_callback);
+        }
+    }
+    const auto npad_period = is_event_driven_input ? npad_event_driven_update_ns : npad_update_ns;
+    system.CoreTiming().ScheduleLoopingEvent(npad_period, npad_period, npad_update_event);
     system.CoreTiming().ScheduleLoopingEvent(default_update_ns, default_update_ns,
                                              default_update_event);
     system.CoreTiming().ScheduleLoopingEvent(mouse_keyboard_update_ns, mouse_keyboard_update_ns,
@@ -483,9 +526,20 @@ void ResourceManager::UpdateControllers(std::chrono::nanoseconds ns_late) {
 
 void ResourceManager::UpdateNpad(std::chrono::nanoseconds ns_late) {
     auto& core_timing = system.CoreTiming();
+    last_npad_update_ns.store(core_timing.GetGlobalTimeNs().count());
     npad->OnUpdate(core_timing);
 }
 
+void ResourceManager::RequestNpadUpdate() {
+    if (npad_update_requested.exchange(true)) {
+        return;
+    }
+    const auto now = system.CoreTiming().GetGlobalTimeNs();
+    const auto next_update = std::chrono::nanoseconds{last_npad_update_ns.load()} + npad_update_ns;
+    const auto delay = next_update > now ? next_update - now : std::chrono::nanoseconds{0};
+    system.CoreTiming().ScheduleEvent(delay, npad_request_event);
+}
+
 void ResourceManager::UpdateMouseKeyboard(std::chrono::nanoseconds ns_late) {
     auto& core_timing = system.CoreTiming();
     mouse->OnUpdate(core_timing);
@@ -1,10 +1,17 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #pragma once
 
+#include <array>
+#include <atomic>
+
 #include "core/hle/service/kernel_helpers.h"
 #include "core/hle/service/service.h"
+#include "hid_core/hid_core.h"
 
 namespace Core {
 class System;
@@ -122,6 +129,9 @@ private:
     void InitializeConsoleSixAxisSampler();
     void InitializeAHidSampler();
 
+    /// Schedules an npad update as soon as the minimum interval since the last one allows it
+    void RequestNpadUpdate();
+
     bool is_initialized{false};
 
     mutable std::recursive_mutex shared_mutex;
@@ -148,6 +158,11 @@ private:
     std::shared_ptr<SleepButton> sleep_button{nullptr};
     std::shared_ptr<UniquePad> unique_pad{nullptr};
     std::shared_ptr<Core::Timing::EventType> npad_update_event;
+    std::shared_ptr<Core::Timing::EventType> npad_request_event;
+    std::array<int, Core::HID::HIDCore::available_controllers> npad_input_callback_keys{};
+    bool is_event_driven_input{false};
+    std::atomic<bool> npad_update_requested{false};
+    std::atomic<s64> last_npad_update_ns{0};
     std::shared_ptr<Core::Timing::EventType> default_update_event;
     std::shared_ptr<Core::Timing::EventType> mouse_keyboard_update_event;
     std::shared_ptr<Core::Timing::EventType> motion_update_event;
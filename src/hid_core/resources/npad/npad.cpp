@@ -615,6 +615,10 @@ void NPad::OnUpdate(const Core::Timing::CoreTiming& core_timing) {
                 npad->system_ext_lifo.ReadCurrentEntry().state.sampling_number + 1;
             npad->system_ext_lifo.WriteNextEntry(libnx_state);
 
+            if (const auto input_age = controller.device->TakeInputAge()) {
+                hid_core.RecordInputLatency(*input_age);
+            }
+
             press_state |= static_cast<u64>(pad_state.npad_buttons.raw);
         }
     }
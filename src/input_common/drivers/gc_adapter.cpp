@@ -1,6 +1,11 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+
 #include <fmt/ranges.h>
 #include <libusb.h>
 
@@ -92,8 +97,11 @@ GCAdapter::~GCAdapter() {
 void GCAdapter::AdapterInputThread(std::stop_token stop_token) {
     LOG_DEBUG(Input, "Input thread started");
     Common::SetCurrentThreadName("GCAdapter");
+    // Reports arrive every few milliseconds, waking up late shows up directly as input jitter
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::VeryHigh);
     s32 payload_size{};
     AdapterPayload adapter_payload{};
+    auto last_report = std::chrono::steady_clock::now();
 
     adapter_scan_thread = {};
 
@@ -101,6 +109,10 @@ void GCAdapter::AdapterInputThread(std::stop_token stop_token) {
         libusb_interrupt_transfer(usb_adapter_handle->get(), input_endpoint, adapter_payload.data(),
                                   static_cast<s32>(adapter_payload.size()), &payload_size, 16);
         if (IsPayloadCorrect(adapter_payload, payload_size)) {
+            const auto now = std::chrono::steady_clock::now();
+            RecordReportInterval(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - last_report));
+            last_report = now;
             UpdateControllers(adapter_payload);
             UpdateVibrations();
         }
@@ -12,6 +12,7 @@
 #include "common/logging/log.h"
 #include "common/param_package.h"
 #include "common/settings.h"
+#include "common/thread.h"
 #include "input_common/drivers/udp_client.h"
 #include "input_common/helpers/udp_protocol.h"
 
@@ -135,6 +136,8 @@ private:
 };
 
 static void SocketLoop(Socket* socket) {
+    Common::SetCurrentThreadName("UDPClient");
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::VeryHigh);
     socket->StartReceive();
     socket->StartSend(Socket::clock::now());
     socket->Loop();
@@ -250,6 +253,7 @@ void UDPClient::OnPadData(Response::PadData data, std::size_t client) {
         std::chrono::duration_cast<std::chrono::microseconds>(now - pads[pad_index].last_update)
             .count());
     pads[pad_index].last_update = now;
+    RecordReportInterval(std::chrono::microseconds{time_difference});
 
     // Gyroscope values are not it the correct scale from better joy.
     // Dividing by 312 allows us to make one full turn = 1 turn
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -136,6 +139,7 @@ Common::Input::DriverResult JoyconDriver::InitializeDevice() {
 void JoyconDriver::InputThread(std::stop_token stop_token) {
     LOG_INFO(Input, "Joycon Adapter input thread started");
     Common::SetCurrentThreadName("JoyconInput");
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::VeryHigh);
     input_thread_running = true;
 
     // Max update rate is 5ms, ensure we are always able to read a bit faster
@@ -457,6 +457,24 @@ void InputEngine::EndConfiguration() {
     configuring = false;
 }
 
+void InputEngine::RecordReportInterval(std::chrono::microseconds interval) {
+    const auto& limits = ReportIntervalHistogram::bucket_limits_ms;
+    const auto interval_ms = std::chrono::duration_cast<std::chrono::milliseconds>(interval);
+    std::size_t bucket = 0;
+    while (bucket < limits.size() && interval_ms.count() >= limits[bucket]) {
+        ++bucket;
+    }
+    report_intervals[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+ReportIntervalHistogram InputEngine::GetAndResetReportIntervals() {
+    ReportIntervalHistogram histogram{};
+    for (std::size_t bucket = 0; bucket < report_intervals.size(); ++bucket) {
+        histogram.counts[bucket] = report_intervals[bucket].exchange(0, std::memory_order_relaxed);
+    }
+    return histogram;
+}
+
 const std::string& InputEngine::GetEngineName() const {
     return input_engine;
 }
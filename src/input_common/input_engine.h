@@ -1,8 +1,14 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <mutex>
 #include <unordered_map>
@@ -67,6 +73,13 @@ struct hash<PadIdentifier> {
 
 namespace InputCommon {
 
+// Number of intervals between consecutive input reports of a driver, by duration
+struct ReportIntervalHistogram {
+    // Upper bound in milliseconds of each bucket, the last bucket holds the longer intervals
+    static constexpr std::array<u32, 6> bucket_limits_ms{1, 2, 4, 8, 16, 32};
+    std::array<u64, bucket_limits_ms.size() + 1> counts{};
+};
+
 // Data from the engine and device needed for creating a ParamPackage
 struct MappingData {
     std::string engine{};
@@ -247,6 +260,9 @@ public:
     Common::Input::CameraStatus GetCamera(const PadIdentifier& identifier) const;
     Common::Input::NfcStatus GetNfc(const PadIdentifier& identifier) const;
 
+    /// Returns the intervals between input reports recorded since the last call
+    ReportIntervalHistogram GetAndResetReportIntervals();
+
     int SetCallback(InputIdentifier input_identifier);
     void SetMappingCallback(MappingCallback callback);
     void DeleteCallback(int key);
@@ -261,6 +277,9 @@ protected:
     void SetCamera(const PadIdentifier& identifier, const Common::Input::CameraStatus& value);
     void SetNfc(const PadIdentifier& identifier, const Common::Input::NfcStatus& value);
 
+    /// Accounts the time between two input reports, safe to call from any driver thread
+    void RecordReportInterval(std::chrono::microseconds interval);
+
     virtual std::string GetHatButtonName([[maybe_unused]] u8 direction_value) const {
         return "Unknown";
     }
@@ -301,6 +320,7 @@ private:
     std::unordered_map<PadIdentifier, ControllerData> controller_list;
     std::unordered_map<int, InputIdentifier> callback_list;
     MappingCallback mapping_callback;
+    std::array<std::atomic<u64>, ReportIntervalHistogram{}.counts.size()> report_intervals{};
 };
 
 } // namespace InputCommon
@@ -491,6 +491,22 @@ void InputSubsystem::PumpEvents() const {
     impl->PumpEvents();
 }
 
+std::vector<std::pair<std::string, ReportIntervalHistogram>>
+InputSubsystem::GetAndResetReportIntervals() const {
+    std::vector<std::pair<std::string, ReportIntervalHistogram>> report_intervals;
+    const auto add_engine = [&](InputEngine* engine) {
+        if (engine != nullptr) {
+            report_intervals.emplace_back(engine->GetEngineName(),
+                                          engine->GetAndResetReportIntervals());
+        }
+    };
+#ifdef ENABLE_LIBUSB
+    add_engine(impl->gcadapter.get());
+#endif
+    add_engine(impl->udp_client.get());
+    return report_intervals;
+}
+
 std::string GenerateKeyboardParam(int key_code) {
     Common::ParamPackage param;
     param.Set("engine", "keyboard");
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2017 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -6,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Common {
@@ -37,6 +41,7 @@ class TouchScreen;
 class VirtualAmiibo;
 class VirtualGamepad;
 struct MappingData;
+struct ReportIntervalHistogram;
 } // namespace InputCommon
 
 namespace InputCommon::TasInput {
@@ -164,6 +169,11 @@ public:
     /// Signals SDL driver for new input events
     void PumpEvents() const;
 
+    /// Returns the report intervals of the drivers that read input on threads of their own, taken
+    /// since the last call, by engine name
+    [[nodiscard]] std::vector<std::pair<std::string, ReportIntervalHistogram>>
+    GetAndResetReportIntervals() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> impl;
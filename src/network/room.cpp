@@ -63,6 +63,9 @@ public:
     void ServerLoop();
     void StartLoop();
 
+    /// Dispatches a received ENet event to its handler.
+    void HandleEvent(ENetEvent* event);
+
     /**
      * Parses and answers a room join request from a client.
      * Validates the uniqueness of the username and assigns the MAC address
@@ -220,6 +223,14 @@ public:
      */
     void HandleLdnPacket(const ENetEvent* event);
 
+    /**
+     * Queues the received packet to all members except the sender when broadcasting, otherwise
+     * to the member with the destination address. The packet is not copied for each recipient.
+     * @param event The ENet event containing the data
+     */
+    void ForwardPacket(const ENetEvent* event, const IPv4Address& destination_address,
+                       bool broadcast);
+
     /**
      * Extracts a chat entry from a received ENet packet and adds it to the chat queue.
      * @param event The ENet event that was received.
@@ -244,53 +255,69 @@ void Room::RoomImpl::ServerLoop() {
     while (state != State::Closed) {
         ENetEvent event;
         if (enet_host_service(server, &event, 5) > 0) {
-            switch (event.type) {
-            case ENET_EVENT_TYPE_RECEIVE:
-                switch (event.packet->data[0]) {
-                case IdJoinRequest:
-                    HandleJoinRequest(&event);
-                    break;
-                case IdSetGameInfo:
-                    HandleGameInfoPacket(&event);
-                    break;
-                case IdProxyPacket:
-                    HandleProxyPacket(&event);
-                    break;
-                case IdLdnPacket:
-                    HandleLdnPacket(&event);
-                    break;
-                case IdChatMessage:
-                    HandleChatPacket(&event);
-                    break;
-                // Moderation
-                case IdModKick:
-                    HandleModKickPacket(&event);
-                    break;
-                case IdModBan:
-                    HandleModBanPacket(&event);
-                    break;
-                case IdModUnban:
-                    HandleModUnbanPacket(&event);
-                    break;
-                case IdModGetBanList:
-                    HandleModGetBanListPacket(&event);
-                    break;
-                }
-                enet_packet_destroy(event.packet);
-                break;
-            case ENET_EVENT_TYPE_DISCONNECT:
-                HandleClientDisconnection(event.peer);
-                break;
-            case ENET_EVENT_TYPE_NONE:
-            case ENET_EVENT_TYPE_CONNECT:
-                break;
-            }
+            // Handle everything that arrived meanwhile before queued packets go out, so the
+            // packets for a member are sent together instead of one datagram per event.
+            do {
+                HandleEvent(&event);
+            } while (enet_host_check_events(server, &event) > 0);
+            enet_host_flush(server);
         }
     }
     // Close the connection to all members:
     SendCloseMessage();
 }
 
+void Room::RoomImpl::HandleEvent(ENetEvent* event) {
+    switch (event->type) {
+    case ENET_EVENT_TYPE_RECEIVE:
+        if (event->packet->dataLength == 0) {
+            enet_packet_destroy(event->packet);
+            break;
+        }
+        switch (event->packet->data[0]) {
+        case IdJoinRequest:
+            HandleJoinRequest(event);
+            break;
+        case IdSetGameInfo:
+            HandleGameInfoPacket(event);
+            break;
+        case IdProxyPacket:
+            HandleProxyPacket(event);
+            break;
+        case IdLdnPacket:
+            HandleLdnPacket(event);
+            break;
+        case IdChatMessage:
+            HandleChatPacket(event);
+            break;
+        // Moderation
+        case IdModKick:
+            HandleModKickPacket(event);
+            break;
+        case IdModBan:
+            HandleModBanPacket(event);
+            break;
+        case IdModUnban:
+            HandleModUnbanPacket(event);
+            break;
+        case IdModGetBanList:
+            HandleModGetBanListPacket(event);
+            break;
+        }
+        // Forwarded packets are owned by the peers they were queued to until they are sent
+        if (event->packet->referenceCount == 0) {
+            enet_packet_destroy(event->packet);
+        }
+        break;
+    case ENET_EVENT_TYPE_DISCONNECT:
+        HandleClientDisconnection(event->peer);
+        break;
+    case ENET_EVENT_TYPE_NONE:
+    case ENET_EVENT_TYPE_CONNECT:
+        break;
+    }
+}
+
 void Room::RoomImpl::StartLoop() {
     room_thread = std::make_unique<std::thread>(&Room::RoomImpl::ServerLoop, this);
 }
@@ -823,8 +850,17 @@ IPv4Address Room::RoomImpl::GenerateFakeIPAddress() {
 }
 
 void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
+    // Only the header is needed to route the packet, the payload is forwarded as it is
+    constexpr std::size_t HeaderSize = sizeof(u8) +                                  // Message type
+                                       sizeof(u8) + sizeof(IPv4Address) + sizeof(u16) + // Local
+                                       sizeof(u8) + sizeof(IPv4Address) + sizeof(u16) + // Remote
+                                       sizeof(u8) + sizeof(u8); // Protocol, broadcast
+    if (event->packet->dataLength < HeaderSize) {
+        LOG_ERROR(Network, "Received a truncated proxy packet");
+        return;
+    }
     Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    in_packet.Append(event->packet->data, HeaderSize);
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
     in_packet.IgnoreBytes(sizeof(u8));          // Domain
@@ -841,48 +877,20 @@ void Room::RoomImpl::HandleProxyPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
-
-    const auto& destination_address = remote_ip;
-    if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
-        for (const auto& member : members) {
-            if (member.peer != event->peer) {
-                sent_packet = true;
-                enet_peer_send(member.peer, 0, enet_packet);
-            }
-        }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
-    } else { // Send the data only to the destination client
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
-    }
-    enet_host_flush(server);
+    ForwardPacket(event, remote_ip, broadcast);
 }
 
 void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
+    // Only the header is needed to route the packet, the payload is forwarded as it is
+    constexpr std::size_t HeaderSize = sizeof(u8) +                       // Message type
+                                       sizeof(u8) + sizeof(IPv4Address) + // Type, local IP
+                                       sizeof(IPv4Address) + sizeof(u8);  // Remote IP, broadcast
+    if (event->packet->dataLength < HeaderSize) {
+        LOG_ERROR(Network, "Received a truncated LDN packet");
+        return;
+    }
     Packet in_packet;
-    in_packet.Append(event->packet->data, event->packet->dataLength);
+    in_packet.Append(event->packet->data, HeaderSize);
 
     in_packet.IgnoreBytes(sizeof(u8)); // Message type
 
@@ -895,43 +903,37 @@ void Room::RoomImpl::HandleLdnPacket(const ENetEvent* event) {
     bool broadcast;
     in_packet.Read(broadcast); // Broadcast
 
-    Packet out_packet;
-    out_packet.Append(event->packet->data, event->packet->dataLength);
-    ENetPacket* enet_packet = enet_packet_create(out_packet.GetData(), out_packet.GetDataSize(),
-                                                 ENET_PACKET_FLAG_RELIABLE);
+    ForwardPacket(event, remote_ip, broadcast);
+}
 
-    const auto& destination_address = remote_ip;
+void Room::RoomImpl::ForwardPacket(const ENetEvent* event, const IPv4Address& destination_address,
+                                   bool broadcast) {
+    // The received packet is queued as it is, all recipients reference the same buffer
+    ENetPacket* const enet_packet = event->packet;
+
+    std::shared_lock lock(member_mutex);
     if (broadcast) { // Send the data to everyone except the sender
-        std::lock_guard lock(member_mutex);
-        bool sent_packet = false;
         for (const auto& member : members) {
             if (member.peer != event->peer) {
-                sent_packet = true;
                 enet_peer_send(member.peer, 0, enet_packet);
             }
         }
-
-        if (!sent_packet) {
-            enet_packet_destroy(enet_packet);
-        }
+        return;
+    }
+    // Send the data only to the destination client
+    const auto member = std::find_if(members.begin(), members.end(),
+                                     [&destination_address](const Member& member_entry) -> bool {
+                                         return member_entry.fake_ip == destination_address;
+                                     });
+    if (member != members.end()) {
+        enet_peer_send(member->peer, 0, enet_packet);
     } else {
-        std::lock_guard lock(member_mutex);
-        auto member = std::find_if(members.begin(), members.end(),
-                                   [destination_address](const Member& member_entry) -> bool {
-                                       return member_entry.fake_ip == destination_address;
-                                   });
-        if (member != members.end()) {
-            enet_peer_send(member->peer, 0, enet_packet);
-        } else {
-            LOG_ERROR(Network,
-                      "Attempting to send to unknown IP address: "
-                      "{}.{}.{}.{}",
-                      destination_address[0], destination_address[1], destination_address[2],
-                      destination_address[3]);
-            enet_packet_destroy(enet_packet);
-        }
+        LOG_ERROR(Network,
+                  "Attempting to send to unknown IP address: "
+                  "{}.{}.{}.{}",
+                  destination_address[0], destination_address[1], destination_address[2],
+                  destination_address[3]);
     }
-    enet_host_flush(server);
 }
 
 void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
@@ -974,8 +976,6 @@ void Room::RoomImpl::HandleChatPacket(const ENetEvent* event) {
         enet_packet_destroy(enet_packet);
     }
 
-    enet_host_flush(server);
-
     if (sending_member->user_data.username.empty()) {
         LOG_INFO(Network, "{}: {}", sending_member->nickname, message);
     } else {
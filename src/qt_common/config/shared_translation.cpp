@@ -54,6 +54,14 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
     INSERT(Settings, audio_input_device_id, tr("Input Device:"), QString());
     INSERT(Settings, audio_muted, tr("Mute audio"), QString());
     INSERT(Settings, volume, tr("Volume:"), QString());
+    INSERT(Settings, audio_adaptive_latency, tr("Adaptive audio latency"),
+           tr("Shrinks the audio queue while playback is stable and grows it back on "
+              "underruns.\nLowers the audio latency, at the cost of a short dropout whenever "
+              "the queue has to grow."));
+    INSERT(Settings, audio_host_timing_voice_drop, tr("Drop voices the host can't keep up with"),
+           tr("Measures how long the audio commands take on this device and drops the least "
+              "important voices when rendering falls behind.\nAvoids audio stutter in games "
+              "playing many sounds at once, at the cost of some of them going quiet."));
     INSERT(Settings, dump_audio_commands, QString(), QString());
     INSERT(UISettings, mute_when_in_background, tr("Mute audio when in background"), QString());
 
@@ -85,6 +93,36 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
            tr("Synchronizes CPU core speed with the game's maximum rendering speed to boost FPS "
               "without affecting game speed (animations, physics, etc.).\n"
               "Can help reduce stuttering at lower framerates."));
+    INSERT(Settings, core_timing_batching, QString(), QString());
+    INSERT(Settings,
+           core_timing_slack,
+           tr("Batch Timing Events (us)"),
+           tr("Runs timed events that are due within this many microseconds together, waking the "
+              "timer thread less often.\n"
+              "Events may run slightly early as a result."));
+    INSERT(Settings,
+           service_threads,
+           tr("Additional Service Threads"),
+           tr("Host threads added to the filesystem and audio services, so that requests from "
+              "different sessions are handled at the same time.\n"
+              "Requests of one session are still handled in order."));
+    INSERT(Settings,
+           use_huge_pages,
+           tr("Use Huge Pages for Emulated RAM"),
+           tr("Asks the host to back the emulated RAM with 2 MiB pages where it allows it, "
+              "reducing TLB misses in memory heavy games.\n"
+              "On Linux this depends on the transparent huge page settings of the system."));
+    INSERT(Settings,
+           prefault_memory,
+           tr("Pre-fault Emulated RAM"),
+           tr("Allocates all of the emulated RAM when booting instead of on first access.\n"
+              "Boot takes longer and uses the whole memory layout size up front."));
+    INSERT(Settings,
+           use_write_watch,
+           tr("Watch Writes to GPU Memory"),
+           tr("Finds the CPU writes to memory used by the GPU when commands are submitted, "
+              "instead of trapping every write.\n"
+              "Experimental, needs Linux 6.7 or newer and is not used with reactive flushing."));
 
     // Cpu
     INSERT(Settings,
@@ -112,6 +150,19 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
     INSERT(Settings, vtable_bouncing,
         tr("Virtual Table Bouncing"),
         tr("Bounces (by emulating a 0-valued return) any functions that triggers a prefetch abort"));
+    INSERT(Settings,
+           cpu_block_cache,
+           tr("Cache Compiled CPU Blocks"),
+           tr("Remembers which game code was compiled by the CPU JIT and compiles it again when the "
+              "game boots, reducing stutter the first time an area is visited.\n"
+              "Boot takes longer while the blocks are compiled."));
+    INSERT(Settings,
+           core_type_affinity,
+           tr("Pin Threads to Core Types"),
+           tr("On processors with performance and efficiency cores, keeps the emulated CPU and GPU "
+              "threads on the performance cores and moves shader compilation and texture decoding "
+              "to the efficiency cores.\n"
+              "Takes effect when a game is started."));
 
     // Cpu Debug
 
@@ -190,6 +241,12 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
               "compatibility with the on-screen keyboard that some games request for "
               "input.\nExclusive "
               "fullscreen may offer better performance and better Freesync/Gsync support."));
+    INSERT(Settings,
+           native_presentation,
+           tr("Native fullscreen presentation (Vulkan)"),
+           tr("Presents fullscreen from a separate native window that covers the screen, with "
+              "mailbox presentation when VSync is on.\nLets the compositor hand the display to "
+              "the game, reducing input latency, at the cost of slower fullscreen toggles."));
     INSERT(Settings,
            aspect_ratio,
            tr("Aspect Ratio:"),
@@ -238,6 +295,12 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
            vram_usage_mode,
            tr("VRAM Usage Mode:"),
            tr("Selects whether the emulator should prefer to conserve memory or make maximum usage of available video memory for performance.\nAggressive mode may impact performance of other applications such as recording software."));
+    INSERT(Settings,
+           auto_performance_profile,
+           tr("Learn per-game performance profiles"),
+           tr("Records frame times, shader stutter and memory usage of each game and adjusts its "
+              "resolution, accuracy, asynchronous shaders and ASTC recompression on the next "
+              "launch.\nSettings changed in the per-game configuration are never overridden."));
     INSERT(Settings,
            skip_cpu_inner_invalidation,
            tr("Skip CPU Inner Invalidation"),
@@ -263,12 +326,57 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
            async_presentation,
            tr("Enable asynchronous presentation (Vulkan only)"),
            tr("Slightly improves performance by moving presentation to a separate CPU thread."));
+    INSERT(Settings,
+           present_wait,
+           tr("Wait for frames to be displayed (Vulkan only)"),
+           tr("Holds each new frame until the previous one has reached the display when using "
+              "FIFO, keeping the presentation queue short to reduce input latency.\n"
+              "Only used on drivers supporting VK_KHR_present_wait."));
+    INSERT(Settings,
+           frame_generation,
+           tr("Generate intermediate frames (Vulkan only)"),
+           tr("Interpolates a frame between each pair of game frames on the GPU when the game "
+              "runs below the display refresh rate, making motion look smoother.\n"
+              "Only works with asynchronous presentation and adds up to one frame of latency."));
+    INSERT(Settings,
+           async_compute_queue,
+           tr("Enable asynchronous compute queue (Vulkan only)"),
+           tr("Decodes ASTC textures on a separate GPU queue when the device has one, so the "
+              "decoding runs alongside rendering instead of stalling it."));
+    INSERT(Settings,
+           batched_query_readback,
+           tr("Batch query readbacks"),
+           tr("Copies the results of all pending occlusion queries to host memory at once, "
+              "instead of reading back each query pool separately."));
+    INSERT(Settings,
+           query_result_tolerance,
+           tr("Query result tolerance (frames)"),
+           tr("Allows games polling occlusion queries to read results up to this many frames "
+              "old instead of waiting for the GPU.\n"
+              "Values above 0 may cause flickering in some games."));
+    INSERT(Settings, async_transfer_queue, QString(), QString());
+    INSERT(Settings,
+           transfer_queue_threshold_kb,
+           tr("Transfer queue upload threshold (KiB)"),
+           tr("Textures at least this large are uploaded on the dedicated transfer queue of the "
+              "GPU, when it has one, instead of the graphics queue."));
+    INSERT(Settings,
+           sparse_texture_residency,
+           tr("Sparse texture residency (Vulkan only)"),
+           tr("Backs large texture arrays with memory only for the layers and mipmaps that are "
+              "uploaded or rendered to, which reduces VRAM usage in some games.\n"
+              "Requires sparse image support from the GPU driver."));
     INSERT(
         Settings,
         renderer_force_max_clock,
         tr("Force maximum clocks (Vulkan only)"),
         tr("Runs work in the background while waiting for graphics commands to keep the GPU from "
            "lowering its clock speed."));
+    INSERT(Settings,
+           vulkan_recording_threads,
+           tr("Command recording threads (Vulkan only)"),
+           tr("Number of threads recording Vulkan command buffers.\nConsecutive submissions are "
+              "recorded in parallel, which helps draw heavy games on CPUs with many cores."));
     INSERT(Settings,
            max_anisotropy,
            tr("Anisotropic Filtering:"),
@@ -340,6 +448,40 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
            tr("Improves lighting and vertex handling in some games.\n"
               "Only Vulkan 1.0+ devices support this extension."));
 
+    INSERT(Settings,
+           graphics_pipeline_library,
+           tr("Graphics Pipeline Library"),
+           tr("Links pipelines from separately compiled shader stages to reduce shader compilation "
+              "stutter, then replaces them with optimized pipelines in the background.\n"
+              "Only used on drivers with fast linking."));
+
+    INSERT(Settings,
+           descriptor_buffer,
+           tr("Descriptor Buffer"),
+           tr("Writes shader descriptors directly into GPU memory instead of allocating and "
+              "updating descriptor sets for every draw, reducing CPU overhead."));
+
+    INSERT(Settings,
+           dynamic_rendering,
+           tr("Dynamic Rendering"),
+           tr("Begins render passes directly on the render targets instead of creating a "
+              "framebuffer object for every combination of them.\n"
+              "Vulkan 1.3+ devices support this extension."));
+
+    INSERT(Settings,
+           foveated_shading,
+           tr("Foveated Shading"),
+           tr("Shades the edges of upscaled render targets at a coarser rate than their center, "
+              "reducing the cost of high resolution scales.\n"
+              "Requires Dynamic Rendering and a device supporting VK_KHR_fragment_shading_rate."));
+
+    INSERT(Settings,
+           host_image_copy,
+           tr("Host Image Copy"),
+           tr("Writes newly uploaded textures from the CPU directly into GPU images instead of "
+              "copying them through a staging buffer.\n"
+              "Only used on integrated GPUs sharing memory with the CPU."));
+
     INSERT(Settings,
            descriptor_indexing,
            tr("Descriptor Indexing"),
@@ -390,8 +532,18 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QObject* parent)
     INSERT(Settings, current_user, QString(), QString());
 
     // Controls
+    INSERT(Settings,
+           event_driven_input,
+           tr("Event driven input"),
+           tr("Writes controller input to the guest as soon as it changes instead of waiting for "
+              "the next poll, and polls at the hardware rate otherwise."));
 
     // Data Storage
+    INSERT(Settings,
+           nca_block_cache_size,
+           tr("NCA Block Cache Size (MiB)"),
+           tr("Memory kept for decrypted blocks of game content, so reading them again skips "
+              "the decryption.\nSet to 0 to disable the cache."));
 
     // Debugging
 
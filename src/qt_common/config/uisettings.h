@@ -153,6 +153,7 @@ struct Values {
     Setting<bool> enable_screenshot_save_as{linkage, true, "enable_screenshot_save_as",
                                             Category::Screenshots};
     Setting<u32> screenshot_height{linkage, 0, "screenshot_height", Category::Screenshots};
+    Setting<bool> screenshot_qoi{linkage, false, "screenshot_qoi", Category::Screenshots};
 
     std::string roms_path;
     std::string game_dir_deprecated;
@@ -259,12 +259,15 @@ void EmitFPAbs64(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPAdd16(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPAdd32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPAdd64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
+void EmitFPAdd16x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPFma16(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
                  std::string_view c);
 void EmitFPFma32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
                  std::string_view c);
 void EmitFPFma64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
                  std::string_view c);
+void EmitFPFma16x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b,
+                   std::string_view c);
 void EmitFPMax32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMax64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMin32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
@@ -272,6 +275,7 @@ void EmitFPMin64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::stri
 void EmitFPMul16(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMul32(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPMul64(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
+void EmitFPMul16x2(EmitContext& ctx, IR::Inst& inst, std::string_view a, std::string_view b);
 void EmitFPNeg16(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPNeg32(EmitContext& ctx, IR::Inst& inst, std::string_view value);
 void EmitFPNeg64(EmitContext& ctx, IR::Inst& inst, std::string_view value);
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -18,7 +21,9 @@ void ConvertDepthMode(EmitContext& ctx) {
 }
 
 void SetFixedPipelinePointSize(EmitContext& ctx) {
-    if (ctx.runtime_info.fixed_state_point_size) {
+    if (Sirit::ValidId(ctx.fixed_state_point_size)) {
+        ctx.OpStore(ctx.output_point_size, ctx.fixed_state_point_size);
+    } else if (ctx.runtime_info.fixed_state_point_size) {
         const float point_size{*ctx.runtime_info.fixed_state_point_size};
         ctx.OpStore(ctx.output_point_size, ctx.Const(point_size));
     }
@@ -79,7 +84,9 @@ void AlphaTest(EmitContext& ctx) {
 
     const Id true_label{ctx.OpLabel()};
     const Id discard_label{ctx.OpLabel()};
-    const Id alpha_reference{ctx.Const(ctx.runtime_info.alpha_test_reference)};
+    const Id alpha_reference{Sirit::ValidId(ctx.alpha_test_reference)
+                                 ? ctx.alpha_test_reference
+                                 : ctx.Const(ctx.runtime_info.alpha_test_reference)};
     const Id condition{ComparisonFunction(ctx, comparison, alpha, alpha_reference)};
 
     ctx.OpSelectionMerge(true_label, spv::SelectionControlMask::MaskNone);
@@ -576,6 +576,24 @@ void EmitContext::DefineCommonConstants() {
     false_value = ConstantFalse(U1);
     u32_zero_value = Const(0U);
     f32_zero_value = Const(0.0f);
+
+    if (!runtime_info.specialize_fixed_state) {
+        return;
+    }
+    // The defaults are placeholders, pipelines always specialize these
+    const auto define_spec_constant = [this](SpecializationConstant id, std::string_view name) {
+        const Id constant{Name(SpecConstant(F32[1], 0.0f), name)};
+        Decorate(constant, spv::Decoration::SpecId, static_cast<u32>(id));
+        return constant;
+    };
+    if (stage == Stage::Fragment && runtime_info.alpha_test_func) {
+        alpha_test_reference =
+            define_spec_constant(SpecializationConstant::AlphaTestReference, "alpha_test_ref");
+    }
+    if (runtime_info.fixed_state_point_size) {
+        fixed_state_point_size =
+            define_spec_constant(SpecializationConstant::FixedStatePointSize, "point_size");
+    }
 }
 
 void EmitContext::DefineInterfaces(const IR::Program& program) {
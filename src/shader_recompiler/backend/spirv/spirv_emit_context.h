@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -226,6 +229,9 @@ public:
     Id u32_zero_value{};
     Id f32_zero_value{};
 
+    Id alpha_test_reference{};
+    Id fixed_state_point_size{};
+
     UniformDefinitions uniform_types;
     StorageTypeDefinitions storage_types;
 
@@ -804,6 +804,27 @@ F16F32F64 IREmitter::FPFma(const F16F32F64& a, const F16F32F64& b, const F16F32F
     }
 }
 
+Value IREmitter::FPAdd16x2(const Value& a, const Value& b, FpControl control) {
+    if (a.Type() != Type::F16x2 || b.Type() != Type::F16x2) {
+        throw InvalidArgument("Invalid types {} and {}", a.Type(), b.Type());
+    }
+    return Inst(Opcode::FPAdd16x2, Flags{control}, a, b);
+}
+
+Value IREmitter::FPMul16x2(const Value& a, const Value& b, FpControl control) {
+    if (a.Type() != Type::F16x2 || b.Type() != Type::F16x2) {
+        throw InvalidArgument("Invalid types {} and {}", a.Type(), b.Type());
+    }
+    return Inst(Opcode::FPMul16x2, Flags{control}, a, b);
+}
+
+Value IREmitter::FPFma16x2(const Value& a, const Value& b, const Value& c, FpControl control) {
+    if (a.Type() != Type::F16x2 || b.Type() != Type::F16x2 || c.Type() != Type::F16x2) {
+        throw InvalidArgument("Invalid types {}, {}, and {}", a.Type(), b.Type(), c.Type());
+    }
+    return Inst(Opcode::FPFma16x2, Flags{control}, a, b, c);
+}
+
 F16F32F64 IREmitter::FPAbs(const F16F32F64& value) {
     switch (value.Type()) {
     case Type::F16:
@@ -179,6 +179,12 @@ public:
     [[nodiscard]] F16F32F64 FPFma(const F16F32F64& a, const F16F32F64& b, const F16F32F64& c,
                                   FpControl control = {});
 
+    /// Operations on both halves of a F16x2 vector at once
+    [[nodiscard]] Value FPAdd16x2(const Value& a, const Value& b, FpControl control = {});
+    [[nodiscard]] Value FPMul16x2(const Value& a, const Value& b, FpControl control = {});
+    [[nodiscard]] Value FPFma16x2(const Value& a, const Value& b, const Value& c,
+                                  FpControl control = {});
+
     [[nodiscard]] F16F32F64 FPAbs(const F16F32F64& value);
     [[nodiscard]] F16F32F64 FPNeg(const F16F32F64& value);
     [[nodiscard]] F16F32F64 FPAbsNeg(const F16F32F64& value, bool abs, bool neg);
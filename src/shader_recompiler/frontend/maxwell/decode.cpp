@@ -3,12 +3,8 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <algorithm>
 #include <array>
-#include <bit>
-#include <memory>
-#include <ranges>
-#include <string_view>
+#include <limits>
 
 #include "common/assert.h"
 #include "common/common_types.h"
@@ -17,8 +13,15 @@
 #include "shader_recompiler/frontend/maxwell/opcodes.h"
 
 namespace Shader::Maxwell {
+namespace {
 
-consteval std::pair<u64, u64> MaskValueFromEncoding(const char data[20]) noexcept {
+struct Encoding {
+    u64 mask;
+    u64 value;
+    Opcode opcode;
+};
+
+consteval Encoding MakeEncoding(const char data[20], Opcode opcode) noexcept {
     u64 mask = 0, value = 0, bit = u64(1) << 63;
     for (int i = 0; i < 20; ++i)
         switch (data[i]) {
@@ -37,15 +40,67 @@ consteval std::pair<u64, u64> MaskValueFromEncoding(const char data[20]) noexcep
         default:
             break;
         }
-    return { mask, value };
+    return {mask, value, opcode};
 }
 
-Opcode Decode(u64 insn) {
-#define INST(name, cute, encode) \
-    if (auto const p = MaskValueFromEncoding(encode); (insn & p.first) == p.second) \
-        return Opcode::name;
+constexpr std::array ENCODINGS{
+#define INST(name, cute, encode) MakeEncoding(encode, Opcode::name),
 #include "maxwell.inc"
 #undef INST
+};
+
+// The table is indexed by the top bits of an instruction. Each entry lists the encodings that
+// can match those bits, in the order of maxwell.inc, so the first match wins like before.
+constexpr size_t TABLE_BITS = 12;
+constexpr size_t TABLE_SHIFT = 64 - TABLE_BITS;
+constexpr size_t MAX_CANDIDATES = 4;
+constexpr u16 NO_CANDIDATE = (std::numeric_limits<u16>::max)();
+
+using Candidates = std::array<u16, MAX_CANDIDATES>;
+
+consteval std::array<Candidates, size_t{1} << TABLE_BITS> MakeDecodeTable() {
+    std::array<Candidates, size_t{1} << TABLE_BITS> table{};
+    for (Candidates& candidates : table) {
+        candidates.fill(NO_CANDIDATE);
+    }
+    constexpr u64 bucket_mask = (u64{1} << TABLE_BITS) - 1;
+    for (size_t index = 0; index < ENCODINGS.size(); ++index) {
+        const u64 fixed_bits = ENCODINGS[index].mask >> TABLE_SHIFT;
+        const u64 fixed_value = ENCODINGS[index].value >> TABLE_SHIFT;
+        const u64 free_bits = ~fixed_bits & bucket_mask;
+        // Walk every combination of the bits the encoding does not care about
+        u64 combination = 0;
+        do {
+            Candidates& candidates = table[fixed_value | combination];
+            size_t slot = 0;
+            while (slot < MAX_CANDIDATES && candidates[slot] != NO_CANDIDATE) {
+                ++slot;
+            }
+            if (slot == MAX_CANDIDATES) {
+                // Not a constant expression, so this fails the build
+                throw LogicError("Too many encodings share the top bits");
+            }
+            candidates[slot] = static_cast<u16>(index);
+            combination = (combination - free_bits) & free_bits;
+        } while (combination != 0);
+    }
+    return table;
+}
+
+constexpr auto DECODE_TABLE = MakeDecodeTable();
+
+} // Anonymous namespace
+
+Opcode Decode(u64 insn) {
+    for (const u16 index : DECODE_TABLE[insn >> TABLE_SHIFT]) {
+        if (index == NO_CANDIDATE) {
+            break;
+        }
+        const Encoding& encoding = ENCODINGS[index];
+        if ((insn & encoding.mask) == encoding.value) {
+            return encoding.opcode;
+        }
+    }
     ASSERT_MSG(false, "Invalid insn 0x{:016x}", insn);
     return Opcode::NOP;
 }
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -13,6 +16,19 @@ void HADD2(TranslatorVisitor& v, u64 insn, Merge merge, bool ftz, bool sat, bool
         BitField<8, 8, IR::Reg> src_a;
     } const hadd2{insn};
 
+    const IR::FpControl fp_control{
+        .no_contraction = true,
+        .rounding = IR::FpRounding::DontCare,
+        .fmz_mode = (ftz ? IR::FmzMode::FTZ : IR::FmzMode::None),
+    };
+    if (!sat && merge == Merge::H1_H0 && swizzle_a != Swizzle::F32 && swizzle_b != Swizzle::F32) {
+        // Add both halves at once when neither of them is promoted
+        const IR::Value a{ExtractPacked(v.ir, v.X(hadd2.src_a), swizzle_a, abs_a, neg_a)};
+        const IR::Value b{ExtractPacked(v.ir, src_b, swizzle_b, abs_b, neg_b)};
+        v.X(hadd2.dest_reg, v.ir.PackFloat2x16(v.ir.FPAdd16x2(a, b, fp_control)));
+        return;
+    }
+
     auto [lhs_a, rhs_a]{Extract(v.ir, v.X(hadd2.src_a), swizzle_a)};
     auto [lhs_b, rhs_b]{Extract(v.ir, src_b, swizzle_b)};
     const bool promotion{lhs_a.Type() != lhs_b.Type()};
@@ -32,11 +48,6 @@ void HADD2(TranslatorVisitor& v, u64 insn, Merge merge, bool ftz, bool sat, bool
     lhs_b = v.ir.FPAbsNeg(lhs_b, abs_b, neg_b);
     rhs_b = v.ir.FPAbsNeg(rhs_b, abs_b, neg_b);
 
-    const IR::FpControl fp_control{
-        .no_contraction = true,
-        .rounding = IR::FpRounding::DontCare,
-        .fmz_mode = (ftz ? IR::FmzMode::FTZ : IR::FmzMode::None),
-    };
     IR::F16F32F64 lhs{v.ir.FPAdd(lhs_a, lhs_b, fp_control)};
     IR::F16F32F64 rhs{v.ir.FPAdd(rhs_a, rhs_b, fp_control)};
     if (sat) {
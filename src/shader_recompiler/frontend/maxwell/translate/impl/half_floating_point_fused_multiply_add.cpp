@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -14,6 +17,21 @@ void HFMA2(TranslatorVisitor& v, u64 insn, Merge merge, Swizzle swizzle_a, bool
         BitField<8, 8, IR::Reg> src_a;
     } const hfma2{insn};
 
+    const IR::FpControl fp_control{
+        .no_contraction = true,
+        .rounding = IR::FpRounding::DontCare,
+        .fmz_mode = HalfPrecision2FmzMode(precision),
+    };
+    if (!sat && precision != HalfPrecision::FMZ && merge == Merge::H1_H0 &&
+        swizzle_a != Swizzle::F32 && swizzle_b != Swizzle::F32 && swizzle_c != Swizzle::F32) {
+        // Compute both halves at once when none of them is promoted
+        const IR::Value a{ExtractPacked(v.ir, v.X(hfma2.src_a), swizzle_a, false, false)};
+        const IR::Value b{ExtractPacked(v.ir, src_b, swizzle_b, false, neg_b)};
+        const IR::Value c{ExtractPacked(v.ir, src_c, swizzle_c, false, neg_c)};
+        v.X(hfma2.dest_reg, v.ir.PackFloat2x16(v.ir.FPFma16x2(a, b, c, fp_control)));
+        return;
+    }
+
     auto [lhs_a, rhs_a]{Extract(v.ir, v.X(hfma2.src_a), swizzle_a)};
     auto [lhs_b, rhs_b]{Extract(v.ir, src_b, swizzle_b)};
     auto [lhs_c, rhs_c]{Extract(v.ir, src_c, swizzle_c)};
@@ -39,11 +57,6 @@ void HFMA2(TranslatorVisitor& v, u64 insn, Merge merge, Swizzle swizzle_a, bool
     lhs_c = v.ir.FPAbsNeg(lhs_c, false, neg_c);
     rhs_c = v.ir.FPAbsNeg(rhs_c, false, neg_c);
 
-    const IR::FpControl fp_control{
-        .no_contraction = true,
-        .rounding = IR::FpRounding::DontCare,
-        .fmz_mode = HalfPrecision2FmzMode(precision),
-    };
     IR::F16F32F64 lhs{v.ir.FPFma(lhs_a, lhs_b, lhs_c, fp_control)};
     IR::F16F32F64 rhs{v.ir.FPFma(rhs_a, rhs_b, rhs_c, fp_control)};
     if (precision == HalfPrecision::FMZ && !sat) {
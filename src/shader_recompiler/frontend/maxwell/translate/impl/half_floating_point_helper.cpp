@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -40,6 +43,28 @@ std::pair<IR::F16F32F64, IR::F16F32F64> Extract(IR::IREmitter& ir, IR::U32 value
     throw InvalidArgument("Invalid swizzle {}", swizzle);
 }
 
+IR::Value ExtractPacked(IR::IREmitter& ir, IR::U32 value, Swizzle swizzle, bool abs, bool neg) {
+    switch (swizzle) {
+    case Swizzle::H1_H0:
+        // Absolute and negated values only differ in the sign bits of both halves
+        if (abs) {
+            value = ir.BitwiseAnd(value, ir.Imm32(0x7fff7fffU));
+        }
+        if (neg) {
+            value = ir.BitwiseXor(value, ir.Imm32(0x80008000U));
+        }
+        return ir.UnpackFloat2x16(value);
+    case Swizzle::H0_H0:
+    case Swizzle::H1_H1: {
+        const IR::F16 scalar{ir.FPAbsNeg(Extract(ir, value, swizzle).first, abs, neg)};
+        return ir.CompositeConstruct(scalar, scalar);
+    }
+    case Swizzle::F32:
+        break;
+    }
+    throw InvalidArgument("Invalid swizzle {}", swizzle);
+}
+
 IR::U32 MergeResult(IR::IREmitter& ir, IR::Reg dest, const IR::F16& lhs, const IR::F16& rhs,
                     Merge merge) {
     switch (merge) {
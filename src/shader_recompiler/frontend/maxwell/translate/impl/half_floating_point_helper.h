@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -33,6 +36,9 @@ IR::FmzMode HalfPrecision2FmzMode(HalfPrecision precision);
 
 std::pair<IR::F16F32F64, IR::F16F32F64> Extract(IR::IREmitter& ir, IR::U32 value, Swizzle swizzle);
 
+/// Returns both halves of an operand as a F16x2 vector, the swizzle can not be F32
+IR::Value ExtractPacked(IR::IREmitter& ir, IR::U32 value, Swizzle swizzle, bool abs, bool neg);
+
 IR::U32 MergeResult(IR::IREmitter& ir, IR::Reg dest, const IR::F16& lhs, const IR::F16& rhs,
                     Merge merge);
 
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -14,6 +17,20 @@ void HMUL2(TranslatorVisitor& v, u64 insn, Merge merge, bool sat, bool abs_a, bo
         BitField<8, 8, IR::Reg> src_a;
     } const hmul2{insn};
 
+    const IR::FpControl fp_control{
+        .no_contraction = true,
+        .rounding = IR::FpRounding::DontCare,
+        .fmz_mode = HalfPrecision2FmzMode(precision),
+    };
+    if (!sat && precision != HalfPrecision::FMZ && merge == Merge::H1_H0 &&
+        swizzle_a != Swizzle::F32 && swizzle_b != Swizzle::F32) {
+        // Multiply both halves at once when neither of them is promoted
+        const IR::Value a{ExtractPacked(v.ir, v.X(hmul2.src_a), swizzle_a, abs_a, neg_a)};
+        const IR::Value b{ExtractPacked(v.ir, src_b, swizzle_b, abs_b, neg_b)};
+        v.X(hmul2.dest_reg, v.ir.PackFloat2x16(v.ir.FPMul16x2(a, b, fp_control)));
+        return;
+    }
+
     auto [lhs_a, rhs_a]{Extract(v.ir, v.X(hmul2.src_a), swizzle_a)};
     auto [lhs_b, rhs_b]{Extract(v.ir, src_b, swizzle_b)};
     const bool promotion{lhs_a.Type() != lhs_b.Type()};
@@ -33,11 +50,6 @@ void HMUL2(TranslatorVisitor& v, u64 insn, Merge merge, bool sat, bool abs_a, bo
     lhs_b = v.ir.FPAbsNeg(lhs_b, abs_b, neg_b);
     rhs_b = v.ir.FPAbsNeg(rhs_b, abs_b, neg_b);
 
-    const IR::FpControl fp_control{
-        .no_contraction = true,
-        .rounding = IR::FpRounding::DontCare,
-        .fmz_mode = HalfPrecision2FmzMode(precision),
-    };
     IR::F16F32F64 lhs{v.ir.FPMul(lhs_a, lhs_b, fp_control)};
     IR::F16F32F64 rhs{v.ir.FPMul(rhs_a, rhs_b, fp_control)};
     if (precision == HalfPrecision::FMZ && !sat) {
@@ -307,6 +307,9 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
     if (Settings::values.resolution_info.active) {
         Optimization::RescalingPass(program);
     }
+    if (!Settings::values.disable_shader_value_numbering) {
+        Optimization::GlobalValueNumberingPass(program);
+    }
     Optimization::DeadCodeEliminationPass(program);
     if (Settings::values.renderer_debug) {
         Optimization::VerificationPass(program);
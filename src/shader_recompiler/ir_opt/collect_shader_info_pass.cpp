@@ -152,10 +152,13 @@ void VisitUsages(Info& info, IR::Inst& inst) {
     case IR::Opcode::ConvertF32F16:
     case IR::Opcode::FPAbs16:
     case IR::Opcode::FPAdd16:
+    case IR::Opcode::FPAdd16x2:
     case IR::Opcode::FPCeil16:
     case IR::Opcode::FPFloor16:
     case IR::Opcode::FPFma16:
+    case IR::Opcode::FPFma16x2:
     case IR::Opcode::FPMul16:
+    case IR::Opcode::FPMul16x2:
     case IR::Opcode::FPNeg16:
     case IR::Opcode::FPRoundEven16:
     case IR::Opcode::FPSaturate16:
@@ -772,8 +775,11 @@ void VisitUsages(Info& info, IR::Inst& inst) {
 void VisitFpModifiers(Info& info, IR::Inst& inst) {
     switch (inst.GetOpcode()) {
     case IR::Opcode::FPAdd16:
+    case IR::Opcode::FPAdd16x2:
     case IR::Opcode::FPFma16:
+    case IR::Opcode::FPFma16x2:
     case IR::Opcode::FPMul16:
+    case IR::Opcode::FPMul16x2:
     case IR::Opcode::FPRoundEven16:
     case IR::Opcode::FPFloor16:
     case IR::Opcode::FPCeil16:
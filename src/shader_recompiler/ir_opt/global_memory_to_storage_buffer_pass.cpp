@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -51,6 +54,9 @@ struct StorageInfo {
     StorageBufferSet set;
     StorageInstVector to_replace;
     StorageWritesSet writes;
+    /// Global memory instructions that could not be tracked to a storage buffer
+    u32 num_fallbacks{};
+    u32 num_global_memory{};
 };
 
 /// Returns true when the instruction is a global memory instruction
@@ -376,25 +382,32 @@ void CollectStorageBuffers(IR::Block& block, IR::Inst& inst, StorageInfo& info)
         .offset_end = 0x700,
         .alignment = 16,
     };
+    ++info.num_global_memory;
     // Track the low address of the instruction
     const std::optional<LowAddrInfo> low_addr_info{TrackLowAddress(&inst)};
-    if (!low_addr_info) {
-        // Failed to track the low address, use NVN fallbacks
-        return;
-    }
-    // First try to find storage buffers in the NVN address
-    const IR::U32 low_addr{low_addr_info->value};
-    std::optional<StorageBufferAddr> storage_buffer{Track(low_addr, &nvn_bias)};
-    if (!storage_buffer) {
-        // If it fails, track without a bias
-        storage_buffer = Track(low_addr, nullptr);
+    std::optional<StorageBufferAddr> storage_buffer;
+    if (low_addr_info) {
+        // First try to find storage buffers in the NVN address
+        const IR::U32 low_addr{low_addr_info->value};
+        storage_buffer = Track(low_addr, &nvn_bias);
         if (!storage_buffer) {
-            // If that also fails, use NVN fallbacks
-            LOG_WARNING(Shader, "Storage buffer failed to track, using global memory fallbacks");
-            return;
+            // If it fails, track without a bias
+            storage_buffer = Track(low_addr, nullptr);
+            if (storage_buffer) {
+                LOG_WARNING(Shader, "Storage buffer tracked without bias, index {} offset {}",
+                            storage_buffer->index, storage_buffer->offset);
+            }
         }
-        LOG_WARNING(Shader, "Storage buffer tracked without bias, index {} offset {}",
-                    storage_buffer->index, storage_buffer->offset);
+    } else {
+        // The address is not built from two 32-bit halves plus an immediate, e.g. it has a
+        // dynamic 64-bit offset, it is selected through a phi or it was read as a 64-bit value.
+        // Track the whole address, only in the NVN range since its offset is tracked through too.
+        storage_buffer = Track(inst.Arg(0), &nvn_bias);
+    }
+    if (!storage_buffer) {
+        // Use NVN fallbacks
+        ++info.num_fallbacks;
+        return;
     }
     // Collect storage buffer and the instruction
     if (IsGlobalMemoryWrite(inst)) {
@@ -530,6 +543,12 @@ void GlobalMemoryToStorageBufferPass(IR::Program& program, const HostTranslateIn
             CollectStorageBuffers(*block, inst, info);
         }
     }
+    if (info.num_fallbacks != 0) {
+        LOG_WARNING(Shader,
+                    "{} of {} global memory instructions failed to track a storage buffer, "
+                    "using global memory fallbacks",
+                    info.num_fallbacks, info.num_global_memory);
+    }
     for (const StorageBufferAddr& storage_buffer : info.set) {
         program.info.storage_buffers_descriptors.push_back({
             .cbuf_index = storage_buffer.index,
@@ -0,0 +1,474 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <bit>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/functional/hash.hpp>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+
+namespace Shader::Optimization {
+namespace {
+constexpr size_t NO_DOMINATOR = std::numeric_limits<size_t>::max();
+constexpr size_t MAX_ARGS = 5;
+
+struct ValueKey {
+    IR::Opcode opcode{};
+    u32 flags{};
+    std::array<IR::Value, MAX_ARGS> args{};
+
+    bool operator==(const ValueKey&) const = default;
+};
+
+size_t HashValue(const IR::Value& value) {
+    size_t hash{static_cast<size_t>(value.Type())};
+    switch (value.Type()) {
+    case IR::Type::Opaque:
+        boost::hash_combine(hash, value.Inst());
+        break;
+    case IR::Type::U1:
+        boost::hash_combine(hash, value.U1());
+        break;
+    case IR::Type::U8:
+        boost::hash_combine(hash, value.U8());
+        break;
+    case IR::Type::U16:
+        boost::hash_combine(hash, value.U16());
+        break;
+    case IR::Type::U32:
+        boost::hash_combine(hash, value.U32());
+        break;
+    case IR::Type::F32:
+        boost::hash_combine(hash, std::bit_cast<u32>(value.F32()));
+        break;
+    case IR::Type::U64:
+        boost::hash_combine(hash, value.U64());
+        break;
+    case IR::Type::F64:
+        boost::hash_combine(hash, std::bit_cast<u64>(value.F64()));
+        break;
+    default:
+        // Equal keys only have to hash equally, the type is enough for the rest
+        break;
+    }
+    return hash;
+}
+
+struct ValueKeyHash {
+    size_t operator()(const ValueKey& key) const noexcept {
+        size_t hash{static_cast<size_t>(key.opcode)};
+        boost::hash_combine(hash, key.flags);
+        for (const IR::Value& arg : key.args) {
+            boost::hash_combine(hash, HashValue(arg));
+        }
+        return hash;
+    }
+};
+
+/// Instructions whose result only depends on their arguments and flags.
+/// Memory loads, attributes, textures, derivatives and subgroup operations are left out, their
+/// result depends on stores or on the invocations active where they are executed.
+bool IsPure(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::GetCbufU8:
+    case IR::Opcode::GetCbufS8:
+    case IR::Opcode::GetCbufU16:
+    case IR::Opcode::GetCbufS16:
+    case IR::Opcode::GetCbufU32:
+    case IR::Opcode::GetCbufF32:
+    case IR::Opcode::GetCbufU32x2:
+    case IR::Opcode::WorkgroupId:
+    case IR::Opcode::LocalInvocationId:
+    case IR::Opcode::InvocationId:
+    case IR::Opcode::InvocationInfo:
+    case IR::Opcode::SampleId:
+    case IR::Opcode::YDirection:
+    case IR::Opcode::ResolutionDownFactor:
+    case IR::Opcode::RenderArea:
+    case IR::Opcode::IsTextureScaled:
+    case IR::Opcode::IsImageScaled:
+    case IR::Opcode::LaneId:
+    case IR::Opcode::SubgroupEqMask:
+    case IR::Opcode::SubgroupLtMask:
+    case IR::Opcode::SubgroupLeMask:
+    case IR::Opcode::SubgroupGtMask:
+    case IR::Opcode::SubgroupGeMask:
+    case IR::Opcode::CompositeConstructU32x2:
+    case IR::Opcode::CompositeConstructU32x3:
+    case IR::Opcode::CompositeConstructU32x4:
+    case IR::Opcode::CompositeExtractU32x2:
+    case IR::Opcode::CompositeExtractU32x3:
+    case IR::Opcode::CompositeExtractU32x4:
+    case IR::Opcode::CompositeInsertU32x2:
+    case IR::Opcode::CompositeInsertU32x3:
+    case IR::Opcode::CompositeInsertU32x4:
+    case IR::Opcode::CompositeConstructF16x2:
+    case IR::Opcode::CompositeConstructF16x3:
+    case IR::Opcode::CompositeConstructF16x4:
+    case IR::Opcode::CompositeExtractF16x2:
+    case IR::Opcode::CompositeExtractF16x3:
+    case IR::Opcode::CompositeExtractF16x4:
+    case IR::Opcode::CompositeInsertF16x2:
+    case IR::Opcode::CompositeInsertF16x3:
+    case IR::Opcode::CompositeInsertF16x4:
+    case IR::Opcode::CompositeConstructF32x2:
+    case IR::Opcode::CompositeConstructF32x3:
+    case IR::Opcode::CompositeConstructF32x4:
+    case IR::Opcode::CompositeExtractF32x2:
+    case IR::Opcode::CompositeExtractF32x3:
+    case IR::Opcode::CompositeExtractF32x4:
+    case IR::Opcode::CompositeInsertF32x2:
+    case IR::Opcode::CompositeInsertF32x3:
+    case IR::Opcode::CompositeInsertF32x4:
+    case IR::Opcode::CompositeConstructF64x2:
+    case IR::Opcode::CompositeConstructF64x3:
+    case IR::Opcode::CompositeConstructF64x4:
+    case IR::Opcode::CompositeExtractF64x2:
+    case IR::Opcode::CompositeExtractF64x3:
+    case IR::Opcode::CompositeExtractF64x4:
+    case IR::Opcode::CompositeInsertF64x2:
+    case IR::Opcode::CompositeInsertF64x3:
+    case IR::Opcode::CompositeInsertF64x4:
+    case IR::Opcode::SelectU1:
+    case IR::Opcode::SelectU8:
+    case IR::Opcode::SelectU16:
+    case IR::Opcode::SelectU32:
+    case IR::Opcode::SelectU64:
+    case IR::Opcode::SelectF16:
+    case IR::Opcode::SelectF32:
+    case IR::Opcode::SelectF64:
+    case IR::Opcode::BitCastU16F16:
+    case IR::Opcode::BitCastU32F32:
+    case IR::Opcode::BitCastU64F64:
+    case IR::Opcode::BitCastF16U16:
+    case IR::Opcode::BitCastF32U32:
+    case IR::Opcode::BitCastF64U64:
+    case IR::Opcode::PackUint2x32:
+    case IR::Opcode::UnpackUint2x32:
+    case IR::Opcode::PackFloat2x16:
+    case IR::Opcode::UnpackFloat2x16:
+    case IR::Opcode::PackHalf2x16:
+    case IR::Opcode::UnpackHalf2x16:
+    case IR::Opcode::PackDouble2x32:
+    case IR::Opcode::UnpackDouble2x32:
+    case IR::Opcode::FPAbs16:
+    case IR::Opcode::FPAbs32:
+    case IR::Opcode::FPAbs64:
+    case IR::Opcode::FPAdd16:
+    case IR::Opcode::FPAdd32:
+    case IR::Opcode::FPAdd64:
+    case IR::Opcode::FPAdd16x2:
+    case IR::Opcode::FPFma16:
+    case IR::Opcode::FPFma32:
+    case IR::Opcode::FPFma64:
+    case IR::Opcode::FPFma16x2:
+    case IR::Opcode::FPMax32:
+    case IR::Opcode::FPMax64:
+    case IR::Opcode::FPMin32:
+    case IR::Opcode::FPMin64:
+    case IR::Opcode::FPMul16:
+    case IR::Opcode::FPMul32:
+    case IR::Opcode::FPMul64:
+    case IR::Opcode::FPMul16x2:
+    case IR::Opcode::FPNeg16:
+    case IR::Opcode::FPNeg32:
+    case IR::Opcode::FPNeg64:
+    case IR::Opcode::FPRecip32:
+    case IR::Opcode::FPRecip64:
+    case IR::Opcode::FPRecipSqrt32:
+    case IR::Opcode::FPRecipSqrt64:
+    case IR::Opcode::FPSqrt:
+    case IR::Opcode::FPSin:
+    case IR::Opcode::FPExp2:
+    case IR::Opcode::FPCos:
+    case IR::Opcode::FPLog2:
+    case IR::Opcode::FPSaturate16:
+    case IR::Opcode::FPSaturate32:
+    case IR::Opcode::FPSaturate64:
+    case IR::Opcode::FPClamp16:
+    case IR::Opcode::FPClamp32:
+    case IR::Opcode::FPClamp64:
+    case IR::Opcode::FPRoundEven16:
+    case IR::Opcode::FPRoundEven32:
+    case IR::Opcode::FPRoundEven64:
+    case IR::Opcode::FPFloor16:
+    case IR::Opcode::FPFloor32:
+    case IR::Opcode::FPFloor64:
+    case IR::Opcode::FPCeil16:
+    case IR::Opcode::FPCeil32:
+    case IR::Opcode::FPCeil64:
+    case IR::Opcode::FPTrunc16:
+    case IR::Opcode::FPTrunc32:
+    case IR::Opcode::FPTrunc64:
+    case IR::Opcode::FPOrdEqual16:
+    case IR::Opcode::FPOrdEqual32:
+    case IR::Opcode::FPOrdEqual64:
+    case IR::Opcode::FPUnordEqual16:
+    case IR::Opcode::FPUnordEqual32:
+    case IR::Opcode::FPUnordEqual64:
+    case IR::Opcode::FPOrdNotEqual16:
+    case IR::Opcode::FPOrdNotEqual32:
+    case IR::Opcode::FPOrdNotEqual64:
+    case IR::Opcode::FPUnordNotEqual16:
+    case IR::Opcode::FPUnordNotEqual32:
+    case IR::Opcode::FPUnordNotEqual64:
+    case IR::Opcode::FPOrdLessThan16:
+    case IR::Opcode::FPOrdLessThan32:
+    case IR::Opcode::FPOrdLessThan64:
+    case IR::Opcode::FPUnordLessThan16:
+    case IR::Opcode::FPUnordLessThan32:
+    case IR::Opcode::FPUnordLessThan64:
+    case IR::Opcode::FPOrdGreaterThan16:
+    case IR::Opcode::FPOrdGreaterThan32:
+    case IR::Opcode::FPOrdGreaterThan64:
+    case IR::Opcode::FPUnordGreaterThan16:
+    case IR::Opcode::FPUnordGreaterThan32:
+    case IR::Opcode::FPUnordGreaterThan64:
+    case IR::Opcode::FPOrdLessThanEqual16:
+    case IR::Opcode::FPOrdLessThanEqual32:
+    case IR::Opcode::FPOrdLessThanEqual64:
+    case IR::Opcode::FPUnordLessThanEqual16:
+    case IR::Opcode::FPUnordLessThanEqual32:
+    case IR::Opcode::FPUnordLessThanEqual64:
+    case IR::Opcode::FPOrdGreaterThanEqual16:
+    case IR::Opcode::FPOrdGreaterThanEqual32:
+    case IR::Opcode::FPOrdGreaterThanEqual64:
+    case IR::Opcode::FPUnordGreaterThanEqual16:
+    case IR::Opcode::FPUnordGreaterThanEqual32:
+    case IR::Opcode::FPUnordGreaterThanEqual64:
+    case IR::Opcode::FPIsNan16:
+    case IR::Opcode::FPIsNan32:
+    case IR::Opcode::FPIsNan64:
+    case IR::Opcode::IAdd32:
+    case IR::Opcode::IAdd64:
+    case IR::Opcode::ISub32:
+    case IR::Opcode::ISub64:
+    case IR::Opcode::IMul32:
+    case IR::Opcode::SDiv32:
+    case IR::Opcode::UDiv32:
+    case IR::Opcode::INeg32:
+    case IR::Opcode::INeg64:
+    case IR::Opcode::IAbs32:
+    case IR::Opcode::IAbs64:
+    case IR::Opcode::ShiftLeftLogical32:
+    case IR::Opcode::ShiftLeftLogical64:
+    case IR::Opcode::ShiftRightLogical32:
+    case IR::Opcode::ShiftRightLogical64:
+    case IR::Opcode::ShiftRightArithmetic32:
+    case IR::Opcode::ShiftRightArithmetic64:
+    case IR::Opcode::BitwiseAnd32:
+    case IR::Opcode::BitwiseOr32:
+    case IR::Opcode::BitwiseXor32:
+    case IR::Opcode::BitFieldInsert:
+    case IR::Opcode::BitFieldSExtract:
+    case IR::Opcode::BitFieldUExtract:
+    case IR::Opcode::BitReverse32:
+    case IR::Opcode::BitCount32:
+    case IR::Opcode::BitwiseNot32:
+    case IR::Opcode::FindSMsb32:
+    case IR::Opcode::FindUMsb32:
+    case IR::Opcode::SMin32:
+    case IR::Opcode::UMin32:
+    case IR::Opcode::SMax32:
+    case IR::Opcode::UMax32:
+    case IR::Opcode::SClamp32:
+    case IR::Opcode::UClamp32:
+    case IR::Opcode::SLessThan:
+    case IR::Opcode::ULessThan:
+    case IR::Opcode::IEqual:
+    case IR::Opcode::SLessThanEqual:
+    case IR::Opcode::ULessThanEqual:
+    case IR::Opcode::SGreaterThan:
+    case IR::Opcode::UGreaterThan:
+    case IR::Opcode::INotEqual:
+    case IR::Opcode::SGreaterThanEqual:
+    case IR::Opcode::UGreaterThanEqual:
+    case IR::Opcode::LogicalOr:
+    case IR::Opcode::LogicalAnd:
+    case IR::Opcode::LogicalXor:
+    case IR::Opcode::LogicalNot:
+    case IR::Opcode::ConvertS16F16:
+    case IR::Opcode::ConvertS16F32:
+    case IR::Opcode::ConvertS16F64:
+    case IR::Opcode::ConvertS32F16:
+    case IR::Opcode::ConvertS32F32:
+    case IR::Opcode::ConvertS32F64:
+    case IR::Opcode::ConvertS64F16:
+    case IR::Opcode::ConvertS64F32:
+    case IR::Opcode::ConvertS64F64:
+    case IR::Opcode::ConvertU16F16:
+    case IR::Opcode::ConvertU16F32:
+    case IR::Opcode::ConvertU16F64:
+    case IR::Opcode::ConvertU32F16:
+    case IR::Opcode::ConvertU32F32:
+    case IR::Opcode::ConvertU32F64:
+    case IR::Opcode::ConvertU64F16:
+    case IR::Opcode::ConvertU64F32:
+    case IR::Opcode::ConvertU64F64:
+    case IR::Opcode::ConvertU64U32:
+    case IR::Opcode::ConvertU32U64:
+    case IR::Opcode::ConvertF16F32:
+    case IR::Opcode::ConvertF32F16:
+    case IR::Opcode::ConvertF32F64:
+    case IR::Opcode::ConvertF64F32:
+    case IR::Opcode::ConvertF16S8:
+    case IR::Opcode::ConvertF16S16:
+    case IR::Opcode::ConvertF16S32:
+    case IR::Opcode::ConvertF16S64:
+    case IR::Opcode::ConvertF16U8:
+    case IR::Opcode::ConvertF16U16:
+    case IR::Opcode::ConvertF16U32:
+    case IR::Opcode::ConvertF16U64:
+    case IR::Opcode::ConvertF32S8:
+    case IR::Opcode::ConvertF32S16:
+    case IR::Opcode::ConvertF32S32:
+    case IR::Opcode::ConvertF32S64:
+    case IR::Opcode::ConvertF32U8:
+    case IR::Opcode::ConvertF32U16:
+    case IR::Opcode::ConvertF32U32:
+    case IR::Opcode::ConvertF32U64:
+    case IR::Opcode::ConvertF64S8:
+    case IR::Opcode::ConvertF64S16:
+    case IR::Opcode::ConvertF64S32:
+    case IR::Opcode::ConvertF64S64:
+    case IR::Opcode::ConvertF64U8:
+    case IR::Opcode::ConvertF64U16:
+    case IR::Opcode::ConvertF64U32:
+    case IR::Opcode::ConvertF64U64:
+    case IR::Opcode::ConvertU16U32:
+    case IR::Opcode::ConvertU32U16:
+    case IR::Opcode::ConvertU8U32:
+    case IR::Opcode::ConvertU32U8:
+    case IR::Opcode::ConvertS32S8:
+    case IR::Opcode::ConvertS32S16:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t Intersect(const std::vector<size_t>& idoms, size_t lhs, size_t rhs) {
+    // Blocks are numbered in post order, dominators have higher numbers
+    while (lhs != rhs) {
+        while (lhs < rhs) {
+            lhs = idoms[lhs];
+        }
+        while (rhs < lhs) {
+            rhs = idoms[rhs];
+        }
+    }
+    return lhs;
+}
+
+/// Computes the immediate dominator of each block, indexed by post order.
+/// "A Simple, Fast Dominance Algorithm" by Cooper, Harvey and Kennedy.
+std::vector<size_t> ImmediateDominators(const IR::Program& program,
+                                        const std::unordered_map<const IR::Block*, size_t>& index) {
+    const size_t num_blocks{program.post_order_blocks.size()};
+    const size_t entry{num_blocks - 1};
+    std::vector<size_t> idoms(num_blocks, NO_DOMINATOR);
+    idoms[entry] = entry;
+
+    bool changed{true};
+    while (changed) {
+        changed = false;
+        for (size_t block = entry; block-- > 0;) {
+            const IR::Block* const current{program.post_order_blocks[block]};
+            size_t new_idom{NO_DOMINATOR};
+            for (const IR::Block* const pred : current->ImmPredecessors()) {
+                const auto it{index.find(pred)};
+                if (it == index.end() || idoms[it->second] == NO_DOMINATOR) {
+                    continue;
+                }
+                new_idom = new_idom == NO_DOMINATOR ? it->second
+                                                    : Intersect(idoms, it->second, new_idom);
+            }
+            if (idoms[block] != new_idom) {
+                idoms[block] = new_idom;
+                changed = true;
+            }
+        }
+    }
+    return idoms;
+}
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    if (program.post_order_blocks.empty()) {
+        return;
+    }
+    const size_t num_blocks{program.post_order_blocks.size()};
+    std::unordered_map<const IR::Block*, size_t> index;
+    for (size_t block = 0; block < num_blocks; ++block) {
+        index.emplace(program.post_order_blocks[block], block);
+    }
+    const std::vector<size_t> idoms{ImmediateDominators(program, index)};
+    const size_t entry{num_blocks - 1};
+    std::vector<boost::container::small_vector<size_t, 2>> children(num_blocks);
+    for (size_t block = 0; block < entry; ++block) {
+        if (idoms[block] != NO_DOMINATOR) {
+            children[idoms[block]].push_back(block);
+        }
+    }
+
+    // Walk the dominator tree, values numbered in a block are visible to the blocks it dominates
+    struct Frame {
+        size_t block;
+        size_t next_child;
+        size_t scope_size;
+    };
+    std::unordered_map<ValueKey, IR::Inst*, ValueKeyHash> values;
+    std::vector<ValueKey> scope;
+    std::vector<Frame> stack;
+    stack.push_back({entry, 0, 0});
+    bool visit_block{true};
+    while (!stack.empty()) {
+        Frame& frame{stack.back()};
+        if (visit_block) {
+            for (IR::Inst& inst : program.post_order_blocks[frame.block]->Instructions()) {
+                const IR::Opcode opcode{inst.GetOpcode()};
+                if (!IsPure(opcode) || inst.HasAssociatedPseudoOperation()) {
+                    continue;
+                }
+                ValueKey key{
+                    .opcode = opcode,
+                    .flags = inst.Flags<u32>(),
+                };
+                const size_t num_args{inst.NumArgs()};
+                for (size_t arg = 0; arg < num_args; ++arg) {
+                    if (inst.Arg(arg).IsIdentity()) {
+                        inst.SetArg(arg, inst.Arg(arg).Resolve());
+                    }
+                    key.args[arg] = inst.Arg(arg);
+                }
+                const auto [it, is_new]{values.try_emplace(key, &inst)};
+                if (is_new) {
+                    scope.push_back(key);
+                } else {
+                    inst.ReplaceUsesWith(IR::Value{it->second});
+                }
+            }
+            visit_block = false;
+        }
+        if (frame.next_child < children[frame.block].size()) {
+            const size_t child{children[frame.block][frame.next_child++]};
+            stack.push_back({child, 0, scope.size()});
+            visit_block = true;
+            continue;
+        }
+        while (scope.size() > frame.scope_size) {
+            values.erase(scope.back());
+            scope.pop_back();
+        }
+        stack.pop_back();
+    }
+}
+
+} // namespace Shader::Optimization
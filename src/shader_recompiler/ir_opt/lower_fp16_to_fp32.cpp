@@ -1,6 +1,12 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/ir_opt/passes.h"
 
@@ -126,11 +132,53 @@ IR::Opcode Replace(IR::Opcode op) {
         return op;
     }
 }
+
+IR::Opcode ReplacePacked(IR::Opcode op) {
+    switch (op) {
+    case IR::Opcode::FPAdd16x2:
+        return IR::Opcode::FPAdd32;
+    case IR::Opcode::FPFma16x2:
+        return IR::Opcode::FPFma32;
+    case IR::Opcode::FPMul16x2:
+        return IR::Opcode::FPMul32;
+    default:
+        return IR::Opcode::Void;
+    }
+}
+
+/// Splits an operation on a F16x2 vector into one F32 operation per element
+void LowerPacked(IR::Block& block, IR::Inst& inst, IR::Opcode op) {
+    const auto it{IR::Block::InstructionList::s_iterator_to(inst)};
+    const u32 flags{inst.Flags<u32>()};
+    const size_t num_args{inst.NumArgs()};
+    std::array<IR::Value, 2> elements;
+    for (u32 element = 0; element < 2; ++element) {
+        const auto extract{[&](size_t arg) {
+            return IR::Value{&*block.PrependNewInst(it, IR::Opcode::CompositeExtractF32x2,
+                                                    {inst.Arg(arg), IR::Value{element}})};
+        }};
+        if (num_args == 2) {
+            elements[element] =
+                IR::Value{&*block.PrependNewInst(it, op, {extract(0), extract(1)}, flags)};
+        } else {
+            elements[element] = IR::Value{
+                &*block.PrependNewInst(it, op, {extract(0), extract(1), extract(2)}, flags)};
+        }
+    }
+    const auto vector{block.PrependNewInst(it, IR::Opcode::CompositeConstructF32x2,
+                                           {elements[0], elements[1]})};
+    inst.ReplaceUsesWith(IR::Value{&*vector});
+}
 } // Anonymous namespace
 
 void LowerFp16ToFp32(IR::Program& program) {
     for (IR::Block* const block : program.blocks) {
         for (IR::Inst& inst : block->Instructions()) {
+            const IR::Opcode packed_op{ReplacePacked(inst.GetOpcode())};
+            if (packed_op != IR::Opcode::Void) {
+                LowerPacked(*block, inst, packed_op);
+                continue;
+            }
             inst.ReplaceOpcode(Replace(inst.GetOpcode()));
         }
     }
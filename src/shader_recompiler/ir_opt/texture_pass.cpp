@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <bit>
+#include <limits>
 #include <optional>
 
 #include <boost/container/small_vector.hpp>
@@ -302,20 +303,41 @@ std::optional<ConstBufferAddr> TryGetConstBuffer(const IR::Inst* inst, Environme
             .has_secondary = false,
         };
     }
-    IR::Inst* const offset_inst{offset.InstRecursive()};
+    IR::Inst* offset_inst{offset.InstRecursive()};
     if (offset_inst->GetOpcode() != IR::Opcode::IAdd32) {
         return std::nullopt;
     }
     u32 base_offset{};
     IR::U32 dynamic_offset;
-    if (offset_inst->Arg(0).IsImmediate()) {
-        base_offset = offset_inst->Arg(0).U32();
-        dynamic_offset = IR::U32{offset_inst->Arg(1)};
-    } else if (offset_inst->Arg(1).IsImmediate()) {
-        base_offset = offset_inst->Arg(1).U32();
-        dynamic_offset = IR::U32{offset_inst->Arg(0)};
-    } else {
-        return std::nullopt;
+    while (true) {
+        if (offset_inst->Arg(0).IsImmediate()) {
+            base_offset += offset_inst->Arg(0).U32();
+            dynamic_offset = IR::U32{offset_inst->Arg(1)};
+        } else if (offset_inst->Arg(1).IsImmediate()) {
+            base_offset += offset_inst->Arg(1).U32();
+            dynamic_offset = IR::U32{offset_inst->Arg(0)};
+        } else {
+            return std::nullopt;
+        }
+        // Fold chains of immediate additions like (x + 0x10) + 0x20 into the base offset, so the
+        // descriptor array starts at the constant part. Stop before an immediate wraps the offset.
+        if (dynamic_offset.IsImmediate()) {
+            break;
+        }
+        IR::Inst* const dynamic_inst{dynamic_offset.InstRecursive()};
+        if (dynamic_inst->GetOpcode() != IR::Opcode::IAdd32) {
+            break;
+        }
+        const IR::Value lhs{dynamic_inst->Arg(0)};
+        const IR::Value rhs{dynamic_inst->Arg(1)};
+        if (!lhs.IsImmediate() && !rhs.IsImmediate()) {
+            break;
+        }
+        const u32 next_offset{lhs.IsImmediate() ? lhs.U32() : rhs.U32()};
+        if (next_offset > std::numeric_limits<u32>::max() - base_offset) {
+            break;
+        }
+        offset_inst = dynamic_inst;
     }
     return ConstBufferAddr{
         .index = index.U32(),
@@ -330,30 +352,38 @@ std::optional<ConstBufferAddr> TryGetConstBuffer(const IR::Inst* inst, Environme
     };
 }
 
-// TODO:xbzk: shall be dropped when Track method cover all bindless stuff
-static ConstBufferAddr last_valid_addr = ConstBufferAddr{
-    .index = 0,
-    .offset = 0,
-    .shift_left = 0,
-    .secondary_index = 0,
-    .secondary_offset = 0,
-    .secondary_shift_left = 0,
-    .dynamic_offset = {},
-    .count = 1,
-    .has_secondary = false,
+/// Bindless handles that couldn't be tracked in the shader being compiled
+struct TrackFallbacks {
+    /// Last handle tracked in the shader, used for the handles that can't be tracked
+    /// TODO:xbzk: shall be dropped when Track method cover all bindless stuff
+    ConstBufferAddr last_valid_addr{
+        .index = 0,
+        .offset = 0,
+        .shift_left = 0,
+        .secondary_index = 0,
+        .secondary_offset = 0,
+        .secondary_shift_left = 0,
+        .dynamic_offset = {},
+        .count = 1,
+        .has_secondary = false,
+    };
+    u32 num_fallbacks = 0;
+    u32 num_bindless = 0;
 };
 
-TextureInst MakeInst(Environment& env, IR::Block* block, IR::Inst& inst) {
+TextureInst MakeInst(Environment& env, IR::Block* block, IR::Inst& inst,
+                     TrackFallbacks& fallbacks) {
     ConstBufferAddr addr;
     if (IsBindless(inst)) {
         const std::optional<ConstBufferAddr> track_addr{Track(inst.Arg(0), env)};
-
+        ++fallbacks.num_bindless;
         if (!track_addr) {
             //throw NotImplementedException("Failed to track bindless texture constant buffer");
-            addr = last_valid_addr; // TODO:xbzk: shall be dropped when Track method cover all bindless stuff
+            addr = fallbacks.last_valid_addr;
+            ++fallbacks.num_fallbacks;
         } else {
             addr = *track_addr;
-            last_valid_addr = addr; // TODO:xbzk: shall be dropped when Track method cover all bindless stuff
+            fallbacks.last_valid_addr = addr;
         }
     } else {
         addr = ConstBufferAddr{
@@ -544,14 +574,22 @@ void PatchTexelFetch(IR::Block& block, IR::Inst& inst, TexturePixelFormat pixel_
 
 void TexturePass(Environment& env, IR::Program& program, const HostTranslateInfo& host_info) {
     TextureInstVector to_replace;
+    // The fallback state is per shader, shaders are compiled from several threads
+    TrackFallbacks fallbacks;
     for (IR::Block* const block : program.post_order_blocks) {
         for (IR::Inst& inst : block->Instructions()) {
             if (!IsTextureInstruction(inst)) {
                 continue;
             }
-            to_replace.push_back(MakeInst(env, block, inst));
+            to_replace.push_back(MakeInst(env, block, inst, fallbacks));
         }
     }
+    if (fallbacks.num_fallbacks != 0) {
+        LOG_WARNING(Shader,
+                    "{} of {} bindless texture instructions failed to track their handle, "
+                    "using the last tracked descriptor",
+                    fallbacks.num_fallbacks, fallbacks.num_bindless);
+    }
     // Sort instructions to visit textures by constant buffer index, then by offset
     std::ranges::sort(to_replace, [](const auto& lhs, const auto& rhs) {
         return lhs.cbuf.offset < rhs.cbuf.offset;
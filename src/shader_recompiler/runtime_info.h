@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -71,6 +74,12 @@ enum class TessSpacing {
     FractionalEven,
 };
 
+/// Specialization constant IDs of the fixed function state read by SPIR-V modules
+enum class SpecializationConstant : u32 {
+    AlphaTestReference,
+    FixedStatePointSize,
+};
+
 struct TransformFeedbackVarying {
     u32 buffer{};
     u32 stride{};
@@ -96,6 +105,10 @@ struct RuntimeInfo {
     std::optional<CompareFunction> alpha_test_func;
     float alpha_test_reference{};
 
+    /// Read the alpha test reference and the fixed point size from specialization constants,
+    /// so SPIR-V modules do not depend on their values
+    bool specialize_fixed_state{};
+
     /// Static Y negate value
     bool y_negate{};
     /// Use storage buffers instead of global pointers on GLASM
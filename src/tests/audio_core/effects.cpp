@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/adsp/apps/audio_renderer/command_list_processor.h"
+#include "audio_core/renderer/command/effect/delay.h"
+#include "audio_core/renderer/command/effect/i3dl2_reverb.h"
+#include "audio_core/renderer/command/effect/reverb.h"
+#include "common/common_types.h"
+
+namespace {
+using namespace AudioCore::Renderer;
+using AudioCore::MaxChannels;
+
+constexpr u32 SAMPLE_COUNT = 240;
+constexpr u32 NUM_BLOCKS = 200;
+
+struct ExpectedHash {
+    u16 channel_count;
+    u64 hash;
+};
+
+/**
+ * Runs an effect over random input and hashes its output. The effects are fixed point and must
+ * not change a single sample, the hashes were taken before their loops were optimized.
+ */
+template <typename Command, typename State, typename Parameter>
+u64 HashEffect(u16 channel_count, const Parameter& parameter) {
+    std::vector<s32> mix_buffers(MaxChannels * 2 * SAMPLE_COUNT);
+    AudioCore::ADSP::AudioRenderer::CommandListProcessor processor{};
+    processor.sample_count = SAMPLE_COUNT;
+    processor.mix_buffers = mix_buffers;
+
+    const auto state = std::make_unique<State>();
+    Command command{};
+    command.parameter = parameter;
+    command.parameter.channel_count = channel_count;
+    command.state = reinterpret_cast<decltype(command.state)>(state.get());
+    command.effect_enabled = true;
+    for (s16 channel = 0; channel < static_cast<s16>(MaxChannels); channel++) {
+        command.inputs[channel] = channel;
+        command.outputs[channel] = static_cast<s16>(MaxChannels + channel);
+    }
+
+    std::mt19937 rng{channel_count};
+    u64 hash = 0xcbf29ce484222325ULL;
+    for (u32 block = 0; block < NUM_BLOCKS; block++) {
+        command.parameter.state = block == 0 ? EffectInfoBase::ParameterState::Initialized
+                                             : EffectInfoBase::ParameterState::Updated;
+        for (u32 i = 0; i < MaxChannels * SAMPLE_COUNT; i++) {
+            mix_buffers[i] = static_cast<s32>(rng() % 0x10000) - 0x8000;
+        }
+        command.Process(processor);
+
+        const auto output = std::span(mix_buffers).subspan(MaxChannels * SAMPLE_COUNT,
+                                                            channel_count * SAMPLE_COUNT);
+        for (const s32 sample : output) {
+            hash = (hash ^ static_cast<u32>(sample)) * 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+DelayInfo::ParameterVersion1 DelayParameter() {
+    DelayInfo::ParameterVersion1 parameter{};
+    parameter.sample_rate = 48;
+    parameter.in_gain = 0.7f;
+    parameter.feedback_gain = 0.6f;
+    parameter.wet_gain = 0.5f;
+    parameter.dry_gain = 0.5f;
+    parameter.channel_spread = 0.3f;
+    parameter.lowpass_amount = 0.4f;
+    parameter.delay_time = 7;
+    parameter.delay_time_max = 20;
+    return parameter;
+}
+
+ReverbInfo::ParameterVersion2 ReverbParameter() {
+    ReverbInfo::ParameterVersion2 parameter{};
+    parameter.sample_rate = 48 << 14;
+    parameter.early_mode = 1;
+    parameter.early_gain = 1 << 13;
+    parameter.pre_delay = 10 << 14;
+    parameter.late_mode = 1;
+    parameter.late_gain = 1 << 13;
+    parameter.decay_time = 2 << 14;
+    parameter.high_freq_decay_ratio = 1 << 13;
+    parameter.colouration = 1 << 13;
+    parameter.base_gain = 1 << 14;
+    parameter.wet_gain = 1 << 13;
+    parameter.dry_gain = 1 << 13;
+    return parameter;
+}
+
+I3dl2ReverbInfo::ParameterVersion1 I3dl2Parameter() {
+    I3dl2ReverbInfo::ParameterVersion1 parameter{};
+    parameter.sample_rate = 48000;
+    parameter.room_HF_gain = -100.0f;
+    parameter.reference_HF = 5000.0f;
+    parameter.late_reverb_decay_time = 1.5f;
+    parameter.late_reverb_HF_decay_ratio = 0.8f;
+    parameter.room_gain = -500.0f;
+    parameter.reflection_gain = -300.0f;
+    parameter.reverb_gain = -200.0f;
+    parameter.late_reverb_diffusion = 100.0f;
+    parameter.reflection_delay = 0.02f;
+    parameter.late_reverb_delay_time = 0.04f;
+    parameter.late_reverb_density = 100.0f;
+    parameter.dry_gain = 0.6f;
+    return parameter;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Effects: Delay output is unchanged", "[audio_core]") {
+    static constexpr ExpectedHash HASHES[]{
+        {1, 0x49e318aeb6cd8f5dULL},
+        {2, 0x09ee1130088b731eULL},
+        {4, 0x63fc7ba2d74ebc90ULL},
+        {6, 0x4a5624408e1600e1ULL},
+    };
+    const auto parameter = DelayParameter();
+    for (const auto& [channel_count, hash] : HASHES) {
+        const u64 output_hash =
+            HashEffect<DelayCommand, DelayInfo::State>(channel_count, parameter);
+        REQUIRE(output_hash == hash);
+    }
+}
+
+TEST_CASE("Effects: Reverb output is unchanged", "[audio_core]") {
+    static constexpr ExpectedHash HASHES[]{
+        {1, 0x84bc2c7fd05e3061ULL},
+        {2, 0xdd5967cb402fb6ccULL},
+        {4, 0x3495a1fee45acaa9ULL},
+        {6, 0xe27d766e4fa7814fULL},
+    };
+    const auto parameter = ReverbParameter();
+    for (const auto& [channel_count, hash] : HASHES) {
+        const u64 output_hash =
+            HashEffect<ReverbCommand, ReverbInfo::State>(channel_count, parameter);
+        REQUIRE(output_hash == hash);
+    }
+}
+
+TEST_CASE("Effects: I3DL2 reverb output is unchanged", "[audio_core]") {
+    static constexpr ExpectedHash HASHES[]{
+        {1, 0x85ab7fec42445914ULL},
+        {2, 0xddcd7e06c60d9be4ULL},
+        {4, 0x774f5b5ebb039f8dULL},
+        {6, 0x9480393050006111ULL},
+    };
+    const auto parameter = I3dl2Parameter();
+    for (const auto& [channel_count, hash] : HASHES) {
+        const u64 output_hash =
+            HashEffect<I3dl2ReverbCommand, I3dl2ReverbInfo::State>(channel_count, parameter);
+        REQUIRE(output_hash == hash);
+    }
+}
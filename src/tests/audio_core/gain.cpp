@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <span>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/renderer/command/mix/gain.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace {
+using namespace AudioCore::Renderer;
+
+struct Gain {
+    f32 volume;
+    f32 ramp;
+};
+
+/// Sample by sample reference, the loop the mix and volume commands used to run.
+template <size_t Q, bool ACCUMULATE>
+s32 ReferenceGain(std::span<s32> output, std::span<const s32> input, f32 volume_, f32 ramp_,
+                  u32 sample_count) {
+    Common::FixedPoint<64 - Q, Q> volume{volume_};
+    const Common::FixedPoint<64 - Q, Q> ramp{ramp_};
+    Common::FixedPoint<64 - Q, Q> sample{0};
+    for (u32 i = 0; i < sample_count; i++) {
+        sample = input[i] * volume;
+        if constexpr (ACCUMULATE) {
+            output[i] = (output[i] + sample).to_int();
+        } else {
+            auto gained{sample};
+            output[i] = gained.to_int();
+        }
+        volume += ramp;
+    }
+    return sample.to_int();
+}
+
+std::vector<s32> RandomSamples(u32 count, u32 seed) {
+    std::mt19937 rng{seed};
+    std::vector<s32> samples(count);
+    for (s32& sample : samples) {
+        sample = static_cast<s32>(rng());
+    }
+    return samples;
+}
+
+constexpr u32 SAMPLE_COUNTS[]{0, 1, 3, 4, 5, 8, 17, 160, 240};
+
+constexpr Gain GAINS[]{
+    // Constant volume
+    {1.0f, 0.0f},
+    {0.5f, 0.0f},
+    {-0.75f, 0.0f},
+    // Ramps
+    {0.0f, 1.0f / 240.0f},
+    {1.0f, -1.0f / 240.0f},
+    {2.5f, 0.0123f},
+    // Raw volume doesn't fit in 32 bits at Q23, taking the scalar path
+    {300.0f, 0.0f},
+};
+
+template <size_t Q, bool ACCUMULATE>
+void CheckGain() {
+    for (const u32 sample_count : SAMPLE_COUNTS) {
+        const std::vector<s32> input = RandomSamples(sample_count, sample_count);
+        for (const Gain& gain : GAINS) {
+            std::vector<s32> output = RandomSamples(sample_count, sample_count + 1);
+            std::vector<s32> expected = output;
+            const s32 last = ApplyGain<Q, ACCUMULATE>(output, input, gain.volume, gain.ramp,
+                                                      sample_count);
+            REQUIRE(last == ReferenceGain<Q, ACCUMULATE>(expected, input, gain.volume,
+                                                         gain.ramp, sample_count));
+            REQUIRE(output == expected);
+        }
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("AudioGain: Mix matches the reference", "[audio_core]") {
+    CheckGain<15, true>();
+    CheckGain<23, true>();
+}
+
+TEST_CASE("AudioGain: Volume matches the reference", "[audio_core]") {
+    CheckGain<15, false>();
+    CheckGain<23, false>();
+}
+
+TEST_CASE("AudioGain: Benchmark", "[audio_core][!benchmark][.]") {
+    static constexpr u32 sample_count = 240;
+    const std::vector<s32> input = RandomSamples(sample_count, 0);
+    std::vector<s32> output(sample_count);
+    BENCHMARK("Mix ramp") {
+        return ApplyGain<15, true>(output, input, 0.5f, 1.0f / sample_count, sample_count);
+    };
+    BENCHMARK("Mix ramp reference") {
+        return ReferenceGain<15, true>(output, input, 0.5f, 1.0f / sample_count, sample_count);
+    };
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/renderer/command/host_command_timings.h"
+#include "common/common_types.h"
+
+namespace {
+using namespace AudioCore::Renderer;
+
+/// Host time a command estimated at the given DSP cycles takes, when it's `ratio` times slower
+u64 HostTimeNs(u32 estimated, f64 ratio) {
+    return static_cast<u64>(static_cast<f64>(estimated) * ratio / HostCommandTimings::CyclesPerNs);
+}
+
+/// Render the command for a number of frames, recording its calibrated estimate on the host
+void Render(HostCommandTimings& timings, CommandId type, u32 estimated, f64 ratio, u32 frames) {
+    for (u32 frame = 0; frame < frames; frame++) {
+        timings.Record(type, timings.Calibrate(type, estimated), HostTimeNs(estimated, ratio));
+        timings.Update();
+    }
+}
+} // Anonymous namespace
+
+TEST_CASE("HostCommandTimings[Uncalibrated]", "[audio_core]") {
+    HostCommandTimings timings;
+    REQUIRE(timings.Calibrate(CommandId::Mix, 1000) == 1000);
+
+    // Nothing recorded, nothing learnt
+    timings.Update();
+    REQUIRE(timings.Calibrate(CommandId::Mix, 1000) == 1000);
+}
+
+TEST_CASE("HostCommandTimings[Converges]", "[audio_core]") {
+    HostCommandTimings timings;
+    Render(timings, CommandId::Reverb, 10000, 3.0, 500);
+    const u32 slow = timings.Calibrate(CommandId::Reverb, 10000);
+    REQUIRE(slow > 29000);
+    REQUIRE(slow < 31000);
+
+    Render(timings, CommandId::Reverb, 10000, 0.5, 500);
+    const u32 fast = timings.Calibrate(CommandId::Reverb, 10000);
+    REQUIRE(fast > 4800);
+    REQUIRE(fast < 5200);
+
+    // Other command types keep their own scale
+    REQUIRE(timings.Calibrate(CommandId::Mix, 1000) == 1000);
+}
+
+TEST_CASE("HostCommandTimings[Clamped]", "[audio_core]") {
+    HostCommandTimings timings;
+    Render(timings, CommandId::Delay, 100, 1000.0, 1000);
+    REQUIRE(timings.Calibrate(CommandId::Delay, 100) ==
+            static_cast<u32>(100 * HostCommandTimings::MaxScale));
+}
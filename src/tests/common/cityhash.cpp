@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/cityhash.h"
@@ -19,3 +22,18 @@ TEST_CASE("CityHash", "[common]") {
     REQUIRE(CityHash128WithSeed(msg, sizeof(msg), {0xdead, 0xbeef}) ==
             u128{0xf0307dba81199ebe, 0xd77764e0c4a9eb74});
 }
+
+TEST_CASE("CityHash: Benchmark", "[common][!benchmark][.]") {
+    // Small keys like pipeline state, and a large one like a shader or a macro program
+    const std::vector<u8> small(64, 0xAB);
+    const std::vector<u8> large(64 * 1024, 0xCD);
+    BENCHMARK("CityHash64 64 B") {
+        return CityHash64(reinterpret_cast<const char*>(small.data()), small.size());
+    };
+    BENCHMARK("CityHash64 64 KiB") {
+        return CityHash64(reinterpret_cast<const char*>(large.data()), large.size());
+    };
+    BENCHMARK("CityHash128 64 KiB") {
+        return CityHash128(reinterpret_cast<const char*>(large.data()), large.size());
+    };
+}
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -11,6 +14,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
@@ -271,4 +275,34 @@ TEST_CASE("Fibers::StartRace", "[common]") {
     REQUIRE(test_control.value3 == 1);
 }
 
+TEST_CASE("Fibers: Switch benchmark", "[common][!benchmark][.]") {
+    // Guest threads run on work fibers and reschedule through the thread fiber of their core
+    const auto thread_fiber = Fiber::ThreadToFiber();
+    std::shared_ptr<Fiber> guest1;
+    std::shared_ptr<Fiber> guest2;
+    u64 switches = 0;
+    guest1 = std::make_shared<Fiber>([&] {
+        while (true) {
+            ++switches;
+            Fiber::YieldTo(guest1, *thread_fiber);
+        }
+    });
+    guest2 = std::make_shared<Fiber>([&] {
+        while (true) {
+            ++switches;
+            Fiber::YieldTo(guest2, *guest1);
+        }
+    });
+
+    BENCHMARK("Thread fiber to guest and back") {
+        Fiber::YieldTo(thread_fiber, *guest1);
+        return switches;
+    };
+    BENCHMARK("Guest to guest and back to the thread fiber") {
+        Fiber::YieldTo(thread_fiber, *guest2);
+        return switches;
+    };
+    thread_fiber->Exit();
+}
+
 } // namespace Common
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/cityhash.h"
+#include "common/hash.h"
+
+using namespace Common;
+
+TEST_CASE("WyHash64", "[common]") {
+    // Test vectors of the reference implementation, each hashed with its index as the seed
+    constexpr std::string_view messages[]{
+        "",
+        "a",
+        "abc",
+        "message digest",
+        "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        "12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+    };
+    constexpr u64 hashes[]{
+        0x93228a4de0eec5a2, 0xc5bac3db178713c4, 0xa97f2f7b1d9b3314, 0x786d1f1df3801df4,
+        0xdca5a8138ad37c87, 0xb9e734f117cfaf70, 0x6cc5eab49a92d617,
+    };
+    for (u64 i = 0; i < std::size(messages); ++i) {
+        REQUIRE(WyHash64(messages[i].data(), messages[i].size(), i) == hashes[i]);
+    }
+}
+
+TEST_CASE("Hash64", "[common]") {
+    constexpr std::string_view msg{"The blue frogs are singing under the crimson sky."};
+    REQUIRE(Hash64<HashAlgorithm::CityHash64>(msg.data(), msg.size()) ==
+            CityHash64(msg.data(), msg.size()));
+    REQUIRE(Hash64<HashAlgorithm::WyHash64>(msg.data(), msg.size()) ==
+            WyHash64(msg.data(), msg.size()));
+}
+
+TEST_CASE("WyHash64: Benchmark", "[common][!benchmark][.]") {
+    // The same sizes as the CityHash benchmark, along with one like a graphics pipeline key
+    const std::vector<u8> small(64, 0xAB);
+    const std::vector<u8> key(320, 0xEF);
+    const std::vector<u8> large(64 * 1024, 0xCD);
+    BENCHMARK("CityHash64 64 B") {
+        return CityHash64(reinterpret_cast<const char*>(small.data()), small.size());
+    };
+    BENCHMARK("WyHash64 64 B") {
+        return WyHash64(small.data(), small.size());
+    };
+    BENCHMARK("CityHash64 320 B") {
+        return CityHash64(reinterpret_cast<const char*>(key.data()), key.size());
+    };
+    BENCHMARK("WyHash64 320 B") {
+        return WyHash64(key.data(), key.size());
+    };
+    BENCHMARK("CityHash64 64 KiB") {
+        return CityHash64(reinterpret_cast<const char*>(large.data()), large.size());
+    };
+    BENCHMARK("WyHash64 64 KiB") {
+        return WyHash64(large.data(), large.size());
+    };
+}
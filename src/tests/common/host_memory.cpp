@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <utility>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/host_memory.h"
@@ -184,3 +187,87 @@ TEST_CASE("HostMemory: Partial sparse middle unmap and check bindings", "[common
     REQUIRE(ptr[0x0000] == 19);
     REQUIRE(ptr[0x3fff] == 12);
 }
+
+TEST_CASE("HostMemory: Huge pages and prefault keep mappings working", "[common]") {
+    static constexpr size_t SIZE = 64_MiB;
+    HostMemory mem(SIZE, VIRTUAL_SIZE, true, true);
+    REQUIRE(mem.IsPrefaulted());
+    mem.Map(0x400000, 0x200000, 0x400000, PERMS, HEAP);
+
+    volatile u8* const ptr = mem.VirtualBasePointer() + 0x400000;
+    ptr[0x0000] = 0x45;
+    ptr[0x3fffff] = 0x10;
+    REQUIRE(mem.BackingBasePointer()[0x200000] == 0x45);
+    REQUIRE(mem.BackingBasePointer()[0x5fffff] == 0x10);
+    REQUIRE(mem.GetHugePageMappedSize() <= SIZE);
+}
+
+TEST_CASE("HostMemory: Batched protections are coalesced", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    mem.Map(0x4000, 0x10000, 0x4000, PERMS, HEAP);
+
+    const Common::ProtectStatistics before = HostMemory::GetProtectStatistics();
+    {
+        Common::ScopedProtectBatch batch;
+        mem.Protect(0x4000, 0x1000, Common::MemoryPermission::Read);
+        mem.Protect(0x5000, 0x2000, Common::MemoryPermission::Read);
+        {
+            // Nested batches are only applied by the outermost one.
+            Common::ScopedProtectBatch nested;
+            mem.Protect(0x7000, 0x1000, Common::MemoryPermission::Read);
+        }
+        REQUIRE(HostMemory::GetProtectStatistics().issued == before.issued);
+    }
+    const Common::ProtectStatistics batched = HostMemory::GetProtectStatistics();
+    REQUIRE(batched.requested - before.requested == 3);
+    REQUIRE(batched.issued - before.issued == 1);
+
+    {
+        // Changes that can't be merged are applied in order.
+        Common::ScopedProtectBatch batch;
+        mem.Protect(0x4000, 0x4000, Common::MemoryPermission{});
+        mem.Protect(0x5000, 0x1000, Common::MemoryPermission::Read);
+        mem.Protect(0x4000, 0x4000, PERMS);
+    }
+    REQUIRE(HostMemory::GetProtectStatistics().issued - batched.issued == 3);
+
+    volatile u8* const data = mem.VirtualBasePointer() + 0x4000;
+    data[0x3fff] = 21;
+    REQUIRE(mem.BackingBasePointer()[0x13fff] == 21);
+}
+
+TEST_CASE("HostMemory: Write watch reports written pages", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    if (!mem.EnableWriteWatch()) {
+        // Not supported by the host.
+        return;
+    }
+    mem.Map(0x4000, 0x10000, 0x4000, PERMS, HEAP);
+    mem.WatchWrites(0x4000, 0x4000, true);
+
+    std::vector<std::pair<size_t, size_t>> writes;
+    const auto collect = [&] {
+        writes.clear();
+        mem.CollectWrites(
+            [&](size_t offset, size_t length) { writes.emplace_back(offset, length); });
+    };
+    volatile u8* const data = mem.VirtualBasePointer() + 0x4000;
+    data[0x1000] = 1;
+    data[0x1fff] = 2;
+    collect();
+    REQUIRE(writes == std::vector<std::pair<size_t, size_t>>{{0x5000, 0x1000}});
+    collect();
+    REQUIRE(writes.empty());
+
+    // Views mapped again in a watched range are watched too.
+    mem.Unmap(0x4000, 0x4000, HEAP);
+    mem.Map(0x4000, 0x20000, 0x4000, PERMS, HEAP);
+    data[0x3000] = 3;
+    collect();
+    REQUIRE(writes == std::vector<std::pair<size_t, size_t>>{{0x7000, 0x1000}});
+
+    mem.WatchWrites(0x4000, 0x4000, false);
+    data[0] = 4;
+    collect();
+    REQUIRE(writes.empty());
+}
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/interval_index.h"
+
+namespace {
+
+std::vector<int> Overlaps(const Common::IntervalIndex<u64, int>& index, u64 begin, u64 end) {
+    std::vector<int> values;
+    index.ForEachOverlap(begin, end, [&values](int value) { values.push_back(value); });
+    std::ranges::sort(values);
+    return values;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("IntervalIndex: Overlap queries", "[common]") {
+    Common::IntervalIndex<u64, int> index;
+    REQUIRE(index.Empty());
+
+    index.Insert(0x1000, 0x2000, 1);
+    index.Insert(0x1800, 0x1900, 2);
+    index.Insert(0x0, 0x1'0000'0000, 3);
+    index.Insert(0x3000, 0x3001, 4);
+    REQUIRE(!index.Empty());
+
+    REQUIRE((Overlaps(index, 0x1900, 0x1A00) == std::vector{1, 3}));
+    REQUIRE((Overlaps(index, 0x18FF, 0x1900) == std::vector{1, 2, 3}));
+    // Ranges are half-open.
+    REQUIRE((Overlaps(index, 0x2000, 0x3000) == std::vector{3}));
+    REQUIRE((Overlaps(index, 0x3000, 0x3001) == std::vector{3, 4}));
+    REQUIRE(Overlaps(index, 0x1'0000'0000, 0x2'0000'0000).empty());
+    REQUIRE(Overlaps(index, 0x1800, 0x1800).empty());
+
+    // Large intervals are found from queries far from their start.
+    REQUIRE((Overlaps(index, 0xFFFF'FFFF, 0x1'0000'0001) == std::vector{3}));
+}
+
+TEST_CASE("IntervalIndex: Erase", "[common]") {
+    Common::IntervalIndex<u64, int> index;
+    index.Insert(0x1000, 0x2000, 1);
+    index.Insert(0x1000, 0x2000, 2);
+
+    // Only the interval with the same bounds and value is removed.
+    REQUIRE(!index.Erase(0x1000, 0x1FFF, 1));
+    REQUIRE(!index.Erase(0x1000, 0x2000, 3));
+    REQUIRE(index.Erase(0x1000, 0x2000, 1));
+    REQUIRE((Overlaps(index, 0x1000, 0x2000) == std::vector{2}));
+
+    REQUIRE(index.Erase(0x1000, 0x2000, 2));
+    REQUIRE(index.Empty());
+    REQUIRE(Overlaps(index, 0, ~u64{0}).empty());
+}
+
+TEST_CASE("IntervalIndex: Stops when asked", "[common]") {
+    Common::IntervalIndex<u64, int> index;
+    for (int i = 0; i < 16; ++i) {
+        index.Insert(static_cast<u64>(i) * 0x100, static_cast<u64>(i) * 0x100 + 0x200, i);
+    }
+    int visited = 0;
+    index.ForEachOverlap(0, 0x10000, [&visited](int) { return ++visited == 3; });
+    REQUIRE(visited == 3);
+}
+
+TEST_CASE("IntervalIndex: Matches a linear search", "[common]") {
+    Common::IntervalIndex<u64, int> index;
+    struct Interval {
+        u64 begin;
+        u64 end;
+    };
+    std::vector<Interval> intervals;
+    u64 seed = 12345;
+    const auto next = [&seed] {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return seed >> 33;
+    };
+    for (int i = 0; i < 500; ++i) {
+        const u64 begin = next() % 0x100000;
+        const u64 size = 1 + (next() % (u64{1} << (next() % 20)));
+        intervals.push_back({begin, begin + size});
+        index.Insert(begin, begin + size, i);
+    }
+    for (int query = 0; query < 200; ++query) {
+        const u64 begin = next() % 0x110000;
+        const u64 end = begin + 1 + next() % 0x4000;
+        std::vector<int> expected;
+        for (int i = 0; i < static_cast<int>(intervals.size()); ++i) {
+            if (intervals[i].begin < end && begin < intervals[i].end) {
+                expected.push_back(i);
+            }
+        }
+        REQUIRE(Overlaps(index, begin, end) == expected);
+    }
+}
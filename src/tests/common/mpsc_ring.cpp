@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/mpsc_ring.h"
+
+namespace Common {
+
+TEST_CASE("MPSCRing: Basic Tests", "[common]") {
+    MPSCRing<int, 4> ring;
+
+    REQUIRE(ring.Empty());
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(ring.EmplaceWait(i) == static_cast<u64>(i));
+    }
+    REQUIRE(!ring.Empty());
+
+    for (int i = 0; i < 4; ++i) {
+        int value = -1;
+        REQUIRE(ring.TryConsume([&value](int& v) { value = v; }));
+        REQUIRE(value == i);
+    }
+    REQUIRE(ring.Empty());
+    REQUIRE(!ring.TryConsume([](int&) {}));
+
+    // Positions keep increasing after wrapping around.
+    REQUIRE(ring.EmplaceWait(42) == 4U);
+}
+
+TEST_CASE("MPSCRing: Destroys pending elements", "[common]") {
+    const auto counter = std::make_shared<int>(0);
+    {
+        MPSCRing<std::shared_ptr<int>, 8> ring;
+        ring.EmplaceWait(counter);
+        ring.EmplaceWait(counter);
+        REQUIRE(counter.use_count() == 3);
+    }
+    REQUIRE(counter.use_count() == 1);
+}
+
+TEST_CASE("MPSCRing: Threaded Test", "[common]") {
+    constexpr size_t num_producers = 4;
+    constexpr size_t count_per_producer = 50000;
+    struct Item {
+        size_t producer;
+        size_t value;
+    };
+    MPSCRing<Item, 64> ring;
+
+    std::vector<std::jthread> producers;
+    for (size_t producer = 0; producer < num_producers; ++producer) {
+        producers.emplace_back([&ring, producer] {
+            for (size_t i = 0; i < count_per_producer; ++i) {
+                ring.EmplaceWait(producer, i);
+            }
+        });
+    }
+
+    // Elements from the same producer must be consumed in the order they were pushed.
+    std::array<size_t, num_producers> next{};
+    std::stop_source stop_source;
+    for (size_t i = 0; i < num_producers * count_per_producer; ++i) {
+        REQUIRE(ring.ConsumeWait(
+            [&next](Item& item) {
+                REQUIRE(item.value == next[item.producer]);
+                ++next[item.producer];
+            },
+            stop_source.get_token()));
+    }
+    for (const size_t count : next) {
+        REQUIRE(count == count_per_producer);
+    }
+
+    // A stop request wakes up a sleeping consumer.
+    std::jthread stopper{[&stop_source] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        stop_source.request_stop();
+    }};
+    REQUIRE(!ring.ConsumeWait([](Item&) {}, stop_source.get_token()));
+}
+
+} // namespace Common
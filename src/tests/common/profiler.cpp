@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/profiler.h"
+#include "common/thread.h"
+
+namespace Common::Profiler {
+namespace {
+std::string ReadFile(const std::filesystem::path& path) {
+    std::ifstream file{path};
+    std::stringstream stream;
+    stream << file.rdbuf();
+    return stream.str();
+}
+} // Anonymous namespace
+
+TEST_CASE("Profiler: Zones are only recorded while recording", "[common]") {
+    const auto path = std::filesystem::temp_directory_path() / "eden_profiler_test.trace.json";
+
+    {
+        PROFILE_SCOPE("NotRecorded");
+    }
+    REQUIRE(!IsRecording());
+    REQUIRE(!Stop(path));
+
+    Start();
+    REQUIRE(IsRecording());
+    std::thread thread{[] {
+        SetCurrentThreadName("ProfilerTest");
+        PROFILE_SCOPE("ThreadZone");
+    }};
+    thread.join();
+    {
+        PROFILE_SCOPE("MainZone");
+    }
+    REQUIRE(Stop(path));
+    REQUIRE(!IsRecording());
+
+    const std::string trace = ReadFile(path);
+    std::filesystem::remove(path);
+    REQUIRE(trace.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    REQUIRE(trace.ends_with("]}\n"));
+    REQUIRE(trace.find("\"name\":\"ProfilerTest\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"ThreadZone\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"MainZone\"") != std::string::npos);
+    REQUIRE(trace.find("NotRecorded") == std::string::npos);
+    REQUIRE(trace.find(",\n]") == std::string::npos);
+}
+
+} // namespace Common::Profiler
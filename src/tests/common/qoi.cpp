@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/qoi.h"
+
+namespace Common::Qoi {
+
+namespace {
+
+const std::vector<u8> END_MARKER{0, 0, 0, 0, 0, 0, 0, 1};
+
+std::vector<u8> Header(u8 width, u8 height) {
+    return {'q', 'o', 'i', 'f', 0, 0, 0, width, 0, 0, 0, height, 3, 0};
+}
+
+std::vector<u8> Image(u8 width, u8 height, std::vector<u8> ops) {
+    std::vector<u8> image = Header(width, height);
+    image.insert(image.end(), ops.begin(), ops.end());
+    image.insert(image.end(), END_MARKER.begin(), END_MARKER.end());
+    return image;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Qoi: Runs of the previous pixel", "[common]") {
+    // Black matches the initial previous pixel, alpha is ignored
+    const std::vector<u8> pixels(3 * 4, 0);
+    REQUIRE(EncodeBgra8(pixels, 3, 1, false) == Image(3, 1, {0xc2}));
+}
+
+TEST_CASE("Qoi: Differences and literals", "[common]") {
+    const std::vector<u8> pixels{
+        0,   0,  1,   0xff, // Small difference
+        9,   10, 11,  0xff, // Luma difference
+        200, 10, 100, 0xff, // Literal
+        0,   0,  1,   0xff, // Seen before
+    };
+    const u8 index = (1 * 3 + 255 * 11) % 64;
+    REQUIRE(EncodeBgra8(pixels, 4, 1, false) ==
+            Image(4, 1, {0x7a, 0x80 + 32 + 10, 8 << 4 | (8 - 1), 0xfe, 100, 10, 200, index}));
+}
+
+TEST_CASE("Qoi: Black is not in the initial index", "[common]") {
+    const std::vector<u8> pixels{
+        0, 0, 0xff, 0xff, // Red
+        0, 0, 0,    0xff, // Black, its index entry starts as transparent black
+    };
+    REQUIRE(EncodeBgra8(pixels, 2, 1, false) == Image(2, 1, {0x5a, 0x7a}));
+}
+
+} // namespace Common::Qoi
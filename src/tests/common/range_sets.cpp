@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <boost/icl/interval_set.hpp>
+#include <boost/icl/split_interval_map.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "common/range_sets.h"
+#include "common/range_sets.inc"
+
+namespace {
+using namespace Common::Literals;
+
+using Range = std::tuple<u64, u64>;
+using Segment = std::tuple<u64, u64, s32>;
+
+/// The boost::icl containers the range sets used to be built on
+using IclRangeSet = boost::icl::interval_set<u64>;
+using IclOverlapRangeSet =
+    boost::icl::split_interval_map<u64, s32, boost::icl::partial_enricher, std::less,
+                                   boost::icl::inplace_plus, boost::icl::inter_section>;
+using IclInterval = boost::icl::discrete_interval<u64>;
+
+IclInterval MakeInterval(u64 addr, u64 size) {
+    return IclInterval::right_open(addr, addr + size);
+}
+
+/// Subtracts from an icl overlap set the way OverlapRangeSet did, reporting the removed segments
+template <typename Func>
+void IclSubtract(IclOverlapRangeSet& set, u64 addr, u64 size, s32 amount, Func&& on_delete) {
+    if (set.empty()) {
+        return;
+    }
+    const IclInterval interval = MakeInterval(addr, size);
+    set += std::make_pair(interval, -amount);
+    bool any_removals;
+    do {
+        any_removals = false;
+        auto it = set.lower_bound(interval);
+        const auto end_it = set.upper_bound(interval);
+        for (; it != set.end() && it != end_it; ++it) {
+            if (it->second <= 0) {
+                if (it->second == 0) {
+                    on_delete(it->first.lower(), it->first.upper());
+                }
+                any_removals = true;
+                set.erase(it);
+                break;
+            }
+        }
+    } while (any_removals);
+}
+
+std::vector<Range> Ranges(const Common::RangeSet<u64>& set) {
+    std::vector<Range> ranges;
+    set.ForEach([&](u64 begin, u64 end) { ranges.emplace_back(begin, end); });
+    return ranges;
+}
+
+std::vector<Range> Ranges(const IclRangeSet& set) {
+    std::vector<Range> ranges;
+    for (const auto& interval : set) {
+        ranges.emplace_back(interval.lower(), interval.upper());
+    }
+    return ranges;
+}
+
+std::vector<Segment> Segments(const Common::OverlapRangeSet<u64>& set) {
+    std::vector<Segment> segments;
+    set.ForEach([&](u64 begin, u64 end, s32 count) { segments.emplace_back(begin, end, count); });
+    return segments;
+}
+
+std::vector<Segment> Segments(const IclOverlapRangeSet& set) {
+    std::vector<Segment> segments;
+    for (const auto& [interval, count] : set) {
+        segments.emplace_back(interval.lower(), interval.upper(), count);
+    }
+    return segments;
+}
+} // Anonymous namespace
+
+TEST_CASE("RangeSet: Join", "[common]") {
+    Common::RangeSet<u64> set;
+    set.Add(0x1000, 0x1000);
+    set.Add(0x3000, 0x1000);
+    set.Add(0x2000, 0x1000);
+    REQUIRE(Ranges(set) == std::vector<Range>{{0x1000, 0x4000}});
+
+    set.Subtract(0x1800, 0x1000);
+    REQUIRE(Ranges(set) == std::vector<Range>{{0x1000, 0x1800}, {0x2800, 0x4000}});
+
+    std::vector<Range> clipped;
+    set.ForEachInRange(0x1400, 0x2000, [&](u64 begin, u64 end) {
+        clipped.emplace_back(begin, end);
+    });
+    REQUIRE(clipped == std::vector<Range>{{0x1400, 0x1800}, {0x2800, 0x3400}});
+
+    set.Clear();
+    REQUIRE(set.Empty());
+}
+
+TEST_CASE("OverlapRangeSet: Split", "[common]") {
+    Common::OverlapRangeSet<u64> set;
+    set.Add(0, 10);
+    set.Add(5, 10);
+    REQUIRE(Segments(set) == std::vector<Segment>{{0, 5, 1}, {5, 10, 2}, {10, 15, 1}});
+
+    // Borders are kept between segments with the same count
+    std::vector<Range> deleted;
+    set.Subtract(5, 10, [&](u64 begin, u64 end) { deleted.emplace_back(begin, end); });
+    REQUIRE(Segments(set) == std::vector<Segment>{{0, 5, 1}, {5, 10, 1}});
+    REQUIRE(deleted == std::vector<Range>{{10, 15}});
+
+    set.DeleteAll(0, 7);
+    REQUIRE(Segments(set) == std::vector<Segment>{{7, 10, 1}});
+}
+
+TEST_CASE("RangeSet: Matches icl", "[common]") {
+    std::mt19937_64 rng{0x5eed};
+    std::uniform_int_distribution<u64> addr_dist{0, 0x400};
+    std::uniform_int_distribution<u64> size_dist{1, 0x80};
+    Common::RangeSet<u64> set;
+    IclRangeSet reference;
+    for (int i = 0; i < 4000; ++i) {
+        const u64 addr = addr_dist(rng);
+        const u64 size = size_dist(rng);
+        if (rng() % 3 == 0) {
+            set.Subtract(addr, size);
+            reference.subtract(MakeInterval(addr, size));
+        } else {
+            set.Add(addr, size);
+            reference.add(MakeInterval(addr, size));
+        }
+        REQUIRE(Ranges(set) == Ranges(reference));
+
+        std::vector<Range> in_range;
+        set.ForEachInRange(addr, size, [&](u64 begin, u64 end) { in_range.emplace_back(begin, end); });
+        std::vector<Range> reference_in_range;
+        for (const auto& interval : reference & MakeInterval(addr, size)) {
+            reference_in_range.emplace_back(interval.lower(), interval.upper());
+        }
+        REQUIRE(in_range == reference_in_range);
+    }
+}
+
+TEST_CASE("OverlapRangeSet: Matches icl", "[common]") {
+    std::mt19937_64 rng{0xfeed};
+    std::uniform_int_distribution<u64> addr_dist{0, 0x400};
+    std::uniform_int_distribution<u64> size_dist{1, 0x80};
+    Common::OverlapRangeSet<u64> set;
+    IclOverlapRangeSet reference;
+    for (int i = 0; i < 4000; ++i) {
+        const u64 addr = addr_dist(rng);
+        const u64 size = size_dist(rng);
+        std::vector<Range> deleted;
+        std::vector<Range> reference_deleted;
+        switch (rng() % 8) {
+        case 0:
+            set.DeleteAll(addr, size);
+            IclSubtract(reference, addr, size, (std::numeric_limits<s32>::max)(),
+                        [](u64, u64) {});
+            break;
+        case 1:
+        case 2:
+            set.Subtract(addr, size, [&](u64 begin, u64 end) { deleted.emplace_back(begin, end); });
+            IclSubtract(reference, addr, size, 1,
+                        [&](u64 begin, u64 end) { reference_deleted.emplace_back(begin, end); });
+            break;
+        default:
+            set.Add(addr, size);
+            reference += std::make_pair(MakeInterval(addr, size), 1);
+            break;
+        }
+        REQUIRE(Segments(set) == Segments(reference));
+        REQUIRE(deleted == reference_deleted);
+    }
+}
+
+TEST_CASE("RangeSet: Benchmark", "[common][!benchmark][.]") {
+    // Buffer cache like traffic, small ranges over a few MiB uploaded and downloaded again
+    std::mt19937_64 rng{0xbe7c};
+    std::uniform_int_distribution<u64> addr_dist{0, 4_MiB};
+    std::uniform_int_distribution<u64> size_dist{0x100, 0x4000};
+    std::vector<std::pair<u64, u64>> ranges(1024);
+    for (auto& [addr, size] : ranges) {
+        addr = addr_dist(rng) & ~u64{0xff};
+        size = size_dist(rng) & ~u64{0xff};
+    }
+    BENCHMARK("RangeSet add and iterate") {
+        Common::RangeSet<u64> set;
+        for (const auto& [addr, size] : ranges) {
+            set.Add(addr, size);
+        }
+        u64 total = 0;
+        set.ForEach([&](u64 begin, u64 end) { total += end - begin; });
+        return total;
+    };
+    BENCHMARK("icl::interval_set add and iterate") {
+        IclRangeSet set;
+        for (const auto& [addr, size] : ranges) {
+            set.add(MakeInterval(addr, size));
+        }
+        u64 total = 0;
+        for (const auto& interval : set) {
+            total += interval.upper() - interval.lower();
+        }
+        return total;
+    };
+    BENCHMARK("OverlapRangeSet add and subtract") {
+        Common::OverlapRangeSet<u64> set;
+        for (const auto& [addr, size] : ranges) {
+            set.Add(addr, size);
+        }
+        for (const auto& [addr, size] : ranges) {
+            set.Subtract(addr, size);
+        }
+        return set.Empty();
+    };
+    BENCHMARK("icl::split_interval_map add and subtract") {
+        IclOverlapRangeSet set;
+        for (const auto& [addr, size] : ranges) {
+            set += std::make_pair(MakeInterval(addr, size), 1);
+        }
+        for (const auto& [addr, size] : ranges) {
+            IclSubtract(set, addr, size, 1, [](u64, u64) {});
+        }
+        return set.empty();
+    };
+}
@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/settings.h"
+
+TEST_CASE("RuntimeSettingsSnapshot[Publish]", "[common]") {
+    const bool barrier_feedback_loops = Settings::values.barrier_feedback_loops.GetValue();
+    Settings::PublishRuntimeSnapshot();
+    const Settings::RuntimeSettingsSnapshot& before = Settings::RuntimeSnapshot();
+    REQUIRE(before.barrier_feedback_loops == barrier_feedback_loops);
+
+    // Nothing changed, nothing is published
+    Settings::PublishRuntimeSnapshot();
+    REQUIRE(&Settings::RuntimeSnapshot() == &before);
+
+    Settings::values.barrier_feedback_loops.SetValue(!barrier_feedback_loops);
+    REQUIRE(Settings::RuntimeSnapshot().barrier_feedback_loops == barrier_feedback_loops);
+    Settings::PublishRuntimeSnapshot();
+    REQUIRE(Settings::RuntimeSnapshot().barrier_feedback_loops == !barrier_feedback_loops);
+
+    // The previous snapshot is left as it was for the readers still holding it
+    REQUIRE(before.barrier_feedback_loops == barrier_feedback_loops);
+
+    // Going back to earlier settings reuses their snapshot
+    Settings::values.barrier_feedback_loops.SetValue(barrier_feedback_loops);
+    Settings::PublishRuntimeSnapshot();
+    REQUIRE(&Settings::RuntimeSnapshot() == &before);
+}
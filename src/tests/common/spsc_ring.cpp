@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <memory>
+#include <thread>
+#include <catch2/catch_test_macros.hpp>
+#include "common/spsc_ring.h"
+
+namespace Common {
+
+TEST_CASE("SPSCRing: Basic Tests", "[common]") {
+    SPSCRing<int, 4> ring;
+
+    REQUIRE(ring.Empty());
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(ring.TryEmplace(i));
+    }
+    REQUIRE(!ring.Empty());
+
+    // Pushing to a full ring fails without waiting.
+    REQUIRE(!ring.TryEmplace(4));
+
+    for (int i = 0; i < 4; ++i) {
+        int value = -1;
+        REQUIRE(ring.TryConsume([&value](int& v) { value = v; }));
+        REQUIRE(value == i);
+    }
+    REQUIRE(ring.Empty());
+    REQUIRE(!ring.TryConsume([](int&) {}));
+
+    // Wrapping around keeps the order.
+    for (int i = 0; i < 6; ++i) {
+        REQUIRE(ring.TryEmplace(i));
+        int value = -1;
+        REQUIRE(ring.TryConsume([&value](int& v) { value = v; }));
+        REQUIRE(value == i);
+    }
+}
+
+TEST_CASE("SPSCRing: Destroys pending elements", "[common]") {
+    const auto counter = std::make_shared<int>(0);
+    {
+        SPSCRing<std::shared_ptr<int>, 8> ring;
+        REQUIRE(ring.TryEmplace(counter));
+        REQUIRE(ring.TryEmplace(counter));
+        REQUIRE(counter.use_count() == 3);
+    }
+    REQUIRE(counter.use_count() == 1);
+}
+
+TEST_CASE("SPSCRing: Threaded Test", "[common]") {
+    constexpr size_t count = 100000;
+    SPSCRing<size_t, 64> ring;
+
+    std::jthread producer{[&ring] {
+        for (size_t i = 0; i < count; ++i) {
+            while (!ring.TryEmplace(i)) {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    // Elements must be consumed in the order they were pushed.
+    size_t next = 0;
+    while (next < count) {
+        if (!ring.TryConsume([&next](size_t& value) {
+                REQUIRE(value == next);
+                ++next;
+            })) {
+            std::this_thread::yield();
+        }
+    }
+    REQUIRE(ring.Empty());
+}
+
+} // namespace Common
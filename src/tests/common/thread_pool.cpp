@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/thread.h"
+#include "common/thread_pool.h"
+
+namespace Common {
+
+TEST_CASE("ThreadPool: Serial worker keeps the order", "[common]") {
+    ThreadPool pool{4, "TestPool"};
+    PooledWorker worker{pool, 1};
+    std::mutex order_mutex;
+    std::vector<int> order;
+    const auto record = [&](int value) {
+        return [&order_mutex, &order, value] {
+            std::scoped_lock lock{order_mutex};
+            order.push_back(value);
+        };
+    };
+
+    // Hold the worker so the rest of the work is queued before any of it runs.
+    Event started;
+    Event release;
+    worker.QueueWork([&] {
+        started.Set();
+        release.Wait();
+    });
+    started.Wait();
+
+    worker.QueueWork(record(4), WorkPriority::Low);
+    worker.QueueWork(record(2));
+    worker.QueueWork(record(0), WorkPriority::High);
+    worker.QueueWork(record(5), WorkPriority::Low);
+    worker.QueueWork(record(1), WorkPriority::High);
+    worker.QueueWork(record(3));
+    release.Set();
+    worker.WaitForRequests();
+
+    // Higher priorities run first, each priority runs in the order it was queued.
+    const std::vector<int> expected{0, 1, 2, 3, 4, 5};
+    REQUIRE(order == expected);
+}
+
+TEST_CASE("ThreadPool: Concurrency limit", "[common]") {
+    ThreadPool pool{4, "TestPool"};
+    PooledWorker worker{pool, 2};
+    std::atomic<int> running{};
+    std::atomic<int> max_running{};
+    std::atomic<int> done{};
+    for (int i = 0; i < 64; ++i) {
+        worker.QueueWork([&] {
+            const int now = ++running;
+            int max = max_running.load();
+            while (now > max && !max_running.compare_exchange_weak(max, now)) {
+            }
+            std::this_thread::yield();
+            --running;
+            ++done;
+        });
+    }
+    worker.WaitForRequests();
+    REQUIRE(done == 64);
+    REQUIRE(max_running <= 2);
+}
+
+TEST_CASE("ThreadPool: Waiting from a pool thread", "[common]") {
+    // A single thread pool only makes progress if waiting threads run the work themselves.
+    ThreadPool pool{1, "TestPool"};
+    PooledWorker outer{pool, 1};
+    PooledWorker inner{pool, 4};
+    std::atomic<int> done{};
+    outer.QueueWork([&] {
+        for (int i = 0; i < 16; ++i) {
+            inner.QueueWork([&done] { ++done; });
+        }
+        inner.WaitForRequests();
+        REQUIRE(done == 16);
+    });
+    outer.WaitForRequests();
+    REQUIRE(done == 16);
+}
+
+TEST_CASE("ThreadPool: Stopping drops pending work", "[common]") {
+    ThreadPool pool{1, "TestPool"};
+    PooledWorker worker{pool, 1};
+    Event started;
+    Event release;
+    std::atomic<int> done{};
+    worker.QueueWork([&] {
+        started.Set();
+        release.Wait();
+    });
+    started.Wait();
+    for (int i = 0; i < 8; ++i) {
+        worker.QueueWork([&done] { ++done; });
+    }
+
+    // Stopping happens as soon as the wait starts, the blocked work is released later.
+    std::stop_source stop_source;
+    stop_source.request_stop();
+    std::jthread releaser{[&release] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        release.Set();
+    }};
+    worker.WaitForRequests(stop_source.get_token());
+    REQUIRE(done == 0);
+
+    worker.QueueWork([&done] { ++done; });
+    worker.WaitForRequests();
+    REQUIRE(done == 0);
+}
+
+} // namespace Common
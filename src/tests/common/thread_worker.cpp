@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "common/thread.h"
+#include "common/thread_worker.h"
+
+namespace Common {
+
+TEST_CASE("ThreadWorker: Priority order", "[common]") {
+    ThreadWorker worker{1, "TestWorker"};
+    std::mutex order_mutex;
+    std::vector<int> order;
+    const auto record = [&](int value) {
+        return [&order_mutex, &order, value] {
+            std::scoped_lock lock{order_mutex};
+            order.push_back(value);
+        };
+    };
+
+    // Hold the worker so the rest of the work is queued before any of it runs.
+    Event started;
+    Event release;
+    worker.QueueWork([&] {
+        started.Set();
+        release.Wait();
+    });
+    started.Wait();
+
+    worker.QueueWork(record(4), WorkPriority::Low);
+    worker.QueueWork(record(2));
+    worker.QueueWork(record(0), WorkPriority::High);
+    worker.QueueWork(record(5), WorkPriority::Low);
+    worker.QueueWork(record(1), WorkPriority::High);
+    worker.QueueWork(record(3));
+    release.Set();
+    worker.WaitForRequests();
+
+    // Higher priorities run first, each priority runs in the order it was queued.
+    const std::vector<int> expected{0, 1, 2, 3, 4, 5};
+    REQUIRE(order == expected);
+}
+
+TEST_CASE("ThreadWorker: Core type", "[common]") {
+    // Pinning degrades to no pinning on processors with a single kind of core.
+    ThreadWorker worker{2, "TestWorker", {}, CoreType::Efficiency};
+    std::atomic<int> done{};
+    for (int i = 0; i < 8; ++i) {
+        worker.QueueWork([&done] { ++done; });
+    }
+    worker.WaitForRequests();
+    REQUIRE(done == 8);
+
+    SetCurrentThreadCoreType(CoreType::Performance);
+    SetCurrentThreadCoreType(CoreType::Any);
+}
+
+} // namespace Common
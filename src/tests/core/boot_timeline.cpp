@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+
+#include "core/boot_timeline.h"
+
+using Core::BootTimeline;
+
+TEST_CASE("BootTimeline: Stages", "[core]") {
+    BootTimeline timeline;
+    timeline.Begin();
+    {
+        const auto outer = timeline.MeasureStage("Outer");
+        std::thread worker([&] { const auto inner = timeline.MeasureStage("Worker"); });
+        worker.join();
+    }
+    const auto stages = timeline.GetStages();
+    REQUIRE(stages.size() == 2);
+    REQUIRE(stages[0].name == "Worker");
+    REQUIRE(stages[1].name == "Outer");
+    REQUIRE(stages[1].begin <= stages[0].begin);
+    REQUIRE(stages[0].end <= stages[1].end);
+}
+
+TEST_CASE("BootTimeline: First frame", "[core]") {
+    BootTimeline timeline;
+    REQUIRE(!timeline.MarkFirstFrame());
+
+    timeline.Begin();
+    REQUIRE(timeline.MarkFirstFrame());
+    REQUIRE(!timeline.MarkFirstFrame());
+
+    // A new boot discards the previous stages
+    {
+        const auto stage = timeline.MeasureStage("Stage");
+    }
+    timeline.Begin();
+    REQUIRE(timeline.GetStages().empty());
+    REQUIRE(timeline.MarkFirstFrame());
+}
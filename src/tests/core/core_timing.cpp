@@ -4,6 +4,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <atomic>
 #include <bitset>
 #include <chrono>
 #include <cstdlib>
@@ -11,6 +12,7 @@
 #include <optional>
 #include <string>
 
+#include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
@@ -139,3 +141,50 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[Batching]", "[core]") {
+    Settings::values.core_timing_batching.SetValue(true);
+    Settings::values.core_timing_slack.SetValue(1000);
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events{
+        Core::Timing::CreateEvent("callbackA", HostCallbackTemplate<0>),
+        Core::Timing::CreateEvent("callbackB", HostCallbackTemplate<1>),
+        Core::Timing::CreateEvent("callbackC", HostCallbackTemplate<2>),
+        Core::Timing::CreateEvent("callbackD", HostCallbackTemplate<3>),
+        Core::Timing::CreateEvent("callbackE", HostCallbackTemplate<4>),
+    };
+    std::atomic<u64> looping_calls{};
+    const auto looping_event = Core::Timing::CreateEvent(
+        "looping", [&looping_calls](s64, std::chrono::nanoseconds) {
+            ++looping_calls;
+            return std::optional<std::chrono::nanoseconds>{};
+        });
+
+    core_timing.SyncPause(true);
+    core_timing.SyncPause(false);
+
+    callbacks_ran_flags.reset();
+    expected_callback = 0;
+
+    // Events within the slack window of each other are all run.
+    for (std::size_t i = 0; i < events.size(); i++) {
+        core_timing.ScheduleEvent(std::chrono::nanoseconds{static_cast<s64>(i * 100 + 100)},
+                                  events[calls_order[i]]);
+    }
+    while (core_timing.HasPendingEvents())
+        ;
+    REQUIRE(callbacks_ran_flags.all());
+
+    core_timing.ScheduleLoopingEvent(std::chrono::microseconds{10}, std::chrono::microseconds{10},
+                                     looping_event);
+    while (looping_calls < 10)
+        ;
+    const auto statistics = core_timing.GetEventStatistics();
+    REQUIRE(statistics.size() == 1);
+    REQUIRE(statistics[0].name == "looping");
+    REQUIRE(statistics[0].call_count >= 10);
+
+    core_timing.UnscheduleEvent(looping_event);
+    Settings::values.core_timing_batching.SetValue(false);
+}
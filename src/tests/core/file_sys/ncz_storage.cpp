@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/zstd_compression.h"
+#include "core/crypto/ctr_encryption_layer.h"
+#include "core/file_sys/fssystem/fssystem_ncz_storage.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+using namespace FileSys;
+
+constexpr u8 BlockSizeExponent = 14;
+constexpr size_t BlockSize = size_t{1} << BlockSizeExponent;
+constexpr size_t HeaderSize = NczStorage::HeaderSize;
+
+constexpr u64 EncryptedOffset = HeaderSize + BlockSize;
+constexpr u64 EncryptedSize = 2 * BlockSize;
+constexpr std::array<u8, 0x10> Key{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                   0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+constexpr std::array<u8, 0x10> Counter{0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08};
+
+template <typename T>
+void Append(std::vector<u8>& out, const T& value) {
+    const auto* const bytes = reinterpret_cast<const u8*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void AppendSection(std::vector<u8>& out, u64 offset, u64 size, u64 crypto_type) {
+    Append(out, offset);
+    Append(out, size);
+    Append(out, crypto_type);
+    Append(out, u64{0});
+    Append(out, Key);
+    Append(out, Counter);
+}
+
+/// Returns the decrypted body of an NCA, its blocks alternate between compressible and random
+std::vector<u8> MakeBody(size_t size) {
+    std::vector<u8> body(size);
+    u32 state = 0x12345678;
+    for (size_t i = 0; i < size; ++i) {
+        state = state * 1664525 + 1013904223;
+        body[i] = (i / BlockSize) % 2 == 0 ? static_cast<u8>(i / 64) : static_cast<u8>(state >> 24);
+    }
+    return body;
+}
+
+std::vector<u8> MakeNcz(const std::vector<u8>& header, const std::vector<u8>& body) {
+    std::vector<u8> ncz = header;
+    ncz.insert(ncz.end(), {'N', 'C', 'Z', 'S', 'E', 'C', 'T', 'N'});
+    Append(ncz, u64{2});
+    AppendSection(ncz, HeaderSize, EncryptedOffset - HeaderSize, 1);
+    AppendSection(ncz, EncryptedOffset, EncryptedSize, 3);
+
+    const u32 block_count = static_cast<u32>((body.size() + BlockSize - 1) / BlockSize);
+    ncz.insert(ncz.end(), {'N', 'C', 'Z', 'B', 'L', 'O', 'C', 'K', 2, 1, 0, BlockSizeExponent});
+    Append(ncz, block_count);
+    Append(ncz, u64{body.size()});
+
+    std::vector<std::vector<u8>> blocks;
+    for (size_t offset = 0; offset < body.size(); offset += BlockSize) {
+        const size_t size = std::min(BlockSize, body.size() - offset);
+        auto block = Common::Compression::CompressDataZSTDDefault(body.data() + offset, size);
+        if (block.size() >= size) {
+            block.assign(body.begin() + offset, body.begin() + offset + size);
+        }
+        Append(ncz, static_cast<u32>(block.size()));
+        blocks.push_back(std::move(block));
+    }
+    for (const auto& block : blocks) {
+        ncz.insert(ncz.end(), block.begin(), block.end());
+    }
+    return ncz;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("NczStorage: Reads the NCA it was made from", "[core]") {
+    std::vector<u8> header(HeaderSize);
+    for (size_t i = 0; i < header.size(); ++i) {
+        header[i] = static_cast<u8>(i * 7);
+    }
+    const std::vector<u8> body = MakeBody(5 * BlockSize + 0x1230);
+    auto file = std::make_shared<VectorVfsFile>(MakeNcz(header, body), "test.ncz");
+    const auto storage = NczStorage::Open(file, "test.nca");
+    REQUIRE(storage != nullptr);
+    REQUIRE(storage->GetName() == "test.nca");
+    REQUIRE(storage->GetSize() == HeaderSize + body.size());
+
+    // Unencrypted ranges read back as is, across the header and blocks of either kind
+    std::vector<u8> data(storage->GetSize());
+    REQUIRE(storage->Read(data.data(), data.size(), 0) == data.size());
+    REQUIRE(std::memcmp(data.data(), header.data(), header.size()) == 0);
+    REQUIRE(std::memcmp(data.data() + HeaderSize, body.data(), EncryptedOffset - HeaderSize) == 0);
+    const size_t tail = EncryptedOffset + EncryptedSize;
+    REQUIRE(std::memcmp(data.data() + tail, body.data() + (tail - HeaderSize),
+                        data.size() - tail) == 0);
+
+    // The encrypted section decrypts to the body with the key and counter of the section
+    Core::Crypto::CTREncryptionLayer layer(storage, Key, 0);
+    layer.SetIV(Counter);
+    std::vector<u8> decrypted(EncryptedSize);
+    REQUIRE(layer.Read(decrypted.data(), decrypted.size(), EncryptedOffset) == EncryptedSize);
+    REQUIRE(std::memcmp(decrypted.data(), body.data() + (EncryptedOffset - HeaderSize),
+                        EncryptedSize) == 0);
+
+    // Unaligned reads, spanning blocks or not, match the whole read
+    for (const auto [offset, size] : std::array<std::pair<size_t, size_t>, 4>{{
+             {HeaderSize - 5, 10},
+             {HeaderSize + BlockSize - 3, 2 * BlockSize + 7},
+             {tail + 0x100, 0x80},
+             {data.size() - 0x10, 0x100},
+         }}) {
+        std::vector<u8> part(size);
+        const size_t expected = std::min(size, data.size() - offset);
+        REQUIRE(storage->Read(part.data(), size, offset) == expected);
+        REQUIRE(std::memcmp(part.data(), data.data() + offset, expected) == 0);
+    }
+}
+
+TEST_CASE("NczStorage: Rejects solid and invalid files", "[core]") {
+    std::vector<u8> solid(HeaderSize);
+    solid.insert(solid.end(), {'N', 'C', 'Z', 'S', 'E', 'C', 'T', 'N'});
+    Append(solid, u64{0});
+    solid.resize(solid.size() + 0x100, 0x28);
+    REQUIRE(NczStorage::Open(std::make_shared<VectorVfsFile>(solid), "solid.nca") == nullptr);
+
+    const std::vector<u8> nca(HeaderSize + 0x100);
+    REQUIRE(NczStorage::Open(std::make_shared<VectorVfsFile>(nca), "plain.nca") == nullptr);
+}
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/file_sys/vfs/vfs_concat.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+using namespace FileSys;
+
+std::vector<u8> MakeData(size_t size, u8 seed) {
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<u8>(seed + i * 7);
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ConcatenatedVfsFile: Reads across parts", "[core]") {
+    std::vector<u8> expected;
+    std::vector<VirtualFile> parts;
+    for (const size_t size : {0x100, 0, 0x33, 0x1000, 1, 0x200}) {
+        std::vector<u8> data = MakeData(size, static_cast<u8>(parts.size()));
+        expected.insert(expected.end(), data.begin(), data.end());
+        parts.push_back(std::make_shared<VectorVfsFile>(std::move(data)));
+    }
+    const VirtualFile file =
+        ConcatenatedVfsFile::MakeConcatenatedFile("split.nsp", std::move(parts));
+    REQUIRE(file->GetName() == "split.nsp");
+    REQUIRE(file->GetSize() == expected.size());
+
+    for (size_t offset = 0; offset <= expected.size(); offset += 0x31) {
+        for (const size_t size : {size_t{1}, size_t{0x40}, size_t{0x1100}}) {
+            std::vector<u8> data(size);
+            const size_t count = std::min(size, expected.size() - offset);
+            REQUIRE(file->Read(data.data(), size, offset) == count);
+            REQUIRE(std::memcmp(data.data(), expected.data() + offset, count) == 0);
+        }
+    }
+
+    u8 byte{};
+    REQUIRE(file->Read(&byte, 1, expected.size()) == 0);
+    REQUIRE(file->Read(&byte, 1, expected.size() + 0x10) == 0);
+}
+
+TEST_CASE("ConcatenatedVfsFile: Fills gaps between parts", "[core]") {
+    std::vector<std::pair<u64, VirtualFile>> parts;
+    parts.emplace_back(0x10, std::make_shared<VectorVfsFile>(MakeData(0x10, 1)));
+    parts.emplace_back(0x40, std::make_shared<VectorVfsFile>());
+    parts.emplace_back(0x40, std::make_shared<VectorVfsFile>(MakeData(0x8, 2)));
+    const VirtualFile file =
+        ConcatenatedVfsFile::MakeConcatenatedFile(0xAB, "romfs", std::move(parts));
+    REQUIRE(file->GetSize() == 0x48);
+
+    std::vector<u8> data(0x48);
+    REQUIRE(file->Read(data.data(), data.size(), 0) == data.size());
+    std::vector<u8> expected(0x48, 0xAB);
+    const auto first = MakeData(0x10, 1);
+    const auto second = MakeData(0x8, 2);
+    std::memcpy(expected.data() + 0x10, first.data(), first.size());
+    std::memcpy(expected.data() + 0x40, second.data(), second.size());
+    REQUIRE(data == expected);
+}
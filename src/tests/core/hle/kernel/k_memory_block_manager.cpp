@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/hle/kernel/k_dynamic_page_manager.h"
+#include "core/hle/kernel/k_dynamic_resource_manager.h"
+#include "core/hle/kernel/k_memory_block_manager.h"
+
+namespace {
+
+using namespace Kernel;
+
+constexpr u64 ManagerAddress = 0x10000000;
+constexpr size_t ManagerPages = 512;
+
+struct PageState {
+    KMemoryState state;
+    KMemoryPermission perm;
+    KMemoryAttribute attr;
+};
+
+constexpr std::array States{KMemoryState::Free, KMemoryState::Normal, KMemoryState::Code,
+                            KMemoryState::Stack};
+constexpr std::array Permissions{KMemoryPermission::None, KMemoryPermission::UserRead,
+                                 KMemoryPermission::UserReadWrite};
+
+class Fixture {
+public:
+    Fixture() {
+        REQUIRE(page_manager.Initialize(KVirtualAddress{0x80000000}, 64 * PageSize, PageSize) ==
+                ResultSuccess);
+        slab_heap.Initialize(&page_manager, 0);
+        slab_manager.Initialize(&page_manager, &slab_heap);
+        REQUIRE(manager.Initialize(KProcessAddress{ManagerAddress},
+                                   KProcessAddress{ManagerAddress + ManagerPages * PageSize},
+                                   &slab_manager) == ResultSuccess);
+    }
+
+    ~Fixture() {
+        manager.Finalize(&slab_manager, [](Common::ProcessAddress, u64) {});
+    }
+
+    KDynamicPageManager page_manager;
+    KMemoryBlockSlabHeap slab_heap;
+    KMemoryBlockSlabManager slab_manager;
+    KMemoryBlockManager manager;
+};
+
+/// Checks every page against the model, in address order and then out of order.
+void CheckModel(const KMemoryBlockManager& manager, const std::vector<PageState>& model,
+                std::mt19937& rng) {
+    REQUIRE(manager.CheckState());
+    const auto check_page = [&](size_t page) {
+        const KProcessAddress address{ManagerAddress + page * PageSize};
+        const KMemoryBlock* const block = manager.FindBlock(address);
+        REQUIRE(block != nullptr);
+        REQUIRE(block->GetAddress() <= address);
+        REQUIRE(address < block->GetEndAddress());
+        REQUIRE(block->GetState() == model[page].state);
+        REQUIRE(block->GetPermission() == model[page].perm);
+        REQUIRE(block->GetAttribute() == model[page].attr);
+    };
+    for (size_t page = 0; page < ManagerPages; ++page) {
+        check_page(page);
+    }
+    std::uniform_int_distribution<size_t> page_dist(0, ManagerPages - 1);
+    for (size_t i = 0; i < 64; ++i) {
+        check_page(page_dist(rng));
+    }
+    REQUIRE(manager.FindBlock(KProcessAddress{ManagerAddress + ManagerPages * PageSize}) ==
+            nullptr);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("KMemoryBlockManager: Randomized updates match a page model", "[core]") {
+    Fixture fixture;
+    auto& manager = fixture.manager;
+    constexpr PageState free_page{KMemoryState::Free, KMemoryPermission::None,
+                                  KMemoryAttribute::None};
+    std::vector<PageState> model(ManagerPages, free_page);
+    std::mt19937 rng{0x6b6d626d};
+    std::uniform_int_distribution<size_t> page_dist(0, ManagerPages - 1);
+    std::uniform_int_distribution<size_t> state_dist(0, States.size() - 1);
+    std::uniform_int_distribution<size_t> perm_dist(0, Permissions.size() - 1);
+    std::uniform_int_distribution<int> attr_dist(0, 3);
+
+    CheckModel(manager, model, rng);
+    for (size_t iteration = 0; iteration < 2000; ++iteration) {
+        const size_t first = page_dist(rng);
+        const size_t num_pages =
+            std::uniform_int_distribution<size_t>(1, ManagerPages - first)(rng);
+        // Like the page table, only update ranges whose first page changes properties.
+        PageState new_state;
+        do {
+            new_state = PageState{
+                .state = States[state_dist(rng)],
+                .perm = Permissions[perm_dist(rng)],
+                .attr = attr_dist(rng) == 0 ? KMemoryAttribute::Uncached : KMemoryAttribute::None,
+            };
+        } while (new_state.state == model[first].state && new_state.perm == model[first].perm &&
+                 new_state.attr == model[first].attr);
+
+        Result result = ResultSuccess;
+        KMemoryBlockManagerUpdateAllocator allocator(&result, &fixture.slab_manager);
+        REQUIRE(result == ResultSuccess);
+        manager.Update(&allocator, KProcessAddress{ManagerAddress + first * PageSize}, num_pages,
+                       new_state.state, new_state.perm, new_state.attr,
+                       KMemoryBlockDisableMergeAttribute::None,
+                       KMemoryBlockDisableMergeAttribute::None);
+        std::fill_n(model.begin() + first, num_pages, new_state);
+
+        if (iteration % 100 == 0) {
+            CheckModel(manager, model, rng);
+        }
+    }
+    CheckModel(manager, model, rng);
+}
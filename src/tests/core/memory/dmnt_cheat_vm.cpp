@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "core/memory/dmnt_cheat_vm.h"
+
+namespace Core::Memory {
+namespace {
+
+class TestCallbacks final : public DmntCheatVm::Callbacks {
+public:
+    explicit TestCallbacks(std::array<u8, 0x400>& memory_) : memory{memory_} {}
+
+    void MemoryReadUnsafe(VAddr address, void* data, u64 size) override {
+        std::memcpy(data, memory.data() + address, size);
+    }
+    void MemoryWriteUnsafe(VAddr address, const void* data, u64 size) override {
+        std::memcpy(memory.data() + address, data, size);
+    }
+    u64 HidKeysDown() override {
+        return 0;
+    }
+    void PauseProcess() override {}
+    void ResumeProcess() override {}
+    void DebugLog(u8 id, u64 value) override {}
+    void CommandLog(std::string_view data) override {}
+    bool IsCommandLogEnabled() const override {
+        return false;
+    }
+
+private:
+    std::array<u8, 0x400>& memory;
+};
+
+u32 ReadU32(const std::array<u8, 0x400>& memory, std::size_t offset) {
+    u32 value;
+    std::memcpy(&value, memory.data() + offset, sizeof(value));
+    return value;
+}
+
+void RunProgram(std::array<u8, 0x400>& memory, const std::vector<u32>& opcodes) {
+    std::vector<CheatEntry> cheats(1);
+    cheats[0].enabled = true;
+    cheats[0].definition.num_opcodes = static_cast<u32>(opcodes.size());
+    std::copy(opcodes.begin(), opcodes.end(), cheats[0].definition.opcodes.begin());
+
+    DmntCheatVm vm{std::make_unique<TestCallbacks>(memory)};
+    REQUIRE(vm.LoadProgram(cheats));
+    vm.Execute(CheatProcessMetadata{});
+}
+
+} // Anonymous namespace
+
+TEST_CASE("DmntCheatVm: Nested conditional blocks", "[core]") {
+    const std::vector<u32> program{
+        0x14050000, 0x00000100, 0x00000001, // if u32 [0x100] == 1
+        0x04000000, 0x00000200, 0x0000000A, //   u32 [0x200] = 0xA
+        0x21000000,                         // else
+        0x14050000, 0x00000104, 0x00000000, //   if u32 [0x104] == 0
+        0x04000000, 0x00000208, 0x0000000D, //     u32 [0x208] = 0xD
+        0x20000000,                         //   end
+        0x04000000, 0x00000200, 0x0000000B, //   u32 [0x200] = 0xB
+        0x20000000,                         // end
+        0x04000000, 0x00000204, 0x0000000C, // u32 [0x204] = 0xC
+    };
+
+    std::array<u8, 0x400> memory{};
+    memory[0x100] = 1;
+    RunProgram(memory, program);
+    REQUIRE(ReadU32(memory, 0x200) == 0xA);
+    REQUIRE(ReadU32(memory, 0x204) == 0xC);
+    REQUIRE(ReadU32(memory, 0x208) == 0);
+
+    memory = {};
+    RunProgram(memory, program);
+    REQUIRE(ReadU32(memory, 0x200) == 0xB);
+    REQUIRE(ReadU32(memory, 0x204) == 0xC);
+    REQUIRE(ReadU32(memory, 0x208) == 0xD);
+}
+
+TEST_CASE("DmntCheatVm: Loops", "[core]") {
+    std::array<u8, 0x400> memory{};
+    RunProgram(memory, {
+                           0x40030000, 0x00000000, 0x00000300, // r3 = 0x300
+                           0x30100000, 0x00000003,             // loop r1 = 3
+                           0x78020000, 0x00000002,             //   r2 += 2
+                           0x31100000,                         // end loop r1
+                           0xA4230000,                         // u32 [r3] = r2
+                       });
+    REQUIRE(ReadU32(memory, 0x300) == 6);
+}
+
+TEST_CASE("DmntCheatVm: Stops at invalid opcodes", "[core]") {
+    std::array<u8, 0x400> memory{};
+    RunProgram(memory, {
+                           0x04000000, 0x00000200, 0x0000000A, // u32 [0x200] = 0xA
+                           0xC4000000,                         // invalid opcode
+                           0x04000000, 0x00000204, 0x0000000C, // u32 [0x204] = 0xC
+                       });
+    REQUIRE(ReadU32(memory, 0x200) == 0xA);
+    REQUIRE(ReadU32(memory, 0x204) == 0);
+}
+
+} // namespace Core::Memory
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+
+#include "core/perf_stats.h"
+
+using Core::FrameTimeHistogram;
+
+namespace {
+bool IsNear(double value, double expected) {
+    return std::abs(value - expected) < 1e-9;
+}
+} // Anonymous namespace
+
+TEST_CASE("FrameTimeHistogram: Empty", "[core]") {
+    const FrameTimeHistogram histogram;
+    REQUIRE(histogram.Count() == 0);
+    REQUIRE(histogram.Percentile(0.5) == 0.0);
+}
+
+TEST_CASE("FrameTimeHistogram: Percentiles", "[core]") {
+    FrameTimeHistogram histogram;
+    for (int i = 0; i < 99; ++i) {
+        histogram.Add(1.0 / 60);
+    }
+    histogram.Add(0.050);
+    REQUIRE(histogram.Count() == 100);
+
+    // Percentiles are rounded up to the end of their bucket
+    REQUIRE(IsNear(histogram.Percentile(0.50), 0.0170));
+    REQUIRE(IsNear(histogram.Percentile(0.99), 0.0170));
+    REQUIRE(IsNear(histogram.Percentile(1.00), 0.050));
+}
+
+TEST_CASE("FrameTimeHistogram: Overflow", "[core]") {
+    FrameTimeHistogram histogram;
+    histogram.Add(0.010);
+    histogram.Add(0.250);
+    REQUIRE(histogram.Buckets().back() == 1);
+    REQUIRE(IsNear(histogram.Percentile(1.0), 0.250));
+
+    histogram.Reset();
+    REQUIRE(histogram.Count() == 0);
+    REQUIRE(histogram.Buckets().back() == 0);
+}
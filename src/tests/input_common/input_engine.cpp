@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <chrono>
+#include <catch2/catch_test_macros.hpp>
+#include "input_common/input_engine.h"
+
+namespace InputCommon {
+
+namespace {
+class TestEngine final : public InputEngine {
+public:
+    TestEngine() : InputEngine("test") {}
+
+    using InputEngine::RecordReportInterval;
+};
+} // Anonymous namespace
+
+TEST_CASE("InputEngine: Report interval histogram", "[input_common]") {
+    using std::chrono::microseconds;
+    TestEngine engine;
+    engine.RecordReportInterval(microseconds{500});
+    engine.RecordReportInterval(microseconds{1000});
+    engine.RecordReportInterval(microseconds{7999});
+    engine.RecordReportInterval(microseconds{8000});
+    engine.RecordReportInterval(microseconds{31999});
+    engine.RecordReportInterval(microseconds{32000});
+    engine.RecordReportInterval(microseconds{1000000});
+
+    const auto histogram = engine.GetAndResetReportIntervals();
+    const ReportIntervalHistogram expected{.counts = {1, 1, 0, 1, 1, 1, 2}};
+    REQUIRE(histogram.counts == expected.counts);
+    REQUIRE(engine.GetAndResetReportIntervals().counts == ReportIntervalHistogram{}.counts);
+}
+
+} // namespace InputCommon
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <optional>
+#include <random>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "shader_recompiler/frontend/maxwell/decode.h"
+#include "shader_recompiler/frontend/maxwell/opcodes.h"
+
+namespace {
+using Shader::Maxwell::Opcode;
+
+struct Encoding {
+    u64 mask;
+    u64 value;
+    Opcode opcode;
+};
+
+constexpr Encoding MakeEncoding(const char* data, Opcode opcode) {
+    u64 mask = 0, value = 0, bit = u64(1) << 63;
+    for (; *data != '\0'; ++data) {
+        if (*data == ' ') {
+            continue;
+        }
+        if (*data != '-') {
+            mask |= bit;
+        }
+        if (*data == '1') {
+            value |= bit;
+        }
+        bit >>= 1;
+    }
+    return {mask, value, opcode};
+}
+
+constexpr std::array ENCODINGS{
+#define INST(name, cute, encode) MakeEncoding(encode, Opcode::name),
+#include "shader_recompiler/frontend/maxwell/maxwell.inc"
+#undef INST
+};
+
+/// Reference decoder that tries every encoding in order
+std::optional<Opcode> LinearDecode(u64 insn) {
+    for (const Encoding& encoding : ENCODINGS) {
+        if ((insn & encoding.mask) == encoding.value) {
+            return encoding.opcode;
+        }
+    }
+    return std::nullopt;
+}
+} // Anonymous namespace
+
+TEST_CASE("Maxwell Decode: Matches a linear search", "[shader_recompiler]") {
+    std::mt19937_64 random{0x6d617877656c6cULL};
+    for (const Encoding& encoding : ENCODINGS) {
+        for (int i = 0; i < 64; ++i) {
+            const u64 insn = encoding.value | (random() & ~encoding.mask);
+            const std::optional<Opcode> expected = LinearDecode(insn);
+            REQUIRE(expected.has_value());
+            REQUIRE(Shader::Maxwell::Decode(insn) == *expected);
+        }
+    }
+}
+
+TEST_CASE("Maxwell Decode: Earlier encodings take precedence", "[shader_recompiler]") {
+    // The fixed bits of an encoding alone can also match encodings that come before it
+    for (const Encoding& encoding : ENCODINGS) {
+        const std::optional<Opcode> expected = LinearDecode(encoding.value);
+        REQUIRE(expected.has_value());
+        REQUIRE(Shader::Maxwell::Decode(encoding.value) == *expected);
+    }
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <filesystem>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "video_core/command_capture.h"
+
+namespace {
+using namespace Tegra;
+
+std::filesystem::path CapturePath() {
+    return std::filesystem::temp_directory_path() / "eden_command_capture_test.gpucapture";
+}
+
+CommandListHeader MakeHeader(GPUVAddr addr, u64 size) {
+    CommandListHeader header{};
+    header.addr.Assign(addr);
+    header.size.Assign(size);
+    header.is_push_buffer.Assign(1);
+    return header;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("CommandCapture: Records are read back in order", "[video_core]") {
+    const auto path = CapturePath();
+    constexpr std::array<u8, 8> memory{1, 2, 3, 4, 5, 6, 7, 8};
+
+    CommandList command_list(2);
+    command_list.command_lists[0] = MakeHeader(0x10000, 2);
+    command_list.command_lists[1] = MakeHeader(0x20000, 0);
+
+    CommandList prefetch_list;
+    prefetch_list.prefetch_command_list.push_back(
+        BuildCommandHeader(BufferMethods::SyncpointPayload, 1, SubmissionMode::Increasing));
+
+    // Fence commands submitted along with the entries
+    CommandList fenced_list(1);
+    fenced_list.command_lists[0] = MakeHeader(0x30000, 4);
+    fenced_list.prefetch_command_list.push_back(
+        BuildCommandHeader(BufferMethods::SyncpointPayload, 1, SubmissionMode::Increasing));
+    fenced_list.prefetch_command_list.push_back(
+        BuildCommandHeader(BufferMethods::WaitForIdle, 1, SubmissionMode::Increasing));
+    fenced_list.num_leading_prefetch_commands = 1;
+    {
+        CommandCapture::Writer writer(path);
+        REQUIRE(writer.IsOpen());
+        writer.WriteMemory(3, 0x10000, memory);
+        writer.WriteCommandList(3, command_list);
+        writer.WriteCommandList(5, prefetch_list);
+        writer.WriteCommandList(5, fenced_list);
+    }
+
+    CommandCapture::Reader reader(path);
+    REQUIRE(reader.IsValid());
+
+    const auto memory_record = reader.Next();
+    REQUIRE(memory_record);
+    REQUIRE(memory_record->type == CommandCapture::RecordType::Memory);
+    REQUIRE(memory_record->channel == 3);
+    REQUIRE(memory_record->address == 0x10000);
+    REQUIRE(std::equal(memory.begin(), memory.end(), memory_record->memory.begin(),
+                       memory_record->memory.end()));
+
+    const auto list_record = reader.Next();
+    REQUIRE(list_record);
+    REQUIRE(list_record->type == CommandCapture::RecordType::CommandList);
+    REQUIRE(list_record->channel == 3);
+    const auto& command_lists = list_record->command_list.command_lists;
+    REQUIRE(command_lists.size() == 2);
+    REQUIRE(command_lists[0].raw == command_list.command_lists[0].raw);
+    REQUIRE(command_lists[1].raw == command_list.command_lists[1].raw);
+    REQUIRE(list_record->command_list.prefetch_command_list.empty());
+
+    const auto prefetch_record = reader.Next();
+    REQUIRE(prefetch_record);
+    REQUIRE(prefetch_record->channel == 5);
+    REQUIRE(prefetch_record->command_list.command_lists.empty());
+    REQUIRE(prefetch_record->command_list.prefetch_command_list.size() == 1);
+    REQUIRE(prefetch_record->command_list.prefetch_command_list[0].argument ==
+            prefetch_list.prefetch_command_list[0].argument);
+    REQUIRE(prefetch_record->command_list.num_leading_prefetch_commands == 0);
+
+    const auto fenced_record = reader.Next();
+    REQUIRE(fenced_record);
+    REQUIRE(fenced_record->command_list.command_lists.size() == 1);
+    REQUIRE(fenced_record->command_list.command_lists[0].raw ==
+            fenced_list.command_lists[0].raw);
+    REQUIRE(fenced_record->command_list.prefetch_command_list.size() == 2);
+    REQUIRE(fenced_record->command_list.num_leading_prefetch_commands == 1);
+
+    REQUIRE(!reader.Next());
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("CommandCapture: Truncated files stop the reader", "[video_core]") {
+    const auto path = CapturePath();
+    {
+        CommandCapture::Writer writer(path);
+        REQUIRE(writer.IsOpen());
+        writer.WriteCommandList(0, CommandList(4));
+    }
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - sizeof(u64));
+
+    CommandCapture::Reader reader(path);
+    REQUIRE(reader.IsValid());
+    REQUIRE(!reader.Next());
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("CommandCapture: Files without the header are rejected", "[video_core]") {
+    const auto path = CapturePath();
+    {
+        Common::FS::IOFile file(path, Common::FS::FileAccessMode::Write,
+                                Common::FS::FileType::BinaryFile);
+        REQUIRE(file.WriteObject(u64{0x1234}));
+    }
+    CommandCapture::Reader reader(path);
+    REQUIRE(!reader.IsValid());
+    REQUIRE(!reader.Next());
+    std::filesystem::remove(path);
+}
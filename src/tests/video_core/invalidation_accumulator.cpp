@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/invalidation_accumulator.h"
+
+namespace {
+using VideoCommon::InvalidationAccumulator;
+using Range = std::pair<VAddr, size_t>;
+
+std::vector<Range> Merged(InvalidationAccumulator& accumulator) {
+    const auto ranges = accumulator.SortAndMerge();
+    std::vector<Range> result(ranges.begin(), ranges.end());
+    accumulator.Clear();
+    return result;
+}
+} // Anonymous namespace
+
+TEST_CASE("InvalidationAccumulator: Unsorted ranges are sorted and merged", "[video_core]") {
+    InvalidationAccumulator accumulator;
+    accumulator.Add(0x3000, 0x100);
+    accumulator.Add(0x1000, 0x100);
+    accumulator.Add(0x1100, 0x40);
+    accumulator.Add(0x2000, 0x20);
+    accumulator.Add(0x1080, 0x200);
+    REQUIRE(Merged(accumulator) ==
+            std::vector<Range>{{0x1000, 0x280}, {0x2000, 0x20}, {0x3000, 0x100}});
+}
+
+TEST_CASE("InvalidationAccumulator: Contained ranges are absorbed", "[video_core]") {
+    InvalidationAccumulator accumulator;
+    accumulator.Add(0x4000, 0x1000);
+    accumulator.Add(0x8000, 0x40);
+    accumulator.Add(0x4200, 0x20);
+    REQUIRE(Merged(accumulator) == std::vector<Range>{{0x4000, 0x1000}, {0x8000, 0x40}});
+}
+
+TEST_CASE("InvalidationAccumulator: Clear starts a new batch", "[video_core]") {
+    InvalidationAccumulator accumulator;
+    REQUIRE(accumulator.SortAndMerge().empty());
+    accumulator.Add(0x1000, 0x20);
+    REQUIRE(Merged(accumulator) == std::vector<Range>{{0x1000, 0x20}});
+    REQUIRE(!accumulator.AnyAccumulated());
+    accumulator.Add(0x2000, 0x20);
+    REQUIRE(Merged(accumulator) == std::vector<Range>{{0x2000, 0x20}});
+}
@@ -4,7 +4,9 @@
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include "common/common_types.h"
@@ -544,3 +546,43 @@ TEST_CASE("MemoryTracker: Cached write downloads") {
     memory_track->MarkRegionAsCpuModified(c, WORD);
     REQUIRE(rasterizer.Count() == 0);
 }
+
+TEST_CASE("MemoryTracker: Sparse words are skipped", "[video_core]") {
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(c, WORD * 16);
+    // Both sides of a four word block, and a page right after a long zero run.
+    memory_track->MarkRegionAsCpuModified(c + WORD * 3 + PAGE * 63, PAGE * 2);
+    memory_track->MarkRegionAsCpuModified(c + WORD * 13 + PAGE * 5, PAGE);
+    REQUIRE(memory_track->ModifiedCpuRegion(c, WORD * 16) ==
+            Range{c + WORD * 3 + PAGE * 63, c + WORD * 13 + PAGE * 6});
+    REQUIRE(!memory_track->IsRegionCpuModified(c + WORD * 5, WORD * 8));
+    REQUIRE(memory_track->IsRegionCpuModified(c + WORD * 5, WORD * 9));
+
+    std::vector<Range> ranges;
+    memory_track->ForEachUploadRange(c + PAGE, WORD * 16 - PAGE, [&](u64 offset, u64 size) {
+        ranges.emplace_back(offset, size);
+    });
+    REQUIRE(ranges == std::vector<Range>{{c + WORD * 3 + PAGE * 63, PAGE * 2},
+                                         {c + WORD * 13 + PAGE * 5, PAGE}});
+    REQUIRE(!memory_track->IsRegionCpuModified(c, WORD * 16));
+    REQUIRE(rasterizer.Count() == WORD * 16 / PAGE);
+}
+
+TEST_CASE("MemoryTracker: Benchmark", "[video_core][!benchmark][.]") {
+    static constexpr u64 size = HIGH_PAGE_SIZE * 64;
+    RasterizerInterface rasterizer;
+    std::unique_ptr<MemoryTracker> memory_track(std::make_unique<MemoryTracker>(rasterizer));
+    memory_track->UnmarkRegionAsCpuModified(c, size);
+    BENCHMARK("Clean region query") {
+        return memory_track->IsRegionCpuModified(c, size);
+    };
+    BENCHMARK("Sparse region upload") {
+        u64 total = 0;
+        memory_track->MarkRegionAsCpuModified(c + size / 3, PAGE);
+        memory_track->ForEachUploadRange(c, size, [&](u64, u64 range_size) {
+            total += range_size;
+        });
+        return total;
+    };
+}
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/shader_environment.h"
+
+namespace {
+
+constexpr u32 CACHE_VERSION = 7;
+
+struct TestKey {
+    u64 value;
+};
+
+void Serialize(u64 key, const std::filesystem::path& filename, u32 cache_version) {
+    const std::array<const VideoCommon::GenericEnvironment*, 0> envs{};
+    VideoCommon::SerializePipeline(TestKey{key}, envs, filename, cache_version);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("PipelineCache: Export and import", "[video_core]") {
+    const auto dir = std::filesystem::temp_directory_path() / "eden_pipeline_cache_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto source = dir / "source.bin";
+    const auto target = dir / "target.bin";
+    const auto package = dir / "source.pkg";
+
+    Serialize(1, source, CACHE_VERSION);
+    Serialize(2, source, CACHE_VERSION);
+    Serialize(2, target, CACHE_VERSION);
+    REQUIRE(VideoCommon::ExportPipelineCache(source, package));
+    REQUIRE(VideoCommon::ImportPipelineCache(package, target));
+
+    // Both caches hold the same two entries once they are compacted.
+    REQUIRE(VideoCommon::CompactPipelineCache(source, CACHE_VERSION));
+    REQUIRE(std::filesystem::file_size(source) == std::filesystem::file_size(target));
+
+    // A package is only merged into caches of the same version.
+    const auto other_version = dir / "other.bin";
+    Serialize(3, other_version, CACHE_VERSION + 1);
+    REQUIRE(!VideoCommon::ImportPipelineCache(package, other_version));
+
+    // Missing caches are created.
+    const auto created = dir / "created.bin";
+    REQUIRE(VideoCommon::ImportPipelineCache(package, created));
+    REQUIRE(std::filesystem::file_size(created) == std::filesystem::file_size(source));
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("PipelineCache: Corrupted package", "[video_core]") {
+    const auto dir = std::filesystem::temp_directory_path() / "eden_pipeline_cache_corrupt_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto source = dir / "source.bin";
+    const auto package = dir / "source.pkg";
+    Serialize(1, source, CACHE_VERSION);
+    REQUIRE(VideoCommon::ExportPipelineCache(source, package));
+
+    // Flip the last byte of the compressed entries.
+    {
+        std::fstream file(package, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(-1, std::ios::end);
+        const char last = static_cast<char>(file.get());
+        file.seekp(-1, std::ios::end);
+        file.put(static_cast<char>(last ^ 0x55));
+    }
+    const auto target = dir / "target.bin";
+    REQUIRE(!VideoCommon::ImportPipelineCache(package, target));
+    REQUIRE(!std::filesystem::exists(target));
+
+    std::filesystem::remove_all(dir);
+}
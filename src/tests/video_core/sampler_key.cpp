@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "video_core/texture_cache/util.h"
+#include "video_core/textures/texture.h"
+
+namespace {
+using Tegra::Texture::DepthCompareFunc;
+using Tegra::Texture::TextureFilter;
+using Tegra::Texture::TSCEntry;
+using Tegra::Texture::WrapMode;
+using VideoCommon::CanonicalSampler;
+
+TSCEntry MakeSampler(WrapMode wrap) {
+    TSCEntry entry{};
+    entry.wrap_u.Assign(wrap);
+    entry.wrap_v.Assign(wrap);
+    entry.wrap_p.Assign(wrap);
+    entry.mag_filter.Assign(TextureFilter::Linear);
+    entry.min_filter.Assign(TextureFilter::Linear);
+    entry.max_anisotropy.Assign(3);
+    entry.max_lod_clamp.Assign(0xF00);
+    entry.border_color = {1.0f, 0.5f, 0.25f, 1.0f};
+    return entry;
+}
+} // Anonymous namespace
+
+TEST_CASE("CanonicalSampler: Ignored fields are merged", "[video_core]") {
+    const TSCEntry base = MakeSampler(WrapMode::Wrap);
+    TSCEntry variant = base;
+    variant.srgb_conversion.Assign(1);
+    variant.srgb_border_color_r.Assign(0x80);
+    variant.trilin_opt.Assign(7);
+    variant.depth_compare_func.Assign(DepthCompareFunc::Greater);
+    // The border color is not sampled with this wrap mode
+    variant.border_color = {0.0f, 0.0f, 0.0f, 0.0f};
+    REQUIRE(base != variant);
+    REQUIRE(CanonicalSampler(base) == CanonicalSampler(variant));
+    REQUIRE(CanonicalSampler(base) == CanonicalSampler(CanonicalSampler(base)));
+}
+
+TEST_CASE("CanonicalSampler: Sampled state is kept", "[video_core]") {
+    const TSCEntry base = MakeSampler(WrapMode::Border);
+    const TSCEntry canonical = CanonicalSampler(base);
+    REQUIRE(canonical.border_color == base.border_color);
+    REQUIRE(canonical.max_anisotropy == base.max_anisotropy);
+    REQUIRE(canonical.max_lod_clamp == base.max_lod_clamp);
+
+    TSCEntry other_border = base;
+    other_border.border_color[0] = 0.0f;
+    REQUIRE(CanonicalSampler(other_border) != canonical);
+
+    TSCEntry compare = base;
+    compare.depth_compare_enabled.Assign(1);
+    compare.depth_compare_func.Assign(DepthCompareFunc::Greater);
+    TSCEntry other_compare = compare;
+    other_compare.depth_compare_func.Assign(DepthCompareFunc::Less);
+    REQUIRE(CanonicalSampler(compare) != CanonicalSampler(other_compare));
+}
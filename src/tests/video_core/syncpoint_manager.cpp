@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <thread>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "video_core/host1x/syncpoint_manager.h"
+
+namespace Tegra::Host1x {
+
+TEST_CASE("SyncpointManager: Wait for increments", "[video_core]") {
+    SyncpointManager manager;
+    std::jthread waiter{[&] { manager.WaitHost(3, 100); }};
+    for (int i = 0; i < 100; ++i) {
+        manager.IncrementHost(3);
+    }
+    waiter.join();
+    REQUIRE(manager.GetHostSyncpointValue(3) == 100);
+    REQUIRE(manager.GetGuestSyncpointValue(3) == 0);
+}
+
+TEST_CASE("SyncpointManager: Actions run in order once reached", "[video_core]") {
+    SyncpointManager manager;
+    std::vector<u32> order;
+    manager.RegisterGuestAction(1, 2, [&] { order.push_back(2); });
+    manager.RegisterGuestAction(1, 1, [&] { order.push_back(1); });
+    const auto handle = manager.RegisterGuestAction(1, 2, [&] { order.push_back(3); });
+    manager.DeregisterGuestAction(1, handle);
+
+    manager.IncrementGuest(0);
+    REQUIRE(order.empty());
+    manager.IncrementGuest(1);
+    REQUIRE(order == std::vector<u32>{1});
+    manager.IncrementGuest(1);
+    REQUIRE(order == std::vector<u32>{1, 2});
+
+    // Reached values run the action right away
+    manager.RegisterGuestAction(1, 2, [&] { order.push_back(4); });
+    REQUIRE(order == std::vector<u32>{1, 2, 4});
+}
+
+} // namespace Tegra::Host1x
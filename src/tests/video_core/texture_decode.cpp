@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/surface.h"
+#include "video_core/texture_cache/decode_bc.h"
+#include "video_core/texture_cache/types.h"
+#include "video_core/textures/astc.h"
+
+namespace {
+using VideoCore::Surface::PixelFormat;
+
+constexpr u32 BLOCK_BYTES = 16;
+
+/// 2D LDR void extent block, every texel of it has the same color.
+std::array<u8, BLOCK_BYTES> VoidExtentBlock(u16 r, u16 g, u16 b, u16 a) {
+    std::array<u8, BLOCK_BYTES> block{};
+    const u64 mode = 0xFFFFFFFFFFFFFDFCULL;
+    const std::array<u16, 4> color{r, g, b, a};
+    std::memcpy(block.data(), &mode, sizeof(mode));
+    std::memcpy(block.data() + sizeof(mode), color.data(), sizeof(color));
+    return block;
+}
+
+/**
+ * Random ASTC blocks that all go through the full decode path: a single partition of direct LDR
+ * RGBA endpoints with a 4x4 weight grid, the endpoint and weight bits are left random.
+ */
+std::vector<u8> RandomAstcBlocks(u32 num_blocks) {
+    static constexpr u32 header = 0x42 | (12 << 13);
+    static constexpr u32 header_mask = (1U << 17) - 1;
+    std::mt19937 rng{num_blocks};
+    std::vector<u8> data(static_cast<size_t>(num_blocks) * BLOCK_BYTES);
+    for (size_t i = 0; i < data.size(); i += sizeof(u32)) {
+        u32 word = static_cast<u32>(rng());
+        if (i % BLOCK_BYTES == 0) {
+            word = (word & ~header_mask) | header;
+        }
+        std::memcpy(data.data() + i, &word, sizeof(word));
+    }
+    return data;
+}
+
+std::vector<u8> RandomData(size_t size) {
+    std::mt19937 rng{static_cast<u32>(size)};
+    std::vector<u8> data(size);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+VideoCommon::BufferImageCopy MakeCopy(u32 width, u32 height) {
+    return VideoCommon::BufferImageCopy{
+        .buffer_offset = 0,
+        .buffer_size = 0,
+        .buffer_row_length = width,
+        .buffer_image_height = height,
+        .image_subresource{},
+        .image_offset{},
+        .image_extent{width, height, 1},
+    };
+}
+
+} // Anonymous namespace
+
+TEST_CASE("TextureDecode: ASTC void extent blocks", "[video_core]") {
+    static constexpr u32 width = 12;
+    static constexpr u32 height = 8;
+    const auto block = VoidExtentBlock(0xFF00, 0x4000, 0x8000, 0xFF00);
+    std::vector<u8> data;
+    for (u32 i = 0; i < (width / 4) * (height / 4); ++i) {
+        data.insert(data.end(), block.begin(), block.end());
+    }
+    std::vector<u8> output(width * height * 4);
+    Tegra::Texture::ASTC::Decompress(data, width, height, 1, 4, 4, output);
+    for (size_t i = 0; i < output.size(); i += 4) {
+        REQUIRE(output[i + 0] == 0xFF);
+        REQUIRE(output[i + 1] == 0x40);
+        REQUIRE(output[i + 2] == 0x80);
+        REQUIRE(output[i + 3] == 0xFF);
+    }
+}
+
+TEST_CASE("TextureDecode: BC1 endpoint rows", "[video_core]") {
+    static constexpr u32 width = 8;
+    static constexpr u32 height = 4;
+    // Black and white endpoints, even rows pick the first and odd rows the second
+    static constexpr u16 color0 = 0x0000;
+    static constexpr u16 color1 = 0xFFFF;
+    static constexpr u32 indices = 0x55005500;
+    std::array<u8, 8> block{};
+    std::memcpy(block.data(), &color0, sizeof(color0));
+    std::memcpy(block.data() + 2, &color1, sizeof(color1));
+    std::memcpy(block.data() + 4, &indices, sizeof(indices));
+    std::vector<u8> data;
+    for (u32 i = 0; i < width / 4; ++i) {
+        data.insert(data.end(), block.begin(), block.end());
+    }
+    std::vector<u8> output(width * height * 4);
+    auto copy = MakeCopy(width, height);
+    VideoCommon::DecompressBCn(data, output, copy, PixelFormat::BC1_RGBA_UNORM);
+    for (u32 y = 0; y < height; ++y) {
+        const u8 expected = y % 2 == 0 ? 0x00 : 0xFF;
+        for (u32 x = 0; x < width; ++x) {
+            const u8* const texel = output.data() + (y * width + x) * 4;
+            REQUIRE(texel[0] == expected);
+            REQUIRE(texel[1] == expected);
+            REQUIRE(texel[2] == expected);
+            REQUIRE(texel[3] == 0xFF);
+        }
+    }
+}
+
+TEST_CASE("TextureDecode: Benchmark", "[video_core][!benchmark][.]") {
+    static constexpr u32 width = 1024;
+    static constexpr u32 height = 1024;
+    std::vector<u8> output(width * height * 4);
+
+    for (const u32 block_size : {4U, 8U}) {
+        const u32 num_blocks = (width / block_size) * (height / block_size);
+        const std::vector<u8> astc = RandomAstcBlocks(num_blocks);
+        BENCHMARK(block_size == 4 ? "ASTC 4x4" : "ASTC 8x8") {
+            Tegra::Texture::ASTC::Decompress(astc, width, height, 1, block_size, block_size,
+                                             output);
+            return output[0];
+        };
+    }
+
+    const std::vector<u8> bcn = RandomData(width * height);
+    for (const PixelFormat format :
+         {PixelFormat::BC1_RGBA_UNORM, PixelFormat::BC3_UNORM, PixelFormat::BC7_UNORM}) {
+        auto copy = MakeCopy(width, height);
+        const char* const name = format == PixelFormat::BC1_RGBA_UNORM ? "BC1"
+                                 : format == PixelFormat::BC3_UNORM    ? "BC3"
+                                                                       : "BC7";
+        BENCHMARK(name) {
+            VideoCommon::DecompressBCn(bcn, output, copy, format);
+            return output[0];
+        };
+    }
+}
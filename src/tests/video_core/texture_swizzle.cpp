@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/alignment.h"
+#include "common/common_types.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using namespace Tegra::Texture;
+
+struct Layout {
+    u32 bytes_per_pixel;
+    u32 width;
+    u32 height;
+    u32 depth;
+    u32 block_height;
+    u32 block_depth;
+};
+
+/// Byte by byte reference of the block linear layout.
+std::vector<u8> ReferenceUnswizzle(const std::vector<u8>& swizzled, const Layout& layout) {
+    static constexpr SwizzleTable table = MakeSwizzleTable();
+    const u32 pitch = layout.width * layout.bytes_per_pixel;
+    const u32 gobs_in_x = Common::AlignUpLog2(pitch, GOB_SIZE_X_SHIFT) / GOB_SIZE_X;
+    const u32 block_size = gobs_in_x * (GOB_SIZE << (layout.block_height + layout.block_depth));
+    const u32 block_rows = GOB_SIZE_Y << layout.block_height;
+    const u32 slice_size =
+        Common::AlignUpLog2(layout.height, GOB_SIZE_Y_SHIFT + layout.block_height) / block_rows *
+        block_size;
+
+    std::vector<u8> linear(static_cast<size_t>(pitch) * layout.height * layout.depth);
+    for (u32 z = 0; z < layout.depth; ++z) {
+        const u32 offset_z = (z >> layout.block_depth) * slice_size +
+                             (z & ((1U << layout.block_depth) - 1)) *
+                                 (GOB_SIZE << layout.block_height);
+        for (u32 y = 0; y < layout.height; ++y) {
+            const u32 offset_y = (y / block_rows) * block_size +
+                                 ((y % block_rows) / GOB_SIZE_Y) * GOB_SIZE;
+            for (u32 x = 0; x < pitch; ++x) {
+                const u32 offset_x = (x / GOB_SIZE_X) *
+                                     (GOB_SIZE << (layout.block_height + layout.block_depth));
+                const u32 offset = offset_z + offset_y + offset_x +
+                                   table[y % GOB_SIZE_Y][x % GOB_SIZE_X];
+                linear[(z * layout.height + y) * pitch + x] = swizzled[offset];
+            }
+        }
+    }
+    return linear;
+}
+
+std::vector<u8> RandomData(const Layout& layout) {
+    const size_t size = CalculateSize(true, layout.bytes_per_pixel, layout.width, layout.height,
+                                      layout.depth, layout.block_height, layout.block_depth);
+    std::mt19937 rng{static_cast<u32>(size)};
+    std::vector<u8> data(size);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+constexpr Layout LAYOUTS[]{
+    // Whole GOBs
+    {4, 256, 64, 1, 2, 0},
+    // Partial GOBs in both directions, copied by whole sectors
+    {4, 52, 13, 1, 1, 0},
+    {16, 3, 21, 1, 4, 0},
+    // Not made of whole sectors
+    {4, 7, 9, 1, 0, 0},
+    {3, 33, 17, 1, 3, 0},
+    // Volumes
+    {8, 24, 16, 5, 1, 2},
+    {2, 100, 8, 3, 0, 1},
+};
+
+} // Anonymous namespace
+
+TEST_CASE("TextureSwizzle: Unswizzle matches the reference", "[video_core]") {
+    for (const Layout& layout : LAYOUTS) {
+        const std::vector<u8> swizzled = RandomData(layout);
+        std::vector<u8> linear(static_cast<size_t>(layout.width) * layout.height * layout.depth *
+                               layout.bytes_per_pixel);
+        UnswizzleTexture(linear, swizzled, layout.bytes_per_pixel, layout.width, layout.height,
+                         layout.depth, layout.block_height, layout.block_depth);
+        REQUIRE(linear == ReferenceUnswizzle(swizzled, layout));
+    }
+}
+
+TEST_CASE("TextureSwizzle: Swizzle roundtrips", "[video_core]") {
+    for (const Layout& layout : LAYOUTS) {
+        const std::vector<u8> swizzled = RandomData(layout);
+        const std::vector<u8> linear = ReferenceUnswizzle(swizzled, layout);
+        std::vector<u8> result(swizzled.size());
+        SwizzleTexture(result, linear, layout.bytes_per_pixel, layout.width, layout.height,
+                       layout.depth, layout.block_height, layout.block_depth);
+        REQUIRE(ReferenceUnswizzle(result, layout) == linear);
+    }
+}
+
+TEST_CASE("TextureSwizzle: Benchmark", "[video_core][!benchmark][.]") {
+    // Rows made of whole sectors take the GOB copy path, slightly narrower ones don't.
+    static constexpr Layout sectors{4, 1024, 1024, 1, 4, 0};
+    static constexpr Layout scalar{4, 1022, 1024, 1, 4, 0};
+    for (const Layout& layout : {sectors, scalar}) {
+        const std::vector<u8> swizzled = RandomData(layout);
+        std::vector<u8> linear(static_cast<size_t>(layout.width) * layout.height *
+                               layout.bytes_per_pixel);
+        BENCHMARK(layout.width == sectors.width ? "Unswizzle sectors" : "Unswizzle scalar") {
+            UnswizzleTexture(linear, swizzled, layout.bytes_per_pixel, layout.width,
+                             layout.height, layout.depth, layout.block_height,
+                             layout.block_depth);
+            return linear[0];
+        };
+        std::vector<u8> result(swizzled.size());
+        BENCHMARK(layout.width == sectors.width ? "Swizzle sectors" : "Swizzle scalar") {
+            SwizzleTexture(result, linear, layout.bytes_per_pixel, layout.width, layout.height,
+                           layout.depth, layout.block_height, layout.block_depth);
+            return result[0];
+        };
+    }
+}
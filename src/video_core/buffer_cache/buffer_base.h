@@ -1,9 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <bit>
 #include <limits>
 #include <utility>
@@ -39,9 +43,9 @@ public:
     static constexpr u64 BASE_PAGE_SIZE = 1ULL << BASE_PAGE_BITS;
 
     explicit BufferBase(VAddr cpu_addr_, u64 size_bytes_)
-        : cpu_addr{cpu_addr_}, size_bytes{size_bytes_} {}
+        : cpu_addr{cpu_addr_}, size_bytes{size_bytes_}, write_generation{NextWriteGeneration()} {}
 
-    explicit BufferBase(NullBufferParams) {}
+    explicit BufferBase(NullBufferParams) : write_generation{NextWriteGeneration()} {}
 
     BufferBase& operator=(const BufferBase&) = delete;
     BufferBase(const BufferBase&) = delete;
@@ -115,12 +119,29 @@ public:
         return size_bytes;
     }
 
+    /// Notes that the contents of the buffer are about to change
+    void MarkWriteGeneration() noexcept {
+        write_generation = NextWriteGeneration();
+    }
+
+    /// Returns a value unique to the buffer and its contents, results derived from them while it
+    /// stays the same are still valid. Buffers never share it, even when their slot is reused.
+    [[nodiscard]] u64 WriteGeneration() const noexcept {
+        return write_generation;
+    }
+
 private:
+    [[nodiscard]] static u64 NextWriteGeneration() noexcept {
+        static std::atomic<u64> counter{};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
     VAddr cpu_addr = 0;
     BufferFlagBits flags{};
     int stream_score = 0;
     size_t lru_id = SIZE_MAX;
     size_t size_bytes = 0;
+    u64 write_generation = 0;
 };
 
 } // namespace VideoCommon
@@ -39,18 +39,17 @@ BufferCache<P>::BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, R
         return;
     }
 
-    const s64 device_local_memory = static_cast<s64>(runtime.GetDeviceLocalMemory());
-    const s64 min_spacing_expected = device_local_memory - 1_GiB;
-    const s64 min_spacing_critical = device_local_memory - 512_MiB;
-    const s64 mem_threshold = (std::min)(device_local_memory, TARGET_THRESHOLD);
-    const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
-    const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
-    minimum_memory = static_cast<u64>(
-        (std::max)((std::min)(device_local_memory - min_vacancy_expected, min_spacing_expected),
-                 DEFAULT_EXPECTED_MEMORY));
-    critical_memory = static_cast<u64>(
-        (std::max)((std::min)(device_local_memory - min_vacancy_critical, min_spacing_critical),
-                 DEFAULT_CRITICAL_MEMORY));
+    memory_pressure.emplace(runtime.GetDeviceLocalMemory(), TARGET_THRESHOLD,
+                            DEFAULT_EXPECTED_MEMORY, DEFAULT_CRITICAL_MEMORY);
+    ApplyMemoryThresholds();
+}
+
+template <class P>
+void BufferCache<P>::ApplyMemoryThresholds() {
+    // Buffers are collected from the expected threshold, as they are cheaper to recreate.
+    const MemoryThresholds& thresholds = memory_pressure->GetThresholds();
+    minimum_memory = thresholds.expected;
+    critical_memory = thresholds.critical;
 }
 
 template <class P>
@@ -74,6 +73,23 @@ void BufferCache<P>::RunGarbageCollector() {
     lru_cache.ForEachItemBelow(frame_tick - ticks_to_destroy, clean_up);
 }
 
+template <class P>
+void BufferCache<P>::Trim(MemoryPressure pressure) {
+    // Same age as the aggressive collection. Evicted buffers are downloaded first, so they are
+    // only given back once the pressure is high.
+    static constexpr u64 TICKS_TO_KEEP = 60;
+    if (pressure < MemoryPressure::High || !channel_state || frame_tick < TICKS_TO_KEEP) {
+        return;
+    }
+    const u64 used_memory = total_used_memory;
+    lru_cache.ForEachItemBelow(frame_tick - TICKS_TO_KEEP, [this](BufferId buffer_id) {
+        DownloadBufferMemory(slot_buffers[buffer_id]);
+        DeleteBuffer(buffer_id);
+        return false;
+    });
+    LOG_INFO(HW_GPU, "Trimmed {} MiB of buffers", (used_memory - total_used_memory) >> 20);
+}
+
 template <class P>
 void BufferCache<P>::TickFrame() {
     // Homebrew console apps don't create or bind any channels, so this will be nullptr.
@@ -102,6 +118,10 @@ void BufferCache<P>::TickFrame() {
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
+        if (memory_pressure) {
+            memory_pressure->Update(runtime.GetDeviceMemoryBudget());
+            ApplyMemoryThresholds();
+        }
     }
     if (total_used_memory >= minimum_memory) {
         RunGarbageCollector();
@@ -242,6 +262,7 @@ bool BufferCache<P>::DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 am
     const auto& copy = copies[0];
     src_buffer.MarkUsage(copy.src_offset, copy.size);
     dest_buffer.MarkUsage(copy.dst_offset, copy.size);
+    dest_buffer.MarkWriteGeneration();
     runtime.CopyBuffer(dest_buffer, src_buffer, copies, true);
     if (has_new_downloads) {
         memory_tracker.MarkRegionAsGpuModified(*cpu_dest_address, amount);
@@ -253,6 +274,55 @@ bool BufferCache<P>::DMACopy(GPUVAddr src_address, GPUVAddr dest_address, u64 am
     return true;
 }
 
+template <class P>
+bool BufferCache<P>::DMASwizzle(const Tegra::DMA::SwizzleCopy& copy) {
+    if constexpr (IS_OPENGL) {
+        // OpenGL has no buffer swizzling pass, these copies stay on the CPU
+        return false;
+    } else {
+        const std::optional<DAddr> cpu_src_address = gpu_memory->GpuToCpuAddress(copy.src.address);
+        const std::optional<DAddr> cpu_dest_address = gpu_memory->GpuToCpuAddress(copy.dst.address);
+        if (!cpu_src_address || !cpu_dest_address) {
+            return false;
+        }
+        const u32 src_size = static_cast<u32>(copy.src.size);
+        const u32 dest_size = static_cast<u32>(copy.dst.size);
+        if (*cpu_src_address < *cpu_dest_address + dest_size &&
+            *cpu_dest_address < *cpu_src_address + src_size) {
+            // Overlapping copies need an intermediate buffer
+            return false;
+        }
+        const bool source_dirty = IsRegionRegistered(*cpu_src_address, src_size);
+        const bool dest_dirty = IsRegionRegistered(*cpu_dest_address, dest_size);
+        if (!source_dirty && !dest_dirty) {
+            return false;
+        }
+
+        ClearDownload(*cpu_dest_address, dest_size);
+
+        BufferId buffer_a;
+        BufferId buffer_b;
+        do {
+            channel_state->has_deleted_buffers = false;
+            buffer_a = FindBuffer(*cpu_src_address, src_size);
+            buffer_b = FindBuffer(*cpu_dest_address, dest_size);
+        } while (channel_state->has_deleted_buffers);
+        auto& src_buffer = slot_buffers[buffer_a];
+        auto& dest_buffer = slot_buffers[buffer_b];
+        // The destination is only partially written, the rest of it has to be valid on the host
+        SynchronizeBuffer(src_buffer, *cpu_src_address, src_size);
+        SynchronizeBuffer(dest_buffer, *cpu_dest_address, dest_size);
+
+        const u32 src_offset = src_buffer.Offset(*cpu_src_address);
+        const u32 dest_offset = dest_buffer.Offset(*cpu_dest_address);
+        src_buffer.MarkUsage(src_offset, src_size);
+        dest_buffer.MarkUsage(dest_offset, dest_size);
+        runtime.SwizzleBuffer(dest_buffer, dest_offset, src_buffer, src_offset, copy);
+        MarkWrittenBuffer(buffer_b, *cpu_dest_address, dest_size);
+        return true;
+    }
+}
+
 template <class P>
 bool BufferCache<P>::DMAClear(GPUVAddr dst_address, u64 amount, u32 value) {
     const std::optional<DAddr> cpu_dst_address = gpu_memory->GpuToCpuAddress(dst_address);
@@ -271,6 +341,7 @@ bool BufferCache<P>::DMAClear(GPUVAddr dst_address, u64 amount, u32 value) {
     const BufferId buffer = FindBuffer(*cpu_dst_address, static_cast<u32>(size));
     Buffer& dest_buffer = slot_buffers[buffer];
     const u32 offset = dest_buffer.Offset(*cpu_dst_address);
+    dest_buffer.MarkWriteGeneration();
     runtime.ClearBuffer(dest_buffer, offset, size, value);
     dest_buffer.MarkUsage(offset, size);
     return true;
@@ -302,6 +373,9 @@ std::pair<typename P::Buffer*, u32> BufferCache<P>::ObtainCPUBuffer(
         break;
     }
 
+    if (post_op != ObtainBufferOperation::DoNothing) {
+        buffer.MarkWriteGeneration();
+    }
     switch (post_op) {
     case ObtainBufferOperation::MarkAsWritten:
         MarkWrittenBuffer(buffer_id, device_addr, size);
@@ -318,7 +392,11 @@ std::pair<typename P::Buffer*, u32> BufferCache<P>::ObtainCPUBuffer(
         break;
     }
 
-    return {&buffer, buffer.Offset(device_addr)};
+    // The caller records GPU commands reading or writing the range, keep the CPU from writing
+    // the buffer's mapping directly until they complete
+    const u32 offset = buffer.Offset(device_addr);
+    buffer.MarkUsage(offset, size);
+    return {&buffer, offset};
 }
 
 template <class P>
@@ -684,23 +762,8 @@ bool BufferCache<P>::IsRegionGpuModified(DAddr addr, size_t size) {
 
 template <class P>
 bool BufferCache<P>::IsRegionRegistered(DAddr addr, size_t size) {
-    const DAddr end_addr = addr + size;
-    const u64 page_end = Common::DivCeil(end_addr, CACHING_PAGESIZE);
-    for (u64 page = addr >> CACHING_PAGEBITS; page < page_end;) {
-        const BufferId buffer_id = page_table[page];
-        if (!buffer_id) {
-            ++page;
-            continue;
-        }
-        Buffer& buffer = slot_buffers[buffer_id];
-        const DAddr buf_start_addr = buffer.CpuAddr();
-        const DAddr buf_end_addr = buf_start_addr + buffer.SizeBytes();
-        if (buf_start_addr < end_addr && addr < buf_end_addr) {
-            return true;
-        }
-        page = Common::DivCeil(end_addr, CACHING_PAGESIZE);
-    }
-    return false;
+    const auto it = registered_buffers.upper_bound(addr);
+    return it != registered_buffers.end() && slot_buffers[it->second].CpuAddr() < addr + size;
 }
 
 template <class P>
@@ -760,8 +823,10 @@ void BufferCache<P>::BindHostIndexBuffer() {
                 {BufferCopy{.src_offset = upload_staging.offset, .dst_offset = 0, .size = size}}};
             std::memcpy(upload_staging.mapped_span.data(),
                         draw_state.inline_index_draw_indexes.data(), size);
+            buffer.MarkWriteGeneration();
             runtime.CopyBuffer(buffer, upload_staging.buffer, copies, true);
         } else {
+            buffer.MarkWriteGeneration();
             buffer.ImmediateUpload(0, draw_state.inline_index_draw_indexes);
         }
     } else {
@@ -775,7 +840,7 @@ void BufferCache<P>::BindHostIndexBuffer() {
         buffer.MarkUsage(offset, size);
         runtime.BindIndexBuffer(draw_state.topology, draw_state.index_buffer.format,
                                 draw_state.index_buffer.first, draw_state.index_buffer.count,
-                                buffer, offset, size);
+                                buffer, offset, size, buffer.WriteGeneration());
     }
 }
 
@@ -941,6 +1006,9 @@ void BufferCache<P>::BindHostGraphicsStorageBuffers(size_t stage) {
             runtime.BindStorageBuffer(buffer, offset, size, is_written);
         }
     });
+    if constexpr (IS_OPENGL) {
+        runtime.FlushStorageBuffers();
+    }
 }
 
 template <class P>
@@ -1054,6 +1122,9 @@ void BufferCache<P>::BindHostComputeStorageBuffers() {
             runtime.BindStorageBuffer(buffer, offset, size, is_written);
         }
     });
+    if constexpr (IS_OPENGL) {
+        runtime.FlushStorageBuffers();
+    }
 }
 
 template <class P>
@@ -1322,6 +1393,7 @@ void BufferCache<P>::UpdateComputeTextureBuffers() {
 
 template <class P>
 void BufferCache<P>::MarkWrittenBuffer(BufferId buffer_id, DAddr device_addr, u32 size) {
+    slot_buffers[buffer_id].MarkWriteGeneration();
     memory_tracker.MarkRegionAsGpuModified(device_addr, size);
     gpu_modified_ranges.Add(device_addr, size);
     uncommitted_gpu_modified_ranges.Add(device_addr, size);
@@ -1332,14 +1404,9 @@ BufferId BufferCache<P>::FindBuffer(DAddr device_addr, u32 size) {
     if (device_addr == 0) {
         return NULL_BUFFER_ID;
     }
-    const u64 page = device_addr >> CACHING_PAGEBITS;
-    const BufferId buffer_id = page_table[page];
-    if (!buffer_id) {
-        return CreateBuffer(device_addr, size);
-    }
-    const Buffer& buffer = slot_buffers[buffer_id];
-    if (buffer.IsInBounds(device_addr, size)) {
-        return buffer_id;
+    const auto it = registered_buffers.upper_bound(device_addr);
+    if (it != registered_buffers.end() && slot_buffers[it->second].IsInBounds(device_addr, size)) {
+        return it->second;
     }
     return CreateBuffer(device_addr, size);
 }
@@ -1357,11 +1424,11 @@ typename BufferCache<P>::OverlapResult BufferCache<P>::ResolveOverlaps(DAddr dev
         static constexpr DAddr min_page = CACHING_PAGESIZE + Core::DEVICE_PAGESIZE;
         if (add_value > begin - min_page) {
             begin = min_page;
-            device_addr = Core::DEVICE_PAGESIZE;
+            device_addr = begin;
             return;
         }
         begin -= add_value;
-        device_addr = begin - CACHING_PAGESIZE;
+        device_addr = begin;
     };
     auto expand_end = [&](DAddr add_value) {
         static constexpr DAddr max_page = 1ULL << Tegra::MaxwellDeviceMemoryManager::AS_BITS;
@@ -1379,13 +1446,15 @@ typename BufferCache<P>::OverlapResult BufferCache<P>::ResolveOverlaps(DAddr dev
             .has_stream_leap = has_stream_leap,
         };
     }
-    for (; device_addr >> CACHING_PAGEBITS < Common::DivCeil(end, CACHING_PAGESIZE);
-         device_addr += CACHING_PAGESIZE) {
-        const BufferId overlap_id = page_table[device_addr >> CACHING_PAGEBITS];
-        if (!overlap_id) {
-            continue;
-        }
+    // Look up the buffers ending after the scanned address, expanding the begin rewinds the scan.
+    for (auto it = registered_buffers.upper_bound(device_addr); it != registered_buffers.end();
+         it = registered_buffers.upper_bound(device_addr)) {
+        const BufferId overlap_id = it->second;
         Buffer& overlap = slot_buffers[overlap_id];
+        if (overlap.CpuAddr() >= Common::AlignUp(end, CACHING_PAGESIZE)) {
+            break;
+        }
+        device_addr = it->first;
         if (overlap.IsPicked()) {
             continue;
         }
@@ -1453,7 +1522,15 @@ BufferId BufferCache<P>::CreateBuffer(DAddr device_addr, u32 wanted_size) {
     wanted_size = static_cast<u32>(device_addr_end - device_addr);
     const OverlapResult overlap = ResolveOverlaps(device_addr, wanted_size);
     const u32 size = static_cast<u32>(overlap.end - overlap.begin);
-    const BufferId new_buffer_id = slot_buffers.insert(runtime, overlap.begin, size);
+    const BufferId new_buffer_id = [&] {
+        if constexpr (USE_DIRECT_STREAM_UPLOADS) {
+            // Stream buffers are rewritten by the CPU over and over, let the runtime place them
+            // where they can be written directly.
+            return slot_buffers.insert(runtime, overlap.begin, size, overlap.has_stream_leap);
+        } else {
+            return slot_buffers.insert(runtime, overlap.begin, size);
+        }
+    }();
     auto& new_buffer = slot_buffers[new_buffer_id];
     const size_t size_bytes = new_buffer.SizeBytes();
     runtime.ClearBuffer(new_buffer, 0, size_bytes, 0);
@@ -1483,21 +1560,18 @@ void BufferCache<P>::ChangeRegister(BufferId buffer_id) {
     const auto size = buffer.SizeBytes();
     if (insert) {
         total_used_memory += Common::AlignUp(size, 1024);
+        buffer_memory_usage.fetch_add(Common::AlignUp(size, 1024), std::memory_order_relaxed);
         buffer.setLRUID(lru_cache.Insert(buffer_id, frame_tick));
     } else {
         total_used_memory -= Common::AlignUp(size, 1024);
+        buffer_memory_usage.fetch_sub(Common::AlignUp(size, 1024), std::memory_order_relaxed);
         lru_cache.Free(buffer.getLRUID());
     }
-    const DAddr device_addr_begin = buffer.CpuAddr();
-    const DAddr device_addr_end = device_addr_begin + size;
-    const u64 page_begin = device_addr_begin / CACHING_PAGESIZE;
-    const u64 page_end = Common::DivCeil(device_addr_end, CACHING_PAGESIZE);
-    for (u64 page = page_begin; page != page_end; ++page) {
-        if constexpr (insert) {
-            page_table[page] = buffer_id;
-        } else {
-            page_table[page] = BufferId{};
-        }
+    const DAddr device_addr_end = buffer.CpuAddr() + size;
+    if constexpr (insert) {
+        registered_buffers.emplace(device_addr_end, buffer_id);
+    } else {
+        registered_buffers.erase(device_addr_end);
     }
 }
 
@@ -1534,6 +1608,13 @@ bool BufferCache<P>::SynchronizeBuffer(Buffer& buffer, DAddr device_addr, u32 si
 template <class P>
 void BufferCache<P>::UploadMemory(Buffer& buffer, u64 total_size_bytes, u64 largest_copy,
                                   std::span<BufferCopy> copies) {
+    buffer.MarkWriteGeneration();
+    if constexpr (USE_DIRECT_STREAM_UPLOADS) {
+        if (runtime.CanUploadDirectly(buffer)) {
+            DirectUploadMemory(buffer, copies);
+            return;
+        }
+    }
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
         MappedUploadMemory(buffer, total_size_bytes, copies);
     } else {
@@ -1548,21 +1629,30 @@ void BufferCache<P>::ImmediateUploadMemory([[maybe_unused]] Buffer& buffer,
     if constexpr (!USE_MEMORY_MAPS_FOR_UPLOADS) {
         std::span<u8> immediate_buffer;
         for (const BufferCopy& copy : copies) {
-            std::span<const u8> upload_span;
-            const DAddr device_addr = buffer.CpuAddr() + copy.dst_offset;
-            if (IsRangeGranular(device_addr, copy.size)) {
-                auto* const ptr = device_memory.GetPointer<u8>(device_addr);
-                if (ptr != nullptr) {
-                    upload_span = std::span(ptr, copy.size);
+            // Upload straight from guest memory, one contiguous host range at a time.
+            u64 offset = 0;
+            while (offset < copy.size) {
+                const DAddr device_addr = buffer.CpuAddr() + copy.dst_offset + offset;
+                const std::span<const u8> span =
+                    device_memory.GetLargestSpan(device_addr, copy.size - offset);
+                // Small pieces are cheaper to gather in the immediate buffer than to upload one
+                // by one.
+                if (span.size() != copy.size - offset && span.size() < MIN_DIRECT_UPLOAD_SIZE) {
+                    break;
                 }
-            } else {
-                if (immediate_buffer.empty()) {
-                    immediate_buffer = ImmediateBuffer(largest_copy);
-                }
-                device_memory.ReadBlockUnsafe(device_addr, immediate_buffer.data(), copy.size);
-                upload_span = immediate_buffer.subspan(0, copy.size);
+                buffer.ImmediateUpload(copy.dst_offset + offset, span);
+                offset += span.size();
+            }
+            if (offset == copy.size) {
+                continue;
+            }
+            if (immediate_buffer.empty()) {
+                immediate_buffer = ImmediateBuffer(largest_copy);
             }
-            buffer.ImmediateUpload(copy.dst_offset, upload_span);
+            const u64 remaining = copy.size - offset;
+            device_memory.ReadBlockUnsafe(buffer.CpuAddr() + copy.dst_offset + offset,
+                                          immediate_buffer.data(), remaining);
+            buffer.ImmediateUpload(copy.dst_offset + offset, immediate_buffer.subspan(0, remaining));
         }
     }
 }
@@ -1584,6 +1674,23 @@ void BufferCache<P>::MappedUploadMemory([[maybe_unused]] Buffer& buffer,
         }
         const bool can_reorder = runtime.CanReorderUpload(buffer, copies);
         runtime.CopyBuffer(buffer, upload_staging.buffer, copies, true, can_reorder);
+        if constexpr (USE_DIRECT_STREAM_UPLOADS) {
+            buffer.MarkGpuAccess();
+        }
+    }
+}
+
+template <class P>
+void BufferCache<P>::DirectUploadMemory([[maybe_unused]] Buffer& buffer,
+                                        [[maybe_unused]] std::span<const BufferCopy> copies) {
+    if constexpr (USE_DIRECT_STREAM_UPLOADS) {
+        // The GPU is done with the buffer, write guest memory straight into its mapping.
+        const std::span<u8> mapped = buffer.Mapped();
+        for (const BufferCopy& copy : copies) {
+            device_memory.ReadBlockUnsafe(buffer.CpuAddr() + copy.dst_offset,
+                                          mapped.data() + copy.dst_offset, copy.size);
+        }
+        buffer.FlushMappedWrites();
     }
 }
 
@@ -1614,6 +1721,7 @@ void BufferCache<P>::InlineMemoryImplementation(DAddr dest_address, size_t copy_
     BufferId buffer_id = FindBuffer(dest_address, static_cast<u32>(copy_size));
     auto& buffer = slot_buffers[buffer_id];
     SynchronizeBuffer(buffer, dest_address, static_cast<u32>(copy_size));
+    buffer.MarkWriteGeneration();
 
     if constexpr (USE_MEMORY_MAPS_FOR_UPLOADS) {
         auto upload_staging = runtime.UploadStagingBuffer(copy_size);
@@ -1626,6 +1734,9 @@ void BufferCache<P>::InlineMemoryImplementation(DAddr dest_address, size_t copy_
         std::memcpy(src_pointer, inlined_buffer.data(), copy_size);
         const bool can_reorder = runtime.CanReorderUpload(buffer, copies);
         runtime.CopyBuffer(buffer, upload_staging.buffer, copies, true, can_reorder);
+        if constexpr (USE_DIRECT_STREAM_UPLOADS) {
+            buffer.MarkGpuAccess();
+        }
     } else {
         buffer.ImmediateUpload(buffer.Offset(dest_address), inlined_buffer.first(copy_size));
     }
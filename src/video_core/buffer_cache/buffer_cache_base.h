@@ -8,14 +8,18 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <optional>
 #include <span>
 #include <unordered_map>
 #include <vector>
 
+#include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
 #include "common/literals.h"
@@ -31,8 +35,10 @@
 #include "video_core/engines/draw_manager.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/memory_manager.h"
 #include "video_core/surface.h"
+#include "video_core/texture_cache/memory_pressure.h"
 #include "video_core/texture_cache/types.h"
 
 namespace VideoCommon {
@@ -74,6 +80,7 @@ enum class ObtainBufferOperation : u32 {
 
 static constexpr BufferId NULL_BUFFER_ID{0};
 static constexpr u32 DEFAULT_SKIP_CACHE_SIZE = static_cast<u32>(4_KiB);
+static constexpr u64 MIN_DIRECT_UPLOAD_SIZE = 64_KiB;
 
 struct Binding {
     DAddr device_addr{};
@@ -173,6 +180,7 @@ class BufferCache : public VideoCommon::ChannelSetupCaches<BufferCacheChannelInf
     static constexpr bool USE_MEMORY_MAPS = P::USE_MEMORY_MAPS;
     static constexpr bool SEPARATE_IMAGE_BUFFERS_BINDINGS = P::SEPARATE_IMAGE_BUFFER_BINDINGS;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = P::USE_MEMORY_MAPS_FOR_UPLOADS;
+    static constexpr bool USE_DIRECT_STREAM_UPLOADS = P::USE_DIRECT_STREAM_UPLOADS;
 
 #ifdef YUZU_LEGACY
     static constexpr s64 TARGET_THRESHOLD = 3_GiB;
@@ -208,6 +216,14 @@ public:
 
     void TickFrame();
 
+    /// Evicts the buffers that weren't used recently, as far as the host pressure allows.
+    void Trim(MemoryPressure pressure);
+
+    /// Destroys the buffers waiting for the GPU, once the host is known to be idle.
+    void ReleaseDelayedBuffers() {
+        delayed_destruction_ring.Clear();
+    }
+
     void WriteMemory(DAddr device_addr, u64 size);
 
     void CachedWriteMemory(DAddr device_addr, u64 size);
@@ -288,9 +304,17 @@ public:
 
     bool DMAClear(GPUVAddr src_address, u64 amount, u32 value);
 
+    /// Runs a swizzling copy between two guest memory ranges on the buffers that hold them
+    bool DMASwizzle(const Tegra::DMA::SwizzleCopy& copy);
+
     /// Return true when a CPU region is modified from the GPU
     [[nodiscard]] bool IsRegionGpuModified(DAddr addr, size_t size);
 
+    /// Return the memory owned by the cached buffers, safe to call from any thread
+    [[nodiscard]] u64 GetBufferMemoryUsage() const noexcept {
+        return buffer_memory_usage.load(std::memory_order_relaxed);
+    }
+
     /// Return true when a region is registered on the cache
     [[nodiscard]] bool IsRegionRegistered(DAddr addr, size_t size);
 
@@ -330,18 +354,16 @@ private:
 
     template <typename Func>
     void ForEachBufferInRange(DAddr device_addr, u64 size, Func&& func) {
-        const u64 page_end = Common::DivCeil(device_addr + size, CACHING_PAGESIZE);
-        for (u64 page = device_addr >> CACHING_PAGEBITS; page < page_end;) {
-            const BufferId buffer_id = page_table[page];
-            if (!buffer_id) {
-                ++page;
-                continue;
-            }
+        const DAddr begin = Common::AlignDown(device_addr, CACHING_PAGESIZE);
+        const DAddr end = Common::AlignUp(device_addr + size, CACHING_PAGESIZE);
+        for (auto it = registered_buffers.upper_bound(begin); it != registered_buffers.end();) {
+            const auto [buffer_end, buffer_id] = *it;
             Buffer& buffer = slot_buffers[buffer_id];
+            if (buffer.CpuAddr() >= end) {
+                break;
+            }
             func(buffer_id, buffer);
-
-            const DAddr end_addr = buffer.CpuAddr() + buffer.SizeBytes();
-            page = Common::DivCeil(end_addr, CACHING_PAGESIZE);
+            it = registered_buffers.upper_bound(buffer_end);
         }
     }
 
@@ -352,6 +374,8 @@ private:
 
     void RunGarbageCollector();
 
+    void ApplyMemoryThresholds();
+
     void BindHostIndexBuffer();
 
     void BindHostVertexBuffers();
@@ -431,6 +455,8 @@ private:
 
     void MappedUploadMemory(Buffer& buffer, u64 total_size_bytes, std::span<BufferCopy> copies);
 
+    void DirectUploadMemory(Buffer& buffer, std::span<const BufferCopy> copies);
+
     void DownloadBufferMemory(Buffer& buffer_id);
 
     void DownloadBufferMemory(Buffer& buffer_id, DAddr device_addr, u64 size);
@@ -491,14 +517,19 @@ private:
     Common::LeastRecentlyUsedCache<LRUItemParams> lru_cache;
     u64 frame_tick = 0;
     u64 total_used_memory = 0;
+    /// Estimated size of the buffers alone, total_used_memory follows the driver when it can
+    std::atomic<u64> buffer_memory_usage{};
     u64 minimum_memory = 0;
     u64 critical_memory = 0;
+    std::optional<MemoryPressureManager> memory_pressure;
     BufferId inline_buffer_id;
 #ifdef YUZU_LEGACY
     bool immediately_free = false;
 #endif
 
-    std::array<BufferId, ((1ULL << 34) >> CACHING_PAGEBITS)> page_table;
+    /// Registered buffers keyed by their end address. Buffers never overlap, so the first one
+    /// ending after an address is the only one that can contain it.
+    std::map<DAddr, BufferId> registered_buffers;
     Common::ScratchBuffer<u8> tmp_buffer;
 };
 
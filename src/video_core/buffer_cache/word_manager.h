@@ -18,6 +18,12 @@
 #include "common/div_ceil.h"
 #include "video_core/host1x/gpu_device_memory_manager.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 namespace VideoCommon {
 
 constexpr u64 PAGES_PER_WORD = 64;
@@ -49,6 +55,45 @@ struct WordsArray {
     u64* heap;                            ///< Not-small buffers pointer to the storage
 };
 
+/**
+ * Returns the index of the first word in [begin, end) with a bit set in either of the arrays, or
+ * end when there is none. Pass the same array twice to scan a single one.
+ */
+[[nodiscard]] inline size_t FindSetWord(const u64* lhs, const u64* rhs, size_t begin,
+                                        size_t end) noexcept {
+    size_t index = begin;
+    // Zero runs are skipped four words (256 pages) at a time.
+#if defined(ARCHITECTURE_x86_64)
+    const __m128i zero = _mm_setzero_si128();
+    for (; index + 4 <= end; index += 4) {
+        const auto load = [&](const u64* words) {
+            const auto* const vectors = reinterpret_cast<const __m128i*>(words + index);
+            return _mm_or_si128(_mm_loadu_si128(vectors), _mm_loadu_si128(vectors + 1));
+        };
+        const __m128i bits = _mm_or_si128(load(lhs), load(rhs));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero)) != 0xFFFF) {
+            break;
+        }
+    }
+#elif defined(ARCHITECTURE_arm64)
+    for (; index + 4 <= end; index += 4) {
+        const auto load = [&](const u64* words) {
+            return vorrq_u64(vld1q_u64(words + index), vld1q_u64(words + index + 2));
+        };
+        const uint64x2_t bits = vorrq_u64(load(lhs), load(rhs));
+        if (vmaxvq_u32(vreinterpretq_u32_u64(bits)) != 0) {
+            break;
+        }
+    }
+#endif
+    for (; index < end; ++index) {
+        if ((lhs[index] | rhs[index]) != 0) {
+            return index;
+        }
+    }
+    return end;
+}
+
 template <size_t stack_words = 1>
 struct Words {
     explicit Words() = default;
@@ -199,6 +244,19 @@ public:
 
     template <typename Func>
     void IterateWords(size_t offset, size_t size, Func&& func) const {
+        IterateWordsImpl<false>(offset, size, nullptr, nullptr, func);
+    }
+
+    /// Like IterateWords, skipping the words where both lhs and rhs are zero
+    template <typename Func>
+    void IterateSetWords(size_t offset, size_t size, const u64* lhs, const u64* rhs,
+                         Func&& func) const {
+        IterateWordsImpl<true>(offset, size, lhs, rhs, func);
+    }
+
+    template <bool skip_zero, typename Func>
+    void IterateWordsImpl(size_t offset, size_t size, [[maybe_unused]] const u64* lhs,
+                          [[maybe_unused]] const u64* rhs, Func& func) const {
         using FuncReturn = std::invoke_result_t<Func, std::size_t, u64>;
         static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
         const size_t start = static_cast<size_t>(std::max<s64>(static_cast<s64>(offset), 0LL));
@@ -217,6 +275,17 @@ public:
         end_page += diff * PAGES_PER_WORD;
         constexpr u64 base_mask{~0ULL};
         for (size_t word_index = start_word; word_index < end_word; word_index++) {
+            if constexpr (skip_zero) {
+                const size_t next_word = FindSetWord(lhs, rhs, word_index, end_word);
+                if (next_word == end_word) {
+                    return;
+                }
+                if (next_word != word_index) {
+                    start_page = 0;
+                    end_page -= (next_word - word_index) * PAGES_PER_WORD;
+                    word_index = next_word;
+                }
+            }
             const u64 mask = ExtractBits(base_mask, start_page, end_page);
             start_page = 0;
             end_page -= PAGES_PER_WORD;
@@ -256,9 +325,10 @@ public:
         std::span<u64> state_words = words.template Span<type>();
         [[maybe_unused]] std::span<u64> untracked_words = words.template Span<Type::Untracked>();
         [[maybe_unused]] std::span<u64> cached_words = words.template Span<Type::CachedCPU>();
+        [[maybe_unused]] TrackerRange tracker_range;
         IterateWords(dirty_addr - cpu_addr, size, [&](size_t index, u64 mask) {
             if constexpr (type == Type::CPU || type == Type::CachedCPU) {
-                NotifyRasterizer<!enable>(index, untracked_words[index], mask);
+                NotifyRasterizer<!enable>(index, untracked_words[index], mask, tracker_range);
             }
             if constexpr (enable) {
                 state_words[index] |= mask;
@@ -279,6 +349,9 @@ public:
                 }
             }
         });
+        if constexpr (type == Type::CPU || type == Type::CachedCPU) {
+            FlushTrackerRange<!enable>(tracker_range);
+        }
     }
 
     /**
@@ -300,18 +373,27 @@ public:
         bool pending = false;
         size_t pending_offset{};
         size_t pending_pointer{};
+        [[maybe_unused]] TrackerRange tracker_range;
         const auto release = [&]() {
+            // The tracker has to protect the pages before they are read.
+            if constexpr (clear && (type == Type::CPU || type == Type::CachedCPU)) {
+                FlushTrackerRange<true>(tracker_range);
+            }
             func(cpu_addr + pending_offset * BYTES_PER_PAGE,
                  (pending_pointer - pending_offset) * BYTES_PER_PAGE);
         };
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        // Clearing also has to untrack the pages left untracked by the CPU.
+        const u64* const skip_words = clear && (type == Type::CPU || type == Type::CachedCPU)
+                                          ? untracked_words.data()
+                                          : state_words.data();
+        IterateSetWords(offset, size, state_words.data(), skip_words, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
             const u64 word = state_words[index] & mask;
             if constexpr (clear) {
                 if constexpr (type == Type::CPU || type == Type::CachedCPU) {
-                    NotifyRasterizer<true>(index, untracked_words[index], mask);
+                    NotifyRasterizer<true>(index, untracked_words[index], mask, tracker_range);
                 }
                 state_words[index] &= ~mask;
                 if constexpr (type == Type::CPU || type == Type::CachedCPU) {
@@ -343,6 +425,9 @@ public:
         if (pending) {
             release();
         }
+        if constexpr (clear && (type == Type::CPU || type == Type::CachedCPU)) {
+            FlushTrackerRange<true>(tracker_range);
+        }
     }
 
     /**
@@ -359,7 +444,8 @@ public:
         [[maybe_unused]] const std::span<const u64> untracked_words =
             words.template Span<Type::Untracked>();
         bool result = false;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const u64* const state = state_words.data();
+        IterateSetWords(offset, size, state, state, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -387,7 +473,8 @@ public:
             words.template Span<Type::Untracked>();
         u64 begin = (std::numeric_limits<u64>::max)();
         u64 end = 0;
-        IterateWords(offset, size, [&](size_t index, u64 mask) {
+        const u64* const state = state_words.data();
+        IterateSetWords(offset, size, state, state, [&](size_t index, u64 mask) {
             if constexpr (type == Type::GPU) {
                 mask &= ~untracked_words[index];
             }
@@ -425,13 +512,18 @@ public:
         u64* const cached_words = Array<Type::CachedCPU>();
         u64* const untracked_words = Array<Type::Untracked>();
         u64* const cpu_words = Array<Type::CPU>();
-        for (u64 word_index = 0; word_index < num_words; ++word_index) {
+        TrackerRange tracker_range;
+        for (u64 word_index = FindSetWord(cached_words, cached_words, 0, num_words);
+             word_index < num_words;
+             word_index = FindSetWord(cached_words, cached_words, word_index + 1, num_words)) {
             const u64 cached_bits = cached_words[word_index];
-            NotifyRasterizer<false>(word_index, untracked_words[word_index], cached_bits);
+            NotifyRasterizer<false>(word_index, untracked_words[word_index], cached_bits,
+                                    tracker_range);
             untracked_words[word_index] |= cached_bits;
             cpu_words[word_index] |= cached_bits;
             cached_words[word_index] = 0;
         }
+        FlushTrackerRange<false>(tracker_range);
     }
 
 private:
@@ -461,25 +553,47 @@ private:
         }
     }
 
+    /// Pages waiting to be notified to the tracker, so runs crossing words are sent at once.
+    struct TrackerRange {
+        VAddr addr{};
+        u64 size{};
+    };
+
     /**
      * Notify tracker about changes in the CPU tracking state of a word in the buffer
      *
      * @param word_index   Index to the word to notify to the tracker
      * @param current_bits Current state of the word
      * @param new_bits     New state of the word
+     * @param range        Pending pages, extended when the changed pages follow them
      *
      * @tparam add_to_tracker True when the tracker should start tracking the new pages
      */
     template <bool add_to_tracker>
-    void NotifyRasterizer(u64 word_index, u64 current_bits, u64 new_bits) const {
+    void NotifyRasterizer(u64 word_index, u64 current_bits, u64 new_bits,
+                          TrackerRange& range) const {
         u64 changed_bits = (add_to_tracker ? current_bits : ~current_bits) & new_bits;
         VAddr addr = cpu_addr + word_index * BYTES_PER_WORD;
         IteratePages(changed_bits, [&](size_t offset, size_t size) {
-            tracker->UpdatePagesCachedCount(addr + offset * BYTES_PER_PAGE, size * BYTES_PER_PAGE,
-                                            add_to_tracker ? 1 : -1);
+            const VAddr begin = addr + offset * BYTES_PER_PAGE;
+            if (range.size != 0 && range.addr + range.size == begin) {
+                range.size += size * BYTES_PER_PAGE;
+                return;
+            }
+            FlushTrackerRange<add_to_tracker>(range);
+            range = {begin, size * BYTES_PER_PAGE};
         });
     }
 
+    /// Notifies the tracker about the pending pages of a range and clears it.
+    template <bool add_to_tracker>
+    void FlushTrackerRange(TrackerRange& range) const {
+        if (range.size != 0) {
+            tracker->UpdatePagesCachedCount(range.addr, range.size, add_to_tracker ? 1 : -1);
+            range.size = 0;
+        }
+    }
+
     VAddr cpu_addr = 0;
     DeviceTracker* tracker = nullptr;
     Words<stack_words> words;
@@ -0,0 +1,210 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "common/logging/log.h"
+#include "video_core/command_capture.h"
+#include "video_core/gpu.h"
+#include "video_core/memory_manager.h"
+
+namespace Tegra::CommandCapture {
+namespace {
+
+struct FileHeader {
+    u64 magic;
+    u32 version;
+    u32 reserved;
+};
+static_assert(sizeof(FileHeader) == 16, "FileHeader has incorrect size");
+
+struct RecordHeader {
+    RecordType type;
+    s32 channel;
+    u64 size;
+};
+static_assert(sizeof(RecordHeader) == 16, "RecordHeader has incorrect size");
+
+struct CommandListSizes {
+    u32 num_command_lists;
+    u32 num_prefetch_commands;
+    u32 num_leading_prefetch_commands;
+    u32 reserved;
+};
+
+/// Records larger than this are taken as a corrupted file rather than allocated
+constexpr u64 MAX_RECORD_SIZE = 1ULL << 32;
+
+} // Anonymous namespace
+
+Writer::Writer(const std::filesystem::path& path)
+    : file{path, Common::FS::FileAccessMode::Write, Common::FS::FileType::BinaryFile} {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU command capture file");
+        return;
+    }
+    const FileHeader header{
+        .magic = MAGIC,
+        .version = VERSION,
+        .reserved = 0,
+    };
+    if (!file.WriteObject(header)) {
+        LOG_ERROR(HW_GPU, "Failed to write the GPU command capture header");
+        file.Close();
+    }
+}
+
+Writer::~Writer() = default;
+
+void Writer::Capture(s32 channel, const CommandList& command_list,
+                     MemoryManager& memory_manager) {
+    if (!IsOpen()) {
+        return;
+    }
+    std::scoped_lock lock{mutex};
+    for (const CommandListHeader& header : command_list.command_lists) {
+        const size_t size = header.size * sizeof(u32);
+        if (size == 0) {
+            continue;
+        }
+        scratch.resize(size);
+        memory_manager.ReadBlockUnsafe(header.addr, scratch.data(), size);
+        WriteMemoryRecord(channel, header.addr, scratch);
+    }
+    WriteCommandListRecord(channel, command_list);
+}
+
+void Writer::WriteMemory(s32 channel, GPUVAddr address, std::span<const u8> memory) {
+    if (!IsOpen()) {
+        return;
+    }
+    std::scoped_lock lock{mutex};
+    WriteMemoryRecord(channel, address, memory);
+}
+
+void Writer::WriteCommandList(s32 channel, const CommandList& command_list) {
+    if (!IsOpen()) {
+        return;
+    }
+    std::scoped_lock lock{mutex};
+    WriteCommandListRecord(channel, command_list);
+}
+
+void Writer::WriteMemoryRecord(s32 channel, GPUVAddr address, std::span<const u8> memory) {
+    WriteRecordHeader(RecordType::Memory, channel, sizeof(GPUVAddr) + memory.size());
+    void(file.WriteObject(address));
+    void(file.WriteSpan(memory));
+}
+
+void Writer::WriteCommandListRecord(s32 channel, const CommandList& command_list) {
+    const CommandListSizes sizes{
+        .num_command_lists = static_cast<u32>(command_list.command_lists.size()),
+        .num_prefetch_commands = static_cast<u32>(command_list.prefetch_command_list.size()),
+        .num_leading_prefetch_commands = command_list.num_leading_prefetch_commands,
+        .reserved = 0,
+    };
+    const u64 size = sizeof(sizes) + sizes.num_command_lists * sizeof(CommandListHeader) +
+                     sizes.num_prefetch_commands * sizeof(CommandHeader);
+    WriteRecordHeader(RecordType::CommandList, channel, size);
+    void(file.WriteObject(sizes));
+    void(file.WriteSpan(std::span<const CommandListHeader>(command_list.command_lists.data(),
+                                                            command_list.command_lists.size())));
+    void(file.WriteSpan(std::span<const CommandHeader>(
+        command_list.prefetch_command_list.data(), command_list.prefetch_command_list.size())));
+}
+
+void Writer::WriteRecordHeader(RecordType type, s32 channel, u64 size) {
+    const RecordHeader header{
+        .type = type,
+        .channel = channel,
+        .size = size,
+    };
+    void(file.WriteObject(header));
+}
+
+Reader::Reader(const std::filesystem::path& path)
+    : file{path, Common::FS::FileAccessMode::Read, Common::FS::FileType::BinaryFile} {
+    FileHeader header{};
+    if (!file.IsOpen() || !file.ReadObject(header)) {
+        return;
+    }
+    if (header.magic != MAGIC || header.version != VERSION) {
+        LOG_ERROR(HW_GPU, "Unsupported GPU command capture version {}", header.version);
+        return;
+    }
+    is_valid = true;
+}
+
+Reader::~Reader() = default;
+
+std::optional<Record> Reader::Next() {
+    RecordHeader header{};
+    if (!is_valid || !file.ReadObject(header) || header.size > MAX_RECORD_SIZE) {
+        return std::nullopt;
+    }
+    Record record{
+        .type = header.type,
+        .channel = header.channel,
+    };
+    switch (header.type) {
+    case RecordType::Memory: {
+        if (header.size < sizeof(GPUVAddr) || !file.ReadObject(record.address)) {
+            return std::nullopt;
+        }
+        record.memory.resize(header.size - sizeof(GPUVAddr));
+        if (file.ReadSpan(std::span<u8>(record.memory)) != record.memory.size()) {
+            return std::nullopt;
+        }
+        return record;
+    }
+    case RecordType::CommandList: {
+        CommandListSizes sizes{};
+        if (!file.ReadObject(sizes)) {
+            return std::nullopt;
+        }
+        const u64 expected = sizeof(sizes) + sizes.num_command_lists * sizeof(CommandListHeader) +
+                             sizes.num_prefetch_commands * sizeof(CommandHeader);
+        if (expected != header.size ||
+            sizes.num_leading_prefetch_commands > sizes.num_prefetch_commands) {
+            return std::nullopt;
+        }
+        auto& command_list = record.command_list;
+        command_list.num_leading_prefetch_commands = sizes.num_leading_prefetch_commands;
+        command_list.command_lists.resize(sizes.num_command_lists);
+        command_list.prefetch_command_list.resize(sizes.num_prefetch_commands);
+        if (file.ReadSpan(std::span<CommandListHeader>(command_list.command_lists.data(),
+                                                       sizes.num_command_lists)) !=
+                sizes.num_command_lists ||
+            file.ReadSpan(std::span<CommandHeader>(command_list.prefetch_command_list.data(),
+                                                   sizes.num_prefetch_commands)) !=
+                sizes.num_prefetch_commands) {
+            return std::nullopt;
+        }
+        return record;
+    }
+    }
+    LOG_ERROR(HW_GPU, "Unknown GPU command capture record type {}",
+              static_cast<u32>(header.type));
+    return std::nullopt;
+}
+
+u64 Replay(Reader& reader, s32 captured_channel, GPU& gpu, s32 channel,
+           MemoryManager& memory_manager) {
+    u64 num_command_lists = 0;
+    while (auto record = reader.Next()) {
+        if (record->channel != captured_channel) {
+            continue;
+        }
+        switch (record->type) {
+        case RecordType::Memory:
+            memory_manager.WriteBlockUnsafe(record->address, record->memory.data(),
+                                            record->memory.size());
+            break;
+        case RecordType::CommandList:
+            gpu.PushGPUEntries(channel, std::move(record->command_list));
+            ++num_command_lists;
+            break;
+        }
+    }
+    return num_command_lists;
+}
+
+} // namespace Tegra::CommandCapture
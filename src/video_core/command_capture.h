@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "video_core/dma_pusher.h"
+
+namespace Tegra {
+
+class GPU;
+class MemoryManager;
+
+namespace CommandCapture {
+
+/// Identifies a GPU command capture file, followed by the format version.
+constexpr u64 MAGIC = 0x435550474E454445ULL; // "EDENGPUC"
+constexpr u32 VERSION = 2;
+
+enum class RecordType : u32 {
+    /// Guest memory contents at a GPU virtual address, written back before the next lists
+    Memory = 0,
+    /// Command list submitted through GPU::PushGPUEntries
+    CommandList = 1,
+};
+
+struct Record {
+    RecordType type{};
+    s32 channel{};
+    GPUVAddr address{};
+    std::vector<u8> memory;
+    CommandList command_list;
+};
+
+/**
+ * Writes the command lists submitted to the GPU into a file, along with a snapshot of the push
+ * buffers they point to, taken at submission time. Replaying the file feeds DmaPusher with the
+ * exact same command stream.
+ */
+class Writer {
+public:
+    explicit Writer(const std::filesystem::path& path);
+    ~Writer();
+
+    [[nodiscard]] bool IsOpen() const {
+        return file.IsOpen();
+    }
+
+    /// Records a command list and the push buffers it references, read from the memory manager
+    void Capture(s32 channel, const CommandList& command_list, MemoryManager& memory_manager);
+
+    void WriteMemory(s32 channel, GPUVAddr address, std::span<const u8> memory);
+    void WriteCommandList(s32 channel, const CommandList& command_list);
+
+private:
+    void WriteMemoryRecord(s32 channel, GPUVAddr address, std::span<const u8> memory);
+    void WriteCommandListRecord(s32 channel, const CommandList& command_list);
+    void WriteRecordHeader(RecordType type, s32 channel, u64 size);
+
+    std::mutex mutex;
+    Common::FS::IOFile file;
+    std::vector<u8> scratch;
+};
+
+/// Reads back the records of a capture file in submission order.
+class Reader {
+public:
+    explicit Reader(const std::filesystem::path& path);
+    ~Reader();
+
+    /// Returns true when the file was opened and its header matches this version
+    [[nodiscard]] bool IsValid() const {
+        return is_valid;
+    }
+
+    /// Returns the next record, or nullopt at the end of the file or on a truncated record
+    [[nodiscard]] std::optional<Record> Next();
+
+private:
+    Common::FS::IOFile file;
+    bool is_valid{};
+};
+
+/**
+ * Replays the records of one captured channel on a channel that is already set up, writing the
+ * memory snapshots through its memory manager and pushing the command lists to the GPU.
+ * Snapshots overwrite push buffers without waiting for the lists before them, so the GPU has to
+ * run synchronously. Returns the number of command lists submitted.
+ */
+u64 Replay(Reader& reader, s32 captured_channel, GPU& gpu, s32 channel,
+           MemoryManager& memory_manager);
+
+} // namespace CommandCapture
+} // namespace Tegra
@@ -26,6 +26,13 @@ public:
         elements[index].push_back(std::move(object));
     }
 
+    /// Destroys every pending object, the caller has to make sure none of them is in use.
+    void Clear() {
+        for (std::vector<T>& tick_elements : elements) {
+            tick_elements.clear();
+        }
+    }
+
 private:
     size_t index = 0;
     std::array<std::vector<T>, TICKS_TO_DESTROY> elements;
@@ -4,12 +4,12 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/profiler.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "video_core/dma_pusher.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/gpu.h"
-#include "video_core/guest_memory.h"
 #include "video_core/memory_manager.h"
 #include "video_core/rasterizer_interface.h"
 #include "video_core/texture_cache/util.h"
@@ -27,8 +27,11 @@ DmaPusher::DmaPusher(Core::System& system_, GPU& gpu_, MemoryManager& memory_man
 DmaPusher::~DmaPusher() = default;
 
 void DmaPusher::DispatchCalls() {
+    PROFILE_SCOPE("DmaPusher::DispatchCalls");
 
     dma_pushbuffer_subindex = 0;
+    prefetch_begin = 0;
+    prefetch_end = 0;
 
     dma_state.is_last_call = true;
 
@@ -55,16 +58,24 @@ bool DmaPusher::Step() {
             // We ignore it and assume its size is 0.
             dma_pushbuffer.pop();
             dma_pushbuffer_subindex = 0;
+            prefetch_begin = 0;
+            prefetch_end = 0;
             return true;
         });
 
-    if (command_list.prefetch_command_list.size()) {
+    const std::span<const CommandHeader> prefetch_commands{
+        command_list.prefetch_command_list.data(), command_list.prefetch_command_list.size()};
+    if (command_list.command_lists.empty()) {
         // Prefetched command list from nvdrv, used for things like synchronization
-        ProcessCommands(VideoCommon::FixSmallVectorADL(command_list.prefetch_command_list));
+        ProcessCommands(prefetch_commands);
         dma_pushbuffer.pop();
     } else {
-        const CommandListHeader command_list_header{
-            command_list.command_lists[dma_pushbuffer_subindex++]};
+        const size_t entry = dma_pushbuffer_subindex++;
+        const CommandListHeader command_list_header{command_list.command_lists[entry]};
+        if (entry == 0 && command_list.num_leading_prefetch_commands != 0) {
+            // Synchronization submitted along with the entries, e.g. a fence wait
+            ProcessCommands(prefetch_commands.first(command_list.num_leading_prefetch_commands));
+        }
 
         if (signal_sync) {
             std::unique_lock lk(sync_mutex);
@@ -75,47 +86,34 @@ bool DmaPusher::Step() {
 
         dma_state.dma_get = command_list_header.addr;
 
-        if (command_list_header.size == 0) {
-            return true;
-        }
-
-        // Push buffer non-empty, read a word
-        if (dma_state.method >= MacroRegistersStart) {
-            if (subchannels[dma_state.subchannel]) {
-                subchannels[dma_state.subchannel]->current_dirty = memory_manager.IsMemoryDirty(
-                    dma_state.dma_get, command_list_header.size * sizeof(u32));
+        // Empty entries still have to reach the end of the list, it may carry a fence increment
+        if (command_list_header.size != 0) {
+            if (entry >= prefetch_end) {
+                PrefetchCommandLists(VideoCommon::FixSmallVectorADL(command_list.command_lists),
+                                     entry);
             }
-        }
-
-        const auto safe_process = [&] {
-            Tegra::Memory::GpuGuestMemory<Tegra::CommandHeader,
-                                          Tegra::Memory::GuestMemoryFlags::SafeRead>
-                headers(memory_manager, dma_state.dma_get, command_list_header.size,
-                        &command_headers);
-            ProcessCommands(headers);
-        };
-
-        const auto unsafe_process = [&] {
-            Tegra::Memory::GpuGuestMemory<Tegra::CommandHeader,
-                                          Tegra::Memory::GuestMemoryFlags::UnsafeRead>
-                headers(memory_manager, dma_state.dma_get, command_list_header.size,
-                        &command_headers);
-            ProcessCommands(headers);
-        };
-
-        const bool use_safe = Settings::IsDMALevelDefault() ? Settings::IsGPULevelHigh() : Settings::IsDMALevelSafe();
-
-        if (use_safe) {
-            safe_process();
-        } else {
-            unsafe_process();
+            const PrefetchedSegment& segment{prefetched_segments[entry - prefetch_begin]};
+
+            // Push buffer non-empty, read a word
+            if (dma_state.method >= MacroRegistersStart) {
+                if (subchannels[dma_state.subchannel]) {
+                    subchannels[dma_state.subchannel]->current_dirty =
+                        segment.was_dirty || memory_manager.IsMemoryDirty(
+                                                 dma_state.dma_get,
+                                                 command_list_header.size * sizeof(u32));
+                }
+            }
+            ProcessCommands(segment.commands);
         }
 
         if (dma_pushbuffer_subindex >= command_list.command_lists.size()) {
-            // We've gone through the current list, remove it from the queue
+            // We've gone through the current list, run its trailing commands and remove it
+            ProcessCommands(prefetch_commands.subspan(command_list.num_leading_prefetch_commands));
             dma_pushbuffer.pop();
             dma_pushbuffer_subindex = 0;
-        } else if (command_list.command_lists[dma_pushbuffer_subindex].sync && Settings::values.sync_memory_operations.GetValue()) {
+            prefetch_begin = 0;
+            prefetch_end = 0;
+        } else if (command_list.command_lists[dma_pushbuffer_subindex].sync && Settings::RuntimeSnapshot().sync_memory_operations) {
             signal_sync = true;
         }
 
@@ -130,6 +128,63 @@ bool DmaPusher::Step() {
     return true;
 }
 
+void DmaPusher::PrefetchCommandLists(std::span<const CommandListHeader> headers, size_t begin) {
+    const bool use_safe =
+        Settings::IsDMALevelDefault() ? Settings::IsGPULevelHigh() : Settings::IsDMALevelSafe();
+    // Entries after a synchronized one may read memory written by the commands before it, they
+    // are read once the pusher has waited for them. Safe mode reads each entry right before it
+    // runs, the commands before it may still write to the entries after it.
+    const bool sync_memory = Settings::RuntimeSnapshot().sync_memory_operations;
+    size_t end = begin + 1;
+    while (!use_safe && end < headers.size() && !(sync_memory && headers[end].sync)) {
+        ++end;
+    }
+
+    // Segments contiguous in host memory are used in place, the others are copied
+    prefetched_segments.clear();
+    size_t num_copied = 0;
+    for (size_t index = begin; index < end; ++index) {
+        const CommandListHeader& header = headers[index];
+        const size_t size_bytes = header.size * sizeof(CommandHeader);
+        PrefetchedSegment& segment = prefetched_segments.emplace_back();
+        if (size_bytes == 0) {
+            continue;
+        }
+        if (use_safe) {
+            // Flushing clears the state macros look at, keep it from before the flush
+            segment.was_dirty = memory_manager.IsMemoryDirty(header.addr, size_bytes);
+        }
+        if (const u8* const span = memory_manager.GetSpan(header.addr, size_bytes)) {
+            if (use_safe) {
+                memory_manager.FlushRegion(header.addr, size_bytes);
+            }
+            segment.commands = {reinterpret_cast<const CommandHeader*>(span), header.size};
+        } else {
+            num_copied += header.size;
+        }
+    }
+    command_headers.resize_destructive(num_copied);
+
+    CommandHeader* copy = command_headers.data();
+    for (size_t index = begin; index < end; ++index) {
+        const CommandListHeader& header = headers[index];
+        const size_t size_bytes = header.size * sizeof(CommandHeader);
+        PrefetchedSegment& segment = prefetched_segments[index - begin];
+        if (size_bytes == 0 || !segment.commands.empty()) {
+            continue;
+        }
+        if (use_safe) {
+            memory_manager.ReadBlock(header.addr, copy, size_bytes);
+        } else {
+            memory_manager.ReadBlockUnsafe(header.addr, copy, size_bytes);
+        }
+        segment.commands = {copy, header.size};
+        copy += header.size;
+    }
+    prefetch_begin = begin;
+    prefetch_end = end;
+}
+
 void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
     for (std::size_t index = 0; index < commands.size();) {
         const CommandHeader& command_header = commands[index];
@@ -145,10 +200,22 @@ void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
                 dma_state.is_last_call = true;
                 index += max_write;
                 continue;
-            } else {
-                dma_state.is_last_call = dma_state.method_count <= 1;
-                CallMethod(command_header.argument);
             }
+            if (!dma_increment_once && dma_state.method >= non_puller_methods) {
+                // Registers without side effects go to the sink in one go, the engine only
+                // processes them once the next executable method is written
+                const u32 max_write = static_cast<u32>(
+                    std::min<std::size_t>(index + dma_state.method_count, commands.size()) - index);
+                const u32 num_sunk = SinkMethods(&command_header.argument, max_write);
+                if (num_sunk != 0) {
+                    dma_state.method += num_sunk;
+                    dma_state.method_count -= num_sunk;
+                    index += num_sunk;
+                    continue;
+                }
+            }
+            dma_state.is_last_call = dma_state.method_count <= 1;
+            CallMethod(command_header.argument);
 
             if (!dma_state.non_incrementing) {
                 dma_state.method++;
@@ -220,6 +287,16 @@ void DmaPusher::CallMethod(u32 argument) const {
     }
 }
 
+u32 DmaPusher::SinkMethods(const u32* arguments, u32 num_methods) const {
+    auto subchannel = subchannels[dma_state.subchannel];
+    u32 num_sunk = 0;
+    while (num_sunk < num_methods && !subchannel->execution_mask[dma_state.method + num_sunk]) {
+        subchannel->method_sink.emplace_back(dma_state.method + num_sunk, arguments[num_sunk]);
+        ++num_sunk;
+    }
+    return num_sunk;
+}
+
 void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
     if (dma_state.method < non_puller_methods) {
         puller.CallMultiMethod(dma_state.method, dma_state.subchannel, base_start, num_methods,
@@ -115,6 +115,8 @@ struct CommandList final {
 
     boost::container::small_vector<CommandListHeader, 512> command_lists;
     boost::container::small_vector<CommandHeader, 512> prefetch_command_list;
+    /// Prefetched commands run before command_lists, the remaining ones run after them
+    u32 num_leading_prefetch_commands{};
 };
 
 /**
@@ -148,15 +150,28 @@ private:
     static constexpr u32 non_puller_methods = 0x40;
     static constexpr u32 max_subchannels = 8;
     bool Step();
+    /// Reads the segments of a command list from the given entry up to the next one that has to
+    /// wait for the commands before it, so they are all translated in one pass.
+    void PrefetchCommandLists(std::span<const CommandListHeader> headers, size_t begin);
     void ProcessCommands(std::span<const CommandHeader> commands);
 
     void SetState(const CommandHeader& command_header);
 
     void CallMethod(u32 argument) const;
     void CallMultiMethod(const u32* base_start, u32 num_methods) const;
+    /// Queues consecutive writes to registers without side effects in the engine's sink.
+    /// @returns Number of methods queued, stopping at the first executable method
+    u32 SinkMethods(const u32* arguments, u32 num_methods) const;
 
     Common::ScratchBuffer<CommandHeader>
-        command_headers; ///< Buffer for list of commands fetched at once
+        command_headers; ///< Buffer for the prefetched segments not contiguous in host memory
+    struct PrefetchedSegment {
+        std::span<const CommandHeader> commands;
+        bool was_dirty{}; ///< Written by the host GPU before it was flushed for the prefetch
+    };
+    std::vector<PrefetchedSegment> prefetched_segments;
+    std::size_t prefetch_begin{}; ///< First command list entry of the prefetched segments
+    std::size_t prefetch_end{};   ///< Entry after the last prefetched segment
 
     std::queue<CommandList> dma_pushbuffer; ///< Queue of command lists to be processed
     std::size_t dma_pushbuffer_subindex{};  ///< Index within a command list within the pushbuffer
@@ -25,6 +25,129 @@ namespace Tegra::Engines {
 /// First register id that is actually a Macro call.
 constexpr u32 MacroRegistersStart = 0xE00;
 
+/// Returns true for the registers that only hold the parameters of the next draw.
+constexpr bool IsDrawParameterRegister(u32 method) {
+    switch (method) {
+    case MAXWELL3D_REG_INDEX(draw.end):
+    case MAXWELL3D_REG_INDEX(draw.begin):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.first):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.count):
+    case MAXWELL3D_REG_INDEX(index_buffer.first):
+    case MAXWELL3D_REG_INDEX(index_buffer.count):
+    case MAXWELL3D_REG_INDEX(index_buffer32_first):
+    case MAXWELL3D_REG_INDEX(index_buffer16_first):
+    case MAXWELL3D_REG_INDEX(index_buffer8_first):
+    case MAXWELL3D_REG_INDEX(index_buffer32_subsequent):
+    case MAXWELL3D_REG_INDEX(index_buffer16_subsequent):
+    case MAXWELL3D_REG_INDEX(index_buffer8_subsequent):
+    case MAXWELL3D_REG_INDEX(vertex_array_instance_first):
+    case MAXWELL3D_REG_INDEX(vertex_array_instance_subsequent):
+    case MAXWELL3D_REG_INDEX(global_base_vertex_index):
+    case MAXWELL3D_REG_INDEX(global_base_instance_index):
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Returns true for the registers that upload data to the bound constant buffer.
+constexpr bool IsConstBufferUploadRegister(u32 method) {
+    constexpr u32 begin = MAXWELL3D_REG_INDEX(const_buffer);
+    constexpr u32 end = begin + sizeof(Maxwell3D::Regs::ConstantBuffer) / sizeof(u32);
+    return method >= begin && method < end;
+}
+
+/// Returns true for the registers whose writes have to be executed instead of only being stored.
+constexpr bool IsExecutableMethod(u32 method) {
+    if (method >= MacroRegistersStart) {
+        return true;
+    }
+    switch (method) {
+    case MAXWELL3D_REG_INDEX(draw.end):
+    case MAXWELL3D_REG_INDEX(draw.begin):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.first):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.count):
+    case MAXWELL3D_REG_INDEX(index_buffer.first):
+    case MAXWELL3D_REG_INDEX(index_buffer.count):
+    case MAXWELL3D_REG_INDEX(draw_inline_index):
+    case MAXWELL3D_REG_INDEX(index_buffer32_subsequent):
+    case MAXWELL3D_REG_INDEX(index_buffer16_subsequent):
+    case MAXWELL3D_REG_INDEX(index_buffer8_subsequent):
+    case MAXWELL3D_REG_INDEX(index_buffer32_first):
+    case MAXWELL3D_REG_INDEX(index_buffer16_first):
+    case MAXWELL3D_REG_INDEX(index_buffer8_first):
+    case MAXWELL3D_REG_INDEX(inline_index_2x16.even):
+    case MAXWELL3D_REG_INDEX(inline_index_4x8.index0):
+    case MAXWELL3D_REG_INDEX(vertex_array_instance_first):
+    case MAXWELL3D_REG_INDEX(vertex_array_instance_subsequent):
+    case MAXWELL3D_REG_INDEX(draw_texture.src_y0):
+    case MAXWELL3D_REG_INDEX(wait_for_idle):
+    case MAXWELL3D_REG_INDEX(shadow_ram_control):
+    case MAXWELL3D_REG_INDEX(load_mme.instruction_ptr):
+    case MAXWELL3D_REG_INDEX(load_mme.instruction):
+    case MAXWELL3D_REG_INDEX(load_mme.start_address):
+    case MAXWELL3D_REG_INDEX(falcon[4]):
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer):
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 1:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 2:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 3:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 4:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 5:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 6:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 7:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 8:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 9:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 10:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 11:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 12:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 13:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 14:
+    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 15:
+    case MAXWELL3D_REG_INDEX(bind_groups[0].raw_config):
+    case MAXWELL3D_REG_INDEX(bind_groups[1].raw_config):
+    case MAXWELL3D_REG_INDEX(bind_groups[2].raw_config):
+    case MAXWELL3D_REG_INDEX(bind_groups[3].raw_config):
+    case MAXWELL3D_REG_INDEX(bind_groups[4].raw_config):
+    case MAXWELL3D_REG_INDEX(topology_override):
+    case MAXWELL3D_REG_INDEX(clear_surface):
+    case MAXWELL3D_REG_INDEX(report_semaphore.query):
+    case MAXWELL3D_REG_INDEX(render_enable.mode):
+    case MAXWELL3D_REG_INDEX(clear_report_value):
+    case MAXWELL3D_REG_INDEX(sync_info):
+    case MAXWELL3D_REG_INDEX(launch_dma):
+    case MAXWELL3D_REG_INDEX(inline_data):
+    case MAXWELL3D_REG_INDEX(fragment_barrier):
+    case MAXWELL3D_REG_INDEX(invalidate_texture_data_cache):
+    case MAXWELL3D_REG_INDEX(tiled_cache_barrier):
+        return true;
+    default:
+        return false;
+    }
+}
+
+enum MethodFlags : u8 {
+    METHOD_EXECUTABLE = 1 << 0,
+    METHOD_DRAW_PARAMETER = 1 << 1,
+    METHOD_CONST_BUFFER_UPLOAD = 1 << 2,
+};
+
+/// Flags of every register, so writes are classified with a single lookup instead of a switch.
+constexpr std::array<u8, Maxwell3D::Regs::NUM_REGS> METHOD_FLAGS = [] {
+    std::array<u8, Maxwell3D::Regs::NUM_REGS> flags{};
+    for (u32 method = 0; method < Maxwell3D::Regs::NUM_REGS; ++method) {
+        const bool is_executable = IsExecutableMethod(method);
+        const bool is_draw_parameter = IsDrawParameterRegister(method);
+        const bool is_const_buffer_upload = IsConstBufferUploadRegister(method);
+        flags[method] = static_cast<u8>((is_executable ? METHOD_EXECUTABLE : 0) |
+                                        (is_draw_parameter ? METHOD_DRAW_PARAMETER : 0) |
+                                        (is_const_buffer_upload ? METHOD_CONST_BUFFER_UPLOAD : 0));
+    }
+    return flags;
+}();
+static_assert((METHOD_FLAGS[MAXWELL3D_REG_INDEX(draw.end)] & METHOD_EXECUTABLE) != 0);
+static_assert(METHOD_FLAGS[MAXWELL3D_REG_INDEX(viewport_transform)] == 0);
+static_assert(METHOD_FLAGS[MAXWELL3D_REG_INDEX(const_buffer.offset)] == METHOD_CONST_BUFFER_UPLOAD);
+
 Maxwell3D::Maxwell3D(Core::System& system_, MemoryManager& memory_manager_)
     : draw_manager{std::make_unique<DrawManager>(this)}, system{system_},
       memory_manager{memory_manager_}, macro_engine{GetMacroEngine(*this)}, upload_state{
@@ -34,7 +157,8 @@ Maxwell3D::Maxwell3D(Core::System& system_, MemoryManager& memory_manager_)
     InitializeRegisterDefaults();
     execution_mask.reset();
     for (size_t i = 0; i < execution_mask.size(); i++) {
-        execution_mask[i] = IsMethodExecutable(static_cast<u32>(i));
+        execution_mask[i] = i >= MacroRegistersStart ||
+                            (METHOD_FLAGS[i] & METHOD_EXECUTABLE) != 0;
     }
 }
 
@@ -129,73 +253,6 @@ void Maxwell3D::InitializeRegisterDefaults() {
     shadow_state = regs;
 }
 
-bool Maxwell3D::IsMethodExecutable(u32 method) {
-    if (method >= MacroRegistersStart) {
-        return true;
-    }
-    switch (method) {
-    case MAXWELL3D_REG_INDEX(draw.end):
-    case MAXWELL3D_REG_INDEX(draw.begin):
-    case MAXWELL3D_REG_INDEX(vertex_buffer.first):
-    case MAXWELL3D_REG_INDEX(vertex_buffer.count):
-    case MAXWELL3D_REG_INDEX(index_buffer.first):
-    case MAXWELL3D_REG_INDEX(index_buffer.count):
-    case MAXWELL3D_REG_INDEX(draw_inline_index):
-    case MAXWELL3D_REG_INDEX(index_buffer32_subsequent):
-    case MAXWELL3D_REG_INDEX(index_buffer16_subsequent):
-    case MAXWELL3D_REG_INDEX(index_buffer8_subsequent):
-    case MAXWELL3D_REG_INDEX(index_buffer32_first):
-    case MAXWELL3D_REG_INDEX(index_buffer16_first):
-    case MAXWELL3D_REG_INDEX(index_buffer8_first):
-    case MAXWELL3D_REG_INDEX(inline_index_2x16.even):
-    case MAXWELL3D_REG_INDEX(inline_index_4x8.index0):
-    case MAXWELL3D_REG_INDEX(vertex_array_instance_first):
-    case MAXWELL3D_REG_INDEX(vertex_array_instance_subsequent):
-    case MAXWELL3D_REG_INDEX(draw_texture.src_y0):
-    case MAXWELL3D_REG_INDEX(wait_for_idle):
-    case MAXWELL3D_REG_INDEX(shadow_ram_control):
-    case MAXWELL3D_REG_INDEX(load_mme.instruction_ptr):
-    case MAXWELL3D_REG_INDEX(load_mme.instruction):
-    case MAXWELL3D_REG_INDEX(load_mme.start_address):
-    case MAXWELL3D_REG_INDEX(falcon[4]):
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer):
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 1:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 2:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 3:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 4:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 5:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 6:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 7:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 8:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 9:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 10:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 11:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 12:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 13:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 14:
-    case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 15:
-    case MAXWELL3D_REG_INDEX(bind_groups[0].raw_config):
-    case MAXWELL3D_REG_INDEX(bind_groups[1].raw_config):
-    case MAXWELL3D_REG_INDEX(bind_groups[2].raw_config):
-    case MAXWELL3D_REG_INDEX(bind_groups[3].raw_config):
-    case MAXWELL3D_REG_INDEX(bind_groups[4].raw_config):
-    case MAXWELL3D_REG_INDEX(topology_override):
-    case MAXWELL3D_REG_INDEX(clear_surface):
-    case MAXWELL3D_REG_INDEX(report_semaphore.query):
-    case MAXWELL3D_REG_INDEX(render_enable.mode):
-    case MAXWELL3D_REG_INDEX(clear_report_value):
-    case MAXWELL3D_REG_INDEX(sync_info):
-    case MAXWELL3D_REG_INDEX(launch_dma):
-    case MAXWELL3D_REG_INDEX(inline_data):
-    case MAXWELL3D_REG_INDEX(fragment_barrier):
-    case MAXWELL3D_REG_INDEX(invalidate_texture_data_cache):
-    case MAXWELL3D_REG_INDEX(tiled_cache_barrier):
-        return true;
-    default:
-        return false;
-    }
-}
-
 void Maxwell3D::ProcessMacro(u32 method, const u32* base_start, u32 amount, bool is_last_call) {
     if (executing_macro == 0) {
         // A macro call must begin by writing the macro method's register, not its argument.
@@ -323,6 +380,13 @@ void Maxwell3D::ProcessDirtyRegisters(u32 method, u32 argument) {
         return;
     }
     regs.reg_array[method] = argument;
+    const u8 method_flags = METHOD_FLAGS[method];
+    if ((method_flags & METHOD_DRAW_PARAMETER) == 0) {
+        ++dirty.generation;
+        if ((method_flags & METHOD_CONST_BUFFER_UPLOAD) == 0) {
+            ++dirty.state_generation;
+        }
+    }
 
     for (const auto& table : dirty.tables) {
         dirty.flags[table[method]] = true;
@@ -462,12 +526,17 @@ void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
     case MAXWELL3D_REG_INDEX(const_buffer.buffer) + 15:
         ProcessCBMultiData(base_start, amount);
         break;
-    case MAXWELL3D_REG_INDEX(inline_data): {
-        ASSERT(methods_pending == amount);
+    case MAXWELL3D_REG_INDEX(inline_data):
         upload_state.ProcessData(base_start, amount);
         return;
-    }
     default:
+        if (amount != 0 && method < Regs::NUM_REGS &&
+            (METHOD_FLAGS[method] & METHOD_EXECUTABLE) == 0) {
+            // Repeated writes to a plain register are only visible through the last one
+            const u32 last = amount - 1;
+            CallMethod(method, base_start[last], methods_pending - last <= 1);
+            break;
+        }
         for (u32 i = 0; i < amount; i++) {
             CallMethod(method, base_start[i], methods_pending - i <= 1);
         }
@@ -618,6 +687,7 @@ void Maxwell3D::ProcessCBBind(size_t stage_index) {
     // Bind the buffer currently in CB_ADDRESS to the specified index in the desired shader
     // stage.
     const auto& bind_data = regs.bind_groups[stage_index];
+    ++dirty.generation;
     auto& buffer = state.shader_stages[stage_index].const_buffers[bind_data.shader_slot];
     buffer.enabled = bind_data.valid.Value() != 0;
     buffer.address = regs.const_buffer.Address();
@@ -644,6 +714,7 @@ void Maxwell3D::ProcessCBMultiData(const u32* start_base, u32 amount) {
     const GPUVAddr address{buffer_address + regs.const_buffer.offset};
     const size_t copy_size = amount * sizeof(u32);
     memory_manager.WriteBlockCached(address, start_base, copy_size);
+    ++dirty.generation;
 
     // Increment the current buffer position.
     regs.const_buffer.offset += static_cast<u32>(copy_size);
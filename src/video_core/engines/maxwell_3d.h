@@ -3100,6 +3100,11 @@ public:
 
         Flags flags;
         Tables tables{};
+
+        /// Incremented on every change that can affect a draw besides its own parameters.
+        u64 generation{};
+        /// Like generation, but constant buffer uploads do not increment it.
+        u64 state_generation{};
     } dirty;
 
     std::unique_ptr<DrawManager> draw_manager;
@@ -3187,8 +3192,6 @@ private:
 
     void RefreshParametersImpl();
 
-    bool IsMethodExecutable(u32 method);
-
     Core::System& system;
     MemoryManager& memory_manager;
 
@@ -21,6 +21,41 @@ namespace Tegra::Engines {
 
 using namespace Texture;
 
+namespace {
+
+DMA::SwizzleOperand BlockLinearOperand(GPUVAddr address, size_t size,
+                                       const DMA::Parameters& params, u32 width, u32 origin_x) {
+    return DMA::SwizzleOperand{
+        .address = address,
+        .size = size,
+        .is_block_linear = true,
+        .pitch = 0,
+        .width = width,
+        .height = params.height,
+        .origin_x = origin_x,
+        .origin_y = params.origin.y,
+        .block_height = params.block_size.height,
+        .block_depth = params.block_size.depth,
+    };
+}
+
+DMA::SwizzleOperand PitchLinearOperand(GPUVAddr address, size_t size, u32 pitch) {
+    return DMA::SwizzleOperand{
+        .address = address,
+        .size = size,
+        .is_block_linear = false,
+        .pitch = pitch,
+        .width = 0,
+        .height = 0,
+        .origin_x = 0,
+        .origin_y = 0,
+        .block_height = 0,
+        .block_depth = 0,
+    };
+}
+
+} // Anonymous namespace
+
 MaxwellDMA::MaxwellDMA(Core::System& system_, MemoryManager& memory_manager_)
     : system{system_}, memory_manager{memory_manager_} {
     execution_mask.reset();
@@ -214,6 +249,16 @@ void MaxwellDMA::CopyBlockLinearToPitch() {
 
     const size_t dst_size = dst_operand.pitch * regs.line_count;
 
+    if (AccelerateSwizzle({
+            .bytes_per_pixel = bytes_per_pixel,
+            .extent_x = x_elements,
+            .extent_y = regs.line_count,
+            .src = BlockLinearOperand(src_operand.address, src_size, src_params, width, x_offset),
+            .dst = PitchLinearOperand(dst_operand.address, dst_size, dst_operand.pitch),
+        })) {
+        return;
+    }
+
     Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::SafeRead> tmp_read_buffer(
         memory_manager, src_operand.address, src_size, &read_buffer);
     Tegra::Memory::GpuGuestMemoryScoped<u8, Tegra::Memory::GuestMemoryFlags::UnsafeReadCachedWrite>
@@ -276,6 +321,16 @@ void MaxwellDMA::CopyPitchToBlockLinear() {
         CalculateSize(true, bytes_per_pixel, width, height, depth, block_height, block_depth);
     const size_t src_size = static_cast<size_t>(regs.pitch_in) * regs.line_count;
 
+    if (AccelerateSwizzle({
+            .bytes_per_pixel = bytes_per_pixel,
+            .extent_x = x_elements,
+            .extent_y = regs.line_count,
+            .src = PitchLinearOperand(regs.offset_in, src_size, regs.pitch_in),
+            .dst = BlockLinearOperand(regs.offset_out, dst_size, dst_params, width, x_offset),
+        })) {
+        return;
+    }
+
     GPUVAddr src_addr = regs.offset_in;
     GPUVAddr dst_addr = regs.offset_out;
     Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::SafeRead> tmp_read_buffer(
@@ -327,6 +382,16 @@ void MaxwellDMA::CopyBlockLinearToBlockLinear() {
     const size_t dst_size = CalculateSize(true, bytes_per_pixel, dst_width, dst.height, dst.depth,
                                           dst.block_size.height, dst.block_size.depth);
 
+    if (AccelerateSwizzle({
+            .bytes_per_pixel = bytes_per_pixel,
+            .extent_x = x_elements,
+            .extent_y = regs.line_count,
+            .src = BlockLinearOperand(regs.offset_in, src_size, src, src_width, src_x_offset),
+            .dst = BlockLinearOperand(regs.offset_out, dst_size, dst, dst_width, dst_x_offset),
+        })) {
+        return;
+    }
+
     const u32 pitch = x_elements * bytes_per_pixel;
     const size_t mid_buffer_size = pitch * regs.line_count;
 
@@ -346,6 +411,17 @@ void MaxwellDMA::CopyBlockLinearToBlockLinear() {
                    dst.block_size.height, dst.block_size.depth, pitch);
 }
 
+bool MaxwellDMA::AccelerateSwizzle(const DMA::SwizzleCopy& copy) {
+    // Lines past the height of a block linear operand wrap around into its next slice
+    const auto is_single_slice = [&copy](const DMA::SwizzleOperand& operand) {
+        return !operand.is_block_linear || operand.origin_y + copy.extent_y <= operand.height;
+    };
+    if (!is_single_slice(copy.src) || !is_single_slice(copy.dst)) {
+        return false;
+    }
+    return rasterizer->AccessAccelerateDMA().BufferSwizzle(copy);
+}
+
 void MaxwellDMA::ReleaseSemaphore() {
     const auto type = regs.launch_dma.semaphore_type;
     const GPUVAddr address = regs.semaphore.address;
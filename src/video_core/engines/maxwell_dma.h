@@ -70,6 +70,33 @@ struct BufferOperand {
     GPUVAddr address;
 };
 
+/// One side of a copy between guest memory ranges, either block linear or pitch linear.
+struct SwizzleOperand {
+    GPUVAddr address;
+    /// Size in bytes of the range touched by the copy
+    u64 size;
+    bool is_block_linear;
+    /// Row pitch in bytes, only used by pitch linear operands
+    u32 pitch;
+    /// Size in elements, only used by block linear operands
+    u32 width;
+    u32 height;
+    /// Origin in elements, only used by block linear operands
+    u32 origin_x;
+    u32 origin_y;
+    u32 block_height;
+    u32 block_depth;
+};
+
+/// Subrect copied between two guest memory ranges without going through the texture cache.
+struct SwizzleCopy {
+    u32 bytes_per_pixel;
+    u32 extent_x;
+    u32 extent_y;
+    SwizzleOperand src;
+    SwizzleOperand dst;
+};
+
 } // namespace DMA
 } // namespace Tegra
 
@@ -87,6 +114,9 @@ public:
 
     virtual bool BufferToImage(const DMA::ImageCopy& copy_info, const DMA::BufferOperand& src,
                                const DMA::ImageOperand& dst) = 0;
+
+    /// Swizzles or unswizzles a subrect on the host GPU, on data resident in the buffer cache.
+    virtual bool BufferSwizzle(const DMA::SwizzleCopy& copy) = 0;
 };
 
 /**
@@ -259,6 +289,9 @@ private:
 
     void CopyBlockLinearToBlockLinear();
 
+    /// Tries to run a swizzling copy on the host GPU, returns false when the CPU has to do it.
+    bool AccelerateSwizzle(const DMA::SwizzleCopy& copy);
+
     void ReleaseSemaphore();
 
     void ConsumeSinkImpl() override;
@@ -1,11 +1,21 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <cmath>
-#include <vector>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
 
+#include "common/div_ceil.h"
 #include "common/scratch_buffer.h"
+#include "common/thread_pool.h"
 #include "video_core/engines/sw_blitter/blitter.h"
 #include "video_core/engines/sw_blitter/converter.h"
 #include "video_core/guest_memory.h"
@@ -28,87 +38,141 @@ namespace {
 
 constexpr size_t ir_components = 4;
 
-void NearestNeighbor(std::span<const u8> input, std::span<u8> output, u32 src_width, u32 src_height,
-                     u32 dst_width, u32 dst_height, size_t bpp) {
-    const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
-    const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
-    size_t src_y = 0;
-    for (u32 y = 0; y < dst_height; y++) {
-        size_t src_x = 0;
-        for (u32 x = 0; x < dst_width; x++) {
-            const size_t read_from = ((src_y * src_width + src_x) >> 32) * bpp;
-            const size_t write_to = (y * dst_width + x) * bpp;
-
-            std::memcpy(&output[write_to], &input[read_from], bpp);
-            src_x += dx_du;
-        }
-        src_y += dy_dv;
+/// Blits with fewer pixels than this are faster done on the calling thread alone
+constexpr size_t PARALLEL_MIN_PIXELS = 256 * 256;
+/// Most threads a single blit is split into, the calling thread included
+constexpr u32 MAX_BLIT_THREADS = 4;
+
+using IrPixel = std::array<f32, ir_components>;
+
+struct BilinearTap {
+    u32 low;
+    u32 high;
+    f32 weight;
+};
+
+/// Step in 32.32 fixed point between the source pixels of two neighbouring destination pixels.
+u64 NearestStep(u32 src_extent, u32 dst_extent) {
+    return std::llround((static_cast<f64>(src_extent) / dst_extent) * (1ULL << 32));
+}
+
+void BuildNearestColumns(Common::ScratchBuffer<u32>& columns, u32 src_width, u32 dst_width) {
+    columns.resize_destructive(dst_width);
+    const u64 dx_du = NearestStep(src_width, dst_width);
+    u64 src_x = 0;
+    for (u32 x = 0; x < dst_width; x++) {
+        columns[x] = (std::min)(static_cast<u32>(src_x >> 32), src_width - 1);
+        src_x += dx_du;
     }
 }
 
-void NearestNeighborFast(std::span<const f32> input, std::span<f32> output, u32 src_width,
-                         u32 src_height, u32 dst_width, u32 dst_height) {
-    const size_t dx_du = std::llround((static_cast<f64>(src_width) / dst_width) * (1ULL << 32));
-    const size_t dy_dv = std::llround((static_cast<f64>(src_height) / dst_height) * (1ULL << 32));
-    size_t src_y = 0;
-    for (u32 y = 0; y < dst_height; y++) {
-        size_t src_x = 0;
-        for (u32 x = 0; x < dst_width; x++) {
-            const size_t read_from = ((src_y * src_width + src_x) >> 32) * ir_components;
-            const size_t write_to = (y * dst_width + x) * ir_components;
-
-            std::memcpy(&output[write_to], &input[read_from], sizeof(f32) * ir_components);
-            src_x += dx_du;
-        }
-        src_y += dy_dv;
+void BuildBilinearTaps(Common::ScratchBuffer<BilinearTap>& taps, u32 src_extent, u32 dst_extent) {
+    taps.resize_destructive(dst_extent);
+    const f32 step = dst_extent > 1 ? static_cast<f32>(src_extent - 1) /
+                                          static_cast<f32>(dst_extent - 1)
+                                    : 0.f;
+    for (u32 i = 0; i < dst_extent; i++) {
+        const f32 position = static_cast<f32>(i) * step;
+        const f32 low = std::floor(position);
+        taps[i] = BilinearTap{
+            .low = (std::min)(static_cast<u32>(low), src_extent - 1),
+            .high = (std::min)(static_cast<u32>(std::ceil(position)), src_extent - 1),
+            .weight = position - low,
+        };
     }
 }
 
-void Bilinear(std::span<const f32> input, std::span<f32> output, size_t src_width,
-              size_t src_height, size_t dst_width, size_t dst_height) {
-    const auto bilinear_sample = [](std::span<const f32> x0_y0, std::span<const f32> x1_y0,
-                                    std::span<const f32> x0_y1, std::span<const f32> x1_y1,
-                                    f32 weight_x, f32 weight_y) {
-        std::array<f32, ir_components> result{};
-        for (size_t i = 0; i < ir_components; i++) {
-            const f32 a = std::lerp(x0_y0[i], x1_y0[i], weight_x);
-            const f32 b = std::lerp(x0_y1[i], x1_y1[i], weight_x);
-            result[i] = std::lerp(a, b, weight_y);
+/**
+ * Scales the destination rows [first_row, last_row) with nearest neighbor filtering, passing
+ * each pixel through transform. Pixel is a trivially copyable type the size of one pixel, so the
+ * copies are done with fixed size moves and unscaled rows compile into plain vector loops.
+ */
+template <typename Pixel, typename Transform>
+void NearestNeighbor(const u8* input, u8* output, u32 src_width, u32 src_height, u32 dst_width,
+                     u32 dst_height, std::span<const u32> columns, u32 first_row, u32 last_row,
+                     Transform&& transform) {
+    const u64 dy_dv = NearestStep(src_height, dst_height);
+    for (u32 y = first_row; y < last_row; y++) {
+        const u32 src_y = (std::min)(static_cast<u32>((y * dy_dv) >> 32), src_height - 1);
+        const u8* const src_row = input + static_cast<size_t>(src_y) * src_width * sizeof(Pixel);
+        u8* const dst_row = output + static_cast<size_t>(y) * dst_width * sizeof(Pixel);
+        if (src_width == dst_width) {
+            for (size_t x = 0; x < dst_width; x++) {
+                Pixel pixel;
+                std::memcpy(&pixel, src_row + x * sizeof(Pixel), sizeof(Pixel));
+                pixel = transform(pixel);
+                std::memcpy(dst_row + x * sizeof(Pixel), &pixel, sizeof(Pixel));
+            }
+            continue;
         }
-        return result;
-    };
-    const f32 dx_du =
-        dst_width > 1 ? static_cast<f32>(src_width - 1) / static_cast<f32>(dst_width - 1) : 0.f;
-    const f32 dy_dv =
-        dst_height > 1 ? static_cast<f32>(src_height - 1) / static_cast<f32>(dst_height - 1) : 0.f;
-    for (u32 y = 0; y < dst_height; y++) {
-        for (u32 x = 0; x < dst_width; x++) {
-            const f32 x_low = std::floor(static_cast<f32>(x) * dx_du);
-            const f32 y_low = std::floor(static_cast<f32>(y) * dy_dv);
-            const f32 x_high = std::ceil(static_cast<f32>(x) * dx_du);
-            const f32 y_high = std::ceil(static_cast<f32>(y) * dy_dv);
-            const f32 weight_x = (static_cast<f32>(x) * dx_du) - x_low;
-            const f32 weight_y = (static_cast<f32>(y) * dy_dv) - y_low;
-
-            const auto read_src = [&](f32 in_x, f32 in_y) {
-                const size_t read_from =
-                    ((static_cast<size_t>(in_x) * src_width + static_cast<size_t>(in_y)) >> 32) *
-                    ir_components;
-                return std::span<const f32>(&input[read_from], ir_components);
-            };
+        for (size_t x = 0; x < dst_width; x++) {
+            Pixel pixel;
+            std::memcpy(&pixel, src_row + size_t{columns[x]} * sizeof(Pixel), sizeof(Pixel));
+            pixel = transform(pixel);
+            std::memcpy(dst_row + x * sizeof(Pixel), &pixel, sizeof(Pixel));
+        }
+    }
+}
 
-            auto x0_y0 = read_src(x_low, y_low);
-            auto x1_y0 = read_src(x_high, y_low);
-            auto x0_y1 = read_src(x_low, y_high);
-            auto x1_y1 = read_src(x_high, y_high);
+/// Scales the destination rows [first_row, last_row) of the intermediate representation.
+void Bilinear(std::span<const f32> input, std::span<f32> output, u32 src_width, u32 dst_width,
+              std::span<const BilinearTap> columns, std::span<const BilinearTap> rows,
+              u32 first_row, u32 last_row) {
+    for (u32 y = first_row; y < last_row; y++) {
+        const BilinearTap& row = rows[y];
+        const f32* const row_low = &input[size_t{row.low} * src_width * ir_components];
+        const f32* const row_high = &input[size_t{row.high} * src_width * ir_components];
+        f32* const dst_row = &output[size_t{y} * dst_width * ir_components];
+        for (size_t x = 0; x < dst_width; x++) {
+            const BilinearTap& column = columns[x];
+            const f32* const x0_y0 = row_low + size_t{column.low} * ir_components;
+            const f32* const x1_y0 = row_low + size_t{column.high} * ir_components;
+            const f32* const x0_y1 = row_high + size_t{column.low} * ir_components;
+            const f32* const x1_y1 = row_high + size_t{column.high} * ir_components;
+            for (size_t i = 0; i < ir_components; i++) {
+                const f32 a = x0_y0[i] + (x1_y0[i] - x0_y0[i]) * column.weight;
+                const f32 b = x0_y1[i] + (x1_y1[i] - x0_y1[i]) * column.weight;
+                dst_row[x * ir_components + i] = a + (b - a) * row.weight;
+            }
+        }
+    }
+}
 
-            const auto result = bilinear_sample(x0_y0, x1_y0, x0_y1, x1_y1, weight_x, weight_y);
+/// Calls func with a value of the unsigned type as wide as a pixel, returns false if none is.
+template <typename Func>
+bool VisitPixelType(size_t bytes_per_pixel, Func&& func) {
+    switch (bytes_per_pixel) {
+    case 1:
+        func(u8{});
+        return true;
+    case 2:
+        func(u16{});
+        return true;
+    case 4:
+        func(u32{});
+        return true;
+    case 8:
+        func(u64{});
+        return true;
+    case 16:
+        func(u128{});
+        return true;
+    default:
+        return false;
+    }
+}
 
-            const size_t write_to = (y * dst_width + x) * ir_components;
+/// Returns true when the formats are the same 8-bit RGBA layout with red and blue swapped.
+bool IsRedBlueSwap(RenderTargetFormat src, RenderTargetFormat dst) {
+    const auto is_pair = [src, dst](RenderTargetFormat a, RenderTargetFormat b) {
+        return (src == a && dst == b) || (src == b && dst == a);
+    };
+    return is_pair(RenderTargetFormat::A8R8G8B8_UNORM, RenderTargetFormat::A8B8G8R8_UNORM) ||
+           is_pair(RenderTargetFormat::A8R8G8B8_SRGB, RenderTargetFormat::A8B8G8R8_SRGB);
+}
 
-            std::memcpy(&output[write_to], &result, sizeof(f32) * ir_components);
-        }
-    }
+u32 SwapRedBlue(u32 pixel) {
+    return (pixel & 0x00FF00FF) | ((pixel & 0x0000FF00) << 16) | ((pixel >> 16) & 0x0000FF00);
 }
 
 template <bool unpack>
@@ -128,12 +192,51 @@ void ProcessPitchLinear(std::span<const u8> input, std::span<u8> output, size_t
 } // namespace
 
 struct SoftwareBlitEngine::BlitEngineImpl {
+    /**
+     * Calls func(first_row, last_row) over ranges covering the rows [0, height). Large surfaces
+     * are split between the calling thread and the workers, func has to be safe to run
+     * concurrently on disjoint rows.
+     */
+    template <typename Func>
+    void ForEachRows(u32 width, u32 height, Func&& func) {
+        if (static_cast<size_t>(width) * height < PARALLEL_MIN_PIXELS) {
+            func(0U, height);
+            return;
+        }
+        if (!workers) {
+            const u32 num_threads =
+                std::clamp(std::thread::hardware_concurrency() / 2, 1U, MAX_BLIT_THREADS);
+            num_workers = num_threads - 1;
+            if (num_workers != 0) {
+                workers = std::make_unique<Common::PooledWorker>(
+                    Common::ThreadPool::Shared(Common::CoreType::Any), num_workers);
+            }
+        }
+        if (num_workers == 0) {
+            func(0U, height);
+            return;
+        }
+        const u32 rows_per_thread = Common::DivCeil(height, num_workers + 1);
+        for (u32 first_row = rows_per_thread; first_row < height; first_row += rows_per_thread) {
+            const u32 last_row = (std::min)(first_row + rows_per_thread, height);
+            workers->QueueWork([&func, first_row, last_row] { func(first_row, last_row); },
+                               Common::WorkPriority::High);
+        }
+        func(0U, (std::min)(rows_per_thread, height));
+        workers->WaitForRequests();
+    }
+
     Common::ScratchBuffer<u8> tmp_buffer;
     Common::ScratchBuffer<u8> src_buffer;
     Common::ScratchBuffer<u8> dst_buffer;
     Common::ScratchBuffer<f32> intermediate_src;
     Common::ScratchBuffer<f32> intermediate_dst;
+    Common::ScratchBuffer<u32> nearest_columns;
+    Common::ScratchBuffer<BilinearTap> bilinear_columns;
+    Common::ScratchBuffer<BilinearTap> bilinear_rows;
     ConverterFactory converter_factory;
+    std::unique_ptr<Common::PooledWorker> workers;
+    u32 num_workers{};
 };
 
 SoftwareBlitEngine::SoftwareBlitEngine(MemoryManager& memory_manager_)
@@ -173,29 +276,86 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
     const bool no_passthrough =
         src.format != dst.format || src_extent_x != dst_extent_x || src_extent_y != dst_extent_y;
 
-    const auto conversion_phase_same_format = [&]() {
-        NearestNeighbor(impl->src_buffer, impl->dst_buffer, src_extent_x, src_extent_y,
-                        dst_extent_x, dst_extent_y, dst_bytes_per_pixel);
+    // Nearest neighbor blits between formats with the same bits skip the intermediate
+    // representation, each pixel is copied or has its components moved as a whole.
+    const auto conversion_phase_direct = [&]() {
+        if (config.filter == Fermi2D::Filter::Bilinear) {
+            return false;
+        }
+        const bool swap_red_blue = IsRedBlueSwap(src.format, dst.format);
+        if (src.format != dst.format && !swap_red_blue) {
+            return false;
+        }
+        BuildNearestColumns(impl->nearest_columns, src_extent_x, dst_extent_x);
+        return VisitPixelType(dst_bytes_per_pixel, [&]<typename Pixel>(Pixel) {
+            const auto scale = [&](auto&& transform) {
+                impl->ForEachRows(dst_extent_x, dst_extent_y, [&](u32 first_row, u32 last_row) {
+                    NearestNeighbor<Pixel>(impl->src_buffer.data(), impl->dst_buffer.data(),
+                                           src_extent_x, src_extent_y, dst_extent_x,
+                                           dst_extent_y, impl->nearest_columns, first_row,
+                                           last_row, transform);
+                });
+            };
+            if constexpr (std::is_same_v<Pixel, u32>) {
+                if (swap_red_blue) {
+                    scale([](u32 pixel) { return SwapRedBlue(pixel); });
+                    return;
+                }
+            }
+            scale(std::identity{});
+        });
     };
 
     const auto conversion_phase_ir = [&]() {
         auto* input_converter = impl->converter_factory.GetFormatConverter(src.format);
+        auto* output_converter = impl->converter_factory.GetFormatConverter(dst.format);
         impl->intermediate_src.resize_destructive((src_copy_size / src_bytes_per_pixel) *
                                                   ir_components);
         impl->intermediate_dst.resize_destructive((dst_copy_size / dst_bytes_per_pixel) *
                                                   ir_components);
-        input_converter->ConvertTo(impl->src_buffer, impl->intermediate_src);
 
-        if (config.filter != Fermi2D::Filter::Bilinear) {
-            NearestNeighborFast(impl->intermediate_src, impl->intermediate_dst, src_extent_x,
-                                src_extent_y, dst_extent_x, dst_extent_y);
+        const std::span<const u8> src_pixels{impl->src_buffer.data(), src_copy_size};
+        const std::span<u8> dst_pixels{impl->dst_buffer.data(), dst_copy_size};
+        const std::span<f32> ir_src{impl->intermediate_src};
+        const std::span<f32> ir_dst{impl->intermediate_dst};
+        const size_t src_row_pixels = src_extent_x;
+        const size_t dst_row_pixels = dst_extent_x;
+
+        // Converters are stateless, so disjoint rows can be converted at the same time
+        impl->ForEachRows(src_extent_x, src_extent_y, [&](u32 first_row, u32 last_row) {
+            const size_t num_pixels = (last_row - first_row) * src_row_pixels;
+            const size_t first_pixel = first_row * src_row_pixels;
+            input_converter->ConvertTo(
+                src_pixels.subspan(first_pixel * src_bytes_per_pixel,
+                                   num_pixels * src_bytes_per_pixel),
+                ir_src.subspan(first_pixel * ir_components, num_pixels * ir_components));
+        });
+
+        const bool bilinear = config.filter == Fermi2D::Filter::Bilinear;
+        if (bilinear) {
+            BuildBilinearTaps(impl->bilinear_columns, src_extent_x, dst_extent_x);
+            BuildBilinearTaps(impl->bilinear_rows, src_extent_y, dst_extent_y);
         } else {
-            Bilinear(impl->intermediate_src, impl->intermediate_dst, src_extent_x, src_extent_y,
-                     dst_extent_x, dst_extent_y);
+            BuildNearestColumns(impl->nearest_columns, src_extent_x, dst_extent_x);
         }
-
-        auto* output_converter = impl->converter_factory.GetFormatConverter(dst.format);
-        output_converter->ConvertFrom(impl->intermediate_dst, impl->dst_buffer);
+        impl->ForEachRows(dst_extent_x, dst_extent_y, [&](u32 first_row, u32 last_row) {
+            if (bilinear) {
+                Bilinear(ir_src, ir_dst, src_extent_x, dst_extent_x, impl->bilinear_columns,
+                         impl->bilinear_rows, first_row, last_row);
+            } else {
+                NearestNeighbor<IrPixel>(reinterpret_cast<const u8*>(ir_src.data()),
+                                         reinterpret_cast<u8*>(ir_dst.data()), src_extent_x,
+                                         src_extent_y, dst_extent_x, dst_extent_y,
+                                         impl->nearest_columns, first_row, last_row,
+                                         std::identity{});
+            }
+            const size_t num_pixels = (last_row - first_row) * dst_row_pixels;
+            const size_t first_pixel = first_row * dst_row_pixels;
+            output_converter->ConvertFrom(
+                ir_dst.subspan(first_pixel * ir_components, num_pixels * ir_components),
+                dst_pixels.subspan(first_pixel * dst_bytes_per_pixel,
+                                   num_pixels * dst_bytes_per_pixel));
+        });
     };
 
     // Do actual Blit
@@ -212,10 +372,8 @@ bool SoftwareBlitEngine::Blit(Fermi2D::Surface& src, Fermi2D::Surface& dst,
 
     // Conversion Phase
     if (no_passthrough) {
-        if (src.format != dst.format || config.filter == Fermi2D::Filter::Bilinear) {
+        if (!conversion_phase_direct()) {
             conversion_phase_ir();
-        } else {
-            conversion_phase_same_format();
         }
     } else {
         impl->dst_buffer.swap(impl->src_buffer);
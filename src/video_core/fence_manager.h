@@ -75,7 +75,7 @@ public:
         const bool delay_fence = Settings::IsGPULevelHigh();
 
         #ifdef __ANDROID__
-        const bool use_optimized = Settings::values.early_release_fences.GetValue();
+        const bool use_optimized = Settings::RuntimeSnapshot().early_release_fences;
         #else
         constexpr bool use_optimized = false;
         #endif
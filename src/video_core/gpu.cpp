@@ -11,7 +11,11 @@
 #include <list>
 #include <memory>
 
+#include <fmt/format.h>
+
 #include "common/assert.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
 #include "common/settings.h"
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -20,6 +24,7 @@
 #include "core/hle/service/nvdrv/nvdata.h"
 #include "core/perf_stats.h"
 #include "video_core/cdma_pusher.h"
+#include "video_core/command_capture.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/control/scheduler.h"
 #include "video_core/dma_pusher.h"
@@ -32,6 +37,7 @@
 #include "video_core/gpu_thread.h"
 #include "video_core/host1x/host1x.h"
 #include "video_core/host1x/syncpoint_manager.h"
+#include "video_core/invalidation_accumulator.h"
 #include "video_core/memory_manager.h"
 #include "video_core/renderer_base.h"
 #include "video_core/shader_notify.h"
@@ -98,9 +104,29 @@ struct GPU::Impl {
 
     /// Synchronizes CPU writes with Host GPU memory.
     void InvalidateGPUCache() {
-        std::function<void(PAddr, size_t)> callback_writes(
-            [this](PAddr address, size_t size) { rasterizer->OnCacheInvalidation(address, size); });
+        std::function<void(PAddr, size_t)> callback_writes([this](PAddr address, size_t size) {
+            if (address == 0 || size == 0) {
+                return;
+            }
+            ++invalidation_ranges_in;
+            invalidation_accumulator.Add(address, size);
+        });
         system.GatherGPUDirtyMemory(callback_writes);
+        // Each CPU core gathers its own writes, sort them to visit the caches once per range
+        const auto ranges = invalidation_accumulator.SortAndMerge();
+        if (!ranges.empty()) {
+            invalidation_ranges_processed += ranges.size();
+            rasterizer->InnerInvalidation(ranges);
+        }
+        invalidation_accumulator.Clear();
+        if (++num_invalidation_batches == INVALIDATION_STATISTICS_PERIOD) {
+            LOG_DEBUG(HW_GPU, "CPU invalidations: {} ranges merged into {} over {} sync points",
+                      invalidation_ranges_in, invalidation_ranges_processed,
+                      num_invalidation_batches);
+            num_invalidation_batches = 0;
+            invalidation_ranges_in = 0;
+            invalidation_ranges_processed = 0;
+        }
     }
 
     /// Signal the ending of command list.
@@ -201,11 +227,10 @@ struct GPU::Impl {
     [[nodiscard]] u64 GetTicks() const {
         u64 gpu_tick = system.CoreTiming().GetGPUTicks();
 
-        if (Settings::values.use_fast_gpu_time.GetValue()) {
+        const auto& settings = Settings::RuntimeSnapshot();
+        if (settings.use_fast_gpu_time) {
             gpu_tick /= (u64) (128
-                               * std::pow(2,
-                                          static_cast<u32>(
-                                              Settings::values.fast_gpu_time.GetValue())));
+                               * std::pow(2, static_cast<u32>(settings.fast_gpu_time)));
         }
 
         return gpu_tick;
@@ -219,8 +244,14 @@ struct GPU::Impl {
         return use_nvdec;
     }
 
+    [[nodiscard]] std::chrono::nanoseconds TargetFrameTime() const {
+        return system.GetPerfStats().GetTargetFrameTime();
+    }
+
     void RendererFrameEndNotify() {
         system.GetPerfStats().EndGameFrame();
+        // Settings changed during the frame are picked up once it ends
+        Settings::PublishRuntimeSnapshot();
     }
 
     /// Performs any additional setup necessary in order to begin GPU emulation.
@@ -228,9 +259,25 @@ struct GPU::Impl {
     /// core timing events.
     void Start() {
         Settings::UpdateGPUAccuracy();
+        Settings::PublishRuntimeSnapshot();
+        if (Settings::values.capture_gpu_commands.GetValue()) {
+            StartCommandCapture();
+        }
         gpu_thread.StartThread(*renderer, renderer->Context(), *scheduler);
     }
 
+    void StartCommandCapture() {
+        const auto path = Common::FS::GetEdenPath(Common::FS::EdenPath::LogDir) /
+                          fmt::format("{:016X}.gpucapture",
+                                      system.GetApplicationProcessProgramID());
+        command_capture = std::make_unique<CommandCapture::Writer>(path);
+        if (command_capture->IsOpen()) {
+            LOG_INFO(HW_GPU, "Capturing GPU commands to {}", Common::FS::PathToUTF8String(path));
+        } else {
+            command_capture.reset();
+        }
+    }
+
     void NotifyShutdown() {
         std::unique_lock lk{sync_mutex};
         shutting_down.store(true, std::memory_order::relaxed);
@@ -252,6 +299,13 @@ struct GPU::Impl {
 
     /// Push GPU command entries to be processed
     void PushGPUEntries(s32 channel, Tegra::CommandList&& entries) {
+        // The commands may use memory the CPU wrote to without being trapped.
+        system.ApplicationMemory().GatherWatchedWrites();
+        if (command_capture) {
+            if (const auto it = channels.find(channel); it != channels.end()) {
+                command_capture->Capture(channel, entries, *it->second->memory_manager);
+            }
+        }
         gpu_thread.SubmitList(channel, std::move(entries));
     }
 
@@ -339,6 +393,11 @@ struct GPU::Impl {
         return out;
     }
 
+    void TrimMemory(VideoCommon::MemoryPressure pressure) {
+        void(RequestSyncOperation([this, pressure] { rasterizer->TrimMemory(pressure); }));
+        gpu_thread.TickGPU();
+    }
+
     GPU& gpu;
     Core::System& system;
     Host1x::Host1x& host1x;
@@ -375,12 +434,20 @@ struct GPU::Impl {
 
     std::unique_ptr<Tegra::Control::Scheduler> scheduler;
     std::unordered_map<s32, std::shared_ptr<Tegra::Control::ChannelState>> channels;
+    std::unique_ptr<CommandCapture::Writer> command_capture;
     Tegra::Control::ChannelState* current_channel;
     s32 bound_channel{-1};
 
     std::deque<size_t> free_swap_counters;
     std::deque<size_t> request_swap_counters;
     std::mutex request_swap_mutex;
+
+    /// Sync points between two reports of the invalidation statistics
+    static constexpr u64 INVALIDATION_STATISTICS_PERIOD = 1024;
+    VideoCommon::InvalidationAccumulator invalidation_accumulator;
+    u64 num_invalidation_batches{};
+    u64 invalidation_ranges_in{};
+    u64 invalidation_ranges_processed{};
 };
 
 GPU::GPU(Core::System& system, bool is_async, bool use_nvdec)
@@ -500,6 +567,10 @@ std::vector<u8> GPU::GetAppletCaptureBuffer() {
     return impl->GetAppletCaptureBuffer();
 }
 
+void GPU::TrimMemory(VideoCommon::MemoryPressure pressure) {
+    impl->TrimMemory(pressure);
+}
+
 u64 GPU::GetTicks() const {
     return impl->GetTicks();
 }
@@ -516,6 +587,10 @@ void GPU::RendererFrameEndNotify() {
     impl->RendererFrameEndNotify();
 }
 
+std::chrono::nanoseconds GPU::TargetFrameTime() const {
+    return impl->TargetFrameTime();
+}
+
 void GPU::Start() {
     impl->Start();
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 
 #include "common/bit_field.h"
@@ -19,6 +20,10 @@ namespace Core {
 class System;
 } // namespace Core
 
+namespace VideoCommon {
+enum class MemoryPressure : u32;
+} // namespace VideoCommon
+
 namespace VideoCore {
 class RendererBase;
 class ShaderNotify;
@@ -215,11 +220,17 @@ public:
 
     void RendererFrameEndNotify();
 
+    /// Returns the time between the frames the game presents at.
+    [[nodiscard]] std::chrono::nanoseconds TargetFrameTime() const;
+
     void RequestComposite(std::vector<Tegra::FramebufferConfig>&& layers,
                           std::vector<Service::Nvidia::NvFence>&& fences);
 
     std::vector<u8> GetAppletCaptureBuffer();
 
+    /// Asks the rasterizer caches to give memory back to the host, without waiting for them.
+    void TrimMemory(VideoCommon::MemoryPressure pressure);
+
     /// Performs any additional setup necessary in order to begin GPU emulation.
     /// This can be used to launch any necessary threads and register any necessary
     /// core timing events.
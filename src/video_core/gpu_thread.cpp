@@ -4,6 +4,8 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <limits>
+
 #include "common/assert.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -24,19 +26,17 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
                       VideoCore::RendererBase& renderer, Core::Frontend::GraphicsContext& context,
                       Tegra::Control::Scheduler& scheduler, SynchState& state) {
     Common::SetCurrentThreadName("GPU");
+    if (Settings::values.core_type_affinity.GetValue()) {
+        Common::SetCurrentThreadCoreType(Common::CoreType::Performance);
+    }
     Common::SetCurrentThreadPriority(Common::ThreadPriority::Critical);
     system.RegisterHostThread();
 
     auto current_context = context.Acquire();
     VideoCore::RasterizerInterface* const rasterizer = renderer.ReadRasterizer();
 
-    CommandDataContainer next;
-
-    while (!stop_token.stop_requested()) {
-        state.queue.PopWait(next, stop_token);
-        if (stop_token.stop_requested()) {
-            break;
-        }
+    u64 fence{};
+    const auto process = [&](CommandDataContainer& next) {
         if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
             scheduler.Push(submit_list->channel, std::move(submit_list->entries));
         } else if (std::holds_alternative<GPUTickCommand>(next.data)) {
@@ -48,14 +48,21 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
         } else {
             ASSERT(false);
         }
-        state.signaled_fence.store(next.fence);
+        state.signaled_fence.store(++fence, std::memory_order_release);
         if (next.block) {
-            // We have to lock the write_lock to ensure that the condition_variable wait not get a
-            // race between the check and the lock itself.
-            std::scoped_lock lk{state.write_lock};
-            state.cv.notify_all();
+            state.signaled_fence.notify_all();
+        }
+    };
+
+    while (!stop_token.stop_requested()) {
+        if (!state.queue.ConsumeWait(process, stop_token)) {
+            break;
         }
     }
+
+    // Release anyone still blocked on a command that will never be executed.
+    state.signaled_fence.store((std::numeric_limits<u64>::max)(), std::memory_order_release);
+    state.signaled_fence.notify_all();
 }
 
 ThreadManager::ThreadManager(Core::System& system_, bool is_async_)
@@ -109,14 +116,14 @@ u64 ThreadManager::PushCommand(CommandData&& command_data, bool block) {
         block = true;
     }
 
-    std::unique_lock lk(state.write_lock);
-    const u64 fence{++state.last_fence};
-    state.queue.EmplaceWait(std::move(command_data), fence, block);
+    const u64 fence{state.queue.EmplaceWait(std::move(command_data), block) + 1};
 
     if (block) {
-        state.cv.wait(lk, thread.get_stop_token(), [this, fence] {
-            return fence <= state.signaled_fence.load(std::memory_order_relaxed);
-        });
+        u64 signaled = state.signaled_fence.load(std::memory_order_acquire);
+        while (signaled < fence) {
+            state.signaled_fence.wait(signaled, std::memory_order_acquire);
+            signaled = state.signaled_fence.load(std::memory_order_acquire);
+        }
     }
 
     return fence;
@@ -4,13 +4,11 @@
 #pragma once
 
 #include <atomic>
-#include <condition_variable>
-#include <mutex>
 #include <optional>
 #include <thread>
 #include <variant>
 
-#include "common/bounded_threadsafe_queue.h"
+#include "common/mpsc_ring.h"
 #include "common/polyfill_thread.h"
 #include "video_core/framebuffer_config.h"
 
@@ -79,22 +77,20 @@ using CommandData =
 struct CommandDataContainer {
     CommandDataContainer() = default;
 
-    explicit CommandDataContainer(CommandData&& data_, u64 next_fence_, bool block_)
-        : data{std::move(data_)}, fence{next_fence_}, block(block_) {}
+    explicit CommandDataContainer(CommandData&& data_, bool block_)
+        : data{std::move(data_)}, block(block_) {}
 
     CommandData data;
-    u64 fence{};
     bool block{};
 };
 
 /// Struct used to synchronize the GPU thread
 struct SynchState final {
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
-    std::mutex write_lock;
+    /// Fences are the position of the command in the queue plus one, so they are assigned in
+    /// submission order without a lock and the GPU thread can derive them by counting.
+    using CommandQueue = Common::MPSCRing<CommandDataContainer, 0x400>;
     CommandQueue queue;
-    u64 last_fence{};
     std::atomic<u64> signaled_fence{};
-    std::condition_variable_any cv;
 };
 
 /// Class used to manage the GPU thread
@@ -4,6 +4,9 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <mutex>
+#include <unordered_map>
+
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
@@ -13,6 +16,7 @@
 #include "video_core/memory_manager.h"
 
 extern "C" {
+#include <libavutil/imgutils.h>
 #ifdef LIBVA_FOUND
 // for querying VAAPI driver information
 #include <libavutil/hwcontext_vaapi.h>
@@ -25,6 +29,7 @@ namespace {
 
 constexpr AVPixelFormat PreferredGpuFormat = AV_PIX_FMT_NV12;
 constexpr AVPixelFormat PreferredCpuFormat = AV_PIX_FMT_YUV420P;
+constexpr int TransferFrameAlignment = 64;
 constexpr std::array PreferredGpuDecoders = {
 #if defined (_WIN32)
 	AV_HWDEVICE_TYPE_CUDA,
@@ -75,6 +80,66 @@ std::string AVError(int errnum) {
 	return errbuf;
 }
 
+AVBufferRef* CreateDevice(AVHWDeviceType type) {
+	AVBufferRef* device{};
+	if (const int ret = av_hwdevice_ctx_create(&device, type, nullptr, nullptr, 0); ret < 0) {
+		LOG_DEBUG(HW_GPU, "av_hwdevice_ctx_create({}) failed: {}", av_hwdevice_get_type_name(type), AVError(ret));
+		return nullptr;
+	}
+
+#ifdef LIBVA_FOUND
+	if (type == AV_HWDEVICE_TYPE_VAAPI) {
+		// We need to determine if this is an impersonated VAAPI driver.
+		auto* hwctx = reinterpret_cast<AVHWDeviceContext*>(device->data);
+		auto* vactx = static_cast<AVVAAPIDeviceContext*>(hwctx->hwctx);
+		const char* vendor_name = vaQueryVendorString(vactx->display);
+		if (strstr(vendor_name, "VDPAU backend")) {
+			// VDPAU impersonated VAAPI impls are super buggy, we need to skip them.
+			LOG_DEBUG(HW_GPU, "Skipping VDPAU impersonated VAAPI driver");
+			av_buffer_unref(&device);
+			return nullptr;
+		} else {
+			// According to some user testing, certain VAAPI drivers (Intel?) could be buggy.
+			// Log the driver name just in case.
+			LOG_DEBUG(HW_GPU, "Using VAAPI driver: {}", vendor_name);
+		}
+	}
+#endif
+
+	return device;
+}
+
+// Creating a device takes long enough to stall the start of every video, so the devices are kept
+// for the lifetime of the process and shared by the streams decoding on them.
+class DevicePool {
+public:
+	~DevicePool() {
+		for (auto& [type, device] : m_devices) {
+			av_buffer_unref(&device);
+		}
+	}
+
+	// Returns a new reference to the device of the type, null when it can't be used.
+	AVBufferRef* Acquire(AVHWDeviceType type) {
+		std::scoped_lock lock{m_mutex};
+		auto [it, is_new] = m_devices.try_emplace(type, nullptr);
+		if (is_new) {
+			// Types that fail are remembered as null instead of being probed for every stream
+			it->second = CreateDevice(type);
+		}
+		return it->second ? av_buffer_ref(it->second) : nullptr;
+	}
+
+private:
+	std::mutex m_mutex;
+	std::unordered_map<AVHWDeviceType, AVBufferRef*> m_devices;
+};
+
+DevicePool& GetDevicePool() {
+	static DevicePool pool;
+	return pool;
+}
+
 }
 
 Packet::Packet(std::span<const u8> data) {
@@ -174,41 +239,22 @@ bool HardwareContext::InitializeForDecoder(DecoderContext& decoder_context, cons
 
 bool HardwareContext::InitializeWithType(AVHWDeviceType type) {
 	av_buffer_unref(&m_gpu_decoder);
-
-	if (const int ret = av_hwdevice_ctx_create(&m_gpu_decoder, type, nullptr, nullptr, 0); ret < 0) {
-		LOG_DEBUG(HW_GPU, "av_hwdevice_ctx_create({}) failed: {}", av_hwdevice_get_type_name(type), AVError(ret));
-		return false;
-	}
-
-#ifdef LIBVA_FOUND
-	if (type == AV_HWDEVICE_TYPE_VAAPI) {
-		// We need to determine if this is an impersonated VAAPI driver.
-		auto* hwctx = reinterpret_cast<AVHWDeviceContext*>(m_gpu_decoder->data);
-		auto* vactx = static_cast<AVVAAPIDeviceContext*>(hwctx->hwctx);
-		const char* vendor_name = vaQueryVendorString(vactx->display);
-		if (strstr(vendor_name, "VDPAU backend")) {
-			// VDPAU impersonated VAAPI impls are super buggy, we need to skip them.
-			LOG_DEBUG(HW_GPU, "Skipping VDPAU impersonated VAAPI driver");
-			return false;
-		} else {
-			// According to some user testing, certain VAAPI drivers (Intel?) could be buggy.
-			// Log the driver name just in case.
-			LOG_DEBUG(HW_GPU, "Using VAAPI driver: {}", vendor_name);
-		}
-	}
-#endif
-
-	return true;
+	m_gpu_decoder = GetDevicePool().Acquire(type);
+	return m_gpu_decoder != nullptr;
 }
 
 DecoderContext::DecoderContext(const Decoder& decoder) : m_decoder{decoder} {
 	m_codec_context = avcodec_alloc_context3(m_decoder.GetCodec());
 	av_opt_set(m_codec_context->priv_data, "tune", "zerolatency", 0);
+	// Frame threading holds every frame back by a packet per thread, but each execute has to
+	// output the frame of the surfaces in its registers, so only slices are decoded in parallel.
 	m_codec_context->thread_count = 0;
-	m_codec_context->thread_type &= ~FF_THREAD_FRAME;
+	m_codec_context->thread_type = FF_THREAD_SLICE;
 }
 
 DecoderContext::~DecoderContext() {
+	// Frames still queued for the VIC keep their buffers, the pool is freed after them
+	av_buffer_pool_uninit(&m_transfer_pool);
 	av_buffer_unref(&m_codec_context->hw_device_ctx);
 	avcodec_free_context(&m_codec_context);
 }
@@ -257,7 +303,10 @@ std::shared_ptr<Frame> DecoderContext::ReceiveFrame() {
 
 	m_final_frame = std::make_shared<Frame>();
 	if (m_codec_context->hw_device_ctx) {
-		m_final_frame->SetFormat(PreferredGpuFormat);
+		if (!AllocateTransferFrame(*m_final_frame, *intermediate_frame)) {
+			LOG_ERROR(HW_GPU, "Failed to allocate a {}x{} transfer frame", intermediate_frame->GetWidth(), intermediate_frame->GetHeight());
+			return {};
+		}
 		if (const int ret = av_hwframe_transfer_data(m_final_frame->GetFrame(), intermediate_frame->GetFrame(), 0); ret < 0) {
 			LOG_ERROR(HW_GPU, "av_hwframe_transfer_data error: {}", AVError(ret));
 			return {};
@@ -269,6 +318,35 @@ std::shared_ptr<Frame> DecoderContext::ReceiveFrame() {
 	return std::move(m_final_frame);
 }
 
+bool DecoderContext::AllocateTransferFrame(Frame& frame, const Frame& hw_frame) {
+	// Every transferred frame used to get freshly allocated planes, take them from a pool instead
+	// so the memory of frames the VIC is done with is reused.
+	const int width = hw_frame.GetWidth();
+	const int height = hw_frame.GetHeight();
+	const int size = av_image_get_buffer_size(PreferredGpuFormat, width, height, TransferFrameAlignment);
+	if (size < 0) {
+		return false;
+	}
+	if (!m_transfer_pool || m_transfer_pool_size != size) {
+		av_buffer_pool_uninit(&m_transfer_pool);
+		m_transfer_pool = av_buffer_pool_init(static_cast<size_t>(size), nullptr);
+		m_transfer_pool_size = size;
+		if (!m_transfer_pool) {
+			return false;
+		}
+	}
+
+	AVFrame* const dst = frame.GetFrame();
+	dst->buf[0] = av_buffer_pool_get(m_transfer_pool);
+	if (!dst->buf[0]) {
+		return false;
+	}
+	dst->format = PreferredGpuFormat;
+	dst->width = width;
+	dst->height = height;
+	return av_image_fill_arrays(dst->data, dst->linesize, dst->buf[0]->data, PreferredGpuFormat, width, height, TransferFrameAlignment) >= 0;
+}
+
 void DecodeApi::Reset() {
 	m_hardware_context.reset();
 	m_decoder_context.reset();
@@ -192,9 +192,13 @@ public:
     }
 
 private:
+    bool AllocateTransferFrame(Frame& frame, const Frame& hw_frame);
+
     const Decoder& m_decoder;
     AVCodecContext* m_codec_context{};
     std::shared_ptr<Frame> m_final_frame{};
+    AVBufferPool* m_transfer_pool{};
+    int m_transfer_pool_size{};
     bool m_decode_order{};
 };
 
@@ -11,15 +11,19 @@ namespace Tegra {
 namespace Host1x {
 
 SyncpointManager::ActionHandle SyncpointManager::RegisterAction(
-    std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage, u32 expected_value,
-    std::function<void()>&& action) {
+    std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage,
+    std::atomic<u32>& action_count, u32 expected_value, std::function<void()>&& action) {
     if (syncpoint.load(std::memory_order_acquire) >= expected_value) {
         action();
         return {};
     }
 
     std::scoped_lock lk(guard);
-    if (syncpoint.load(std::memory_order_relaxed) >= expected_value) {
+    // Counting the action before checking the value again pairs with Increment adding to the
+    // value before checking the count, at least one of them sees the other
+    action_count.fetch_add(1, std::memory_order_seq_cst);
+    if (syncpoint.load(std::memory_order_seq_cst) >= expected_value) {
+        action_count.fetch_sub(1, std::memory_order_relaxed);
         action();
         return {};
     }
@@ -34,6 +38,7 @@ SyncpointManager::ActionHandle SyncpointManager::RegisterAction(
 }
 
 void SyncpointManager::DeregisterAction(std::list<RegisteredAction>& action_storage,
+                                        std::atomic<u32>& action_count,
                                         const ActionHandle& handle) {
     std::scoped_lock lk(guard);
 
@@ -44,38 +49,47 @@ void SyncpointManager::DeregisterAction(std::list<RegisteredAction>& action_stor
     for (auto it = action_storage.begin(); it != action_storage.end(); it++) {
         if (it == handle) {
             action_storage.erase(it);
+            action_count.fetch_sub(1, std::memory_order_relaxed);
             return;
         }
     }
 }
 
 void SyncpointManager::DeregisterGuestAction(u32 syncpoint_id, const ActionHandle& handle) {
-    DeregisterAction(guest_action_storage[syncpoint_id], handle);
+    DeregisterAction(guest_action_storage[syncpoint_id], guest_action_counts[syncpoint_id],
+                     handle);
 }
 
 void SyncpointManager::DeregisterHostAction(u32 syncpoint_id, const ActionHandle& handle) {
-    DeregisterAction(host_action_storage[syncpoint_id], handle);
+    DeregisterAction(host_action_storage[syncpoint_id], host_action_counts[syncpoint_id], handle);
 }
 
 void SyncpointManager::IncrementGuest(u32 syncpoint_id) {
-    Increment(syncpoints_guest[syncpoint_id], wait_guest_cv, guest_action_storage[syncpoint_id]);
+    Increment(syncpoints_guest[syncpoint_id], guest_action_storage[syncpoint_id],
+              guest_action_counts[syncpoint_id]);
 }
 
 void SyncpointManager::IncrementHost(u32 syncpoint_id) {
-    Increment(syncpoints_host[syncpoint_id], wait_host_cv, host_action_storage[syncpoint_id]);
+    Increment(syncpoints_host[syncpoint_id], host_action_storage[syncpoint_id],
+              host_action_counts[syncpoint_id]);
 }
 
 void SyncpointManager::WaitGuest(u32 syncpoint_id, u32 expected_value) {
-    Wait(syncpoints_guest[syncpoint_id], wait_guest_cv, expected_value);
+    Wait(syncpoints_guest[syncpoint_id], expected_value);
 }
 
 void SyncpointManager::WaitHost(u32 syncpoint_id, u32 expected_value) {
-    Wait(syncpoints_host[syncpoint_id], wait_host_cv, expected_value);
+    Wait(syncpoints_host[syncpoint_id], expected_value);
 }
 
-void SyncpointManager::Increment(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                                 std::list<RegisteredAction>& action_storage) {
-    auto new_value{syncpoint.fetch_add(1, std::memory_order_acq_rel) + 1};
+void SyncpointManager::Increment(std::atomic<u32>& syncpoint,
+                                 std::list<RegisteredAction>& action_storage,
+                                 std::atomic<u32>& action_count) {
+    const u32 new_value{syncpoint.fetch_add(1, std::memory_order_seq_cst) + 1};
+    syncpoint.notify_all();
+    if (action_count.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
 
     std::scoped_lock lk(guard);
     auto it = action_storage.begin();
@@ -85,19 +99,16 @@ void SyncpointManager::Increment(std::atomic<u32>& syncpoint, std::condition_var
         }
         it->action();
         it = action_storage.erase(it);
+        action_count.fetch_sub(1, std::memory_order_relaxed);
     }
-    wait_cv.notify_all();
 }
 
-void SyncpointManager::Wait(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                            u32 expected_value) {
-    const auto pred = [&]() { return syncpoint.load(std::memory_order_acquire) >= expected_value; };
-    if (pred()) {
-        return;
+void SyncpointManager::Wait(std::atomic<u32>& syncpoint, u32 expected_value) {
+    u32 value = syncpoint.load(std::memory_order_acquire);
+    while (value < expected_value) {
+        syncpoint.wait(value, std::memory_order_acquire);
+        value = syncpoint.load(std::memory_order_acquire);
     }
-
-    std::unique_lock lk(guard);
-    wait_cv.wait(lk, pred);
 }
 
 } // namespace Host1x
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
@@ -5,7 +8,6 @@
 
 #include <array>
 #include <atomic>
-#include <condition_variable>
 #include <functional>
 #include <list>
 #include <mutex>
@@ -37,13 +39,15 @@ public:
     template <typename Func>
     ActionHandle RegisterGuestAction(u32 syncpoint_id, u32 expected_value, Func&& action) {
         return RegisterAction(syncpoints_guest[syncpoint_id], guest_action_storage[syncpoint_id],
-                              expected_value, std::move(action));
+                              guest_action_counts[syncpoint_id], expected_value,
+                              std::move(action));
     }
 
     template <typename Func>
     ActionHandle RegisterHostAction(u32 syncpoint_id, u32 expected_value, Func&& action) {
         return RegisterAction(syncpoints_host[syncpoint_id], host_action_storage[syncpoint_id],
-                              expected_value, std::move(action));
+                              host_action_counts[syncpoint_id], expected_value,
+                              std::move(action));
     }
 
     void DeregisterGuestAction(u32 syncpoint_id, const ActionHandle& handle);
@@ -67,16 +71,19 @@ public:
     }
 
 private:
-    void Increment(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv,
-                   std::list<RegisteredAction>& action_storage);
+    void Increment(std::atomic<u32>& syncpoint, std::list<RegisteredAction>& action_storage,
+                   std::atomic<u32>& action_count);
 
     ActionHandle RegisterAction(std::atomic<u32>& syncpoint,
-                                std::list<RegisteredAction>& action_storage, u32 expected_value,
+                                std::list<RegisteredAction>& action_storage,
+                                std::atomic<u32>& action_count, u32 expected_value,
                                 std::function<void()>&& action);
 
-    void DeregisterAction(std::list<RegisteredAction>& action_storage, const ActionHandle& handle);
+    void DeregisterAction(std::list<RegisteredAction>& action_storage,
+                          std::atomic<u32>& action_count, const ActionHandle& handle);
 
-    void Wait(std::atomic<u32>& syncpoint, std::condition_variable& wait_cv, u32 expected_value);
+    /// Sleeps on the address of the syncpoint, only its own increments wake the waiter
+    void Wait(std::atomic<u32>& syncpoint, u32 expected_value);
 
     static constexpr size_t NUM_MAX_SYNCPOINTS = 192;
 
@@ -86,9 +93,11 @@ private:
     std::array<std::list<RegisteredAction>, NUM_MAX_SYNCPOINTS> guest_action_storage;
     std::array<std::list<RegisteredAction>, NUM_MAX_SYNCPOINTS> host_action_storage;
 
+    /// Registered actions per syncpoint, lets increments skip the lock when there are none
+    std::array<std::atomic<u32>, NUM_MAX_SYNCPOINTS> guest_action_counts{};
+    std::array<std::atomic<u32>, NUM_MAX_SYNCPOINTS> host_action_counts{};
+
     std::mutex guard;
-    std::condition_variable wait_guest_cv;
-    std::condition_variable wait_host_cv;
 };
 
 } // namespace Host1x
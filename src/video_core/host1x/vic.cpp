@@ -4,8 +4,9 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
-#include <tuple>
+#include <optional>
 #include <stdint.h>
 
 extern "C" {
@@ -73,6 +74,125 @@ void SwizzleSurface(std::span<u8> output, u32 out_stride, std::span<const u8> in
     }
 }
 
+/// Region of the output surface a slot is blended to, in output surface pixels.
+struct BlendRect {
+    u32 source_left;
+    u32 source_right;
+    u32 source_top;
+    u32 source_bottom;
+    u32 rect_left;
+    u32 rect_right;
+};
+
+std::optional<BlendRect> GetBlendRect(const ConfigStruct& config, const SlotStruct& slot) {
+    constexpr auto add_one([](u32 v) -> u32 { return v != 0 ? v + 1 : 0; });
+
+    auto source_left{add_one(u32(slot.config.source_rect_left.Value()))};
+    auto source_right{add_one(u32(slot.config.source_rect_right.Value()))};
+    auto source_top{add_one(u32(slot.config.source_rect_top.Value()))};
+    auto source_bottom{add_one(u32(slot.config.source_rect_bottom.Value()))};
+
+    const auto dest_left{add_one(u32(slot.config.dest_rect_left.Value()))};
+    const auto dest_right{add_one(u32(slot.config.dest_rect_right.Value()))};
+    const auto dest_top{add_one(u32(slot.config.dest_rect_top.Value()))};
+    const auto dest_bottom{add_one(u32(slot.config.dest_rect_bottom.Value()))};
+
+    auto rect_left{add_one(config.output_config.target_rect_left.Value())};
+    auto rect_right{add_one(config.output_config.target_rect_right.Value())};
+    auto rect_top{add_one(config.output_config.target_rect_top.Value())};
+    auto rect_bottom{add_one(config.output_config.target_rect_bottom.Value())};
+
+    rect_left = (std::max)(rect_left, dest_left);
+    rect_right = (std::min)(rect_right, dest_right);
+    rect_top = (std::max)(rect_top, dest_top);
+    rect_bottom = (std::min)(rect_bottom, dest_bottom);
+
+    source_left = (std::max)(source_left, rect_left);
+    source_right = (std::min)(source_right, rect_right);
+    source_top = (std::max)(source_top, rect_top);
+    source_bottom = (std::min)(source_bottom, rect_bottom);
+
+    if (source_left >= source_right || source_top >= source_bottom) {
+        return std::nullopt;
+    }
+
+    const auto out_surface_width{config.output_surface_config.out_surface_width + 1};
+    const auto out_surface_height{config.output_surface_config.out_surface_height + 1};
+
+    source_bottom = (std::min)(source_bottom, out_surface_height);
+    source_right = (std::min)(source_right, out_surface_width);
+
+    return BlendRect{
+        .source_left = source_left,
+        .source_right = source_right,
+        .source_top = source_top,
+        .source_bottom = source_bottom,
+        .rect_left = rect_left,
+        .rect_right = rect_right,
+    };
+}
+
+/// Colour conversion of a slot, read once for the whole frame.
+class ColorMatrix {
+public:
+    explicit ColorMatrix(const SlotStruct& slot)
+        : r0c0{s32(slot.color_matrix.matrix_coeff00.Value())},
+          r0c1{s32(slot.color_matrix.matrix_coeff01.Value())},
+          r0c2{s32(slot.color_matrix.matrix_coeff02.Value())},
+          r0c3{s32(slot.color_matrix.matrix_coeff03.Value())},
+          r1c0{s32(slot.color_matrix.matrix_coeff10.Value())},
+          r1c1{s32(slot.color_matrix.matrix_coeff11.Value())},
+          r1c2{s32(slot.color_matrix.matrix_coeff12.Value())},
+          r1c3{s32(slot.color_matrix.matrix_coeff13.Value())},
+          r2c0{s32(slot.color_matrix.matrix_coeff20.Value())},
+          r2c1{s32(slot.color_matrix.matrix_coeff21.Value())},
+          r2c2{s32(slot.color_matrix.matrix_coeff22.Value())},
+          r2c3{s32(slot.color_matrix.matrix_coeff23.Value())},
+          shift{s32(slot.color_matrix.matrix_r_shift.Value())},
+          clamp_min{s32(slot.config.soft_clamp_low.Value())},
+          clamp_max{s32(slot.config.soft_clamp_high.Value())} {}
+
+    // clang-format off
+    // Colour conversion is enabled, this is a 3x4 * 4x1 matrix multiplication, resulting in a 3x1 matrix.
+    // | r0c0 r0c1 r0c2 r0c3 |   | R |   | R |
+    // | r1c0 r1c1 r1c2 r1c3 | * | G | = | G |
+    // | r2c0 r2c1 r2c2 r2c3 |   | B |   | B |
+    //                           | 1 |
+    // clang-format on
+    [[nodiscard]] Pixel Apply(const Pixel& in_pixel) const {
+        s32 r = in_pixel.r * r0c0 + in_pixel.g * r0c1 + in_pixel.b * r0c2;
+        s32 g = in_pixel.r * r1c0 + in_pixel.g * r1c1 + in_pixel.b * r1c2;
+        s32 b = in_pixel.r * r2c0 + in_pixel.g * r2c1 + in_pixel.b * r2c2;
+
+        r >>= shift;
+        g >>= shift;
+        b >>= shift;
+
+        r += r0c3;
+        g += r1c3;
+        b += r2c3;
+
+        r >>= 8;
+        g >>= 8;
+        b >>= 8;
+
+        return {
+            u16(std::clamp(r, clamp_min, clamp_max)),
+            u16(std::clamp(g, clamp_min, clamp_max)),
+            u16(std::clamp(b, clamp_min, clamp_max)),
+            u16(std::clamp(s32(in_pixel.a), clamp_min, clamp_max)),
+        };
+    }
+
+private:
+    s32 r0c0, r0c1, r0c2, r0c3;
+    s32 r1c0, r1c1, r1c2, r1c3;
+    s32 r2c0, r2c1, r2c2, r2c3;
+    s32 shift;
+    s32 clamp_min;
+    s32 clamp_max;
+};
+
 } // namespace
 
 Vic::Vic(Host1x& host1x_, s32 id_, u32 syncpt, FrameQueue& frame_queue_)
@@ -107,10 +227,11 @@ void Vic::Execute() {
     auto output_height{config.output_surface_config.out_surface_height + 1};
     output_surface.resize_destructive(output_width * output_height);
 
+    bool is_converted{false};
     if (Settings::values.nvdec_emulation.GetValue() == Settings::NvdecEmulation::Off) [[unlikely]] {
         // Fill the frame with black, as otherwise they can have random data and be very glitchy.
         std::fill(output_surface.begin(), output_surface.end(), Pixel{});
-    } else {
+    } else if (is_converted = ConvertABGR(config); !is_converted) {
         for (size_t i = 0; i < config.slot_structs.size(); i++) {
             auto& slot_config{config.slot_structs[i]};
             if (!slot_config.config.slot_enable) {
@@ -146,10 +267,10 @@ void Vic::Execute() {
     switch (config.output_surface_config.out_pixel_format) {
     case VideoPixelFormat::A8B8G8R8:
     case VideoPixelFormat::X8B8G8R8:
-        WriteABGR(config.output_surface_config, VideoPixelFormat::A8B8G8R8);
+        WriteABGR(config.output_surface_config, VideoPixelFormat::A8B8G8R8, is_converted);
         break;
     case VideoPixelFormat::A8R8G8B8:
-        WriteABGR(config.output_surface_config, VideoPixelFormat::A8R8G8B8);
+        WriteABGR(config.output_surface_config, VideoPixelFormat::A8R8G8B8, is_converted);
         break;
     case VideoPixelFormat::Y8__V8U8_N420:
         WriteY8__V8U8_N420(config.output_surface_config);
@@ -302,45 +423,16 @@ void Vic::ReadY8__V8U8_N420(const SlotStruct& slot, std::span<const PlaneOffsets
 }
 
 void Vic::Blend(const ConfigStruct& config, const SlotStruct& slot) {
-    constexpr auto add_one([](u32 v) -> u32 { return v != 0 ? v + 1 : 0; });
-
-    auto source_left{add_one(u32(slot.config.source_rect_left.Value()))};
-    auto source_right{add_one(u32(slot.config.source_rect_right.Value()))};
-    auto source_top{add_one(u32(slot.config.source_rect_top.Value()))};
-    auto source_bottom{add_one(u32(slot.config.source_rect_bottom.Value()))};
-
-    const auto dest_left{add_one(u32(slot.config.dest_rect_left.Value()))};
-    const auto dest_right{add_one(u32(slot.config.dest_rect_right.Value()))};
-    const auto dest_top{add_one(u32(slot.config.dest_rect_top.Value()))};
-    const auto dest_bottom{add_one(u32(slot.config.dest_rect_bottom.Value()))};
-
-    auto rect_left{add_one(config.output_config.target_rect_left.Value())};
-    auto rect_right{add_one(config.output_config.target_rect_right.Value())};
-    auto rect_top{add_one(config.output_config.target_rect_top.Value())};
-    auto rect_bottom{add_one(config.output_config.target_rect_bottom.Value())};
-
-    rect_left = (std::max)(rect_left, dest_left);
-    rect_right = (std::min)(rect_right, dest_right);
-    rect_top = (std::max)(rect_top, dest_top);
-    rect_bottom = (std::min)(rect_bottom, dest_bottom);
-
-    source_left = (std::max)(source_left, rect_left);
-    source_right = (std::min)(source_right, rect_right);
-    source_top = (std::max)(source_top, rect_top);
-    source_bottom = (std::min)(source_bottom, rect_bottom);
-
-    if (source_left >= source_right || source_top >= source_bottom) {
+    const auto rect{GetBlendRect(config, slot)};
+    if (!rect) {
         return;
     }
+    const auto [source_left, source_right, source_top, source_bottom, rect_left, rect_right] =
+        *rect;
 
     const auto out_surface_width{config.output_surface_config.out_surface_width + 1};
-    [[maybe_unused]] const auto out_surface_height{config.output_surface_config.out_surface_height +
-                                                   1};
     const auto in_surface_width{slot.surface_config.slot_surface_width + 1};
 
-    source_bottom = (std::min)(source_bottom, out_surface_height);
-    source_right = (std::min)(source_right, out_surface_width);
-
     // TODO Alpha blending. No games I've seen use more than a single surface or supply an alpha
     // below max, so it's ignored for now.
 
@@ -354,66 +446,122 @@ void Vic::Blend(const ConfigStruct& config, const SlotStruct& slot) {
                         &slot_surface[src_line + source_left], copy_width * sizeof(Pixel));
         }
     } else {
-        // clang-format off
-        // Colour conversion is enabled, this is a 3x4 * 4x1 matrix multiplication, resulting in a 3x1 matrix.
-        // | r0c0 r0c1 r0c2 r0c3 |   | R |   | R |
-        // | r1c0 r1c1 r1c2 r1c3 | * | G | = | G |
-        // | r2c0 r2c1 r2c2 r2c3 |   | B |   | B |
-        //                           | 1 |
-        const auto r0c0 = s32(slot.color_matrix.matrix_coeff00.Value());
-        const auto r0c1 = s32(slot.color_matrix.matrix_coeff01.Value());
-        const auto r0c2 = s32(slot.color_matrix.matrix_coeff02.Value());
-        const auto r0c3 = s32(slot.color_matrix.matrix_coeff03.Value());
-        const auto r1c0 = s32(slot.color_matrix.matrix_coeff10.Value());
-        const auto r1c1 = s32(slot.color_matrix.matrix_coeff11.Value());
-        const auto r1c2 = s32(slot.color_matrix.matrix_coeff12.Value());
-        const auto r1c3 = s32(slot.color_matrix.matrix_coeff13.Value());
-        const auto r2c0 = s32(slot.color_matrix.matrix_coeff20.Value());
-        const auto r2c1 = s32(slot.color_matrix.matrix_coeff21.Value());
-        const auto r2c2 = s32(slot.color_matrix.matrix_coeff22.Value());
-        const auto r2c3 = s32(slot.color_matrix.matrix_coeff23.Value());
-
-        const auto shift = s32(slot.color_matrix.matrix_r_shift.Value());
-        const auto clamp_min = s32(slot.config.soft_clamp_low.Value());
-        const auto clamp_max = s32(slot.config.soft_clamp_high.Value());
-
-        auto MatMul = [&](const Pixel& in_pixel) -> std::tuple<s32, s32, s32, s32> {
-            auto r = s32(in_pixel.r);
-            auto g = s32(in_pixel.g);
-            auto b = s32(in_pixel.b);
-
-            r = in_pixel.r * r0c0 + in_pixel.g * r0c1 + in_pixel.b * r0c2;
-            g = in_pixel.r * r1c0 + in_pixel.g * r1c1 + in_pixel.b * r1c2;
-            b = in_pixel.r * r2c0 + in_pixel.g * r2c1 + in_pixel.b * r2c2;
-
-            r >>= shift;
-            g >>= shift;
-            b >>= shift;
-
-            r += r0c3;
-            g += r1c3;
-            b += r2c3;
-
-            r >>= 8;
-            g >>= 8;
-            b >>= 8;
-
-            return {r, g, b, s32(in_pixel.a)};
-        };
-
+        const ColorMatrix color_matrix{slot};
         for (u32 y = source_top; y < source_bottom; y++) {
             const auto src{y * in_surface_width + source_left};
             const auto dst{y * out_surface_width + rect_left};
             for (u32 x = source_left; x < source_right; x++) {
-                auto [r, g, b, a] = MatMul(slot_surface[src + x]);
-                r = std::clamp(r, clamp_min, clamp_max);
-                g = std::clamp(g, clamp_min, clamp_max);
-                b = std::clamp(b, clamp_min, clamp_max);
-                a = std::clamp(a, clamp_min, clamp_max);
-                output_surface[dst + x] = {u16(r), u16(g), u16(b), u16(a)};
+                output_surface[dst + x] = color_matrix.Apply(slot_surface[src + x]);
+            }
+        }
+    }
+}
+
+bool Vic::ConvertABGR(const ConfigStruct& config) {
+    const auto format{config.output_surface_config.out_pixel_format.Value()};
+    if (format != VideoPixelFormat::A8B8G8R8 && format != VideoPixelFormat::X8B8G8R8 &&
+        format != VideoPixelFormat::A8R8G8B8) {
+        return false;
+    }
+    std::optional<size_t> slot_index;
+    for (size_t i = 0; i < config.slot_structs.size(); i++) {
+        if (!config.slot_structs[i].config.slot_enable) {
+            continue;
+        }
+        if (slot_index) {
+            // Slots are blended over each other, go through the intermediate surfaces
+            return false;
+        }
+        slot_index = i;
+    }
+    if (!slot_index) {
+        return false;
+    }
+    const SlotStruct& slot{config.slot_structs[*slot_index]};
+    const auto rect{GetBlendRect(config, slot)};
+    if (slot.config.frame_format != DXVAHD_FRAME_FORMAT::PROGRESSIVE ||
+        (rect && (rect->source_left != 0 || rect->rect_left != 0))) {
+        return false;
+    }
+
+    const auto luma_offset{regs.surfaces[*slot_index][SurfaceIndex::Current].luma.Address()};
+    if (nvdec_id == -1) {
+        nvdec_id = frame_queue.VicFindNvdecFdFromOffset(luma_offset);
+    }
+    const auto frame{frame_queue.GetFrame(nvdec_id, luma_offset)};
+    if (!frame) {
+        // Same as the intermediate surfaces, the previous frame is written again
+        return true;
+    }
+    bool planar{};
+    switch (frame->GetPixelFormat()) {
+    case AV_PIX_FMT_YUV420P:
+        planar = true;
+        break;
+    case AV_PIX_FMT_NV12:
+        planar = false;
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented slot pixel format {}",
+                          u32(slot.surface_config.slot_pixel_format.Value()));
+        return true;
+    }
+
+    const auto& output_surface_config{config.output_surface_config};
+    const auto out_luma_width{output_surface_config.out_luma_width + 1};
+    const auto out_luma_height{output_surface_config.out_luma_height + 1};
+    const auto out_luma_stride{Common::AlignUp(out_luma_width * 4, 0x10)};
+    luma_scratch.resize_destructive(out_luma_height * out_luma_stride);
+    if (!rect) {
+        return true;
+    }
+
+    // Only the pixels covered by the frame, the slot, the blend rectangle and the output surface
+    // are written, matching what goes through the slot and output surfaces.
+    const auto surface_width{(std::min)(output_surface_config.out_surface_width + 1,
+                                        out_luma_width)};
+    const auto surface_height{(std::min)(output_surface_config.out_surface_height + 1,
+                                         out_luma_height)};
+    const auto slot_width{slot.surface_config.slot_surface_width + 1};
+    const auto slot_height{slot.surface_config.slot_surface_height + 1};
+    const auto in_width{u32((std::min)(frame->GetWidth(), s32(slot_width)))};
+    const auto in_height{u32((std::min)(frame->GetHeight(), s32(slot_height)))};
+    const u32 width{(std::min)({rect->source_right, in_width, surface_width})};
+    const u32 bottom{(std::min)({rect->source_bottom, in_height, surface_height})};
+
+    const auto in_luma_stride{frame->GetStride(0)};
+    const auto in_chroma_stride{frame->GetStride(1)};
+    const auto* luma_buffer{frame->GetPlane(0)};
+    const auto* chroma_u_buffer{frame->GetPlane(1)};
+    const auto* chroma_v_buffer{frame->GetPlane(2)};
+
+    const bool is_argb{format == VideoPixelFormat::A8R8G8B8};
+    const bool matrix_enable{slot.color_matrix.matrix_enable != 0};
+    const ColorMatrix color_matrix{slot};
+    const auto alpha{u16(slot.config.planar_alpha.Value())};
+    for (u32 y = rect->source_top; y < bottom; y++) {
+        const u8* const src_luma{luma_buffer + y * in_luma_stride};
+        const u8* const src_chroma_u{chroma_u_buffer + (y / 2) * in_chroma_stride};
+        const u8* const src_chroma_v{planar ? chroma_v_buffer + (y / 2) * in_chroma_stride
+                                            : nullptr};
+        u8* const dst{luma_scratch.data() + y * out_luma_stride};
+        for (u32 x = 0; x < width; x++) {
+            Pixel pixel{
+                .r = u16(src_luma[x] << 2),
+                .g = u16((planar ? src_chroma_u[x / 2] : src_chroma_u[(x & ~1) + 0]) << 2),
+                .b = u16((planar ? src_chroma_v[x / 2] : src_chroma_u[(x & ~1) + 1]) << 2),
+                .a = alpha,
+            };
+            if (matrix_enable) {
+                pixel = color_matrix.Apply(pixel);
             }
+            dst[x * 4 + 0] = u8((is_argb ? pixel.b : pixel.r) >> 2);
+            dst[x * 4 + 1] = u8(pixel.g >> 2);
+            dst[x * 4 + 2] = u8((is_argb ? pixel.r : pixel.b) >> 2);
+            dst[x * 4 + 3] = u8(pixel.a >> 2);
         }
     }
+    return true;
 }
 
 void Vic::WriteY8__V8U8_N420(const OutputSurfaceConfig& output_surface_config) {
@@ -529,7 +677,8 @@ void Vic::WriteY8__V8U8_N420(const OutputSurfaceConfig& output_surface_config) {
     }
 }
 
-void Vic::WriteABGR(const OutputSurfaceConfig& output_surface_config, VideoPixelFormat format) {
+void Vic::WriteABGR(const OutputSurfaceConfig& output_surface_config, VideoPixelFormat format,
+                    bool is_converted) {
     constexpr u32 BytesPerPixel = 4;
 
     auto surface_width{output_surface_config.out_surface_width + 1};
@@ -579,9 +728,10 @@ void Vic::WriteABGR(const OutputSurfaceConfig& output_surface_config, VideoPixel
             surface_stride * surface_height * BytesPerPixel, out_luma_width, out_luma_height,
             out_luma_stride, out_luma_size, block_height, out_swizzle_size);
 
-        luma_scratch.resize_destructive(out_luma_size);
-
-        Decode(luma_scratch);
+        if (!is_converted) {
+            luma_scratch.resize_destructive(out_luma_size);
+            Decode(luma_scratch);
+        }
 
         Tegra::Memory::GpuGuestMemoryScoped<u8, Core::Memory::GuestMemoryFlags::SafeWrite> out_luma(
             memory_manager, regs.output_surface.luma.Address(), out_swizzle_size, &swizzle_scratch);
@@ -602,6 +752,11 @@ void Vic::WriteABGR(const OutputSurfaceConfig& output_surface_config, VideoPixel
             surface_stride * surface_height * BytesPerPixel, out_luma_width, out_luma_height,
             out_luma_stride, out_luma_size);
 
+        if (is_converted) {
+            memory_manager.WriteBlock(regs.output_surface.luma.Address(), luma_scratch.data(),
+                                      out_luma_size);
+            break;
+        }
         luma_scratch.resize_destructive(out_luma_size);
 
         Tegra::Memory::GpuGuestMemoryScoped<u8, Core::Memory::GuestMemoryFlags::SafeWrite> out_luma(
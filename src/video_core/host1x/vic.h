@@ -614,11 +614,16 @@ public:
 private:
     void Execute();
     void Blend(const ConfigStruct& config, const SlotStruct& slot);
+    /// Converts a single progressive slot straight from the decoded frame to the ABGR output,
+    /// without going through the slot and output surfaces.
+    /// @returns True when the output has been written to the luma scratch buffer
+    bool ConvertABGR(const ConfigStruct& config);
     void ReadProgressiveY8__V8U8_N420(const SlotStruct& slot, std::span<const PlaneOffsets> offsets, std::shared_ptr<const FFmpeg::Frame> frame, bool planar, bool interlaced);
     void ReadInterlacedY8__V8U8_N420(const SlotStruct& slot, std::span<const PlaneOffsets> offsets, std::shared_ptr<const FFmpeg::Frame> frame, bool planar, bool top_field);
     void ReadY8__V8U8_N420(const SlotStruct& slot, std::span<const PlaneOffsets> offsets, std::shared_ptr<const FFmpeg::Frame> frame, bool planar);
     void WriteY8__V8U8_N420(const OutputSurfaceConfig& output_surface_config);
-    void WriteABGR(const OutputSurfaceConfig& output_surface_config, VideoPixelFormat format);
+    void WriteABGR(const OutputSurfaceConfig& output_surface_config, VideoPixelFormat format,
+                   bool is_converted);
 
     s32 id;
     s32 nvdec_id{-1};
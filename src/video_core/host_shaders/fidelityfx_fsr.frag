@@ -26,12 +26,19 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#if USE_RCAS
+// Sharpening is done by the present pass, its push constants are taken by the layer vertices
+layout (constant_id = 0) const uint RcasCon0 = 0;
+layout (constant_id = 1) const uint RcasCon1 = 0;
+#define Const0 uvec4(RcasCon0, RcasCon1, 0, 0)
+#else
 layout( push_constant ) uniform constants {
     uvec4 Const0;
     uvec4 Const1;
     uvec4 Const2;
     uvec4 Const3;
 };
+#endif
 
 layout(set=0,binding=0) uniform sampler2D InputTexture;
 
@@ -1,8 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <algorithm>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -64,6 +69,29 @@ public:
         }
     }
 
+    /// Returns the accumulated ranges sorted by address, with the overlapping and adjacent ones
+    /// merged. They stay valid until Clear is called.
+    std::span<const std::pair<VAddr, size_t>> SortAndMerge() {
+        if (!has_collected) {
+            return {};
+        }
+        has_collected = false;
+        buffer.emplace_back(start_address, accumulated_size);
+        std::ranges::sort(buffer);
+        size_t merged = 0;
+        for (size_t index = 1; index < buffer.size(); ++index) {
+            auto& [merged_address, merged_size] = buffer[merged];
+            const auto [address, size] = buffer[index];
+            if (address <= merged_address + merged_size) {
+                merged_size = (std::max)(merged_size, address + size - merged_address);
+            } else {
+                buffer[++merged] = {address, size};
+            }
+        }
+        buffer.resize(merged + 1);
+        return buffer;
+    }
+
 private:
     static constexpr size_t atomicity_bits = 5;
     static constexpr size_t atomicity_size = 1ULL << atomicity_bits;
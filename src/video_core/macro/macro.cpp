@@ -4,10 +4,13 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <optional>
 #include <span>
+#include <utility>
+#include <vector>
 
 #include "common/container_hash.h"
 
@@ -23,6 +26,8 @@
 
 #ifdef ARCHITECTURE_x86_64
 #include "video_core/macro/macro_jit_x64.h"
+#elif defined(ARCHITECTURE_arm64)
+#include "video_core/macro/macro_jit_arm64.h"
 #endif
 
 namespace Tegra {
@@ -54,10 +59,23 @@ static void Dump(u64 hash, std::span<const u32> code, bool decompiled = false) {
     macro_file.write(reinterpret_cast<const char*>(code.data()), code.size_bytes());
 }
 
+namespace {
+/// Executions between logs of the macro profile
+constexpr u64 PROFILE_LOG_INTERVAL = 1ULL << 22;
+
+/// Number of macros listed in the profile
+constexpr size_t PROFILE_NUM_HOTTEST = 8;
+} // Anonymous namespace
+
 MacroEngine::MacroEngine(Engines::Maxwell3D& maxwell3d_)
-    : hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d_)}, maxwell3d{maxwell3d_} {}
+    : is_profiling{Settings::values.log_macro_profile.GetValue()},
+      hle_macros{std::make_unique<Tegra::HLEMacro>(maxwell3d_)}, maxwell3d{maxwell3d_} {}
 
-MacroEngine::~MacroEngine() = default;
+MacroEngine::~MacroEngine() {
+    if (is_profiling) {
+        LogProfile();
+    }
+}
 
 void MacroEngine::AddCode(u32 method, u32 data) {
     uploaded_macro_code[method].push_back(data);
@@ -75,6 +93,9 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
         if (cache_info.has_hle_program) {
             cache_info.hle_program->Execute(parameters, method);
         } else {
+            if (is_profiling) [[unlikely]] {
+                ProfileExecution(cache_info.hash);
+            }
             maxwell3d.RefreshParameters();
             cache_info.lle_program->Execute(parameters, method);
         }
@@ -112,6 +133,9 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
 
         auto hle_program = hle_macros->GetHLEProgram(cache_info.hash);
         if (!hle_program || Settings::values.disable_macro_hle) {
+            if (is_profiling) [[unlikely]] {
+                ProfileExecution(cache_info.hash);
+            }
             maxwell3d.RefreshParameters();
             cache_info.lle_program->Execute(parameters, method);
         } else {
@@ -126,12 +150,36 @@ void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
     }
 }
 
+void MacroEngine::ProfileExecution(u64 hash) {
+    ++lle_executions[hash];
+    if (++num_profiled_executions % PROFILE_LOG_INTERVAL == 0) {
+        LogProfile();
+    }
+}
+
+void MacroEngine::LogProfile() const {
+    if (lle_executions.empty()) {
+        return;
+    }
+    std::vector<std::pair<u64, u64>> hottest(lle_executions.begin(), lle_executions.end());
+    const size_t num_hottest = std::min(hottest.size(), PROFILE_NUM_HOTTEST);
+    std::partial_sort(hottest.begin(), hottest.begin() + num_hottest, hottest.end(),
+                      [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+    LOG_INFO(HW_GPU, "{} macro executions without HLE across {} macros, hottest:",
+             num_profiled_executions, lle_executions.size());
+    for (size_t i = 0; i < num_hottest; ++i) {
+        LOG_INFO(HW_GPU, "  {:016X}: {} executions", hottest[i].first, hottest[i].second);
+    }
+}
+
 std::unique_ptr<MacroEngine> GetMacroEngine(Engines::Maxwell3D& maxwell3d) {
     if (Settings::values.disable_macro_jit) {
         return std::make_unique<MacroInterpreter>(maxwell3d);
     }
 #ifdef ARCHITECTURE_x86_64
     return std::make_unique<MacroJITx64>(maxwell3d);
+#elif defined(ARCHITECTURE_arm64)
+    return std::make_unique<MacroJITArm64>(maxwell3d);
 #else
     return std::make_unique<MacroInterpreter>(maxwell3d);
 #endif
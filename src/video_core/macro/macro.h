@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -134,7 +137,16 @@ private:
         bool has_hle_program{};
     };
 
+    /// Counts an execution of a macro without an HLE program, the hottest ones get logged
+    void ProfileExecution(u64 hash);
+
+    /// Logs the macros without an HLE program that were executed the most
+    void LogProfile() const;
+
     std::unordered_map<u32, CacheInfo> macro_cache;
+    std::unordered_map<u64, u64> lle_executions; ///< Executions of macros run without HLE
+    u64 num_profiled_executions{};
+    bool is_profiling{};
     std::unordered_map<u32, std::vector<u32>> uploaded_macro_code;
     std::unique_ptr<HLEMacro> hle_macros;
     Engines::Maxwell3D& maxwell3d;
@@ -0,0 +1,549 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <oaknut/code_block.hpp>
+#include <oaknut/oaknut.hpp>
+
+#include "common/assert.h"
+#include "common/container_hash.h"
+#include "common/logging/log.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/macro/macro_jit_arm64.h"
+
+namespace Tegra {
+namespace {
+using namespace oaknut::util;
+
+// All persistent state lives in callee-saved registers so calls into Maxwell3D don't clobber it.
+constexpr oaknut::XReg STATE = X19;
+constexpr oaknut::XReg PARAMETERS = X20;
+constexpr oaknut::XReg MAX_PARAMETER = X21;
+constexpr oaknut::WReg METHOD_ADDRESS = W22;
+constexpr oaknut::WReg RESULT = W23;
+constexpr oaknut::WReg CARRY = W24;
+
+// Upper bound of host instructions emitted per macro instruction, including its delay slot copy.
+constexpr size_t MAX_INSTRUCTIONS_PER_OPCODE = 128;
+constexpr size_t PROLOGUE_EPILOGUE_SIZE = 64;
+
+void Send(Engines::Maxwell3D* maxwell3d, Macro::MethodAddress method_address, u32 value) {
+    maxwell3d->CallMethod(method_address.address, value, true);
+}
+
+void WarnInvalidParameter(uintptr_t parameter, uintptr_t max_parameter) {
+    LOG_CRITICAL(HW_GPU,
+                 "Macro JIT: invalid parameter access 0x{:x} (0x{:x} is the last parameter)",
+                 parameter, max_parameter - sizeof(u32));
+}
+
+class MacroJITArm64Impl final : public CachedMacro {
+public:
+    explicit MacroJITArm64Impl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code_)
+        : code{code_}, maxwell3d{maxwell3d_},
+          mem{(code.size() * MAX_INSTRUCTIONS_PER_OPCODE + PROLOGUE_EPILOGUE_SIZE) *
+              sizeof(u32)},
+          c{mem.ptr(), mem.ptr()}, labels(code.size()) {
+        Compile();
+    }
+
+    void Execute(const std::vector<u32>& parameters, u32 method) override;
+
+    [[nodiscard]] const std::vector<u32>& Code() const noexcept {
+        return code;
+    }
+
+private:
+    void Optimizer_ScanFlags();
+
+    void Compile();
+    void Compile_Instruction(u32 index, bool is_delay_slot);
+    void Compile_DelaySlot(u32 index);
+
+    void Compile_ALU(Macro::Opcode opcode);
+    void Compile_AddImmediate(Macro::Opcode opcode);
+    void Compile_ExtractInsert(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode);
+    void Compile_ExtractShiftLeftRegister(Macro::Opcode opcode);
+    void Compile_Read(Macro::Opcode opcode);
+    void Compile_Branch(Macro::Opcode opcode, u32 index);
+
+    oaknut::WReg Compile_FetchParameter();
+    oaknut::WReg Compile_GetRegister(u32 index, oaknut::WReg dst);
+    void Compile_AddSignedImmediate(oaknut::WReg dst, s32 immediate);
+
+    void Compile_ProcessResult(Macro::ResultOperation operation, u32 reg);
+    void Compile_Send(oaknut::WReg value);
+    void Compile_CallFunction(const void* function);
+
+    struct JITState {
+        Engines::Maxwell3D* maxwell3d{};
+        std::array<u32, Macro::NUM_MACRO_REGISTERS> registers{};
+    };
+    static_assert(offsetof(JITState, maxwell3d) == 0, "Maxwell3D is not at 0x0");
+    using ProgramType = void (*)(JITState*, const u32*, const u32*);
+
+    struct OptimizerState {
+        bool can_skip_carry{};
+        bool skip_dummy_addimmediate{};
+    };
+    OptimizerState optimizer{};
+
+    ProgramType program{nullptr};
+
+    const std::vector<u32> code;
+    Engines::Maxwell3D& maxwell3d;
+
+    oaknut::CodeBlock mem;
+    oaknut::CodeGenerator c;
+    std::vector<oaknut::Label> labels;
+    oaknut::Label end_of_code;
+};
+
+void MacroJITArm64Impl::Execute(const std::vector<u32>& parameters, u32 method) {
+    ASSERT_OR_EXECUTE(program != nullptr, { return; });
+    JITState state{};
+    state.maxwell3d = &maxwell3d;
+    program(&state, parameters.data(), parameters.data() + parameters.size());
+}
+
+void MacroJITArm64Impl::Compile_ALU(Macro::Opcode opcode) {
+    const auto src_a = Compile_GetRegister(opcode.src_a, RESULT);
+    const auto src_b = Compile_GetRegister(opcode.src_b, W0);
+
+    // The macro carry flag follows the same convention as the ARM64 C flag, including the
+    // inverted borrow on subtraction, so it maps directly onto ADDS/ADCS/SUBS/SBCS.
+    const auto LoadCarry = [this] {
+        // C is set when CARRY >= 1.
+        c.CMP(CARRY, 1);
+    };
+    const auto StoreCarry = [this] { c.CSET(CARRY, CS); };
+
+    switch (opcode.alu_operation) {
+    case Macro::ALUOperation::Add:
+        if (optimizer.can_skip_carry) {
+            c.ADD(RESULT, src_a, src_b);
+        } else {
+            c.ADDS(RESULT, src_a, src_b);
+            StoreCarry();
+        }
+        break;
+    case Macro::ALUOperation::AddWithCarry:
+        LoadCarry();
+        c.ADCS(RESULT, src_a, src_b);
+        StoreCarry();
+        break;
+    case Macro::ALUOperation::Subtract:
+        if (optimizer.can_skip_carry) {
+            c.SUB(RESULT, src_a, src_b);
+        } else {
+            c.SUBS(RESULT, src_a, src_b);
+            StoreCarry();
+        }
+        break;
+    case Macro::ALUOperation::SubtractWithBorrow:
+        LoadCarry();
+        c.SBCS(RESULT, src_a, src_b);
+        StoreCarry();
+        break;
+    case Macro::ALUOperation::Xor:
+        c.EOR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Or:
+        c.ORR(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::And:
+        c.AND(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::AndNot:
+        c.BIC(RESULT, src_a, src_b);
+        break;
+    case Macro::ALUOperation::Nand:
+        c.AND(RESULT, src_a, src_b);
+        c.MVN(RESULT, RESULT);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented ALU operation {}", opcode.alu_operation.Value());
+        break;
+    }
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_AddImmediate(Macro::Opcode opcode) {
+    if (optimizer.skip_dummy_addimmediate) {
+        // Games tend to use this as an exit instruction placeholder. It's to encode an instruction
+        // without doing anything. In our case we can just not emit anything.
+        if (opcode.result_operation == Macro::ResultOperation::Move && opcode.dst == 0) {
+            return;
+        }
+    }
+    Compile_GetRegister(opcode.src_a, RESULT);
+    Compile_AddSignedImmediate(RESULT, opcode.immediate);
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractInsert(Macro::Opcode opcode) {
+    const auto dst = Compile_GetRegister(opcode.src_a, RESULT);
+    const auto src = Compile_GetRegister(opcode.src_b, W0);
+
+    const u32 mask = opcode.GetBitfieldMask();
+    c.MOV(W1, mask);
+    c.LSR(src, src, opcode.bf_src_bit.Value());
+    c.AND(src, src, W1);
+    c.LSL(src, src, opcode.bf_dst_bit.Value());
+    c.LSL(W1, W1, opcode.bf_dst_bit.Value());
+    c.BIC(dst, dst, W1);
+    c.ORR(RESULT, dst, src);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftImmediate(Macro::Opcode opcode) {
+    const auto dst = Compile_GetRegister(opcode.src_a, W1);
+    const auto src = Compile_GetRegister(opcode.src_b, RESULT);
+
+    c.MOV(W2, opcode.GetBitfieldMask());
+    c.LSR(RESULT, src, dst);
+    c.AND(RESULT, RESULT, W2);
+    c.LSL(RESULT, RESULT, opcode.bf_dst_bit.Value());
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_ExtractShiftLeftRegister(Macro::Opcode opcode) {
+    const auto dst = Compile_GetRegister(opcode.src_a, W1);
+    const auto src = Compile_GetRegister(opcode.src_b, RESULT);
+
+    c.MOV(W2, opcode.GetBitfieldMask());
+    c.LSR(RESULT, src, opcode.bf_src_bit.Value());
+    c.AND(RESULT, RESULT, W2);
+    c.LSL(RESULT, RESULT, dst);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Read(Macro::Opcode opcode) {
+    Compile_GetRegister(opcode.src_a, RESULT);
+    Compile_AddSignedImmediate(RESULT, opcode.immediate);
+
+    // Equivalent to Engines::Maxwell3D::GetRegisterValue:
+    constexpr u64 reg_array_offset =
+        offsetof(Engines::Maxwell3D, regs) + offsetof(Engines::Maxwell3D::Regs, reg_array);
+    c.LDR(X0, STATE, offsetof(JITState, maxwell3d));
+    c.MOV(X1, reg_array_offset);
+    c.ADD(X0, X0, X1);
+    c.UBFIZ(X1, RESULT.toX(), 2, 32);
+    c.ADD(X0, X0, X1);
+    c.LDR(RESULT, X0, 0);
+
+    Compile_ProcessResult(opcode.result_operation, opcode.dst);
+}
+
+void MacroJITArm64Impl::Compile_Branch(Macro::Opcode opcode, u32 index) {
+    const s64 jump_address = static_cast<s64>(index) + opcode.immediate;
+    const auto value = Compile_GetRegister(opcode.src_a, W0);
+    ASSERT_MSG(jump_address >= 0 && jump_address <= static_cast<s64>(code.size()),
+               "Macro branch target {} is out of bounds", jump_address);
+    oaknut::Label& target = jump_address < static_cast<s64>(code.size())
+                                ? labels[static_cast<size_t>(jump_address)]
+                                : end_of_code;
+
+    if (opcode.branch_annul) {
+        switch (opcode.branch_condition) {
+        case Macro::BranchCondition::Zero:
+            c.CBZ(value, target);
+            break;
+        case Macro::BranchCondition::NotZero:
+            c.CBNZ(value, target);
+            break;
+        }
+        return;
+    }
+
+    // Branches with a delay slot execute the next instruction before jumping, emit a copy of it
+    // in the taken path instead of tracking the delayed target at runtime.
+    oaknut::Label not_taken;
+    switch (opcode.branch_condition) {
+    case Macro::BranchCondition::Zero:
+        c.CBNZ(value, not_taken);
+        break;
+    case Macro::BranchCondition::NotZero:
+        c.CBZ(value, not_taken);
+        break;
+    }
+    Compile_DelaySlot(index + 1);
+    c.B(target);
+    c.l(not_taken);
+}
+
+void MacroJITArm64Impl::Optimizer_ScanFlags() {
+    optimizer.can_skip_carry = true;
+    for (auto raw_op : code) {
+        Macro::Opcode op{};
+        op.raw = raw_op;
+
+        if (op.operation == Macro::Operation::ALU) {
+            // Scan for any ALU operations which actually use the carry flag, if they don't exist in
+            // our current code we can skip emitting the carry flag handling operations
+            if (op.alu_operation == Macro::ALUOperation::AddWithCarry ||
+                op.alu_operation == Macro::ALUOperation::SubtractWithBorrow) {
+                optimizer.can_skip_carry = false;
+            }
+        }
+    }
+}
+
+void MacroJITArm64Impl::Compile() {
+    mem.unprotect();
+
+    // Frame record plus the callee-saved registers we use
+    c.STP(X29, X30, SP, PRE_INDEXED, -64);
+    c.MOV(X29, SP);
+    c.STP(X19, X20, SP, 16);
+    c.STP(X21, X22, SP, 32);
+    c.STP(X23, X24, SP, 48);
+
+    // JIT state
+    c.MOV(STATE, X0);
+    c.MOV(PARAMETERS, X1);
+    c.MOV(MAX_PARAMETER, X2);
+    c.MOV(RESULT, WZR);
+    c.MOV(METHOD_ADDRESS, WZR);
+    c.MOV(CARRY, WZR);
+
+    c.STR(Compile_FetchParameter(), STATE, offsetof(JITState, registers) + sizeof(u32));
+
+    // AddImmediate tends to be used as a NOP instruction, if we detect this we can
+    // completely skip the entire code path and no emit anything
+    optimizer.skip_dummy_addimmediate = true;
+
+    // Check to see if we can skip emitting certain instructions
+    Optimizer_ScanFlags();
+
+    const u32 op_count = static_cast<u32>(code.size());
+    for (u32 i = 0; i < op_count; i++) {
+        c.l(labels[i]);
+        Compile_Instruction(i, false);
+    }
+
+    c.l(end_of_code);
+    c.LDP(X23, X24, SP, 48);
+    c.LDP(X21, X22, SP, 32);
+    c.LDP(X19, X20, SP, 16);
+    c.LDP(X29, X30, SP, POST_INDEXED, 64);
+    c.RET();
+
+    mem.protect();
+    mem.invalidate_all();
+    program = reinterpret_cast<ProgramType>(mem.ptr());
+}
+
+void MacroJITArm64Impl::Compile_Instruction(u32 index, bool is_delay_slot) {
+    const Macro::Opcode opcode{code[index]};
+
+    switch (opcode.operation) {
+    case Macro::Operation::ALU:
+        Compile_ALU(opcode);
+        break;
+    case Macro::Operation::AddImmediate:
+        Compile_AddImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractInsert:
+        Compile_ExtractInsert(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftImmediate:
+        Compile_ExtractShiftLeftImmediate(opcode);
+        break;
+    case Macro::Operation::ExtractShiftLeftRegister:
+        Compile_ExtractShiftLeftRegister(opcode);
+        break;
+    case Macro::Operation::Read:
+        Compile_Read(opcode);
+        break;
+    case Macro::Operation::Branch:
+        if (is_delay_slot) {
+            UNIMPLEMENTED_MSG("Executing a branch in a delay slot is not valid");
+            break;
+        }
+        Compile_Branch(opcode, index);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented opcode {}", opcode.operation.Value());
+        break;
+    }
+
+    // An instruction with the Exit flag will not actually cause an exit if it's executed inside
+    // a delay slot. Exit has a delay slot itself, so execute the next instruction before leaving.
+    if (opcode.is_exit && !is_delay_slot) {
+        Compile_DelaySlot(index + 1);
+        c.B(end_of_code);
+    }
+}
+
+void MacroJITArm64Impl::Compile_DelaySlot(u32 index) {
+    if (index >= code.size()) {
+        LOG_ERROR(HW_GPU, "Macro JIT: delay slot at {} is past the end of the macro", index);
+        return;
+    }
+    Compile_Instruction(index, true);
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_FetchParameter() {
+    oaknut::Label parameter_ok;
+    oaknut::Label done;
+    c.CMP(PARAMETERS, MAX_PARAMETER);
+    c.B(LO, parameter_ok);
+    c.MOV(X0, PARAMETERS);
+    c.MOV(X1, MAX_PARAMETER);
+    Compile_CallFunction(reinterpret_cast<const void*>(&WarnInvalidParameter));
+    c.MOV(W0, WZR);
+    c.B(done);
+    c.l(parameter_ok);
+    c.LDR(W0, PARAMETERS, POST_INDEXED, sizeof(u32));
+    c.l(done);
+    return W0;
+}
+
+oaknut::WReg MacroJITArm64Impl::Compile_GetRegister(u32 index, oaknut::WReg dst) {
+    if (index == 0) {
+        // Register 0 is always zero
+        c.MOV(dst, WZR);
+    } else {
+        c.LDR(dst, STATE, offsetof(JITState, registers) + index * sizeof(u32));
+    }
+    return dst;
+}
+
+void MacroJITArm64Impl::Compile_AddSignedImmediate(oaknut::WReg dst, s32 immediate) {
+    if (immediate == 0) {
+        return;
+    }
+    c.MOV(W1, static_cast<u32>(immediate));
+    c.ADD(dst, dst, W1);
+}
+
+void MacroJITArm64Impl::Compile_CallFunction(const void* function) {
+    c.MOV(X16, reinterpret_cast<u64>(function));
+    c.BLR(X16);
+}
+
+void MacroJITArm64Impl::Compile_Send(oaknut::WReg value) {
+    c.MOV(W2, value);
+    c.MOV(W1, METHOD_ADDRESS);
+    c.LDR(X0, STATE, offsetof(JITState, maxwell3d));
+    Compile_CallFunction(reinterpret_cast<const void*>(&Send));
+
+    oaknut::Label dont_process;
+    // Get increment, if zero the method address doesn't update
+    c.TST(METHOD_ADDRESS, 0x3f000);
+    c.B(EQ, dont_process);
+
+    c.UBFX(W1, METHOD_ADDRESS, 12, 6);
+    c.AND(W0, METHOD_ADDRESS, 0xfff);
+    c.ADD(W0, W0, W1);
+    c.AND(W0, W0, 0xfff);
+    c.LSL(W1, W1, 12);
+    c.ORR(METHOD_ADDRESS, W0, W1);
+
+    c.l(dont_process);
+}
+
+void MacroJITArm64Impl::Compile_ProcessResult(Macro::ResultOperation operation, u32 reg) {
+    const auto SetRegister = [this](u32 reg_index, oaknut::WReg result) {
+        // Register 0 is supposed to always return 0. NOP is implemented as a store to the zero
+        // register.
+        if (reg_index == 0) {
+            return;
+        }
+        c.STR(result, STATE, offsetof(JITState, registers) + reg_index * sizeof(u32));
+    };
+    const auto SetMethodAddress = [this](oaknut::WReg reg32) { c.MOV(METHOD_ADDRESS, reg32); };
+
+    switch (operation) {
+    case Macro::ResultOperation::IgnoreAndFetch:
+        SetRegister(reg, Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::Move:
+        SetRegister(reg, RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethod:
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSend:
+        // Fetch parameter and send result.
+        SetRegister(reg, Compile_FetchParameter());
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSend:
+        // Move and send result.
+        SetRegister(reg, RESULT);
+        Compile_Send(RESULT);
+        break;
+    case Macro::ResultOperation::FetchAndSetMethod:
+        // Fetch parameter and use result as Method Address.
+        SetRegister(reg, Compile_FetchParameter());
+        SetMethodAddress(RESULT);
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+        // Move result and use as Method Address, then fetch and send parameter.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        Compile_Send(Compile_FetchParameter());
+        break;
+    case Macro::ResultOperation::MoveAndSetMethodSend:
+        // Move result and use as Method Address, then send bits 12:17 of result.
+        SetRegister(reg, RESULT);
+        SetMethodAddress(RESULT);
+        c.UBFX(W0, RESULT, 12, 6);
+        Compile_Send(W0);
+        break;
+    default:
+        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", operation);
+        break;
+    }
+}
+
+/// Cached programs past which the ones no method uses are dropped.
+constexpr std::size_t MAX_CACHED_PROGRAMS = 1024;
+
+/// Forwards to a compiled program that may be shared between several methods.
+class SharedMacro final : public CachedMacro {
+public:
+    explicit SharedMacro(std::shared_ptr<CachedMacro> program_) : program{std::move(program_)} {}
+
+    void Execute(const std::vector<u32>& parameters, u32 method) override {
+        program->Execute(parameters, method);
+    }
+
+private:
+    std::shared_ptr<CachedMacro> program;
+};
+} // Anonymous namespace
+
+MacroJITArm64::MacroJITArm64(Engines::Maxwell3D& maxwell3d_)
+    : MacroEngine{maxwell3d_}, maxwell3d{maxwell3d_} {}
+
+MacroJITArm64::~MacroJITArm64() = default;
+
+std::unique_ptr<CachedMacro> MacroJITArm64::Compile(const std::vector<u32>& code) {
+    const u64 hash = Common::HashValue(code);
+    if (const auto it = program_cache.find(hash); it != program_cache.end()) {
+        const auto& cached = static_cast<const MacroJITArm64Impl&>(*it->second);
+        if (cached.Code() == code) {
+            return std::make_unique<SharedMacro>(it->second);
+        }
+    }
+    if (program_cache.size() >= MAX_CACHED_PROGRAMS) {
+        // Only the cache references programs whose methods were overwritten
+        std::erase_if(program_cache,
+                      [](const auto& entry) { return entry.second.use_count() == 1; });
+    }
+    auto program = std::make_shared<MacroJITArm64Impl>(maxwell3d, code);
+    program_cache.insert_or_assign(hash, program);
+    return std::make_unique<SharedMacro>(std::move(program));
+}
+} // namespace Tegra
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "video_core/macro/macro.h"
+
+namespace Tegra {
+
+namespace Engines {
+class Maxwell3D;
+}
+
+class MacroJITArm64 final : public MacroEngine {
+public:
+    explicit MacroJITArm64(Engines::Maxwell3D& maxwell3d_);
+    ~MacroJITArm64() override;
+
+protected:
+    std::unique_ptr<CachedMacro> Compile(const std::vector<u32>& code) override;
+
+private:
+    Engines::Maxwell3D& maxwell3d;
+
+    /// Compiled programs keyed by macro hash, shared between methods uploading the same code.
+    /// Programs no method uses are dropped once it holds MAX_CACHED_PROGRAMS of them.
+    std::unordered_map<u64, std::shared_ptr<CachedMacro>> program_cache;
+};
+
+} // namespace Tegra
@@ -123,7 +123,7 @@ GPUVAddr MemoryManager::PageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr de
         [[maybe_unused]] const auto current_entry_type = GetEntry<false>(current_gpu_addr);
         SetEntry<false>(current_gpu_addr, entry_type);
         if (current_entry_type != entry_type) {
-            rasterizer->ModifyGPUMemory(unique_identifier, current_gpu_addr, page_size);
+            RecordModifiedRange(current_gpu_addr, page_size);
         }
         if constexpr (entry_type == EntryType::Mapped) {
             const DAddr current_dev_addr = dev_addr + offset;
@@ -133,6 +133,7 @@ GPUVAddr MemoryManager::PageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr de
         }
         remaining_size -= page_size;
     }
+    FlushModifiedRange();
     kind_map.Map(gpu_addr, gpu_addr + size, kind);
     return gpu_addr;
 }
@@ -146,7 +147,7 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
         [[maybe_unused]] const auto current_entry_type = GetEntry<true>(current_gpu_addr);
         SetEntry<true>(current_gpu_addr, entry_type);
         if (current_entry_type != entry_type) {
-            rasterizer->ModifyGPUMemory(unique_identifier, current_gpu_addr, big_page_size);
+            RecordModifiedRange(current_gpu_addr, big_page_size);
         }
         if constexpr (entry_type == EntryType::Mapped) {
             const DAddr current_dev_addr = dev_addr + offset;
@@ -173,6 +174,7 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
         }
         remaining_size -= big_page_size;
     }
+    FlushModifiedRange();
     {
         std::unique_lock<std::mutex> lock(guard);
         kind_map.Map(gpu_addr, gpu_addr + size, kind);
@@ -180,6 +182,38 @@ GPUVAddr MemoryManager::BigPageTableOp(GPUVAddr gpu_addr, [[maybe_unused]] DAddr
     return gpu_addr;
 }
 
+void MemoryManager::RecordModifiedRange(GPUVAddr gpu_addr, u64 size) {
+    if (modified_begin != modified_end && modified_end == gpu_addr) {
+        modified_end += size;
+        return;
+    }
+    if (modified_begin != modified_end) {
+        rasterizer->ModifyGPUMemory(unique_identifier, modified_begin,
+                                    modified_end - modified_begin);
+    }
+    modified_begin = gpu_addr;
+    modified_end = gpu_addr + size;
+}
+
+void MemoryManager::FlushModifiedRange() {
+    if (batched_update_depth != 0 || modified_begin == modified_end) {
+        return;
+    }
+    rasterizer->ModifyGPUMemory(unique_identifier, modified_begin, modified_end - modified_begin);
+    modified_begin = 0;
+    modified_end = 0;
+}
+
+void MemoryManager::BeginBatchedUpdate() {
+    ++batched_update_depth;
+}
+
+void MemoryManager::EndBatchedUpdate() {
+    ASSERT(batched_update_depth > 0);
+    --batched_update_depth;
+    FlushModifiedRange();
+}
+
 void MemoryManager::BindRasterizer(VideoCore::RasterizerInterface* rasterizer_) {
     rasterizer = rasterizer_;
 }
@@ -373,6 +407,20 @@ inline void MemoryManager::MemoryOperation(GPUVAddr gpu_src_addr, std::size_t si
 template <bool is_safe>
 void MemoryManager::ReadBlockImpl(GPUVAddr gpu_src_addr, void* dest_buffer, std::size_t size,
                                   [[maybe_unused]] VideoCommon::CacheType which) const {
+    // The contiguous start of the range, often all of it, takes a single flush and copy
+    if (const auto span = GetContiguousSpan(gpu_src_addr, size)) {
+        const auto [dev_addr, span_size] = *span;
+        if constexpr (is_safe) {
+            rasterizer->FlushRegion(dev_addr, span_size, which);
+        }
+        memory.ReadBlockUnsafe(dev_addr, dest_buffer, span_size);
+        if (span_size == size) {
+            return;
+        }
+        gpu_src_addr += span_size;
+        dest_buffer = static_cast<u8*>(dest_buffer) + span_size;
+        size -= span_size;
+    }
     auto set_to_zero = [&]([[maybe_unused]] std::size_t page_index,
                            [[maybe_unused]] std::size_t offset, std::size_t copy_amount) {
         std::memset(dest_buffer, 0, copy_amount);
@@ -423,6 +471,19 @@ void MemoryManager::ReadBlockUnsafe(GPUVAddr gpu_src_addr, void* dest_buffer,
 template <bool is_safe>
 void MemoryManager::WriteBlockImpl(GPUVAddr gpu_dest_addr, const void* src_buffer, std::size_t size,
                                    [[maybe_unused]] VideoCommon::CacheType which) {
+    if (const auto span = GetContiguousSpan(gpu_dest_addr, size)) {
+        const auto [dev_addr, span_size] = *span;
+        if constexpr (is_safe) {
+            rasterizer->InvalidateRegion(dev_addr, span_size, which);
+        }
+        memory.WriteBlockUnsafe(dev_addr, src_buffer, span_size);
+        if (span_size == size) {
+            return;
+        }
+        gpu_dest_addr += span_size;
+        src_buffer = static_cast<const u8*>(src_buffer) + span_size;
+        size -= span_size;
+    }
     auto just_advance = [&]([[maybe_unused]] std::size_t page_index,
                             [[maybe_unused]] std::size_t offset, std::size_t copy_amount) {
         src_buffer = static_cast<const u8*>(src_buffer) + copy_amount;
@@ -477,6 +538,14 @@ void MemoryManager::WriteBlockCached(GPUVAddr gpu_dest_addr, const void* src_buf
 
 void MemoryManager::FlushRegion(GPUVAddr gpu_addr, size_t size,
                                 VideoCommon::CacheType which) const {
+    if (const auto span = GetContiguousSpan(gpu_addr, size)) {
+        rasterizer->FlushRegion(span->first, span->second, which);
+        if (span->second == size) {
+            return;
+        }
+        gpu_addr += span->second;
+        size -= span->second;
+    }
     auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
                           [[maybe_unused]] std::size_t offset,
                           [[maybe_unused]] std::size_t copy_amount) {};
@@ -529,43 +598,8 @@ bool MemoryManager::IsMemoryDirty(GPUVAddr gpu_addr, size_t size,
 }
 
 size_t MemoryManager::MaxContinuousRange(GPUVAddr gpu_addr, size_t size) const {
-    std::optional<DAddr> old_page_addr{};
-    size_t range_so_far = 0;
-    bool result{false};
-    auto fail = [&]([[maybe_unused]] std::size_t page_index, [[maybe_unused]] std::size_t offset,
-                    std::size_t copy_amount) {
-        result = true;
-        return true;
-    };
-    auto short_check = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        if (old_page_addr && *old_page_addr != dev_addr_base) {
-            result = true;
-            return true;
-        }
-        range_so_far += copy_amount;
-        old_page_addr = {dev_addr_base + copy_amount};
-        return false;
-    };
-    auto big_check = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        if (old_page_addr && *old_page_addr != dev_addr_base) {
-            return true;
-        }
-        range_so_far += copy_amount;
-        old_page_addr = {dev_addr_base + copy_amount};
-        return false;
-    };
-    auto check_short_pages = [&](std::size_t page_index, std::size_t offset,
-                                 std::size_t copy_amount) {
-        GPUVAddr base = (page_index << big_page_bits) + offset;
-        MemoryOperation<false>(base, copy_amount, short_check, fail, fail);
-        return result;
-    };
-    MemoryOperation<true>(gpu_addr, size, big_check, fail, check_short_pages);
-    return range_so_far;
+    const auto span = GetContiguousSpan(gpu_addr, size);
+    return span ? span->second : 0;
 }
 
 size_t MemoryManager::GetMemoryLayoutSize(GPUVAddr gpu_addr, size_t max_size) const {
@@ -575,6 +609,14 @@ size_t MemoryManager::GetMemoryLayoutSize(GPUVAddr gpu_addr, size_t max_size) co
 
 void MemoryManager::InvalidateRegion(GPUVAddr gpu_addr, size_t size,
                                      VideoCommon::CacheType which) const {
+    if (const auto span = GetContiguousSpan(gpu_addr, size)) {
+        rasterizer->InvalidateRegion(span->first, span->second, which);
+        if (span->second == size) {
+            return;
+        }
+        gpu_addr += span->second;
+        size -= span->second;
+    }
     auto do_nothing = [&]([[maybe_unused]] std::size_t page_index,
                           [[maybe_unused]] std::size_t offset,
                           [[maybe_unused]] std::size_t copy_amount) {};
@@ -623,41 +665,54 @@ bool MemoryManager::IsGranularRange(GPUVAddr gpu_addr, std::size_t size) const {
 }
 
 bool MemoryManager::IsContinuousRange(GPUVAddr gpu_addr, std::size_t size) const {
-    std::optional<DAddr> old_page_addr{};
-    bool result{true};
-    auto fail = [&]([[maybe_unused]] std::size_t page_index, [[maybe_unused]] std::size_t offset,
-                    std::size_t copy_amount) {
-        result = false;
+    if (size == 0) {
         return true;
-    };
-    auto short_check = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset;
-        if (old_page_addr && *old_page_addr != dev_addr_base) {
-            result = false;
+    }
+    const auto span = GetContiguousSpan(gpu_addr, size);
+    return span && span->second == size;
+}
+
+std::optional<std::pair<DAddr, std::size_t>> MemoryManager::GetContiguousSpan(
+    GPUVAddr gpu_addr, std::size_t size) const {
+    std::optional<DAddr> span_begin{};
+    DAddr span_end{};
+    bool is_broken{};
+    auto extend = [&](DAddr dev_addr, std::size_t copy_amount) {
+        if (span_begin && span_end != dev_addr) {
+            is_broken = true;
             return true;
         }
-        old_page_addr = {dev_addr_base + copy_amount};
+        if (!span_begin) {
+            span_begin = dev_addr;
+        }
+        span_end = dev_addr + copy_amount;
         return false;
     };
+    auto fail = [&]([[maybe_unused]] std::size_t page_index, [[maybe_unused]] std::size_t offset,
+                    [[maybe_unused]] std::size_t copy_amount) {
+        is_broken = true;
+        return true;
+    };
+    auto short_check = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
+        return extend((static_cast<DAddr>(page_table[page_index]) << cpu_page_bits) + offset,
+                      copy_amount);
+    };
     auto big_check = [&](std::size_t page_index, std::size_t offset, std::size_t copy_amount) {
-        const DAddr dev_addr_base =
-            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset;
-        if (old_page_addr && *old_page_addr != dev_addr_base) {
-            result = false;
-            return true;
-        }
-        old_page_addr = {dev_addr_base + copy_amount};
-        return false;
+        return extend(
+            (static_cast<DAddr>(big_page_table_dev[page_index]) << cpu_page_bits) + offset,
+            copy_amount);
     };
     auto check_short_pages = [&](std::size_t page_index, std::size_t offset,
                                  std::size_t copy_amount) {
         GPUVAddr base = (page_index << big_page_bits) + offset;
         MemoryOperation<false>(base, copy_amount, short_check, fail, fail);
-        return !result;
+        return is_broken;
     };
     MemoryOperation<true>(gpu_addr, size, big_check, fail, check_short_pages);
-    return result;
+    if (!span_begin) {
+        return std::nullopt;
+    }
+    return std::make_pair(*span_begin, static_cast<std::size_t>(span_end - *span_begin));
 }
 
 bool MemoryManager::IsFullyMappedRange(GPUVAddr gpu_addr, std::size_t size) const {
@@ -768,25 +823,19 @@ void MemoryManager::FlushCaching() {
 }
 
 const u8* MemoryManager::GetSpan(const GPUVAddr src_addr, const std::size_t size) const {
-    if (!IsContinuousRange(src_addr, size)) {
+    const auto span = GetContiguousSpan(src_addr, size);
+    if (!span || span->second != size) {
         return nullptr;
     }
-    auto dev_addr = GpuToCpuAddress(src_addr);
-    if (dev_addr) {
-        return memory.GetSpan(*dev_addr, size);
-    }
-    return nullptr;
+    return memory.GetSpan(span->first, size);
 }
 
 u8* MemoryManager::GetSpan(const GPUVAddr src_addr, const std::size_t size) {
-    if (!IsContinuousRange(src_addr, size)) {
+    const auto span = GetContiguousSpan(src_addr, size);
+    if (!span || span->second != size) {
         return nullptr;
     }
-    auto dev_addr = GpuToCpuAddress(src_addr);
-    if (dev_addr) {
-        return memory.GetSpan(*dev_addr, size);
-    }
-    return nullptr;
+    return memory.GetSpan(span->first, size);
 }
 
 } // namespace Tegra
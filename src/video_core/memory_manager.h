@@ -119,6 +119,14 @@ public:
      */
     [[nodiscard]] bool IsContinuousRange(GPUVAddr gpu_addr, std::size_t size) const;
 
+    /**
+     * Returns the device address a gpu region starts at and the size of its largest prefix mapped
+     * to consecutive device addresses, in a single walk of the page table.
+     * Returns nullopt if the start of the region isn't mapped.
+     */
+    [[nodiscard]] std::optional<std::pair<DAddr, std::size_t>> GetContiguousSpan(
+        GPUVAddr gpu_addr, std::size_t size) const;
+
     /**
      * Checks if a gpu region is mapped entirely.
      */
@@ -137,6 +145,13 @@ public:
     GPUVAddr MapSparse(GPUVAddr gpu_addr, std::size_t size, bool is_big_pages = true);
     void Unmap(GPUVAddr gpu_addr, std::size_t size);
 
+    /**
+     * Defers the notifications of page table updates to the rasterizer until the matching
+     * EndBatchedUpdate, so that adjacent updated ranges are reported once.
+     */
+    void BeginBatchedUpdate();
+    void EndBatchedUpdate();
+
     void FlushRegion(GPUVAddr gpu_addr, size_t size,
                      VideoCommon::CacheType which = VideoCommon::CacheType::All) const;
 
@@ -236,11 +251,21 @@ private:
     template <bool is_big_page>
     inline void SetEntry(size_t position, EntryType entry);
 
+    /// Records a range whose entries changed type, it is merged with the previous one if adjacent
+    void RecordModifiedRange(GPUVAddr gpu_addr, u64 size);
+
+    /// Notifies the rasterizer of the recorded range unless updates are batched
+    void FlushModifiedRange();
+
     Common::MultiLevelPageTable<u32> page_table;
     Common::RangeMap<GPUVAddr, PTEKind> kind_map;
     Common::VirtualBuffer<u32> big_page_table_dev;
 
     std::vector<u64> big_page_continuous;
+
+    GPUVAddr modified_begin{};
+    GPUVAddr modified_end{};
+    u32 batched_update_depth{};
     boost::container::small_vector<std::pair<DAddr, std::size_t>, 32> page_stash{};
     boost::container::small_vector<std::pair<DAddr, std::size_t>, 32> page_stash2{};
 
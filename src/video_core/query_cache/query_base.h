@@ -26,6 +26,7 @@ public:
     DAddr guest_address{};
     QueryFlagBits flags{};
     u64 value{};
+    u64 frame{}; ///< Frame the query was reported in
 
 protected:
     // Default constructor
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -169,6 +170,7 @@ struct QueryCacheBase<Traits>::QueryCacheBaseImpl {
     u64 streamer_mask;
     std::mutex flush_guard;
     std::deque<u64> flushes_pending;
+    std::atomic<u64> frame_tick{};
     std::vector<QueryCacheBase<Traits>::QueryLocation> pending_unregister;
 };
 
@@ -248,6 +250,7 @@ void QueryCacheBase<Traits>::CounterReport(GPUVAddr addr, QueryType counter_type
     DAddr cpu_addr = *cpu_addr_opt;
     const size_t new_query_id = streamer->WriteCounter(cpu_addr, has_timestamp, payload, subreport);
     auto* query = streamer->GetQuery(new_query_id);
+    query->frame = impl->frame_tick.load(std::memory_order_relaxed);
     if (is_fence) {
         query->flags |= QueryFlagBits::IsFence;
     }
@@ -372,6 +375,11 @@ void QueryCacheBase<Traits>::NotifyWFI() {
     impl->runtime.Barriers(false);
 }
 
+template <typename Traits>
+void QueryCacheBase<Traits>::TickFrame() {
+    impl->frame_tick.fetch_add(1, std::memory_order_relaxed);
+}
+
 template <typename Traits>
 void QueryCacheBase<Traits>::NotifySegment(bool resume) {
     if (resume) {
@@ -574,8 +582,14 @@ bool QueryCacheBase<Traits>::SemiFlushQueryDirty(QueryCacheBase<Traits>::QueryLo
         std::memcpy(ptr, &value_l, sizeof(value_l));
         return false;
     }
-    return True(query_base->flags & QueryFlagBits::IsHostManaged) &&
-           False(query_base->flags & QueryFlagBits::IsGuestSynced);
+    if (False(query_base->flags & QueryFlagBits::IsHostManaged) ||
+        True(query_base->flags & QueryFlagBits::IsGuestSynced)) {
+        return false;
+    }
+    // Games polling the result every frame can keep reading the previous one for a while,
+    // instead of waiting for the GPU each time.
+    const u64 tolerance = Settings::RuntimeSnapshot().query_result_tolerance;
+    return impl->frame_tick.load(std::memory_order_relaxed) - query_base->frame >= tolerance;
 }
 
 template <typename Traits>
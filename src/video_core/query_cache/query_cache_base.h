@@ -99,6 +99,9 @@ public:
 
     void NotifyWFI();
 
+    /// Advances the frame used to tell how old the results read by the guest can be.
+    void TickFrame();
+
     bool AccelerateHostConditionalRendering();
 
     // Async downloads
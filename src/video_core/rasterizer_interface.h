@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -15,6 +18,7 @@
 #include "video_core/gpu.h"
 #include "video_core/query_cache/types.h"
 #include "video_core/rasterizer_download_area.h"
+#include "video_core/texture_cache/memory_pressure.h"
 
 namespace Tegra {
 class MemoryManager;
@@ -35,6 +39,12 @@ enum class LoadCallbackStage {
 };
 using DiskResourceLoadCallback = std::function<void(LoadCallbackStage, std::size_t, std::size_t)>;
 
+/// Memory owned by the caches of a rasterizer, in bytes
+struct CacheMemoryUsage {
+    u64 texture_cache{};
+    u64 buffer_cache{};
+};
+
 class RasterizerInterface {
 public:
     virtual ~RasterizerInterface() = default;
@@ -175,5 +185,13 @@ public:
     virtual bool HasDrawTransformFeedback() {
         return false;
     }
+
+    /// Returns the memory owned by the texture and buffer caches, callable from any thread
+    [[nodiscard]] virtual CacheMemoryUsage GetCacheMemoryUsage() const {
+        return {};
+    }
+
+    /// Releases cached resources the host asked to give back, more of them as pressure rises
+    virtual void TrimMemory(VideoCommon::MemoryPressure pressure) {}
 };
 } // namespace VideoCore
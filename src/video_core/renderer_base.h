@@ -6,6 +6,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "common/common_funcs.h"
 #include "common/common_types.h"
@@ -47,6 +48,11 @@ public:
 
     [[nodiscard]] virtual std::string GetDeviceVendor() const = 0;
 
+    /// Returns the device memory used by the process, if the backend can report it
+    [[nodiscard]] virtual std::optional<u64> GetDeviceMemoryUsage() const {
+        return std::nullopt;
+    }
+
     // Getter/setter functions:
     // ------------------------
 
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <span>
 
 #include "shader_recompiler/backend/glasm/emit_glasm.h"
@@ -63,9 +64,22 @@ Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
     if (runtime.has_unified_vertex_buffers) {
         glGetNamedBufferParameterui64vNV(buffer.handle, GL_BUFFER_GPU_ADDRESS_NV, &address);
     }
+    if (runtime.stream_buffer) {
+        stream_buffer = &*runtime.stream_buffer;
+    }
 }
 
 void Buffer::ImmediateUpload(size_t offset, std::span<const u8> data) noexcept {
+    if (stream_buffer && StreamBuffer::CanRequest(data.size_bytes())) {
+        // Drivers without fast buffer sub data stall less copying from the coherent stream buffer
+        const auto [mapped_span, stream_offset] = stream_buffer->Request(data.size_bytes());
+        std::memcpy(mapped_span.data(), data.data(), data.size_bytes());
+        glCopyNamedBufferSubData(stream_buffer->Handle(), buffer.handle,
+                                 static_cast<GLintptr>(stream_offset),
+                                 static_cast<GLintptr>(offset),
+                                 static_cast<GLsizeiptr>(data.size_bytes()));
+        return;
+    }
     glNamedBufferSubData(buffer.handle, static_cast<GLintptr>(offset),
                          static_cast<GLsizeiptr>(data.size_bytes()), data.data());
 }
@@ -313,9 +327,7 @@ void BufferCacheRuntime::BindStorageBuffer(size_t stage, u32 binding_index, Buff
                                            u32 offset, u32 size, bool is_written) {
     if (use_storage_buffers) {
         const GLuint base_binding = graphics_base_storage_bindings[stage];
-        const GLuint binding = base_binding + binding_index;
-        glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, buffer.Handle(),
-                          static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+        QueueStorageBuffer(base_binding + binding_index, buffer.Handle(), offset, size);
     } else {
         const BindlessSSBO ssbo{
             .address = buffer.HostGpuAddr() + offset,
@@ -333,12 +345,7 @@ void BufferCacheRuntime::BindStorageBuffer(size_t stage, u32 binding_index, Buff
 void BufferCacheRuntime::BindComputeStorageBuffer(u32 binding_index, Buffer& buffer, u32 offset,
                                                   u32 size, bool is_written) {
     if (use_storage_buffers) {
-        if (size != 0) {
-            glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding_index, buffer.Handle(),
-                              static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
-        } else {
-            glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding_index, 0, 0, 0);
-        }
+        QueueStorageBuffer(binding_index, size != 0 ? buffer.Handle() : 0, offset, size);
     } else {
         const BindlessSSBO ssbo{
             .address = buffer.HostGpuAddr() + offset,
@@ -353,6 +360,34 @@ void BufferCacheRuntime::BindComputeStorageBuffer(u32 binding_index, Buffer& buf
     }
 }
 
+void BufferCacheRuntime::FlushStorageBuffers() {
+    if (storage_bindings.count == 0) {
+        return;
+    }
+    glBindBuffersRange(GL_SHADER_STORAGE_BUFFER, storage_bindings.first, storage_bindings.count,
+                       storage_bindings.buffers.data(), storage_bindings.offsets.data(),
+                       storage_bindings.sizes.data());
+    storage_bindings.count = 0;
+}
+
+void BufferCacheRuntime::QueueStorageBuffer(GLuint binding, GLuint handle, u32 offset, u32 size) {
+    const bool is_consecutive =
+        binding == storage_bindings.first + static_cast<GLuint>(storage_bindings.count);
+    if (storage_bindings.count != 0 &&
+        (!is_consecutive ||
+         static_cast<u32>(storage_bindings.count) == VideoCommon::NUM_STORAGE_BUFFERS)) {
+        FlushStorageBuffers();
+    }
+    if (storage_bindings.count == 0) {
+        storage_bindings.first = binding;
+    }
+    // Offsets and sizes of null buffers are ignored
+    const size_t index = static_cast<size_t>(storage_bindings.count++);
+    storage_bindings.buffers[index] = handle;
+    storage_bindings.offsets[index] = static_cast<GLintptr>(offset);
+    storage_bindings.sizes[index] = static_cast<GLsizeiptr>(size);
+}
+
 void BufferCacheRuntime::BindTransformFeedbackBuffer(u32 index, Buffer& buffer, u32 offset,
                                                      u32 size) {
     glBindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, index, buffer.Handle(),
@@ -54,6 +54,8 @@ private:
 
     GLuint64EXT address = 0;
     OGLBuffer buffer;
+    /// Uploads go through the stream buffer of the runtime when it has one
+    StreamBuffer* stream_buffer = nullptr;
     GLenum current_residency_access = GL_NONE;
     std::vector<BufferView> views;
 };
@@ -113,6 +115,9 @@ public:
     void BindComputeStorageBuffer(u32 binding_index, Buffer& buffer, u32 offset, u32 size,
                                   bool is_written);
 
+    /// Binds the storage buffers queued since the last call, called after each stage is bound.
+    void FlushStorageBuffers();
+
     void BindTransformFeedbackBuffer(u32 index, Buffer& buffer, u32 offset, u32 size);
 
     void BindTransformFeedbackBuffers(VideoCommon::HostBindings<Buffer>& bindings);
@@ -194,6 +199,11 @@ public:
         return device_access_memory;
     }
 
+    /// OpenGL has no live budget query, the static limit is used instead.
+    u64 GetDeviceMemoryBudget() const {
+        return 0;
+    }
+
     bool CanReportMemoryUsage() const {
         return device.CanReportMemoryUsage();
     }
@@ -203,6 +213,17 @@ public:
     }
 
 private:
+    /// Consecutive storage buffer bindings, bound at once with glBindBuffersRange
+    struct StorageBindings {
+        GLuint first = 0;
+        GLsizei count = 0;
+        std::array<GLuint, VideoCommon::NUM_STORAGE_BUFFERS> buffers{};
+        std::array<GLintptr, VideoCommon::NUM_STORAGE_BUFFERS> offsets{};
+        std::array<GLsizeiptr, VideoCommon::NUM_STORAGE_BUFFERS> sizes{};
+    };
+
+    void QueueStorageBuffer(GLuint binding, GLuint handle, u32 offset, u32 size);
+
     static constexpr std::array PABO_LUT{
         GL_VERTEX_PROGRAM_PARAMETER_BUFFER_NV,          GL_TESS_CONTROL_PROGRAM_PARAMETER_BUFFER_NV,
         GL_TESS_EVALUATION_PROGRAM_PARAMETER_BUFFER_NV, GL_GEOMETRY_PROGRAM_PARAMETER_BUFFER_NV,
@@ -227,6 +248,8 @@ private:
 
     std::optional<StreamBuffer> stream_buffer;
 
+    StorageBindings storage_bindings;
+
     std::array<std::array<OGLBuffer, VideoCommon::NUM_GRAPHICS_UNIFORM_BUFFERS>,
                VideoCommon::NUM_STAGES>
         fast_uniforms;
@@ -257,6 +280,7 @@ struct BufferCacheParams {
 
     // TODO: Investigate why OpenGL seems to perform worse with persistently mapped buffer uploads
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = false;
+    static constexpr bool USE_DIRECT_STREAM_UPLOADS = false;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
@@ -161,6 +161,10 @@ public:
         return has_draw_texture;
     }
 
+    bool HasParallelShaderCompile() const {
+        return has_parallel_shader_compile;
+    }
+
     bool IsWarpSizePotentiallyLargerThanGuest() const {
         return warp_size_potentially_larger_than_guest;
     }
@@ -244,6 +248,7 @@ private:
     bool has_amd_shader_half_float{};
     bool has_sparse_texture_2{};
     bool has_draw_texture{};
+    bool has_parallel_shader_compile{};
     bool warp_size_potentially_larger_than_guest{};
     bool need_fastmath_off{};
     bool has_cbuf_ftou_bug{};
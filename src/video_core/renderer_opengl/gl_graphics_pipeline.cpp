@@ -235,6 +235,9 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
         GenerateTransformFeedbackState();
     }
     const bool in_parallel = thread_worker != nullptr;
+    is_fenced = force_context_flush || in_parallel;
+    // The assembly programs of GL_NV_gpu_program5 are not covered by the extension
+    polls_link_status = device.HasParallelShaderCompile() && !assembly_shaders;
     auto func{[this, sources_ = std::move(sources), sources_spirv_ = std::move(sources_spirv),
                shader_notify, backend, in_parallel,
                force_context_flush](ShaderContext::Context*) mutable {
@@ -265,14 +268,15 @@ GraphicsPipeline::GraphicsPipeline(const Device& device, TextureCache& texture_c
             glFlush();
             built_condvar.notify_one();
         } else {
-            is_built = true;
+            is_built = !polls_link_status;
         }
         if (shader_notify) {
             shader_notify->MarkShaderComplete();
         }
     }};
     if (thread_worker) {
-        thread_worker->QueueWork(std::move(func));
+        // Builds are asynchronous, so they yield to work a thread is blocked on
+        thread_worker->QueueWork(std::move(func), Common::WorkPriority::Normal);
     } else {
         func(nullptr);
     }
@@ -621,11 +625,14 @@ void GraphicsPipeline::GenerateTransformFeedbackState() {
 }
 
 void GraphicsPipeline::WaitForBuild() {
-    if (built_fence.handle == 0) {
-        std::unique_lock lock{built_mutex};
-        built_condvar.wait(lock, [this] { return built_fence.handle != 0; });
+    if (is_fenced) {
+        if (built_fence.handle == 0) {
+            std::unique_lock lock{built_mutex};
+            built_condvar.wait(lock, [this] { return built_fence.handle != 0; });
+        }
+        ASSERT(glClientWaitSync(built_fence.handle, 0, GL_TIMEOUT_IGNORED) != GL_WAIT_FAILED);
     }
-    ASSERT(glClientWaitSync(built_fence.handle, 0, GL_TIMEOUT_IGNORED) != GL_WAIT_FAILED);
+    // Binding programs the driver is still linking blocks until they are done
     is_built = true;
 }
 
@@ -633,11 +640,25 @@ bool GraphicsPipeline::IsBuilt() noexcept {
     if (is_built) {
         return true;
     }
-    if (built_fence.handle == 0) {
+    if (is_fenced && (built_fence.handle == 0 || !built_fence.IsSignaled())) {
         return false;
     }
-    is_built = built_fence.IsSignaled();
+    is_built = IsLinked();
     return is_built;
 }
 
+bool GraphicsPipeline::IsLinked() const noexcept {
+    if (!polls_link_status) {
+        return true;
+    }
+    return std::ranges::all_of(source_programs, [](const OGLProgram& program) {
+        if (program.handle == 0) {
+            return true;
+        }
+        GLint is_complete{};
+        glGetProgramiv(program.handle, GL_COMPLETION_STATUS_KHR, &is_complete);
+        return is_complete != GL_FALSE;
+    });
+}
+
 } // namespace OpenGL
@@ -12,8 +12,8 @@
 #include <utility>
 
 #include "common/bit_field.h"
-#include "common/cityhash.h"
 #include "common/common_types.h"
+#include "common/hash.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
@@ -49,7 +49,7 @@ struct GraphicsPipelineKey {
     VideoCommon::TransformFeedbackState xfb_state;
 
     size_t Hash() const noexcept {
-        return static_cast<size_t>(Common::CityHash64(reinterpret_cast<const char*>(this), Size()));
+        return static_cast<size_t>(Common::WyHash64(this, Size()));
     }
 
     bool operator==(const GraphicsPipelineKey& rhs) const noexcept {
@@ -129,6 +129,10 @@ private:
 
     void WaitForBuild();
 
+    /// Returns true when the driver finished linking the programs, always without
+    /// KHR_parallel_shader_compile
+    [[nodiscard]] bool IsLinked() const noexcept;
+
     TextureCache& texture_cache;
     BufferCache& buffer_cache;
     Tegra::MemoryManager* gpu_memory;
@@ -164,6 +168,8 @@ private:
     std::condition_variable built_condvar;
     OGLSync built_fence{};
     bool is_built{false};
+    bool is_fenced{false};         ///< Built on another context, signaled by built_fence
+    bool polls_link_status{false}; ///< Programs are linked in the background by the driver
 };
 
 } // namespace OpenGL
@@ -553,6 +553,25 @@ void RasterizerOpenGL::InvalidateRegion(DAddr addr, u64 size, VideoCommon::Cache
     }
 }
 
+void RasterizerOpenGL::InnerInvalidation(std::span<const std::pair<DAddr, std::size_t>> sequences) {
+    {
+        std::scoped_lock lock{texture_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            texture_cache.WriteMemory(addr, size);
+        }
+    }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        for (const auto& [addr, size] : sequences) {
+            buffer_cache.WriteMemory(addr, size);
+        }
+    }
+    for (const auto& [addr, size] : sequences) {
+        shader_cache.InvalidateRegion(addr, size);
+        query_cache.InvalidateRegion(addr, size);
+    }
+}
+
 bool RasterizerOpenGL::OnCPUWrite(DAddr addr, u64 size) {
     DEBUG_ASSERT(addr != 0 || size != 0);
     {
@@ -1455,4 +1474,9 @@ bool AccelerateDMA::BufferToImage(const Tegra::DMA::ImageCopy& copy_info,
     return DmaBufferImageCopy<true>(copy_info, buffer_operand, image_operand);
 }
 
+bool AccelerateDMA::BufferSwizzle(const Tegra::DMA::SwizzleCopy& copy) {
+    // Swizzling copies are only accelerated on Vulkan
+    return false;
+}
+
 } // namespace OpenGL
@@ -62,6 +62,8 @@ public:
     bool BufferToImage(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::BufferOperand& src,
                        const Tegra::DMA::ImageOperand& dst) override;
 
+    bool BufferSwizzle(const Tegra::DMA::SwizzleCopy& copy) override;
+
 private:
     template <bool IS_IMAGE_UPLOAD>
     bool DmaBufferImageCopy(const Tegra::DMA::ImageCopy& copy_info,
@@ -99,6 +101,7 @@ public:
     VideoCore::RasterizerDownloadArea GetFlushArea(PAddr addr, u64 size) override;
     void InvalidateRegion(DAddr addr, u64 size,
                           VideoCommon::CacheType which = VideoCommon::CacheType::All) override;
+    void InnerInvalidation(std::span<const std::pair<DAddr, std::size_t>> sequences) override;
     void OnCacheInvalidation(PAddr addr, u64 size) override;
     bool OnCPUWrite(PAddr addr, u64 size) override;
     void InvalidateGPUCache() override;
@@ -143,6 +146,13 @@ public:
         return true;
     }
 
+    VideoCore::CacheMemoryUsage GetCacheMemoryUsage() const override {
+        return {
+            .texture_cache = texture_cache.GetImageMemoryUsage(),
+            .buffer_cache = buffer_cache.GetBufferMemoryUsage(),
+        };
+    }
+
     std::optional<FramebufferTextureInfo> AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                                             VAddr framebuffer_addr,
                                                             u32 pixel_stride);
@@ -54,7 +54,7 @@ using VideoCommon::LoadPipelines;
 using VideoCommon::SerializePipeline;
 using Context = ShaderContext::Context;
 
-constexpr u32 CACHE_VERSION = 13;
+constexpr u32 CACHE_VERSION = 15;
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -252,6 +252,11 @@ ShaderCache::ShaderCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
           .support_geometry_shader_passthrough = device.HasGeometryShaderPassthrough(),
           .support_conditional_barrier = device.SupportsConditionalBarriers(),
       } {
+    if (device.HasParallelShaderCompile()) {
+        // Let the driver link programs on as many threads as it sees fit, shared worker contexts
+        // keep the default which is already the implementation's choice
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
     if (use_asynchronous_shaders) {
         workers = CreateWorkers();
     }
@@ -614,7 +619,10 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
 std::unique_ptr<ShaderWorker> ShaderCache::CreateWorkers() const {
     return std::make_unique<ShaderWorker>((std::max)(std::thread::hardware_concurrency(), 2U) - 1,
                                           "GlShaderBuilder",
-                                          [this] { return Context{emu_window}; });
+                                          [this] { return Context{emu_window}; },
+                                          Settings::values.core_type_affinity.GetValue()
+                                              ? Common::CoreType::Efficiency
+                                              : Common::CoreType::Any);
 }
 
 } // namespace OpenGL
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -69,6 +72,11 @@ public:
 
     [[nodiscard]] std::pair<std::span<u8>, size_t> Request(size_t size) noexcept;
 
+    /// Returns true when a request of the given size fits in the buffer.
+    [[nodiscard]] static constexpr bool CanRequest(size_t size) noexcept {
+        return size < REGION_SIZE;
+    }
+
     [[nodiscard]] GLuint Handle() const noexcept {
         return buffer.handle;
     }
@@ -1,8 +1,12 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <span>
 
@@ -85,10 +89,19 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    /// OpenGL has no live budget query, the static limit is used instead.
+    u64 GetDeviceMemoryBudget() const {
+        return 0;
+    }
+
     bool CanReportMemoryUsage() const {
         return device.CanReportMemoryUsage();
     }
 
+    size_t GetMaxSamplers() const {
+        return std::numeric_limits<size_t>::max();
+    }
+
     bool ShouldReinterpret([[maybe_unused]] Image& dst,
                            [[maybe_unused]] Image& src) const noexcept {
         return true;
@@ -372,6 +385,7 @@ struct TextureCacheParams {
     static constexpr bool HAS_EMULATED_COPIES = true;
     static constexpr bool HAS_DEVICE_MEMORY_INFO = true;
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = true;
+    static constexpr bool IMPLEMENTS_HOST_IMAGE_COPY = false;
 
     using Runtime = OpenGL::TextureCacheRuntime;
     using Image = OpenGL::Image;
@@ -20,6 +20,7 @@ using VideoCommon::Region2D;
 class Device;
 class Framebuffer;
 class ImageView;
+class RenderPassCache;
 class StateTracker;
 class Scheduler;
 
@@ -43,7 +44,8 @@ struct BlitDepthStencilPipelineKey {
 class BlitImageHelper {
 public:
     explicit BlitImageHelper(const Device& device, Scheduler& scheduler,
-                             StateTracker& state_tracker, DescriptorPool& descriptor_pool);
+                             StateTracker& state_tracker, DescriptorPool& descriptor_pool,
+                             RenderPassCache& render_pass_cache);
     ~BlitImageHelper();
 
     void BlitColor(const Framebuffer* dst_framebuffer, const ImageView& src_image_view,
@@ -129,6 +131,7 @@ private:
     const Device& device;
     Scheduler& scheduler;
     StateTracker& state_tracker;
+    RenderPassCache& render_pass_cache;
 
     vk::DescriptorSetLayout one_texture_set_layout;
     vk::DescriptorSetLayout two_textures_set_layout;
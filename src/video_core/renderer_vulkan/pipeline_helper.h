@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
 #include <boost/container/small_vector.hpp>
@@ -10,6 +11,7 @@
 #include "common/common_types.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/shader_info.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/texture_cache/types.h"
@@ -28,13 +30,38 @@ public:
                num_descriptors <= device->MaxPushDescriptors();
     }
 
+    bool CanUseDescriptorBuffer() const noexcept {
+        if (!device->IsExtDescriptorBufferSupported() || bindings.empty()) {
+            return false;
+        }
+        // Texel buffers are only known by their views, their addresses aren't tracked
+        const bool single_array =
+            device->DescriptorBufferProperties().combinedImageSamplerDescriptorSingleArray;
+        return std::ranges::all_of(bindings, [single_array](const auto& layout_binding) {
+            switch (layout_binding.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                return true;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                return single_array || layout_binding.descriptorCount == 1;
+            default:
+                return false;
+            }
+        });
+    }
+
     // TODO(crueter): utilize layout binding flags
-    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor) const {
+    vk::DescriptorSetLayout CreateDescriptorSetLayout(bool use_push_descriptor,
+                                                      bool use_descriptor_buffer = false) const {
         if (bindings.empty()) {
             return nullptr;
         }
-        const VkDescriptorSetLayoutCreateFlags flags =
+        VkDescriptorSetLayoutCreateFlags flags =
             use_push_descriptor ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+        if (use_descriptor_buffer) {
+            flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+        }
         return device->GetLogical().CreateDescriptorSetLayout({
             .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
             .pNext = nullptr,
@@ -44,6 +71,26 @@ public:
         });
     }
 
+    DescriptorBufferLayout CreateDescriptorBufferLayout(
+        VkDescriptorSetLayout descriptor_set_layout) const {
+        const vk::Device& dev{device->GetLogical()};
+        DescriptorBufferLayout layout{
+            .size = dev.GetDescriptorSetLayoutSizeEXT(descriptor_set_layout),
+            .bindings{},
+        };
+        for (size_t i = 0; i < bindings.size(); ++i) {
+            layout.bindings.push_back({
+                .type = bindings[i].descriptorType,
+                .count = bindings[i].descriptorCount,
+                .offset = dev.GetDescriptorSetLayoutBindingOffsetEXT(descriptor_set_layout,
+                                                                     bindings[i].binding),
+                .data_offset = entries[i].offset,
+                .data_stride = entries[i].stride,
+            });
+        }
+        return layout;
+    }
+
     vk::DescriptorUpdateTemplate CreateTemplate(VkDescriptorSetLayout descriptor_set_layout,
                                                 VkPipelineLayout pipeline_layout,
                                                 bool use_push_descriptor) const {
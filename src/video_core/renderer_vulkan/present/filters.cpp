@@ -7,10 +7,14 @@
 // SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <vector>
+
 #include <vulkan/vulkan_core.h>
 #include "common/assert.h"
 #include "common/common_types.h"
 
+#include "video_core/fsr.h"
 #include "video_core/host_shaders/present_area_frag_spv.h"
 #include "video_core/host_shaders/present_bicubic_frag_spv.h"
 #include "video_core/host_shaders/present_gaussian_frag_spv.h"
@@ -20,6 +24,8 @@
 #include "video_core/host_shaders/present_bspline_frag_spv.h"
 #include "video_core/host_shaders/present_zero_tangent_frag_spv.h"
 #include "video_core/host_shaders/present_mmpx_frag_spv.h"
+#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp16_frag_spv.h"
+#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp32_frag_spv.h"
 #include "video_core/host_shaders/vulkan_present_frag_spv.h"
 #include "video_core/host_shaders/vulkan_present_scaleforce_fp16_frag_spv.h"
 #include "video_core/host_shaders/vulkan_present_scaleforce_fp32_frag_spv.h"
@@ -40,6 +46,14 @@ vk::ShaderModule SelectScaleForceShader(const Device& device) {
     }
 }
 
+vk::ShaderModule SelectRcasShader(const Device& device) {
+    if (device.IsFloat16Supported()) {
+        return BuildShader(device, VULKAN_FIDELITYFX_FSR_RCAS_FP16_FRAG_SPV);
+    } else {
+        return BuildShader(device, VULKAN_FIDELITYFX_FSR_RCAS_FP32_FRAG_SPV);
+    }
+}
+
 } // Anonymous namespace
 
 std::unique_ptr<WindowAdaptPass> MakeNearestNeighbor(const Device& device, VkFormat frame_format) {
@@ -107,4 +121,14 @@ std::unique_ptr<WindowAdaptPass> MakeMmpx(const Device& device, VkFormat frame_f
                                              BuildShader(device, PRESENT_MMPX_FRAG_SPV));
 }
 
+std::unique_ptr<WindowAdaptPass> MakeFsr(const Device& device, VkFormat frame_format,
+                                         f32 sharpening) {
+    std::array<u32, 4> rcas_con{};
+    ::FSR::FsrRcasCon(rcas_con.data(), sharpening);
+    // RCAS loads texels, the sampler is unused
+    return std::make_unique<WindowAdaptPass>(device, frame_format, CreateBilinearSampler(device),
+                                             SelectRcasShader(device),
+                                             std::vector<u32>{rcas_con[0], rcas_con[1]});
+}
+
 } // namespace Vulkan
@@ -24,5 +24,8 @@ std::unique_ptr<WindowAdaptPass> MakeLanczos(const Device& device, VkFormat fram
 std::unique_ptr<WindowAdaptPass> MakeScaleForce(const Device& device, VkFormat frame_format);
 std::unique_ptr<WindowAdaptPass> MakeArea(const Device& device, VkFormat frame_format);
 std::unique_ptr<WindowAdaptPass> MakeMmpx(const Device& device, VkFormat frame_format);
+/// Presents the output of FSR EASU, sharpening it with RCAS in the same pass.
+std::unique_ptr<WindowAdaptPass> MakeFsr(const Device& device, VkFormat frame_format,
+                                         f32 sharpening);
 
 } // namespace Vulkan
@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <array>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+
+#include "video_core/host_shaders/vulkan_frame_generation_comp_spv.h"
+#include "video_core/renderer_vulkan/present/frame_generation.h"
+#include "video_core/renderer_vulkan/present/util.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+namespace {
+
+constexpr u32 BLOCK_SIZE = 8;
+// Frames are copied bit for bit to and from the storage images, all presentation formats are
+// 32 bits wide and the shader doesn't care about the channel order.
+constexpr VkFormat FORMAT = VK_FORMAT_R8G8B8A8_UNORM;
+
+void ImageBarrier(vk::CommandBuffer& cmdbuf, VkImage image, VkAccessFlags src_access,
+                  VkAccessFlags dst_access, VkImageLayout old_layout, VkImageLayout new_layout) {
+    const VkImageMemoryBarrier barrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = src_access,
+        .dstAccessMask = dst_access,
+        .oldLayout = old_layout,
+        .newLayout = new_layout,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image,
+        .subresourceRange{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        },
+    };
+    cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                           0, barrier);
+}
+
+VkImageCopy MakeImageCopy(VkExtent2D extent) {
+    static constexpr VkImageSubresourceLayers subresource{
+        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .mipLevel = 0,
+        .baseArrayLayer = 0,
+        .layerCount = 1,
+    };
+    return VkImageCopy{
+        .srcSubresource = subresource,
+        .srcOffset = {0, 0, 0},
+        .dstSubresource = subresource,
+        .dstOffset = {0, 0, 0},
+        .extent = {extent.width, extent.height, 1},
+    };
+}
+
+/// Copies a presentation frame, left in the general layout, into a history image
+void CopyToHistory(vk::CommandBuffer& cmdbuf, VkImage image, VkImage history_image,
+                   VkExtent2D extent) {
+    ImageBarrier(cmdbuf, image, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                 VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    ImageBarrier(cmdbuf, history_image, VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                 VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    cmdbuf.CopyImage(image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, history_image,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, MakeImageCopy(extent));
+    ImageBarrier(cmdbuf, image, VK_ACCESS_TRANSFER_READ_BIT,
+                 VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                 VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+    ImageBarrier(cmdbuf, history_image, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL);
+}
+
+} // Anonymous namespace
+
+FrameGeneration::FrameGeneration(const Device& device, MemoryAllocator& allocator,
+                                 VkExtent2D extent)
+    : m_device(device), m_allocator(allocator), m_extent(extent) {
+    CreateImages();
+    CreateShaders();
+    CreateDescriptorPool();
+    CreateDescriptorSetLayouts();
+    CreateDescriptorSets();
+    CreatePipelineLayouts();
+    CreatePipelines();
+    UpdateDescriptorSets();
+}
+
+FrameGeneration::~FrameGeneration() = default;
+
+void FrameGeneration::CreateImages() {
+    for (Image& image : m_history_images) {
+        image.image = CreateWrappedImage(m_allocator, m_extent, FORMAT);
+        image.image_view = CreateWrappedImageView(m_device, image.image, FORMAT);
+    }
+    m_output_image.image = CreateWrappedImage(m_allocator, m_extent, FORMAT);
+    m_output_image.image_view = CreateWrappedImageView(m_device, m_output_image.image, FORMAT);
+}
+
+void FrameGeneration::CreateShaders() {
+    m_shader = CreateWrappedShaderModule(m_device, VULKAN_FRAME_GENERATION_COMP_SPV);
+}
+
+void FrameGeneration::CreateDescriptorPool() {
+    // 3 descriptors, 1 descriptor set per frame order
+    m_descriptor_pool = CreateWrappedDescriptorPool(m_device, 3 * m_history_images.size(),
+                                                    m_history_images.size(),
+                                                    {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE});
+}
+
+void FrameGeneration::CreateDescriptorSetLayouts() {
+    std::array<VkDescriptorSetLayoutBinding, 3> bindings;
+    for (u32 i = 0; i < bindings.size(); i++) {
+        bindings[i] = {
+            .binding = i,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .descriptorCount = 1,
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+            .pImmutableSamplers = nullptr,
+        };
+    }
+    m_descriptor_set_layout =
+        m_device.GetLogical().CreateDescriptorSetLayout(VkDescriptorSetLayoutCreateInfo{
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .bindingCount = static_cast<u32>(bindings.size()),
+            .pBindings = bindings.data(),
+        });
+}
+
+void FrameGeneration::CreateDescriptorSets() {
+    const std::array layouts{*m_descriptor_set_layout, *m_descriptor_set_layout};
+    m_descriptor_sets = CreateWrappedDescriptorSets(m_descriptor_pool, layouts);
+}
+
+void FrameGeneration::CreatePipelineLayouts() {
+    m_pipeline_layout = CreateWrappedPipelineLayout(m_device, m_descriptor_set_layout);
+}
+
+void FrameGeneration::CreatePipelines() {
+    m_pipeline = m_device.GetLogical().CreateComputePipeline(VkComputePipelineCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .stage{
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+            .module = *m_shader,
+            .pName = "main",
+            .pSpecializationInfo = nullptr,
+        },
+        .layout = *m_pipeline_layout,
+        .basePipelineHandle = VK_NULL_HANDLE,
+        .basePipelineIndex = 0,
+    });
+}
+
+void FrameGeneration::UpdateDescriptorSets() {
+    // Set i reads the previous frame from history image i and the current one from the other
+    std::vector<VkDescriptorImageInfo> image_infos;
+    std::vector<VkWriteDescriptorSet> updates;
+    image_infos.reserve(3 * m_history_images.size());
+    for (size_t i = 0; i < m_history_images.size(); i++) {
+        const std::array views{
+            *m_history_images[i].image_view,
+            *m_history_images[i ^ 1].image_view,
+            *m_output_image.image_view,
+        };
+        for (u32 binding = 0; binding < views.size(); binding++) {
+            image_infos.push_back(VkDescriptorImageInfo{
+                .sampler = VK_NULL_HANDLE,
+                .imageView = views[binding],
+                .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+            });
+            updates.push_back(VkWriteDescriptorSet{
+                .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                .pNext = nullptr,
+                .dstSet = m_descriptor_sets[i],
+                .dstBinding = binding,
+                .dstArrayElement = 0,
+                .descriptorCount = 1,
+                .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                .pImageInfo = &image_infos.back(),
+                .pBufferInfo = nullptr,
+                .pTexelBufferView = nullptr,
+            });
+        }
+    }
+    m_device.GetLogical().UpdateDescriptorSets(updates, {});
+}
+
+void FrameGeneration::PushFrame(Scheduler& scheduler, VkImage image) {
+    const size_t current_index = m_previous_index ^ 1;
+    const VkImage history_image{*m_history_images[current_index].image};
+    const VkExtent2D extent{m_extent};
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([=](vk::CommandBuffer cmdbuf) {
+        CopyToHistory(cmdbuf, image, history_image, extent);
+    });
+
+    m_previous_index = current_index;
+    m_has_previous_frame = true;
+}
+
+void FrameGeneration::Draw(Scheduler& scheduler, VkImage image, VkImage output_image) {
+    const size_t current_index = m_previous_index ^ 1;
+    const VkImage history_image{*m_history_images[current_index].image};
+    const VkImage storage_image{*m_output_image.image};
+    const VkDescriptorSet descriptor_set{m_descriptor_sets[m_previous_index]};
+    const VkPipeline pipeline{*m_pipeline};
+    const VkPipelineLayout layout{*m_pipeline_layout};
+    const VkExtent2D extent{m_extent};
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([=](vk::CommandBuffer cmdbuf) {
+        CopyToHistory(cmdbuf, image, history_image, extent);
+
+        ImageBarrier(cmdbuf, storage_image, VK_ACCESS_TRANSFER_READ_BIT,
+                     VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED,
+                     VK_IMAGE_LAYOUT_GENERAL);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, descriptor_set, {});
+        cmdbuf.Dispatch(Common::DivCeil(extent.width, BLOCK_SIZE),
+                        Common::DivCeil(extent.height, BLOCK_SIZE), 1);
+
+        // The output frame is always overwritten, its previous contents don't matter
+        ImageBarrier(cmdbuf, storage_image, VK_ACCESS_SHADER_WRITE_BIT,
+                     VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_GENERAL,
+                     VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+        ImageBarrier(cmdbuf, output_image, 0, VK_ACCESS_TRANSFER_WRITE_BIT,
+                     VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        cmdbuf.CopyImage(storage_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, output_image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, MakeImageCopy(extent));
+        ImageBarrier(cmdbuf, output_image, VK_ACCESS_TRANSFER_WRITE_BIT,
+                     VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                     VK_IMAGE_LAYOUT_GENERAL);
+    });
+
+    m_previous_index = current_index;
+}
+
+} // namespace Vulkan
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/**
+ * Generates intermediate frames on the GPU, by block matching motion estimation between the two
+ * last presented frames and warping both of them halfway along the found motion.
+ */
+class FrameGeneration {
+public:
+    explicit FrameGeneration(const Device& device, MemoryAllocator& allocator, VkExtent2D extent);
+    ~FrameGeneration();
+
+    /// Returns true when a previous frame is stored and a frame can be generated
+    [[nodiscard]] bool HasPreviousFrame() const {
+        return m_has_previous_frame;
+    }
+
+    /// Stores the presented image as the newest frame, without generating anything
+    void PushFrame(Scheduler& scheduler, VkImage image);
+
+    /// Stores the presented image as the newest frame and writes the frame between it and the
+    /// previous one to the output image
+    void Draw(Scheduler& scheduler, VkImage image, VkImage output_image);
+
+private:
+    void CreateImages();
+    void CreateShaders();
+    void CreateDescriptorPool();
+    void CreateDescriptorSetLayouts();
+    void CreateDescriptorSets();
+    void CreatePipelineLayouts();
+    void CreatePipelines();
+    void UpdateDescriptorSets();
+
+    const Device& m_device;
+    MemoryAllocator& m_allocator;
+    const VkExtent2D m_extent;
+
+    vk::ShaderModule m_shader{};
+    vk::DescriptorPool m_descriptor_pool{};
+    vk::DescriptorSetLayout m_descriptor_set_layout{};
+    vk::PipelineLayout m_pipeline_layout{};
+    vk::Pipeline m_pipeline{};
+
+    struct Image {
+        vk::Image image{};
+        vk::ImageView image_view{};
+    };
+    // Two last presented frames, the previous one is at m_previous_index
+    std::array<Image, 2> m_history_images{};
+    Image m_output_image{};
+    // One descriptor set for each frame order
+    vk::DescriptorSets m_descriptor_sets{};
+    size_t m_previous_index{};
+    bool m_has_previous_frame{};
+};
+
+} // namespace Vulkan
@@ -1,15 +1,15 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/common_types.h"
 #include "common/div_ceil.h"
-#include "common/settings.h"
 
 #include "video_core/fsr.h"
 #include "video_core/host_shaders/vulkan_fidelityfx_fsr_easu_fp16_frag_spv.h"
 #include "video_core/host_shaders/vulkan_fidelityfx_fsr_easu_fp32_frag_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp16_frag_spv.h"
-#include "video_core/host_shaders/vulkan_fidelityfx_fsr_rcas_fp32_frag_spv.h"
 #include "video_core/host_shaders/vulkan_fidelityfx_fsr_vert_spv.h"
 #include "video_core/renderer_vulkan/present/fsr.h"
 #include "video_core/renderer_vulkan/present/util.h"
@@ -41,14 +41,10 @@ FSR::FSR(const Device& device, MemoryAllocator& memory_allocator, size_t image_c
 void FSR::CreateImages() {
     m_dynamic_images.resize(m_image_count);
     for (auto& images : m_dynamic_images) {
-        images.images[Easu] =
-            CreateWrappedImage(m_memory_allocator, m_extent, VK_FORMAT_R16G16B16A16_SFLOAT);
-        images.images[Rcas] =
+        images.image =
             CreateWrappedImage(m_memory_allocator, m_extent, VK_FORMAT_R16G16B16A16_SFLOAT);
-        images.image_views[Easu] =
-            CreateWrappedImageView(m_device, images.images[Easu], VK_FORMAT_R16G16B16A16_SFLOAT);
-        images.image_views[Rcas] =
-            CreateWrappedImageView(m_device, images.images[Rcas], VK_FORMAT_R16G16B16A16_SFLOAT);
+        images.image_view =
+            CreateWrappedImageView(m_device, images.image, VK_FORMAT_R16G16B16A16_SFLOAT);
     }
 }
 
@@ -56,10 +52,8 @@ void FSR::CreateRenderPasses() {
     m_renderpass = CreateWrappedRenderPass(m_device, VK_FORMAT_R16G16B16A16_SFLOAT);
 
     for (auto& images : m_dynamic_images) {
-        images.framebuffers[Easu] =
-            CreateWrappedFramebuffer(m_device, m_renderpass, images.image_views[Easu], m_extent);
-        images.framebuffers[Rcas] =
-            CreateWrappedFramebuffer(m_device, m_renderpass, images.image_views[Rcas], m_extent);
+        images.framebuffer =
+            CreateWrappedFramebuffer(m_device, m_renderpass, images.image_view, m_extent);
     }
 }
 
@@ -72,18 +66,14 @@ void FSR::CreateShaders() {
 
     if (m_device.IsFloat16Supported()) {
         m_easu_shader = BuildShader(m_device, VULKAN_FIDELITYFX_FSR_EASU_FP16_FRAG_SPV);
-        m_rcas_shader = BuildShader(m_device, VULKAN_FIDELITYFX_FSR_RCAS_FP16_FRAG_SPV);
     } else {
         m_easu_shader = BuildShader(m_device, VULKAN_FIDELITYFX_FSR_EASU_FP32_FRAG_SPV);
-        m_rcas_shader = BuildShader(m_device, VULKAN_FIDELITYFX_FSR_RCAS_FP32_FRAG_SPV);
     }
 }
 
 void FSR::CreateDescriptorPool() {
-    // EASU: 1 descriptor
-    // RCAS: 1 descriptor
-    // 2 descriptors, 2 descriptor sets per invocation
-    m_descriptor_pool = CreateWrappedDescriptorPool(m_device, 2 * m_image_count, 2 * m_image_count);
+    // EASU: 1 descriptor, 1 descriptor set per invocation
+    m_descriptor_pool = CreateWrappedDescriptorPool(m_device, m_image_count, m_image_count);
 }
 
 void FSR::CreateDescriptorSetLayout() {
@@ -92,7 +82,7 @@ void FSR::CreateDescriptorSetLayout() {
 }
 
 void FSR::CreateDescriptorSets() {
-    std::vector<VkDescriptorSetLayout> layouts(MaxFsrStage, *m_descriptor_set_layout);
+    std::vector<VkDescriptorSetLayout> layouts(1, *m_descriptor_set_layout);
 
     for (auto& images : m_dynamic_images) {
         images.descriptor_sets = CreateWrappedDescriptorSets(m_descriptor_pool, layouts);
@@ -121,20 +111,16 @@ void FSR::CreatePipelineLayouts() {
 void FSR::CreatePipelines() {
     m_easu_pipeline = CreateWrappedPipeline(m_device, m_renderpass, m_pipeline_layout,
                                             std::tie(m_vert_shader, m_easu_shader));
-    m_rcas_pipeline = CreateWrappedPipeline(m_device, m_renderpass, m_pipeline_layout,
-                                            std::tie(m_vert_shader, m_rcas_shader));
 }
 
 void FSR::UpdateDescriptorSets(VkImageView image_view, size_t image_index) {
     Images& images = m_dynamic_images[image_index];
     std::vector<VkDescriptorImageInfo> image_infos;
     std::vector<VkWriteDescriptorSet> updates;
-    image_infos.reserve(2);
+    image_infos.reserve(1);
 
     updates.push_back(CreateWriteDescriptorSet(image_infos, *m_sampler, image_view,
-                                               images.descriptor_sets[Easu], 0));
-    updates.push_back(CreateWriteDescriptorSet(image_infos, *m_sampler, *images.image_views[Easu],
-                                               images.descriptor_sets[Rcas], 0));
+                                               images.descriptor_sets[0], 0));
 
     m_device.GetLogical().UpdateDescriptorSets(updates, {});
 }
@@ -146,8 +132,7 @@ void FSR::UploadImages(Scheduler& scheduler) {
 
     scheduler.Record([&](vk::CommandBuffer cmdbuf) {
         for (auto& image : m_dynamic_images) {
-            ClearColorImage(cmdbuf, *image.images[Easu]);
-            ClearColorImage(cmdbuf, *image.images[Rcas]);
+            ClearColorImage(cmdbuf, *image.image);
         }
     });
     scheduler.Finish();
@@ -160,14 +145,10 @@ VkImageView FSR::Draw(Scheduler& scheduler, size_t image_index, VkImage source_i
                       const Common::Rectangle<f32>& crop_rect) {
     Images& images = m_dynamic_images[image_index];
 
-    VkImage easu_image = *images.images[Easu];
-    VkImage rcas_image = *images.images[Rcas];
-    VkDescriptorSet easu_descriptor_set = images.descriptor_sets[Easu];
-    VkDescriptorSet rcas_descriptor_set = images.descriptor_sets[Rcas];
-    VkFramebuffer easu_framebuffer = *images.framebuffers[Easu];
-    VkFramebuffer rcas_framebuffer = *images.framebuffers[Rcas];
+    VkImage easu_image = *images.image;
+    VkDescriptorSet easu_descriptor_set = images.descriptor_sets[0];
+    VkFramebuffer easu_framebuffer = *images.framebuffer;
     VkPipeline easu_pipeline = *m_easu_pipeline;
-    VkPipeline rcas_pipeline = *m_rcas_pipeline;
     VkPipelineLayout pipeline_layout = *m_pipeline_layout;
     VkRenderPass renderpass = *m_renderpass;
     VkExtent2D extent = m_extent;
@@ -182,16 +163,11 @@ VkImageView FSR::Draw(Scheduler& scheduler, size_t image_index, VkImage source_i
     const f32 viewport_y = crop_rect.top * input_image_height;
 
     PushConstants easu_con{};
-    PushConstants rcas_con{};
     FsrEasuConOffset(easu_con.data() + 0, easu_con.data() + 4, easu_con.data() + 8,
                      easu_con.data() + 12, viewport_width, viewport_height, input_image_width,
                      input_image_height, output_image_width, output_image_height, viewport_x,
                      viewport_y);
 
-    const float sharpening =
-        static_cast<float>(Settings::values.fsr_sharpening_slider.GetValue()) / 100.0f;
-    FsrRcasCon(rcas_con.data(), sharpening);
-
     UploadImages(scheduler);
     UpdateDescriptorSets(source_image_view, image_index);
 
@@ -208,19 +184,9 @@ VkImageView FSR::Draw(Scheduler& scheduler, size_t image_index, VkImage source_i
         cmdbuf.EndRenderPass();
 
         TransitionImageLayout(cmdbuf, easu_image, VK_IMAGE_LAYOUT_GENERAL);
-        TransitionImageLayout(cmdbuf, rcas_image, VK_IMAGE_LAYOUT_GENERAL);
-        BeginRenderPass(cmdbuf, renderpass, rcas_framebuffer, extent);
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, rcas_pipeline);
-        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0,
-                                  rcas_descriptor_set, {});
-        cmdbuf.PushConstants(pipeline_layout, VK_SHADER_STAGE_FRAGMENT_BIT, rcas_con);
-        cmdbuf.Draw(3, 1, 0, 0);
-        cmdbuf.EndRenderPass();
-
-        TransitionImageLayout(cmdbuf, rcas_image, VK_IMAGE_LAYOUT_GENERAL);
     });
 
-    return *images.image_views[Rcas];
+    return *images.image_view;
 }
 
 } // namespace Vulkan
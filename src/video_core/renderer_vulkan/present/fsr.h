@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -12,6 +15,8 @@ namespace Vulkan {
 class Device;
 class Scheduler;
 
+/// Upscales with FSR EASU, the RCAS sharpening is left to the present pass made by MakeFsr so
+/// the output is only written once.
 class FSR {
 public:
     explicit FSR(const Device& device, MemoryAllocator& memory_allocator, size_t image_count,
@@ -39,28 +44,20 @@ private:
     const size_t m_image_count;
     const VkExtent2D m_extent;
 
-    enum FsrStage {
-        Easu,
-        Rcas,
-        MaxFsrStage,
-    };
-
     vk::DescriptorPool m_descriptor_pool;
     vk::DescriptorSetLayout m_descriptor_set_layout;
     vk::PipelineLayout m_pipeline_layout;
     vk::ShaderModule m_vert_shader;
     vk::ShaderModule m_easu_shader;
-    vk::ShaderModule m_rcas_shader;
     vk::Pipeline m_easu_pipeline;
-    vk::Pipeline m_rcas_pipeline;
     vk::RenderPass m_renderpass;
     vk::Sampler m_sampler;
 
     struct Images {
         vk::DescriptorSets descriptor_sets;
-        std::array<vk::Image, MaxFsrStage> images;
-        std::array<vk::ImageView, MaxFsrStage> image_views;
-        std::array<vk::Framebuffer, MaxFsrStage> framebuffers;
+        vk::Image image;
+        vk::ImageView image_view;
+        vk::Framebuffer framebuffer;
     };
     std::vector<Images> m_dynamic_images;
     bool m_images_ready{};
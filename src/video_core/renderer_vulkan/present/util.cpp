@@ -36,8 +36,9 @@ vk::Image CreateWrappedImage(MemoryAllocator& allocator, VkExtent2D dimensions,
         .arrayLayers = 1,
         .samples = VK_SAMPLE_COUNT_1_BIT,
         .tiling = VK_IMAGE_TILING_OPTIMAL,
-        .usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT |
-                 VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+        .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                 VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+                 VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -368,7 +369,8 @@ vk::PipelineLayout CreateWrappedPipelineLayout(const Device& device,
 static vk::Pipeline CreateWrappedPipelineImpl(
     const Device& device, vk::RenderPass& renderpass, vk::PipelineLayout& layout,
     std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders,
-    VkPipelineColorBlendAttachmentState blending) {
+    VkPipelineColorBlendAttachmentState blending,
+    const VkSpecializationInfo* fragment_specialization) {
     const std::array<VkPipelineShaderStageCreateInfo, 2> shader_stages{{
         {
             .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
@@ -386,7 +388,7 @@ static vk::Pipeline CreateWrappedPipelineImpl(
             .stage = VK_SHADER_STAGE_FRAGMENT_BIT,
             .module = *std::get<1>(shaders),
             .pName = "main",
-            .pSpecializationInfo = nullptr,
+            .pSpecializationInfo = fragment_specialization,
         },
     }};
 
@@ -495,7 +497,8 @@ static vk::Pipeline CreateWrappedPipelineImpl(
 
 vk::Pipeline CreateWrappedPipeline(const Device& device, vk::RenderPass& renderpass,
                                    vk::PipelineLayout& layout,
-                                   std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders) {
+                                   std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders,
+                                   const VkSpecializationInfo* fragment_specialization) {
     constexpr VkPipelineColorBlendAttachmentState color_blend_attachment_disabled{
         .blendEnable = VK_FALSE,
         .srcColorBlendFactor = VK_BLEND_FACTOR_ZERO,
@@ -509,12 +512,13 @@ vk::Pipeline CreateWrappedPipeline(const Device& device, vk::RenderPass& renderp
     };
 
     return CreateWrappedPipelineImpl(device, renderpass, layout, shaders,
-                                     color_blend_attachment_disabled);
+                                     color_blend_attachment_disabled, fragment_specialization);
 }
 
 vk::Pipeline CreateWrappedPremultipliedBlendingPipeline(
     const Device& device, vk::RenderPass& renderpass, vk::PipelineLayout& layout,
-    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders) {
+    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders,
+    const VkSpecializationInfo* fragment_specialization) {
     constexpr VkPipelineColorBlendAttachmentState color_blend_attachment_premultiplied{
         .blendEnable = VK_TRUE,
         .srcColorBlendFactor = VK_BLEND_FACTOR_ONE,
@@ -528,12 +532,13 @@ vk::Pipeline CreateWrappedPremultipliedBlendingPipeline(
     };
 
     return CreateWrappedPipelineImpl(device, renderpass, layout, shaders,
-                                     color_blend_attachment_premultiplied);
+                                     color_blend_attachment_premultiplied, fragment_specialization);
 }
 
 vk::Pipeline CreateWrappedCoverageBlendingPipeline(
     const Device& device, vk::RenderPass& renderpass, vk::PipelineLayout& layout,
-    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders) {
+    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders,
+    const VkSpecializationInfo* fragment_specialization) {
     constexpr VkPipelineColorBlendAttachmentState color_blend_attachment_coverage{
         .blendEnable = VK_TRUE,
         .srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA,
@@ -547,7 +552,7 @@ vk::Pipeline CreateWrappedCoverageBlendingPipeline(
     };
 
     return CreateWrappedPipelineImpl(device, renderpass, layout, shaders,
-                                     color_blend_attachment_coverage);
+                                     color_blend_attachment_coverage, fragment_specialization);
 }
 
 VkWriteDescriptorSet CreateWriteDescriptorSet(std::vector<VkDescriptorImageInfo>& images,
@@ -45,13 +45,16 @@ vk::PipelineLayout CreateWrappedPipelineLayout(const Device& device,
                                                vk::DescriptorSetLayout& layout);
 vk::Pipeline CreateWrappedPipeline(const Device& device, vk::RenderPass& renderpass,
                                    vk::PipelineLayout& layout,
-                                   std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders);
+                                   std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders,
+                                   const VkSpecializationInfo* fragment_specialization = nullptr);
 vk::Pipeline CreateWrappedPremultipliedBlendingPipeline(
     const Device& device, vk::RenderPass& renderpass, vk::PipelineLayout& layout,
-    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders);
+    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders,
+    const VkSpecializationInfo* fragment_specialization = nullptr);
 vk::Pipeline CreateWrappedCoverageBlendingPipeline(
     const Device& device, vk::RenderPass& renderpass, vk::PipelineLayout& layout,
-    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders);
+    std::tuple<vk::ShaderModule&, vk::ShaderModule&> shaders,
+    const VkSpecializationInfo* fragment_specialization = nullptr);
 VkWriteDescriptorSet CreateWriteDescriptorSet(std::vector<VkDescriptorImageInfo>& images,
                                               VkSampler sampler, VkImageView view,
                                               VkDescriptorSet set, u32 binding);
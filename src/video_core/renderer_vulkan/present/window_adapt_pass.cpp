@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -16,8 +19,10 @@
 namespace Vulkan {
 
 WindowAdaptPass::WindowAdaptPass(const Device& device_, VkFormat frame_format,
-                                 vk::Sampler&& sampler_, vk::ShaderModule&& fragment_shader_)
-    : device(device_), sampler(std::move(sampler_)), fragment_shader(std::move(fragment_shader_)) {
+                                 vk::Sampler&& sampler_, vk::ShaderModule&& fragment_shader_,
+                                 std::vector<u32> fragment_constants_)
+    : device(device_), sampler(std::move(sampler_)), fragment_shader(std::move(fragment_shader_)),
+      fragment_constants(std::move(fragment_constants_)) {
     CreateDescriptorSetLayout();
     CreatePipelineLayout();
     CreateVertexShader();
@@ -143,12 +148,31 @@ void WindowAdaptPass::CreateRenderPass(VkFormat frame_format) {
 }
 
 void WindowAdaptPass::CreatePipelines() {
+    std::vector<VkSpecializationMapEntry> constant_entries(fragment_constants.size());
+    for (u32 i = 0; i < static_cast<u32>(constant_entries.size()); ++i) {
+        constant_entries[i] = VkSpecializationMapEntry{
+            .constantID = i,
+            .offset = i * static_cast<u32>(sizeof(u32)),
+            .size = sizeof(u32),
+        };
+    }
+    const VkSpecializationInfo fragment_specialization{
+        .mapEntryCount = static_cast<u32>(constant_entries.size()),
+        .pMapEntries = constant_entries.data(),
+        .dataSize = fragment_constants.size() * sizeof(u32),
+        .pData = fragment_constants.data(),
+    };
+    const VkSpecializationInfo* const specialization =
+        fragment_constants.empty() ? nullptr : &fragment_specialization;
     opaque_pipeline = CreateWrappedPipeline(device, render_pass, pipeline_layout,
-                                            std::tie(vertex_shader, fragment_shader));
+                                            std::tie(vertex_shader, fragment_shader),
+                                            specialization);
     premultiplied_pipeline = CreateWrappedPremultipliedBlendingPipeline(
-        device, render_pass, pipeline_layout, std::tie(vertex_shader, fragment_shader));
+        device, render_pass, pipeline_layout, std::tie(vertex_shader, fragment_shader),
+        specialization);
     coverage_pipeline = CreateWrappedCoverageBlendingPipeline(
-        device, render_pass, pipeline_layout, std::tie(vertex_shader, fragment_shader));
+        device, render_pass, pipeline_layout, std::tie(vertex_shader, fragment_shader),
+        specialization);
 }
 
 } // namespace Vulkan
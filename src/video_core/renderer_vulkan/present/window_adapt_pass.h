@@ -1,9 +1,13 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2024 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <list>
+#include <vector>
 
 #include "common/math_util.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -26,8 +30,11 @@ class RasterizerVulkan;
 
 class WindowAdaptPass final {
 public:
+    /// fragment_constants are the values of the fragment shader specialization constants, in
+    /// constant_id order.
     explicit WindowAdaptPass(const Device& device, VkFormat frame_format, vk::Sampler&& sampler,
-                             vk::ShaderModule&& fragment_shader);
+                             vk::ShaderModule&& fragment_shader,
+                             std::vector<u32> fragment_constants = {});
     ~WindowAdaptPass();
 
     void Draw(RasterizerVulkan& rasterizer, Scheduler& scheduler, size_t image_index,
@@ -51,6 +58,7 @@ private:
     vk::Sampler sampler;
     vk::ShaderModule vertex_shader;
     vk::ShaderModule fragment_shader;
+    std::vector<u32> fragment_constants;
     vk::RenderPass render_pass;
     vk::Pipeline opaque_pipeline;
     vk::Pipeline premultiplied_pipeline;
@@ -165,7 +165,7 @@ try
     , rasterizer(render_window, gpu, device_memory, device, memory_allocator, state_tracker, scheduler) {
 
     if (Settings::values.renderer_force_max_clock.GetValue() && device.ShouldBoostClocks()) {
-        turbo_mode.emplace(instance, dld);
+        turbo_mode.emplace(instance, dld, scheduler.GetMasterSemaphore());
         scheduler.RegisterOnSubmit([this] { turbo_mode->QueueSubmitted(); });
     }
 
@@ -212,113 +212,13 @@ class BooleanSetting {
     Java_org_yuzu_yuzu_1emu_features_settings_model_BooleanSetting_isFrameInterpolationEnabled(JNIEnv* env, jobject /* this */) {
         return static_cast<jboolean>(BooleanSetting::FRAME_INTERPOLATION.getBoolean());
     }
-
-    void RendererVulkan::InterpolateFrames(Frame* prev_frame, Frame* interpolated_frame) {
-        if (!prev_frame || !interpolated_frame || !prev_frame->image || !interpolated_frame->image) {
-            return;
-        }
-
-        const auto& framebuffer_layout = render_window.GetFramebufferLayout();
-        // Fixed aggressive downscale (50%)
-        VkExtent2D dst_extent{
-            .width = framebuffer_layout.width / 2,
-            .height = framebuffer_layout.height / 2
-        };
-
-        // Check if we need to recreate the destination frame
-        bool needs_recreation = false;  // Only recreate when necessary
-        if (!interpolated_frame->image_view) {
-            needs_recreation = true;  // Need to create initially
-        } else {
-            // Check if dimensions have changed
-            if (interpolated_frame->framebuffer) {
-                needs_recreation = (framebuffer_layout.width / 2 != dst_extent.width) ||
-                                  (framebuffer_layout.height / 2 != dst_extent.height);
-            } else {
-                needs_recreation = true;
-            }
-        }
-
-        if (needs_recreation) {
-            interpolated_frame->image = CreateWrappedImage(memory_allocator, dst_extent, swapchain.GetImageViewFormat());
-            interpolated_frame->image_view = CreateWrappedImageView(device, interpolated_frame->image, swapchain.GetImageViewFormat());
-            interpolated_frame->framebuffer = blit_swapchain.CreateFramebuffer(
-                Layout::FramebufferLayout{dst_extent.width, dst_extent.height},
-                *interpolated_frame->image_view,
-                swapchain.GetImageViewFormat());
-        }
-
-        scheduler.RequestOutsideRenderPassOperationContext();
-        scheduler.Record([&](vk::CommandBuffer cmdbuf) {
-            // Transition images to transfer layouts
-            TransitionImageLayout(cmdbuf, *prev_frame->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
-            TransitionImageLayout(cmdbuf, *interpolated_frame->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
-            // Perform the downscale blit
-            VkImageBlit blit_region{};
-            blit_region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
-            blit_region.srcOffsets[0] = {0, 0, 0};
-            blit_region.srcOffsets[1] = {
-                static_cast<int32_t>(framebuffer_layout.width),
-                static_cast<int32_t>(framebuffer_layout.height),
-                1
-            };
-            blit_region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
-            blit_region.dstOffsets[0] = {0, 0, 0};
-            blit_region.dstOffsets[1] = {
-                static_cast<int32_t>(dst_extent.width),
-                static_cast<int32_t>(dst_extent.height),
-                1
-            };
-
-            // Using the wrapper's BlitImage with proper parameters
-            cmdbuf.BlitImage(
-                *prev_frame->image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                *interpolated_frame->image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                blit_region, VK_FILTER_NEAREST
-            );
-
-            // Transition back to general layout
-            TransitionImageLayout(cmdbuf, *prev_frame->image, VK_IMAGE_LAYOUT_GENERAL);
-            TransitionImageLayout(cmdbuf, *interpolated_frame->image, VK_IMAGE_LAYOUT_GENERAL);
-        });
-    }
 #endif
 
 void RendererVulkan::Composite(std::span<const Tegra::FramebufferConfig> framebuffers) {
-    #ifdef __ANDROID__
-    static int frame_counter = 0;
-    static int target_fps = 60; // Target FPS (30 or 60)
-    int frame_skip_threshold = 1;
-
-    bool frame_skipping = false; //BooleanSetting::FRAME_SKIPPING.getBoolean();
-    bool frame_interpolation = BooleanSetting::FRAME_INTERPOLATION.getBoolean();
-    #endif
-
     if (framebuffers.empty()) {
         return;
     }
 
-    #ifdef __ANDROID__
-    if (frame_skipping) {
-        frame_skip_threshold = (target_fps == 30) ? 2 : 2;
-    }
-
-    frame_counter++;
-    if (frame_counter % frame_skip_threshold != 0) {
-        if (frame_interpolation && previous_frame) {
-            Frame* interpolated_frame = present_manager.GetRenderFrame();
-            InterpolateFrames(previous_frame, interpolated_frame);
-            blit_swapchain.DrawToFrame(rasterizer, interpolated_frame, framebuffers,
-                                       render_window.GetFramebufferLayout(), swapchain.GetImageCount(),
-                                       swapchain.GetImageViewFormat());
-            scheduler.Flush(*interpolated_frame->render_ready);
-            present_manager.Present(interpolated_frame);
-        }
-        return;
-    }
-    #endif
-
     SCOPE_EXIT {
         render_window.OnFrameDisplayed();
     };
@@ -334,8 +234,18 @@ void RendererVulkan::Composite(std::span<const Tegra::FramebufferConfig> framebu
     blit_swapchain.DrawToFrame(rasterizer, frame, framebuffers,
                                render_window.GetFramebufferLayout(), swapchain.GetImageCount(),
                                swapchain.GetImageViewFormat());
+    if (Settings::values.frame_generation.GetValue() && present_manager.UsesPresentThread()) {
+        // The generated frame goes first, it's the one between the previous frame and this one
+        if (Frame* const generated = blit_swapchain.GenerateFrame(frame)) {
+            scheduler.Flush(*generated->render_ready);
+            present_manager.Present(generated);
+        }
+    }
     scheduler.Flush(*frame->render_ready);
     present_manager.Present(frame);
+    if (turbo_mode) {
+        turbo_mode->FrameEnded(gpu.TargetFrameTime());
+    }
 
     gpu.RendererFrameEndNotify();
     rasterizer.TickFrame();
@@ -360,46 +270,55 @@ void RendererVulkan::Report() const {
     LOG_INFO(Render_Vulkan, "Available VRAM: {:.2f} GiB", available_vram);
 }
 
-vk::Buffer RendererVulkan::RenderToBuffer(std::span<const Tegra::FramebufferConfig> framebuffers,
-                                          const Layout::FramebufferLayout& layout, VkFormat format,
-                                          VkDeviceSize buffer_size) {
-    auto frame = [&]() {
-        Frame f{};
-        f.image =
-            CreateWrappedImage(memory_allocator, VkExtent2D{layout.width, layout.height}, format);
-        f.image_view = CreateWrappedImageView(device, f.image, format);
-        f.framebuffer = blit_capture.CreateFramebuffer(layout, *f.image_view, format);
-        return f;
-    }();
-
-    auto dst_buffer = CreateWrappedBuffer(memory_allocator, buffer_size, MemoryUsage::Download);
-    blit_capture.DrawToFrame(rasterizer, &frame, framebuffers, layout, 1, format);
+RendererVulkan::ScreenshotReadback RendererVulkan::RecordReadback(
+    std::span<const Tegra::FramebufferConfig> framebuffers, const Layout::FramebufferLayout& layout,
+    VkFormat format, VkDeviceSize buffer_size) {
+    ScreenshotReadback readback{};
+    readback.frame.image =
+        CreateWrappedImage(memory_allocator, VkExtent2D{layout.width, layout.height}, format);
+    readback.frame.image_view = CreateWrappedImageView(device, readback.frame.image, format);
+    readback.frame.framebuffer =
+        blit_capture.CreateFramebuffer(layout, *readback.frame.image_view, format);
+    readback.buffer = CreateWrappedBuffer(memory_allocator, buffer_size, MemoryUsage::Download);
+
+    blit_capture.DrawToFrame(rasterizer, &readback.frame, framebuffers, layout, 1, format);
 
     scheduler.RequestOutsideRenderPassOperationContext();
-    scheduler.Record([&](vk::CommandBuffer cmdbuf) {
-        DownloadColorImage(cmdbuf, *frame.image, *dst_buffer,
-                           VkExtent3D{layout.width, layout.height, 1});
+    scheduler.Record([image = *readback.frame.image, buffer = *readback.buffer,
+                      extent = VkExtent3D{layout.width, layout.height, 1}](
+                         vk::CommandBuffer cmdbuf) {
+        DownloadColorImage(cmdbuf, image, buffer, extent);
     });
-
-    // Ensure the copy is fully completed before saving the capture
-    scheduler.Finish();
-
-    // Copy backing image data to the capture buffer
-    dst_buffer.Invalidate();
-    return dst_buffer;
+    readback.tick = scheduler.CurrentTick();
+    return readback;
 }
 
 void RendererVulkan::RenderScreenshot(std::span<const Tegra::FramebufferConfig> framebuffers) {
     if (!renderer_settings.screenshot_requested) {
         return;
     }
+    if (!screenshot_readback) {
+        // The copy is read back on a later frame instead of stalling this one for the GPU
+        const auto& layout{renderer_settings.screenshot_framebuffer_layout};
+        screenshot_readback = RecordReadback(framebuffers, layout, VK_FORMAT_B8G8R8A8_UNORM,
+                                             layout.width * layout.height * 4);
+        return;
+    }
 
-    const auto& layout{renderer_settings.screenshot_framebuffer_layout};
-    const auto dst_buffer = RenderToBuffer(framebuffers, layout, VK_FORMAT_B8G8R8A8_UNORM,
-                                           layout.width * layout.height * 4);
+    scheduler.GetMasterSemaphore().Refresh();
+    if (!scheduler.IsFree(screenshot_readback->tick)) {
+        if (++screenshot_readback->frames_waited < MAX_SCREENSHOT_FRAMES_WAITED) {
+            return;
+        }
+        scheduler.Wait(screenshot_readback->tick);
+    }
 
+    // Copy backing image data to the capture buffer, the callback encodes it on its own thread
+    const auto& dst_buffer = screenshot_readback->buffer;
+    dst_buffer.Invalidate();
     std::memcpy(renderer_settings.screenshot_bits, dst_buffer.Mapped().data(),
                 dst_buffer.Mapped().size());
+    screenshot_readback.reset();
     renderer_settings.screenshot_complete_callback(false);
     renderer_settings.screenshot_requested = false;
 }
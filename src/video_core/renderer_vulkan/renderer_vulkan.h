@@ -7,6 +7,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -56,19 +57,35 @@ public:
         return device.GetDriverName();
     }
 
+    [[nodiscard]] std::optional<u64> GetDeviceMemoryUsage() const override {
+        if (!device.CanReportMemoryUsage()) {
+            return std::nullopt;
+        }
+        return device.GetDeviceMemoryUsage();
+    }
+
     // Enhanced platform-specific initialization
     void InitializePlatformSpecific();
 
 private:
-    void InterpolateFrames(Frame* prev_frame, Frame* curr_frame);
-    Frame* previous_frame = nullptr;  // Store the previous frame for interpolation
     VkCommandBuffer BeginSingleTimeCommands();
     void EndSingleTimeCommands(VkCommandBuffer command_buffer);
     void Report() const;
 
-    vk::Buffer RenderToBuffer(std::span<const Tegra::FramebufferConfig> framebuffers,
-                              const Layout::FramebufferLayout& layout, VkFormat format,
-                              VkDeviceSize buffer_size);
+    /// Frames a screenshot readback may take before the renderer waits for it
+    static constexpr u32 MAX_SCREENSHOT_FRAMES_WAITED = 4;
+
+    /// Capture of a frame being copied to a host visible buffer by the GPU
+    struct ScreenshotReadback {
+        Frame frame;
+        vk::Buffer buffer;
+        u64 tick = 0;          ///< Tick the copy is done at
+        u32 frames_waited = 0; ///< Frames presented since the copy was recorded
+    };
+
+    ScreenshotReadback RecordReadback(std::span<const Tegra::FramebufferConfig> framebuffers,
+                                      const Layout::FramebufferLayout& layout, VkFormat format,
+                                      VkDeviceSize buffer_size);
     void RenderScreenshot(std::span<const Tegra::FramebufferConfig> framebuffers);
     void RenderAppletCaptureLayer(std::span<const Tegra::FramebufferConfig> framebuffers);
 
@@ -98,6 +115,7 @@ private:
     std::optional<TurboMode> turbo_mode;
 
     Frame applet_frame;
+    std::optional<ScreenshotReadback> screenshot_readback;
 };
 
 } // namespace Vulkan
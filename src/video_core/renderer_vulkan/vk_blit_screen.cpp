@@ -8,9 +8,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <vulkan/vulkan_core.h>
+#include "common/settings.h"
 #include "video_core/framebuffer_config.h"
 #include "video_core/present.h"
 #include "video_core/renderer_vulkan/present/filters.h"
+#include "video_core/renderer_vulkan/present/frame_generation.h"
 #include "video_core/renderer_vulkan/present/layer.h"
 #include "video_core/renderer_vulkan/vk_blit_screen.h"
 #include "video_core/renderer_vulkan/vk_present_manager.h"
@@ -36,6 +38,7 @@ void BlitScreen::WaitIdle() {
 void BlitScreen::SetWindowAdaptPass() {
     layers.clear();
     scaling_filter = filters.get_scaling_filter();
+    fsr_sharpening = Settings::values.fsr_sharpening_slider.GetValue();
 
     switch (scaling_filter) {
     case Settings::ScalingFilter::NearestNeighbor:
@@ -72,6 +75,9 @@ void BlitScreen::SetWindowAdaptPass() {
         window_adapt = MakeMmpx(device, swapchain_view_format);
         break;
     case Settings::ScalingFilter::Fsr:
+        window_adapt = MakeFsr(device, swapchain_view_format,
+                               static_cast<f32>(fsr_sharpening) / 100.0f);
+        break;
     case Settings::ScalingFilter::Bilinear:
     default:
         window_adapt = MakeBilinear(device, swapchain_view_format);
@@ -79,6 +85,12 @@ void BlitScreen::SetWindowAdaptPass() {
     }
 }
 
+bool BlitScreen::IsSharpeningOutdated() const {
+    // FSR sharpens in the present pass, its pipelines are specialized with the sharpening
+    return scaling_filter == Settings::ScalingFilter::Fsr &&
+           fsr_sharpening != Settings::values.fsr_sharpening_slider.GetValue();
+}
+
 void BlitScreen::DrawToFrame(RasterizerVulkan& rasterizer, Frame* frame,
                              std::span<const Tegra::FramebufferConfig> framebuffers,
                              const Layout::FramebufferLayout& layout,
@@ -88,7 +100,8 @@ void BlitScreen::DrawToFrame(RasterizerVulkan& rasterizer, Frame* frame,
     bool presentation_recreate_required = false;
 
     // Recreate dynamic resources if the adapting filter changed
-    if (!window_adapt || scaling_filter != filters.get_scaling_filter()) {
+    if (!window_adapt || scaling_filter != filters.get_scaling_filter() ||
+        IsSharpeningOutdated()) {
         resource_update_required = true;
     }
 
@@ -143,12 +156,43 @@ void BlitScreen::DrawToFrame(RasterizerVulkan& rasterizer, Frame* frame,
     }
 }
 
+Frame* BlitScreen::GenerateFrame(Frame* frame) {
+    // Start over when the window size changed, the stored frame can't be used anymore
+    if (!frame_generation || frame_generation_extent.width != frame->width ||
+        frame_generation_extent.height != frame->height) {
+        WaitIdle();
+        frame_generation_extent = VkExtent2D{
+            .width = frame->width,
+            .height = frame->height,
+        };
+        frame_generation =
+            std::make_unique<FrameGeneration>(device, memory_allocator, frame_generation_extent);
+    }
+
+    // Frames still waiting to be presented mean the game keeps up with the display, there's no gap
+    // to fill then
+    if (!frame_generation->HasPreviousFrame() || present_manager.HasPendingPresents()) {
+        frame_generation->PushFrame(scheduler, *frame->image);
+        return nullptr;
+    }
+
+    Frame* const output = present_manager.GetRenderFrame();
+    if (output->width != frame->width || output->height != frame->height) {
+        present_manager.RecreateFrame(output, frame->width, frame->height, swapchain_view_format,
+                                      window_adapt->GetRenderPass());
+    }
+    output->generated = true;
+    frame_generation->Draw(scheduler, *frame->image, *output->image);
+    return output;
+}
+
 vk::Framebuffer BlitScreen::CreateFramebuffer(const Layout::FramebufferLayout& layout,
                                               VkImageView image_view,
                                               VkFormat current_view_format) {
     const bool format_updated =
         std::exchange(swapchain_view_format, current_view_format) != current_view_format;
-    if (!window_adapt || scaling_filter != filters.get_scaling_filter() || format_updated) {
+    if (!window_adapt || scaling_filter != filters.get_scaling_filter() || format_updated ||
+        IsSharpeningOutdated()) {
         WaitIdle();
         SetWindowAdaptPass();
     }
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -31,6 +34,7 @@ namespace Vulkan {
 class Device;
 class RasterizerVulkan;
 class Scheduler;
+class FrameGeneration;
 class PresentManager;
 class WindowAdaptPass;
 
@@ -57,6 +61,10 @@ public:
                      const Layout::FramebufferLayout& layout, size_t current_swapchain_image_count,
                      VkFormat current_swapchain_view_format);
 
+    /// Stores the drawn frame for interpolation, and returns a frame generated between it and the
+    /// previous one when the display is waiting on the game, or nullptr.
+    [[nodiscard]] Frame* GenerateFrame(Frame* frame);
+
     [[nodiscard]] vk::Framebuffer CreateFramebuffer(const Layout::FramebufferLayout& layout,
                                                     VkImageView image_view,
                                                     VkFormat current_view_format);
@@ -64,6 +72,10 @@ public:
 private:
     void WaitIdle();
     void SetWindowAdaptPass();
+
+    /// Returns true when the present pass was made with another FSR sharpening than the current.
+    [[nodiscard]] bool IsSharpeningOutdated() const;
+
     vk::Framebuffer CreateFramebuffer(const VkImageView& image_view, VkExtent2D extent,
                                       VkRenderPass render_pass);
 
@@ -78,7 +90,10 @@ private:
     VkFormat swapchain_view_format{};
 
     Settings::ScalingFilter scaling_filter{};
+    int fsr_sharpening{}; ///< Sharpening the FSR present pass was made with
     std::unique_ptr<WindowAdaptPass> window_adapt{};
+    std::unique_ptr<FrameGeneration> frame_generation{};
+    VkExtent2D frame_generation_extent{};
     std::list<Layer> layers{};
 };
 
@@ -10,6 +10,7 @@
 #include <span>
 #include <vector>
 
+#include "common/literals.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
 
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
@@ -23,6 +24,14 @@
 
 namespace Vulkan {
 namespace {
+using namespace Common::Literals;
+
+/// Memory index conversions may keep, past it new conversions stay in staging memory
+constexpr u64 MAX_INDEX_CONVERSION_BYTES = 64_MiB;
+
+/// Frames an unused index conversion is kept around
+constexpr u64 INDEX_CONVERSION_FRAMES_TO_KEEP = 8;
+
 VkBufferCopy MakeBufferCopy(const VideoCommon::BufferCopy& copy) {
     return VkBufferCopy{
         .srcOffset = copy.src_offset,
@@ -55,7 +64,8 @@ size_t BytesPerIndex(VkIndexType index_type) {
     }
 }
 
-vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allocator, u64 size) {
+vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allocator, u64 size,
+                        MemoryUsage usage = MemoryUsage::DeviceLocal) {
     VkBufferUsageFlags flags =
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
         VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT |
@@ -78,7 +88,7 @@ vk::Buffer CreateBuffer(const Device& device, const MemoryAllocator& memory_allo
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
     };
-    return memory_allocator.CreateBuffer(buffer_ci, MemoryUsage::DeviceLocal);
+    return memory_allocator.CreateBuffer(buffer_ci, usage);
 }
 } // Anonymous namespace
 
@@ -92,14 +102,24 @@ Buffer::Buffer(BufferCacheRuntime& runtime, VideoCommon::NullBufferParams null_p
     is_null = true;
 }
 
-Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_)
+Buffer::Buffer(BufferCacheRuntime& runtime, DAddr cpu_addr_, u64 size_bytes_, bool is_stream)
     : VideoCommon::BufferBase(cpu_addr_, size_bytes_), device{&runtime.device},
-      buffer{CreateBuffer(*device, runtime.memory_allocator, SizeBytes())}, tracker{SizeBytes()} {
+      scheduler{&runtime.scheduler}, tracker{SizeBytes()} {
+    // Device local memory is host visible on unified memory devices, streamed buffers placed
+    // there are written by the CPU without staging copies.
+    const bool use_stream_memory = is_stream && device->IsIntegrated();
+    buffer = CreateBuffer(*device, runtime.memory_allocator, SizeBytes(),
+                          use_stream_memory ? MemoryUsage::Stream : MemoryUsage::DeviceLocal);
+    is_direct_uploadable = use_stream_memory && buffer.IsHostVisible();
     if (runtime.device.HasDebuggingToolAttached()) {
         buffer.SetObjectNameEXT(fmt::format("Buffer 0x{:x}", CpuAddr()).c_str());
     }
 }
 
+void Buffer::MarkGpuAccess() noexcept {
+    last_gpu_access_tick = scheduler->CurrentTick();
+}
+
 VkBufferView Buffer::View(u32 offset, u32 size, VideoCore::Surface::PixelFormat format) {
     if (!device) {
         // Null buffer supported, return a null descriptor
@@ -332,17 +352,13 @@ BufferCacheRuntime::BufferCacheRuntime(const Device& device_, MemoryAllocator& m
     : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
       staging_pool{staging_pool_}, guest_descriptor_queue{guest_descriptor_queue_},
       quad_index_pass(device, scheduler, descriptor_pool, staging_pool,
-                      compute_pass_descriptor_queue) {
+                      compute_pass_descriptor_queue),
+      block_linear_copy_pass(device, scheduler, descriptor_pool, compute_pass_descriptor_queue) {
     if (device.GetDriverID() != VK_DRIVER_ID_QUALCOMM_PROPRIETARY) {
         // TODO: FixMe: Uint8Pass compute shader does not build on some Qualcomm drivers.
         uint8_pass = std::make_unique<Uint8Pass>(device, scheduler, descriptor_pool, staging_pool,
                                                  compute_pass_descriptor_queue);
     }
-    const u32 ubo_align = static_cast<u32>(
-            device.GetUniformBufferAlignment() //check if the device has it
-    );
-    // add the ability to change the size in settings in future
-    uniform_ring.Init(memory_allocator, 8 * 1024 * 1024 /* 8 MiB */, ubo_align ? ubo_align : 256);
     quad_array_index_buffer = std::make_shared<QuadArrayIndexBuffer>(device_, memory_allocator_,
                                                                      scheduler_, staging_pool_);
     quad_strip_index_buffer = std::make_shared<QuadStripIndexBuffer>(device_, memory_allocator_,
@@ -361,41 +377,6 @@ void BufferCacheRuntime::FreeDeferredStagingBuffer(StagingBufferRef& ref) {
     staging_pool.FreeDeferred(ref);
 }
 
-void BufferCacheRuntime::UniformRing::Init(MemoryAllocator& alloc, u64 bytes, u32 alignment)
-{
-    for (size_t i = 0; i < NUM_FRAMES; ++i) {
-        VkBufferCreateInfo ci{
-            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
-            .pNext = nullptr,
-            .flags = 0,
-            .size  = bytes,
-            .usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
-            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-            .queueFamilyIndexCount = 0,
-            .pQueueFamilyIndices = nullptr,
-        };
-        buffers[i] = alloc.CreateBuffer(ci, MemoryUsage::Upload);
-        mapped[i] = buffers[i].Mapped().data();
-    }
-    size   = bytes;
-    align  = alignment ? alignment : 256;
-    head   = 0;
-    current_frame = 0;
-}
-
-std::span<u8> BufferCacheRuntime::UniformRing::Alloc(u32 bytes, u32& out_offset) {
-    const u64 aligned = Common::AlignUp(head, static_cast<u64>(align));
-    u64 end = aligned + bytes;
-
-    if (end > size) {
-       return {}; // Fallback to staging pool
-    }
-
-    out_offset = static_cast<u32>(aligned);
-    head = end;
-    return {mapped[current_frame] + out_offset, bytes};
-}
-
 u64 BufferCacheRuntime::GetDeviceLocalMemory() const {
     return device.GetDeviceLocalMemory();
 }
@@ -404,6 +385,10 @@ u64 BufferCacheRuntime::GetDeviceMemoryUsage() const {
     return device.GetDeviceMemoryUsage();
 }
 
+u64 BufferCacheRuntime::GetDeviceMemoryBudget() const {
+    return device.GetDeviceMemoryBudget();
+}
+
 bool BufferCacheRuntime::CanReportMemoryUsage() const {
     return device.CanReportMemoryUsage();
 }
@@ -416,7 +401,16 @@ void BufferCacheRuntime::TickFrame(Common::SlotVector<Buffer>& slot_buffers) noe
     for (auto it = slot_buffers.begin(); it != slot_buffers.end(); it++) {
         it->ResetUsageTracking();
     }
-    uniform_ring.BeginFrame();
+    ++frame_index;
+    std::erase_if(index_conversions, [this](const auto& pair) {
+        const IndexConversion& conversion = pair.second;
+        if (conversion.frame + INDEX_CONVERSION_FRAMES_TO_KEEP >= frame_index ||
+            !scheduler.IsFree(conversion.tick)) {
+            return false;
+        }
+        index_conversion_bytes -= conversion.size_bytes;
+        return true;
+    });
 }
 
 void BufferCacheRuntime::Finish() {
@@ -435,6 +429,10 @@ bool BufferCacheRuntime::CanReorderUpload(const Buffer& buffer,
     return can_use_upload_cmdbuf;
 }
 
+bool BufferCacheRuntime::CanUploadDirectly(const Buffer& buffer) const {
+    return buffer.IsDirectUploadable() && scheduler.IsFree(buffer.LastGpuAccessTick());
+}
+
 void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
                                     std::span<const VideoCommon::BufferCopy> copies, bool barrier,
                                     bool can_reorder_upload) {
@@ -458,9 +456,8 @@ void BufferCacheRuntime::CopyBuffer(VkBuffer dst_buffer, VkBuffer src_buffer,
     boost::container::small_vector<VkBufferCopy, 8> vk_copies(copies.size());
     std::ranges::transform(copies, vk_copies.begin(), MakeBufferCopy);
     if (src_buffer == staging_pool.StreamBuf() && can_reorder_upload) {
-        scheduler.RecordWithUploadBuffer([src_buffer, dst_buffer, vk_copies](
-                                             vk::CommandBuffer, vk::CommandBuffer upload_cmdbuf) {
-            upload_cmdbuf.CopyBuffer(src_buffer, dst_buffer, VideoCommon::FixSmallVectorADL(vk_copies));
+        scheduler.RecordUpload([src_buffer, dst_buffer, vk_copies](vk::CommandBuffer cmdbuf) {
+            cmdbuf.CopyBuffer(src_buffer, dst_buffer, VideoCommon::FixSmallVectorADL(vk_copies));
         });
         return;
     }
@@ -534,21 +531,53 @@ void BufferCacheRuntime::ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t si
     });
 }
 
+void BufferCacheRuntime::SwizzleBuffer(VkBuffer dest_buffer, u32 dest_offset, VkBuffer src_buffer,
+                                       u32 src_offset, const Tegra::DMA::SwizzleCopy& copy) {
+    block_linear_copy_pass.Copy(dest_buffer, dest_offset, src_buffer, src_offset, copy);
+}
+
 void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format,
                                          u32 base_vertex, u32 num_indices, VkBuffer buffer,
-                                         u32 offset, [[maybe_unused]] u32 size) {
+                                         u32 offset, [[maybe_unused]] u32 size,
+                                         u64 write_generation) {
     VkIndexType vk_index_type = MaxwellToVK::IndexFormat(index_format);
     VkDeviceSize vk_offset = offset;
     VkBuffer vk_buffer = buffer;
+    const IndexConversionKey key{
+        .buffer = buffer,
+        .write_generation = write_generation,
+        .offset = offset,
+        .num_indices = num_indices,
+        .base_vertex = base_vertex,
+        .index_format = index_format,
+        .topology = topology,
+    };
+    bool is_converted = false;
     if (topology == PrimitiveTopology::Quads || topology == PrimitiveTopology::QuadStrip) {
         vk_index_type = VK_INDEX_TYPE_UINT32;
-        std::tie(vk_buffer, vk_offset) =
-            quad_index_pass.Assemble(index_format, num_indices, base_vertex, buffer, offset,
-                                     topology == PrimitiveTopology::QuadStrip);
+        const bool is_strip = topology == PrimitiveTopology::QuadStrip;
+        const u64 size_bytes =
+            u64{QuadIndexedPass::NumTriangleVertices(num_indices, is_strip)} * sizeof(u32);
+        const VkBuffer cached = FindIndexConversion(key, size_bytes, is_converted);
+        if (is_converted) {
+            vk_buffer = cached;
+            vk_offset = 0;
+        } else {
+            std::tie(vk_buffer, vk_offset) = quad_index_pass.Assemble(
+                index_format, num_indices, base_vertex, buffer, offset, is_strip, cached);
+        }
     } else if (vk_index_type == VK_INDEX_TYPE_UINT8_EXT && !device.IsExtIndexTypeUint8Supported()) {
         vk_index_type = VK_INDEX_TYPE_UINT16;
         if (uint8_pass) {
-            std::tie(vk_buffer, vk_offset) = uint8_pass->Assemble(num_indices, buffer, offset);
+            const u64 size_bytes = u64{num_indices} * sizeof(u16);
+            const VkBuffer cached = FindIndexConversion(key, size_bytes, is_converted);
+            if (is_converted) {
+                vk_buffer = cached;
+                vk_offset = 0;
+            } else {
+                std::tie(vk_buffer, vk_offset) =
+                    uint8_pass->Assemble(num_indices, buffer, offset, cached);
+            }
         }
     }
     if (vk_buffer == VK_NULL_HANDLE) {
@@ -561,6 +590,33 @@ void BufferCacheRuntime::BindIndexBuffer(PrimitiveTopology topology, IndexFormat
     });
 }
 
+VkBuffer BufferCacheRuntime::FindIndexConversion(const IndexConversionKey& key, u64 size_bytes,
+                                                 bool& is_converted) {
+    is_converted = false;
+    if (key.write_generation == 0 || key.buffer == VK_NULL_HANDLE || size_bytes == 0) {
+        return VK_NULL_HANDLE;
+    }
+    const auto [it, is_new] = index_conversions.try_emplace(key);
+    IndexConversion& conversion = it->second;
+    conversion.frame = frame_index;
+    if (is_new) {
+        // Index buffers streamed every frame are never seen twice, keep them in staging memory
+        return VK_NULL_HANDLE;
+    }
+    if (!conversion.buffer) {
+        if (index_conversion_bytes + size_bytes > MAX_INDEX_CONVERSION_BYTES) {
+            return VK_NULL_HANDLE;
+        }
+        conversion.buffer = CreateBuffer(device, memory_allocator, size_bytes);
+        conversion.size_bytes = size_bytes;
+        index_conversion_bytes += size_bytes;
+    } else {
+        is_converted = true;
+    }
+    conversion.tick = scheduler.CurrentTick();
+    return *conversion.buffer;
+}
+
 void BufferCacheRuntime::BindQuadIndexBuffer(PrimitiveTopology topology, u32 first, u32 count) {
     if (count == 0) {
         ReserveNullBuffer();
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "video_core/buffer_cache/buffer_cache_base.h"
 #include "video_core/buffer_cache/memory_tracker_base.h"
 #include "video_core/buffer_cache/usage_tracker.h"
@@ -29,7 +31,8 @@ class BufferCacheRuntime;
 class Buffer : public VideoCommon::BufferBase {
 public:
     explicit Buffer(BufferCacheRuntime&, VideoCommon::NullBufferParams null_params);
-    explicit Buffer(BufferCacheRuntime& runtime, VAddr cpu_addr_, u64 size_bytes_);
+    explicit Buffer(BufferCacheRuntime& runtime, VAddr cpu_addr_, u64 size_bytes_,
+                    bool is_stream = false);
 
     [[nodiscard]] VkBufferView View(u32 offset, u32 size, VideoCore::Surface::PixelFormat format);
 
@@ -43,6 +46,30 @@ public:
 
     void MarkUsage(u64 offset, u64 size) noexcept {
         tracker.Track(offset, size);
+        if (is_direct_uploadable) {
+            MarkGpuAccess();
+        }
+    }
+
+    /// Notes that commands recorded in the current command buffer access the buffer.
+    void MarkGpuAccess() noexcept;
+
+    /// Returns true when the CPU can write the buffer through its mapping.
+    [[nodiscard]] bool IsDirectUploadable() const noexcept {
+        return is_direct_uploadable;
+    }
+
+    /// Returns the tick of the last commands accessing the buffer.
+    [[nodiscard]] u64 LastGpuAccessTick() const noexcept {
+        return last_gpu_access_tick;
+    }
+
+    [[nodiscard]] std::span<u8> Mapped() noexcept {
+        return buffer.Mapped();
+    }
+
+    void FlushMappedWrites() const {
+        buffer.Flush();
     }
 
     void ResetUsageTracking() noexcept {
@@ -62,9 +89,12 @@ private:
     };
 
     const Device* device{};
+    const Scheduler* scheduler{};
     vk::Buffer buffer;
     std::vector<BufferView> views;
     VideoCommon::UsageTracker tracker;
+    u64 last_gpu_access_tick{};
+    bool is_direct_uploadable{}; ///< Host visible stream buffer on a unified memory device
     bool is_null{};
 };
 
@@ -92,6 +122,8 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    u64 GetDeviceMemoryBudget() const;
+
     bool CanReportMemoryUsage() const;
 
     u32 GetStorageBufferAlignment() const;
@@ -102,6 +134,9 @@ public:
 
     bool CanReorderUpload(const Buffer& buffer, std::span<const VideoCommon::BufferCopy> copies);
 
+    /// Returns true when the GPU has finished with a buffer the CPU can write directly.
+    bool CanUploadDirectly(const Buffer& buffer) const;
+
     void FreeDeferredStagingBuffer(StagingBufferRef& ref);
 
     void PreCopyBarrier();
@@ -114,8 +149,14 @@ public:
 
     void ClearBuffer(VkBuffer dest_buffer, u32 offset, size_t size, u32 value);
 
+    void SwizzleBuffer(VkBuffer dest_buffer, u32 dest_offset, VkBuffer src_buffer, u32 src_offset,
+                       const Tegra::DMA::SwizzleCopy& copy);
+
+    /// Binds an index buffer, converting it to indices the host can draw when needed. A nonzero
+    /// write generation of the buffer lets unchanged conversions be reused.
     void BindIndexBuffer(PrimitiveTopology topology, IndexFormat index_format, u32 num_indices,
-                         u32 base_vertex, VkBuffer buffer, u32 offset, u32 size);
+                         u32 base_vertex, VkBuffer buffer, u32 offset, u32 size,
+                         u64 write_generation = 0);
 
     void BindQuadIndexBuffer(PrimitiveTopology topology, u32 first, u32 count);
 
@@ -130,13 +171,7 @@ public:
     std::span<u8> BindMappedUniformBuffer([[maybe_unused]] size_t /*stage*/,
                                           [[maybe_unused]] u32 /*binding_index*/,
                                           u32 size) {
-        u32 offset = 0;
-        if (auto span = uniform_ring.Alloc(size, offset); !span.empty()) {
-            BindBuffer(*uniform_ring.buffers[uniform_ring.current_frame], offset, size);
-            return span;
-        }
-        // Fallback for giant requests
-        const StagingBufferRef ref = staging_pool.Request(size, MemoryUsage::Upload);
+        const StagingBufferRef ref = staging_pool.RequestUniform(size);
         BindBuffer(ref.buffer, static_cast<u32>(ref.offset), size);
         return ref.mapped_span;
     }
@@ -156,6 +191,42 @@ public:
     }
 
 private:
+    struct IndexConversionKey {
+        bool operator==(const IndexConversionKey&) const noexcept = default;
+
+        VkBuffer buffer;
+        u64 write_generation;
+        u32 offset;
+        u32 num_indices;
+        u32 base_vertex;
+        IndexFormat index_format;
+        PrimitiveTopology topology;
+    };
+
+    struct IndexConversionKeyHash {
+        size_t operator()(const IndexConversionKey& key) const noexcept {
+            return static_cast<size_t>(key.write_generation) ^
+                   (static_cast<size_t>(key.offset) << 20) ^
+                   (static_cast<size_t>(key.num_indices) << 40) ^
+                   (static_cast<size_t>(key.base_vertex) << 8) ^
+                   (static_cast<size_t>(key.index_format) << 60) ^
+                   (static_cast<size_t>(key.topology) << 54);
+        }
+    };
+
+    /// Converted indices of a guest index buffer, the buffer is only made once it's seen again
+    struct IndexConversion {
+        vk::Buffer buffer;
+        u64 size_bytes = 0;
+        u64 tick = 0;  ///< Last submission that used the buffer
+        u64 frame = 0; ///< Last frame it was used in
+    };
+
+    /// Returns the buffer holding the conversion of key, null when it has to be converted into
+    /// staging memory. Sets is_converted when the buffer already holds it.
+    VkBuffer FindIndexConversion(const IndexConversionKey& key, u64 size_bytes,
+                                 bool& is_converted);
+
     void BindBuffer(VkBuffer buffer, u32 offset, u32 size) {
         guest_descriptor_queue.AddBuffer(buffer, offset, size);
     }
@@ -163,24 +234,6 @@ private:
     void ReserveNullBuffer();
     vk::Buffer CreateNullBuffer();
 
-    struct UniformRing {
-        static constexpr size_t NUM_FRAMES = 3;
-        std::array<vk::Buffer, NUM_FRAMES> buffers{};
-        std::array<u8*, NUM_FRAMES> mapped{};
-        u64 size = 0;
-        u64 head = 0;
-        u32 align = 256;
-        size_t current_frame = 0;
-
-        void Init(MemoryAllocator& alloc, u64 bytes, u32 alignment);
-        void BeginFrame() {
-            current_frame = (current_frame + 1) % NUM_FRAMES;
-            head = 0;
-        }
-        std::span<u8> Alloc(u32 bytes, u32& out_offset);
-    };
-    UniformRing uniform_ring;
-
     const Device& device;
     MemoryAllocator& memory_allocator;
     Scheduler& scheduler;
@@ -192,8 +245,14 @@ private:
 
     vk::Buffer null_buffer;
 
+    std::unordered_map<IndexConversionKey, IndexConversion, IndexConversionKeyHash>
+        index_conversions;
+    u64 index_conversion_bytes = 0;
+    u64 frame_index = 0;
+
     std::unique_ptr<Uint8Pass> uint8_pass;
     QuadIndexedPass quad_index_pass;
+    BlockLinearCopyPass block_linear_copy_pass;
 };
 
 struct BufferCacheParams {
@@ -210,6 +269,7 @@ struct BufferCacheParams {
     static constexpr bool USE_MEMORY_MAPS = true;
     static constexpr bool SEPARATE_IMAGE_BUFFER_BINDINGS = false;
     static constexpr bool USE_MEMORY_MAPS_FOR_UPLOADS = true;
+    static constexpr bool USE_DIRECT_STREAM_UPLOADS = true;
 };
 
 using BufferCache = VideoCommon::BufferCache<BufferCacheParams>;
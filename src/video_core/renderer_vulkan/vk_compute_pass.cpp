@@ -9,9 +9,11 @@
 #include <numeric>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
 
+#include "common/alignment.h"
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/div_ceil.h"
@@ -19,11 +21,15 @@
 #include "video_core/host_shaders/astc_decoder_comp_spv.h"
 #include "video_core/host_shaders/convert_msaa_to_non_msaa_comp_spv.h"
 #include "video_core/host_shaders/convert_non_msaa_to_msaa_comp_spv.h"
+#include "video_core/host_shaders/convert_rgba8_to_bcn_comp_spv.h"
+#include "video_core/host_shaders/decode_bcn_comp_spv.h"
 #include "video_core/host_shaders/queries_prefix_scan_sum_comp_spv.h"
 #include "video_core/host_shaders/queries_prefix_scan_sum_nosubgroups_comp_spv.h"
 #include "video_core/host_shaders/resolve_conditional_render_comp_spv.h"
+#include "video_core/host_shaders/vulkan_block_linear_copy_comp_spv.h"
 #include "video_core/host_shaders/vulkan_quad_indexed_comp_spv.h"
 #include "video_core/host_shaders/vulkan_uint8_comp_spv.h"
+#include "video_core/engines/maxwell_dma.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
@@ -31,6 +37,7 @@
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/texture_cache/accelerated_swizzle.h"
 #include "video_core/texture_cache/types.h"
+#include "video_core/texture_cache/util.h"
 #include "video_core/textures/decoders.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -212,6 +219,57 @@ constexpr std::array<VkDescriptorUpdateTemplateEntry, ASTC_NUM_BINDINGS>
         },
     }};
 
+constexpr u32 BCN_BINDING_INPUT_IMAGE = 0;
+constexpr u32 BCN_BINDING_OUTPUT_BUFFER = 1;
+constexpr size_t BCN_NUM_BINDINGS = 2;
+
+constexpr std::array<VkDescriptorSetLayoutBinding, BCN_NUM_BINDINGS> BCN_DESCRIPTOR_SET_BINDINGS{{
+    {
+        .binding = BCN_BINDING_INPUT_IMAGE,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .pImmutableSamplers = nullptr,
+    },
+    {
+        .binding = BCN_BINDING_OUTPUT_BUFFER,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .pImmutableSamplers = nullptr,
+    },
+}};
+
+constexpr DescriptorBankInfo BCN_BANK_INFO{
+    .uniform_buffers = 0,
+    .storage_buffers = 1,
+    .texture_buffers = 0,
+    .image_buffers = 0,
+    .textures = 0,
+    .images = 1,
+    .score = 2,
+};
+
+constexpr std::array<VkDescriptorUpdateTemplateEntry, BCN_NUM_BINDINGS>
+    BCN_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY{{
+        {
+            .dstBinding = BCN_BINDING_INPUT_IMAGE,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            .offset = BCN_BINDING_INPUT_IMAGE * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+        {
+            .dstBinding = BCN_BINDING_OUTPUT_BUFFER,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .offset = BCN_BINDING_OUTPUT_BUFFER * sizeof(DescriptorUpdateEntry),
+            .stride = sizeof(DescriptorUpdateEntry),
+        },
+    }};
+
 struct AstcPushConstants {
     std::array<u32, 2> blocks_dims;
     u32 layer_stride;
@@ -221,12 +279,74 @@ struct AstcPushConstants {
     u32 block_height_mask;
 };
 
+struct BCnDecodePushConstants {
+    u32 format;
+    u32 bytes_per_block_log2;
+    u32 layer_stride;
+    u32 block_size;
+    u32 x_shift;
+    u32 block_height;
+    u32 block_height_mask;
+};
+
+struct BCnEncodePushConstants {
+    std::array<u32, 2> num_blocks;
+    u32 encode_alpha;
+};
+
 struct QueriesPrefixScanPushConstants {
     u32 min_accumulation_base;
     u32 max_accumulation_base;
     u32 accumulation_limit;
     u32 buffer_offset;
 };
+
+struct BlockLinearCopyOperand {
+    u32 offset;
+    u32 is_block_linear;
+    u32 pitch;
+    u32 x_shift;
+    u32 block_height;
+    u32 origin_x;
+    u32 origin_y;
+};
+
+struct BlockLinearCopyPushConstants {
+    BlockLinearCopyOperand src;
+    BlockLinearCopyOperand dst;
+    std::array<u32, 2> extent;
+    u32 words_per_element;
+};
+static_assert(sizeof(BlockLinearCopyPushConstants) == 68);
+
+BlockLinearCopyOperand MakeBlockLinearCopyOperand(const Tegra::DMA::SwizzleOperand& operand,
+                                                  u32 bytes_per_pixel, u32 offset) {
+    using namespace Tegra::Texture;
+    if (!operand.is_block_linear) {
+        return BlockLinearCopyOperand{
+            .offset = offset,
+            .is_block_linear = 0,
+            .pitch = operand.pitch,
+            .x_shift = 0,
+            .block_height = 0,
+            .origin_x = 0,
+            .origin_y = 0,
+        };
+    }
+    // Same block layout as SwizzleSubrect
+    const u32 stride = Common::AlignUpLog2(operand.width * bytes_per_pixel, GOB_SIZE_X_SHIFT);
+    const u32 gobs_in_x = Common::DivCeilLog2(stride, GOB_SIZE_X_SHIFT);
+    const u32 x_shift = GOB_SIZE_SHIFT + operand.block_height + operand.block_depth;
+    return BlockLinearCopyOperand{
+        .offset = offset,
+        .is_block_linear = 1,
+        .pitch = gobs_in_x << x_shift,
+        .x_shift = x_shift,
+        .block_height = operand.block_height,
+        .origin_x = operand.origin_x * bytes_per_pixel,
+        .origin_y = operand.origin_y,
+    };
+}
 } // Anonymous namespace
 
 ComputePass::ComputePass(const Device& device_, DescriptorPool& descriptor_pool,
@@ -317,16 +437,22 @@ Uint8Pass::Uint8Pass(const Device& device_, Scheduler& scheduler_, DescriptorPoo
 Uint8Pass::~Uint8Pass() = default;
 
 std::pair<VkBuffer, VkDeviceSize> Uint8Pass::Assemble(u32 num_vertices, VkBuffer src_buffer,
-                                                      u32 src_offset) {
+                                                      u32 src_offset, VkBuffer dst_buffer) {
     const u32 staging_size = static_cast<u32>(num_vertices * sizeof(u16));
-    const auto staging = staging_buffer_pool.Request(staging_size, MemoryUsage::DeviceLocal);
+    VkDeviceSize dst_offset = 0;
+    if (!dst_buffer) {
+        const auto staging = staging_buffer_pool.Request(staging_size, MemoryUsage::DeviceLocal);
+        dst_buffer = staging.buffer;
+        dst_offset = staging.offset;
+    }
 
     compute_pass_descriptor_queue.Acquire();
     compute_pass_descriptor_queue.AddBuffer(src_buffer, src_offset, num_vertices);
-    compute_pass_descriptor_queue.AddBuffer(staging.buffer, staging.offset, staging_size);
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_offset, staging_size);
     const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
     scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "Uint8Pass"};
     scheduler.Record([this, descriptor_data, num_vertices](vk::CommandBuffer cmdbuf) {
         static constexpr u32 DISPATCH_SIZE = 1024;
         static constexpr VkMemoryBarrier WRITE_BARRIER{
@@ -343,7 +469,7 @@ std::pair<VkBuffer, VkDeviceSize> Uint8Pass::Assemble(u32 num_vertices, VkBuffer
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                                VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, WRITE_BARRIER);
     });
-    return {staging.buffer, staging.offset};
+    return {dst_buffer, dst_offset};
 }
 
 QuadIndexedPass::QuadIndexedPass(const Device& device_, Scheduler& scheduler_,
@@ -360,7 +486,7 @@ QuadIndexedPass::~QuadIndexedPass() = default;
 
 std::pair<VkBuffer, VkDeviceSize> QuadIndexedPass::Assemble(
     Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices, u32 base_vertex,
-    VkBuffer src_buffer, u32 src_offset, bool is_strip) {
+    VkBuffer src_buffer, u32 src_offset, bool is_strip, VkBuffer dst_buffer) {
     const u32 index_shift = [index_format] {
         switch (index_format) {
         case Tegra::Engines::Maxwell3D::Regs::IndexFormat::UnsignedByte:
@@ -374,17 +500,23 @@ std::pair<VkBuffer, VkDeviceSize> QuadIndexedPass::Assemble(
         return 2;
     }();
     const u32 input_size = num_vertices << index_shift;
-    const u32 num_tri_vertices = (is_strip ? (num_vertices - 2) / 2 : num_vertices / 4) * 6;
+    const u32 num_tri_vertices = NumTriangleVertices(num_vertices, is_strip);
 
     const std::size_t staging_size = num_tri_vertices * sizeof(u32);
-    const auto staging = staging_buffer_pool.Request(staging_size, MemoryUsage::DeviceLocal);
+    VkDeviceSize dst_offset = 0;
+    if (!dst_buffer) {
+        const auto staging = staging_buffer_pool.Request(staging_size, MemoryUsage::DeviceLocal);
+        dst_buffer = staging.buffer;
+        dst_offset = staging.offset;
+    }
 
     compute_pass_descriptor_queue.Acquire();
     compute_pass_descriptor_queue.AddBuffer(src_buffer, src_offset, input_size);
-    compute_pass_descriptor_queue.AddBuffer(staging.buffer, staging.offset, staging_size);
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_offset, staging_size);
     const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
     scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "QuadIndexedPass"};
     scheduler.Record([this, descriptor_data, num_tri_vertices, base_vertex, index_shift,
                       is_strip](vk::CommandBuffer cmdbuf) {
         static constexpr u32 DISPATCH_SIZE = 1024;
@@ -405,7 +537,7 @@ std::pair<VkBuffer, VkDeviceSize> QuadIndexedPass::Assemble(
         cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                                VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, WRITE_BARRIER);
     });
-    return {staging.buffer, staging.offset};
+    return {dst_buffer, dst_offset};
 }
 
 ConditionalRenderingResolvePass::ConditionalRenderingResolvePass(
@@ -426,6 +558,7 @@ void ConditionalRenderingResolvePass::Resolve(VkBuffer dst_buffer, VkBuffer src_
     const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
 
     scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "ConditionalRenderingResolvePass"};
     scheduler.Record([this, descriptor_data](vk::CommandBuffer cmdbuf) {
         static constexpr VkMemoryBarrier read_barrier{
             .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
@@ -485,6 +618,7 @@ void QueriesPrefixScanPass::Run(VkBuffer accumulation_buffer, VkBuffer dst_buffe
         offset += runs_to_do;
 
         scheduler.RequestOutsideRenderPassOperationContext();
+        const ScopedProfiledPass profiled_pass{scheduler, "QueriesPrefixScanPass"};
         scheduler.Record([this, descriptor_data, min_accumulation_limit, max_accumulation_limit,
                           runs_to_do, used_offset](vk::CommandBuffer cmdbuf) {
             static constexpr VkMemoryBarrier read_barrier{
@@ -525,6 +659,70 @@ void QueriesPrefixScanPass::Run(VkBuffer accumulation_buffer, VkBuffer dst_buffe
     }
 }
 
+BlockLinearCopyPass::BlockLinearCopyPass(
+    const Device& device_, Scheduler& scheduler_, DescriptorPool& descriptor_pool_,
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, INPUT_OUTPUT_DESCRIPTOR_SET_BINDINGS,
+                  INPUT_OUTPUT_DESCRIPTOR_UPDATE_TEMPLATE, INPUT_OUTPUT_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(BlockLinearCopyPushConstants)>,
+                  VULKAN_BLOCK_LINEAR_COPY_COMP_SPV),
+      scheduler{scheduler_}, compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+BlockLinearCopyPass::~BlockLinearCopyPass() = default;
+
+void BlockLinearCopyPass::Copy(VkBuffer dst_buffer, u32 dst_offset, VkBuffer src_buffer,
+                               u32 src_offset, const Tegra::DMA::SwizzleCopy& copy) {
+    // Bind the buffers at an aligned offset and address the data from there
+    const u32 alignment = static_cast<u32>(device.GetStorageBufferAlignment());
+    const u32 src_base = Common::AlignDown(src_offset, alignment);
+    const u32 dst_base = Common::AlignDown(dst_offset, alignment);
+
+    compute_pass_descriptor_queue.Acquire();
+    compute_pass_descriptor_queue.AddBuffer(src_buffer, src_base,
+                                            src_offset - src_base + copy.src.size);
+    compute_pass_descriptor_queue.AddBuffer(dst_buffer, dst_base,
+                                            dst_offset - dst_base + copy.dst.size);
+    const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+    const BlockLinearCopyPushConstants uniforms{
+        .src = MakeBlockLinearCopyOperand(copy.src, copy.bytes_per_pixel, src_offset - src_base),
+        .dst = MakeBlockLinearCopyOperand(copy.dst, copy.bytes_per_pixel, dst_offset - dst_base),
+        .extent{copy.extent_x, copy.extent_y},
+        .words_per_element = copy.bytes_per_pixel / static_cast<u32>(sizeof(u32)),
+    };
+    const u32 num_dispatches_x = Common::DivCeil(copy.extent_x, 32U);
+    const u32 num_dispatches_y = Common::DivCeil(copy.extent_y, 8U);
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "BlockLinearCopyPass"};
+    scheduler.Record([this, descriptor_data, uniforms, num_dispatches_x,
+                      num_dispatches_y](vk::CommandBuffer cmdbuf) {
+        static constexpr VkMemoryBarrier read_barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        };
+        static constexpr VkMemoryBarrier write_barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+        };
+        const VkDescriptorSet set = descriptor_allocator.Commit();
+        device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, read_barrier);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+        cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
+        cmdbuf.Dispatch(num_dispatches_x, num_dispatches_y, 1);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, write_barrier);
+    });
+}
+
 ASTCDecoderPass::ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
                                  DescriptorPool& descriptor_pool_,
                                  StagingBufferPool& staging_buffer_pool_,
@@ -546,7 +744,12 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
         VideoCore::Surface::DefaultBlockWidth(image.info.format),
         VideoCore::Surface::DefaultBlockHeight(image.info.format),
     };
+    if (scheduler.HasAsyncCompute() && !image.IsInitialized() && image.modification_tick == 0) {
+        AssembleAsync(image, map, swizzles, block_dims);
+        return;
+    }
     scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "ASTCDecoderPass"};
     const VkPipeline vk_pipeline = *pipeline;
     const VkImageAspectFlags aspect_mask = image.AspectMask();
     const VkImage vk_image = image.Handle();
@@ -636,6 +839,396 @@ void ASTCDecoderPass::Assemble(Image& image, const StagingBufferRef& map,
     scheduler.Finish();
 }
 
+void ASTCDecoderPass::AssembleAsync(Image& image, const StagingBufferRef& map,
+                                    std::span<const VideoCommon::SwizzleParameters> swizzles,
+                                    const std::array<u32, 2>& block_dims) {
+    using namespace VideoCommon::Accelerated;
+    struct AstcDispatch {
+        AstcPushConstants uniforms;
+        std::array<u32, 3> num_dispatches;
+        const void* descriptor_data;
+    };
+    std::vector<AstcDispatch> dispatches;
+    dispatches.reserve(swizzles.size());
+    for (const VideoCommon::SwizzleParameters& swizzle : swizzles) {
+        const size_t input_offset = swizzle.buffer_offset + map.offset;
+        compute_pass_descriptor_queue.Acquire();
+        compute_pass_descriptor_queue.AddBuffer(map.buffer, input_offset,
+                                                image.guest_size_bytes - swizzle.buffer_offset);
+        compute_pass_descriptor_queue.AddImage(image.StorageImageView(swizzle.level));
+
+        const auto params = MakeBlockLinearSwizzle2DParams(swizzle, image.info);
+        ASSERT(params.origin == (std::array<u32, 3>{0, 0, 0}));
+        ASSERT(params.destination == (std::array<s32, 3>{0, 0, 0}));
+        ASSERT(params.bytes_per_block_log2 == 4);
+        dispatches.push_back({
+            .uniforms{
+                .blocks_dims = block_dims,
+                .layer_stride = params.layer_stride,
+                .block_size = params.block_size,
+                .x_shift = params.x_shift,
+                .block_height = params.block_height,
+                .block_height_mask = params.block_height_mask,
+            },
+            .num_dispatches{
+                Common::DivCeil(swizzle.num_tiles.width, 8U),
+                Common::DivCeil(swizzle.num_tiles.height, 8U),
+                static_cast<u32>(image.info.resources.layers),
+            },
+            .descriptor_data = compute_pass_descriptor_queue.UpdateData(),
+        });
+    }
+    // The image has no contents yet, so the compute queue can take it without an ownership
+    // transfer. When the queue is from another family, it's released back to graphics.
+    const VkImage vk_image = image.Handle();
+    const VkImageAspectFlags aspect_mask = image.AspectMask();
+    const u32 compute_family = device.GetComputeFamily();
+    const u32 graphics_family = device.GetGraphicsFamily();
+    const bool is_same_family = compute_family == graphics_family;
+    const VkImageSubresourceRange range{
+        .aspectMask = aspect_mask,
+        .baseMipLevel = 0,
+        .levelCount = VK_REMAINING_MIP_LEVELS,
+        .baseArrayLayer = 0,
+        .layerCount = VK_REMAINING_ARRAY_LAYERS,
+    };
+    (void)image.ExchangeInitialization();
+    scheduler.RecordAsyncCompute([this, vk_image, range, compute_family, graphics_family,
+                                  is_same_family,
+                                  dispatches = std::move(dispatches)](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier write_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_NONE,
+            .dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, write_barrier);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        for (const AstcDispatch& dispatch : dispatches) {
+            const VkDescriptorSet set = descriptor_allocator.Commit();
+            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template,
+                                                    dispatch.descriptor_data);
+            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, dispatch.uniforms);
+            cmdbuf.Dispatch(dispatch.num_dispatches[0], dispatch.num_dispatches[1],
+                            dispatch.num_dispatches[2]);
+        }
+        if (is_same_family) {
+            // Signalling the compute timeline makes the writes available to the graphics queue
+            return;
+        }
+        const VkImageMemoryBarrier release_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_NONE,
+            .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = compute_family,
+            .dstQueueFamilyIndex = graphics_family,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, release_barrier);
+    });
+    if (!is_same_family) {
+        scheduler.RequestOutsideRenderPassOperationContext();
+        scheduler.Record([vk_image, range, compute_family,
+                          graphics_family](vk::CommandBuffer cmdbuf) {
+            const VkImageMemoryBarrier acquire_barrier{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_NONE,
+                .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .srcQueueFamilyIndex = compute_family,
+                .dstQueueFamilyIndex = graphics_family,
+                .image = vk_image,
+                .subresourceRange = range,
+            };
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                   VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, acquire_barrier);
+        });
+    }
+    // Hand the decode to the worker right away, so it runs while the frame is being recorded
+    scheduler.DispatchWork();
+}
+
+BCnDecoderPass::BCnDecoderPass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, ASTC_DESCRIPTOR_SET_BINDINGS,
+                  ASTC_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, ASTC_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(BCnDecodePushConstants)>, DECODE_BCN_COMP_SPV),
+      scheduler{scheduler_}, compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+BCnDecoderPass::~BCnDecoderPass() = default;
+
+bool BCnDecoderPass::IsFormatSupported(VideoCore::Surface::PixelFormat format) noexcept {
+    return DecodeFormat(format).has_value();
+}
+
+std::optional<u32> BCnDecoderPass::DecodeFormat(VideoCore::Surface::PixelFormat format) noexcept {
+    using VideoCore::Surface::PixelFormat;
+    // Matches the FORMAT_ constants of the shader
+    switch (format) {
+    case PixelFormat::BC1_RGBA_UNORM:
+    case PixelFormat::BC1_RGBA_SRGB:
+        return 0;
+    case PixelFormat::BC2_UNORM:
+    case PixelFormat::BC2_SRGB:
+        return 1;
+    case PixelFormat::BC3_UNORM:
+    case PixelFormat::BC3_SRGB:
+        return 2;
+    case PixelFormat::BC7_UNORM:
+    case PixelFormat::BC7_SRGB:
+        return 3;
+    default:
+        return std::nullopt;
+    }
+}
+
+void BCnDecoderPass::Decode(Image& image, const StagingBufferRef& map,
+                            std::span<const VideoCommon::SwizzleParameters> swizzles) {
+    using namespace VideoCommon::Accelerated;
+    const std::optional<u32> format = DecodeFormat(image.info.format);
+    ASSERT(format.has_value());
+    scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "BCnDecoderPass"};
+    const VkPipeline vk_pipeline = *pipeline;
+    const VkImage vk_image = image.Handle();
+    const bool is_initialized = image.ExchangeInitialization();
+    const VkImageSubresourceRange range{
+        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+        .baseMipLevel = 0,
+        .levelCount = VK_REMAINING_MIP_LEVELS,
+        .baseArrayLayer = 0,
+        .layerCount = VK_REMAINING_ARRAY_LAYERS,
+    };
+    scheduler.Record([vk_pipeline, vk_image, is_initialized, range](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier image_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = static_cast<VkAccessFlags>(
+                is_initialized ? VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT
+                               : VK_ACCESS_NONE),
+            .dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .oldLayout = is_initialized ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(is_initialized ? VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+                                              : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, image_barrier);
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, vk_pipeline);
+    });
+    for (const VideoCommon::SwizzleParameters& swizzle : swizzles) {
+        const size_t input_offset = swizzle.buffer_offset + map.offset;
+        const u32 num_dispatches_x = Common::DivCeil(swizzle.num_tiles.width, 8U);
+        const u32 num_dispatches_y = Common::DivCeil(swizzle.num_tiles.height, 8U);
+        const u32 num_dispatches_z = image.info.resources.layers;
+
+        compute_pass_descriptor_queue.Acquire();
+        compute_pass_descriptor_queue.AddBuffer(map.buffer, input_offset,
+                                                image.guest_size_bytes - swizzle.buffer_offset);
+        compute_pass_descriptor_queue.AddImage(image.StorageImageView(swizzle.level));
+        const void* const descriptor_data{compute_pass_descriptor_queue.UpdateData()};
+
+        const auto params = MakeBlockLinearSwizzle2DParams(swizzle, image.info);
+        ASSERT(params.origin == (std::array<u32, 3>{0, 0, 0}));
+        ASSERT(params.destination == (std::array<s32, 3>{0, 0, 0}));
+        scheduler.Record([this, num_dispatches_x, num_dispatches_y, num_dispatches_z, params,
+                          descriptor_data, format = *format](vk::CommandBuffer cmdbuf) {
+            const BCnDecodePushConstants uniforms{
+                .format = format,
+                .bytes_per_block_log2 = params.bytes_per_block_log2,
+                .layer_stride = params.layer_stride,
+                .block_size = params.block_size,
+                .x_shift = params.x_shift,
+                .block_height = params.block_height,
+                .block_height_mask = params.block_height_mask,
+            };
+            const VkDescriptorSet set = descriptor_allocator.Commit();
+            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template, descriptor_data);
+            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, uniforms);
+            cmdbuf.Dispatch(num_dispatches_x, num_dispatches_y, num_dispatches_z);
+        });
+    }
+    scheduler.Record([vk_image, range](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier image_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, image_barrier);
+    });
+}
+
+BCnEncoderPass::BCnEncoderPass(const Device& device_, Scheduler& scheduler_,
+                               DescriptorPool& descriptor_pool_,
+                               StagingBufferPool& staging_buffer_pool_,
+                               ComputePassDescriptorQueue& compute_pass_descriptor_queue_)
+    : ComputePass(device_, descriptor_pool_, BCN_DESCRIPTOR_SET_BINDINGS,
+                  BCN_PASS_DESCRIPTOR_UPDATE_TEMPLATE_ENTRY, BCN_BANK_INFO,
+                  COMPUTE_PUSH_CONSTANT_RANGE<sizeof(BCnEncodePushConstants)>,
+                  CONVERT_RGBA8_TO_BCN_COMP_SPV),
+      scheduler{scheduler_}, staging_buffer_pool{staging_buffer_pool_},
+      compute_pass_descriptor_queue{compute_pass_descriptor_queue_} {}
+
+BCnEncoderPass::~BCnEncoderPass() = default;
+
+void BCnEncoderPass::Encode(Image& dst, Image& src, bool encode_alpha) {
+    struct LevelDispatch {
+        BCnEncodePushConstants uniforms;
+        std::array<u32, 3> num_dispatches;
+        const void* descriptor_data;
+    };
+    const u32 block_bytes = encode_alpha ? 16 : 8;
+    const u32 num_layers = static_cast<u32>(dst.info.resources.layers);
+    const VkDeviceSize alignment = device.GetStorageBufferAlignment();
+    std::vector<VkBufferImageCopy> copies;
+    copies.reserve(dst.info.resources.levels);
+    VkDeviceSize total_size = 0;
+    for (s32 level = 0; level < dst.info.resources.levels; ++level) {
+        const VideoCommon::Extent3D extent = VideoCommon::MipSize(dst.info.size, level);
+        total_size = Common::AlignUp(total_size, alignment);
+        copies.push_back(VkBufferImageCopy{
+            .bufferOffset = total_size,
+            .bufferRowLength = 0,
+            .bufferImageHeight = 0,
+            .imageSubresource{
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .mipLevel = static_cast<u32>(level),
+                .baseArrayLayer = 0,
+                .layerCount = num_layers,
+            },
+            .imageOffset{.x = 0, .y = 0, .z = 0},
+            .imageExtent{.width = extent.width, .height = extent.height, .depth = 1},
+        });
+        total_size += VkDeviceSize{Common::DivCeil(extent.width, 4U)} *
+                      Common::DivCeil(extent.height, 4U) * num_layers * block_bytes;
+    }
+    const StagingBufferRef staging =
+        staging_buffer_pool.Request(static_cast<size_t>(total_size), MemoryUsage::DeviceLocal);
+
+    std::vector<LevelDispatch> dispatches;
+    dispatches.reserve(copies.size());
+    for (VkBufferImageCopy& copy : copies) {
+        const u32 level = copy.imageSubresource.mipLevel;
+        const u32 num_blocks_x = Common::DivCeil(copy.imageExtent.width, 4U);
+        const u32 num_blocks_y = Common::DivCeil(copy.imageExtent.height, 4U);
+        const VkDeviceSize level_size =
+            VkDeviceSize{num_blocks_x} * num_blocks_y * num_layers * block_bytes;
+        copy.bufferOffset += staging.offset;
+
+        compute_pass_descriptor_queue.Acquire();
+        compute_pass_descriptor_queue.AddImage(src.StorageImageView(static_cast<s32>(level)));
+        compute_pass_descriptor_queue.AddBuffer(staging.buffer, copy.bufferOffset, level_size);
+        dispatches.push_back({
+            .uniforms{
+                .num_blocks = {num_blocks_x, num_blocks_y},
+                .encode_alpha = encode_alpha ? 1U : 0U,
+            },
+            .num_dispatches{
+                Common::DivCeil(num_blocks_x, 8U),
+                Common::DivCeil(num_blocks_y, 8U),
+                num_layers,
+            },
+            .descriptor_data = compute_pass_descriptor_queue.UpdateData(),
+        });
+    }
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "BCnEncoderPass"};
+    const VkImage dst_image = dst.Handle();
+    const VkBuffer buffer = staging.buffer;
+    const bool is_initialized = dst.ExchangeInitialization();
+    scheduler.Record([this, dst_image, buffer, is_initialized, dispatches = std::move(dispatches),
+                      copies = std::move(copies)](vk::CommandBuffer cmdbuf) {
+        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+        for (const LevelDispatch& dispatch : dispatches) {
+            const VkDescriptorSet set = descriptor_allocator.Commit();
+            device.GetLogical().UpdateDescriptorSet(set, *descriptor_template,
+                                                    dispatch.descriptor_data);
+            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *layout, 0, set, {});
+            cmdbuf.PushConstants(*layout, VK_SHADER_STAGE_COMPUTE_BIT, dispatch.uniforms);
+            cmdbuf.Dispatch(dispatch.num_dispatches[0], dispatch.num_dispatches[1],
+                            dispatch.num_dispatches[2]);
+        }
+        const VkImageSubresourceRange range{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = VK_REMAINING_MIP_LEVELS,
+            .baseArrayLayer = 0,
+            .layerCount = VK_REMAINING_ARRAY_LAYERS,
+        };
+        const VkBufferMemoryBarrier buffer_barrier{
+            .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .buffer = buffer,
+            .offset = 0,
+            .size = VK_WHOLE_SIZE,
+        };
+        const VkImageMemoryBarrier write_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = is_initialized ? VkAccessFlags{VK_ACCESS_MEMORY_READ_BIT |
+                                                            VK_ACCESS_MEMORY_WRITE_BIT}
+                                            : VkAccessFlags{0},
+            .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .oldLayout = is_initialized ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = dst_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, {}, buffer_barrier, write_barrier);
+        cmdbuf.CopyBufferToImage(buffer, dst_image, VK_IMAGE_LAYOUT_GENERAL, copies);
+        const VkImageMemoryBarrier read_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = dst_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                               0, read_barrier);
+    });
+}
+
 MSAACopyPass::MSAACopyPass(const Device& device_, Scheduler& scheduler_,
                            DescriptorPool& descriptor_pool_,
                            StagingBufferPool& staging_buffer_pool_,
@@ -682,6 +1275,7 @@ void MSAACopyPass::CopyImage(Image& dst_image, Image& src_image,
                              bool msaa_to_non_msaa) {
     const VkPipeline msaa_pipeline = *pipelines[msaa_to_non_msaa ? 1 : 0];
     scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "MSAACopyPass"};
     for (const VideoCommon::ImageCopy& copy : copies) {
         ASSERT(copy.src_subresource.base_layer == 0);
         ASSERT(copy.src_subresource.num_layers == 1);
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -11,6 +14,7 @@
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
 #include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/surface.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -19,6 +23,10 @@ namespace VideoCommon {
 struct SwizzleParameters;
 }
 
+namespace Tegra::DMA {
+struct SwizzleCopy;
+}
+
 namespace Vulkan {
 
 class Device;
@@ -57,9 +65,10 @@ public:
     ~Uint8Pass();
 
     /// Assemble uint8 indices into an uint16 index buffer
-    /// Returns a pair with the staging buffer, and the offset where the assembled data is
+    /// Returns a pair with the staging buffer, and the offset where the assembled data is.
+    /// When dst_buffer is not null the indices are written to its start instead of staging.
     std::pair<VkBuffer, VkDeviceSize> Assemble(u32 num_vertices, VkBuffer src_buffer,
-                                               u32 src_offset);
+                                               u32 src_offset, VkBuffer dst_buffer = nullptr);
 
 private:
     Scheduler& scheduler;
@@ -75,9 +84,16 @@ public:
                              ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
     ~QuadIndexedPass();
 
+    /// Returns the number of u32 indices Assemble writes for the quads
+    [[nodiscard]] static u32 NumTriangleVertices(u32 num_vertices, bool is_strip) noexcept {
+        return (is_strip ? (num_vertices - 2) / 2 : num_vertices / 4) * 6;
+    }
+
+    /// Same as Uint8Pass::Assemble, the output has u32 indices of triangle lists.
     std::pair<VkBuffer, VkDeviceSize> Assemble(
         Tegra::Engines::Maxwell3D::Regs::IndexFormat index_format, u32 num_vertices,
-        u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip);
+        u32 base_vertex, VkBuffer src_buffer, u32 src_offset, bool is_strip,
+        VkBuffer dst_buffer = nullptr);
 
 private:
     Scheduler& scheduler;
@@ -112,6 +128,22 @@ private:
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
 };
 
+class BlockLinearCopyPass final : public ComputePass {
+public:
+    explicit BlockLinearCopyPass(const Device& device_, Scheduler& scheduler_,
+                                 DescriptorPool& descriptor_pool_,
+                                 ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BlockLinearCopyPass();
+
+    /// Copies a subrect between two buffers, swizzling or unswizzling it as the operands require
+    void Copy(VkBuffer dst_buffer, u32 dst_offset, VkBuffer src_buffer, u32 src_offset,
+              const Tegra::DMA::SwizzleCopy& copy);
+
+private:
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class ASTCDecoderPass final : public ComputePass {
 public:
     explicit ASTCDecoderPass(const Device& device_, Scheduler& scheduler_,
@@ -125,12 +157,57 @@ public:
                   std::span<const VideoCommon::SwizzleParameters> swizzles);
 
 private:
+    /// Decodes an image that hasn't been used yet on the async compute queue, without stalling.
+    void AssembleAsync(Image& image, const StagingBufferRef& map,
+                       std::span<const VideoCommon::SwizzleParameters> swizzles,
+                       const std::array<u32, 2>& block_dims);
+
     Scheduler& scheduler;
     StagingBufferPool& staging_buffer_pool;
     ComputePassDescriptorQueue& compute_pass_descriptor_queue;
     MemoryAllocator& memory_allocator;
 };
 
+/// Decodes block linear BC1, BC2, BC3 and BC7 images to RGBA8 for devices without native BCn.
+class BCnDecoderPass final : public ComputePass {
+public:
+    explicit BCnDecoderPass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BCnDecoderPass();
+
+    /// Returns true when images of the format can be decoded by the pass
+    [[nodiscard]] static bool IsFormatSupported(VideoCore::Surface::PixelFormat format) noexcept;
+
+    void Decode(Image& image, const StagingBufferRef& map,
+                std::span<const VideoCommon::SwizzleParameters> swizzles);
+
+private:
+    [[nodiscard]] static std::optional<u32> DecodeFormat(
+        VideoCore::Surface::PixelFormat format) noexcept;
+
+    Scheduler& scheduler;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
+/// Encodes RGBA8 images, like decoded ASTC, to BC1 or BC3 for devices without native ASTC.
+class BCnEncoderPass final : public ComputePass {
+public:
+    explicit BCnEncoderPass(const Device& device_, Scheduler& scheduler_,
+                            DescriptorPool& descriptor_pool_,
+                            StagingBufferPool& staging_buffer_pool_,
+                            ComputePassDescriptorQueue& compute_pass_descriptor_queue_);
+    ~BCnEncoderPass();
+
+    /// Encodes every level and layer of src into dst, BC3 when encode_alpha is set and BC1 if not.
+    void Encode(Image& dst, Image& src, bool encode_alpha);
+
+private:
+    Scheduler& scheduler;
+    StagingBufferPool& staging_buffer_pool;
+    ComputePassDescriptorQueue& compute_pass_descriptor_queue;
+};
+
 class MSAACopyPass final : public ComputePass {
 public:
     explicit MSAACopyPass(const Device& device_, Scheduler& scheduler_,
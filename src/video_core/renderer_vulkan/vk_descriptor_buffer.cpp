@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+namespace {
+
+using namespace Common::Literals;
+
+constexpr VkDeviceSize DESCRIPTOR_BUFFER_SIZE = 4_MiB;
+constexpr VkDeviceSize MAX_DESCRIPTOR_BUFFER_SIZE = 64_MiB;
+
+VkDeviceSize MaxBufferSize(const Device& device) {
+    // Combined image samplers count against both ranges
+    const auto& properties{device.DescriptorBufferProperties()};
+    return (std::min)({MAX_DESCRIPTOR_BUFFER_SIZE, properties.maxResourceDescriptorBufferRange,
+                       properties.maxSamplerDescriptorBufferRange});
+}
+
+} // Anonymous namespace
+
+DescriptorBuffer::DescriptorBuffer(const Device& device_, MemoryAllocator& memory_allocator_,
+                                   Scheduler& scheduler_)
+    : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
+      alignment{(std::max<VkDeviceSize>)(
+          device.DescriptorBufferProperties().descriptorBufferOffsetAlignment, 1)} {
+    CreateBuffer((std::min)(DESCRIPTOR_BUFFER_SIZE, MaxBufferSize(device)));
+}
+
+DescriptorBuffer::~DescriptorBuffer() = default;
+
+VkDeviceSize DescriptorBuffer::Write(const DescriptorBufferLayout& layout,
+                                     const DescriptorUpdateEntry* data) {
+    const VkDeviceSize set_offset = Allocate(layout.size);
+    u8* const set = mapped.data() + set_offset;
+    const u8* const entries = reinterpret_cast<const u8*>(data);
+    const vk::Device& dev{device.GetLogical()};
+    for (const DescriptorBufferLayout::Binding& binding : layout.bindings) {
+        const size_t descriptor_size = DescriptorSize(binding.type);
+        for (u32 index = 0; index < binding.count; ++index) {
+            const auto& entry{*reinterpret_cast<const DescriptorUpdateEntry*>(
+                entries + binding.data_offset + index * binding.data_stride)};
+            VkDescriptorAddressInfoEXT address_info;
+            VkDescriptorGetInfoEXT info{
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                .pNext = nullptr,
+                .type = binding.type,
+                .data{},
+            };
+            switch (binding.type) {
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                address_info = {
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                    .pNext = nullptr,
+                    .address =
+                        dev.GetBufferDeviceAddress(entry.buffer.buffer) + entry.buffer.offset,
+                    .range = entry.buffer.range,
+                    .format = VK_FORMAT_UNDEFINED,
+                };
+                if (binding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER) {
+                    info.data.pUniformBuffer = &address_info;
+                } else {
+                    info.data.pStorageBuffer = &address_info;
+                }
+                break;
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                info.data.pCombinedImageSampler = &entry.image;
+                break;
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                info.data.pStorageImage = &entry.image;
+                break;
+            default:
+                ASSERT_MSG(false, "Invalid descriptor buffer type {}",
+                           static_cast<u32>(binding.type));
+                continue;
+            }
+            dev.GetDescriptorEXT(info, descriptor_size,
+                                 set + binding.offset + index * descriptor_size);
+        }
+    }
+    const u64 current_tick = scheduler.CurrentTick();
+    if (bound_tick != current_tick) {
+        // Every tick is recorded to a new command buffer, bind the ring once for each of them
+        bound_tick = current_tick;
+        const VkDescriptorBufferBindingInfoEXT binding_info{
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+            .pNext = nullptr,
+            .address = address,
+            .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                     VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT,
+        };
+        scheduler.Record([binding_info](vk::CommandBuffer cmdbuf) {
+            cmdbuf.BindDescriptorBuffersEXT(binding_info);
+        });
+    }
+    return set_offset;
+}
+
+void DescriptorBuffer::CreateBuffer(VkDeviceSize size) {
+    if (buffer) {
+        retired_buffers.emplace_back(std::move(buffer), scheduler.CurrentTick());
+    }
+    buffer = memory_allocator.CreateBuffer(
+        {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = size,
+            .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                     VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                     VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        },
+        MemoryUsage::Stream);
+    if (device.HasDebuggingToolAttached()) {
+        buffer.SetObjectNameEXT("Descriptor Buffer");
+    }
+    mapped = buffer.Mapped();
+    ASSERT_MSG(!mapped.empty(), "Descriptor buffer must be host visible!");
+    address = device.GetLogical().GetBufferDeviceAddress(*buffer);
+    buffer_size = size;
+    region_size = size / NUM_SYNCS;
+    iterator = 0;
+    current_region = NUM_SYNCS;
+    sync_ticks.fill(0);
+    bound_tick = 0;
+}
+
+VkDeviceSize DescriptorBuffer::Allocate(VkDeviceSize size) {
+    std::erase_if(retired_buffers, [this](const std::pair<vk::Buffer, u64>& retired) {
+        return scheduler.IsFree(retired.second);
+    });
+    if (size > region_size) {
+        Grow();
+        return Allocate(size);
+    }
+    VkDeviceSize offset = Common::AlignUp(iterator, alignment);
+    if (offset + size > buffer_size) {
+        offset = 0;
+    }
+    const size_t first_region = static_cast<size_t>(offset / region_size);
+    const size_t last_region = static_cast<size_t>((offset + size - 1) / region_size);
+    const u64 current_tick = scheduler.CurrentTick();
+    for (size_t region = first_region; region <= last_region; ++region) {
+        if (region == current_region) {
+            continue;
+        }
+        const u64 tick = sync_ticks[region];
+        if (tick < current_tick) {
+            if (!scheduler.IsFree(tick)) {
+                scheduler.Wait(tick);
+            }
+            continue;
+        }
+        // The command buffer being recorded filled the whole ring, flushing it here would
+        // split the draw, move to a bigger ring instead.
+        Grow();
+        return Allocate(size);
+    }
+    std::fill(sync_ticks.begin() + first_region, sync_ticks.begin() + last_region + 1,
+              current_tick);
+    current_region = last_region;
+    iterator = offset + size;
+    return offset;
+}
+
+void DescriptorBuffer::Grow() {
+    const VkDeviceSize new_size = buffer_size * 2;
+    if (new_size > MaxBufferSize(device)) {
+        // Same as running out of descriptor pools, we can't handle this from here.
+        throw vk::Exception(VK_ERROR_OUT_OF_POOL_MEMORY);
+    }
+    LOG_WARNING(Render_Vulkan, "Descriptor buffer overflow, growing it to {} bytes", new_size);
+    CreateBuffer(new_size);
+}
+
+size_t DescriptorBuffer::DescriptorSize(VkDescriptorType type) const noexcept {
+    // Robust buffer access is always enabled
+    const auto& properties{device.DescriptorBufferProperties()};
+    switch (type) {
+    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        return properties.robustUniformBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        return properties.robustStorageBufferDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        return properties.combinedImageSamplerDescriptorSize;
+    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        return properties.storageImageDescriptorSize;
+    default:
+        return 0;
+    }
+}
+
+} // namespace Vulkan
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MemoryAllocator;
+class Scheduler;
+struct DescriptorUpdateEntry;
+
+/// Placement of the descriptors of a set layout created for descriptor buffers.
+struct DescriptorBufferLayout {
+    struct Binding {
+        VkDescriptorType type;
+        u32 count;
+        VkDeviceSize offset; ///< Offset of the binding in the set
+        size_t data_offset;  ///< Offset of the first element in the descriptor update entries
+        size_t data_stride;  ///< Distance between elements in the descriptor update entries
+    };
+
+    VkDeviceSize size{}; ///< Size of the set in bytes
+    boost::container::small_vector<Binding, 32> bindings;
+};
+
+/**
+ * Ring of host visible memory where descriptor sets are written with VK_EXT_descriptor_buffer,
+ * instead of allocating and updating a set from a DescriptorPool on every draw.
+ *
+ * Sets are written by the thread recording draws. Like the stream buffers, the ring is split in
+ * regions tagged with the tick of their last usage.
+ */
+class DescriptorBuffer {
+    static constexpr size_t NUM_SYNCS = 16;
+
+public:
+    explicit DescriptorBuffer(const Device& device, MemoryAllocator& memory_allocator,
+                              Scheduler& scheduler);
+    ~DescriptorBuffer();
+
+    DescriptorBuffer& operator=(const DescriptorBuffer&) = delete;
+    DescriptorBuffer(const DescriptorBuffer&) = delete;
+
+    /// Writes a set to the ring, binding the ring to the current command buffer when needed.
+    /// @returns Offset of the set to pass to vkCmdSetDescriptorBufferOffsetsEXT
+    [[nodiscard]] VkDeviceSize Write(const DescriptorBufferLayout& layout,
+                                     const DescriptorUpdateEntry* data);
+
+private:
+    void CreateBuffer(VkDeviceSize size);
+
+    VkDeviceSize Allocate(VkDeviceSize size);
+
+    void Grow();
+
+    [[nodiscard]] size_t DescriptorSize(VkDescriptorType type) const noexcept;
+
+    const Device& device;
+    MemoryAllocator& memory_allocator;
+    Scheduler& scheduler;
+    VkDeviceSize alignment;
+
+    vk::Buffer buffer;
+    std::span<u8> mapped;
+    VkDeviceAddress address{};
+    VkDeviceSize buffer_size{};
+    VkDeviceSize region_size{};
+    VkDeviceSize iterator{};
+    size_t current_region = NUM_SYNCS;
+    std::array<u64, NUM_SYNCS> sync_ticks{};
+    u64 bound_tick{};
+
+    /// Rings replaced by a bigger one, kept alive until the GPU is done with them
+    std::vector<std::pair<vk::Buffer, u64>> retired_buffers;
+};
+
+} // namespace Vulkan
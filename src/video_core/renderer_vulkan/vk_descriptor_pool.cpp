@@ -5,13 +5,17 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <mutex>
 #include <span>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/hash.h"
+#include "common/logging/log.h"
 #include <ranges>
 #include "video_core/renderer_vulkan/vk_descriptor_pool.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -25,6 +29,7 @@ constexpr s32 SCORE_THRESHOLD = 3;
 
 struct DescriptorBank {
     DescriptorBankInfo info;
+    std::mutex pools_mutex; ///< Allocators of several pipelines may grow the bank at once
     std::vector<vk::DescriptorPool> pools;
 };
 
@@ -88,11 +93,49 @@ static void AllocatePool(const Device& device, DescriptorBank& bank) {
 }
 
 DescriptorAllocator::DescriptorAllocator(const Device& device_, MasterSemaphore& master_semaphore_,
-                                         DescriptorBank& bank_, VkDescriptorSetLayout layout_)
+                                         DescriptorBank& bank_, VkDescriptorSetLayout layout_,
+                                         DescriptorSetCacheStats& cache_stats_)
     : ResourcePool(master_semaphore_, SETS_GROW_RATE), device{&device_}, bank{&bank_},
-      layout{layout_} {}
+      layout{layout_}, master_semaphore{&master_semaphore_}, cache_stats{&cache_stats_},
+      commit_mutex{std::make_unique<std::mutex>()} {}
 
 VkDescriptorSet DescriptorAllocator::Commit() {
+    std::scoped_lock lock{*commit_mutex};
+    return CommitSet();
+}
+
+VkDescriptorSet DescriptorAllocator::Commit(VkDescriptorUpdateTemplate update_template,
+                                            std::span<const DescriptorUpdateEntry> entries) {
+    std::scoped_lock lock{*commit_mutex};
+    // A set committed for a submission won't be handed out again until the submission completes,
+    // so it can be bound again within it as long as nothing is written to it. Workers record
+    // different submissions, so they never share sets through the cache
+    const u64 tick = master_semaphore->RecordingTick();
+    const u64 hash = Common::WyHash64(entries.data(), entries.size_bytes());
+    const auto it = std::ranges::find_if(cache, [&](const CachedSet& cached) {
+        return cached.set != VK_NULL_HANDLE && cached.tick == tick && cached.hash == hash &&
+               cached.entries.size() == entries.size() &&
+               std::memcmp(cached.entries.data(), entries.data(), entries.size_bytes()) == 0;
+    });
+    if (it != cache.end()) {
+        cache_stats->hits.fetch_add(1, std::memory_order_relaxed);
+        return it->set;
+    }
+    cache_stats->misses.fetch_add(1, std::memory_order_relaxed);
+
+    const VkDescriptorSet set = CommitSet();
+    device->GetLogical().UpdateDescriptorSet(set, update_template, entries.data());
+
+    CachedSet& cached = cache[cache_cursor];
+    cache_cursor = (cache_cursor + 1) % CACHE_SIZE;
+    cached.hash = hash;
+    cached.tick = tick;
+    cached.set = set;
+    cached.entries.assign(entries.begin(), entries.end());
+    return set;
+}
+
+VkDescriptorSet DescriptorAllocator::CommitSet() {
     const size_t index = CommitResource();
     return sets[index / SETS_GROW_RATE][index % SETS_GROW_RATE];
 }
@@ -102,6 +145,8 @@ void DescriptorAllocator::Allocate(size_t begin, size_t end) {
 }
 
 vk::DescriptorSets DescriptorAllocator::AllocateDescriptors(size_t count) {
+    // Allocating from a pool has to be externally synchronized
+    std::scoped_lock lock{bank->pools_mutex};
     const std::vector<VkDescriptorSetLayout> layouts(count, layout);
     VkDescriptorSetAllocateInfo allocate_info{
         .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
@@ -125,8 +170,13 @@ vk::DescriptorSets DescriptorAllocator::AllocateDescriptors(size_t count) {
     throw vk::Exception(VK_ERROR_OUT_OF_POOL_MEMORY);
 }
 
-DescriptorPool::DescriptorPool(const Device& device_, Scheduler& scheduler)
-    : device{device_}, master_semaphore{scheduler.GetMasterSemaphore()} {}
+DescriptorPool::DescriptorPool(const Device& device_, MemoryAllocator& memory_allocator,
+                               Scheduler& scheduler)
+    : device{device_}, master_semaphore{scheduler.GetMasterSemaphore()} {
+    if (device.IsExtDescriptorBufferSupported()) {
+        descriptor_buffer.emplace(device, memory_allocator, scheduler);
+    }
+}
 
 DescriptorPool::~DescriptorPool() = default;
 
@@ -142,7 +192,16 @@ DescriptorAllocator DescriptorPool::Allocator(VkDescriptorSetLayout layout,
 
 DescriptorAllocator DescriptorPool::Allocator(VkDescriptorSetLayout layout,
                                               const DescriptorBankInfo& info) {
-    return DescriptorAllocator(device, master_semaphore, Bank(info), layout);
+    return DescriptorAllocator(device, master_semaphore, Bank(info), layout, cache_stats);
+}
+
+void DescriptorPool::TickFrame() {
+    const u64 hits = cache_stats.hits.exchange(0, std::memory_order_relaxed);
+    const u64 misses = cache_stats.misses.exchange(0, std::memory_order_relaxed);
+    if (hits != 0) {
+        LOG_DEBUG(Render_Vulkan, "Descriptor sets: {} reused, {} written ({:.1f}% hit rate)", hits,
+                  misses, 100.0 * static_cast<double>(hits) / static_cast<double>(hits + misses));
+    }
 }
 
 DescriptorBank& DescriptorPool::Bank(const DescriptorBankInfo& reqs) {
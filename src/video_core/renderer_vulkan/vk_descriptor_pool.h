@@ -1,23 +1,40 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <span>
 #include <vector>
 
 #include "shader_recompiler/shader_info.h"
+#include "video_core/renderer_vulkan/vk_descriptor_buffer.h"
 #include "video_core/renderer_vulkan/vk_resource_pool.h"
+#include "video_core/renderer_vulkan/vk_update_descriptor.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace Vulkan {
 
 class Device;
+class MemoryAllocator;
 class Scheduler;
 
 struct DescriptorBank;
 
+/// Lookups of sets by their contents, shared by all the allocators of a pool
+struct DescriptorSetCacheStats {
+    std::atomic<u64> hits;   ///< Sets reused because they were written with the same bindings
+    std::atomic<u64> misses; ///< Sets committed and written
+};
+
 struct DescriptorBankInfo {
     [[nodiscard]] bool IsSuperset(const DescriptorBankInfo& subset) const noexcept;
 
@@ -43,11 +60,30 @@ public:
     DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
     DescriptorAllocator(const DescriptorAllocator&) = delete;
 
+    /// Commits a set, thread-safe as pipelines are bound by every scheduler worker
     VkDescriptorSet Commit();
 
+    /// Returns a set written with the given entries through the update template.
+    /// Sets written with the same entries for the submission being recorded are reused instead.
+    VkDescriptorSet Commit(VkDescriptorUpdateTemplate update_template,
+                           std::span<const DescriptorUpdateEntry> entries);
+
 private:
+    /// Number of recently written sets looked up before writing a new one
+    static constexpr size_t CACHE_SIZE = 4;
+
+    struct CachedSet {
+        u64 hash{};
+        u64 tick{};
+        VkDescriptorSet set{};
+        std::vector<DescriptorUpdateEntry> entries;
+    };
+
     explicit DescriptorAllocator(const Device& device_, MasterSemaphore& master_semaphore_,
-                                 DescriptorBank& bank_, VkDescriptorSetLayout layout_);
+                                 DescriptorBank& bank_, VkDescriptorSetLayout layout_,
+                                 DescriptorSetCacheStats& cache_stats_);
+
+    VkDescriptorSet CommitSet();
 
     void Allocate(size_t begin, size_t end) override;
 
@@ -56,13 +92,20 @@ private:
     const Device* device{};
     DescriptorBank* bank{};
     VkDescriptorSetLayout layout{};
+    MasterSemaphore* master_semaphore{};
+    DescriptorSetCacheStats* cache_stats{};
 
+    std::unique_ptr<std::mutex> commit_mutex;
     std::vector<vk::DescriptorSets> sets;
+
+    std::array<CachedSet, CACHE_SIZE> cache;
+    size_t cache_cursor{};
 };
 
 class DescriptorPool {
 public:
-    explicit DescriptorPool(const Device& device, Scheduler& scheduler);
+    explicit DescriptorPool(const Device& device, MemoryAllocator& memory_allocator,
+                            Scheduler& scheduler);
     ~DescriptorPool();
 
     DescriptorPool& operator=(const DescriptorPool&) = delete;
@@ -73,6 +116,13 @@ public:
     DescriptorAllocator Allocator(VkDescriptorSetLayout layout, const Shader::Info& info);
     DescriptorAllocator Allocator(VkDescriptorSetLayout layout, const DescriptorBankInfo& info);
 
+    void TickFrame();
+
+    /// Returns the ring sets are written to with VK_EXT_descriptor_buffer, null when unsupported.
+    [[nodiscard]] DescriptorBuffer* GetDescriptorBuffer() noexcept {
+        return descriptor_buffer ? &*descriptor_buffer : nullptr;
+    }
+
 private:
     DescriptorBank& Bank(const DescriptorBankInfo& reqs);
 
@@ -82,6 +132,10 @@ private:
     std::shared_mutex banks_mutex;
     std::vector<DescriptorBankInfo> bank_infos;
     std::vector<std::unique_ptr<DescriptorBank>> banks;
+
+    std::optional<DescriptorBuffer> descriptor_buffer;
+
+    DescriptorSetCacheStats cache_stats{};
 };
 
 } // namespace Vulkan
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "common/div_ceil.h"
+#include "video_core/renderer_vulkan/vk_foveated_shading.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+namespace {
+// Fragment shading rates, encoded as log2(width) << 2 | log2(height)
+constexpr u8 RATE_1X1 = 0;
+constexpr u8 RATE_1X2 = 1;
+constexpr u8 RATE_2X1 = 4;
+constexpr u8 RATE_2X2 = 5;
+
+// Normalized distances from the center where the rate gets coarser
+constexpr float FULL_RATE_RADIUS = 0.5f;
+constexpr float HALF_RATE_RADIUS = 0.85f;
+
+constexpr u32 PREFERRED_TEXEL_SIZE = 16;
+
+u32 ChooseTexelSize(const Device& device) {
+    const auto& properties = device.FragmentShadingRateProperties();
+    const VkExtent2D min_size = properties.minFragmentShadingRateAttachmentTexelSize;
+    const VkExtent2D max_size = properties.maxFragmentShadingRateAttachmentTexelSize;
+    // Limits are powers of two, so the clamped size is one too
+    const u32 min_texel = (std::max)(min_size.width, min_size.height);
+    const u32 max_texel = (std::min)(max_size.width, max_size.height);
+    return std::clamp(PREFERRED_TEXEL_SIZE, min_texel, (std::max)(min_texel, max_texel));
+}
+
+u8 FoveatedRate(u32 x, u32 y, VkExtent2D extent) {
+    // Distance of the texel center from the center of the map, normalized so the middle of
+    // each edge is at one
+    const auto normalized = [](u32 coord, u32 size) {
+        return (static_cast<float>(coord) + 0.5f) / static_cast<float>(size) * 2.0f - 1.0f;
+    };
+    const float dx = normalized(x, extent.width);
+    const float dy = normalized(y, extent.height);
+    const float distance = std::sqrt(dx * dx + dy * dy);
+    if (distance < FULL_RATE_RADIUS) {
+        return RATE_1X1;
+    }
+    if (distance < HALF_RATE_RADIUS) {
+        // Keep the full rate across the direction of the gradient, towards the center
+        return std::abs(dx) > std::abs(dy) ? RATE_2X1 : RATE_1X2;
+    }
+    return RATE_2X2;
+}
+} // Anonymous namespace
+
+FoveatedShading::FoveatedShading(const Device& device_, Scheduler& scheduler_,
+                                 MemoryAllocator& memory_allocator_,
+                                 StagingBufferPool& staging_buffer_pool_)
+    : device{device_}, scheduler{scheduler_}, memory_allocator{memory_allocator_},
+      staging_buffer_pool{staging_buffer_pool_}, texel_size{ChooseTexelSize(device)} {}
+
+FoveatedShading::~FoveatedShading() = default;
+
+VkImageView FoveatedShading::Map(VkExtent2D render_area) {
+    const VkExtent2D extent{
+        .width = Common::DivCeil(render_area.width, texel_size),
+        .height = Common::DivCeil(render_area.height, texel_size),
+    };
+    const u64 key = (static_cast<u64>(extent.width) << 32) | extent.height;
+    auto it = attachments.find(key);
+    if (it == attachments.end()) {
+        it = attachments.emplace(key, CreateAttachment(extent)).first;
+    }
+    return *it->second.image_view;
+}
+
+FoveatedShading::Attachment FoveatedShading::CreateAttachment(VkExtent2D extent) {
+    Attachment attachment;
+    attachment.image = memory_allocator.CreateImage(VkImageCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .imageType = VK_IMAGE_TYPE_2D,
+        .format = VK_FORMAT_R8_UINT,
+        .extent = {.width = extent.width, .height = extent.height, .depth = 1},
+        .mipLevels = 1,
+        .arrayLayers = 1,
+        .samples = VK_SAMPLE_COUNT_1_BIT,
+        .tiling = VK_IMAGE_TILING_OPTIMAL,
+        .usage = VK_IMAGE_USAGE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR |
+                 VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+    });
+    attachment.image_view = device.GetLogical().CreateImageView(VkImageViewCreateInfo{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .image = *attachment.image,
+        .viewType = VK_IMAGE_VIEW_TYPE_2D,
+        .format = VK_FORMAT_R8_UINT,
+        .components{},
+        .subresourceRange{.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                          .baseMipLevel = 0,
+                          .levelCount = 1,
+                          .baseArrayLayer = 0,
+                          .layerCount = 1},
+    });
+
+    // The pattern only depends on the size, it's written once from the host
+    const size_t size = static_cast<size_t>(extent.width) * extent.height;
+    const StagingBufferRef staging = staging_buffer_pool.Request(size, MemoryUsage::Upload);
+    for (u32 y = 0; y < extent.height; ++y) {
+        for (u32 x = 0; x < extent.width; ++x) {
+            staging.mapped_span[static_cast<size_t>(y) * extent.width + x] =
+                FoveatedRate(x, y, extent);
+        }
+    }
+
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([staging, image = *attachment.image, extent](vk::CommandBuffer cmdbuf) {
+        const VkImageSubresourceRange range{
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = 0,
+            .levelCount = 1,
+            .baseArrayLayer = 0,
+            .layerCount = 1,
+        };
+        const VkImageMemoryBarrier write_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_NONE,
+            .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = image,
+            .subresourceRange = range,
+        };
+        const VkImageMemoryBarrier read_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_FRAGMENT_SHADING_RATE_ATTACHMENT_READ_BIT_KHR,
+            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .newLayout = VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = image,
+            .subresourceRange = range,
+        };
+        const VkBufferImageCopy copy{
+            .bufferOffset = staging.offset,
+            .bufferRowLength = 0,
+            .bufferImageHeight = 0,
+            .imageSubresource{
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .mipLevel = 0,
+                .baseArrayLayer = 0,
+                .layerCount = 1,
+            },
+            .imageOffset{},
+            .imageExtent = {.width = extent.width, .height = extent.height, .depth = 1},
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, write_barrier);
+        cmdbuf.CopyBufferToImage(staging.buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 copy);
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               VK_PIPELINE_STAGE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR, 0,
+                               read_barrier);
+    });
+    return attachment;
+}
+
+} // namespace Vulkan
@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <unordered_map>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+class StagingBufferPool;
+
+/**
+ * Builds fragment shading rate attachments for upscaled render targets. The center of the target
+ * is shaded at full rate, and the rate gets coarser towards its edges.
+ */
+class FoveatedShading {
+public:
+    explicit FoveatedShading(const Device& device, Scheduler& scheduler,
+                             MemoryAllocator& memory_allocator,
+                             StagingBufferPool& staging_buffer_pool);
+    ~FoveatedShading();
+
+    /// Returns the attachment for a render area, building it on first use.
+    [[nodiscard]] VkImageView Map(VkExtent2D render_area);
+
+    /// Returns the size in pixels covered by one texel of the attachments.
+    [[nodiscard]] u32 TexelSize() const noexcept {
+        return texel_size;
+    }
+
+private:
+    struct Attachment {
+        vk::Image image;
+        vk::ImageView image_view;
+    };
+
+    Attachment CreateAttachment(VkExtent2D extent);
+
+    const Device& device;
+    Scheduler& scheduler;
+    MemoryAllocator& memory_allocator;
+    StagingBufferPool& staging_buffer_pool;
+    u32 texel_size{};
+    std::unordered_map<u64, Attachment> attachments;
+};
+
+} // namespace Vulkan
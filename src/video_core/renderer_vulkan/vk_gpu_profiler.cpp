@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_vulkan/vk_gpu_profiler.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+
+GpuPassProfiler::GpuPassProfiler(const Device& device_, MasterSemaphore& master_semaphore_)
+    : device{device_}, master_semaphore{master_semaphore_},
+      timestamp_period{static_cast<double>(device.GetTimestampPeriod())} {
+    const auto& dev = device.GetLogical();
+    for (Frame& frame : frames) {
+        frame.query_pool = dev.CreateQueryPool({
+            .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .queryType = VK_QUERY_TYPE_TIMESTAMP,
+            .queryCount = QUERIES_PER_FRAME,
+            .pipelineStatistics = 0,
+        });
+        dev.ResetQueryPool(*frame.query_pool, 0, QUERIES_PER_FRAME);
+        frame.passes.reserve(QUERIES_PER_FRAME / 2);
+    }
+    timestamps.reserve(QUERIES_PER_FRAME);
+    LOG_INFO(Render_Vulkan, "Profiling GPU passes, timestamp period is {} ns", timestamp_period);
+}
+
+GpuPassProfiler::~GpuPassProfiler() = default;
+
+std::optional<GpuPassProfiler::Query> GpuPassProfiler::BeginPass(std::string_view name, u64 id) {
+    ASSERT(!is_pass_open);
+    Frame& frame = frames[frame_index];
+    if (is_frame_skipped || frame.passes.size() * 2 >= QUERIES_PER_FRAME) {
+        return std::nullopt;
+    }
+    const u32 index = static_cast<u32>(frame.passes.size() * 2);
+    frame.passes.push_back({.name = name, .id = id});
+    is_pass_open = true;
+    return Query{.pool = *frame.query_pool, .index = index};
+}
+
+GpuPassProfiler::Query GpuPassProfiler::EndPass() {
+    ASSERT(is_pass_open);
+    is_pass_open = false;
+    const Frame& frame = frames[frame_index];
+    const Query query{
+        .pool = *frame.query_pool,
+        .index = static_cast<u32>(frame.passes.size() * 2 - 1),
+    };
+    if (is_frame_ended) {
+        // The end timestamp is recorded right after, before the tick the frame waits for
+        AdvanceFrame();
+    }
+    return query;
+}
+
+void GpuPassProfiler::TickFrame() {
+    if (is_pass_open) {
+        is_frame_ended = true;
+        return;
+    }
+    AdvanceFrame();
+}
+
+void GpuPassProfiler::AdvanceFrame() {
+    is_frame_ended = false;
+    Frame& current = frames[frame_index];
+    if (!current.passes.empty()) {
+        current.tick = master_semaphore.CurrentTick();
+        current.is_pending = true;
+    }
+    master_semaphore.Refresh();
+    for (Frame& frame : frames) {
+        if (frame.is_pending && master_semaphore.IsFree(frame.tick)) {
+            CollectFrame(frame);
+        }
+    }
+    frame_index = (frame_index + 1) % NUM_FRAMES;
+    // Skip measuring a frame instead of waiting for the GPU to be done with its queries
+    is_frame_skipped = frames[frame_index].is_pending;
+
+    if (++num_reported_frames >= REPORT_INTERVAL) {
+        Report();
+    }
+}
+
+void GpuPassProfiler::CollectFrame(Frame& frame) {
+    const auto& dev = device.GetLogical();
+    const u32 num_queries = static_cast<u32>(frame.passes.size() * 2);
+    timestamps.resize(num_queries);
+    const VkResult result =
+        dev.GetQueryResults(*frame.query_pool, 0, num_queries, sizeof(u64) * num_queries,
+                            timestamps.data(), sizeof(u64), VK_QUERY_RESULT_64_BIT);
+    switch (result) {
+    case VK_SUCCESS:
+        for (size_t pass = 0; pass < frame.passes.size(); ++pass) {
+            const u64 begin = timestamps[pass * 2];
+            const u64 end = timestamps[pass * 2 + 1];
+            if (end < begin) {
+                continue;
+            }
+            PassStats& pass_stats = stats[{frame.passes[pass].name, frame.passes[pass].id}];
+            pass_stats.total_ns += static_cast<u64>(static_cast<double>(end - begin) *
+                                                    timestamp_period);
+            ++pass_stats.count;
+        }
+        break;
+    case VK_NOT_READY:
+        LOG_WARNING(Render_Vulkan, "Timestamps of {} GPU passes weren't written",
+                    frame.passes.size());
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        throw vk::Exception(result);
+    }
+    dev.ResetQueryPool(*frame.query_pool, 0, QUERIES_PER_FRAME);
+    frame.passes.clear();
+    frame.is_pending = false;
+}
+
+void GpuPassProfiler::Report() {
+    const u64 num_frames = std::exchange(num_reported_frames, 0);
+    if (stats.empty()) {
+        return;
+    }
+    std::vector<std::pair<PassKey, PassStats>> sorted(stats.begin(), stats.end());
+    stats.clear();
+
+    const auto num_passes = (std::min)(sorted.size(), NUM_REPORTED_PASSES);
+    std::ranges::partial_sort(sorted, sorted.begin() + num_passes, [](const auto& a,
+                                                                      const auto& b) {
+        return a.second.total_ns > b.second.total_ns;
+    });
+    LOG_INFO(Render_Vulkan, "Most expensive GPU passes over the last {} frames:", num_frames);
+    for (size_t i = 0; i < num_passes; ++i) {
+        const auto& [key, pass_stats] = sorted[i];
+        LOG_INFO(Render_Vulkan, "  {} {:#x}: {:.3f} ms per frame over {} passes", key.name,
+                 key.id,
+                 static_cast<double>(pass_stats.total_ns) / 1e6 / static_cast<double>(num_frames),
+                 pass_stats.count);
+    }
+}
+
+} // namespace Vulkan
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class MasterSemaphore;
+
+/// Measures the GPU time of passes recorded by the scheduler with timestamp queries. Passes are
+/// aggregated by their name and identity, e.g. the framebuffer of a render pass, and the most
+/// expensive ones are logged periodically.
+class GpuPassProfiler {
+public:
+    static constexpr size_t NUM_FRAMES = 4;          ///< Frames that can be in flight
+    static constexpr u32 QUERIES_PER_FRAME = 2048;   ///< Two per pass
+    static constexpr u64 REPORT_INTERVAL = 300;      ///< Frames between two reports
+    static constexpr size_t NUM_REPORTED_PASSES = 8; ///< Passes shown in a report
+
+    struct Query {
+        VkQueryPool pool;
+        u32 index;
+    };
+
+    explicit GpuPassProfiler(const Device& device, MasterSemaphore& master_semaphore);
+    ~GpuPassProfiler();
+
+    /// Returns the query of the timestamp beginning a pass, nullopt when it can't be measured.
+    /// Passes don't nest, the name has to outlive the profiler.
+    [[nodiscard]] std::optional<Query> BeginPass(std::string_view name, u64 id);
+
+    /// Returns the query of the timestamp ending the pass begun last.
+    [[nodiscard]] Query EndPass();
+
+    /// Ends the frame recorded so far, once its open pass has ended, and collects the frames the
+    /// GPU has finished.
+    void TickFrame();
+
+private:
+    struct Pass {
+        std::string_view name;
+        u64 id;
+    };
+
+    struct Frame {
+        vk::QueryPool query_pool;
+        std::vector<Pass> passes; ///< Pass n was measured by queries 2n and 2n + 1
+        u64 tick = 0;             ///< Tick the timestamps are written before
+        bool is_pending = false;  ///< Waiting for the GPU to write its timestamps
+    };
+
+    struct PassKey {
+        bool operator==(const PassKey&) const noexcept = default;
+
+        std::string_view name;
+        u64 id;
+    };
+
+    struct PassKeyHash {
+        size_t operator()(const PassKey& key) const noexcept {
+            return std::hash<std::string_view>{}(key.name) ^ static_cast<size_t>(key.id);
+        }
+    };
+
+    struct PassStats {
+        u64 total_ns = 0;
+        u64 count = 0;
+    };
+
+    /// Moves on to the next frame, collecting the finished ones.
+    void AdvanceFrame();
+
+    /// Reads the timestamps of a finished frame and makes it available again.
+    void CollectFrame(Frame& frame);
+
+    /// Logs the most expensive passes since the last report.
+    void Report();
+
+    const Device& device;
+    MasterSemaphore& master_semaphore;
+    double timestamp_period;
+
+    std::array<Frame, NUM_FRAMES> frames;
+    size_t frame_index = 0;
+    bool is_pass_open = false;
+    bool is_frame_ended = false;   ///< The frame ends once its open pass does
+    bool is_frame_skipped = false; ///< Every query pool is in use, nothing is measured
+
+    std::vector<u64> timestamps;
+    std::unordered_map<PassKey, PassStats, PassKeyHash> stats;
+    u64 num_reported_frames = 0;
+};
+
+} // namespace Vulkan
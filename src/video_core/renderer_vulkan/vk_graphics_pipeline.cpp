@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <bit>
 #include <iostream>
 #include <span>
 #include <string_view>
@@ -15,6 +16,9 @@
 #include "video_core/renderer_vulkan/pipeline_helper.h"
 
 #include "common/bit_field.h"
+#include "common/hash.h"
+#include "common/profiler.h"
+#include "shader_recompiler/runtime_info.h"
 #include "video_core/renderer_vulkan/maxwell_to_vk.h"
 #include "video_core/renderer_vulkan/pipeline_statistics.h"
 #include "video_core/renderer_vulkan/vk_buffer_cache.h"
@@ -238,20 +242,72 @@ ConfigureFuncPtr ConfigureFunc(const std::array<vk::ShaderModule, NUM_STAGES>& m
     return FindSpec<SimpleVertexSpec, SimpleVertexFragmentSpec, SimpleStorageSpec, SimpleImageSpec,
                     DefaultSpec>(modules, infos);
 }
+
+/// Accumulates the state a pipeline library is built from, to find libraries that can be shared.
+class LibraryKey {
+public:
+    template <typename... Values>
+    void Add(Values... values) {
+        (words.push_back(static_cast<u64>(values)), ...);
+    }
+
+    void Add(f32 value) {
+        words.push_back(std::bit_cast<u32>(value));
+    }
+
+    [[nodiscard]] u64 Hash() const {
+        return Common::WyHash64(words.data(), words.size() * sizeof(u64));
+    }
+
+private:
+    small_vector<u64, 64> words;
+};
+
+VkGraphicsPipelineCreateInfo MakeLibraryCreateInfo(
+    VkGraphicsPipelineCreateInfo ci, const VkGraphicsPipelineLibraryCreateInfoEXT& library_ci,
+    std::span<const VkPipelineShaderStageCreateInfo> stages) {
+    ci.pNext = &library_ci;
+    ci.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR |
+                VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+    ci.stageCount = static_cast<u32>(stages.size());
+    ci.pStages = stages.empty() ? nullptr : stages.data();
+    return ci;
+}
 } // Anonymous namespace
 
+GraphicsPipelineLibraryCache::GraphicsPipelineLibraryCache(const Device& device_)
+    : device{device_} {}
+
+VkPipeline GraphicsPipelineLibraryCache::Get(u64 hash, const VkGraphicsPipelineCreateInfo& ci,
+                                             VkPipelineCache pipeline_cache) {
+    {
+        std::scoped_lock lock{mutex};
+        if (const auto it = libraries.find(hash); it != libraries.end()) {
+            return *it->second;
+        }
+    }
+    // Build outside of the lock, other workers may be building unrelated libraries.
+    // When two workers race for the same hash, the first one to finish is kept.
+    vk::Pipeline library = device.GetLogical().CreateGraphicsPipeline(ci, pipeline_cache);
+    std::scoped_lock lock{mutex};
+    return *libraries.try_emplace(hash, std::move(library)).first->second;
+}
+
 // TODO(crueter): This is the worst-formatted code I have EVER seen
 GraphicsPipeline::GraphicsPipeline(
     Scheduler& scheduler_, BufferCache& buffer_cache_, TextureCache& texture_cache_,
     vk::PipelineCache& pipeline_cache_, VideoCore::ShaderNotify* shader_notify,
     const Device& device_, DescriptorPool& descriptor_pool,
-    GuestDescriptorQueue& guest_descriptor_queue_, Common::ThreadWorker* worker_thread,
+    GuestDescriptorQueue& guest_descriptor_queue_, Common::PooledWorker* worker_thread,
     PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-    const GraphicsPipelineCacheKey& key_, std::array<vk::ShaderModule, NUM_STAGES> stages,
+    GraphicsPipelineLibraryCache* library_cache_, const GraphicsPipelineCacheKey& key_,
+    std::array<vk::ShaderModule, NUM_STAGES> stages,
+    const std::array<u64, NUM_STAGES>& code_hashes,
     const std::array<const Shader::Info*, NUM_STAGES>& infos)
     : key{key_}, device{device_}, texture_cache{texture_cache_}, buffer_cache{buffer_cache_},
       pipeline_cache(pipeline_cache_), scheduler{scheduler_},
-      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)} {
+      guest_descriptor_queue{guest_descriptor_queue_}, spv_modules{std::move(stages)},
+      spv_hashes{code_hashes}, library_cache{library_cache_} {
     if (shader_notify) {
         shader_notify->MarkShaderBuilding();
     }
@@ -265,23 +321,48 @@ GraphicsPipeline::GraphicsPipeline(
         std::ranges::copy(info->constant_buffer_used_sizes, uniform_buffer_sizes[stage].begin());
         num_textures += Shader::NumDescriptors(info->texture_descriptors);
     }
-    auto func{[this, shader_notify, &render_pass_cache, &descriptor_pool, pipeline_statistics] {
-        DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
-        uses_push_descriptor = builder.CanUsePushDescriptor();
-        descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
-
-        if (!uses_push_descriptor) {
-            descriptor_allocator = descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
+    DescriptorLayoutBuilder builder{MakeBuilder(device, stage_infos)};
+    uses_push_descriptor = builder.CanUsePushDescriptor();
+    if (!uses_push_descriptor && descriptor_pool.GetDescriptorBuffer() &&
+        builder.CanUseDescriptorBuffer()) {
+        // Draws write sets to the ring as soon as they are recorded, so the placement of the
+        // descriptors has to be known before the pipeline is built.
+        descriptor_buffer = descriptor_pool.GetDescriptorBuffer();
+        descriptor_set_layout = builder.CreateDescriptorSetLayout(false, true);
+        descriptor_buffer_layout = builder.CreateDescriptorBufferLayout(*descriptor_set_layout);
+    }
+    auto func{[this, builder, shader_notify, &render_pass_cache, &descriptor_pool,
+                pipeline_statistics, worker_thread] {
+        PROFILE_SCOPE("GraphicsPipeline::Build");
+        if (!descriptor_buffer) {
+            descriptor_set_layout = builder.CreateDescriptorSetLayout(uses_push_descriptor);
+            if (!uses_push_descriptor) {
+                descriptor_allocator =
+                    descriptor_pool.Allocator(*descriptor_set_layout, stage_infos);
+            }
         }
 
         const VkDescriptorSetLayout set_layout{*descriptor_set_layout};
         pipeline_layout = builder.CreatePipelineLayout(set_layout);
-        descriptor_update_template =
-            builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        if (!descriptor_buffer) {
+            descriptor_update_template =
+                builder.CreateTemplate(set_layout, *pipeline_layout, uses_push_descriptor);
+        }
 
         const VkRenderPass render_pass{render_pass_cache.Get(MakeRenderPassKey(key.state))};
+        // The rate of the foveation attachment replaces the pipeline one when it's bound
+        const VkPipelineFragmentShadingRateStateCreateInfoKHR shading_rate_ci{
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR,
+            .pNext = nullptr,
+            .fragmentSize{.width = 1, .height = 1},
+            .combinerOps{VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+                         VK_FRAGMENT_SHADING_RATE_COMBINER_OP_REPLACE_KHR},
+        };
+        const PipelineRenderingInfo rendering{
+            render_pass_cache, render_pass,
+            render_pass_cache.UsesFragmentShadingRate() ? &shading_rate_ci : nullptr};
         Validate();
-        MakePipeline(render_pass);
+        MakePipeline(rendering, worker_thread);
         if (pipeline_statistics) {
             pipeline_statistics->Collect(*pipeline);
         }
@@ -294,7 +375,8 @@ GraphicsPipeline::GraphicsPipeline(
         }
     }};
     if (worker_thread) {
-        worker_thread->QueueWork(std::move(func));
+        // Builds are asynchronous, so they yield to work a thread is blocked on
+        worker_thread->QueueWork(std::move(func), Common::WorkPriority::Normal);
     } else {
         func();
     }
@@ -514,13 +596,19 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
     const bool is_rescaling{texture_cache.IsRescaling()};
     const bool update_rescaling{scheduler.UpdateRescaling(is_rescaling)};
     const bool bind_pipeline{scheduler.UpdateGraphicsPipeline(this)};
-    const void* const descriptor_data{guest_descriptor_queue.UpdateData()};
-    scheduler.Record([this, descriptor_data, bind_pipeline, rescaling_data = rescaling.Data(),
+    const auto descriptor_entries{guest_descriptor_queue.UpdateEntries()};
+    VkDeviceSize descriptor_offset{};
+    if (descriptor_buffer) {
+        descriptor_offset =
+            descriptor_buffer->Write(descriptor_buffer_layout, descriptor_entries.data());
+    }
+    scheduler.Record([this, descriptor_entries, descriptor_offset, bind_pipeline,
+                      rescaling_data = rescaling.Data(),
                       is_rescaling, update_rescaling,
                       uses_render_area = render_area.uses_render_area,
                       render_area_data = render_area.words](vk::CommandBuffer cmdbuf) {
         if (bind_pipeline) {
-            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline);
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, BoundPipeline());
         }
         cmdbuf.PushConstants(*pipeline_layout, VK_SHADER_STAGE_ALL_GRAPHICS,
                              RESCALING_LAYOUT_WORDS_OFFSET, sizeof(rescaling_data),
@@ -540,20 +628,24 @@ void GraphicsPipeline::ConfigureDraw(const RescalingPushConstant& rescaling,
         if (!descriptor_set_layout) {
             return;
         }
-        if (uses_push_descriptor) {
+        if (descriptor_buffer) {
+            const u32 buffer_index{0};
+            cmdbuf.SetDescriptorBufferOffsetsEXT(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline_layout,
+                                                 0, buffer_index, descriptor_offset);
+        } else if (uses_push_descriptor) {
             cmdbuf.PushDescriptorSetWithTemplateKHR(*descriptor_update_template, *pipeline_layout,
-                                                    0, descriptor_data);
+                                                    0, descriptor_entries.data());
         } else {
-            const VkDescriptorSet descriptor_set{descriptor_allocator.Commit()};
-            const vk::Device& dev{device.GetLogical()};
-            dev.UpdateDescriptorSet(descriptor_set, *descriptor_update_template, descriptor_data);
+            const VkDescriptorSet descriptor_set{
+                descriptor_allocator.Commit(*descriptor_update_template, descriptor_entries)};
             cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, *pipeline_layout, 0,
                                       descriptor_set, nullptr);
         }
     });
 }
 
-void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
+void GraphicsPipeline::MakePipeline(const PipelineRenderingInfo& rendering,
+                                    Common::PooledWorker* worker_thread) {
     FixedPipelineState::DynamicState dynamic{};
     if (!key.state.extended_dynamic_state) {
         dynamic = key.state.dynamic_state;
@@ -894,13 +986,18 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
                 VK_DYNAMIC_STATE_CONSERVATIVE_RASTERIZATION_MODE_EXT,
 
                 VK_DYNAMIC_STATE_LINE_STIPPLE_ENABLE_EXT,
-                VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
-                VK_DYNAMIC_STATE_ALPHA_TO_ONE_ENABLE_EXT,
                 VK_DYNAMIC_STATE_DEPTH_CLIP_ENABLE_EXT,
                 VK_DYNAMIC_STATE_PROVOKING_VERTEX_MODE_EXT,
             };
             dynamic_states.insert(dynamic_states.end(), extended3.begin(), extended3.end());
         }
+        if (key.state.extended_dynamic_state_3_rasterization) {
+            static constexpr std::array extended3{
+                VK_DYNAMIC_STATE_POLYGON_MODE_EXT,
+                VK_DYNAMIC_STATE_ALPHA_TO_COVERAGE_ENABLE_EXT,
+            };
+            dynamic_states.insert(dynamic_states.end(), extended3.begin(), extended3.end());
+        }
     }
 
     const VkPipelineDynamicStateCreateInfo dynamic_state_ci{
@@ -915,6 +1012,29 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
         .pNext = nullptr,
         .requiredSubgroupSize = GuestWarpSize,
     };
+    // Entries for constants a module does not declare are ignored, all stages share them
+    const std::array<float, 2> specialization_data{
+        std::bit_cast<float>(key.state.alpha_test_ref),
+        std::bit_cast<float>(key.state.point_size),
+    };
+    const std::array<VkSpecializationMapEntry, 2> specialization_entries{{
+        {
+            .constantID = static_cast<u32>(Shader::SpecializationConstant::AlphaTestReference),
+            .offset = 0,
+            .size = sizeof(float),
+        },
+        {
+            .constantID = static_cast<u32>(Shader::SpecializationConstant::FixedStatePointSize),
+            .offset = sizeof(float),
+            .size = sizeof(float),
+        },
+    }};
+    const VkSpecializationInfo specialization_info{
+        .mapEntryCount = static_cast<u32>(specialization_entries.size()),
+        .pMapEntries = specialization_entries.data(),
+        .dataSize = sizeof(specialization_data),
+        .pData = specialization_data.data(),
+    };
     static_vector<VkPipelineShaderStageCreateInfo, 5> shader_stages;
     for (size_t stage = 0; stage < Maxwell::MaxShaderStage; ++stage) {
         if (!spv_modules[stage]) {
@@ -928,30 +1048,177 @@ void GraphicsPipeline::MakePipeline(VkRenderPass render_pass) {
                 .stage = MaxwellToVK::ShaderStage(Shader::StageFromIndex(stage)),
                 .module = *spv_modules[stage],
                 .pName = "main",
-                .pSpecializationInfo = nullptr,
+                .pSpecializationInfo = &specialization_info,
             });
     }
-    VkPipelineCreateFlags flags{};
+    VkPipelineCreateFlags flags{rendering.Flags()};
     if (device.IsKhrPipelineExecutablePropertiesEnabled() && Settings::values.renderer_debug.GetValue()) {
         flags |= VK_PIPELINE_CREATE_CAPTURE_STATISTICS_BIT_KHR;
     }
+    if (descriptor_buffer) {
+        flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
+
+    const VkGraphicsPipelineCreateInfo pipeline_ci{
+        .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = rendering.Next(),
+        .flags = flags,
+        .stageCount = static_cast<u32>(shader_stages.size()),
+        .pStages = shader_stages.data(),
+        .pVertexInputState = &vertex_input_ci,
+        .pInputAssemblyState = &input_assembly_ci,
+        .pTessellationState = &tessellation_ci,
+        .pViewportState = &viewport_ci,
+        .pRasterizationState = &rasterization_ci,
+        .pMultisampleState = &multisample_ci,
+        .pDepthStencilState = &depth_stencil_ci,
+        .pColorBlendState = &color_blend_ci,
+        .pDynamicState = &dynamic_state_ci,
+        .layout = *pipeline_layout,
+        .renderPass = rendering.RenderPass(),
+        .subpass = 0,
+        .basePipelineHandle = nullptr,
+        .basePipelineIndex = 0,
+    };
+    // Pipelines built synchronously are waited on anyway, there's no point in linking them first
+    if (!library_cache || !worker_thread) {
+        pipeline = device.GetLogical().CreateGraphicsPipeline(pipeline_ci, *pipeline_cache);
+        return;
+    }
+    // The pipeline layout depends on every stage, so shader libraries are only shared between
+    // pipelines with the same set of shaders.
+    LibraryKey common_key;
+    common_key.Add(std::bit_cast<u64>(rendering.Key()), flags);
+    for (const u64 hash : key.unique_hashes) {
+        common_key.Add(hash);
+    }
+    for (const u64 hash : spv_hashes) {
+        common_key.Add(hash);
+    }
+    for (const VkDynamicState state : dynamic_states) {
+        common_key.Add(state);
+    }
+    LibraryKey pre_raster_key{common_key};
+    pre_raster_key.Add(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+                       input_assembly_topology, tessellation_ci.patchControlPoints,
+                       viewport_ci.viewportCount, ndc_info.negativeOneToOne,
+                       rasterization_ci.depthClampEnable, rasterization_ci.rasterizerDiscardEnable,
+                       rasterization_ci.polygonMode, rasterization_ci.cullMode,
+                       rasterization_ci.frontFace, rasterization_ci.depthBiasEnable,
+                       line_state.lineRasterizationMode, line_state.stippledLineEnable,
+                       line_state.lineStippleFactor, line_state.lineStipplePattern,
+                       conservative_raster.conservativeRasterizationMode,
+                       provoking_vertex.provokingVertexMode,
+                       Settings::values.provoking_vertex.GetValue());
+    for (const u16 swizzle : key.state.viewport_swizzles) {
+        pre_raster_key.Add(swizzle);
+    }
+    // Specialized values are not part of the SPIR-V hashes
+    pre_raster_key.Add(key.state.point_size);
+    LibraryKey fragment_key{common_key};
+    fragment_key.Add(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+                     multisample_ci.rasterizationSamples, multisample_ci.sampleShadingEnable,
+                     multisample_ci.alphaToCoverageEnable, multisample_ci.alphaToOneEnable,
+                     depth_stencil_ci.depthTestEnable, depth_stencil_ci.depthWriteEnable,
+                     depth_stencil_ci.depthCompareOp, depth_stencil_ci.depthBoundsTestEnable,
+                     depth_stencil_ci.stencilTestEnable);
+    fragment_key.Add(key.state.alpha_test_ref);
+    fragment_key.Add(multisample_ci.minSampleShading);
+    fragment_key.Add(depth_stencil_ci.minDepthBounds);
+    fragment_key.Add(depth_stencil_ci.maxDepthBounds);
+    for (const VkStencilOpState& face : {depth_stencil_ci.front, depth_stencil_ci.back}) {
+        fragment_key.Add(face.failOp, face.passOp, face.depthFailOp, face.compareOp);
+    }
+    BuildLibraries(pipeline_ci, pre_raster_key.Hash(), fragment_key.Hash());
+
+    // Fast link what the first draws use, and replace it with an optimized link in the background
+    // once the pipelines draws are waiting for have been built
+    const VkRenderPass render_pass{rendering.RenderPass()};
+    pipeline = LinkLibraries(render_pass, flags);
+    worker_thread->QueueWork([this, render_pass, flags] {
+        try {
+            optimized_pipeline = LinkLibraries(
+                render_pass, flags | VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT);
+        } catch (const vk::Exception& exception) {
+            LOG_ERROR(Render_Vulkan, "Failed to optimize graphics pipeline: {}",
+                      exception.what());
+            return;
+        }
+        is_optimized.store(true, std::memory_order::release);
+    }, Common::WorkPriority::Low);
+}
+
+void GraphicsPipeline::BuildLibraries(const VkGraphicsPipelineCreateInfo& pipeline_ci,
+                                      u64 pre_raster_hash, u64 fragment_hash) {
+    static_vector<VkPipelineShaderStageCreateInfo, 5> pre_raster_stages;
+    static_vector<VkPipelineShaderStageCreateInfo, 1> fragment_stages;
+    for (const VkPipelineShaderStageCreateInfo& stage : std::span{pipeline_ci.pStages,
+                                                                  pipeline_ci.stageCount}) {
+        if (stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
+            fragment_stages.push_back(stage);
+        } else {
+            pre_raster_stages.push_back(stage);
+        }
+    }
+    // Keep the rest of the chain, it holds the attachment formats with dynamic rendering
+    const auto library_ci = [&pipeline_ci](VkGraphicsPipelineLibraryFlagsEXT part) {
+        return VkGraphicsPipelineLibraryCreateInfoEXT{
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+            .pNext = pipeline_ci.pNext,
+            .flags = part,
+        };
+    };
+    const auto vertex_input_ci =
+        library_ci(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT);
+    const auto pre_raster_ci =
+        library_ci(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT);
+    const auto fragment_ci = library_ci(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT);
+    const auto fragment_output_ci =
+        library_ci(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+
+    // The interface libraries hold the state most likely to change between pipelines,
+    // and they are cheap to build, so they are not shared.
+    const vk::Device& logical{device.GetLogical()};
+    vertex_input_library = logical.CreateGraphicsPipeline(
+        MakeLibraryCreateInfo(pipeline_ci, vertex_input_ci, {}), *pipeline_cache);
+    fragment_output_library = logical.CreateGraphicsPipeline(
+        MakeLibraryCreateInfo(pipeline_ci, fragment_output_ci, {}), *pipeline_cache);
+    libraries = {
+        *vertex_input_library,
+        library_cache->Get(pre_raster_hash,
+                           MakeLibraryCreateInfo(pipeline_ci, pre_raster_ci, pre_raster_stages),
+                           *pipeline_cache),
+        library_cache->Get(fragment_hash,
+                           MakeLibraryCreateInfo(pipeline_ci, fragment_ci, fragment_stages),
+                           *pipeline_cache),
+        *fragment_output_library,
+    };
+}
 
-    pipeline = device.GetLogical().CreateGraphicsPipeline(
+vk::Pipeline GraphicsPipeline::LinkLibraries(VkRenderPass render_pass,
+                                             VkPipelineCreateFlags flags) const {
+    const VkPipelineLibraryCreateInfoKHR library_ci{
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+        .pNext = nullptr,
+        .libraryCount = static_cast<u32>(libraries.size()),
+        .pLibraries = libraries.data(),
+    };
+    return device.GetLogical().CreateGraphicsPipeline(
         {
             .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
-            .pNext = nullptr,
+            .pNext = &library_ci,
             .flags = flags,
-            .stageCount = static_cast<u32>(shader_stages.size()),
-            .pStages = shader_stages.data(),
-            .pVertexInputState = &vertex_input_ci,
-            .pInputAssemblyState = &input_assembly_ci,
-            .pTessellationState = &tessellation_ci,
-            .pViewportState = &viewport_ci,
-            .pRasterizationState = &rasterization_ci,
-            .pMultisampleState = &multisample_ci,
-            .pDepthStencilState = &depth_stencil_ci,
-            .pColorBlendState = &color_blend_ci,
-            .pDynamicState = &dynamic_state_ci,
+            .stageCount = 0,
+            .pStages = nullptr,
+            .pVertexInputState = nullptr,
+            .pInputAssemblyState = nullptr,
+            .pTessellationState = nullptr,
+            .pViewportState = nullptr,
+            .pRasterizationState = nullptr,
+            .pMultisampleState = nullptr,
+            .pDepthStencilState = nullptr,
+            .pColorBlendState = nullptr,
+            .pDynamicState = nullptr,
             .layout = *pipeline_layout,
             .renderPass = render_pass,
             .subpass = 0,
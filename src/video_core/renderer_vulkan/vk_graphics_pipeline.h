@@ -12,8 +12,9 @@
 #include <condition_variable>
 #include <mutex>
 #include <type_traits>
+#include <unordered_map>
 
-#include "common/thread_worker.h"
+#include "common/thread_pool.h"
 #include "shader_recompiler/shader_info.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_vulkan/fixed_pipeline_state.h"
@@ -62,12 +63,34 @@ struct hash<Vulkan::GraphicsPipelineCacheKey> {
 namespace Vulkan {
 
 class Device;
+class PipelineRenderingInfo;
 class PipelineStatistics;
 class RenderPassCache;
 class RescalingPushConstant;
 class RenderAreaPushConstant;
 class Scheduler;
 
+/**
+ * Shares the shader stages of VK_EXT_graphics_pipeline_library between pipelines.
+ *
+ * Pipelines that only differ in the state consumed by the vertex input and fragment output
+ * interfaces link the same pre-rasterization and fragment shader libraries, which is fast enough
+ * to do before the first draw.
+ */
+class GraphicsPipelineLibraryCache {
+public:
+    explicit GraphicsPipelineLibraryCache(const Device& device);
+
+    /// Returns the library of the given hash, building it from ci when it doesn't exist yet.
+    [[nodiscard]] VkPipeline Get(u64 hash, const VkGraphicsPipelineCreateInfo& ci,
+                                 VkPipelineCache pipeline_cache);
+
+private:
+    const Device& device;
+    std::mutex mutex;
+    std::unordered_map<u64, vk::Pipeline> libraries;
+};
+
 class GraphicsPipeline {
     static constexpr size_t NUM_STAGES = Tegra::Engines::Maxwell3D::Regs::MaxShaderStage;
 
@@ -76,9 +99,11 @@ public:
         Scheduler& scheduler, BufferCache& buffer_cache, TextureCache& texture_cache,
         vk::PipelineCache& pipeline_cache, VideoCore::ShaderNotify* shader_notify,
         const Device& device, DescriptorPool& descriptor_pool,
-        GuestDescriptorQueue& guest_descriptor_queue, Common::ThreadWorker* worker_thread,
+        GuestDescriptorQueue& guest_descriptor_queue, Common::PooledWorker* worker_thread,
         PipelineStatistics* pipeline_statistics, RenderPassCache& render_pass_cache,
-        const GraphicsPipelineCacheKey& key, std::array<vk::ShaderModule, NUM_STAGES> stages,
+        GraphicsPipelineLibraryCache* library_cache, const GraphicsPipelineCacheKey& key,
+        std::array<vk::ShaderModule, NUM_STAGES> stages,
+        const std::array<u64, NUM_STAGES>& code_hashes,
         const std::array<const Shader::Info*, NUM_STAGES>& infos);
 
     bool HasDynamicVertexInput() const noexcept { return key.state.dynamic_vertex_input; }
@@ -103,6 +128,10 @@ public:
                                            : nullptr;
     }
 
+    [[nodiscard]] const GraphicsPipelineCacheKey& Key() const noexcept {
+        return key;
+    }
+
     [[nodiscard]] bool IsBuilt() const noexcept {
         return is_built.load(std::memory_order::relaxed);
     }
@@ -124,7 +153,18 @@ private:
     void ConfigureDraw(const RescalingPushConstant& rescaling,
                        const RenderAreaPushConstant& render_are);
 
-    void MakePipeline(VkRenderPass render_pass);
+    void MakePipeline(const PipelineRenderingInfo& rendering,
+                      Common::PooledWorker* worker_thread);
+
+    void BuildLibraries(const VkGraphicsPipelineCreateInfo& pipeline_ci, u64 pre_raster_hash,
+                        u64 fragment_hash);
+
+    [[nodiscard]] vk::Pipeline LinkLibraries(VkRenderPass render_pass,
+                                             VkPipelineCreateFlags flags) const;
+
+    [[nodiscard]] VkPipeline BoundPipeline() const noexcept {
+        return is_optimized.load(std::memory_order::acquire) ? *optimized_pipeline : *pipeline;
+    }
 
     void Validate();
 
@@ -144,6 +184,8 @@ private:
     std::vector<GraphicsPipeline*> transitions;
 
     std::array<vk::ShaderModule, NUM_STAGES> spv_modules;
+    std::array<u64, NUM_STAGES> spv_hashes;
+    GraphicsPipelineLibraryCache* library_cache;
 
     std::array<Shader::Info, NUM_STAGES> stage_infos;
     std::array<u32, 5> enabled_uniform_buffer_masks{};
@@ -154,8 +196,17 @@ private:
     DescriptorAllocator descriptor_allocator;
     vk::PipelineLayout pipeline_layout;
     vk::DescriptorUpdateTemplate descriptor_update_template;
+    DescriptorBuffer* descriptor_buffer{};
+    DescriptorBufferLayout descriptor_buffer_layout;
     vk::Pipeline pipeline;
 
+    // Set when the pipeline was fast linked from libraries, until it's replaced by an optimized one
+    vk::Pipeline vertex_input_library;
+    vk::Pipeline fragment_output_library;
+    std::array<VkPipeline, 4> libraries{};
+    vk::Pipeline optimized_pipeline;
+    std::atomic_bool is_optimized{false};
+
     std::condition_variable build_condvar;
     std::mutex build_mutex;
     std::atomic_bool is_built{false};
@@ -4,6 +4,7 @@
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
 #include <thread>
 
 #include <ranges>
@@ -16,6 +17,9 @@ namespace Vulkan {
 
 constexpr u64 FENCE_RESERVE_SIZE = 8;
 
+/// Tick of the submission recorded by the current thread, zero when it isn't recording one
+thread_local u64 recording_tick = 0;
+
 MasterSemaphore::MasterSemaphore(const Device& device_) : device(device_) {
     if (!device.HasTimelineSemaphore()) {
         static constexpr VkFenceCreateInfo fence_ci{
@@ -39,6 +43,14 @@ MasterSemaphore::MasterSemaphore(const Device& device_) : device(device_) {
         .flags = 0,
     };
     semaphore = device.GetLogical().CreateSemaphore(semaphore_ci);
+    if (device.HasAsyncComputeQueue()) {
+        async_timelines[static_cast<size_t>(AsyncQueue::Compute)].semaphore =
+            device.GetLogical().CreateSemaphore(semaphore_ci);
+    }
+    if (device.HasTransferQueue()) {
+        async_timelines[static_cast<size_t>(AsyncQueue::Transfer)].semaphore =
+            device.GetLogical().CreateSemaphore(semaphore_ci);
+    }
 
     if (!Settings::values.renderer_debug) {
         return;
@@ -58,6 +70,14 @@ MasterSemaphore::MasterSemaphore(const Device& device_) : device(device_) {
 
 MasterSemaphore::~MasterSemaphore() = default;
 
+u64 MasterSemaphore::RecordingTick() const noexcept {
+    return recording_tick != 0 ? recording_tick : CurrentTick();
+}
+
+void MasterSemaphore::SetRecordingTick(u64 tick) noexcept {
+    recording_tick = tick;
+}
+
 void MasterSemaphore::Refresh() {
     if (!semaphore) {
         // If we don't support timeline semaphores, there's nothing to refresh
@@ -79,8 +99,10 @@ void MasterSemaphore::Refresh() {
 void MasterSemaphore::Wait(u64 tick) {
     if (!semaphore) {
         // If we don't support timeline semaphores, wait for the value normally
+        const auto wait_start = std::chrono::steady_clock::now();
         std::unique_lock lk{free_mutex};
         free_cv.wait(lk, [&] { return gpu_tick.load(std::memory_order_relaxed) >= tick; });
+        AccountWait(wait_start);
         return;
     }
 
@@ -97,21 +119,33 @@ void MasterSemaphore::Wait(u64 tick) {
     }
 
     // If none of the above is hit, fallback to a regular wait
+    const auto wait_start = std::chrono::steady_clock::now();
     while (!semaphore.Wait(tick)) {
     }
+    AccountWait(wait_start);
 
     Refresh();
 }
 
+void MasterSemaphore::AccountWait(std::chrono::steady_clock::time_point wait_start) {
+    const auto waited = std::chrono::steady_clock::now() - wait_start;
+    waited_ns.fetch_add(
+        static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()),
+        std::memory_order_relaxed);
+}
+
 VkResult MasterSemaphore::SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                                       VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
                                       u64 host_tick) {
-    if (semaphore) {
-        return SubmitQueueTimeline(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore,
-                                   host_tick);
-    } else {
-        return SubmitQueueFence(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore, host_tick);
+    const VkResult result =
+        semaphore ? SubmitQueueTimeline(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore,
+                                        host_tick)
+                  : SubmitQueueFence(cmdbuf, upload_cmdbuf, signal_semaphore, wait_semaphore,
+                                     host_tick);
+    if (result == VK_SUCCESS) {
+        submitted_tick.store(host_tick, std::memory_order_release);
     }
+    return result;
 }
 
 static constexpr std::array<VkPipelineStageFlags, 2> wait_stage_masks{
@@ -119,6 +153,13 @@ static constexpr std::array<VkPipelineStageFlags, 2> wait_stage_masks{
     VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
 };
 
+static constexpr std::array<VkPipelineStageFlags, NUM_ASYNC_QUEUES + 1>
+    timeline_wait_stage_masks{
+    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+};
+
 VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
                                               vk::CommandBuffer& upload_cmdbuf,
                                               VkSemaphore signal_semaphore,
@@ -131,20 +172,33 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
 
     const std::array cmdbuffers{*upload_cmdbuf, *cmdbuf};
 
-    const u32 num_wait_semaphores = wait_semaphore ? 1 : 0;
+    u32 num_wait_semaphores = 0;
+    std::array<VkSemaphore, NUM_ASYNC_QUEUES + 1> wait_semaphores{};
+    std::array<u64, NUM_ASYNC_QUEUES + 1> wait_values{}; // binary waits ignore their value
+    if (wait_semaphore) {
+        wait_semaphores[num_wait_semaphores++] = wait_semaphore;
+    }
+    // Wait for the async work recorded before this submission
+    for (AsyncTimeline& timeline : async_timelines) {
+        const u64 last_tick = timeline.tick.load(std::memory_order_acquire);
+        if (last_tick > timeline.waited_tick) {
+            timeline.waited_tick = last_tick;
+            wait_values[num_wait_semaphores] = last_tick;
+            wait_semaphores[num_wait_semaphores++] = *timeline.semaphore;
+        }
+    }
     // Pointers must be null when the count is zero (best-practices)
     const VkSemaphore* p_wait_sems =
-        (num_wait_semaphores > 0) ? &wait_semaphore : nullptr;
+        (num_wait_semaphores > 0) ? wait_semaphores.data() : nullptr;
     const VkPipelineStageFlags* p_wait_masks =
-        (num_wait_semaphores > 0) ? wait_stage_masks.data() : nullptr;
+        (num_wait_semaphores > 0) ? timeline_wait_stage_masks.data() : nullptr;
     const VkSemaphore* p_signal_sems =
         (num_signal_semaphores > 0) ? signal_semaphores.data() : nullptr;
-    const u64 wait_zero = 0; // dummy for binary wait
     const VkTimelineSemaphoreSubmitInfo timeline_si{
         .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
         .pNext = nullptr,
         .waitSemaphoreValueCount = num_wait_semaphores,
-        .pWaitSemaphoreValues    = num_wait_semaphores ? &wait_zero : nullptr,
+        .pWaitSemaphoreValues    = num_wait_semaphores ? wait_values.data() : nullptr,
         .signalSemaphoreValueCount = num_signal_semaphores,
         .pSignalSemaphoreValues = signal_values.data(),
     };
@@ -163,6 +217,39 @@ VkResult MasterSemaphore::SubmitQueueTimeline(vk::CommandBuffer& cmdbuf,
     return device.GetGraphicsQueue().Submit(submit_info);
 }
 
+VkResult MasterSemaphore::SubmitAsync(AsyncQueue queue, vk::CommandBuffer& cmdbuf) {
+    AsyncTimeline& timeline = async_timelines[static_cast<size_t>(queue)];
+    const u64 tick = timeline.tick.load(std::memory_order_relaxed) + 1;
+    const VkSemaphore signal_semaphore = *timeline.semaphore;
+    const VkCommandBuffer cmdbuffer = *cmdbuf;
+    const VkTimelineSemaphoreSubmitInfo timeline_si{
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreValueCount = 0,
+        .pWaitSemaphoreValues = nullptr,
+        .signalSemaphoreValueCount = 1,
+        .pSignalSemaphoreValues = &tick,
+    };
+    const VkSubmitInfo submit_info{
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = &timeline_si,
+        .waitSemaphoreCount = 0,
+        .pWaitSemaphores = nullptr,
+        .pWaitDstStageMask = nullptr,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &cmdbuffer,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores = &signal_semaphore,
+    };
+    const vk::Queue vk_queue = queue == AsyncQueue::Compute ? device.GetComputeQueue()
+                                                             : device.GetTransferQueue();
+    const VkResult result = vk_queue.Submit(submit_info);
+    if (result == VK_SUCCESS) {
+        timeline.tick.store(tick, std::memory_order_release);
+    }
+    return result;
+}
+
 VkResult MasterSemaphore::SubmitQueueFence(vk::CommandBuffer& cmdbuf,
                                            vk::CommandBuffer& upload_cmdbuf,
                                            VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
@@ -1,9 +1,14 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
@@ -18,6 +23,13 @@ namespace Vulkan {
 
 class Device;
 
+/// Queues executing work alongside the graphics queue.
+enum class AsyncQueue : u32 {
+    Compute,
+    Transfer,
+};
+constexpr size_t NUM_ASYNC_QUEUES = 2;
+
 class MasterSemaphore {
     using Waitable = std::pair<u64, vk::Fence>;
 
@@ -40,6 +52,14 @@ public:
         return KnownGpuTick() >= tick;
     }
 
+    /// Returns the tick of the submission the calling thread is recording, the current tick for
+    /// threads that aren't recording one. Scheduler workers record submissions ahead of the
+    /// current tick, resources committed by them are in use until their own submission completes.
+    [[nodiscard]] u64 RecordingTick() const noexcept;
+
+    /// Sets the tick of the submission recorded by the calling thread, zero to clear it.
+    static void SetRecordingTick(u64 tick) noexcept;
+
     /// Advance to the logical tick and return the old one
     [[nodiscard]] u64 NextTick() noexcept {
         return current_tick.fetch_add(1, std::memory_order_release);
@@ -48,6 +68,17 @@ public:
     /// Refresh the known GPU tick
     void Refresh();
 
+    /// Returns true when the GPU has finished every graphics queue submission.
+    [[nodiscard]] bool IsIdle() {
+        Refresh();
+        return IsFree(submitted_tick.load(std::memory_order_acquire));
+    }
+
+    /// Returns the time the host has spent blocked on the GPU in Wait, in nanoseconds.
+    [[nodiscard]] u64 WaitedNanoseconds() const noexcept {
+        return waited_ns.load(std::memory_order_relaxed);
+    }
+
     /// Waits for a tick to be hit on the GPU
     void Wait(u64 tick);
 
@@ -55,6 +86,9 @@ public:
     VkResult SubmitQueue(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                          VkSemaphore signal_semaphore, VkSemaphore wait_semaphore, u64 host_tick);
 
+    /// Submits to an async queue of the device, the next graphics submission waits for it
+    VkResult SubmitAsync(AsyncQueue queue, vk::CommandBuffer& cmdbuf);
+
 private:
     VkResult SubmitQueueTimeline(vk::CommandBuffer& cmdbuf, vk::CommandBuffer& upload_cmdbuf,
                                  VkSemaphore signal_semaphore, VkSemaphore wait_semaphore,
@@ -65,13 +99,24 @@ private:
 
     void WaitThread(std::stop_token token);
 
+    /// Adds the time elapsed since wait_start to the time spent blocked on the GPU.
+    void AccountWait(std::chrono::steady_clock::time_point wait_start);
+
     vk::Fence GetFreeFence();
 
 private:
-    const Device& device;             ///< Device.
-    vk::Semaphore semaphore;          ///< Timeline semaphore.
-    std::atomic<u64> gpu_tick{0};     ///< Current known GPU tick.
-    std::atomic<u64> current_tick{1}; ///< Current logical tick.
+    struct AsyncTimeline {
+        vk::Semaphore semaphore;  ///< Timeline semaphore of the queue.
+        std::atomic<u64> tick{0}; ///< Last submitted tick.
+        u64 waited_tick{0};       ///< Last tick waited by the graphics queue.
+    };
+
+    const Device& device;               ///< Device.
+    vk::Semaphore semaphore;            ///< Timeline semaphore.
+    std::atomic<u64> gpu_tick{0};       ///< Current known GPU tick.
+    std::atomic<u64> current_tick{1};   ///< Current logical tick.
+    std::atomic<u64> submitted_tick{0}; ///< Last tick submitted to the graphics queue.
+    std::atomic<u64> waited_ns{0};      ///< Time spent blocked in Wait.
     std::mutex wait_mutex;
     std::mutex free_mutex;
     std::condition_variable free_cv;
@@ -80,6 +125,7 @@ private:
     std::deque<vk::Fence> free_queue; ///< Holds available fences for submission.
     std::jthread debug_thread;        ///< Debug thread to workaround validation layer bugs.
     std::jthread wait_thread;         ///< Helper thread that waits for submitted fences.
+    std::array<AsyncTimeline, NUM_ASYNC_QUEUES> async_timelines;
 };
 
 } // namespace Vulkan
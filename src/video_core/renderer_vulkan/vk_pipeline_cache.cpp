@@ -12,17 +12,22 @@
 #include <thread>
 #include <vector>
 #include <bit>
+#include <cstring>
 #include <numeric>
-#include "common/cityhash.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
-#include "common/thread_worker.h"
+#include "common/hash.h"
+#include "common/hex_util.h"
+#include "common/thread_pool.h"
+#include "common/unique_function.h"
 #include "core/core.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
 #include "shader_recompiler/environment.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
 #include "shader_recompiler/frontend/maxwell/translate_program.h"
 #include "shader_recompiler/program_header.h"
+#include "video_core/dirty_flags.h"
+#include "video_core/engines/draw_manager.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/memory_manager.h"
@@ -55,7 +60,7 @@ using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
 
-constexpr u32 CACHE_VERSION = 13;
+constexpr u32 CACHE_VERSION = 16;
 constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
 
 template <typename Container>
@@ -143,11 +148,50 @@ Shader::AttributeType AttributeType(const FixedPipelineState& state, size_t inde
     return Shader::AttributeType::Disabled;
 }
 
+u64 ShadersHash(const std::array<u64, Maxwell::MaxShaderProgram>& unique_hashes) {
+    return Common::WyHash64(unique_hashes.data(), sizeof(unique_hashes));
+}
+
+/// Returns true when a pipeline built for the fallback state renders to the same attachments
+/// and channels with the same topology and vertex layout as one built for state. The rest of the
+/// state, like blending and depth testing, only changes how the draw looks.
+bool IsFallbackCompatible(const FixedPipelineState& state, const FixedPipelineState& fallback) {
+    if (state.raw1 != fallback.raw1 || state.depth_enabled != fallback.depth_enabled ||
+        state.depth_format != fallback.depth_format || state.y_negate != fallback.y_negate ||
+        state.color_formats != fallback.color_formats) {
+        return false;
+    }
+    // Write masks are baked into the pipeline without dynamic blend state, a fallback writing
+    // other channels would overwrite data the draw keeps
+    if (!state.extended_dynamic_state_3_blend) {
+        for (size_t index = 0; index < state.attachments.size(); ++index) {
+            if (state.attachments[index].Mask() != fallback.attachments[index].Mask()) {
+                return false;
+            }
+        }
+    }
+    if (state.xfb_enabled &&
+        std::memcmp(&state.xfb_state, &fallback.xfb_state, sizeof(state.xfb_state)) != 0) {
+        return false;
+    }
+    if (state.dynamic_vertex_input) {
+        return state.attribute_types == fallback.attribute_types;
+    }
+    if (state.enabled_divisors != fallback.enabled_divisors ||
+        std::memcmp(state.attributes.data(), fallback.attributes.data(),
+                    sizeof(state.attributes)) != 0 ||
+        state.binding_divisors != fallback.binding_divisors) {
+        return false;
+    }
+    return state.extended_dynamic_state || state.vertex_strides == fallback.vertex_strides;
+}
+
 Shader::RuntimeInfo MakeRuntimeInfo(std::span<const Shader::IR::Program> programs,
                                     const GraphicsPipelineCacheKey& key,
                                     const Shader::IR::Program& program,
                                     const Shader::IR::Program* previous_program) {
     Shader::RuntimeInfo info;
+    info.specialize_fixed_state = true;
     if (previous_program) {
         info.previous_stage_stores = previous_program->info.stores;
         info.previous_stage_legacy_stores_mapping = previous_program->info.legacy_stores_mapping;
@@ -280,10 +324,18 @@ size_t GetTotalPipelineWorkers() {
 #endif
 }
 
+/// Pools of the calling pipeline worker, reused from one build to the next instead of allocating
+/// the instructions and blocks of every shader from scratch.
+ShaderPools& GetWorkerPools() {
+    thread_local ShaderPools worker_pools;
+    worker_pools.ReleaseContents();
+    return worker_pools;
+}
+
 } // Anonymous namespace
 
 size_t ComputePipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), sizeof *this);
+    const u64 hash = Common::WyHash64(this, sizeof *this);
     return static_cast<size_t>(hash);
 }
 
@@ -292,7 +344,7 @@ bool ComputePipelineCacheKey::operator==(const ComputePipelineCacheKey& rhs) con
 }
 
 size_t GraphicsPipelineCacheKey::Hash() const noexcept {
-    const u64 hash = Common::CityHash64(reinterpret_cast<const char*>(this), Size());
+    const u64 hash = Common::WyHash64(this, Size());
     return static_cast<size_t>(hash);
 }
 
@@ -313,9 +365,14 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
       use_asynchronous_shaders{Settings::values.use_asynchronous_shaders.GetValue()},
       use_vulkan_pipeline_cache{Settings::values.use_vulkan_driver_pipeline_cache.GetValue()},
       optimize_spirv_output{Settings::values.optimize_spirv_output.GetValue() != Settings::SpirvOptimizeMode::Never},
-      workers(device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers(),
-              "VkPipelineBuilder"),
-      serialization_thread(1, "VkPipelineSerialization") {
+      workers(Common::ThreadPool::Shared(Settings::values.core_type_affinity.GetValue()
+                                             ? Common::CoreType::Efficiency
+                                             : Common::CoreType::Any),
+              device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers()),
+      serialization_thread(Common::ThreadPool::Shared(Common::CoreType::Any), 1) {
+    if (device.IsExtGraphicsPipelineLibrarySupported()) {
+        library_cache.emplace(device);
+    }
     const auto& float_control{device.FloatControlProperties()};
     const VkDriverId driver_id{device.GetDriverID()};
     profile = Shader::Profile{
@@ -410,8 +467,16 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
         .has_extended_dynamic_state_2_extra = device.IsExtExtendedDynamicState2ExtrasSupported(),
         .has_extended_dynamic_state_3_blend = device.IsExtExtendedDynamicState3BlendingSupported(),
         .has_extended_dynamic_state_3_enables = device.IsExtExtendedDynamicState3EnablesSupported(),
+        .has_extended_dynamic_state_3_rasterization =
+            device.IsExtExtendedDynamicState3RasterizationSupported(),
         .has_dynamic_vertex_input = device.IsExtVertexInputDynamicStateSupported(),
     };
+    // States set dynamically are left out of the pipeline keys, collapsing their permutations
+    LOG_INFO(Render_Vulkan,
+             "Dynamic pipeline state: blending {}, enables {}, rasterization modes {}",
+             dynamic_features.has_extended_dynamic_state_3_blend,
+             dynamic_features.has_extended_dynamic_state_3_enables,
+             dynamic_features.has_extended_dynamic_state_3_rasterization);
 }
 
 PipelineCache::~PipelineCache() {
@@ -422,6 +487,11 @@ PipelineCache::~PipelineCache() {
 }
 
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipeline() {
+    if (current_pipeline && IsGraphicsKeyCurrent()) {
+        // The key would be rebuilt to the same value, skip refreshing and looking it up
+        return BuiltPipeline(current_pipeline);
+    }
+    graphics_key_state.maxwell3d = nullptr;
 
     if (!RefreshStages(graphics_key.unique_hashes)) {
         current_pipeline = nullptr;
@@ -433,12 +503,33 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipeline() {
         GraphicsPipeline* const next{current_pipeline->Next(graphics_key)};
         if (next) {
             current_pipeline = next;
+            MarkGraphicsKeyCurrent();
             return BuiltPipeline(current_pipeline);
         }
     }
     return CurrentGraphicsPipelineSlowPath();
 }
 
+bool PipelineCache::IsGraphicsKeyCurrent() const noexcept {
+    // Register writes besides draw parameters and constant buffer uploads bump the state
+    // generation, the only draw parameters in the key are the topology and the engine hint.
+    // Shaders can also be marked dirty by HLE macros and state invalidations.
+    return graphics_key_state.maxwell3d == maxwell3d &&
+           graphics_key_state.generation == maxwell3d->dirty.state_generation &&
+           graphics_key_state.topology == maxwell3d->draw_manager->GetDrawState().topology &&
+           graphics_key_state.engine_state == maxwell3d->engine_state &&
+           !maxwell3d->dirty.flags[VideoCommon::Dirty::Shaders];
+}
+
+void PipelineCache::MarkGraphicsKeyCurrent() noexcept {
+    graphics_key_state = {
+        .maxwell3d = maxwell3d,
+        .generation = maxwell3d->dirty.state_generation,
+        .topology = maxwell3d->draw_manager->GetDrawState().topology,
+        .engine_state = maxwell3d->engine_state,
+    };
+}
+
 ComputePipeline* PipelineCache::CurrentComputePipeline() {
 
     const ShaderInfo* const shader{ComputeShader()};
@@ -474,7 +565,15 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     pipeline_cache_filename = base_dir / "vulkan.bin";
 
     if (use_vulkan_pipeline_cache) {
-        vulkan_pipeline_cache_filename = base_dir / "vulkan_pipelines.bin";
+        // Keep one driver cache per driver build, so switching between drivers doesn't throw away
+        // the pipelines built by the other one.
+        const auto legacy_filename{base_dir / "vulkan_pipelines.bin"};
+        if (Common::FS::Exists(legacy_filename)) {
+            (void)Common::FS::RemoveFile(legacy_filename);
+        }
+        vulkan_pipeline_cache_filename =
+            base_dir / fmt::format("vulkan_pipelines_{}.bin",
+                                   Common::HexToString(device.GetPipelineCacheUUID(), false));
         vulkan_pipeline_cache =
             LoadVulkanPipelineCache(vulkan_pipeline_cache_filename, CACHE_VERSION);
     }
@@ -490,13 +589,16 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         state.statistics = std::make_unique<PipelineStatistics>(device);
     }
+    // Pipelines are appended to the cache as they are first seen, build them from the end of the
+    // file so the most recently used ones are ready first.
+    std::vector<Common::UniqueFunction<void>> build_tasks;
     const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
         ComputePipelineCacheKey key;
         file.read(reinterpret_cast<char*>(&key), sizeof(key));
 
-        workers.QueueWork([this, key, env_ = std::move(env), &state, &callback]() mutable {
-            ShaderPools pools;
-            auto pipeline{CreateComputePipeline(pools, key, env_, state.statistics.get(), false)};
+        build_tasks.emplace_back([this, key, env_ = std::move(env), &state, &callback]() mutable {
+            auto pipeline{CreateComputePipeline(GetWorkerPools(), key, env_,
+                                                state.statistics.get(), false)};
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
                 compute_cache.emplace(key, std::move(pipeline));
@@ -522,20 +624,22 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
                 dynamic_features.has_extended_dynamic_state_3_blend ||
             (key.state.extended_dynamic_state_3_enables != 0) !=
                 dynamic_features.has_extended_dynamic_state_3_enables ||
+            (key.state.extended_dynamic_state_3_rasterization != 0) !=
+                dynamic_features.has_extended_dynamic_state_3_rasterization ||
             (key.state.dynamic_vertex_input != 0) != dynamic_features.has_dynamic_vertex_input) {
             return;
         }
-        workers.QueueWork([this, key, envs_ = std::move(envs), &state, &callback]() mutable {
-            ShaderPools pools;
+        build_tasks.emplace_back([this, key, envs_ = std::move(envs), &state, &callback]() mutable {
             boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
             for (auto& env : envs_) {
                 env_ptrs.push_back(&env);
             }
-            auto pipeline{CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
+            auto pipeline{CreateGraphicsPipeline(GetWorkerPools(), key, MakeSpan(env_ptrs),
                                                  state.statistics.get(), false)};
 
             std::scoped_lock lock{state.mutex};
             if (pipeline) {
+                pipelines_by_shaders[ShadersHash(key.unique_hashes)].push_back(pipeline.get());
                 graphics_cache.emplace(key, std::move(pipeline));
             }
             ++state.built;
@@ -555,6 +659,11 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     state.has_loaded = true;
     lock.unlock();
 
+    for (auto it = build_tasks.rbegin(); it != build_tasks.rend(); ++it) {
+        workers.QueueWork(std::move(*it));
+    }
+    build_tasks.clear();
+
     workers.WaitForRequests(stop_loading);
 
     if (use_vulkan_pipeline_cache) {
@@ -576,6 +685,10 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
     auto& pipeline{pair->second};
     if (is_new) {
         pipeline = CreateGraphicsPipeline();
+        if (pipeline) {
+            pipelines_by_shaders[ShadersHash(graphics_key.unique_hashes)].push_back(
+                pipeline.get());
+        }
     }
     if (!pipeline) {
         return nullptr;
@@ -584,6 +697,7 @@ GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
         current_pipeline->AddTransition(pipeline.get());
     }
     current_pipeline = pipeline.get();
+    MarkGraphicsKeyCurrent();
     return BuiltPipeline(current_pipeline);
 }
 
@@ -601,6 +715,19 @@ GraphicsPipeline* PipelineCache::BuiltPipeline(GraphicsPipeline* pipeline) const
     if (draw_state.index_buffer.count <= 6 || draw_state.vertex_buffer.count <= 6) {
         return pipeline;
     }
+    // Draw with a built pipeline of the same shaders that only differs in how the result looks,
+    // instead of skipping the draw until this one is ready
+    const auto it{pipelines_by_shaders.find(ShadersHash(pipeline->Key().unique_hashes))};
+    if (it == pipelines_by_shaders.end()) {
+        return nullptr;
+    }
+    for (GraphicsPipeline* const fallback : it->second) {
+        if (fallback != pipeline && fallback->IsBuilt() &&
+            fallback->Key().unique_hashes == pipeline->Key().unique_hashes &&
+            IsFallbackCompatible(pipeline->Key().state, fallback->Key().state)) {
+            return fallback;
+        }
+    }
     return nullptr;
 }
 
@@ -655,6 +782,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     }
     std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
     std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
+    std::array<u64, Maxwell::MaxShaderStage> code_hashes{};
 
     const Shader::IR::Program* previous_stage{};
     Shader::Backend::Bindings binding;
@@ -676,17 +804,18 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
         const std::vector<u32> code{EmitSPIRV(profile, runtime_info, program, binding, this->optimize_spirv_output)};
         device.SaveShader(code);
         modules[stage_index] = BuildShader(device, code);
+        code_hashes[stage_index] = Common::WyHash64(code.data(), code.size() * sizeof(u32));
         if (device.HasDebuggingToolAttached()) {
             const std::string name{fmt::format("Shader {:016x}", key.unique_hashes[index])};
             modules[stage_index].SetObjectNameEXT(name.c_str());
         }
         previous_stage = &program;
     }
-    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    Common::PooledWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
-        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
-        std::move(modules), infos);
+        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache,
+        library_cache ? &*library_cache : nullptr, key, std::move(modules), code_hashes, infos);
 
 } catch (const Shader::Exception& exception) {
     auto hash = key.Hash();
@@ -774,7 +903,7 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
         const auto name{fmt::format("Shader {:016x}", key.unique_hash)};
         spv_module.SetObjectNameEXT(name.c_str());
     }
-    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    Common::PooledWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<ComputePipeline>(device, vulkan_pipeline_cache, descriptor_pool,
                                              guest_descriptor_queue, thread_worker, statistics,
                                              &shader_notify, program.info, std::move(spv_module));
@@ -863,6 +992,21 @@ vk::PipelineCache PipelineCache::LoadVulkanPipelineCache(const std::filesystem::
         std::vector<char> cache_data(cache_size);
         file.read(cache_data.data(), cache_size);
 
+        // Some drivers crash instead of rejecting data from a different device or driver build,
+        // validate the header before handing the blob over.
+        VkPipelineCacheHeaderVersionOne header{};
+        if (cache_size >= sizeof(header)) {
+            std::memcpy(&header, cache_data.data(), sizeof(header));
+        }
+        const auto uuid{device.GetPipelineCacheUUID()};
+        if (cache_size < sizeof(header) ||
+            header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+            header.vendorID != device.GetVendorID() || header.deviceID != device.GetDeviceID() ||
+            !std::equal(uuid.begin(), uuid.end(), std::begin(header.pipelineCacheUUID))) {
+            LOG_INFO(Render_Vulkan, "Discarding Vulkan driver pipeline cache from another driver");
+            return create_pipeline_cache(0, nullptr);
+        }
+
         LOG_INFO(Render_Vulkan,
                  "Loaded Vulkan driver pipeline cache: ", Common::FS::PathToUTF8String(filename));
 
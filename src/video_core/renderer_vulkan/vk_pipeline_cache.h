@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,12 +10,13 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 #include "common/common_types.h"
-#include "common/thread_worker.h"
+#include "common/thread_pool.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/value.h"
 #include "shader_recompiler/frontend/maxwell/control_flow.h"
@@ -116,6 +120,11 @@ public:
 private:
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipelineSlowPath();
 
+    /// Returns true when nothing the graphics key is built from changed since it was last built.
+    [[nodiscard]] bool IsGraphicsKeyCurrent() const noexcept;
+
+    void MarkGraphicsKeyCurrent() noexcept;
+
     [[nodiscard]] GraphicsPipeline* BuiltPipeline(GraphicsPipeline* pipeline) const noexcept;
 
     std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline();
@@ -155,8 +164,21 @@ private:
     GraphicsPipelineCacheKey graphics_key{};
     GraphicsPipeline* current_pipeline{};
 
+    /// Engine state the graphics key and the current pipeline were last built from.
+    struct {
+        const Tegra::Engines::Maxwell3D* maxwell3d;
+        u64 generation;
+        Maxwell::PrimitiveTopology topology;
+        Tegra::Engines::Maxwell3D::EngineHint engine_state;
+    } graphics_key_state{};
+
+    std::optional<GraphicsPipelineLibraryCache> library_cache;
+
     std::unordered_map<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>> compute_cache;
     std::unordered_map<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>> graphics_cache;
+    /// Pipelines by a hash of their shaders, looked up for one to draw with while another
+    /// pipeline of the same shaders is being built
+    std::unordered_map<u64, std::vector<GraphicsPipeline*>> pipelines_by_shaders;
 
     ShaderPools main_pools;
 
@@ -168,8 +190,8 @@ private:
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
 
-    Common::ThreadWorker workers;
-    Common::ThreadWorker serialization_thread;
+    Common::PooledWorker workers;
+    Common::PooledWorker serialization_thread;
     DynamicFeatures dynamic_features;
 };
 
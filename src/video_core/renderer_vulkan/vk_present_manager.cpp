@@ -169,6 +169,7 @@ Frame* PresentManager::GetRenderFrame() {
     // Wait for the presentation to be finished so all frame resources are free
     frame->present_done.Wait();
     frame->present_done.Reset();
+    frame->generated = false;
 
     return frame;
 }
@@ -211,7 +212,8 @@ void PresentManager::RecreateFrame(Frame* frame, u32 width, u32 height, VkFormat
         .arrayLayers = 1,
         .samples = VK_SAMPLE_COUNT_1_BIT,
         .tiling = VK_IMAGE_TILING_OPTIMAL,
-        .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+        .usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                 VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -273,6 +275,11 @@ void PresentManager::WaitPresent() {
     std::scoped_lock swapchain_lock{swapchain_mutex};
 }
 
+bool PresentManager::HasPendingPresents() {
+    std::scoped_lock queue_lock{queue_mutex};
+    return !present_queue.empty();
+}
+
 void PresentManager::PresentThread(std::stop_token token) {
     Common::SetCurrentThreadName("VulkanPresent");
     while (!token.stop_requested()) {
@@ -284,22 +291,50 @@ void PresentManager::PresentThread(std::stop_token token) {
             return;
         }
 
-        // Take the frame and notify anyone waiting
+        // Take the newest frame and notify anyone waiting. Like a mailbox, frames that were
+        // queued while the previous present was blocked are replaced instead of presented late,
+        // so the renderer never has to wait for the display to catch up.
+        std::vector<Frame*> dropped_frames;
         Frame* frame = present_queue.front();
         present_queue.pop();
+        while (!present_queue.empty()) {
+            dropped_frames.push_back(frame);
+            frame = present_queue.front();
+            present_queue.pop();
+        }
         frame_cv.notify_one();
 
+        // A generated frame goes between the previous frame and the one queued right after it,
+        // keep it when that one is presented.
+        Frame* generated_frame = nullptr;
+        if (!dropped_frames.empty() && dropped_frames.back()->generated) {
+            generated_frame = dropped_frames.back();
+            dropped_frames.pop_back();
+        }
+
         // By exchanging the lock ownership we take the swapchain lock
         // before the queue lock goes out of scope. This way the swapchain
         // lock in WaitPresent is guaranteed to occur after here.
         std::exchange(lock, std::unique_lock{swapchain_mutex});
 
+        for (Frame* const dropped_frame : dropped_frames) {
+            DropFrame(dropped_frame);
+        }
+        if (generated_frame) {
+            CopyToSwapchain(generated_frame);
+        }
         CopyToSwapchain(frame);
 
-        // Free the frame for reuse
+        // Free the frames for reuse
         std::scoped_lock fl{free_mutex};
+        for (Frame* const dropped_frame : dropped_frames) {
+            free_queue.push(dropped_frame);
+        }
+        if (generated_frame) {
+            free_queue.push(generated_frame);
+        }
         free_queue.push(frame);
-        free_cv.notify_one();
+        free_cv.notify_all();
     }
 }
 
@@ -344,6 +379,35 @@ void PresentManager::CopyToSwapchain(Frame* frame) {
     }
 }
 
+void PresentManager::DropFrame(Frame* frame) {
+    // The frame is never copied to the swapchain, still wait on its render semaphore so it can be
+    // signaled again, and signal the fence the next user of the frame waits on.
+    static constexpr VkPipelineStageFlags wait_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    const VkSubmitInfo submit_info{
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreCount = 1U,
+        .pWaitSemaphores = frame->render_ready.address(),
+        .pWaitDstStageMask = &wait_stage_mask,
+        .commandBufferCount = 0,
+        .pCommandBuffers = nullptr,
+        .signalSemaphoreCount = 0,
+        .pSignalSemaphores = nullptr,
+    };
+    std::scoped_lock submit_lock{scheduler.submit_mutex};
+    switch (const VkResult result =
+                device.GetGraphicsQueue().Submit(submit_info, *frame->present_done)) {
+    case VK_SUCCESS:
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+}
+
 void PresentManager::CopyToSwapchainImpl(Frame* frame) {
 
     // If the size of the incoming frames has changed, recreate the swapchain
@@ -504,6 +568,11 @@ void PresentManager::CopyToSwapchainImpl(Frame* frame) {
 
     // Present
     swapchain.Present(render_semaphore);
+
+    // Let the previous frame reach the display before taking a new one. This keeps a single
+    // frame queued in the presentation engine, and as frames are only freed from here, the
+    // emulated vsync follows the real scanout instead of running a whole swapchain ahead.
+    swapchain.WaitForPresent(1);
 }
 
 } // namespace Vulkan
@@ -33,6 +33,7 @@ struct Frame {
     vk::CommandBuffer cmdbuf;
     vk::Semaphore render_ready;
     vk::Fence present_done;
+    bool generated{}; ///< Interpolated by the presenter instead of drawn from a guest frame
 };
 
 class PresentManager {
@@ -63,6 +64,14 @@ public:
     /// Waits for the present thread to finish presenting all queued frames.
     void WaitPresent();
 
+    /// Returns true when frames are queued but not taken by the present thread yet
+    [[nodiscard]] bool HasPendingPresents();
+
+    /// Returns true when frames are presented from a dedicated thread
+    [[nodiscard]] bool UsesPresentThread() const {
+        return use_present_thread;
+    }
+
 private:
     void PresentThread(std::stop_token token);
 
@@ -70,6 +79,8 @@ private:
 
     void CopyToSwapchainImpl(Frame* frame);
 
+    void DropFrame(Frame* frame);
+
     void RecreateSwapchain(Frame* frame);
 
     void SetImageCount();
@@ -4,6 +4,8 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <limits>
 #include <map>
@@ -372,23 +374,33 @@ public:
     void PushUnsyncedQueries() override {
         PauseCounter();
         current_bank->Close();
+        FlushSet flush_set{
+            .queries = std::move(pending_flush_queries),
+        };
+        if (Settings::RuntimeSnapshot().batched_query_readback) {
+            RecordReadback(flush_set);
+        }
         {
             std::scoped_lock lk(flush_guard);
-            pending_flush_sets.emplace_back(std::move(pending_flush_queries));
+            pending_flush_sets.push_back(std::move(flush_set));
         }
     }
 
     void PopUnsyncedQueries() override {
-        std::vector<size_t> current_flush_queries;
+        FlushSet flush_set;
         {
             std::scoped_lock lk(flush_guard);
-            current_flush_queries = std::move(pending_flush_sets.front());
+            flush_set = std::move(pending_flush_sets.front());
             pending_flush_sets.pop_front();
         }
+        if (flush_set.readback) {
+            PopReadback(flush_set);
+            return;
+        }
         ApplyBanksWideOp<false>(
-            current_flush_queries,
+            flush_set.queries,
             [](SamplesQueryBank* bank, size_t start, size_t amount) { bank->Sync(start, amount); });
-        for (auto q : current_flush_queries) {
+        for (auto q : flush_set.queries) {
             auto* query = GetQuery(q);
             u64 total = 0;
             ApplyBankOp(query, [&total](SamplesQueryBank* bank, size_t start, size_t amount) {
@@ -403,6 +415,105 @@ public:
     }
 
 private:
+    /// Queries waiting for the same fence to have their results read by the host
+    struct FlushSet {
+        std::vector<size_t> queries;
+
+        /// Host visible copy of the results, null when they are read from the query pools
+        vk::Buffer readback;
+        size_t readback_slots{};
+
+        /// First slot and its position in the readback buffer of every bank with results
+        std::unordered_map<size_t, std::pair<size_t, size_t>> bank_offsets;
+    };
+
+    /// Copies the results of every query in the set with one command per bank into a host
+    /// visible buffer, so they can be read once the fence is signalled.
+    void RecordReadback(FlushSet& flush_set) {
+        size_t num_slots = 0;
+        ApplyBanksWideOp<true>(flush_set.queries,
+                               [&](SamplesQueryBank* bank, size_t start, size_t amount) {
+                                   flush_set.bank_offsets[bank->GetIndex()] = {start, num_slots};
+                                   num_slots += amount;
+                               });
+        if (num_slots == 0) {
+            return;
+        }
+        ObtainReadbackBuffer(flush_set, num_slots);
+        scheduler.RequestOutsideRenderPassOperationContext();
+        ApplyBanksWideOp<true>(flush_set.queries, [&](SamplesQueryBank* bank, size_t start,
+                                                      size_t amount) {
+            const VkDeviceSize offset =
+                flush_set.bank_offsets[bank->GetIndex()].second * SamplesQueryBank::QUERY_SIZE;
+            scheduler.Record([query_pool = bank->GetInnerPool(), start, amount, offset,
+                              buffer = *flush_set.readback](vk::CommandBuffer cmdbuf) {
+                cmdbuf.CopyQueryPoolResults(query_pool, static_cast<u32>(start),
+                                            static_cast<u32>(amount), buffer, offset,
+                                            SamplesQueryBank::QUERY_SIZE,
+                                            VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_64_BIT);
+            });
+        });
+        scheduler.Record([](vk::CommandBuffer cmdbuf) {
+            static constexpr VkMemoryBarrier READBACK_BARRIER{
+                .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                .pNext = nullptr,
+                .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+            };
+            cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
+                                   READBACK_BARRIER);
+        });
+    }
+
+    void PopReadback(FlushSet& flush_set) {
+        flush_set.readback.Invalidate();
+        const u64* const results =
+            reinterpret_cast<const u64*>(flush_set.readback.Mapped().data());
+        for (const size_t q : flush_set.queries) {
+            auto* query = GetQuery(q);
+            u64 total = 0;
+            ApplyBankOp(query, [&](SamplesQueryBank* bank, size_t start, size_t amount) {
+                const auto [first_slot, position] = flush_set.bank_offsets.at(bank->GetIndex());
+                for (size_t i = 0; i < amount; i++) {
+                    total += results[position + start - first_slot + i];
+                }
+            });
+            query->value = total;
+            query->flags |= VideoCommon::QueryFlagBits::IsFinalValueSynced;
+        }
+        std::scoped_lock lk(flush_guard);
+        free_readbacks.emplace_back(std::move(flush_set.readback), flush_set.readback_slots);
+    }
+
+    void ObtainReadbackBuffer(FlushSet& flush_set, size_t num_slots) {
+        {
+            std::scoped_lock lk(flush_guard);
+            const auto it = std::ranges::find_if(free_readbacks, [num_slots](const auto& free) {
+                return free.second >= num_slots;
+            });
+            if (it != free_readbacks.end()) {
+                flush_set.readback = std::move(it->first);
+                flush_set.readback_slots = it->second;
+                free_readbacks.erase(it);
+                return;
+            }
+        }
+        const size_t slots = (std::max)(SamplesQueryBank::BANK_SIZE, std::bit_ceil(num_slots));
+        flush_set.readback = memory_allocator.CreateBuffer(
+            {
+                .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                .pNext = nullptr,
+                .flags = 0,
+                .size = slots * SamplesQueryBank::QUERY_SIZE,
+                .usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                .queueFamilyIndexCount = 0,
+                .pQueueFamilyIndices = nullptr,
+            },
+            MemoryUsage::Download);
+        flush_set.readback_slots = slots;
+    }
+
     template <typename Func>
     void ApplyBankOp(VideoCommon::HostQueryBase* query, Func&& func) {
         size_t size_slots = query->size_slots;
@@ -590,7 +701,8 @@ private:
 
     // flush levels
     std::vector<size_t> pending_flush_queries;
-    std::deque<std::vector<size_t>> pending_flush_sets;
+    std::deque<FlushSet> pending_flush_sets;
+    std::vector<std::pair<vk::Buffer, size_t>> free_readbacks;
 
     // State Machine
     size_t current_bank_slot;
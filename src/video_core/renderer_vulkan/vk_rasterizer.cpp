@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <memory>
 #include <mutex>
 
@@ -13,6 +14,7 @@
 
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/profiler.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
 #include "video_core/buffer_cache/buffer_cache.h"
@@ -175,6 +177,18 @@ DrawParams MakeDrawParams(const MaxwellDrawState& draw_state, u32 num_instances,
     }
     return params;
 }
+
+bool IsTopologyMergeable(Maxwell::PrimitiveTopology topology) {
+    // These topologies generate index buffers for the vertices of each draw
+    switch (topology) {
+    case Maxwell::PrimitiveTopology::Quads:
+    case Maxwell::PrimitiveTopology::QuadStrip:
+    case Maxwell::PrimitiveTopology::Polygon:
+        return false;
+    default:
+        return true;
+    }
+}
 } // Anonymous namespace
 
 RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra::GPU& gpu_,
@@ -183,9 +197,10 @@ RasterizerVulkan::RasterizerVulkan(Core::Frontend::EmuWindow& emu_window_, Tegra
                                    StateTracker& state_tracker_, Scheduler& scheduler_)
     : gpu{gpu_}, device_memory{device_memory_}, device{device_},
       memory_allocator{memory_allocator_}, state_tracker{state_tracker_}, scheduler{scheduler_},
-      staging_pool(device, memory_allocator, scheduler), descriptor_pool(device, scheduler),
+      staging_pool(device, memory_allocator, scheduler), descriptor_pool(device, memory_allocator, scheduler),
       guest_descriptor_queue(device, scheduler), compute_pass_descriptor_queue(device, scheduler),
-      blit_image(device, scheduler, state_tracker, descriptor_pool), render_pass_cache(device),
+      render_pass_cache(device),
+      blit_image(device, scheduler, state_tracker, descriptor_pool, render_pass_cache),
       texture_cache_runtime{
           device,     scheduler,         memory_allocator, staging_pool,
           blit_image, render_pass_cache, descriptor_pool,  compute_pass_descriptor_queue},
@@ -232,13 +247,17 @@ void RasterizerVulkan::PrepareDraw(bool is_indexed, Func&& draw_func) {
     query_cache.CounterEnable(VideoCommon::QueryType::ZPassPixelCount64,
                               maxwell3d->regs.zpass_pixel_count_enable);
 
-    draw_func();
+    draw_func(pipeline);
 
     query_cache.CounterEnable(VideoCommon::QueryType::StreamingByteCount, false);
 }
 
 void RasterizerVulkan::Draw(bool is_indexed, u32 instance_count) {
-    PrepareDraw(is_indexed, [this, is_indexed, instance_count] {
+    PROFILE_SCOPE("RasterizerVulkan::Draw");
+    if (TryMergeDraw(is_indexed, instance_count)) {
+        return;
+    }
+    PrepareDraw(is_indexed, [this, is_indexed, instance_count](GraphicsPipeline* pipeline) {
         const auto& draw_state = maxwell3d->draw_manager->GetDrawState();
         const u32 num_instances{instance_count};
         const auto polygon_mode = VideoCore::EffectivePolygonMode(maxwell3d->regs);
@@ -253,13 +272,134 @@ void RasterizerVulkan::Draw(bool is_indexed, u32 instance_count) {
                             draw_params.base_vertex, draw_params.base_instance);
             }
         });
+        BeginDrawBatch(pipeline, is_indexed);
     });
 }
 
+void RasterizerVulkan::BeginDrawBatch(GraphicsPipeline* pipeline, bool is_indexed) {
+    draw_batch.pipeline = nullptr;
+    if (!device.IsKhrDrawIndirectCountSupported()) {
+        return;
+    }
+    const auto& regs = maxwell3d->regs;
+    const auto& draw_state = maxwell3d->draw_manager->GetDrawState();
+    // Transform feedback and feedback loops need work between draws, HLE macros pass per draw
+    // parameters through the pipeline configuration.
+    if (regs.transform_feedback_enabled != 0 || texture_cache.HasFeedbackLoop() ||
+        maxwell3d->engine_state == Tegra::Engines::Maxwell3D::EngineHint::OnHLEMacro ||
+        !draw_state.inline_index_draw_indexes.empty() ||
+        !IsTopologyMergeable(draw_state.topology)) {
+        return;
+    }
+    if (is_indexed && draw_state.index_buffer.format == Maxwell::IndexFormat::UnsignedByte &&
+        !device.IsExtIndexTypeUint8Supported()) {
+        return;
+    }
+    draw_batch = DrawBatch{
+        .pipeline = pipeline,
+        .maxwell3d = maxwell3d,
+        .topology = draw_state.topology,
+        .is_indexed = is_indexed,
+        .index_limit = draw_state.index_buffer.first + draw_state.index_buffer.count,
+        .generation = maxwell3d->dirty.generation,
+        .num_invalidations = num_invalidations.load(std::memory_order_relaxed),
+        .tick = scheduler.CurrentTick(),
+        .num_recorded_commands = scheduler.NumRecordedCommands(),
+        .commands{},
+        .num_commands = 0,
+    };
+}
+
+bool RasterizerVulkan::TryMergeDraw(bool is_indexed, u32 instance_count) {
+    if (!draw_batch.pipeline) {
+        return false;
+    }
+    const auto& draw_state = maxwell3d->draw_manager->GetDrawState();
+    // Anything recorded or modified since the last draw of the batch breaks it
+    const bool is_compatible =
+        draw_batch.maxwell3d == maxwell3d && draw_batch.is_indexed == is_indexed &&
+        draw_batch.topology == draw_state.topology &&
+        draw_batch.generation == maxwell3d->dirty.generation &&
+        draw_batch.num_invalidations == num_invalidations.load(std::memory_order_relaxed) &&
+        draw_batch.tick == scheduler.CurrentTick() &&
+        draw_batch.num_recorded_commands == scheduler.NumRecordedCommands() &&
+        maxwell3d->engine_state != Tegra::Engines::Maxwell3D::EngineHint::OnHLEMacro &&
+        draw_state.inline_index_draw_indexes.empty() &&
+        (!is_indexed || static_cast<u64>(draw_state.index_buffer.first) +
+                                draw_state.index_buffer.count <= draw_batch.index_limit);
+    if (!is_compatible || pipeline_cache.CurrentGraphicsPipeline() != draw_batch.pipeline) {
+        draw_batch.pipeline = nullptr;
+        return false;
+    }
+    if (draw_batch.num_commands == MAX_BATCHED_DRAWS || draw_batch.commands.empty()) {
+        if (!RecordDrawBatch()) {
+            draw_batch.pipeline = nullptr;
+            return false;
+        }
+    }
+    const auto polygon_mode = VideoCore::EffectivePolygonMode(maxwell3d->regs);
+    const DrawParams params{MakeDrawParams(draw_state, instance_count, is_indexed, polygon_mode)};
+    u8* const count = draw_batch.commands.data();
+    if (is_indexed) {
+        const VkDrawIndexedIndirectCommand command{
+            .indexCount = params.num_vertices,
+            .instanceCount = params.num_instances,
+            .firstIndex = params.first_index,
+            .vertexOffset = static_cast<s32>(params.base_vertex),
+            .firstInstance = params.base_instance,
+        };
+        std::memcpy(count + sizeof(u32) + draw_batch.num_commands * sizeof(command), &command,
+                    sizeof(command));
+    } else {
+        const VkDrawIndirectCommand command{
+            .vertexCount = params.num_vertices,
+            .instanceCount = params.num_instances,
+            .firstVertex = params.base_vertex,
+            .firstInstance = params.base_instance,
+        };
+        std::memcpy(count + sizeof(u32) + draw_batch.num_commands * sizeof(command), &command,
+                    sizeof(command));
+    }
+    // The memory is host coherent and read when the command buffer is submitted, the tick
+    // check above makes sure it hasn't been submitted yet.
+    ++draw_batch.num_commands;
+    std::memcpy(count, &draw_batch.num_commands, sizeof(u32));
+    ++num_merged_draws;
+    gpu.TickWork();
+    return true;
+}
+
+bool RasterizerVulkan::RecordDrawBatch() {
+    const bool is_indexed = draw_batch.is_indexed;
+    const u32 stride = static_cast<u32>(is_indexed ? sizeof(VkDrawIndexedIndirectCommand)
+                                                   : sizeof(VkDrawIndirectCommand));
+    const StagingBufferRef ref =
+        staging_pool.Request(sizeof(u32) + MAX_BATCHED_DRAWS * stride, MemoryUsage::Upload);
+    if (scheduler.CurrentTick() != draw_batch.tick) {
+        return false;
+    }
+    const u32 num_commands = 0;
+    std::memcpy(ref.mapped_span.data(), &num_commands, sizeof(u32));
+    scheduler.Record([buffer = ref.buffer, offset = ref.offset, stride,
+                      is_indexed](vk::CommandBuffer cmdbuf) {
+        if (is_indexed) {
+            cmdbuf.DrawIndexedIndirectCount(buffer, offset + sizeof(u32), buffer, offset,
+                                            MAX_BATCHED_DRAWS, stride);
+        } else {
+            cmdbuf.DrawIndirectCount(buffer, offset + sizeof(u32), buffer, offset,
+                                     MAX_BATCHED_DRAWS, stride);
+        }
+    });
+    draw_batch.commands = ref.mapped_span;
+    draw_batch.num_commands = 0;
+    draw_batch.num_recorded_commands = scheduler.NumRecordedCommands();
+    return true;
+}
+
 void RasterizerVulkan::DrawIndirect() {
     const auto& params = maxwell3d->draw_manager->GetIndirectParams();
     buffer_cache.SetDrawIndirect(&params);
-    PrepareDraw(params.is_indexed, [this, &params] {
+    PrepareDraw(params.is_indexed, [this, &params](GraphicsPipeline*) {
         const auto indirect_buffer = buffer_cache.GetDrawIndirectBuffer();
         const auto& buffer = indirect_buffer.first;
         const auto& offset = indirect_buffer.second;
@@ -371,17 +511,12 @@ void RasterizerVulkan::Clear(u32 layer_count) {
     const VkExtent2D render_area = framebuffer->RenderArea();
     scheduler.RequestRenderpass(framebuffer);
 
-    query_cache.NotifySegment(true);
-    query_cache.CounterEnable(VideoCommon::QueryType::ZPassPixelCount64,
-                              maxwell3d->regs.zpass_pixel_count_enable);
-
     u32 up_scale = 1;
     u32 down_shift = 0;
     if (texture_cache.IsRescaling()) {
         up_scale = Settings::values.resolution_info.up_scale;
         down_shift = Settings::values.resolution_info.down_shift;
     }
-    UpdateViewportsState(regs);
 
     VkRect2D default_scissor;
     default_scissor.offset.x = 0;
@@ -402,15 +537,25 @@ void RasterizerVulkan::Clear(u32 layer_count) {
         .width = (std::min)(clear_rect.rect.extent.width, render_area.width),
         .height = (std::min)(clear_rect.rect.extent.height, render_area.height),
     };
+    // Clears of whole attachments in a render pass nothing was recorded in yet become its load
+    // operation, which saves tilers from loading the attachments just to overwrite them
+    const bool is_whole_clear = clear_rect.rect.offset.x == 0 && clear_rect.rect.offset.y == 0 &&
+                                clear_rect.rect.extent.width == render_area.width &&
+                                clear_rect.rect.extent.height == render_area.height &&
+                                clear_rect.baseArrayLayer == 0 &&
+                                clear_rect.layerCount >= framebuffer->Attachments().layers;
 
     const u32 color_attachment = regs.clear_surface.RT;
-    if (use_color && framebuffer->HasAspectColorBit(color_attachment)) {
+    const bool clear_color = use_color && framebuffer->HasAspectColorBit(color_attachment);
+    const bool is_color_masked = !regs.clear_surface.R || !regs.clear_surface.G ||
+                                 !regs.clear_surface.B || !regs.clear_surface.A;
+    VkClearValue clear_value{};
+    if (clear_color) {
         const auto format =
             VideoCore::Surface::PixelFormatFromRenderTargetFormat(regs.rt[color_attachment].format);
         bool is_integer = IsPixelFormatInteger(format);
         bool is_signed = IsPixelFormatSignedInteger(format);
         size_t int_size = PixelComponentSizeBitsInteger(format);
-        VkClearValue clear_value{};
         if (!is_integer) {
             std::memcpy(clear_value.color.float32, regs.clear_color.data(),
                         regs.clear_color.size() * sizeof(f32));
@@ -426,9 +571,44 @@ void RasterizerVulkan::Clear(u32 layer_count) {
                                      (regs.clear_color[i] - 0.5f));
             }
         }
+    }
+    const bool is_color_cleared_on_load =
+        clear_color && !is_color_masked && is_whole_clear &&
+        scheduler.RequestLoadClear(framebuffer, 1U << color_attachment, clear_value);
 
-        if (regs.clear_surface.R && regs.clear_surface.G && regs.clear_surface.B &&
-            regs.clear_surface.A) {
+    VkImageAspectFlags aspect_flags = 0;
+    u32 depth_stencil_clear_bits = 0;
+    if (use_depth && framebuffer->HasAspectDepthBit()) {
+        aspect_flags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+        depth_stencil_clear_bits |= RENDER_PASS_CLEAR_DEPTH;
+    }
+    if (use_stencil && framebuffer->HasAspectStencilBit()) {
+        aspect_flags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+        depth_stencil_clear_bits |= RENDER_PASS_CLEAR_STENCIL;
+    }
+    const bool is_stencil_masked = (aspect_flags & VK_IMAGE_ASPECT_STENCIL_BIT) != 0 &&
+                                   regs.stencil_front_mask != 0xFF && regs.stencil_front_mask != 0;
+    const VkClearValue depth_stencil_value{
+        .depthStencil{
+            .depth = regs.clear_depth,
+            .stencil = regs.clear_stencil,
+        },
+    };
+    const bool is_depth_stencil_cleared_on_load =
+        aspect_flags != 0 && !is_stencil_masked && is_whole_clear &&
+        scheduler.RequestLoadClear(framebuffer, depth_stencil_clear_bits, depth_stencil_value);
+    if ((!clear_color || is_color_cleared_on_load) &&
+        (aspect_flags == 0 || is_depth_stencil_cleared_on_load)) {
+        return;
+    }
+
+    query_cache.NotifySegment(true);
+    query_cache.CounterEnable(VideoCommon::QueryType::ZPassPixelCount64,
+                              maxwell3d->regs.zpass_pixel_count_enable);
+    UpdateViewportsState(regs);
+
+    if (clear_color && !is_color_cleared_on_load) {
+        if (!is_color_masked) {
             scheduler.Record([color_attachment, clear_value, clear_rect](vk::CommandBuffer cmdbuf) {
                 const VkClearAttachment attachment{
                     .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
@@ -450,22 +630,10 @@ void RasterizerVulkan::Clear(u32 layer_count) {
         }
     }
 
-    if (!use_depth && !use_stencil) {
+    if (aspect_flags == 0 || is_depth_stencil_cleared_on_load) {
         return;
     }
-    VkImageAspectFlags aspect_flags = 0;
-    if (use_depth && framebuffer->HasAspectDepthBit()) {
-        aspect_flags |= VK_IMAGE_ASPECT_DEPTH_BIT;
-    }
-    if (use_stencil && framebuffer->HasAspectStencilBit()) {
-        aspect_flags |= VK_IMAGE_ASPECT_STENCIL_BIT;
-    }
-    if (aspect_flags == 0) {
-        return;
-    }
-
-    if (use_stencil && framebuffer->HasAspectStencilBit() && regs.stencil_front_mask != 0xFF &&
-        regs.stencil_front_mask != 0) {
+    if (is_stencil_masked) {
         Region2D dst_region = {
             Offset2D{.x = clear_rect.rect.offset.x, .y = clear_rect.rect.offset.y},
             Offset2D{.x = clear_rect.rect.offset.x + static_cast<s32>(clear_rect.rect.extent.width),
@@ -604,6 +772,7 @@ void RasterizerVulkan::InvalidateRegion(DAddr addr, u64 size, VideoCommon::Cache
     if (addr == 0 || size == 0) {
         return;
     }
+    num_invalidations.fetch_add(1, std::memory_order_relaxed);
     if (True(which & VideoCommon::CacheType::TextureCache)) {
         std::scoped_lock lock{texture_cache.mutex};
         texture_cache.WriteMemory(addr, size);
@@ -621,6 +790,7 @@ void RasterizerVulkan::InvalidateRegion(DAddr addr, u64 size, VideoCommon::Cache
 }
 
 void RasterizerVulkan::InnerInvalidation(std::span<const std::pair<DAddr, std::size_t>> sequences) {
+    num_invalidations.fetch_add(1, std::memory_order_relaxed);
     {
         std::scoped_lock lock{texture_cache.mutex};
         for (const auto& [addr, size] : sequences) {
@@ -643,6 +813,7 @@ void RasterizerVulkan::InnerInvalidation(std::span<const std::pair<DAddr, std::s
 
 bool RasterizerVulkan::OnCPUWrite(DAddr addr, u64 size) {
     DEBUG_ASSERT(addr != 0 || size != 0);
+    num_invalidations.fetch_add(1, std::memory_order_relaxed);
     {
         std::scoped_lock lock{buffer_cache.mutex};
         if (buffer_cache.OnCPUWrite(addr, size)) {
@@ -661,6 +832,7 @@ void RasterizerVulkan::OnCacheInvalidation(DAddr addr, u64 size) {
     if (addr == 0 || size == 0) {
         return;
     }
+    num_invalidations.fetch_add(1, std::memory_order_relaxed);
 
     {
         std::scoped_lock lock{texture_cache.mutex};
@@ -678,6 +850,7 @@ void RasterizerVulkan::InvalidateGPUCache() {
 }
 
 void RasterizerVulkan::UnmapMemory(DAddr addr, u64 size) {
+    num_invalidations.fetch_add(1, std::memory_order_relaxed);
     {
         std::scoped_lock lock{texture_cache.mutex};
         texture_cache.UnmapMemory(addr, size);
@@ -690,6 +863,7 @@ void RasterizerVulkan::UnmapMemory(DAddr addr, u64 size) {
 }
 
 void RasterizerVulkan::ModifyGPUMemory(size_t as_id, GPUVAddr addr, u64 size) {
+    num_invalidations.fetch_add(1, std::memory_order_relaxed);
     {
         std::scoped_lock lock{texture_cache.mutex};
         texture_cache.UnmapGPUMemory(as_id, addr, size);
@@ -766,9 +940,16 @@ void RasterizerVulkan::FlushCommands() {
 
 void RasterizerVulkan::TickFrame() {
     draw_counter = 0;
+    if (num_merged_draws != 0) {
+        LOG_DEBUG(Render_Vulkan, "Merged {} draws into indirect count draws", num_merged_draws);
+        num_merged_draws = 0;
+    }
     guest_descriptor_queue.TickFrame();
     compute_pass_descriptor_queue.TickFrame();
+    descriptor_pool.TickFrame();
     fence_manager.TickFrame();
+    query_cache.TickFrame();
+    scheduler.TickFrame();
     staging_pool.TickFrame();
     {
         std::scoped_lock lock{texture_cache.mutex};
@@ -780,6 +961,21 @@ void RasterizerVulkan::TickFrame() {
     }
 }
 
+void RasterizerVulkan::TrimMemory(VideoCommon::MemoryPressure pressure) {
+    {
+        std::scoped_lock lock{texture_cache.mutex, buffer_cache.mutex};
+        texture_cache.Trim(pressure);
+        buffer_cache.Trim(pressure);
+    }
+    // The emulation may be paused and not tick frames, wait for the GPU to be done with what was
+    // evicted so it can be destroyed right away.
+    scheduler.Finish();
+    staging_pool.Trim();
+    std::scoped_lock lock{texture_cache.mutex, buffer_cache.mutex};
+    texture_cache.ReleaseSentencedResources();
+    buffer_cache.ReleaseDelayedBuffers();
+}
+
 bool RasterizerVulkan::AccelerateConditionalRendering() {
     gpu_memory->FlushCaching();
     return query_cache.AccelerateHostConditionalRendering();
@@ -804,6 +1000,7 @@ void RasterizerVulkan::AccelerateInlineToMemory(GPUVAddr address, size_t copy_si
         return;
     }
     gpu_memory->WriteBlockUnsafe(address, memory.data(), copy_size);
+    num_invalidations.fetch_add(1, std::memory_order_relaxed);
     {
         std::unique_lock<std::recursive_mutex> lock{buffer_cache.mutex};
         if (!buffer_cache.InlineMemory(*cpu_addr, copy_size, memory)) {
@@ -931,6 +1128,24 @@ bool AccelerateDMA::BufferToImage(const Tegra::DMA::ImageCopy& copy_info,
     return DmaBufferImageCopy<true>(copy_info, buffer_operand, image_operand);
 }
 
+bool AccelerateDMA::BufferSwizzle(const Tegra::DMA::SwizzleCopy& copy) {
+    // The copy pass moves whole words
+    const auto is_word_aligned = [](const Tegra::DMA::SwizzleOperand& operand) {
+        return operand.address % sizeof(u32) == 0 && operand.pitch % sizeof(u32) == 0;
+    };
+    if (copy.bytes_per_pixel % sizeof(u32) != 0 || !is_word_aligned(copy.src) ||
+        !is_word_aligned(copy.dst)) {
+        return false;
+    }
+    std::scoped_lock lock{buffer_cache.mutex, texture_cache.mutex};
+    // Cached images are only synchronized with guest memory, not with the buffers
+    if (texture_cache.HasImagesInRegion(copy.src.address, copy.src.size) ||
+        texture_cache.HasImagesInRegion(copy.dst.address, copy.dst.size)) {
+        return false;
+    }
+    return buffer_cache.DMASwizzle(copy);
+}
+
 void RasterizerVulkan::UpdateDynamicStates() {
     auto& regs = maxwell3d->regs;
     UpdateViewportsState(regs);
@@ -983,6 +1198,10 @@ void RasterizerVulkan::UpdateDynamicStates() {
             UpdateLineStippleEnable(regs);
             UpdateConservativeRasterizationMode(regs);
         }
+        if (device.IsExtExtendedDynamicState3RasterizationSupported()) {
+            UpdatePolygonMode(regs);
+            UpdateAlphaToCoverageEnable(regs);
+        }
     }
     if (device.IsExtVertexInputDynamicStateSupported()) {
         if (auto* gp = pipeline_cache.CurrentGraphicsPipeline(); gp && gp->HasDynamicVertexInput()) {
@@ -1425,6 +1644,24 @@ void RasterizerVulkan::UpdateDepthClampEnable(Tegra::Engines::Maxwell3D::Regs& r
         [is_enabled](vk::CommandBuffer cmdbuf) { cmdbuf.SetDepthClampEnableEXT(is_enabled); });
 }
 
+void RasterizerVulkan::UpdatePolygonMode(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!state_tracker.TouchPolygonMode()) {
+        return;
+    }
+    scheduler.Record([mode = VideoCore::EffectivePolygonMode(regs)](vk::CommandBuffer cmdbuf) {
+        cmdbuf.SetPolygonModeEXT(MaxwellToVK::PolygonMode(mode));
+    });
+}
+
+void RasterizerVulkan::UpdateAlphaToCoverageEnable(Tegra::Engines::Maxwell3D::Regs& regs) {
+    if (!state_tracker.TouchAlphaToCoverageEnable()) {
+        return;
+    }
+    const bool enable = regs.anti_alias_alpha_control.alpha_to_coverage != 0;
+    scheduler.Record(
+        [enable](vk::CommandBuffer cmdbuf) { cmdbuf.SetAlphaToCoverageEnableEXT(enable); });
+}
+
 void RasterizerVulkan::UpdateDepthCompareOp(Tegra::Engines::Maxwell3D::Regs& regs) {
     if (!state_tracker.TouchDepthCompareOp()) {
         return;
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <span>
 
 #include <boost/container/static_vector.hpp>
 
@@ -65,6 +67,8 @@ public:
     bool BufferToImage(const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::BufferOperand& src,
                        const Tegra::DMA::ImageOperand& dst) override;
 
+    bool BufferSwizzle(const Tegra::DMA::SwizzleCopy& copy) override;
+
 private:
     template <bool IS_IMAGE_UPLOAD>
     bool DmaBufferImageCopy(const Tegra::DMA::ImageCopy& copy_info,
@@ -136,6 +140,15 @@ public:
     void BindChannel(Tegra::Control::ChannelState& channel) override;
 
     void ReleaseChannel(s32 channel_id) override;
+
+    VideoCore::CacheMemoryUsage GetCacheMemoryUsage() const override {
+        return {
+            .texture_cache = texture_cache.GetImageMemoryUsage(),
+            .buffer_cache = buffer_cache.GetBufferMemoryUsage(),
+        };
+    }
+    void TrimMemory(VideoCommon::MemoryPressure pressure) override;
+
     std::optional<FramebufferTextureInfo> AccelerateDisplay(const Tegra::FramebufferConfig& config,
                                                             VAddr framebuffer_addr,
                                                             u32 pixel_stride);
@@ -152,9 +165,36 @@ private:
 
     static constexpr VkDeviceSize DEFAULT_BUFFER_SIZE = 4 * sizeof(float);
 
+    /// Maximum number of draws merged in a single indirect count draw
+    static constexpr u32 MAX_BATCHED_DRAWS = 64;
+
+    /// Draws recorded back to back with the same state, appended to an indirect count draw.
+    struct DrawBatch {
+        GraphicsPipeline* pipeline{}; ///< Pipeline of the first draw, null when there's no batch
+        Tegra::Engines::Maxwell3D* maxwell3d{};
+        Tegra::Engines::Maxwell3D::Regs::PrimitiveTopology topology{};
+        bool is_indexed{};
+        u32 index_limit{}; ///< Indices synchronized by the buffer cache for the first draw
+        u64 generation{};
+        u64 num_invalidations{};
+        u64 tick{};
+        u64 num_recorded_commands{};
+        std::span<u8> commands; ///< Draw count followed by the commands, empty until a merge
+        u32 num_commands{};
+    };
+
     template <typename Func>
     void PrepareDraw(bool is_indexed, Func&&);
 
+    /// Starts a batch with the draw that was just recorded, when later draws can be merged to it.
+    void BeginDrawBatch(GraphicsPipeline* pipeline, bool is_indexed);
+
+    /// Appends the current draw to the batch, returns false when it has to be drawn on its own.
+    bool TryMergeDraw(bool is_indexed, u32 instance_count);
+
+    /// Records a new indirect count draw for the batch to append its draws to.
+    bool RecordDrawBatch();
+
     void FlushWork();
 
     void UpdateDynamicStates();
@@ -183,6 +223,8 @@ private:
     void UpdateDepthBiasEnable(Tegra::Engines::Maxwell3D::Regs& regs);
     void UpdateLogicOpEnable(Tegra::Engines::Maxwell3D::Regs& regs);
     void UpdateDepthClampEnable(Tegra::Engines::Maxwell3D::Regs& regs);
+    void UpdatePolygonMode(Tegra::Engines::Maxwell3D::Regs& regs);
+    void UpdateAlphaToCoverageEnable(Tegra::Engines::Maxwell3D::Regs& regs);
     void UpdateFrontFace(Tegra::Engines::Maxwell3D::Regs& regs);
     void UpdateStencilOp(Tegra::Engines::Maxwell3D::Regs& regs);
     void UpdateStencilTestEnable(Tegra::Engines::Maxwell3D::Regs& regs);
@@ -203,8 +245,8 @@ private:
     DescriptorPool descriptor_pool;
     GuestDescriptorQueue guest_descriptor_queue;
     ComputePassDescriptorQueue compute_pass_descriptor_queue;
-    BlitImageHelper blit_image;
     RenderPassCache render_pass_cache;
+    BlitImageHelper blit_image;
 
     TextureCacheRuntime texture_cache_runtime;
     TextureCache texture_cache;
@@ -223,6 +265,12 @@ private:
     boost::container::static_vector<VkSampler, MAX_TEXTURES> sampler_handles;
 
     u32 draw_counter = 0;
+
+    DrawBatch draw_batch;
+    u64 num_merged_draws = 0;
+
+    /// Incremented when guest memory is modified, it might be done from other threads
+    std::atomic<u64> num_invalidations{};
 };
 
 } // namespace Vulkan
@@ -44,7 +44,8 @@ using VideoCore::Surface::SurfaceType;
         }
 
         VkAttachmentDescription AttachmentDescription(const Device& device, PixelFormat format,
-                                                      VkSampleCountFlagBits samples) {
+                                                      VkSampleCountFlagBits samples, bool clear,
+                                                      bool clear_stencil) {
             using MaxwellToVK::SurfaceFormat;
 
             const SurfaceType surface_type = GetSurfaceType(format);
@@ -55,10 +56,11 @@ using VideoCore::Surface::SurfaceType;
                 .flags = {},
                 .format = SurfaceFormat(device, FormatType::Optimal, true, format).format,
                 .samples = samples,
-                .loadOp = VK_ATTACHMENT_LOAD_OP_LOAD,
+                .loadOp = clear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
                 .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
-                .stencilLoadOp = has_stencil ? VK_ATTACHMENT_LOAD_OP_LOAD
-                                                 : VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                .stencilLoadOp = !has_stencil  ? VK_ATTACHMENT_LOAD_OP_DONT_CARE
+                                 : clear_stencil ? VK_ATTACHMENT_LOAD_OP_CLEAR
+                                                 : VK_ATTACHMENT_LOAD_OP_LOAD,
                 .stencilStoreOp = has_stencil ? VK_ATTACHMENT_STORE_OP_STORE
                                                   : VK_ATTACHMENT_STORE_OP_DONT_CARE,
                 .initialLayout = VK_IMAGE_LAYOUT_GENERAL,
@@ -73,8 +75,9 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
     std::scoped_lock lock{mutex};
     const auto [pair, is_new] = cache.try_emplace(key);
     if (!is_new) {
-        return *pair->second;
+        return *pair->second.render_pass;
     }
+    RenderingFormats& rendering = pair->second.formats;
     boost::container::static_vector<VkAttachmentDescription, 9> descriptions;
     std::array<VkAttachmentReference, 8> references{};
     u32 num_attachments{};
@@ -87,11 +90,15 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
             .layout = VK_IMAGE_LAYOUT_GENERAL,
         };
         if (is_valid) {
-            descriptions.push_back(AttachmentDescription(*device, format, key.samples));
+            const bool clear = (key.clear_mask & (1U << index)) != 0;
+            descriptions.push_back(
+                AttachmentDescription(*device, format, key.samples, clear, false));
+            rendering.color_formats[index] = descriptions.back().format;
             num_attachments = static_cast<u32>(index + 1);
             ++num_colors;
         }
     }
+    rendering.num_color_formats = num_attachments;
     const bool has_depth{key.depth_format != PixelFormat::Invalid};
     VkAttachmentReference depth_reference{};
     if (key.depth_format != PixelFormat::Invalid) {
@@ -99,7 +106,16 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
             .attachment = num_colors,
             .layout = VK_IMAGE_LAYOUT_GENERAL,
         };
-        descriptions.push_back(AttachmentDescription(*device, key.depth_format, key.samples));
+        descriptions.push_back(AttachmentDescription(
+            *device, key.depth_format, key.samples, (key.clear_mask & RENDER_PASS_CLEAR_DEPTH) != 0,
+            (key.clear_mask & RENDER_PASS_CLEAR_STENCIL) != 0));
+        const SurfaceType surface_type = GetSurfaceType(key.depth_format);
+        if (surface_type != SurfaceType::Stencil) {
+            rendering.depth_format = descriptions.back().format;
+        }
+        if (surface_type != SurfaceType::Depth) {
+            rendering.stencil_format = descriptions.back().format;
+        }
     }
     const VkSubpassDescription subpass{
         .flags = 0,
@@ -125,7 +141,7 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
             .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
             .dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT
     };
-    pair->second = device->GetLogical().CreateRenderPass({
+    pair->second.render_pass = device->GetLogical().CreateRenderPass({
         .sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
@@ -136,7 +152,98 @@ VkRenderPass RenderPassCache::Get(const RenderPassKey& key) {
         .dependencyCount = 1,
         .pDependencies = &dependency,
     });
-    return *pair->second;
+    formats.emplace(*pair->second.render_pass, &rendering);
+    return *pair->second.render_pass;
+}
+
+void RenderingAttachments::BeginRendering(vk::CommandBuffer cmdbuf, VkExtent2D render_area,
+                                          u32 clear_mask,
+                                          std::span<const VkClearValue> clear_values) const {
+    const auto attachment_info = [&](VkImageView view, u32 clear_bit, size_t value_index) {
+        const bool clear = (clear_mask & clear_bit) != 0;
+        return VkRenderingAttachmentInfo{
+            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+            .pNext = nullptr,
+            .imageView = view,
+            .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .resolveMode = VK_RESOLVE_MODE_NONE,
+            .resolveImageView = VK_NULL_HANDLE,
+            .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .loadOp = clear ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD,
+            .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+            .clearValue = clear ? clear_values[value_index] : VkClearValue{},
+        };
+    };
+    std::array<VkRenderingAttachmentInfo, 8> color_attachments;
+    for (u32 index = 0; index < num_color_views; ++index) {
+        color_attachments[index] = attachment_info(color_views[index], 1U << index, index);
+    }
+    // Depth and stencil share the view but not their load operation
+    const VkRenderingAttachmentInfo depth_attachment =
+        attachment_info(depth_stencil_view, RENDER_PASS_CLEAR_DEPTH, 8);
+    const VkRenderingAttachmentInfo stencil_attachment =
+        attachment_info(depth_stencil_view, RENDER_PASS_CLEAR_STENCIL, 8);
+    const VkRenderingFragmentShadingRateAttachmentInfoKHR shading_rate_attachment{
+        .sType = VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR,
+        .pNext = nullptr,
+        .imageView = shading_rate_view,
+        .imageLayout = VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR,
+        .shadingRateAttachmentTexelSize{
+            .width = shading_rate_texel_size,
+            .height = shading_rate_texel_size,
+        },
+    };
+    cmdbuf.BeginRendering({
+        .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+        .pNext = shading_rate_view ? &shading_rate_attachment : nullptr,
+        .flags = 0,
+        .renderArea{
+            .offset{},
+            .extent = render_area,
+        },
+        .layerCount = layers,
+        .viewMask = 0,
+        .colorAttachmentCount = num_color_views,
+        .pColorAttachments = color_attachments.data(),
+        .pDepthAttachment = has_depth ? &depth_attachment : nullptr,
+        .pStencilAttachment = has_stencil ? &stencil_attachment : nullptr,
+    });
+}
+
+const RenderingFormats& RenderPassCache::Formats(VkRenderPass render_pass) {
+    std::scoped_lock lock{mutex};
+    return *formats.at(render_pass);
+}
+
+bool RenderPassCache::UsesDynamicRendering() const noexcept {
+    return device->IsKhrDynamicRenderingSupported();
+}
+
+bool RenderPassCache::UsesFragmentShadingRate() const noexcept {
+    return device->IsKhrFragmentShadingRateSupported();
+}
+
+PipelineRenderingInfo::PipelineRenderingInfo(RenderPassCache& render_pass_cache,
+                                             VkRenderPass render_pass_, const void* next_)
+    : render_pass{render_pass_}, next{next_},
+      uses_dynamic_rendering{render_pass_cache.UsesDynamicRendering()} {
+    if (!uses_dynamic_rendering) {
+        return;
+    }
+    // Any render pass instance may have a shading rate attachment bound, even for blits
+    if (render_pass_cache.UsesFragmentShadingRate()) {
+        flags |= VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
+    }
+    const RenderingFormats& rendering = render_pass_cache.Formats(render_pass);
+    rendering_ci = {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+        .pNext = next,
+        .viewMask = 0,
+        .colorAttachmentCount = rendering.num_color_formats,
+        .pColorAttachmentFormats = rendering.color_formats.data(),
+        .depthAttachmentFormat = rendering.depth_format,
+        .stencilAttachmentFormat = rendering.stencil_format,
+    };
 }
 
 } // namespace Vulkan
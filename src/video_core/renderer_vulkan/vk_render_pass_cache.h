@@ -1,22 +1,35 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
 #include <mutex>
+#include <span>
 #include <unordered_map>
 
+#include "common/common_types.h"
 #include "video_core/surface.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace Vulkan {
 
+/// Bits of RenderPassKey::clear_mask for the depth and stencil aspects, colors use their index
+constexpr u32 RENDER_PASS_CLEAR_DEPTH = 1U << 8;
+constexpr u32 RENDER_PASS_CLEAR_STENCIL = 1U << 9;
+
 struct RenderPassKey {
     bool operator==(const RenderPassKey&) const noexcept = default;
 
     std::array<VideoCore::Surface::PixelFormat, 8> color_formats;
     VideoCore::Surface::PixelFormat depth_format;
     VkSampleCountFlagBits samples;
+    /// Attachments cleared on load instead of loaded. Passes that only differ in it are
+    /// compatible, pipelines are always built against passes without clears.
+    u32 clear_mask = 0;
 };
 
 } // namespace Vulkan
@@ -27,6 +40,7 @@ struct hash<Vulkan::RenderPassKey> {
     [[nodiscard]] size_t operator()(const Vulkan::RenderPassKey& key) const noexcept {
         size_t value = static_cast<size_t>(key.depth_format) << 48;
         value ^= static_cast<size_t>(key.samples) << 52;
+        value ^= static_cast<size_t>(key.clear_mask) << 54;
         for (size_t i = 0; i < key.color_formats.size(); ++i) {
             value ^= static_cast<size_t>(key.color_formats[i]) << (i * 6);
         }
@@ -39,16 +53,96 @@ namespace Vulkan {
 
 class Device;
 
+/// Attachments of a framebuffer begun with VK_KHR_dynamic_rendering, in place of a VkFramebuffer.
+struct RenderingAttachments {
+    bool operator==(const RenderingAttachments&) const noexcept = default;
+
+    /// Begins a render pass instance on the attachments, the ones in clear_mask are cleared to
+    /// their value in clear_values, indexed like the bits of RenderPassKey::clear_mask.
+    void BeginRendering(vk::CommandBuffer cmdbuf, VkExtent2D render_area, u32 clear_mask = 0,
+                        std::span<const VkClearValue> clear_values = {}) const;
+
+    std::array<VkImageView, 8> color_views{}; ///< Null for the unused render targets
+    u32 num_color_views{};
+    VkImageView depth_stencil_view{};
+    u32 layers{1};
+    bool has_depth{};
+    bool has_stencil{};
+    VkImageView shading_rate_view{}; ///< Fragment shading rate attachment, may be null
+    u32 shading_rate_texel_size{};
+};
+
+/// Attachment formats of a render pass, pipelines for dynamic rendering are built against them.
+struct RenderingFormats {
+    std::array<VkFormat, 8> color_formats{};
+    u32 num_color_formats{};
+    VkFormat depth_format{VK_FORMAT_UNDEFINED};
+    VkFormat stencil_format{VK_FORMAT_UNDEFINED};
+};
+
 class RenderPassCache {
 public:
     explicit RenderPassCache(const Device& device_);
 
     VkRenderPass Get(const RenderPassKey& key);
 
+    /// Returns the attachment formats of a render pass returned by Get.
+    [[nodiscard]] const RenderingFormats& Formats(VkRenderPass render_pass);
+
+    /// Returns true when render passes are begun with vkCmdBeginRendering.
+    /// Render pass objects are still created, but only to key pipelines by their attachments.
+    [[nodiscard]] bool UsesDynamicRendering() const noexcept;
+
+    /// Returns true when render passes may be begun with a fragment shading rate attachment.
+    [[nodiscard]] bool UsesFragmentShadingRate() const noexcept;
+
 private:
+    struct Entry {
+        vk::RenderPass render_pass;
+        RenderingFormats formats;
+    };
+
     const Device* device{};
-    std::unordered_map<RenderPassKey, vk::RenderPass> cache;
+    std::unordered_map<RenderPassKey, Entry> cache;
+    std::unordered_map<VkRenderPass, const RenderingFormats*> formats;
     std::mutex mutex;
 };
 
+/// Render pass parameters of a graphics pipeline create info.
+class PipelineRenderingInfo {
+public:
+    explicit PipelineRenderingInfo(RenderPassCache& render_pass_cache, VkRenderPass render_pass,
+                                   const void* next = nullptr);
+
+    PipelineRenderingInfo(const PipelineRenderingInfo&) = delete;
+    PipelineRenderingInfo& operator=(const PipelineRenderingInfo&) = delete;
+
+    /// Returns the pNext chain of the create info.
+    [[nodiscard]] const void* Next() const noexcept {
+        return uses_dynamic_rendering ? &rendering_ci : next;
+    }
+
+    /// Returns the render pass of the create info, null with dynamic rendering.
+    [[nodiscard]] VkRenderPass RenderPass() const noexcept {
+        return uses_dynamic_rendering ? VK_NULL_HANDLE : render_pass;
+    }
+
+    /// Returns the render pass the pipeline is compatible with, to be used as a key.
+    [[nodiscard]] VkRenderPass Key() const noexcept {
+        return render_pass;
+    }
+
+    /// Returns the pipeline create flags required by the render pass instances.
+    [[nodiscard]] VkPipelineCreateFlags Flags() const noexcept {
+        return flags;
+    }
+
+private:
+    VkPipelineRenderingCreateInfo rendering_ci{};
+    VkRenderPass render_pass;
+    const void* next;
+    VkPipelineCreateFlags flags{};
+    bool uses_dynamic_rendering;
+};
+
 } // namespace Vulkan
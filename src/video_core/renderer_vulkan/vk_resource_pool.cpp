@@ -18,7 +18,7 @@ size_t ResourcePool::CommitResource() {
     const auto search = [this, gpu_tick](size_t begin, size_t end) -> std::optional<size_t> {
         for (size_t iterator = begin; iterator < end; ++iterator) {
             if (gpu_tick >= ticks[iterator]) {
-                ticks[iterator] = master_semaphore->CurrentTick();
+                ticks[iterator] = master_semaphore->RecordingTick();
                 return iterator;
             }
         }
@@ -33,7 +33,7 @@ size_t ResourcePool::CommitResource() {
             // Both searches failed, the pool is full; handle it.
             const size_t free_resource = ManageOverflow();
 
-            ticks[free_resource] = master_semaphore->CurrentTick();
+            ticks[free_resource] = master_semaphore->RecordingTick();
             found = free_resource;
         }
     }
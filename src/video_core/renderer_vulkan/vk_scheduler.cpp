@@ -4,15 +4,22 @@
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <utility>
 
+#include <fmt/format.h>
+
 #include "video_core/renderer_vulkan/vk_query_cache.h"
 
+#include "common/logging/log.h"
+#include "common/profiler.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "video_core/renderer_vulkan/vk_command_pool.h"
+#include "video_core/renderer_vulkan/vk_gpu_profiler.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_state_tracker.h"
@@ -40,11 +47,34 @@ void Scheduler::CommandChunk::ExecuteAll(vk::CommandBuffer cmdbuf,
 
 Scheduler::Scheduler(const Device& device_, StateTracker& state_tracker_)
     : device{device_}, state_tracker{state_tracker_},
-      master_semaphore{std::make_unique<MasterSemaphore>(device)},
-      command_pool{std::make_unique<CommandPool>(*master_semaphore, device)} {
+      master_semaphore{std::make_unique<MasterSemaphore>(device)} {
     AcquireNewChunk();
-    AllocateWorkerCommandBuffer();
-    worker_thread = std::jthread([this](std::stop_token token) { WorkerThread(token); });
+
+    const size_t num_workers =
+        (std::max<size_t>)(Settings::values.vulkan_recording_threads.GetValue(), 1);
+    workers.reserve(num_workers);
+    for (size_t index = 0; index < num_workers; ++index) {
+        Worker& worker = *workers.emplace_back(std::make_unique<Worker>());
+        worker.command_pool =
+            std::make_unique<CommandPool>(*master_semaphore, device, device.GetGraphicsFamily());
+        worker.thread = std::jthread(
+            [this, &worker, index](std::stop_token token) { WorkerThread(worker, index, token); });
+    }
+    if (device.HasAsyncComputeQueue()) {
+        async_command_pools[static_cast<size_t>(AsyncQueue::Compute)] =
+            std::make_unique<CommandPool>(*master_semaphore, device, device.GetComputeFamily());
+    }
+    if (device.HasTransferQueue()) {
+        async_command_pools[static_cast<size_t>(AsyncQueue::Transfer)] =
+            std::make_unique<CommandPool>(*master_semaphore, device, device.GetTransferFamily());
+    }
+    if (Settings::values.gpu_pass_profiling.GetValue()) {
+        if (device.SupportsTimestamps()) {
+            gpu_profiler = std::make_unique<GpuPassProfiler>(device, *master_semaphore);
+        } else {
+            LOG_WARNING(Render_Vulkan, "GPU pass profiling requires timestamp support");
+        }
+    }
 }
 
 Scheduler::~Scheduler() = default;
@@ -67,25 +97,33 @@ void Scheduler::Finish(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore)
 void Scheduler::WaitWorker() {
     DispatchWork();
 
-    // Ensure the queue is drained.
-    {
-        std::unique_lock ql{queue_mutex};
-        event_cv.wait(ql, [this] { return work_queue.empty(); });
-    }
+    for (const auto& worker : workers) {
+        // Ensure the queue is drained.
+        {
+            std::unique_lock ql{worker->queue_mutex};
+            worker->event_cv.wait(ql, [&worker] { return worker->work_queue.empty(); });
+        }
 
-    // Now wait for execution to finish.
-    std::scoped_lock el{execution_mutex};
+        // Now wait for execution to finish.
+        std::scoped_lock el{worker->execution_mutex};
+    }
 }
 
 void Scheduler::DispatchWork() {
     if (chunk->Empty()) {
         return;
     }
+    // Every chunk up to a submission has to be recorded into the same command buffers, move on to
+    // the next worker only once the current one has been given a whole submission.
+    Worker& worker = *workers[dispatch_worker];
+    if (chunk->HasSubmit()) {
+        dispatch_worker = (dispatch_worker + 1) % workers.size();
+    }
     {
-        std::scoped_lock ql{queue_mutex};
-        work_queue.push(std::move(chunk));
+        std::scoped_lock ql{worker.queue_mutex};
+        worker.work_queue.push(std::move(chunk));
     }
-    event_cv.notify_all();
+    worker.event_cv.notify_all();
     AcquireNewChunk();
 }
 
@@ -93,17 +131,103 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
     const VkRenderPass renderpass = framebuffer->RenderPass();
     const VkFramebuffer framebuffer_handle = framebuffer->Handle();
     const VkExtent2D render_area = framebuffer->RenderArea();
+    const RenderingAttachments& attachments = framebuffer->Attachments();
     if (renderpass == state.renderpass && framebuffer_handle == state.framebuffer &&
         render_area.width == state.render_area.width &&
-        render_area.height == state.render_area.height) {
+        render_area.height == state.render_area.height &&
+        (framebuffer_handle || attachments == state.attachments)) {
         return;
     }
     EndRenderPass();
     state.renderpass = renderpass;
     state.framebuffer = framebuffer_handle;
     state.render_area = render_area;
+    state.attachments = attachments;
+
+    is_begin_pending = true;
+    pending_renderpass = renderpass;
+    pending_clear_mask = 0;
+    pending_cleared_images = 0;
+    num_renderpass_images = framebuffer->NumImages();
+    renderpass_images = framebuffer->Images();
+    renderpass_image_ranges = framebuffer->ImageRanges();
+    renderpass_image_sizes = framebuffer->ImageSizes();
+}
+
+bool Scheduler::RequestLoadClear(const Framebuffer* framebuffer, u32 clear_bits,
+                                 const VkClearValue& value) {
+    if (!is_begin_pending || framebuffer->RenderPass() != state.renderpass ||
+        framebuffer->Handle() != state.framebuffer ||
+        (!state.framebuffer && framebuffer->Attachments() != state.attachments)) {
+        return false;
+    }
+    pending_clear_mask |= clear_bits;
+    pending_renderpass = framebuffer->ClearRenderPass(pending_clear_mask);
+    const bool is_dynamic_rendering = !state.framebuffer;
+    for (u32 index = 0; index < NUM_RT; ++index) {
+        if ((clear_bits & (1U << index)) == 0) {
+            continue;
+        }
+        const size_t attachment = framebuffer->ColorAttachmentIndex(index);
+        pending_clear_values[is_dynamic_rendering ? index : attachment] = value;
+        pending_cleared_images |= 1U << attachment;
+    }
+    if ((clear_bits & (RENDER_PASS_CLEAR_DEPTH | RENDER_PASS_CLEAR_STENCIL)) == 0) {
+        return true;
+    }
+    // Depth and stencil share the attachment and its clear value, keep the aspect not cleared now
+    const u32 attachment = framebuffer->NumColorBuffers();
+    VkClearDepthStencilValue& depth_stencil =
+        pending_clear_values[is_dynamic_rendering ? NUM_RT : attachment].depthStencil;
+    if ((clear_bits & RENDER_PASS_CLEAR_DEPTH) != 0) {
+        depth_stencil.depth = value.depthStencil.depth;
+    }
+    if ((clear_bits & RENDER_PASS_CLEAR_STENCIL) != 0) {
+        depth_stencil.stencil = value.depthStencil.stencil;
+    }
+    const bool clears_depth = !framebuffer->HasAspectDepthBit() ||
+                              (pending_clear_mask & RENDER_PASS_CLEAR_DEPTH) != 0;
+    const bool clears_stencil = !framebuffer->HasAspectStencilBit() ||
+                                (pending_clear_mask & RENDER_PASS_CLEAR_STENCIL) != 0;
+    if (clears_depth && clears_stencil) {
+        pending_cleared_images |= 1U << attachment;
+    }
+    return true;
+}
 
-    Record([renderpass, framebuffer_handle, render_area](vk::CommandBuffer cmdbuf) {
+void Scheduler::BeginPendingRenderPass() {
+    is_begin_pending = false;
+    ++num_renderpasses;
+    for (u32 index = 0; index < num_renderpass_images; ++index) {
+        const bool is_cleared = (pending_cleared_images & (1U << index)) != 0;
+        (is_cleared ? cleared_attachment_bytes : loaded_attachment_bytes) +=
+            renderpass_image_sizes[index];
+    }
+    const VkRenderPass renderpass = pending_renderpass;
+    const VkFramebuffer framebuffer_handle = state.framebuffer;
+    const VkExtent2D render_area = state.render_area;
+    const u32 clear_mask = pending_clear_mask;
+    const std::array<VkClearValue, 9> clear_values = pending_clear_values;
+    if (gpu_profiler) {
+        // Identify passes begun on attachments by their first one
+        const RenderingAttachments& attachments = state.attachments;
+        const VkImageView first_view = attachments.num_color_views != 0
+                                           ? attachments.color_views[0]
+                                           : attachments.depth_stencil_view;
+        BeginProfiledPass("Render pass",
+                          framebuffer_handle ? reinterpret_cast<u64>(framebuffer_handle)
+                                             : reinterpret_cast<u64>(first_view));
+    }
+    if (!framebuffer_handle) {
+        Record([attachments = state.attachments, render_area, clear_mask,
+                clear_values](vk::CommandBuffer cmdbuf) {
+            attachments.BeginRendering(cmdbuf, render_area, clear_mask, clear_values);
+        });
+        return;
+    }
+    const u32 num_clear_values = clear_mask != 0 ? num_renderpass_images : 0;
+    Record([renderpass, framebuffer_handle, render_area, num_clear_values,
+            clear_values](vk::CommandBuffer cmdbuf) {
         const VkRenderPassBeginInfo renderpass_bi{
             .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
             .pNext = nullptr,
@@ -114,14 +238,11 @@ void Scheduler::RequestRenderpass(const Framebuffer* framebuffer) {
                     .offset = {.x = 0, .y = 0},
                     .extent = render_area,
                 },
-            .clearValueCount = 0,
-            .pClearValues = nullptr,
+            .clearValueCount = num_clear_values,
+            .pClearValues = num_clear_values != 0 ? clear_values.data() : nullptr,
         };
         cmdbuf.BeginRenderPass(renderpass_bi, VK_SUBPASS_CONTENTS_INLINE);
     });
-    num_renderpass_images = framebuffer->NumImages();
-    renderpass_images = framebuffer->Images();
-    renderpass_image_ranges = framebuffer->ImageRanges();
 }
 
 void Scheduler::RequestOutsideRenderPassOperationContext() {
@@ -145,17 +266,21 @@ bool Scheduler::UpdateRescaling(bool is_rescaling) {
     return true;
 }
 
-void Scheduler::WorkerThread(std::stop_token stop_token) {
-    Common::SetCurrentThreadName("VulkanWorker");
+void Scheduler::WorkerThread(Worker& worker, size_t index, std::stop_token stop_token) {
+    if (index == 0) {
+        Common::SetCurrentThreadName("VulkanWorker");
+    } else {
+        Common::SetCurrentThreadName(fmt::format("VulkanWorker{}", index).c_str());
+    }
 
-    const auto TryPopQueue{[this](auto& work) -> bool {
-        if (work_queue.empty()) {
+    const auto TryPopQueue{[&worker](auto& work) -> bool {
+        if (worker.work_queue.empty()) {
             return false;
         }
 
-        work = std::move(work_queue.front());
-        work_queue.pop();
-        event_cv.notify_all();
+        work = std::move(worker.work_queue.front());
+        worker.work_queue.pop();
+        worker.event_cv.notify_all();
         return true;
     }};
 
@@ -163,10 +288,10 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
         std::unique_ptr<CommandChunk> work;
 
         {
-            std::unique_lock lk{queue_mutex};
+            std::unique_lock lk{worker.queue_mutex};
 
             // Wait for work.
-            event_cv.wait(lk, stop_token, [&] { return TryPopQueue(work); });
+            worker.event_cv.wait(lk, stop_token, [&] { return TryPopQueue(work); });
 
             // If we've been asked to stop, we're done.
             if (stop_token.stop_requested()) {
@@ -176,16 +301,41 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
             // Exchange lock ownership so that we take the execution lock before
             // the queue lock goes out of scope. This allows us to force execution
             // to complete in the next step.
-            std::exchange(lk, std::unique_lock{execution_mutex});
+            std::exchange(lk, std::unique_lock{worker.execution_mutex});
 
             // Perform the work, tracking whether the chunk was a submission
-            // before executing.
+            // before executing. Submissions recorded by other workers have
+            // to reach the queue first.
             const bool has_submit = work->HasSubmit();
-            work->ExecuteAll(current_cmdbuf, current_upload_cmdbuf);
+            const u64 submit_index = work->SubmitIndex();
+            if (has_submit) {
+                WaitSubmitTurn(submit_index, stop_token);
+                if (stop_token.stop_requested()) {
+                    return;
+                }
+            }
+            // Resources committed while recording stay in use until this chunk's submission
+            // completes, which may be ahead of the current tick with several workers
+            MasterSemaphore::SetRecordingTick(work->Tick());
+            if (!worker.has_cmdbufs) {
+                AllocateWorkerCommandBuffer(worker);
+                worker.has_cmdbufs = true;
+            }
+            {
+                PROFILE_SCOPE("Scheduler::ExecuteChunk");
+                work->ExecuteAll(worker.cmdbuf, worker.upload_cmdbuf);
+            }
+            MasterSemaphore::SetRecordingTick(0);
 
-            // If the chunk was a submission, reallocate the command buffer.
+            // If the chunk was a submission, let the next one through and
+            // reallocate the command buffer.
             if (has_submit) {
-                AllocateWorkerCommandBuffer();
+                {
+                    std::scoped_lock tl{submit_turn_mutex};
+                    submit_turn = submit_index + 1;
+                }
+                submit_turn_cv.notify_all();
+                worker.has_cmdbufs = false;
             }
         }
 
@@ -198,16 +348,17 @@ void Scheduler::WorkerThread(std::stop_token stop_token) {
     }
 }
 
-void Scheduler::AllocateWorkerCommandBuffer() {
-    current_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_cmdbuf.Begin({
+void Scheduler::AllocateWorkerCommandBuffer(Worker& worker) {
+    worker.cmdbuf = vk::CommandBuffer(worker.command_pool->Commit(), device.GetDispatchLoader());
+    worker.cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
         .pInheritanceInfo = nullptr,
     });
-    current_upload_cmdbuf = vk::CommandBuffer(command_pool->Commit(), device.GetDispatchLoader());
-    current_upload_cmdbuf.Begin({
+    worker.upload_cmdbuf =
+        vk::CommandBuffer(worker.command_pool->Commit(), device.GetDispatchLoader());
+    worker.upload_cmdbuf.Begin({
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
         .pNext = nullptr,
         .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
@@ -215,6 +366,11 @@ void Scheduler::AllocateWorkerCommandBuffer() {
     });
 }
 
+void Scheduler::WaitSubmitTurn(u64 submit_index, std::stop_token stop_token) {
+    std::unique_lock tl{submit_turn_mutex};
+    submit_turn_cv.wait(tl, stop_token, [&] { return submit_turn == submit_index; });
+}
+
 u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore) {
     EndPendingOperations();
     InvalidateState();
@@ -250,11 +406,39 @@ u64 Scheduler::SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_se
             break;
         }
     });
-    chunk->MarkSubmit();
+    // Recording the submission may have moved to a new chunk acquired after the tick advanced
+    chunk->SetTick(signal_value);
+    chunk->MarkSubmit(num_submissions++);
     DispatchWork();
     return signal_value;
 }
 
+vk::CommandBuffer Scheduler::BeginAsync(AsyncQueue queue) {
+    CommandPool& command_pool = *async_command_pools[static_cast<size_t>(queue)];
+    vk::CommandBuffer cmdbuf(command_pool.Commit(), device.GetDispatchLoader());
+    cmdbuf.Begin({
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .pNext = nullptr,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+        .pInheritanceInfo = nullptr,
+    });
+    return cmdbuf;
+}
+
+void Scheduler::SubmitAsync(AsyncQueue queue, vk::CommandBuffer& cmdbuf) {
+    cmdbuf.End();
+    switch (const VkResult result = master_semaphore->SubmitAsync(queue, cmdbuf)) {
+    case VK_SUCCESS:
+        break;
+    case VK_ERROR_DEVICE_LOST:
+        device.ReportLoss();
+        [[fallthrough]];
+    default:
+        vk::Check(result);
+        break;
+    }
+}
+
 void Scheduler::AllocateNewContext() {
     // Enable counters once again. These are disabled when a command buffer is finished.
 }
@@ -265,6 +449,51 @@ void Scheduler::InvalidateState() {
     state_tracker.InvalidateCommandBufferState();
 }
 
+void Scheduler::TickFrame() {
+    if (num_renderpasses != 0 || num_skipped_renderpasses != 0) {
+        LOG_DEBUG(Render_Vulkan,
+                  "Render passes: {} begun, {} skipped, {} attachment bytes loaded, {} cleared on "
+                  "load, {} commands recorded before them",
+                  num_renderpasses, num_skipped_renderpasses, loaded_attachment_bytes,
+                  cleared_attachment_bytes, num_upload_commands);
+    }
+    num_renderpasses = 0;
+    num_skipped_renderpasses = 0;
+    loaded_attachment_bytes = 0;
+    cleared_attachment_bytes = 0;
+    num_upload_commands = 0;
+    if (gpu_profiler) {
+        gpu_profiler->TickFrame();
+    }
+}
+
+void Scheduler::BeginProfiledPass(std::string_view name, u64 id) {
+    if (!gpu_profiler) {
+        return;
+    }
+    EndProfiledPass();
+    const auto query = gpu_profiler->BeginPass(name, id);
+    if (!query) {
+        return;
+    }
+    is_profiled_pass_open = true;
+    // Timestamps are recorded straight to the chunk, they don't begin a requested render pass
+    RecordToChunk([query = *query](vk::CommandBuffer cmdbuf, vk::CommandBuffer) {
+        cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, query.pool, query.index);
+    });
+}
+
+void Scheduler::EndProfiledPass() {
+    if (!is_profiled_pass_open) {
+        return;
+    }
+    is_profiled_pass_open = false;
+    const GpuPassProfiler::Query query = gpu_profiler->EndPass();
+    RecordToChunk([query](vk::CommandBuffer cmdbuf, vk::CommandBuffer) {
+        cmdbuf.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query.pool, query.index);
+    });
+}
+
 void Scheduler::EndPendingOperations() {
     query_cache->CounterReset(VideoCommon::QueryType::ZPassPixelCount64);
     EndRenderPass();
@@ -275,13 +504,26 @@ void Scheduler::EndRenderPass()
         if (!state.renderpass) {
             return;
         }
+        if (is_begin_pending && pending_clear_mask == 0) {
+            // Nothing was recorded in the render pass, skip it instead of loading and storing
+            // its attachments for nothing
+            is_begin_pending = false;
+            ++num_skipped_renderpasses;
+            state.renderpass = nullptr;
+            num_renderpass_images = 0;
+            return;
+        }
+        if (is_begin_pending) {
+            BeginPendingRenderPass();
+        }
 
         query_cache->CounterEnable(VideoCommon::QueryType::ZPassPixelCount64, false);
         query_cache->NotifySegment(false);
 
         Record([num_images = num_renderpass_images,
                        images = renderpass_images,
-                       ranges = renderpass_image_ranges](vk::CommandBuffer cmdbuf) {
+                       ranges = renderpass_image_ranges,
+                       is_dynamic_rendering = !state.framebuffer](vk::CommandBuffer cmdbuf) {
             std::array<VkImageMemoryBarrier, 9> barriers;
             VkPipelineStageFlags src_stages = 0;
 
@@ -331,7 +573,11 @@ void Scheduler::EndRenderPass()
                     VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
                     VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 
-            cmdbuf.EndRenderPass();
+            if (is_dynamic_rendering) {
+                cmdbuf.EndRendering();
+            } else {
+                cmdbuf.EndRenderPass();
+            }
 
             cmdbuf.PipelineBarrier(src_stages,
                                    VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
@@ -341,6 +587,7 @@ void Scheduler::EndRenderPass()
                                    vk::Span(barriers.data(), num_images)  // Batched image barriers
             );
         });
+        EndProfiledPass();
 
         state.renderpass = nullptr;
         num_renderpass_images = 0;
@@ -358,6 +605,8 @@ void Scheduler::AcquireNewChunk() {
         chunk = std::move(chunk_reserve.back());
         chunk_reserve.pop_back();
     }
+    // Only SubmitExecution advances the tick, so the chunk belongs to the submission of this one
+    chunk->SetTick(master_semaphore->CurrentTick());
 }
 
 } // namespace Vulkan
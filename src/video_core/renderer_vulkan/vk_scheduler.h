@@ -1,20 +1,28 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <array>
 #include <condition_variable>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <string_view>
 #include <thread>
 #include <utility>
 #include <queue>
+#include <vector>
 
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include "common/polyfill_thread.h"
 #include "video_core/renderer_vulkan/vk_master_semaphore.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
 namespace VideoCommon {
@@ -27,6 +35,7 @@ namespace Vulkan {
 class CommandPool;
 class Device;
 class Framebuffer;
+class GpuPassProfiler;
 class GraphicsPipeline;
 class StateTracker;
 
@@ -45,16 +54,22 @@ public:
     /// Sends the current execution context to the GPU and waits for it to complete.
     void Finish(VkSemaphore signal_semaphore = nullptr, VkSemaphore wait_semaphore = nullptr);
 
-    /// Waits for the worker thread to finish executing everything. After this function returns it's
-    /// safe to touch worker resources.
+    /// Waits for the worker threads to finish executing everything. After this function returns
+    /// it's safe to touch worker resources.
     void WaitWorker();
 
     /// Sends currently recorded work to the worker thread.
     void DispatchWork();
 
-    /// Requests to begin a renderpass.
+    /// Requests to begin a renderpass. It's begun once the first command is recorded in it, and
+    /// not at all if it ends before that.
     void RequestRenderpass(const Framebuffer* framebuffer);
 
+    /// Clears attachments of the render pass requested last on load instead of recording a clear,
+    /// clear_bits are bits of RenderPassKey::clear_mask. Returns false when it has already begun.
+    bool RequestLoadClear(const Framebuffer* framebuffer, u32 clear_bits,
+                          const VkClearValue& value);
+
     /// Requests the current execution context to be able to execute operations only allowed outside
     /// of a renderpass.
     void RequestOutsideRenderPassOperationContext();
@@ -68,6 +83,17 @@ public:
     /// Invalidates current command buffer state except for render passes
     void InvalidateState();
 
+    /// Logs the attachment traffic of the frame.
+    void TickFrame();
+
+    /// Measures the GPU time of the commands recorded until the next pass begins or this one ends,
+    /// when GPU pass profiling is enabled. Passes don't nest, render passes are measured on their
+    /// own. The name has to be a literal, passes are aggregated by name and id.
+    void BeginProfiledPass(std::string_view name, u64 id = 0);
+
+    /// Ends the pass begun last, if any.
+    void EndProfiledPass();
+
     /// Assigns the query cache.
     void SetQueryCache(VideoCommon::QueryCacheBase<QueryCacheParams>& query_cache_) {
         query_cache = &query_cache_;
@@ -82,11 +108,22 @@ public:
     template <typename T>
         requires std::is_invocable_v<T, vk::CommandBuffer, vk::CommandBuffer>
     void RecordWithUploadBuffer(T&& command) {
-        if (chunk->Record(command)) {
-            return;
+        if (is_begin_pending) {
+            BeginPendingRenderPass();
         }
-        DispatchWork();
-        (void)chunk->Record(command);
+        RecordToChunk(std::move(command));
+    }
+
+    /// Records commands to the upload command buffer, which runs before every other command of
+    /// the submission. They don't need the current render pass to end, nor begin a requested one.
+    template <typename T>
+        requires std::is_invocable_v<T, vk::CommandBuffer>
+    void RecordUpload(T&& c) {
+        ++num_upload_commands;
+        this->RecordToChunk(
+            [command = std::move(c)](vk::CommandBuffer, vk::CommandBuffer upload_cmdbuf) {
+                command(upload_cmdbuf);
+            });
     }
 
     template <typename T>
@@ -98,11 +135,41 @@ public:
             });
     }
 
+    /// Returns true when compute work can be recorded to the async compute queue.
+    [[nodiscard]] bool HasAsyncCompute() const noexcept {
+        return HasAsyncQueue(AsyncQueue::Compute);
+    }
+
+    /// Returns true when uploads can be recorded to the dedicated transfer queue.
+    [[nodiscard]] bool HasAsyncTransfer() const noexcept {
+        return HasAsyncQueue(AsyncQueue::Transfer);
+    }
+
+    /// Records commands to their own command buffer, submitted to the async compute queue once the
+    /// worker reaches them. The next graphics submission waits for them to finish.
+    template <typename T>
+        requires std::is_invocable_v<T, vk::CommandBuffer>
+    void RecordAsyncCompute(T&& c) {
+        this->RecordAsync(AsyncQueue::Compute, std::move(c));
+    }
+
+    /// Same as RecordAsyncCompute, for the dedicated transfer queue.
+    template <typename T>
+        requires std::is_invocable_v<T, vk::CommandBuffer>
+    void RecordAsyncTransfer(T&& c) {
+        this->RecordAsync(AsyncQueue::Transfer, std::move(c));
+    }
+
     /// Returns the current command buffer tick.
     [[nodiscard]] u64 CurrentTick() const noexcept {
         return master_semaphore->CurrentTick();
     }
 
+    /// Returns the number of commands recorded so far, it changes whenever work is recorded.
+    [[nodiscard]] u64 NumRecordedCommands() const noexcept {
+        return num_recorded_commands;
+    }
+
     /// Returns true when a tick has been triggered by the GPU.
     [[nodiscard]] bool IsFree(u64 tick) const noexcept {
         return master_semaphore->IsFree(tick);
@@ -186,8 +253,9 @@ private:
             return true;
         }
 
-        void MarkSubmit() {
+        void MarkSubmit(u64 index) {
             submit = true;
+            submit_index = index;
         }
 
         bool Empty() const {
@@ -198,34 +266,99 @@ private:
             return submit;
         }
 
+        /// Sets the tick of the submission the chunk is recorded into
+        void SetTick(u64 tick_) {
+            tick = tick_;
+        }
+
+        u64 Tick() const {
+            return tick;
+        }
+
+        u64 SubmitIndex() const {
+            return submit_index;
+        }
+
     private:
         Command* first = nullptr;
         Command* last = nullptr;
 
         size_t command_offset = 0;
+        u64 submit_index = 0;
+        u64 tick = 0;
         bool submit = false;
         alignas(std::max_align_t) std::array<u8, 0x8000> data{};
     };
 
     struct State {
         VkRenderPass renderpass = nullptr;
-        VkFramebuffer framebuffer = nullptr;
+        VkFramebuffer framebuffer = nullptr; ///< Null when rendering was begun on the attachments
+        RenderingAttachments attachments{};
         VkExtent2D render_area = {0, 0};
         GraphicsPipeline* graphics_pipeline = nullptr;
         bool is_rescaling = false;
         bool rescaling_defined = false;
     };
 
-    void WorkerThread(std::stop_token stop_token);
+    /// Records every chunk between two submissions into its own command buffers, so consecutive
+    /// submissions can be recorded by different threads.
+    struct Worker {
+        std::unique_ptr<CommandPool> command_pool;
+        vk::CommandBuffer cmdbuf;
+        vk::CommandBuffer upload_cmdbuf;
+        /// Command buffers are committed when a submission starts, with its tick
+        bool has_cmdbufs = false;
+
+        std::queue<std::unique_ptr<CommandChunk>> work_queue;
+        std::mutex execution_mutex;
+        std::mutex queue_mutex;
+        std::condition_variable_any event_cv;
+        std::jthread thread;
+    };
+
+    template <typename T>
+    void RecordToChunk(T&& command) {
+        ++num_recorded_commands;
+        if (chunk->Record(command)) {
+            return;
+        }
+        DispatchWork();
+        (void)chunk->Record(command);
+    }
+
+    void WorkerThread(Worker& worker, size_t index, std::stop_token stop_token);
 
-    void AllocateWorkerCommandBuffer();
+    void AllocateWorkerCommandBuffer(Worker& worker);
+
+    /// Blocks until all submissions before the given one have been sent to the queue.
+    void WaitSubmitTurn(u64 submit_index, std::stop_token stop_token);
 
     u64 SubmitExecution(VkSemaphore signal_semaphore, VkSemaphore wait_semaphore);
 
+    [[nodiscard]] bool HasAsyncQueue(AsyncQueue queue) const noexcept {
+        return async_command_pools[static_cast<size_t>(queue)] != nullptr;
+    }
+
+    template <typename T>
+    void RecordAsync(AsyncQueue queue, T&& c) {
+        this->Record([this, queue, command = std::move(c)](vk::CommandBuffer) {
+            std::scoped_lock lock{async_mutexes[static_cast<size_t>(queue)]};
+            vk::CommandBuffer async_cmdbuf = BeginAsync(queue);
+            command(async_cmdbuf);
+            SubmitAsync(queue, async_cmdbuf);
+        });
+    }
+
+    vk::CommandBuffer BeginAsync(AsyncQueue queue);
+
+    void SubmitAsync(AsyncQueue queue, vk::CommandBuffer& cmdbuf);
+
     void AllocateNewContext();
 
     void EndPendingOperations();
 
+    void BeginPendingRenderPass();
+
     void EndRenderPass();
 
     void AcquireNewChunk();
@@ -234,12 +367,11 @@ private:
     StateTracker& state_tracker;
 
     std::unique_ptr<MasterSemaphore> master_semaphore;
-    std::unique_ptr<CommandPool> command_pool;
 
     VideoCommon::QueryCacheBase<QueryCacheParams>* query_cache = nullptr;
 
-    vk::CommandBuffer current_cmdbuf;
-    vk::CommandBuffer current_upload_cmdbuf;
+    std::unique_ptr<GpuPassProfiler> gpu_profiler; ///< Null when passes aren't profiled
+    bool is_profiled_pass_open = false;
 
     std::unique_ptr<CommandChunk> chunk;
     std::function<void()> on_submit;
@@ -249,14 +381,56 @@ private:
     u32 num_renderpass_images = 0;
     std::array<VkImage, 9> renderpass_images{};
     std::array<VkImageSubresourceRange, 9> renderpass_image_ranges{};
+    std::array<u64, 9> renderpass_image_sizes{};
+
+    /// The requested render pass has not been recorded yet, it may still take clears on load
+    bool is_begin_pending = false;
+    VkRenderPass pending_renderpass = nullptr;
+    u32 pending_clear_mask = 0;
+    u32 pending_cleared_images = 0; ///< Images with every aspect cleared, by attachment index
+    /// Indexed like the bits of the clear mask for dynamic rendering, by attachment otherwise
+    std::array<VkClearValue, 9> pending_clear_values{};
+
+    u64 loaded_attachment_bytes = 0;  ///< Attachment bytes loaded by render passes this frame
+    u64 cleared_attachment_bytes = 0; ///< Attachment bytes cleared on load instead this frame
+    u64 num_renderpasses = 0;         ///< Render passes begun this frame
+    u64 num_skipped_renderpasses = 0; ///< Render passes that ended before recording anything
+    u64 num_upload_commands = 0;      ///< Commands recorded to the upload command buffer
+
+    /// Null for the async queues the device doesn't have
+    std::array<std::unique_ptr<CommandPool>, NUM_ASYNC_QUEUES> async_command_pools;
+    std::array<std::mutex, NUM_ASYNC_QUEUES> async_mutexes;
 
-    std::queue<std::unique_ptr<CommandChunk>> work_queue;
     std::vector<std::unique_ptr<CommandChunk>> chunk_reserve;
-    std::mutex execution_mutex;
     std::mutex reserve_mutex;
-    std::mutex queue_mutex;
-    std::condition_variable_any event_cv;
-    std::jthread worker_thread;
+
+    u64 num_submissions = 0;
+    u64 num_recorded_commands = 0;
+    u64 submit_turn = 0;
+    std::mutex submit_turn_mutex;
+    std::condition_variable_any submit_turn_cv;
+
+    size_t dispatch_worker = 0;
+    std::vector<std::unique_ptr<Worker>> workers;
+};
+
+/// Profiles the commands recorded during its lifetime as a pass.
+class ScopedProfiledPass {
+public:
+    explicit ScopedProfiledPass(Scheduler& scheduler_, std::string_view name, u64 id = 0)
+        : scheduler{scheduler_} {
+        scheduler.BeginProfiledPass(name, id);
+    }
+
+    ~ScopedProfiledPass() {
+        scheduler.EndProfiledPass();
+    }
+
+    ScopedProfiledPass(const ScopedProfiledPass&) = delete;
+    ScopedProfiledPass& operator=(const ScopedProfiledPass&) = delete;
+
+private:
+    Scheduler& scheduler;
 };
 
 } // namespace Vulkan
@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <mutex>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/div_ceil.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_sparse_image.h"
+#include "video_core/vulkan_common/vulkan_device.h"
+
+namespace Vulkan {
+namespace {
+[[nodiscard]] bool IsSparseFormatSupported(const Device& device, const VkImageCreateInfo& ci) {
+    const VkPhysicalDeviceImageFormatInfo2 format_info{
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2,
+        .pNext = nullptr,
+        .format = ci.format,
+        .type = ci.imageType,
+        .tiling = ci.tiling,
+        .usage = ci.usage,
+        .flags = ci.flags,
+    };
+    VkImageFormatProperties2 format_properties{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2,
+        .pNext = nullptr,
+        .imageFormatProperties = {},
+    };
+    if (device.GetPhysical().GetImageFormatProperties2(format_info, format_properties) !=
+        VK_SUCCESS) {
+        return false;
+    }
+    const auto sparse_properties = device.GetPhysical().GetSparseImageFormatProperties(
+        ci.format, ci.imageType, ci.samples, ci.usage, ci.tiling);
+    return std::ranges::any_of(sparse_properties, [](const VkSparseImageFormatProperties& props) {
+        return props.aspectMask == VK_IMAGE_ASPECT_COLOR_BIT;
+    });
+}
+} // Anonymous namespace
+
+SparseImageMemory::SparseImageMemory(const Device& device_, MemoryAllocator& allocator_,
+                                     Scheduler& scheduler_, VkImage image_,
+                                     const VkImageCreateInfo& ci,
+                                     const VkSparseImageMemoryRequirements& requirements_)
+    : device{device_}, allocator{allocator_}, scheduler{scheduler_}, image{image_},
+      extent{ci.extent}, num_levels{ci.mipLevels}, num_layers{ci.arrayLayers},
+      requirements{requirements_} {
+    const VkMemoryRequirements memory_requirements =
+        device.GetLogical().GetImageMemoryRequirements(image);
+    // The alignment of sparse resources is the size of their sparse blocks
+    block_size = memory_requirements.alignment;
+    memory_type_bits = memory_requirements.memoryTypeBits;
+    is_single_mip_tail =
+        (requirements.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0;
+    fence = device.GetLogical().CreateFence({
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+    });
+    resident_levels.resize(static_cast<size_t>(num_layers) * num_levels);
+    resident_tails.resize(is_single_mip_tail ? 1 : num_layers);
+}
+
+SparseImageMemory::~SparseImageMemory() = default;
+
+std::pair<vk::Image, std::shared_ptr<SparseImageMemory>> SparseImageMemory::Create(
+    const Device& device, MemoryAllocator& allocator, Scheduler& scheduler, VkImageCreateInfo ci) {
+    ci.flags |= VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+    if (!IsSparseFormatSupported(device, ci)) {
+        return {};
+    }
+    vk::Image image = allocator.CreateSparseImage(ci);
+    const auto sparse_requirements = device.GetLogical().GetImageSparseMemoryRequirements(*image);
+    const auto requires_aspect = [&sparse_requirements](VkImageAspectFlags aspect) {
+        return std::ranges::find_if(sparse_requirements, [aspect](const auto& requirements) {
+            return (requirements.formatProperties.aspectMask & aspect) != 0;
+        });
+    };
+    const auto color = requires_aspect(VK_IMAGE_ASPECT_COLOR_BIT);
+    if (color == sparse_requirements.end() ||
+        requires_aspect(VK_IMAGE_ASPECT_METADATA_BIT) != sparse_requirements.end()) {
+        // Metadata has to be resident before the image is used, keep these images simple
+        return {};
+    }
+    auto memory = std::make_shared<SparseImageMemory>(device, allocator, scheduler, *image, ci,
+                                                      *color);
+    return {std::move(image), std::move(memory)};
+}
+
+void SparseImageMemory::Commit(const VideoCommon::SubresourceRange& range) {
+    boost::container::small_vector<VkSparseImageMemoryBind, 16> image_binds;
+    boost::container::small_vector<VkSparseMemoryBind, 4> opaque_binds;
+    const u32 first_tail_level = requirements.imageMipTailFirstLod;
+    const u32 base_level = static_cast<u32>(range.base.level);
+    const u32 base_layer = static_cast<u32>(range.base.layer);
+    const u32 end_level = (std::min)(base_level + range.extent.levels, num_levels);
+    const u32 end_layer = (std::min)(base_layer + range.extent.layers, num_layers);
+    for (u32 layer = base_layer; layer < end_layer; ++layer) {
+        for (u32 level = base_level; level < end_level; ++level) {
+            if (level >= first_tail_level) {
+                // All the levels from here are packed in the mip tail
+                const u32 tail = is_single_mip_tail ? 0 : layer;
+                if (!resident_tails[tail]) {
+                    resident_tails[tail] = true;
+                    opaque_binds.push_back(CommitMipTail(tail));
+                }
+                break;
+            }
+            const size_t index = static_cast<size_t>(layer) * num_levels + level;
+            if (!resident_levels[index]) {
+                resident_levels[index] = true;
+                image_binds.push_back(CommitLevel(level, layer));
+            }
+        }
+    }
+    if (image_binds.empty() && opaque_binds.empty()) {
+        return;
+    }
+    Bind({image_binds.data(), image_binds.size()}, {opaque_binds.data(), opaque_binds.size()});
+}
+
+void SparseImageMemory::CommitAll() {
+    Commit(VideoCommon::SubresourceRange{
+        .base = {.level = 0, .layer = 0},
+        .extent = {.levels = static_cast<s32>(num_levels), .layers = static_cast<s32>(num_layers)},
+    });
+}
+
+VkSparseImageMemoryBind SparseImageMemory::CommitLevel(u32 level, u32 layer) {
+    const VkExtent3D& granularity = requirements.formatProperties.imageGranularity;
+    const VkExtent3D level_extent{
+        .width = (std::max)(extent.width >> level, 1U),
+        .height = (std::max)(extent.height >> level, 1U),
+        .depth = 1,
+    };
+    const u64 num_blocks = u64{Common::DivCeil(level_extent.width, granularity.width)} *
+                           Common::DivCeil(level_extent.height, granularity.height);
+    // Binding the whole level is valid even when its size isn't a multiple of the granularity
+    const MemoryCommit& commit = CommitBlocks(num_blocks * block_size);
+    return VkSparseImageMemoryBind{
+        .subresource =
+            {
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .mipLevel = level,
+                .arrayLayer = layer,
+            },
+        .offset = {0, 0, 0},
+        .extent = level_extent,
+        .memory = commit.Memory(),
+        .memoryOffset = commit.Offset(),
+        .flags = 0,
+    };
+}
+
+VkSparseMemoryBind SparseImageMemory::CommitMipTail(u32 tail) {
+    const MemoryCommit& commit = CommitBlocks(requirements.imageMipTailSize);
+    return VkSparseMemoryBind{
+        .resourceOffset =
+            requirements.imageMipTailOffset + tail * requirements.imageMipTailStride,
+        .size = requirements.imageMipTailSize,
+        .memory = commit.Memory(),
+        .memoryOffset = commit.Offset(),
+        .flags = 0,
+    };
+}
+
+const MemoryCommit& SparseImageMemory::CommitBlocks(u64 size) {
+    return commits.emplace_back(allocator.Commit(
+        VkMemoryRequirements{
+            .size = size,
+            .alignment = block_size,
+            .memoryTypeBits = memory_type_bits,
+        },
+        MemoryUsage::DeviceLocal));
+}
+
+void SparseImageMemory::Bind(std::span<const VkSparseImageMemoryBind> image_binds,
+                             std::span<const VkSparseMemoryBind> opaque_binds) {
+    const VkSparseImageMemoryBindInfo image_bind_info{
+        .image = image,
+        .bindCount = static_cast<u32>(image_binds.size()),
+        .pBinds = image_binds.data(),
+    };
+    const VkSparseImageOpaqueMemoryBindInfo opaque_bind_info{
+        .image = image,
+        .bindCount = static_cast<u32>(opaque_binds.size()),
+        .pBinds = opaque_binds.data(),
+    };
+    const VkBindSparseInfo bind_info{
+        .sType = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO,
+        .pNext = nullptr,
+        .waitSemaphoreCount = 0,
+        .pWaitSemaphores = nullptr,
+        .bufferBindCount = 0,
+        .pBufferBinds = nullptr,
+        .imageOpaqueBindCount = opaque_binds.empty() ? 0U : 1U,
+        .pImageOpaqueBinds = &opaque_bind_info,
+        .imageBindCount = image_binds.empty() ? 0U : 1U,
+        .pImageBinds = &image_bind_info,
+        .signalSemaphoreCount = 0,
+        .pSignalSemaphores = nullptr,
+    };
+    VkResult result;
+    {
+        std::scoped_lock lock{scheduler.submit_mutex};
+        result = device.GetGraphicsQueue().BindSparse(bind_info, *fence);
+    }
+    if (result == VK_SUCCESS) {
+        // Sparse binding isn't ordered with the submissions that follow it on the queue. The work
+        // writing to the new memory is submitted later, so it's enough to let the binding finish
+        result = fence.Wait();
+    }
+    if (result == VK_ERROR_DEVICE_LOST) {
+        device.ReportLoss();
+    }
+    vk::Check(result);
+    fence.Reset();
+}
+
+} // namespace Vulkan
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/texture_cache/types.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class Device;
+class Scheduler;
+
+/// Memory of a sparse resident image, committed to each mipmap of each layer the first time the
+/// subresource is written, so the parts of an image that are never used take no memory
+class SparseImageMemory {
+public:
+    explicit SparseImageMemory(const Device& device, MemoryAllocator& allocator,
+                               Scheduler& scheduler, VkImage image, const VkImageCreateInfo& ci,
+                               const VkSparseImageMemoryRequirements& requirements);
+    ~SparseImageMemory();
+
+    SparseImageMemory(const SparseImageMemory&) = delete;
+    SparseImageMemory& operator=(const SparseImageMemory&) = delete;
+
+    /// Creates a sparse resident image with the given create info
+    /// Returns a null image when the device can't bind memory to the image by subresource
+    [[nodiscard]] static std::pair<vk::Image, std::shared_ptr<SparseImageMemory>> Create(
+        const Device& device, MemoryAllocator& allocator, Scheduler& scheduler,
+        VkImageCreateInfo ci);
+
+    /// Commits memory to the subresources in the range that don't have memory yet
+    void Commit(const VideoCommon::SubresourceRange& range);
+
+    /// Commits memory to all the subresources of the image
+    void CommitAll();
+
+private:
+    [[nodiscard]] VkSparseImageMemoryBind CommitLevel(u32 level, u32 layer);
+
+    [[nodiscard]] VkSparseMemoryBind CommitMipTail(u32 tail);
+
+    [[nodiscard]] const MemoryCommit& CommitBlocks(u64 size);
+
+    void Bind(std::span<const VkSparseImageMemoryBind> image_binds,
+              std::span<const VkSparseMemoryBind> opaque_binds);
+
+    const Device& device;
+    MemoryAllocator& allocator;
+    Scheduler& scheduler;
+    VkImage image;
+    VkExtent3D extent;
+    u32 num_levels;
+    u32 num_layers;
+    VkSparseImageMemoryRequirements requirements;
+    u64 block_size;
+    u32 memory_type_bits;
+    bool is_single_mip_tail;
+    vk::Fence fence;
+
+    std::vector<bool> resident_levels; ///< Levels before the mip tail, indexed by layer and level
+    std::vector<bool> resident_tails;  ///< Mip tails, one per layer unless it's shared by all
+    std::vector<MemoryCommit> commits;
+};
+
+} // namespace Vulkan
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -29,6 +30,8 @@ using namespace Common::Literals;
 constexpr VkDeviceSize MAX_ALIGNMENT = 256;
 // Stream buffer size in bytes
 constexpr VkDeviceSize MAX_STREAM_BUFFER_SIZE = 128_MiB;
+// Uniform stream buffer size in bytes
+constexpr VkDeviceSize UNIFORM_STREAM_BUFFER_SIZE = 16_MiB;
 
 size_t GetStreamBufferSize(const Device& device) {
     VkDeviceSize size{0};
@@ -47,20 +50,49 @@ size_t GetStreamBufferSize(const Device& device) {
     }
     return (std::min)(Common::AlignUp(size, MAX_ALIGNMENT), MAX_STREAM_BUFFER_SIZE);
 }
+
+/// Families of the queues reading uploads, the buffers are shared between them
+struct UploadQueueFamilies {
+    explicit UploadQueueFamilies(const Device& device) {
+        families[count++] = device.GetGraphicsFamily();
+        if (device.HasAsyncComputeQueue() &&
+            device.GetComputeFamily() != device.GetGraphicsFamily()) {
+            families[count++] = device.GetComputeFamily();
+        }
+        if (device.HasTransferQueue()) {
+            families[count++] = device.GetTransferFamily();
+        }
+    }
+
+    void Apply(VkBufferCreateInfo& ci) const noexcept {
+        if (count == 1) {
+            return;
+        }
+        ci.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        ci.queueFamilyIndexCount = count;
+        ci.pQueueFamilyIndices = families.data();
+    }
+
+    std::array<u32, 3> families{};
+    u32 count = 0;
+};
 } // Anonymous namespace
 
 StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& memory_allocator_,
                                      Scheduler& scheduler_)
     : device{device_}, memory_allocator{memory_allocator_}, scheduler{scheduler_},
-      stream_buffer_size{GetStreamBufferSize(device)}, region_size{stream_buffer_size /
-                                                                   StagingBufferPool::NUM_SYNCS} {
+      stream_buffer_size{GetStreamBufferSize(device)},
+      region_size{stream_buffer_size / StagingBufferPool::NUM_SYNCS},
+      uniform_alignment{(std::max<VkDeviceSize>)(device.GetUniformBufferAlignment(), 1)},
+      uniform_region_size{UNIFORM_STREAM_BUFFER_SIZE / StagingBufferPool::NUM_SYNCS} {
     VkBufferCreateInfo stream_ci = {
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
         .pNext = nullptr,
         .flags = 0,
         .size = stream_buffer_size,
         .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
-                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                 VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -68,12 +100,31 @@ StagingBufferPool::StagingBufferPool(const Device& device_, MemoryAllocator& mem
     if (device.IsExtTransformFeedbackSupported()) {
         stream_ci.usage |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT;
     }
+    const UploadQueueFamilies queue_families(device);
+    queue_families.Apply(stream_ci);
     stream_buffer = memory_allocator.CreateBuffer(stream_ci, MemoryUsage::Stream);
     if (device.HasDebuggingToolAttached()) {
         stream_buffer.SetObjectNameEXT("Stream Buffer");
     }
     stream_pointer = stream_buffer.Mapped();
     ASSERT_MSG(!stream_pointer.empty(), "Stream buffer must be host visible!");
+
+    const VkBufferCreateInfo uniform_ci = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .pNext = nullptr,
+        .flags = 0,
+        .size = UNIFORM_STREAM_BUFFER_SIZE,
+        .usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+        .queueFamilyIndexCount = 0,
+        .pQueueFamilyIndices = nullptr,
+    };
+    uniform_buffer = memory_allocator.CreateBuffer(uniform_ci, MemoryUsage::Stream);
+    if (device.HasDebuggingToolAttached()) {
+        uniform_buffer.SetObjectNameEXT("Uniform Stream Buffer");
+    }
+    uniform_pointer = uniform_buffer.Mapped();
+    ASSERT_MSG(!uniform_pointer.empty(), "Uniform stream buffer must be host visible!");
 }
 
 StagingBufferPool::~StagingBufferPool() = default;
@@ -97,6 +148,40 @@ void StagingBufferPool::FreeDeferred(StagingBufferRef& ref) {
     it->deferred = false;
 }
 
+StagingBufferRef StagingBufferPool::RequestUniform(size_t size) {
+    if (size == 0 || size > uniform_region_size) {
+        return Request(size, MemoryUsage::Upload);
+    }
+    size_t offset = Common::AlignUp(uniform_iterator, uniform_alignment);
+    if (offset + size > UNIFORM_STREAM_BUFFER_SIZE) {
+        offset = 0;
+    }
+    const size_t end = offset + size;
+    const size_t first_region = UniformRegion(offset);
+    const size_t last_region = UniformRegion(end - 1);
+    // Only the region being filled is known to be ours, entering another one requires the GPU to
+    // be done with its previous contents.
+    for (size_t region = first_region; region <= last_region; ++region) {
+        if (region != uniform_region && !scheduler.IsFree(uniform_sync_ticks[region])) {
+            // Avoid waiting for the previous usages to be free
+            return Request(size, MemoryUsage::Upload);
+        }
+    }
+    const u64 current_tick = scheduler.CurrentTick();
+    std::fill(uniform_sync_ticks.begin() + first_region,
+              uniform_sync_ticks.begin() + last_region + 1, current_tick);
+    uniform_region = last_region;
+    uniform_iterator = end;
+    return StagingBufferRef{
+        .buffer = *uniform_buffer,
+        .offset = static_cast<VkDeviceSize>(offset),
+        .mapped_span = uniform_pointer.subspan(offset, size),
+        .usage{},
+        .log2_level{},
+        .index{},
+    };
+}
+
 void StagingBufferPool::TickFrame() {
     current_delete_level = (current_delete_level + 1) % NUM_LEVELS;
 
@@ -189,7 +274,8 @@ StagingBufferRef StagingBufferPool::CreateStagingBuffer(size_t size, MemoryUsage
         .size = 1ULL << log2,
         .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
                  VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
-                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                 VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+                 VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
         .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
         .queueFamilyIndexCount = 0,
         .pQueueFamilyIndices = nullptr,
@@ -197,6 +283,8 @@ StagingBufferRef StagingBufferPool::CreateStagingBuffer(size_t size, MemoryUsage
     if (device.IsExtTransformFeedbackSupported()) {
         buffer_ci.usage |= VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT;
     }
+    const UploadQueueFamilies queue_families(device);
+    queue_families.Apply(buffer_ci);
     vk::Buffer buffer = memory_allocator.CreateBuffer(buffer_ci, usage);
     if (device.HasDebuggingToolAttached()) {
         ++buffer_index;
@@ -229,6 +317,19 @@ StagingBufferPool::StagingBuffersCache& StagingBufferPool::GetCache(MemoryUsage
     }
 }
 
+void StagingBufferPool::Trim() {
+    const auto is_deletable = [this](const StagingBuffer& entry) {
+        return scheduler.IsFree(entry.tick);
+    };
+    for (StagingBuffersCache* cache : {&device_local_cache, &upload_cache, &download_cache}) {
+        for (StagingBuffers& staging : *cache) {
+            std::erase_if(staging.entries, is_deletable);
+            staging.delete_index = 0;
+            staging.iterate_index = 0;
+        }
+    }
+}
+
 void StagingBufferPool::ReleaseCache(MemoryUsage usage) {
     ReleaseLevel(GetCache(usage), current_delete_level);
 }
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
@@ -36,12 +39,18 @@ public:
     StagingBufferRef Request(size_t size, MemoryUsage usage, bool deferred = false);
     void FreeDeferred(StagingBufferRef& ref);
 
+    /// Returns mapped memory for uniform data, packed back to back in a ring of its own
+    StagingBufferRef RequestUniform(size_t size);
+
     [[nodiscard]] VkBuffer StreamBuf() const noexcept {
         return *stream_buffer;
     }
 
     void TickFrame();
 
+    /// Destroys every cached staging buffer the GPU is done with.
+    void Trim();
+
 private:
     struct StreamBufferCommit {
         size_t upper_bound;
@@ -98,6 +107,10 @@ private:
         return iter / region_size;
     }
 
+    size_t UniformRegion(size_t iter) const noexcept {
+        return iter / uniform_region_size;
+    }
+
     const Device& device;
     MemoryAllocator& memory_allocator;
     Scheduler& scheduler;
@@ -112,6 +125,14 @@ private:
     size_t free_iterator = 0;
     std::array<u64, NUM_SYNCS> sync_ticks{};
 
+    vk::Buffer uniform_buffer;
+    std::span<u8> uniform_pointer;
+    VkDeviceSize uniform_alignment;
+    VkDeviceSize uniform_region_size;
+    size_t uniform_iterator = 0;
+    size_t uniform_region = NUM_SYNCS;
+    std::array<u64, NUM_SYNCS> uniform_sync_ticks{};
+
     StagingBuffersCache device_local_cache;
     StagingBuffersCache upload_cache;
     StagingBuffersCache download_cache;
@@ -55,6 +55,8 @@ Flags MakeInvalidationFlags() {
         DepthBiasEnable,
         LogicOpEnable,
         DepthClampEnable,
+        PolygonMode,
+        AlphaToCoverageEnable,
         LogicOp,
         Blending,
         ColorMask,
@@ -226,6 +228,13 @@ void SetupRasterModes(Tables &tables) {
 
     table[OFF(line_stipple_params)] = LineStippleParams;
     table[OFF(conservative_raster_enable)] = ConservativeRasterizationMode;
+    table[OFF(polygon_mode_front)] = PolygonMode;
+    table[OFF(polygon_mode_back)] = PolygonMode;
+    table[OFF(anti_alias_alpha_control)] = AlphaToCoverageEnable;
+
+    // The effective polygon mode depends on the faces being culled
+    tables[1][OFF(gl_cull_face)] = PolygonMode;
+    tables[1][OFF(gl_cull_test_enabled)] = PolygonMode;
 }
 } // Anonymous namespace
 
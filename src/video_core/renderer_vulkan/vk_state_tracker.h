@@ -61,6 +61,8 @@ enum : u8 {
     LogicOp,
     LogicOpEnable,
     DepthClampEnable,
+    PolygonMode,
+    AlphaToCoverageEnable,
 
     Blending,
     BlendEnable,
@@ -225,6 +227,14 @@ public:
         return Exchange(Dirty::DepthClampEnable, false);
     }
 
+    bool TouchPolygonMode() {
+        return Exchange(Dirty::PolygonMode, false);
+    }
+
+    bool TouchAlphaToCoverageEnable() {
+        return Exchange(Dirty::AlphaToCoverageEnable, false);
+    }
+
     bool TouchDepthCompareOp() {
         return Exchange(Dirty::DepthCompareOp, false);
     }
@@ -45,6 +45,13 @@ static VkPresentModeKHR ChooseSwapPresentMode(bool has_imm, bool has_mailbox,
     Settings::VSyncMode setting = [has_imm, has_mailbox]() {
         // Choose Mailbox or Immediate if unlocked and those modes are supported
         const auto mode = Settings::values.vsync_mode.GetValue();
+        if (Settings::values.native_presentation_active.load(std::memory_order_relaxed) &&
+            has_mailbox &&
+            (mode == Settings::VSyncMode::Fifo || mode == Settings::VSyncMode::FifoRelaxed)) {
+            // Fullscreen native windows skip composition, mailbox keeps them tear free without
+            // queueing frames behind the display
+            return Settings::VSyncMode::Mailbox;
+        }
         if (Settings::values.use_speed_limit.GetValue()) {
             return mode;
         }
@@ -202,9 +209,16 @@ bool Swapchain::AcquireNextImage() {
 
 void Swapchain::Present(VkSemaphore render_semaphore) {
     const auto present_queue{device.GetPresentQueue()};
+    const u64 next_present_id{present_id + 1};
+    const VkPresentIdKHR present_id_info{
+        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .pNext = nullptr,
+        .swapchainCount = 1,
+        .pPresentIds = &next_present_id,
+    };
     const VkPresentInfoKHR present_info{
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-        .pNext = nullptr,
+        .pNext = use_present_wait ? &present_id_info : nullptr,
         .waitSemaphoreCount = render_semaphore ? 1U : 0U,
         .pWaitSemaphores = &render_semaphore,
         .swapchainCount = 1,
@@ -229,12 +243,39 @@ void Swapchain::Present(VkSemaphore render_semaphore) {
         LOG_CRITICAL(Render_Vulkan, "Failed to present with error {}", string_VkResult(result));
         break;
     }
+    if (use_present_wait) {
+        present_id = next_present_id;
+    }
     ++frame_index;
     if (frame_index >= image_count) {
         frame_index = 0;
     }
 }
 
+void Swapchain::WaitForPresent(u64 queued_presents) {
+    if (!use_present_wait || present_id <= queued_presents) {
+        return;
+    }
+    // Don't block forever on presents that never reach the display, like on minimized windows.
+    static constexpr u64 timeout_ns = 100'000'000;
+    switch (const VkResult result =
+                swapchain.WaitForPresentKHR(present_id - queued_presents, timeout_ns)) {
+    case VK_SUCCESS:
+    case VK_TIMEOUT:
+    case VK_SUBOPTIMAL_KHR:
+        break;
+    case VK_ERROR_OUT_OF_DATE_KHR:
+        is_outdated = true;
+        break;
+    case VK_ERROR_SURFACE_LOST_KHR:
+        vk::Check(result);
+        break;
+    default:
+        LOG_ERROR(Render_Vulkan, "vkWaitForPresentKHR returned {}", string_VkResult(result));
+        break;
+    }
+}
+
 void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
     const auto physical_device{device.GetPhysical()};
 
@@ -256,6 +297,10 @@ void Swapchain::CreateSwapchain(const VkSurfaceCapabilitiesKHR& capabilities) {
     const VkCompositeAlphaFlagBitsKHR alpha_flags{ChooseAlphaFlags(capabilities)};
     surface_format = ChooseSwapSurfaceFormat(formats);
     present_mode = ChooseSwapPresentMode(has_imm, has_mailbox, has_fifo_relaxed);
+    // Other modes don't queue presents, waiting on them would only cap the frame rate.
+    use_present_wait = device.IsKhrPresentWaitSupported() &&
+                       (present_mode == VK_PRESENT_MODE_FIFO_KHR ||
+                        present_mode == VK_PRESENT_MODE_FIFO_RELAXED_KHR);
 
     u32 requested_image_count{capabilities.minImageCount + 1};
     // Ensure Triple buffering if possible.
@@ -350,6 +395,7 @@ void Swapchain::CreateSemaphores() {
 
 void Swapchain::Destroy() {
     frame_index = 0;
+    present_id = 0;
     present_semaphores.clear();
     render_semaphores.clear();
     swapchain.reset();
@@ -49,6 +49,9 @@ public:
     /// Presents the rendered image to the swapchain.
     void Present(VkSemaphore render_semaphore);
 
+    /// Waits until at most the given number of presents are queued but not displayed.
+    void WaitForPresent(u64 queued_presents);
+
     /// Returns true when the swapchain needs to be recreated.
     bool NeedsRecreation() const {
         return IsSubOptimal() || NeedsPresentModeUpdate();
@@ -155,6 +158,8 @@ private:
     bool has_imm{false};
     bool has_mailbox{false};
     bool has_fifo_relaxed{false};
+    bool use_present_wait{false};
+    u64 present_id{};
 
     bool is_outdated{};
     bool is_suboptimal{};
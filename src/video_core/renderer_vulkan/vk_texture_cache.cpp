@@ -12,7 +12,9 @@
 #include <boost/container/small_vector.hpp>
 #include <bit>
 #include <numeric>
+#include <tuple>
 #include "common/bit_util.h"
+#include "common/literals.h"
 #include "common/settings.h"
 
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
@@ -48,6 +50,11 @@ using VideoCore::Surface::IsPixelFormatInteger;
 using VideoCore::Surface::SurfaceType;
 
 namespace {
+using namespace Common::Literals;
+
+/// Images at least this large can be created sparse resident
+constexpr u64 SPARSE_RESIDENCY_MIN_SIZE = 32_MiB;
+
 constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     if (color == std::array<float, 4>{0, 0, 0, 0}) {
         return VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
@@ -160,13 +167,12 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     };
 }
 
-[[nodiscard]] vk::Image MakeImage(const Device& device, const MemoryAllocator& allocator,
-                                  const ImageInfo& info, std::span<const VkFormat> view_formats) {
-    if (info.type == ImageType::Buffer) {
-        return vk::Image{};
-    }
+/// Create info of a cached image, format_list is chained to it when the views need one
+[[nodiscard]] VkImageCreateInfo MakeImageCreateInfo(const Device& device, const ImageInfo& info,
+                                                    std::span<const VkFormat> view_formats,
+                                                    VkImageFormatListCreateInfo& format_list) {
     VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info);
-    const VkImageFormatListCreateInfo image_format_list = {
+    format_list = VkImageFormatListCreateInfo{
         .sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO,
         .pNext = nullptr,
         .viewFormatCount = static_cast<u32>(view_formats.size()),
@@ -175,12 +181,47 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     if (view_formats.size() > 1) {
         image_ci.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
         if (device.IsKhrImageFormatListSupported()) {
-            image_ci.pNext = &image_format_list;
+            image_ci.pNext = &format_list;
+        }
+    }
+    return image_ci;
+}
+
+void AddHostTransferUsage(const Device& device, VkImageCreateInfo& image_ci) {
+    if (device.IsExtHostImageCopySupported() && image_ci.samples == VK_SAMPLE_COUNT_1_BIT &&
+        device.IsHostImageCopyFormatSupported(image_ci.format)) {
+        // Don't trade device performance for faster uploads, e.g. by losing render target
+        // compression.
+        image_ci.usage |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+        if (!device.IsHostImageCopyOptimal(image_ci)) {
+            image_ci.usage &= ~VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
         }
     }
+}
+
+[[nodiscard]] vk::Image MakeImage(const Device& device, const MemoryAllocator& allocator,
+                                  const ImageInfo& info, std::span<const VkFormat> view_formats) {
+    if (info.type == ImageType::Buffer) {
+        return vk::Image{};
+    }
+    VkImageFormatListCreateInfo format_list;
+    VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info, view_formats, format_list);
+    AddHostTransferUsage(device, image_ci);
     return allocator.CreateImage(image_ci);
 }
 
+/// Same as above, reusing the image of a destroyed image with the same create info if possible
+[[nodiscard]] vk::Image MakeImage(const Device& device, TransientImagePool& pool,
+                                  const ImageInfo& info, std::span<const VkFormat> view_formats) {
+    if (info.type == ImageType::Buffer) {
+        return vk::Image{};
+    }
+    VkImageFormatListCreateInfo format_list;
+    VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info, view_formats, format_list);
+    AddHostTransferUsage(device, image_ci);
+    return pool.Request(image_ci).image;
+}
+
 [[nodiscard]] vk::ImageView MakeStorageView(const vk::Device& device, u32 level, VkImage image,
                                             VkFormat format) {
     static constexpr VkImageViewUsageCreateInfo storage_image_view_usage_create_info{
@@ -227,6 +268,50 @@ constexpr VkBorderColor ConvertBorderColor(const std::array<float, 4>& color) {
     }
 }
 
+/// Returns true when the image should only have memory for the subresources that are written
+[[nodiscard]] bool UseSparseResidency(const Device& device, const ImageInfo& info,
+                                      u64 size_bytes) {
+    if (!Settings::values.sparse_texture_residency.GetValue() ||
+        !device.IsSparseResidencyImage2DSupported()) {
+        return false;
+    }
+    // Committing memory waits for the binding on the queue, limit it to large images with many
+    // subresources where some of them are likely never used
+    return info.type == ImageType::e2D && info.num_samples == 1 &&
+           ImageAspectMask(info.format) == VK_IMAGE_ASPECT_COLOR_BIT &&
+           (info.resources.layers > 1 || info.resources.levels > 1) &&
+           size_bytes >= SPARSE_RESIDENCY_MIN_SIZE;
+}
+
+[[nodiscard]] std::pair<vk::Image, std::shared_ptr<SparseImageMemory>> MakeSparseImage(
+    const Device& device, MemoryAllocator& allocator, Scheduler& scheduler, const ImageInfo& info,
+    std::span<const VkFormat> view_formats) {
+    VkImageFormatListCreateInfo format_list;
+    const VkImageCreateInfo image_ci = MakeImageCreateInfo(device, info, view_formats, format_list);
+    return SparseImageMemory::Create(device, allocator, scheduler, image_ci);
+}
+
+/// Returns the subresources covering the ones written by the copies, to bind memory to them at once
+template <typename Copy>
+[[nodiscard]] SubresourceRange WrittenRange(std::span<const Copy> copies,
+                                            VideoCommon::SubresourceLayers Copy::*subresource) {
+    s32 begin_level = (std::numeric_limits<s32>::max)();
+    s32 begin_layer = (std::numeric_limits<s32>::max)();
+    s32 end_level = 0;
+    s32 end_layer = 0;
+    for (const Copy& copy : copies) {
+        const VideoCommon::SubresourceLayers& layers = copy.*subresource;
+        begin_level = (std::min)(begin_level, layers.base_level);
+        begin_layer = (std::min)(begin_layer, layers.base_layer);
+        end_level = (std::max)(end_level, layers.base_level + 1);
+        end_layer = (std::max)(end_layer, layers.base_layer + layers.num_layers);
+    }
+    return SubresourceRange{
+        .base = {.level = begin_level, .layer = begin_layer},
+        .extent = {.levels = end_level - begin_level, .layers = end_layer - begin_layer},
+    };
+}
+
 [[nodiscard]] VkImageAspectFlags ImageViewAspectMask(const VideoCommon::ImageViewInfo& info) {
     if (info.IsRenderTarget()) {
         return ImageAspectMask(info.format);
@@ -852,15 +937,27 @@ TextureCacheRuntime::TextureCacheRuntime(const Device& device_, Scheduler& sched
                                          ComputePassDescriptorQueue& compute_pass_descriptor_queue)
     : device{device_}, scheduler{scheduler_}, memory_allocator{memory_allocator_},
       staging_buffer_pool{staging_buffer_pool_}, blit_image_helper{blit_image_helper_},
-      render_pass_cache{render_pass_cache_}, resolution{Settings::values.resolution_info} {
+      render_pass_cache{render_pass_cache_}, transient_image_pool{memory_allocator, scheduler},
+      resolution{Settings::values.resolution_info} {
     if (Settings::values.accelerate_astc.GetValue() == Settings::AstcDecodeMode::Gpu) {
         astc_decoder_pass.emplace(device, scheduler, descriptor_pool, staging_buffer_pool,
                                   compute_pass_descriptor_queue, memory_allocator);
+        if (Settings::values.astc_recompression.GetValue() !=
+            Settings::AstcRecompression::Uncompressed) {
+            bcn_encoder_pass.emplace(device, scheduler, descriptor_pool, staging_buffer_pool,
+                                     compute_pass_descriptor_queue);
+        }
+    }
+    if (!device.IsOptimalBcnSupported()) {
+        bcn_decoder_pass.emplace(device, scheduler, descriptor_pool, compute_pass_descriptor_queue);
     }
     if (device.IsStorageImageMultisampleSupported()) {
         msaa_copy_pass = std::make_unique<MSAACopyPass>(
             device, scheduler, descriptor_pool, staging_buffer_pool, compute_pass_descriptor_queue);
     }
+    if (device.IsKhrFragmentShadingRateSupported()) {
+        foveated_shading.emplace(device, scheduler, memory_allocator, staging_buffer_pool);
+    }
     if (!device.IsKhrImageFormatListSupported()) {
         return;
     }
@@ -885,9 +982,23 @@ void TextureCacheRuntime::Finish() {
 }
 
 StagingBufferRef TextureCacheRuntime::UploadStagingBuffer(size_t size) {
+    staging_upload_bytes += size;
     return staging_buffer_pool.Request(size, MemoryUsage::Upload);
 }
 
+StagingBufferRef TextureCacheRuntime::HostUploadBuffer(size_t size) {
+    host_upload_bytes += size;
+    host_upload_buffer.resize_destructive(size);
+    return StagingBufferRef{
+        .buffer = VK_NULL_HANDLE,
+        .offset = 0,
+        .mapped_span = std::span<u8>(host_upload_buffer.data(), size),
+        .usage = MemoryUsage::Upload,
+        .log2_level = 0,
+        .index = 0,
+    };
+}
+
 StagingBufferRef TextureCacheRuntime::DownloadStagingBuffer(size_t size, bool deferred) {
     return staging_buffer_pool.Request(size, MemoryUsage::Download, deferred);
 }
@@ -945,6 +1056,7 @@ void TextureCacheRuntime::BarrierFeedbackLoop() {
 
 void TextureCacheRuntime::ReinterpretImage(Image& dst, Image& src,
                                            std::span<const VideoCommon::ImageCopy> copies) {
+    dst.CommitMemory(copies);
     boost::container::small_vector<VkBufferImageCopy, 16> vk_in_copies(copies.size());
     boost::container::small_vector<VkBufferImageCopy, 16> vk_out_copies(copies.size());
     const VkImageAspectFlags src_aspect_mask = src.AspectMask();
@@ -1078,6 +1190,7 @@ void TextureCacheRuntime::BlitImage(Framebuffer* dst_framebuffer, ImageView& dst
                                     const Region2D& dst_region, const Region2D& src_region,
                                     Tegra::Engines::Fermi2D::Filter filter,
                                     Tegra::Engines::Fermi2D::Operation operation) {
+    dst.CommitMemory();
     const VkImageAspectFlags aspect_mask = ImageAspectMask(src.format);
     const bool is_dst_msaa = dst.Samples() != VK_SAMPLE_COUNT_1_BIT;
     const bool is_src_msaa = src.Samples() != VK_SAMPLE_COUNT_1_BIT;
@@ -1120,6 +1233,7 @@ void TextureCacheRuntime::BlitImage(Framebuffer* dst_framebuffer, ImageView& dst
     const VkImageSubresourceLayers src_layers = MakeSubresourceLayers(&src);
     const bool is_resolve = is_src_msaa && !is_dst_msaa;
     scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "BlitImage"};
     scheduler.Record([filter, dst_region, src_region, dst_image, src_image, dst_layers, src_layers,
                       aspect_mask, is_resolve](vk::CommandBuffer cmdbuf) {
         const std::array read_barriers{
@@ -1374,6 +1488,7 @@ bool TextureCacheRuntime::IsFormatScalable(PixelFormat format) {
 
 void TextureCacheRuntime::CopyImage(Image& dst, Image& src,
                                     std::span<const VideoCommon::ImageCopy> copies) {
+    dst.CommitMemory(copies);
     // As per the size-compatible formats section of vulkan, copy manually via ReinterpretImage
     // these images that aren't size-compatible
     if (BytesPerBlock(src.info.format) != BytesPerBlock(dst.info.format)) {
@@ -1401,6 +1516,7 @@ void TextureCacheRuntime::CopyImage(Image& dst, Image& src,
     const VkImage dst_image = dst.Handle();
     const VkImage src_image = src.Handle();
     scheduler.RequestOutsideRenderPassOperationContext();
+    const ScopedProfiledPass profiled_pass{scheduler, "CopyImage"};
     scheduler.Record([dst_image, src_image, aspect_mask, vk_copies](vk::CommandBuffer cmdbuf) {
         RangedBarrierRange dst_range;
         RangedBarrierRange src_range;
@@ -1486,6 +1602,7 @@ void TextureCacheRuntime::CopyImage(Image& dst, Image& src,
 
 void TextureCacheRuntime::CopyImageMSAA(Image& dst, Image& src,
                                         std::span<const VideoCommon::ImageCopy> copies) {
+    dst.CommitMemory(copies);
     const bool msaa_to_non_msaa = src.info.num_samples > 1 && dst.info.num_samples == 1;
     if (msaa_copy_pass) {
         return msaa_copy_pass->CopyImage(dst, src, copies, msaa_to_non_msaa);
@@ -1501,24 +1618,59 @@ u64 TextureCacheRuntime::GetDeviceMemoryUsage() const {
     return device.GetDeviceMemoryUsage();
 }
 
+u64 TextureCacheRuntime::GetDeviceMemoryBudget() const {
+    return device.GetDeviceMemoryBudget();
+}
+
 bool TextureCacheRuntime::CanReportMemoryUsage() const {
     return device.CanReportMemoryUsage();
 }
 
-void TextureCacheRuntime::TickFrame() {}
+size_t TextureCacheRuntime::GetMaxSamplers() const {
+    // Leave room for the samplers created outside of the texture cache, and count the extra
+    // sampler created for the default anisotropy
+    static constexpr u32 RESERVED_SAMPLERS = 64;
+    const u32 max_samplers = device.GetMaxSamplerAllocationCount();
+    if (max_samplers <= RESERVED_SAMPLERS * 2) {
+        return max_samplers / 2;
+    }
+    return (max_samplers - RESERVED_SAMPLERS) / 2;
+}
+
+void TextureCacheRuntime::TickFrame() {
+    if (staging_upload_bytes != 0 || host_upload_bytes != 0) {
+        LOG_DEBUG(Render_Vulkan, "Texture uploads: {} bytes staged, {} bytes copied from host",
+                  staging_upload_bytes, host_upload_bytes);
+    }
+    staging_upload_bytes = 0;
+    host_upload_bytes = 0;
+    transient_image_pool.TickFrame();
+}
+
+bool TextureCacheRuntime::CanUploadFromHost(const Image& image) const noexcept {
+    return image.CanUploadFromHost();
+}
 
 Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu_addr_,
              VAddr cpu_addr_)
     : VideoCommon::ImageBase(info_, gpu_addr_, cpu_addr_), scheduler{&runtime_.scheduler},
-      runtime{&runtime_}, original_image(MakeImage(runtime_.device, runtime_.memory_allocator, info,
-                                                   runtime->ViewFormats(info.format))),
-      aspect_mask(ImageAspectMask(info.format)) {
+      runtime{&runtime_}, aspect_mask(ImageAspectMask(info.format)), is_recyclable{true} {
+    if (UseSparseResidency(runtime->device, info, guest_size_bytes)) {
+        std::tie(original_image, sparse_memory) =
+            MakeSparseImage(runtime->device, runtime->memory_allocator, *scheduler, info,
+                            runtime->ViewFormats(info.format));
+    }
+    if (sparse_memory) {
+        // The pool hands images down with their memory, sparse images have it per subresource
+        is_recyclable = false;
+    } else {
+        original_image = MakeImage(runtime->device, runtime->transient_image_pool, info,
+                                   runtime->ViewFormats(info.format));
+    }
     if (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported()) {
         switch (Settings::values.accelerate_astc.GetValue()) {
         case Settings::AstcDecodeMode::Gpu:
-            if (Settings::values.astc_recompression.GetValue() ==
-                    Settings::AstcRecompression::Uncompressed &&
-                info.size.depth == 1) {
+            if (info.size.depth == 1) {
                 flags |= VideoCommon::ImageFlagBits::AcceleratedUpload;
             }
             break;
@@ -1532,6 +1684,9 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
         flags |= VideoCommon::ImageFlagBits::CostlyLoad;
     }
     if (IsPixelFormatBCn(info.format) && !runtime->device.IsOptimalBcnSupported()) {
+        if (BCnDecoderPass::IsFormatSupported(info.format) && info.size.depth == 1) {
+            flags |= VideoCommon::ImageFlagBits::AcceleratedUpload;
+        }
         flags |= VideoCommon::ImageFlagBits::Converted;
         flags |= VideoCommon::ImageFlagBits::CostlyLoad;
     }
@@ -1540,9 +1695,13 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
     }
     current_image = &Image::original_image;
     storage_image_views.resize(info.resources.levels);
-    if (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported() &&
-        Settings::values.astc_recompression.GetValue() ==
-            Settings::AstcRecompression::Uncompressed) {
+    const bool decodes_to_rgba8 =
+        (IsPixelFormatASTC(info.format) && !runtime->device.IsOptimalAstcSupported() &&
+         Settings::values.astc_recompression.GetValue() ==
+             Settings::AstcRecompression::Uncompressed) ||
+        (IsPixelFormatBCn(info.format) &&
+         True(flags & VideoCommon::ImageFlagBits::AcceleratedUpload));
+    if (decodes_to_rgba8) {
         const auto& device = runtime->device.GetLogical();
         for (s32 level = 0; level < info.resources.levels; ++level) {
             storage_image_views[level] =
@@ -1553,10 +1712,51 @@ Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, GPUVAddr gpu
 
 Image::Image(const VideoCommon::NullImageParams& params) : VideoCommon::ImageBase{params} {}
 
-Image::~Image() = default;
+Image::Image(TextureCacheRuntime& runtime_, const ImageInfo& info_, TransientImage&& image)
+    : VideoCommon::ImageBase(info_, 0, 0), scheduler{&runtime_.scheduler}, runtime{&runtime_},
+      original_image(std::move(image.image)), storage_image_views(std::move(image.views)),
+      aspect_mask(ImageAspectMask(info.format)), initialized{true} {
+    current_image = &Image::original_image;
+    storage_image_views.resize(info.resources.levels);
+}
+
+TransientImage Image::TakeTransient() noexcept {
+    return TransientImage{
+        .image = std::move(original_image),
+        .views = std::move(storage_image_views),
+    };
+}
+
+Image::~Image() {
+    if (!is_recyclable || !original_image) {
+        return;
+    }
+    // Cached images are destroyed well after their last use, hand the image down to the next one
+    // created with the same info instead of freeing its memory
+    VkImageFormatListCreateInfo format_list;
+    VkImageCreateInfo image_ci =
+        MakeImageCreateInfo(runtime->device, info, runtime->ViewFormats(info.format), format_list);
+    image_ci.usage = original_image.UsageFlags();
+    const u64 size_bytes = (std::max)(guest_size_bytes, unswizzled_size_bytes);
+    runtime->transient_image_pool.Recycle(image_ci, std::move(original_image), size_bytes);
+}
+
+void Image::CommitMemory(std::span<const VideoCommon::BufferImageCopy> copies) {
+    if (sparse_memory && !copies.empty()) {
+        sparse_memory->Commit(WrittenRange(copies, &VideoCommon::BufferImageCopy::image_subresource));
+    }
+}
+
+void Image::CommitMemory(std::span<const VideoCommon::ImageCopy> copies) {
+    if (sparse_memory && !copies.empty()) {
+        sparse_memory->Commit(WrittenRange(copies, &VideoCommon::ImageCopy::dst_subresource));
+    }
+}
 
 void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
                          std::span<const VideoCommon::BufferImageCopy> copies) {
+    CommitMemory(copies);
+
     // TODO: Move this to another API
     const bool is_rescaled = True(flags & ImageFlagBits::Rescaled);
     if (is_rescaled) {
@@ -1587,23 +1787,18 @@ void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
         image_ci.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
                          VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT;
 
-        // CHANGE: The previous stack-allocated wrapper was destroyed at function exit,
-        //         which could destroy VkImage before the GPU used it.
-        auto temp_wrapper = std::make_shared<Image>(*runtime, temp_info, 0, 0);
-        temp_wrapper->original_image = runtime->memory_allocator.CreateImage(image_ci);
-        temp_wrapper->current_image = &Image::original_image;
-        temp_wrapper->aspect_mask = aspect_mask;
-        temp_wrapper->initialized = true;
+        // The pool keeps the temporary image alive until the GPU is done with it
+        Image temp_wrapper(*runtime, temp_info, runtime->transient_image_pool.Request(image_ci));
 
         // Upload to the temporary non-MSAA image
         scheduler->RequestOutsideRenderPassOperationContext();
-        auto vk_copies = TransformBufferImageCopies(copies, offset, temp_wrapper->aspect_mask);
+        auto vk_copies = TransformBufferImageCopies(copies, offset, temp_wrapper.aspect_mask);
         const VkBuffer src_buffer = buffer;
-        const VkImage temp_vk_image = *temp_wrapper->original_image;
-        const VkImageAspectFlags vk_aspect_mask = temp_wrapper->aspect_mask;
+        const VkImage temp_vk_image = *temp_wrapper.original_image;
+        const VkImageAspectFlags vk_aspect_mask = temp_wrapper.aspect_mask;
 
-        scheduler->Record([src_buffer, temp_vk_image, vk_aspect_mask, vk_copies,
-                           keep = temp_wrapper](vk::CommandBuffer cmdbuf) {
+        scheduler->Record([src_buffer, temp_vk_image, vk_aspect_mask,
+                           vk_copies](vk::CommandBuffer cmdbuf) {
             CopyBufferToImage(cmdbuf, src_buffer, temp_vk_image, vk_aspect_mask, false, VideoCommon::FixSmallVectorADL(vk_copies));
         });
 
@@ -1620,12 +1815,10 @@ void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
             image_copies.push_back(image_copy);
         }
 
-        runtime->msaa_copy_pass->CopyImage(*this, *temp_wrapper, image_copies,
+        runtime->msaa_copy_pass->CopyImage(*this, temp_wrapper, image_copies,
                                            /*msaa_to_non_msaa=*/false);
         std::exchange(initialized, true);
-
-        const u64 tick = scheduler->Flush();
-        scheduler->Wait(tick);
+        runtime->transient_image_pool.Release(image_ci, temp_wrapper.TakeTransient());
 
         if (is_rescaled) {
             ScaleUp();
@@ -1633,6 +1826,11 @@ void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
         return;
     }
 
+    if (!is_rescaled && CanUploadOnTransferQueue(offset, copies)) {
+        UploadMemoryOnTransferQueue(buffer, offset, copies);
+        return;
+    }
+
     // Regular non-MSAA upload (original behavior preserved)
     scheduler->RequestOutsideRenderPassOperationContext();
     auto vk_copies = TransformBufferImageCopies(copies, offset, aspect_mask);
@@ -1652,9 +1850,200 @@ void Image::UploadMemory(VkBuffer buffer, VkDeviceSize offset,
 }
 
 void Image::UploadMemory(const StagingBufferRef& map, std::span<const BufferImageCopy> copies) {
+    if (map.buffer == VK_NULL_HANDLE) {
+        // Host memory from TextureCacheRuntime::HostUploadBuffer
+        UploadMemory(map.mapped_span, copies);
+        return;
+    }
+    // Large uploads are better off on the transfer queue when there's one
+    if (CanUploadBeforeSubmission() && !CanUploadOnTransferQueue(map.offset, copies)) {
+        UploadMemoryBeforeSubmission(map.buffer, map.offset, copies);
+        return;
+    }
     UploadMemory(map.buffer, map.offset, copies);
 }
 
+void Image::UploadMemory(std::span<const u8> host_memory,
+                         std::span<const VideoCommon::BufferImageCopy> copies) {
+    // The GPU has never accessed the image, so it can be written without waiting for it. Writes
+    // from the host are visible to every command buffer submitted afterwards.
+    const vk::Device& logical = runtime->device.GetLogical();
+    const VkImage vk_image = *original_image;
+    logical.TransitionImageLayoutEXT(VkHostImageLayoutTransitionInfoEXT{
+        .sType = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT,
+        .pNext = nullptr,
+        .image = vk_image,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .subresourceRange{
+            .aspectMask = aspect_mask,
+            .baseMipLevel = 0,
+            .levelCount = VK_REMAINING_MIP_LEVELS,
+            .baseArrayLayer = 0,
+            .layerCount = VK_REMAINING_ARRAY_LAYERS,
+        },
+    });
+    boost::container::small_vector<VkMemoryToImageCopyEXT, 16> regions;
+    regions.reserve(copies.size());
+    for (const BufferImageCopy& copy : copies) {
+        regions.push_back(VkMemoryToImageCopyEXT{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT,
+            .pNext = nullptr,
+            .pHostPointer = host_memory.data() + copy.buffer_offset,
+            .memoryRowLength = copy.buffer_row_length,
+            .memoryImageHeight = copy.buffer_image_height,
+            .imageSubresource{
+                .aspectMask = aspect_mask,
+                .mipLevel = static_cast<u32>(copy.image_subresource.base_level),
+                .baseArrayLayer = static_cast<u32>(copy.image_subresource.base_layer),
+                .layerCount = static_cast<u32>(copy.image_subresource.num_layers),
+            },
+            .imageOffset{
+                .x = copy.image_offset.x,
+                .y = copy.image_offset.y,
+                .z = copy.image_offset.z,
+            },
+            .imageExtent{
+                .width = copy.image_extent.width,
+                .height = copy.image_extent.height,
+                .depth = copy.image_extent.depth,
+            },
+        });
+    }
+    logical.CopyMemoryToImageEXT(VkCopyMemoryToImageInfoEXT{
+        .sType = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT,
+        .pNext = nullptr,
+        .flags = 0,
+        .dstImage = vk_image,
+        .dstImageLayout = VK_IMAGE_LAYOUT_GENERAL,
+        .regionCount = static_cast<u32>(regions.size()),
+        .pRegions = regions.data(),
+    });
+    initialized = true;
+}
+
+bool Image::CanUploadOnTransferQueue(VkDeviceSize offset,
+                                     std::span<const BufferImageCopy> copies) const noexcept {
+    // Only images the GPU has never used can be taken by the transfer queue without releasing
+    // them from the graphics queue first. Copy engines can't write depth or stencil aspects.
+    if (!scheduler->HasAsyncTransfer() || initialized || modification_tick != 0 ||
+        aspect_mask != VK_IMAGE_ASPECT_COLOR_BIT) {
+        return false;
+    }
+    const u64 threshold = u64{Settings::values.transfer_queue_threshold_kb.GetValue()} * 1024;
+    u64 upload_size = 0;
+    for (const BufferImageCopy& copy : copies) {
+        if ((offset + copy.buffer_offset) % 4 != 0) {
+            // Required by copies on queues without graphics or compute support
+            return false;
+        }
+        upload_size += copy.buffer_size;
+    }
+    return upload_size >= threshold;
+}
+
+bool Image::CanUploadBeforeSubmission() const noexcept {
+    // Commands recorded so far can't have used an image the GPU has never accessed, and staging
+    // buffers are written by the host before the submission, so nothing has to come before it
+    return !initialized && modification_tick == 0 && !is_rescaled && info.num_samples == 1;
+}
+
+void Image::UploadMemoryBeforeSubmission(VkBuffer buffer, VkDeviceSize offset,
+                                         std::span<const BufferImageCopy> copies) {
+    CommitMemory(copies);
+    auto vk_copies = TransformBufferImageCopies(copies, offset, aspect_mask);
+    const VkImage vk_image = *original_image;
+    const VkImageAspectFlags vk_aspect_mask = aspect_mask;
+    initialized = true;
+    scheduler->RecordUpload([buffer, vk_image, vk_aspect_mask,
+                             vk_copies](vk::CommandBuffer upload_cmdbuf) {
+        CopyBufferToImage(upload_cmdbuf, buffer, vk_image, vk_aspect_mask, false,
+                          VideoCommon::FixSmallVectorADL(vk_copies));
+    });
+}
+
+void Image::UploadMemoryOnTransferQueue(VkBuffer buffer, VkDeviceSize offset,
+                                        std::span<const BufferImageCopy> copies) {
+    const auto vk_copies = TransformBufferImageCopies(copies, offset, aspect_mask);
+    const VkImage vk_image = *original_image;
+    const u32 transfer_family = runtime->device.GetTransferFamily();
+    const u32 graphics_family = runtime->device.GetGraphicsFamily();
+    const VkImageSubresourceRange range{
+        .aspectMask = aspect_mask,
+        .baseMipLevel = 0,
+        .levelCount = VK_REMAINING_MIP_LEVELS,
+        .baseArrayLayer = 0,
+        .layerCount = VK_REMAINING_ARRAY_LAYERS,
+    };
+    initialized = true;
+    scheduler->RecordAsyncTransfer([buffer, vk_image, range, vk_copies, transfer_family,
+                                    graphics_family](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier write_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_NONE,
+            .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        const VkImageMemoryBarrier release_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_NONE,
+            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = transfer_family,
+            .dstQueueFamilyIndex = graphics_family,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0, write_barrier);
+        cmdbuf.CopyBufferToImage(buffer, vk_image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 VideoCommon::FixSmallVectorADL(vk_copies));
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, release_barrier);
+    });
+    scheduler->RequestOutsideRenderPassOperationContext();
+    scheduler->Record([vk_image, range, transfer_family,
+                       graphics_family](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier acquire_barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_NONE,
+            .dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = transfer_family,
+            .dstQueueFamilyIndex = graphics_family,
+            .image = vk_image,
+            .subresourceRange = range,
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                               VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, acquire_barrier);
+    });
+    // Start the copy while the rest of the frame is being recorded
+    scheduler->DispatchWork();
+}
+
+bool Image::CanUploadFromHost() const noexcept {
+    // Images written by the GPU or already uploaded might be in use by pending command buffers,
+    // those are still uploaded through staging buffers.
+    if (!original_image || initialized || modification_tick != 0) {
+        return false;
+    }
+    if (True(flags & (ImageFlagBits::AcceleratedUpload | ImageFlagBits::Rescaled))) {
+        return false;
+    }
+    return aspect_mask == VK_IMAGE_ASPECT_COLOR_BIT &&
+           (original_image.UsageFlags() & VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT) != 0;
+}
+
 void Image::DownloadMemory(VkBuffer buffer, size_t offset,
                            std::span<const VideoCommon::BufferImageCopy> copies) {
     std::array buffer_handles{
@@ -1682,13 +2071,9 @@ void Image::DownloadMemory(std::span<VkBuffer> buffers_span, std::span<size_t> o
 
             VkImageCreateInfo image_ci = MakeImageCreateInfo(runtime->device, temp_info);
             image_ci.usage = original_image.UsageFlags();
-            vk::Image temp_image = runtime->memory_allocator.CreateImage(image_ci);
-
-            Image temp_wrapper(*runtime, temp_info, 0, 0);
-            temp_wrapper.original_image = std::move(temp_image);
-            temp_wrapper.current_image = &Image::original_image;
-            temp_wrapper.aspect_mask = aspect_mask;
-            temp_wrapper.initialized = true;
+            // The pool keeps the temporary image alive until the GPU is done with it
+            Image temp_wrapper(*runtime, temp_info,
+                               runtime->transient_image_pool.Request(image_ci));
 
             std::vector<VideoCommon::ImageCopy> image_copies;
             for (const auto& copy : copies) {
@@ -1768,6 +2153,7 @@ void Image::DownloadMemory(std::span<VkBuffer> buffers_span, std::span<size_t> o
                 cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                        0, memory_write_barrier, nullptr, image_write_barrier);
             });
+            runtime->transient_image_pool.Release(image_ci, temp_wrapper.TakeTransient());
             return;
         }
     } else {
@@ -1855,6 +2241,13 @@ void Image::DownloadMemory(const StagingBufferRef& map, std::span<const BufferIm
 VkImageView Image::StorageImageView(s32 level) noexcept {
     auto& view = storage_image_views[level];
     if (!view) {
+        if (sparse_memory) {
+            // Storage views of the image are written by the decoding passes
+            sparse_memory->Commit(SubresourceRange{
+                .base = {.level = level, .layer = 0},
+                .extent = {.levels = 1, .layers = info.resources.layers},
+            });
+        }
         const auto format_info =
             MaxwellToVK::SurfaceFormat(runtime->device, FormatType::Optimal, true, info.format);
         view = MakeStorageView(runtime->device.GetLogical(), level, *(this->*current_image),
@@ -1918,6 +2311,9 @@ bool Image::ScaleDown(bool ignore) {
     if (ignore) {
         return true;
     }
+    if (sparse_memory) {
+        sparse_memory->CommitAll();
+    }
     if (aspect_mask == 0) {
         aspect_mask = ImageAspectMask(info.format);
     }
@@ -2010,7 +2406,7 @@ ImageView::ImageView(TextureCacheRuntime& runtime, const VideoCommon::ImageViewI
                      ImageId image_id_, Image& image)
     : VideoCommon::ImageViewBase{info, image.info, image_id_, image.gpu_addr},
       device{&runtime.device}, image_handle{image.Handle()},
-      samples(ConvertSampleCount(image.info.num_samples)) {
+      samples(ConvertSampleCount(image.info.num_samples)), sparse_memory{image.SparseMemory()} {
     using Shader::TextureType;
 
     const VkImageAspectFlags aspect_mask = ImageViewAspectMask(info);
@@ -2029,7 +2425,9 @@ ImageView::ImageView(TextureCacheRuntime& runtime, const VideoCommon::ImageViewI
         }
     }
     const auto format_info = MaxwellToVK::SurfaceFormat(*device, FormatType::Optimal, true, format);
-    if (ImageUsageFlags(format_info, format) != image.UsageFlags()) {
+    // Host transfers are not a view usage
+    const VkImageUsageFlags image_usage = image.UsageFlags() & ~VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+    if (ImageUsageFlags(format_info, format) != image_usage) {
         LOG_WARNING(Render_Vulkan,
                     "Image view format {} has different usage flags than image format {}", format,
                     image.info.format);
@@ -2165,6 +2563,7 @@ VkImageView ImageView::StorageView(Shader::TextureType texture_type,
     if (!image_handle) {
         return VK_NULL_HANDLE;
     }
+    CommitMemory();
     if (image_format == Shader::ImageFormat::Typeless) {
         return Handle(texture_type);
     }
@@ -2277,7 +2676,7 @@ Framebuffer::Framebuffer(TextureCacheRuntime& runtime, std::span<ImageView*, NUM
           .height = key.size.height,
       }} {
     CreateFramebuffer(runtime, color_buffers, depth_buffer, key.is_rescaled);
-    if (runtime.device.HasDebuggingToolAttached()) {
+    if (framebuffer && runtime.device.HasDebuggingToolAttached()) {
         framebuffer.SetObjectNameEXT(VideoCommon::Name(key).c_str());
     }
 }
@@ -2295,12 +2694,22 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
                                     std::span<ImageView*, NUM_RT> color_buffers,
                                     ImageView* depth_buffer, bool is_rescaled_) {
     boost::container::small_vector<VkImageView, NUM_RT + 1> attachments;
-    RenderPassKey renderpass_key{};
+    std::array<u32, 9> bytes_per_pixel{};
     s32 num_layers = 1;
 
     is_rescaled = is_rescaled_;
     const auto& resolution = runtime.resolution;
 
+    // Attachments are written, the framebuffer is created before any pass renders to them
+    for (ImageView* const color_buffer : color_buffers) {
+        if (color_buffer) {
+            color_buffer->CommitMemory();
+        }
+    }
+    if (depth_buffer) {
+        depth_buffer->CommitMemory();
+    }
+
     u32 width = (std::numeric_limits<u32>::max)();
     u32 height = (std::numeric_limits<u32>::max)();
     for (size_t index = 0; index < NUM_RT; ++index) {
@@ -2314,10 +2723,13 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         height = (std::min)(height, is_rescaled ? resolution.ScaleUp(color_buffer->size.height)
                                               : color_buffer->size.height);
         attachments.push_back(color_buffer->RenderTarget());
+        rendering_attachments.color_views[index] = color_buffer->RenderTarget();
+        rendering_attachments.num_color_views = static_cast<u32>(index + 1);
         renderpass_key.color_formats[index] = color_buffer->format;
         num_layers = (std::max)(num_layers, color_buffer->range.extent.layers);
         images[num_images] = color_buffer->ImageHandle();
         image_ranges[num_images] = MakeSubresourceRange(color_buffer);
+        bytes_per_pixel[num_images] = BytesPerBlock(color_buffer->format);
         rt_map[index] = num_images;
         samples = color_buffer->Samples();
         ++num_images;
@@ -2329,11 +2741,13 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
         height = (std::min)(height, is_rescaled ? resolution.ScaleUp(depth_buffer->size.height)
                                               : depth_buffer->size.height);
         attachments.push_back(depth_buffer->RenderTarget());
+        rendering_attachments.depth_stencil_view = depth_buffer->RenderTarget();
         renderpass_key.depth_format = depth_buffer->format;
         num_layers = (std::max)(num_layers, depth_buffer->range.extent.layers);
         images[num_images] = depth_buffer->ImageHandle();
         const VkImageSubresourceRange subresource_range = MakeSubresourceRange(depth_buffer);
         image_ranges[num_images] = subresource_range;
+        bytes_per_pixel[num_images] = BytesPerBlock(depth_buffer->format);
         samples = depth_buffer->Samples();
         ++num_images;
         has_depth = (subresource_range.aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT) != 0;
@@ -2343,11 +2757,31 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
     }
     renderpass_key.samples = samples;
 
+    render_pass_cache = &runtime.render_pass_cache;
     renderpass = runtime.render_pass_cache.Get(renderpass_key);
     render_area.width = (std::min)(render_area.width, width);
     render_area.height = (std::min)(render_area.height, height);
+    const u64 num_samples = static_cast<u64>((std::max)(num_layers, 1)) * samples *
+                            render_area.width * render_area.height;
+    for (u32 index = 0; index < num_images; ++index) {
+        image_sizes[index] = num_samples * bytes_per_pixel[index];
+    }
 
     num_color_buffers = static_cast<u32>(num_colors);
+    rendering_attachments.layers = static_cast<u32>((std::max)(num_layers, 1));
+    rendering_attachments.has_depth = has_depth;
+    rendering_attachments.has_stencil = has_stencil;
+    // Only shade upscaled targets coarser, at native resolution it would lose detail
+    if (runtime.foveated_shading && is_rescaled && runtime.resolution.active &&
+        !runtime.resolution.downscale && samples == VK_SAMPLE_COUNT_1_BIT &&
+        rendering_attachments.num_color_views > 0 && rendering_attachments.layers == 1) {
+        rendering_attachments.shading_rate_view = runtime.foveated_shading->Map(render_area);
+        rendering_attachments.shading_rate_texel_size = runtime.foveated_shading->TexelSize();
+    }
+    if (runtime.render_pass_cache.UsesDynamicRendering()) {
+        // The render pass is still needed to key pipelines, but there's nothing to bind views to
+        return;
+    }
     framebuffer = runtime.device.GetLogical().CreateFramebuffer({
         .sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
         .pNext = nullptr,
@@ -2361,13 +2795,65 @@ void Framebuffer::CreateFramebuffer(TextureCacheRuntime& runtime,
     });
 }
 
+VkRenderPass Framebuffer::ClearRenderPass(u32 clear_mask) const {
+    RenderPassKey key = renderpass_key;
+    key.clear_mask = clear_mask;
+    return render_pass_cache->Get(key);
+}
+
 void TextureCacheRuntime::AccelerateImageUpload(
     Image& image, const StagingBufferRef& map,
     std::span<const VideoCommon::SwizzleParameters> swizzles) {
-    if (IsPixelFormatASTC(image.info.format)) {
+    if (IsPixelFormatBCn(image.info.format)) {
+        return bcn_decoder_pass->Decode(image, map, swizzles);
+    }
+    if (!IsPixelFormatASTC(image.info.format)) {
+        ASSERT(false);
+        return;
+    }
+    if (!bcn_encoder_pass) {
         return astc_decoder_pass->Assemble(image, map, swizzles);
     }
-    ASSERT(false);
+    // Decode to a scratch RGBA8 image and encode that to the BCn format the image was created with
+    VkImageCreateInfo scratch_ci = MakeImageCreateInfo(device, image.info);
+    scratch_ci.format = VK_FORMAT_A8B8G8R8_UNORM_PACK32;
+    scratch_ci.usage = VK_IMAGE_USAGE_STORAGE_BIT;
+    TransientImage transient = transient_image_pool.Request(scratch_ci);
+    if (transient.views.empty()) {
+        for (s32 level = 0; level < image.info.resources.levels; ++level) {
+            transient.views.push_back(MakeStorageView(device.GetLogical(), level, *transient.image,
+                                                      VK_FORMAT_A8B8G8R8_UNORM_PACK32));
+        }
+    }
+    Image scratch(*this, image.info, std::move(transient));
+    scheduler.RequestOutsideRenderPassOperationContext();
+    scheduler.Record([scratch_image = scratch.Handle()](vk::CommandBuffer cmdbuf) {
+        const VkImageMemoryBarrier barrier{
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .pNext = nullptr,
+            .srcAccessMask = VK_ACCESS_NONE,
+            .dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = scratch_image,
+            .subresourceRange{
+                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                .baseMipLevel = 0,
+                .levelCount = VK_REMAINING_MIP_LEVELS,
+                .baseArrayLayer = 0,
+                .layerCount = VK_REMAINING_ARRAY_LAYERS,
+            },
+        };
+        cmdbuf.PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                               VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, barrier);
+    });
+    astc_decoder_pass->Assemble(scratch, map, swizzles);
+    const bool encode_alpha =
+        Settings::values.astc_recompression.GetValue() == Settings::AstcRecompression::Bc3;
+    bcn_encoder_pass->Encode(image, scratch, encode_alpha);
+    transient_image_pool.Release(scratch_ci, scratch.TakeTransient());
 }
 
 void TextureCacheRuntime::TransitionImageLayout(Image& image) {
@@ -1,15 +1,24 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #pragma once
 
+#include <memory>
 #include <span>
+#include <utility>
 
 #include "video_core/texture_cache/texture_cache_base.h"
 
 #include "shader_recompiler/shader_info.h"
 #include "video_core/renderer_vulkan/vk_compute_pass.h"
+#include "video_core/renderer_vulkan/vk_foveated_shading.h"
+#include "video_core/renderer_vulkan/vk_render_pass_cache.h"
+#include "video_core/renderer_vulkan/vk_sparse_image.h"
 #include "video_core/renderer_vulkan/vk_staging_buffer_pool.h"
+#include "video_core/renderer_vulkan/vk_transient_image_pool.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/vulkan_common/vulkan_memory_allocator.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
@@ -50,6 +59,10 @@ public:
 
     StagingBufferRef UploadStagingBuffer(size_t size);
 
+    /// Returns host memory for an upload written with VK_EXT_host_image_copy.
+    /// The reference has no buffer, images are written directly from its mapped span.
+    StagingBufferRef HostUploadBuffer(size_t size);
+
     StagingBufferRef DownloadStagingBuffer(size_t size, bool deferred = false);
 
     void FreeDeferredStagingBuffer(StagingBufferRef& ref);
@@ -60,8 +73,12 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    u64 GetDeviceMemoryBudget() const;
+
     bool CanReportMemoryUsage() const;
 
+    size_t GetMaxSamplers() const;
+
     void BlitImage(Framebuffer* dst_framebuffer, ImageView& dst, ImageView& src,
                    const Region2D& dst_region, const Region2D& src_region,
                    Tegra::Engines::Fermi2D::Filter filter,
@@ -85,6 +102,8 @@ public:
         return msaa_copy_pass.operator bool();
     }
 
+    bool CanUploadFromHost(const Image& image) const noexcept;
+
     void AccelerateImageUpload(Image&, const StagingBufferRef&,
                                std::span<const VideoCommon::SwizzleParameters>);
 
@@ -122,10 +141,18 @@ public:
     BlitImageHelper& blit_image_helper;
     RenderPassCache& render_pass_cache;
     std::optional<ASTCDecoderPass> astc_decoder_pass;
+    std::optional<BCnEncoderPass> bcn_encoder_pass;
+    std::optional<BCnDecoderPass> bcn_decoder_pass;
     std::unique_ptr<MSAACopyPass> msaa_copy_pass;
+    std::optional<FoveatedShading> foveated_shading;
+    TransientImagePool transient_image_pool;
     const Settings::ResolutionScalingInfo& resolution;
     std::array<std::vector<VkFormat>, VideoCore::Surface::MaxPixelFormat> view_formats;
 
+    Common::ScratchBuffer<u8> host_upload_buffer;
+    u64 staging_upload_bytes = 0; ///< Bytes uploaded through staging buffers this frame
+    u64 host_upload_bytes = 0;    ///< Bytes written from the host this frame
+
     static constexpr size_t indexing_slots = 8 * sizeof(size_t);
     std::array<vk::Buffer, indexing_slots> buffers{};
 };
@@ -136,6 +163,10 @@ public:
                    VAddr cpu_addr);
     explicit Image(const VideoCommon::NullImageParams&);
 
+    /// Wraps a scratch image owned by the caller, used as the operand of internal passes
+    explicit Image(TextureCacheRuntime&, const VideoCommon::ImageInfo& info,
+                   TransientImage&& image);
+
     ~Image();
 
     Image(const Image&) = delete;
@@ -150,6 +181,9 @@ public:
     void UploadMemory(const StagingBufferRef& map,
                       std::span<const VideoCommon::BufferImageCopy> copies);
 
+    void UploadMemory(std::span<const u8> host_memory,
+                      std::span<const VideoCommon::BufferImageCopy> copies);
+
     void DownloadMemory(VkBuffer buffer, size_t offset,
                         std::span<const VideoCommon::BufferImageCopy> copies);
 
@@ -171,11 +205,30 @@ public:
         return (this->*current_image).UsageFlags();
     }
 
+    /// Returns the memory of the image when it's sparse resident, null otherwise
+    [[nodiscard]] const std::shared_ptr<SparseImageMemory>& SparseMemory() const noexcept {
+        return sparse_memory;
+    }
+
+    /// Commits memory to the subresources written by the copies, if the image is sparse resident
+    void CommitMemory(std::span<const VideoCommon::BufferImageCopy> copies);
+
+    /// Commits memory to the subresources written by the copies, if the image is sparse resident
+    void CommitMemory(std::span<const VideoCommon::ImageCopy> copies);
+
+    /// Returns true when the image has been initialized
+    [[nodiscard]] bool IsInitialized() const noexcept {
+        return initialized;
+    }
+
     /// Returns true when the image is already initialized and mark it as initialized
     [[nodiscard]] bool ExchangeInitialization() noexcept {
         return std::exchange(initialized, true);
     }
 
+    /// Returns true when the image can be written from the host without synchronizing with the GPU
+    [[nodiscard]] bool CanUploadFromHost() const noexcept;
+
     VkImageView StorageImageView(s32 level) noexcept;
 
     bool IsRescaled() const noexcept;
@@ -184,7 +237,24 @@ public:
 
     bool ScaleDown(bool ignore = false);
 
+    /// Hands the image of a scratch wrapper back, to give it to the transient image pool
+    [[nodiscard]] TransientImage TakeTransient() noexcept;
+
 private:
+    /// Returns true when an upload is worth recording to the dedicated transfer queue
+    [[nodiscard]] bool CanUploadOnTransferQueue(
+        VkDeviceSize offset, std::span<const VideoCommon::BufferImageCopy> copies) const noexcept;
+
+    void UploadMemoryOnTransferQueue(VkBuffer buffer, VkDeviceSize offset,
+                                     std::span<const VideoCommon::BufferImageCopy> copies);
+
+    /// Returns true when a staged upload can be recorded to the upload command buffer, which runs
+    /// before the rest of the submission, instead of ending the current render pass
+    [[nodiscard]] bool CanUploadBeforeSubmission() const noexcept;
+
+    void UploadMemoryBeforeSubmission(VkBuffer buffer, VkDeviceSize offset,
+                                      std::span<const VideoCommon::BufferImageCopy> copies);
+
     bool BlitScaleHelper(bool scale_up);
 
     bool NeedsScaleHelper() const;
@@ -194,6 +264,7 @@ private:
 
     vk::Image original_image;
     vk::Image scaled_image;
+    std::shared_ptr<SparseImageMemory> sparse_memory;
 
     // Use a pointer to field because it is relative, so that the object can be
     // moved without breaking the reference.
@@ -202,6 +273,8 @@ private:
     std::vector<vk::ImageView> storage_image_views;
     VkImageAspectFlags aspect_mask = 0;
     bool initialized = false;
+    /// Set on cached images, their image goes to the transient image pool when destroyed
+    bool is_recyclable = false;
 
     std::unique_ptr<Framebuffer> scale_framebuffer;
     std::unique_ptr<ImageView> scale_view;
@@ -238,6 +311,14 @@ public:
 
     [[nodiscard]] bool IsRescaled() const noexcept;
 
+    /// Commits memory to the subresources of the view before it's written, if its image is sparse
+    /// resident
+    void CommitMemory() {
+        if (sparse_memory && !std::exchange(is_memory_committed, true)) {
+            sparse_memory->Commit(range);
+        }
+    }
+
     [[nodiscard]] VkImageView Handle(Shader::TextureType texture_type) const noexcept {
         return *image_views[static_cast<size_t>(texture_type)];
     }
@@ -282,6 +363,8 @@ private:
     VkImage image_handle = VK_NULL_HANDLE;
     VkImageView render_target = VK_NULL_HANDLE;
     VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+    std::shared_ptr<SparseImageMemory> sparse_memory;
+    bool is_memory_committed = false;
     u32 buffer_size = 0;
 };
 
@@ -328,14 +411,23 @@ public:
                            std::span<ImageView*, NUM_RT> color_buffers, ImageView* depth_buffer,
                            bool is_rescaled = false);
 
+    /// Returns the framebuffer object, null when rendering is begun on the attachments.
     [[nodiscard]] VkFramebuffer Handle() const noexcept {
         return *framebuffer;
     }
 
+    [[nodiscard]] const RenderingAttachments& Attachments() const noexcept {
+        return rendering_attachments;
+    }
+
     [[nodiscard]] VkRenderPass RenderPass() const noexcept {
         return renderpass;
     }
 
+    /// Returns a render pass compatible with RenderPass() that clears the attachments in
+    /// clear_mask on load, see RenderPassKey::clear_mask.
+    [[nodiscard]] VkRenderPass ClearRenderPass(u32 clear_mask) const;
+
     [[nodiscard]] VkExtent2D RenderArea() const noexcept {
         return render_area;
     }
@@ -360,6 +452,16 @@ public:
         return image_ranges;
     }
 
+    /// Returns the bytes a render pass loads or stores for each image, in the order of Images().
+    [[nodiscard]] const std::array<u64, 9>& ImageSizes() const noexcept {
+        return image_sizes;
+    }
+
+    /// Returns the attachment index of a color render target, it must be bound.
+    [[nodiscard]] size_t ColorAttachmentIndex(size_t index) const noexcept {
+        return rt_map[index];
+    }
+
     [[nodiscard]] bool HasAspectColorBit(size_t index) const noexcept {
         return (image_ranges.at(rt_map[index]).aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0;
     }
@@ -378,6 +480,9 @@ public:
 
 private:
     vk::Framebuffer framebuffer;
+    RenderingAttachments rendering_attachments;
+    RenderPassCache* render_pass_cache{};
+    RenderPassKey renderpass_key{};
     VkRenderPass renderpass{};
     VkExtent2D render_area{};
     VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
@@ -385,6 +490,7 @@ private:
     u32 num_images = 0;
     std::array<VkImage, 9> images{};
     std::array<VkImageSubresourceRange, 9> image_ranges{};
+    std::array<u64, 9> image_sizes{};
     std::array<size_t, NUM_RT> rt_map{};
     bool has_depth{};
     bool has_stencil{};
@@ -397,6 +503,7 @@ struct TextureCacheParams {
     static constexpr bool HAS_EMULATED_COPIES = false;
     static constexpr bool HAS_DEVICE_MEMORY_INFO = true;
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = true;
+    static constexpr bool IMPLEMENTS_HOST_IMAGE_COPY = true;
 
     using Runtime = Vulkan::TextureCacheRuntime;
     using Image = Vulkan::Image;
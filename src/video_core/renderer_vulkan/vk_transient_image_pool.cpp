@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <utility>
+
+#include "common/literals.h"
+#include "video_core/renderer_vulkan/vk_scheduler.h"
+#include "video_core/renderer_vulkan/vk_transient_image_pool.h"
+#include "video_core/vulkan_common/vulkan_memory_allocator.h"
+
+namespace Vulkan {
+namespace {
+using namespace Common::Literals;
+
+/// Frames a released image is kept around waiting to be reused
+constexpr u64 FRAMES_TO_KEEP = 120;
+
+/// Memory recycled images may hold, past it the oldest ones are freed like before recycling
+constexpr u64 MAX_RECYCLED_BYTES = 256_MiB;
+} // Anonymous namespace
+
+TransientImagePool::TransientImagePool(MemoryAllocator& memory_allocator_, Scheduler& scheduler_)
+    : memory_allocator{memory_allocator_}, scheduler{scheduler_} {}
+
+TransientImagePool::~TransientImagePool() = default;
+
+TransientImage TransientImagePool::Request(const VkImageCreateInfo& ci) {
+    const Key key = MakeKey(ci);
+    const auto it = std::ranges::find_if(free_images, [this, &key](const Entry& entry) {
+        return entry.key == key && scheduler.IsFree(entry.tick);
+    });
+    if (it == free_images.end()) {
+        return TransientImage{
+            .image = memory_allocator.CreateImage(ci),
+            .views = {},
+        };
+    }
+    TransientImage image = std::move(it->image);
+    recycled_bytes -= it->size_bytes;
+    free_images.erase(it);
+    return image;
+}
+
+void TransientImagePool::Release(const VkImageCreateInfo& ci, TransientImage&& image) {
+    free_images.push_back(Entry{
+        .key = MakeKey(ci),
+        .image = std::move(image),
+        .tick = scheduler.CurrentTick(),
+        .frame = frame,
+        .size_bytes = 0,
+    });
+}
+
+void TransientImagePool::Recycle(const VkImageCreateInfo& ci, vk::Image&& image, u64 size_bytes) {
+    if (size_bytes > MAX_RECYCLED_BYTES) {
+        return;
+    }
+    free_images.push_back(Entry{
+        .key = MakeKey(ci),
+        .image{
+            .image = std::move(image),
+            .views = {},
+        },
+        .tick = scheduler.CurrentTick(),
+        .frame = frame,
+        .size_bytes = size_bytes,
+    });
+    recycled_bytes += size_bytes;
+    // The texture cache only destroys images the GPU is done with, the oldest ones can be freed
+    auto it = free_images.begin();
+    while (recycled_bytes > MAX_RECYCLED_BYTES) {
+        it = std::find_if(it, free_images.end(),
+                          [](const Entry& entry) { return entry.size_bytes != 0; });
+        recycled_bytes -= it->size_bytes;
+        it = free_images.erase(it);
+    }
+}
+
+void TransientImagePool::TickFrame() {
+    ++frame;
+    std::erase_if(free_images, [this](const Entry& entry) {
+        if (entry.frame + FRAMES_TO_KEEP >= frame || !scheduler.IsFree(entry.tick)) {
+            return false;
+        }
+        recycled_bytes -= entry.size_bytes;
+        return true;
+    });
+}
+
+bool TransientImagePool::Key::operator==(const Key& rhs) const noexcept {
+    return flags == rhs.flags && type == rhs.type && format == rhs.format &&
+           extent.width == rhs.extent.width && extent.height == rhs.extent.height &&
+           extent.depth == rhs.extent.depth && levels == rhs.levels && layers == rhs.layers &&
+           samples == rhs.samples && tiling == rhs.tiling && usage == rhs.usage &&
+           view_formats == rhs.view_formats;
+}
+
+TransientImagePool::Key TransientImagePool::MakeKey(const VkImageCreateInfo& ci) {
+    std::vector<VkFormat> view_formats;
+    for (auto* next = static_cast<const VkBaseInStructure*>(ci.pNext); next != nullptr;
+         next = next->pNext) {
+        if (next->sType == VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO) {
+            const auto& format_list = *reinterpret_cast<const VkImageFormatListCreateInfo*>(next);
+            view_formats.assign(format_list.pViewFormats,
+                                format_list.pViewFormats + format_list.viewFormatCount);
+        }
+    }
+    return Key{
+        .flags = ci.flags,
+        .type = ci.imageType,
+        .format = ci.format,
+        .extent = ci.extent,
+        .levels = ci.mipLevels,
+        .layers = ci.arrayLayers,
+        .samples = ci.samples,
+        .tiling = ci.tiling,
+        .usage = ci.usage,
+        .view_formats = std::move(view_formats),
+    };
+}
+
+} // namespace Vulkan
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/vulkan_common/vulkan_wrapper.h"
+
+namespace Vulkan {
+
+class MemoryAllocator;
+class Scheduler;
+
+/// Scratch image and the views created on it, the views are kept alive along with the image
+struct TransientImage {
+    vk::Image image;
+    std::vector<vk::ImageView> views;
+};
+
+/**
+ * Pool of scratch images only used within a few commands, like the single sampled copies of
+ * multisampled images. Images given back are reused by later requests with the same create info
+ * once the GPU is done with them, so scratch images with disjoint lifetimes share their memory.
+ * Destroyed texture cache images are recycled the same way, up to a memory budget.
+ */
+class TransientImagePool {
+public:
+    explicit TransientImagePool(MemoryAllocator& memory_allocator, Scheduler& scheduler);
+    ~TransientImagePool();
+
+    /// Returns an image created with the given info, reusing a released one when possible
+    [[nodiscard]] TransientImage Request(const VkImageCreateInfo& ci);
+
+    /// Gives an image back to the pool, it is reused once the commands recorded so far finish
+    void Release(const VkImageCreateInfo& ci, TransientImage&& image);
+
+    /// Keeps the image of a destroyed cached image for a later request instead of freeing it
+    void Recycle(const VkImageCreateInfo& ci, vk::Image&& image, u64 size_bytes);
+
+    /// Destroys the images that have not been reused for a while
+    void TickFrame();
+
+private:
+    struct Key {
+        VkImageCreateFlags flags;
+        VkImageType type;
+        VkFormat format;
+        VkExtent3D extent;
+        u32 levels;
+        u32 layers;
+        VkSampleCountFlagBits samples;
+        VkImageTiling tiling;
+        VkImageUsageFlags usage;
+        /// Formats of the chained format list, views of other formats are not valid on the image
+        std::vector<VkFormat> view_formats;
+
+        [[nodiscard]] bool operator==(const Key& rhs) const noexcept;
+    };
+
+    struct Entry {
+        Key key;
+        TransientImage image;
+        u64 tick;
+        u64 frame;
+        /// Estimated size of recycled images, zero for released scratch images
+        u64 size_bytes;
+    };
+
+    [[nodiscard]] static Key MakeKey(const VkImageCreateInfo& ci);
+
+    MemoryAllocator& memory_allocator;
+    Scheduler& scheduler;
+    std::vector<Entry> free_images;
+    u64 recycled_bytes = 0;
+    u64 frame = 0;
+};
+
+} // namespace Vulkan
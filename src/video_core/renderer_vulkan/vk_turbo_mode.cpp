@@ -9,8 +9,10 @@
 #endif
 
 #include "common/literals.h"
+#include "common/logging/log.h"
 #include "video_core/host_shaders/vulkan_turbo_mode_comp_spv.h"
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
+#include "video_core/renderer_vulkan/vk_master_semaphore.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
 #include "video_core/renderer_vulkan/vk_turbo_mode.h"
 #include "video_core/vulkan_common/vulkan_device.h"
@@ -18,16 +20,35 @@
 namespace Vulkan {
 
 using namespace Common::Literals;
-
-TurboMode::TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld)
+using namespace std::chrono_literals;
+
+namespace {
+constexpr auto SAMPLE_PERIOD = 2ms;   ///< Time between two GPU samples while not boosting
+constexpr auto SAMPLE_WINDOW = 500ms; ///< Time the boost is decided over
+constexpr auto FRAME_DEADLINE_SLACK = 1ms; ///< Lateness of frames still counted as on time
+constexpr u64 MIN_FRAME_WAIT_NS = 1'000'000; ///< Time late frames have to block on the GPU
+constexpr u32 MIN_DEADLINE_MISSES = 3;       ///< Late frames in a window that start the boost
+constexpr u32 CALM_WINDOWS = 4; ///< Windows without late frames that stop the boost
+/// Idle GPUs have nothing to speed up, saturated ones already run at full clocks and would only
+/// lose time to the dummy workload
+constexpr double IDLE_UTILIZATION = 0.05;
+constexpr double SATURATED_UTILIZATION = 0.95;
+} // Anonymous namespace
+
+TurboMode::TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld,
+                     MasterSemaphore& master_semaphore)
 #ifndef ANDROID
-    : m_device{CreateDevice(instance, dld, VK_NULL_HANDLE)}, m_allocator{m_device}
+    : m_device{CreateDevice(instance, dld, VK_NULL_HANDLE)}, m_allocator{m_device},
+      m_master_semaphore{master_semaphore}
+#else
+    : m_master_semaphore{master_semaphore}
 #endif
 {
     {
         std::scoped_lock lk{m_submission_lock};
         m_submission_time = std::chrono::steady_clock::now();
     }
+    m_frame_time = std::chrono::steady_clock::now();
     m_thread = std::jthread([&](auto stop_token) { Run(stop_token); });
 }
 
@@ -39,6 +60,45 @@ void TurboMode::QueueSubmitted() {
     m_submission_cv.notify_one();
 }
 
+void TurboMode::FrameEnded(std::chrono::nanoseconds target_frame_time) {
+    const auto now = std::chrono::steady_clock::now();
+    const u64 waited_ns = m_master_semaphore.WaitedNanoseconds();
+    const auto frame_time = now - m_frame_time;
+    const u64 frame_waited_ns = waited_ns - m_frame_waited_ns;
+    m_frame_time = now;
+    m_frame_waited_ns = waited_ns;
+
+    // Late frames the host spent waiting on the GPU are the ones higher clocks can make on time
+    if (frame_time > target_frame_time + FRAME_DEADLINE_SLACK &&
+        frame_waited_ns >= MIN_FRAME_WAIT_NS) {
+        m_deadline_misses.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void TurboMode::UpdateBoost(u32 deadline_misses, u32 busy_samples, u32 num_samples) {
+    const double utilization =
+        num_samples != 0 ? static_cast<double>(busy_samples) / num_samples : 0.0;
+    if (utilization <= IDLE_UTILIZATION || utilization >= SATURATED_UTILIZATION) {
+        SetBoost(false);
+    } else if (deadline_misses >= MIN_DEADLINE_MISSES) {
+        SetBoost(true);
+    } else if (m_is_boosting && deadline_misses == 0 && ++m_calm_windows >= CALM_WINDOWS) {
+        SetBoost(false);
+    }
+}
+
+void TurboMode::SetBoost(bool is_boosting) {
+    m_calm_windows = 0;
+    if (m_is_boosting == is_boosting) {
+        return;
+    }
+    m_is_boosting = is_boosting;
+    LOG_DEBUG(Render_Vulkan, "{} boosting GPU clocks", is_boosting ? "Started" : "Stopped");
+#if defined(ANDROID) && defined(ARCHITECTURE_arm64)
+    adrenotools_set_turbo(is_boosting);
+#endif
+}
+
 void TurboMode::Run(std::stop_token stop_token) {
 #ifndef ANDROID
     auto& dld = m_device.GetLogical();
@@ -153,88 +213,112 @@ void TurboMode::Run(std::stop_token stop_token) {
     auto cmdbuf = vk::CommandBuffer{cmdbufs[0], m_device.GetDispatchLoader()};
 #endif
 
+    const auto submitted_recently = [this] {
+        return (std::chrono::steady_clock::now() - m_submission_time) <=
+               std::chrono::milliseconds{100};
+    };
+    auto window_start = std::chrono::steady_clock::now();
+    u32 num_samples = 0;
+    u32 busy_samples = 0;
+
     while (!stop_token.stop_requested()) {
-#ifdef ANDROID
-#ifdef ARCHITECTURE_arm64
-        adrenotools_set_turbo(true);
-#endif
-#else
-        // Reset the fence.
-        fence.Reset();
-
-        // Update descriptor set.
-        const VkDescriptorBufferInfo buffer_info{
-            .buffer = *buffer,
-            .offset = 0,
-            .range = VK_WHOLE_SIZE,
-        };
-
-        const VkWriteDescriptorSet buffer_write{
-            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-            .pNext = nullptr,
-            .dstSet = descriptor_set[0],
-            .dstBinding = 0,
-            .dstArrayElement = 0,
-            .descriptorCount = 1,
-            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
-            .pImageInfo = nullptr,
-            .pBufferInfo = &buffer_info,
-            .pTexelBufferView = nullptr,
-        };
-
-        dld.UpdateDescriptorSets(std::array{buffer_write}, {});
-
-        // Set up the command buffer.
-        cmdbuf.Begin(VkCommandBufferBeginInfo{
-            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-            .pNext = nullptr,
-            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
-            .pInheritanceInfo = nullptr,
-        });
-
-        // Clear the buffer.
-        cmdbuf.FillBuffer(*buffer, 0, VK_WHOLE_SIZE, 0);
-
-        // Bind descriptor set.
-        cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout, 0,
-                                  descriptor_set, {});
-
-        // Bind the pipeline.
-        cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
-
-        // Dispatch.
-        cmdbuf.Dispatch(64, 64, 1);
-
-        // Finish.
-        cmdbuf.End();
-
-        const VkSubmitInfo submit_info{
-            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-            .pNext = nullptr,
-            .waitSemaphoreCount = 0,
-            .pWaitSemaphores = nullptr,
-            .pWaitDstStageMask = nullptr,
-            .commandBufferCount = 1,
-            .pCommandBuffers = cmdbuf.address(),
-            .signalSemaphoreCount = 0,
-            .pSignalSemaphores = nullptr,
-        };
-
-        m_device.GetGraphicsQueue().Submit(std::array{submit_info}, *fence);
-
-        // Wait for completion.
-        fence.Wait();
+        ++num_samples;
+        if (!m_master_semaphore.IsIdle()) {
+            ++busy_samples;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now - window_start >= SAMPLE_WINDOW) {
+            UpdateBoost(m_deadline_misses.exchange(0, std::memory_order_relaxed), busy_samples,
+                        num_samples);
+            window_start = now;
+            num_samples = 0;
+            busy_samples = 0;
+        }
+#ifndef ANDROID
+        if (m_is_boosting) {
+            // Reset the fence.
+            fence.Reset();
+
+            // Update descriptor set.
+            const VkDescriptorBufferInfo buffer_info{
+                .buffer = *buffer,
+                .offset = 0,
+                .range = VK_WHOLE_SIZE,
+            };
+
+            const VkWriteDescriptorSet buffer_write{
+                .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                .pNext = nullptr,
+                .dstSet = descriptor_set[0],
+                .dstBinding = 0,
+                .dstArrayElement = 0,
+                .descriptorCount = 1,
+                .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                .pImageInfo = nullptr,
+                .pBufferInfo = &buffer_info,
+                .pTexelBufferView = nullptr,
+            };
+
+            dld.UpdateDescriptorSets(std::array{buffer_write}, {});
+
+            // Set up the command buffer.
+            cmdbuf.Begin(VkCommandBufferBeginInfo{
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                .pNext = nullptr,
+                .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                .pInheritanceInfo = nullptr,
+            });
+
+            // Clear the buffer.
+            cmdbuf.FillBuffer(*buffer, 0, VK_WHOLE_SIZE, 0);
+
+            // Bind descriptor set.
+            cmdbuf.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline_layout, 0,
+                                      descriptor_set, {});
+
+            // Bind the pipeline.
+            cmdbuf.BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
+
+            // Dispatch.
+            cmdbuf.Dispatch(64, 64, 1);
+
+            // Finish.
+            cmdbuf.End();
+
+            const VkSubmitInfo submit_info{
+                .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                .pNext = nullptr,
+                .waitSemaphoreCount = 0,
+                .pWaitSemaphores = nullptr,
+                .pWaitDstStageMask = nullptr,
+                .commandBufferCount = 1,
+                .pCommandBuffers = cmdbuf.address(),
+                .signalSemaphoreCount = 0,
+                .pSignalSemaphores = nullptr,
+            };
+
+            m_device.GetGraphicsQueue().Submit(std::array{submit_info}, *fence);
+
+            // Wait for completion.
+            fence.Wait();
+        }
 #endif
-        // Wait for the next graphics queue submission if necessary.
         std::unique_lock lk{m_submission_lock};
-        m_submission_cv.wait(lk, stop_token, [this] {
-            return (std::chrono::steady_clock::now() - m_submission_time) <=
-                   std::chrono::milliseconds{100};
-        });
+        if (!m_is_boosting) {
+            // Only sample the GPU while the clocks are left alone
+            m_submission_cv.wait_for(lk, stop_token, SAMPLE_PERIOD, [] { return false; });
+        }
+        // Wait for the next graphics queue submission if necessary.
+        if (!submitted_recently()) {
+            SetBoost(false);
+            m_submission_cv.wait(lk, stop_token, submitted_recently);
+            window_start = std::chrono::steady_clock::now();
+            num_samples = 0;
+            busy_samples = 0;
+            m_deadline_misses.store(0, std::memory_order_relaxed);
+        }
     }
-#if defined(ANDROID) && defined(ARCHITECTURE_arm64)
-    adrenotools_set_turbo(false);
-#endif
+    SetBoost(false);
 }
 
 } // namespace Vulkan
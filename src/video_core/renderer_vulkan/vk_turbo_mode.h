@@ -1,8 +1,12 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 
@@ -13,16 +17,32 @@
 
 namespace Vulkan {
 
+class MasterSemaphore;
+
+/// Keeps GPU clocks up with a dummy workload while frames miss their deadline waiting on a GPU
+/// that isn't saturated, the busy time is sampled from the master semaphore.
 class TurboMode {
 public:
-    explicit TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld);
+    explicit TurboMode(const vk::Instance& instance, const vk::InstanceDispatch& dld,
+                       MasterSemaphore& master_semaphore);
     ~TurboMode();
 
     void QueueSubmitted();
 
+    /// Notifies a frame has been presented, counting it when it took longer than the game's target
+    /// frame time while waiting on the GPU.
+    void FrameEnded(std::chrono::nanoseconds target_frame_time);
+
 private:
     void Run(std::stop_token stop_token);
 
+    /// Decides whether to boost clocks from the deadline misses and the GPU busy samples of the
+    /// window that just ended.
+    void UpdateBoost(u32 deadline_misses, u32 busy_samples, u32 num_samples);
+
+    /// Starts or stops the dummy workload.
+    void SetBoost(bool is_boosting);
+
 #ifndef ANDROID
     Device m_device;
     MemoryAllocator m_allocator;
@@ -31,6 +51,14 @@ private:
     std::condition_variable_any m_submission_cv;
     std::chrono::time_point<std::chrono::steady_clock> m_submission_time{};
 
+    MasterSemaphore& m_master_semaphore;
+    std::atomic<u32> m_deadline_misses{};
+    std::chrono::time_point<std::chrono::steady_clock> m_frame_time{};
+    u64 m_frame_waited_ns{};
+
+    bool m_is_boosting{};
+    u32 m_calm_windows{}; ///< Windows in a row without deadline misses while boosting
+
     std::jthread m_thread;
 };
 
@@ -1,9 +1,14 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2019 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <array>
+#include <cstring>
+#include <span>
 
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -47,35 +52,44 @@ public:
         return upload_start;
     }
 
+    /// Returns the entries pushed since the last call to Acquire
+    std::span<const DescriptorUpdateEntry> UpdateEntries() const noexcept {
+        return {upload_start, payload_cursor};
+    }
+
     void AddSampledImage(VkImageView image_view, VkSampler sampler) {
-        *(payload_cursor++) = VkDescriptorImageInfo{
-            .sampler = sampler,
-            .imageView = image_view,
-            .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
-        };
+        VkDescriptorImageInfo& image = NextEntry().image;
+        image.sampler = sampler;
+        image.imageView = image_view;
+        image.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
     }
 
     void AddImage(VkImageView image_view) {
-        *(payload_cursor++) = VkDescriptorImageInfo{
-            .sampler = VK_NULL_HANDLE,
-            .imageView = image_view,
-            .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
-        };
+        VkDescriptorImageInfo& image = NextEntry().image;
+        image.sampler = VK_NULL_HANDLE;
+        image.imageView = image_view;
+        image.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
     }
 
     void AddBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size) {
-        *(payload_cursor++) = VkDescriptorBufferInfo{
-            .buffer = buffer,
-            .offset = offset,
-            .range = size,
-        };
+        VkDescriptorBufferInfo& buffer_info = NextEntry().buffer;
+        buffer_info.buffer = buffer;
+        buffer_info.offset = offset;
+        buffer_info.range = size;
     }
 
     void AddTexelBuffer(VkBufferView texel_buffer) {
-        *(payload_cursor++) = texel_buffer;
+        NextEntry().texel_buffer = texel_buffer;
     }
 
 private:
+    /// Returns the next entry with all its bytes cleared, so equal bindings compare equal
+    /// including the padding and the bytes of the larger union members
+    DescriptorUpdateEntry& NextEntry() noexcept {
+        std::memset(static_cast<void*>(payload_cursor), 0, sizeof(DescriptorUpdateEntry));
+        return *(payload_cursor++);
+    }
+
     const Device& device;
     Scheduler& scheduler;
 
@@ -231,7 +231,7 @@ ShaderCache::Entry* ShaderCache::NewEntry(VAddr addr, VAddr addr_end, ShaderInfo
 const ShaderInfo* ShaderCache::MakeShaderInfo(GenericEnvironment& env, VAddr cpu_addr) {
     auto info = std::make_unique<ShaderInfo>();
     if (const std::optional<u64> cached_hash{env.Analyze()}) {
-        info->unique_hash = *cached_hash;
+        info->unique_hash = env.CalculateReachableHash().value_or(*cached_hash);
         info->size_bytes = env.CachedSizeBytes();
     } else {
         // Slow path, not really hit on commercial games
@@ -5,10 +5,14 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <memory>
 #include <optional>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "common/assert.h"
@@ -17,9 +21,14 @@
 #include "common/div_ceil.h"
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/hash.h"
 #include "common/logging/log.h"
+#include "common/zstd_compression.h"
 #include <ranges>
 #include "shader_recompiler/environment.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/object_pool.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/memory_manager.h"
 #include "video_core/shader_environment.h"
@@ -28,7 +37,49 @@
 
 namespace VideoCommon {
 
-constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h'};
+constexpr std::array<char, 8> LEGACY_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h'};
+constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'i', 'd', 'x'};
+
+/// Pipeline cache file header. The index is only present after the file has been compacted,
+/// entries appended afterwards follow it and are found by walking their record headers.
+struct CacheHeader {
+    std::array<char, 8> magic_number;
+    u32 cache_version;
+    u32 reserved;
+    u64 index_offset;
+    u64 index_size;
+};
+static_assert(std::is_trivially_copyable_v<CacheHeader> && sizeof(CacheHeader) == 32);
+
+/// Hashes the pipeline keys of the records, changing it requires bumping the cache versions.
+/// Shaders keep being identified by their CityHash64, the name they are dumped with.
+constexpr Common::HashAlgorithm RECORD_KEY_HASH = Common::HashAlgorithm::WyHash64;
+
+/// Precedes every entry, so entries can be skipped or copied without being parsed.
+struct RecordHeader {
+    u64 key_hash;
+    u64 size;
+};
+
+struct IndexEntry {
+    u64 key_hash;
+    u64 offset;
+};
+
+constexpr std::array<char, 8> PACKAGE_MAGIC_NUMBER{'e', 'd', 'e', 'n', 'p', 'k', 'g', 'c'};
+constexpr u32 PACKAGE_VERSION = 1;
+
+/// Exported pipeline cache, followed by its entries with their record headers compressed with
+/// Zstandard. The hash covers the uncompressed entries.
+struct PackageHeader {
+    std::array<char, 8> magic_number;
+    u32 package_version;
+    u32 cache_version;
+    u64 num_entries;
+    u64 entries_size;
+    u128 entries_hash;
+};
+static_assert(std::is_trivially_copyable_v<PackageHeader> && sizeof(PackageHeader) == 48);
 
 constexpr size_t INST_SIZE = sizeof(u64);
 
@@ -162,6 +213,39 @@ std::optional<u64> GenericEnvironment::Analyze() {
     return Common::CityHash64(reinterpret_cast<const char*>(code.data()), *size);
 }
 
+std::optional<u64> GenericEnvironment::CalculateReachableHash() {
+    const size_t header_words = initial_offset / INST_SIZE;
+    if (code.size() < header_words) {
+        return std::nullopt;
+    }
+    std::vector<u64> words(code.begin(), code.begin() + header_words);
+    try {
+        Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block;
+        const Shader::Maxwell::Flow::CFG cfg{*this, flow_block, start_address + initial_offset};
+        for (const Shader::Maxwell::Flow::Function& function : cfg.Functions()) {
+            for (const Shader::Maxwell::Flow::Block& block : function.blocks) {
+                if (block.begin.IsVirtual() || block.end <= block.begin) {
+                    continue;
+                }
+                if (block.begin.Offset() < cached_lowest ||
+                    block.end.Offset() - cached_lowest > code.size() * INST_SIZE) {
+                    return std::nullopt;
+                }
+                // Relative branches depend on where the block is, not only on its instructions
+                words.push_back(block.begin.Offset());
+                const size_t first = (block.begin.Offset() - cached_lowest) / INST_SIZE;
+                const size_t last = (block.end.Offset() - cached_lowest) / INST_SIZE;
+                words.insert(words.end(), code.begin() + first, code.begin() + last);
+            }
+        }
+    } catch (const Shader::Exception& exception) {
+        LOG_DEBUG(HW_GPU, "Failed to follow the control flow of a shader: {}", exception.what());
+        return std::nullopt;
+    }
+    return Common::CityHash64(reinterpret_cast<const char*>(words.data()),
+                              words.size() * sizeof(u64));
+}
+
 void GenericEnvironment::SetCachedSize(size_t size_bytes) {
     cached_lowest = start_address;
     cached_highest = start_address + static_cast<u32>(size_bytes);
@@ -196,7 +280,7 @@ void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
     DumpImpl(pipeline_hash, shader_hash, code, read_highest, read_lowest, initial_offset, stage);
 }
 
-void GenericEnvironment::Serialize(std::ofstream& file) const {
+void GenericEnvironment::Serialize(std::ostream& file) const {
     const u64 code_size{static_cast<u64>(CachedSizeBytes())};
     const u64 num_texture_types{static_cast<u64>(texture_types.size())};
     const u64 num_texture_pixel_formats{static_cast<u64>(texture_pixel_formats.size())};
@@ -585,6 +669,75 @@ std::optional<Shader::ReplaceConstant> FileEnvironment::GetReplaceConstBuffer(u3
     return it->second;
 }
 
+static bool ReadHeader(std::ifstream& file, const std::filesystem::path& filename,
+                       u32 expected_cache_version, CacheHeader& header) {
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (header.magic_number == MAGIC_NUMBER && header.cache_version == expected_cache_version) {
+        return true;
+    }
+    file.close();
+    if (Common::FS::RemoveFile(filename)) {
+        if (header.magic_number == LEGACY_MAGIC_NUMBER) {
+            LOG_INFO(Common_Filesystem, "Deleting pipeline cache with an old file format");
+        } else if (header.magic_number != MAGIC_NUMBER) {
+            LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
+        } else {
+            LOG_INFO(Common_Filesystem, "Deleting old pipeline cache");
+        }
+    } else {
+        LOG_ERROR(Common_Filesystem,
+                  "Invalid pipeline cache file and failed to delete it in \"{}\"",
+                  Common::FS::PathToUTF8String(filename));
+    }
+    return false;
+}
+
+/// Collects the latest entry of every key, sorted by file offset.
+/// @returns True when the file had duplicated or truncated entries
+static bool ReadRecords(std::ifstream& file, const CacheHeader& header, u64 file_size,
+                        std::vector<IndexEntry>& records, size_t& num_indexed) {
+    u64 offset = sizeof(CacheHeader);
+    if (header.index_offset != 0) {
+        records.resize(header.index_size);
+        file.seekg(header.index_offset)
+            .read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(IndexEntry));
+        offset = header.index_offset + header.index_size * sizeof(IndexEntry);
+    }
+    num_indexed = records.size();
+
+    bool has_stale_entries = false;
+    while (offset + sizeof(RecordHeader) <= file_size) {
+        RecordHeader record;
+        file.seekg(offset).read(reinterpret_cast<char*>(&record), sizeof(record));
+        if (record.size > file_size - offset - sizeof(RecordHeader)) {
+            break;
+        }
+        records.push_back({record.key_hash, offset});
+        offset += sizeof(RecordHeader) + record.size;
+    }
+    if (offset != file_size) {
+        LOG_WARNING(Common_Filesystem, "Pipeline cache has a truncated entry");
+        has_stale_entries = true;
+    }
+
+    std::unordered_map<u64, u64> latest;
+    latest.reserve(records.size());
+    for (const IndexEntry& entry : records) {
+        auto [it, is_new] = latest.try_emplace(entry.key_hash, entry.offset);
+        if (!is_new) {
+            it->second = (std::max)(it->second, entry.offset);
+            has_stale_entries = true;
+        }
+    }
+    if (has_stale_entries) {
+        std::erase_if(records, [&latest](const IndexEntry& entry) {
+            return latest.at(entry.key_hash) != entry.offset;
+        });
+    }
+    std::ranges::sort(records, {}, &IndexEntry::offset);
+    return has_stale_entries;
+}
+
 void SerializePipeline(std::span<const char> key, std::span<const GenericEnvironment* const> envs,
                        const std::filesystem::path& filename, u32 cache_version) try {
     std::ofstream file(filename, std::ios::binary | std::ios::ate | std::ios::app);
@@ -596,18 +749,34 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
     }
     if (file.tellp() == 0) {
         // Write header
-        file.write(MAGIC_NUMBER.data(), MAGIC_NUMBER.size())
-            .write(reinterpret_cast<const char*>(&cache_version), sizeof(cache_version));
+        const CacheHeader header{
+            .magic_number = MAGIC_NUMBER,
+            .cache_version = cache_version,
+            .reserved = 0,
+            .index_offset = 0,
+            .index_size = 0,
+        };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
     }
     if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
         return;
     }
+    std::ostringstream entry;
+    entry.exceptions(std::ios::failbit);
     const u32 num_envs{static_cast<u32>(envs.size())};
-    file.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
+    entry.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
     for (const GenericEnvironment* const env : envs) {
-        env->Serialize(file);
+        env->Serialize(entry);
     }
-    file.write(key.data(), key.size_bytes());
+    entry.write(key.data(), key.size_bytes());
+
+    const std::string data{std::move(entry).str()};
+    const RecordHeader record{
+        .key_hash = Common::Hash64<RECORD_KEY_HASH>(key.data(), key.size_bytes()),
+        .size = data.size(),
+    };
+    file.write(reinterpret_cast<const char*>(&record), sizeof(record))
+        .write(data.data(), data.size());
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
@@ -621,49 +790,47 @@ void LoadPipelines(
     std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
     Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
     Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics) try {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-        return;
-    }
-    file.exceptions(std::ifstream::failbit);
-    const auto end{file.tellg()};
-    file.seekg(0, std::ios::beg);
+    bool needs_compaction = false;
+    {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return;
+        }
+        file.exceptions(std::ifstream::failbit);
+        const u64 file_size{static_cast<u64>(file.tellg())};
+        file.seekg(0, std::ios::beg);
 
-    std::array<char, 8> magic_number;
-    u32 cache_version;
-    file.read(magic_number.data(), magic_number.size())
-        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
-    if (magic_number != MAGIC_NUMBER || cache_version != expected_cache_version) {
-        file.close();
-        if (Common::FS::RemoveFile(filename)) {
-            if (magic_number != MAGIC_NUMBER) {
-                LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
+        CacheHeader header;
+        if (!ReadHeader(file, filename, expected_cache_version, header)) {
+            return;
+        }
+        std::vector<IndexEntry> records;
+        size_t num_indexed{};
+        needs_compaction = ReadRecords(file, header, file_size, records, num_indexed);
+
+        // Refresh the index once enough entries have been appended after it.
+        needs_compaction |= (records.size() - num_indexed) * 4 > records.size();
+
+        for (const IndexEntry& entry : records) {
+            if (stop_loading.stop_requested()) {
+                return;
             }
-            if (cache_version != expected_cache_version) {
-                LOG_INFO(Common_Filesystem, "Deleting old pipeline cache");
+            file.seekg(entry.offset + sizeof(RecordHeader));
+            u32 num_envs{};
+            file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
+            std::vector<FileEnvironment> envs(num_envs);
+            for (FileEnvironment& env : envs) {
+                env.Deserialize(file);
+            }
+            if (envs.front().ShaderStage() == Shader::Stage::Compute) {
+                load_compute(file, std::move(envs.front()));
+            } else {
+                load_graphics(file, std::move(envs));
             }
-        } else {
-            LOG_ERROR(Common_Filesystem,
-                      "Invalid pipeline cache file and failed to delete it in \"{}\"",
-                      Common::FS::PathToUTF8String(filename));
         }
-        return;
     }
-    while (file.tellg() != end) {
-        if (stop_loading.stop_requested()) {
-            return;
-        }
-        u32 num_envs{};
-        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
-        std::vector<FileEnvironment> envs(num_envs);
-        for (FileEnvironment& env : envs) {
-            env.Deserialize(file);
-        }
-        if (envs.front().ShaderStage() == Shader::Stage::Compute) {
-            load_compute(file, std::move(envs.front()));
-        } else {
-            load_graphics(file, std::move(envs));
-        }
+    if (needs_compaction && !stop_loading.stop_requested()) {
+        CompactPipelineCache(filename, expected_cache_version);
     }
 
 } catch (const std::ios_base::failure& e) {
@@ -674,4 +841,253 @@ void LoadPipelines(
     }
 }
 
+bool CompactPipelineCache(const std::filesystem::path& filename, u32 expected_cache_version) {
+    auto temp_filename{filename};
+    temp_filename += ".tmp";
+    try {
+        std::vector<IndexEntry> index;
+        {
+            std::ifstream file(filename, std::ios::binary | std::ios::ate);
+            if (!file.is_open()) {
+                return false;
+            }
+            file.exceptions(std::ifstream::failbit);
+            const u64 file_size{static_cast<u64>(file.tellg())};
+            file.seekg(0, std::ios::beg);
+
+            CacheHeader header;
+            if (!ReadHeader(file, filename, expected_cache_version, header)) {
+                return false;
+            }
+            std::vector<IndexEntry> records;
+            size_t num_indexed{};
+            ReadRecords(file, header, file_size, records, num_indexed);
+
+            std::ofstream out(temp_filename, std::ios::binary | std::ios::trunc);
+            out.exceptions(std::ofstream::failbit);
+            header.index_offset = 0;
+            header.index_size = 0;
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            std::vector<char> buffer;
+            index.reserve(records.size());
+            for (const IndexEntry& entry : records) {
+                RecordHeader record;
+                file.seekg(entry.offset).read(reinterpret_cast<char*>(&record), sizeof(record));
+                buffer.resize(record.size);
+                file.read(buffer.data(), buffer.size());
+
+                index.push_back({entry.key_hash, static_cast<u64>(out.tellp())});
+                out.write(reinterpret_cast<const char*>(&record), sizeof(record))
+                    .write(buffer.data(), buffer.size());
+            }
+            // Sorted by hash so single entries can be looked up with a binary search.
+            std::ranges::sort(index, {}, &IndexEntry::key_hash);
+            header.index_offset = static_cast<u64>(out.tellp());
+            header.index_size = index.size();
+            out.write(reinterpret_cast<const char*>(index.data()),
+                      index.size() * sizeof(IndexEntry));
+            out.seekp(0).write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+        if (!Common::FS::RemoveFile(filename) || !Common::FS::RenameFile(temp_filename, filename)) {
+            LOG_ERROR(Common_Filesystem, "Failed to replace pipeline cache file {}",
+                      Common::FS::PathToUTF8String(filename));
+            return false;
+        }
+        LOG_INFO(Common_Filesystem, "Compacted pipeline cache to {} entries", index.size());
+        return true;
+
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "{}", e.what());
+        (void)Common::FS::RemoveFile(temp_filename);
+        return false;
+    }
+}
+
+bool ExportPipelineCache(const std::filesystem::path& filename,
+                         const std::filesystem::path& package_filename) {
+    try {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            LOG_ERROR(Common_Filesystem, "Failed to open pipeline cache file {}",
+                      Common::FS::PathToUTF8String(filename));
+            return false;
+        }
+        file.exceptions(std::ifstream::failbit);
+        const u64 file_size{static_cast<u64>(file.tellg())};
+        file.seekg(0, std::ios::beg);
+
+        CacheHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (header.magic_number != MAGIC_NUMBER) {
+            LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
+            return false;
+        }
+        std::vector<IndexEntry> records;
+        size_t num_indexed{};
+        ReadRecords(file, header, file_size, records, num_indexed);
+
+        // Entries are stored with their record headers, like in the cache file
+        std::vector<u8> entries;
+        for (const IndexEntry& entry : records) {
+            RecordHeader record;
+            file.seekg(entry.offset).read(reinterpret_cast<char*>(&record), sizeof(record));
+            const size_t offset{entries.size()};
+            entries.resize(offset + sizeof(record) + record.size);
+            std::memcpy(entries.data() + offset, &record, sizeof(record));
+            file.read(reinterpret_cast<char*>(entries.data() + offset + sizeof(record)),
+                      record.size);
+        }
+        const PackageHeader package{
+            .magic_number = PACKAGE_MAGIC_NUMBER,
+            .package_version = PACKAGE_VERSION,
+            .cache_version = header.cache_version,
+            .num_entries = records.size(),
+            .entries_size = entries.size(),
+            .entries_hash =
+                Common::CityHash128(reinterpret_cast<const char*>(entries.data()), entries.size()),
+        };
+        const std::vector<u8> compressed{
+            Common::Compression::CompressDataZSTDDefault(entries.data(), entries.size())};
+        if (compressed.empty()) {
+            LOG_ERROR(Common_Filesystem, "Failed to compress the pipeline cache");
+            return false;
+        }
+        std::ofstream out(package_filename, std::ios::binary | std::ios::trunc);
+        out.exceptions(std::ofstream::failbit);
+        out.write(reinterpret_cast<const char*>(&package), sizeof(package))
+            .write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+
+        LOG_INFO(Common_Filesystem, "Exported {} pipeline cache entries, hash {:016x}{:016x}",
+                 records.size(), package.entries_hash[1], package.entries_hash[0]);
+        return true;
+
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "{}", e.what());
+        (void)Common::FS::RemoveFile(package_filename);
+        return false;
+    }
+}
+
+bool ImportPipelineCache(const std::filesystem::path& package_filename,
+                         const std::filesystem::path& filename) {
+    PackageHeader package;
+    std::vector<u8> entries;
+    try {
+        std::ifstream file(package_filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            LOG_ERROR(Common_Filesystem, "Failed to open pipeline cache package {}",
+                      Common::FS::PathToUTF8String(package_filename));
+            return false;
+        }
+        file.exceptions(std::ifstream::failbit);
+        const u64 file_size{static_cast<u64>(file.tellg())};
+        file.seekg(0, std::ios::beg);
+        if (file_size < sizeof(package)) {
+            LOG_ERROR(Common_Filesystem, "Invalid pipeline cache package");
+            return false;
+        }
+        file.read(reinterpret_cast<char*>(&package), sizeof(package));
+        if (package.magic_number != PACKAGE_MAGIC_NUMBER) {
+            LOG_ERROR(Common_Filesystem, "Invalid pipeline cache package");
+            return false;
+        }
+        if (package.package_version != PACKAGE_VERSION) {
+            LOG_ERROR(Common_Filesystem, "Unsupported pipeline cache package version {}",
+                      package.package_version);
+            return false;
+        }
+        std::vector<u8> compressed(file_size - sizeof(package));
+        file.read(reinterpret_cast<char*>(compressed.data()), compressed.size());
+        entries = Common::Compression::DecompressDataZSTD(compressed);
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "{}", e.what());
+        return false;
+    }
+    if (entries.size() != package.entries_size ||
+        Common::CityHash128(reinterpret_cast<const char*>(entries.data()), entries.size()) !=
+            package.entries_hash) {
+        LOG_ERROR(Common_Filesystem, "Pipeline cache package is corrupted");
+        return false;
+    }
+    // Validate every record before anything is written to the cache
+    std::vector<IndexEntry> records;
+    records.reserve((std::min)(package.num_entries, u64{entries.size() / sizeof(RecordHeader)}));
+    u64 offset{};
+    while (entries.size() - offset >= sizeof(RecordHeader)) {
+        RecordHeader record;
+        std::memcpy(&record, entries.data() + offset, sizeof(record));
+        if (record.size > entries.size() - offset - sizeof(record)) {
+            break;
+        }
+        records.push_back({record.key_hash, offset});
+        offset += sizeof(record) + record.size;
+    }
+    if (offset != entries.size() || records.size() != package.num_entries) {
+        LOG_ERROR(Common_Filesystem, "Pipeline cache package is corrupted");
+        return false;
+    }
+
+    try {
+        // Entries already in the cache are kept, the package only adds the missing ones
+        std::unordered_set<u64> cached_keys;
+        if (std::ifstream file(filename, std::ios::binary | std::ios::ate); file.is_open()) {
+            file.exceptions(std::ifstream::failbit);
+            const u64 file_size{static_cast<u64>(file.tellg())};
+            file.seekg(0, std::ios::beg);
+            if (file_size != 0) {
+                CacheHeader header;
+                file.read(reinterpret_cast<char*>(&header), sizeof(header));
+                if (header.magic_number != MAGIC_NUMBER ||
+                    header.cache_version != package.cache_version) {
+                    LOG_ERROR(Common_Filesystem,
+                              "Pipeline cache package doesn't match the version of {}",
+                              Common::FS::PathToUTF8String(filename));
+                    return false;
+                }
+                std::vector<IndexEntry> cached;
+                size_t num_indexed{};
+                ReadRecords(file, header, file_size, cached, num_indexed);
+                for (const IndexEntry& entry : cached) {
+                    cached_keys.insert(entry.key_hash);
+                }
+            }
+        }
+        std::ofstream file(filename, std::ios::binary | std::ios::ate | std::ios::app);
+        file.exceptions(std::ofstream::failbit);
+        if (file.tellp() == 0) {
+            const CacheHeader header{
+                .magic_number = MAGIC_NUMBER,
+                .cache_version = package.cache_version,
+                .reserved = 0,
+                .index_offset = 0,
+                .index_size = 0,
+            };
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
+        size_t num_imported{};
+        for (size_t i = 0; i < records.size(); ++i) {
+            if (!cached_keys.insert(records[i].key_hash).second) {
+                continue;
+            }
+            const u64 end{i + 1 < records.size() ? records[i + 1].offset : entries.size()};
+            file.write(reinterpret_cast<const char*>(entries.data() + records[i].offset),
+                       end - records[i].offset);
+            ++num_imported;
+        }
+        file.close();
+
+        LOG_INFO(Common_Filesystem, "Imported {} of {} pipeline cache entries", num_imported,
+                 records.size());
+        if (num_imported != 0) {
+            CompactPipelineCache(filename, package.cache_version);
+        }
+        return true;
+
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "{}", e.what());
+        return false;
+    }
+}
+
 } // namespace VideoCommon
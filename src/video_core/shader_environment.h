@@ -49,6 +49,11 @@ public:
 
     [[nodiscard]] std::optional<u64> Analyze();
 
+    /// Hashes the header and the instructions reachable from the entry point of an analyzed
+    /// shader, so shaders that only differ in unreachable code share their pipelines.
+    /// Returns std::nullopt when the control flow could not be followed within the code.
+    [[nodiscard]] std::optional<u64> CalculateReachableHash();
+
     void SetCachedSize(size_t size_bytes);
 
     [[nodiscard]] size_t CachedSizeWords() const noexcept;
@@ -63,7 +68,7 @@ public:
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
-    void Serialize(std::ofstream& file) const;
+    void Serialize(std::ostream& file) const;
 
     bool HasHLEMacroState() const override {
         return has_hle_engine_state;
@@ -232,4 +237,30 @@ void LoadPipelines(
     Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
     Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics);
 
+/**
+ * Rewrites a pipeline cache file without duplicated or truncated entries, followed by a sorted
+ * index of every entry so later loads don't have to walk the file. It doesn't depend on any
+ * renderer state and can be run on a cache file offline.
+ * @returns True when the file was rewritten
+ */
+bool CompactPipelineCache(const std::filesystem::path& filename, u32 expected_cache_version);
+
+/**
+ * Writes the entries of a pipeline cache file to a Zstandard compressed package. The entries only
+ * hold guest shaders and pipeline state, so the package can be imported on any device that uses
+ * the same renderer and cache version. A hash of the entries is stored to verify the package.
+ * @returns True when the package was written
+ */
+bool ExportPipelineCache(const std::filesystem::path& filename,
+                         const std::filesystem::path& package_filename);
+
+/**
+ * Merges the entries of a package into a pipeline cache file, creating it if needed. Entries the
+ * cache already has are kept. Importing several packages and exporting the cache again produces
+ * a merged package. Must not be used on the cache of a running title.
+ * @returns False when the package is invalid or doesn't match the version of the cache
+ */
+bool ImportPipelineCache(const std::filesystem::path& package_filename,
+                         const std::filesystem::path& filename);
+
 } // namespace VideoCommon
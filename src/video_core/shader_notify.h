@@ -11,6 +11,11 @@ class ShaderNotify {
 public:
     [[nodiscard]] int ShadersBuilding() noexcept;
 
+    /// Returns the number of shaders built since boot
+    [[nodiscard]] int ShadersBuilt() const noexcept {
+        return num_complete.load(std::memory_order_relaxed);
+    }
+
     void MarkShaderComplete() noexcept {
         ++num_complete;
     }
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -26,10 +29,14 @@ public:
 
     void Invalidate() noexcept {
         std::ranges::fill(read_descriptors, 0);
+        std::ranges::fill(trusted_descriptors, 0);
     }
 
     [[nodiscard]] std::pair<Descriptor, bool> Read(u32 index) {
         DEBUG_ASSERT(index <= current_limit);
+        if (is_tracked && IsDescriptorTrusted(index)) {
+            return {descriptors[index], false};
+        }
         const GPUVAddr gpu_addr = current_gpu_addr + index * sizeof(Descriptor);
         std::pair<Descriptor, bool> result;
         gpu_memory.ReadBlockUnsafe(gpu_addr, &result.first, sizeof(Descriptor));
@@ -42,6 +49,9 @@ public:
         if (result.second) {
             descriptors[index] = result.first;
         }
+        if (is_tracked) {
+            MarkDescriptorAsTrusted(index);
+        }
         return result;
     }
 
@@ -49,6 +59,45 @@ public:
         return current_limit;
     }
 
+    [[nodiscard]] GPUVAddr Address() const noexcept {
+        return current_gpu_addr;
+    }
+
+    [[nodiscard]] size_t SizeBytes() const noexcept {
+        return (static_cast<size_t>(current_limit) + 1) * sizeof(Descriptor);
+    }
+
+    /**
+     * Marks the table as tracked at the given device address. While it is tracked, descriptors
+     * already read are served from the table without reading guest memory again, the owner has
+     * to call Untrack when the memory of the table is written.
+     */
+    void Track(DAddr cpu_addr) noexcept {
+        is_tracked = true;
+        tracked_cpu_addr = cpu_addr;
+        tracked_size = SizeBytes();
+    }
+
+    /// Stops trusting the read descriptors, they are compared with guest memory again.
+    void Untrack() noexcept {
+        is_tracked = false;
+        std::ranges::fill(trusted_descriptors, 0);
+    }
+
+    [[nodiscard]] bool IsTracked() const noexcept {
+        return is_tracked;
+    }
+
+    /// Device address of the table when it was tracked.
+    [[nodiscard]] DAddr TrackedAddress() const noexcept {
+        return tracked_cpu_addr;
+    }
+
+    /// Size in bytes of the table when it was tracked.
+    [[nodiscard]] size_t TrackedSize() const noexcept {
+        return tracked_size;
+    }
+
 private:
     void Refresh(GPUVAddr gpu_addr, u32 limit) {
         current_gpu_addr = gpu_addr;
@@ -57,6 +106,8 @@ private:
         const size_t num_descriptors = static_cast<size_t>(limit) + 1;
         read_descriptors.clear();
         read_descriptors.resize(Common::DivCeil(num_descriptors, 64U), 0);
+        trusted_descriptors.clear();
+        trusted_descriptors.resize(read_descriptors.size(), 0);
         descriptors.resize(num_descriptors);
     }
 
@@ -68,11 +119,25 @@ private:
         return (read_descriptors[index / 64] & (1ULL << (index % 64))) != 0;
     }
 
+    void MarkDescriptorAsTrusted(u32 index) noexcept {
+        trusted_descriptors[index / 64] |= 1ULL << (index % 64);
+    }
+
+    [[nodiscard]] bool IsDescriptorTrusted(u32 index) const noexcept {
+        return (trusted_descriptors[index / 64] & (1ULL << (index % 64))) != 0;
+    }
+
     Tegra::MemoryManager& gpu_memory;
     GPUVAddr current_gpu_addr{};
     u32 current_limit{};
     std::vector<u64> read_descriptors;
     std::vector<Descriptor> descriptors;
+
+    /// Descriptors read while the table was tracked, they can't have changed since
+    std::vector<u64> trusted_descriptors;
+    bool is_tracked{};
+    DAddr tracked_cpu_addr{};
+    size_t tracked_size{};
 };
 
 } // namespace VideoCommon
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2020 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -42,6 +45,8 @@ enum class ImageFlagBits : u32 {
 
     AsynchronousDecode = 1 << 16,
     IsDecoding = 1 << 17, ///< Is currently being decoded asynchronously.
+
+    ReadbackQueued = 1 << 18, ///< A preemptive download is waiting for the next fence
 };
 DECLARE_ENUM_FLAG_OPERATORS(ImageFlagBits)
 
@@ -84,6 +89,11 @@ struct ImageBase {
         return has_scaled;
     }
 
+    /// Returns true when only a range of the image was modified from the CPU
+    [[nodiscard]] bool HasPartialCpuModification() const noexcept {
+        return cpu_modified_begin != cpu_modified_end;
+    }
+
     ImageInfo info;
 
     u32 guest_size_bytes = 0;
@@ -101,9 +111,19 @@ struct ImageBase {
     VAddr cpu_addr = 0;
     VAddr cpu_addr_end = 0;
 
+    /// Page aligned range written from the CPU since the last upload, relative to the start of
+    /// the image. Only its pages are untracked, it's empty when the whole image is modified.
+    u32 cpu_modified_begin = 0;
+    u32 cpu_modified_end = 0;
+
     u64 modification_tick = 0;
     size_t lru_index = SIZE_MAX;
 
+    /// Confidence that the CPU reads the image back, zero when it was never learned
+    u32 readback_score = 0;
+    /// Preemptive downloads since the CPU last read the image
+    u32 unread_downloads = 0;
+
     std::array<u32, MAX_MIP_LEVELS> mip_level_offsets{};
 
     std::vector<ImageViewInfo> image_view_infos;
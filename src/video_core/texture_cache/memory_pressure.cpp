@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/memory_detect.h"
+#include "common/settings.h"
+#include "video_core/texture_cache/memory_pressure.h"
+
+namespace VideoCommon {
+
+using namespace Common::Literals;
+
+MemoryPressureManager::MemoryPressureManager(u64 device_local_memory, s64 target_threshold_,
+                                             s64 default_expected_, s64 default_critical_)
+    : target_threshold{target_threshold_}, default_expected{default_expected_},
+      default_critical{default_critical_} {
+    static_limit = device_local_memory;
+    if (const u64 tier_cap = GetDeviceTierCap(); tier_cap != 0 && tier_cap < static_limit) {
+        LOG_INFO(HW_GPU, "Capping device memory usage to {} MiB for this device tier",
+                 tier_cap / 1_MiB);
+        static_limit = tier_cap;
+    }
+    Recalculate(static_limit);
+}
+
+void MemoryPressureManager::Update(u64 budget) {
+    u64 new_limit = static_limit;
+    if (budget != 0) {
+        // Leave some headroom for the driver, the budget is shared with everything else.
+        new_limit = (std::min)(new_limit, budget - budget / 8);
+    }
+    if (new_limit != limit) {
+        Recalculate(new_limit);
+    }
+}
+
+u64 MemoryPressureManager::GetDeviceTierCap() {
+#ifdef ANDROID
+    // Phones share system memory with the GPU, keep enough of it free for the rest of the
+    // emulator and the OS so the low memory killer doesn't terminate us.
+    if (Settings::values.vram_usage_mode.GetValue() == Settings::VramUsageMode::Aggressive) {
+        return 0;
+    }
+    const u64 total_memory = Common::GetMemInfo().TotalPhysicalMemory;
+    if (total_memory <= 4_GiB) {
+        return 1_GiB + 512_MiB;
+    }
+    if (total_memory <= 6_GiB) {
+        return 2_GiB + 512_MiB;
+    }
+    if (total_memory <= 8_GiB) {
+        return 3_GiB + 512_MiB;
+    }
+#endif
+    return 0;
+}
+
+void MemoryPressureManager::Recalculate(u64 new_limit) {
+    limit = new_limit;
+    const s64 memory = static_cast<s64>(limit);
+    const s64 min_spacing_expected = memory - 1_GiB;
+    const s64 min_spacing_critical = memory - 512_MiB;
+    const s64 mem_threshold = (std::min)(memory, target_threshold);
+    const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
+    const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
+    thresholds.expected = static_cast<u64>((std::max)(
+        (std::min)(memory - min_vacancy_expected, min_spacing_expected), default_expected));
+    thresholds.critical = static_cast<u64>((std::max)(
+        (std::min)(memory - min_vacancy_critical, min_spacing_critical), default_critical));
+    thresholds.minimum = static_cast<u64>((std::max<s64>)((memory - mem_threshold) / 2, 0));
+}
+
+} // namespace VideoCommon
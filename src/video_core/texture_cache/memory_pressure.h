@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+enum class MemoryPressure : u32 {
+    None,     ///< Usage is below the point where collection is needed
+    Low,      ///< Old resources should be collected
+    High,     ///< Old resources should be collected, even if they have to be downloaded
+    Critical, ///< Costly resources have to be evicted too
+};
+
+/// Usage thresholds at which the caches start reacting to memory pressure.
+struct MemoryThresholds {
+    u64 minimum;
+    u64 expected;
+    u64 critical;
+};
+
+/**
+ * Backend agnostic memory pressure policy shared by the texture and buffer caches.
+ *
+ * The limit starts from the device local memory reported by the backend, is optionally capped
+ * by the host device tier and is refreshed every frame from the live memory budget when the
+ * backend can report it, so eviction reacts to other processes claiming memory.
+ */
+class MemoryPressureManager {
+public:
+    explicit MemoryPressureManager(u64 device_local_memory, s64 target_threshold,
+                                   s64 default_expected, s64 default_critical);
+
+    /// Updates the thresholds from the current memory budget. A budget of zero is ignored.
+    void Update(u64 budget);
+
+    [[nodiscard]] const MemoryThresholds& GetThresholds() const noexcept {
+        return thresholds;
+    }
+
+    /// Returns the memory cap imposed by the host device tier, or zero when there is none.
+    [[nodiscard]] static u64 GetDeviceTierCap();
+
+private:
+    void Recalculate(u64 new_limit);
+
+    u64 static_limit;
+    u64 limit;
+    s64 target_threshold;
+    s64 default_expected;
+    s64 default_critical;
+    MemoryThresholds thresholds{};
+};
+
+} // namespace VideoCommon
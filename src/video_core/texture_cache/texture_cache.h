@@ -10,6 +10,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include "common/alignment.h"
+#include "common/profiler.h"
 #include "common/settings.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/dirty_flags.h"
@@ -51,21 +52,12 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     void(slot_images.insert(NullImageParams{}));
     void(slot_image_views.insert(runtime, NullImageViewParams{}));
     void(slot_samplers.insert(runtime, sampler_descriptor));
+    sampler_limit = (std::min)(runtime.GetMaxSamplers(), MAX_SAMPLERS);
 
     if constexpr (HAS_DEVICE_MEMORY_INFO) {
-        const s64 device_local_memory = static_cast<s64>(runtime.GetDeviceLocalMemory());
-        const s64 min_spacing_expected = device_local_memory - 1_GiB;
-        const s64 min_spacing_critical = device_local_memory - 512_MiB;
-        const s64 mem_threshold = (std::min)(device_local_memory, TARGET_THRESHOLD);
-        const s64 min_vacancy_expected = (6 * mem_threshold) / 10;
-        const s64 min_vacancy_critical = (2 * mem_threshold) / 10;
-        expected_memory = static_cast<u64>(
-            (std::max)((std::min)(device_local_memory - min_vacancy_expected, min_spacing_expected),
-                     DEFAULT_EXPECTED_MEMORY));
-        critical_memory = static_cast<u64>(
-            (std::max)((std::min)(device_local_memory - min_vacancy_critical, min_spacing_critical),
-                     DEFAULT_CRITICAL_MEMORY));
-        minimum_memory = static_cast<u64>((device_local_memory - mem_threshold) / 2);
+        memory_pressure.emplace(runtime.GetDeviceLocalMemory(), TARGET_THRESHOLD,
+                                DEFAULT_EXPECTED_MEMORY, DEFAULT_CRITICAL_MEMORY);
+        ApplyMemoryThresholds();
     } else {
         expected_memory = DEFAULT_EXPECTED_MEMORY + 512_MiB;
         critical_memory = DEFAULT_CRITICAL_MEMORY + 1_GiB;
@@ -73,6 +65,14 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     }
 }
 
+template <class P>
+void TextureCache<P>::ApplyMemoryThresholds() {
+    const MemoryThresholds& thresholds = memory_pressure->GetThresholds();
+    minimum_memory = thresholds.minimum;
+    expected_memory = thresholds.expected;
+    critical_memory = thresholds.critical;
+}
+
 template <class P>
 void TextureCache<P>::RunGarbageCollector() {
     bool high_priority_mode = false;
@@ -106,19 +106,7 @@ void TextureCache<P>::RunGarbageCollector() {
         if (!high_priority_mode && must_download) {
             return false;
         }
-        if (must_download) {
-            auto map = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes);
-            const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
-            image.DownloadMemory(map, copies);
-            runtime.Finish();
-            SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
-                         swizzle_data_buffer);
-        }
-        if (True(image.flags & ImageFlagBits::Tracked)) {
-            UntrackImage(image, image_id);
-        }
-        UnregisterImage(image_id);
-        DeleteImage(image_id, image.scale_tick > frame_tick + 5);
+        EvictImage(image_id, must_download);
         if (total_used_memory < critical_memory) {
             if (aggressive_mode) {
                 // Sink the aggresiveness.
@@ -145,11 +133,69 @@ void TextureCache<P>::RunGarbageCollector() {
     }
 }
 
+template <class P>
+void TextureCache<P>::EvictImage(ImageId image_id, bool must_download) {
+    auto& image = slot_images[image_id];
+    if (must_download) {
+        auto map = runtime.DownloadStagingBuffer(image.unswizzled_size_bytes);
+        const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
+        image.DownloadMemory(map, copies);
+        runtime.Finish();
+        SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, map.mapped_span,
+                     swizzle_data_buffer);
+    }
+    if (True(image.flags & ImageFlagBits::Tracked)) {
+        UntrackImage(image, image_id);
+    }
+    UnregisterImage(image_id);
+    DeleteImage(image_id, image.scale_tick > frame_tick + 5);
+}
+
+template <class P>
+void TextureCache<P>::Trim(MemoryPressure pressure) {
+    // Same age as the aggressive collection, younger images are likely used by the next frames
+    static constexpr u64 TICKS_TO_KEEP = 10;
+    if (pressure == MemoryPressure::None || !maxwell3d || frame_tick < TICKS_TO_KEEP) {
+        return;
+    }
+    const u64 used_memory = total_used_memory;
+    lru_cache.ForEachItemBelow(frame_tick - TICKS_TO_KEEP, [this, pressure](ImageId image_id) {
+        const auto& image = slot_images[image_id];
+        if (True(image.flags & ImageFlagBits::IsDecoding)) {
+            return false;
+        }
+        if (pressure < MemoryPressure::Critical && True(image.flags & ImageFlagBits::CostlyLoad)) {
+            return false;
+        }
+        const bool must_download =
+            image.IsSafeDownload() && False(image.flags & ImageFlagBits::BadOverlap);
+        if (pressure < MemoryPressure::High && must_download) {
+            return false;
+        }
+        EvictImage(image_id, must_download);
+        return false;
+    });
+    LOG_INFO(HW_GPU, "Trimmed {} MiB of images", (used_memory - total_used_memory) >> 20);
+}
+
+template <class P>
+void TextureCache<P>::ReleaseSentencedResources() {
+    sentenced_images.Clear();
+    sentenced_framebuffers.Clear();
+    sentenced_image_view.Clear();
+    sentenced_samplers.Clear();
+}
+
 template <class P>
 void TextureCache<P>::TickFrame() {
     // If we can obtain the memory info, use it instead of the estimate.
     if (runtime.CanReportMemoryUsage()) {
         total_used_memory = runtime.GetDeviceMemoryUsage();
+        if constexpr (HAS_DEVICE_MEMORY_INFO) {
+            // Follow the live budget so other processes claiming memory tighten our limits.
+            memory_pressure->Update(runtime.GetDeviceMemoryBudget());
+            ApplyMemoryThresholds();
+        }
     }
     if (total_used_memory > minimum_memory) {
         RunGarbageCollector();
@@ -157,7 +203,12 @@ void TextureCache<P>::TickFrame() {
     sentenced_images.Tick();
     sentenced_framebuffers.Tick();
     sentenced_image_view.Tick();
+    sentenced_samplers.Tick();
     TickAsyncDecode();
+    if (frame_tick % STATISTICS_PERIOD == 0) {
+        ReportSamplerStatistics();
+        ReportUploadStatistics();
+    }
 
     runtime.TickFrame();
     ++frame_tick;
@@ -207,7 +258,8 @@ void TextureCache<P>::FillComputeImageViews(std::span<ImageViewInOut> views) {
 
 template <class P>
 void TextureCache<P>::CheckFeedbackLoop(std::span<const ImageViewInOut> views) {
-    if (!Settings::values.barrier_feedback_loops.GetValue()) {
+    if (!Settings::RuntimeSnapshot().barrier_feedback_loops) {
+        has_feedback_loop = false;
         return;
     }
 
@@ -240,6 +292,7 @@ void TextureCache<P>::CheckFeedbackLoop(std::span<const ImageViewInOut> views) {
         return false;
     }();
 
+    has_feedback_loop = requires_barrier;
     if (requires_barrier) {
         runtime.BarrierFeedbackLoop();
     }
@@ -266,6 +319,7 @@ SamplerId TextureCache<P>::GetGraphicsSamplerId(u32 index) {
     if (is_new) {
         id = FindSampler(descriptor);
     }
+    TouchSampler(id);
     return id;
 }
 
@@ -280,6 +334,7 @@ SamplerId TextureCache<P>::GetComputeSamplerId(u32 index) {
     if (is_new) {
         id = FindSampler(descriptor);
     }
+    TouchSampler(id);
     return id;
 }
 
@@ -306,7 +361,9 @@ void TextureCache<P>::SynchronizeGraphicsDescriptors() {
     if (channel_state->graphics_image_table.Synchronize(maxwell3d->regs.tex_header.Address(),
                                                         tic_limit)) {
         channel_state->graphics_image_view_ids.resize(tic_limit + 1, CORRUPT_ID);
+        UntrackDescriptorTable(channel_state->graphics_image_table);
     }
+    TrackDescriptorTable(channel_state->graphics_image_table);
 }
 
 template <class P>
@@ -321,7 +378,9 @@ void TextureCache<P>::SynchronizeComputeDescriptors() {
     if (channel_state->compute_image_table.Synchronize(kepler_compute->regs.tic.Address(),
                                                        tic_limit)) {
         channel_state->compute_image_view_ids.resize(tic_limit + 1, CORRUPT_ID);
+        UntrackDescriptorTable(channel_state->compute_image_table);
     }
+    TrackDescriptorTable(channel_state->compute_image_table);
 }
 
 template <class P>
@@ -516,6 +575,49 @@ ImageViewId TextureCache<P>::VisitImageView(DescriptorTable<TICEntry>& table,
     return image_view_id;
 }
 
+template <class P>
+void TextureCache<P>::TrackDescriptorTable(DescriptorTable<TICEntry>& table) {
+    if (table.IsTracked()) {
+        return;
+    }
+    const GPUVAddr gpu_addr = table.Address();
+    const size_t size = table.SizeBytes();
+    // Tables split across non contiguous memory keep being read from guest memory
+    if (gpu_addr == 0) {
+        return;
+    }
+    const auto span = gpu_memory->GetContiguousSpan(gpu_addr, size);
+    if (!span || span->second != size) {
+        return;
+    }
+    device_memory.UpdatePagesCachedCount(span->first, size, 1);
+    table.Track(span->first);
+}
+
+template <class P>
+void TextureCache<P>::UntrackDescriptorTable(DescriptorTable<TICEntry>& table) {
+    if (!table.IsTracked()) {
+        return;
+    }
+    device_memory.UpdatePagesCachedCount(table.TrackedAddress(), table.TrackedSize(), -1);
+    table.Untrack();
+}
+
+template <class P>
+void TextureCache<P>::UntrackDescriptorTables(DAddr cpu_addr, size_t size) {
+    const auto untrack = [this, cpu_addr, size](DescriptorTable<TICEntry>& table) {
+        if (table.IsTracked() && cpu_addr < table.TrackedAddress() + table.TrackedSize() &&
+            table.TrackedAddress() < cpu_addr + size) {
+            UntrackDescriptorTable(table);
+        }
+    };
+    for (size_t c : active_channel_ids) {
+        auto& channel_info = channel_storage[c];
+        untrack(channel_info.graphics_image_table);
+        untrack(channel_info.compute_image_table);
+    }
+}
+
 template <class P>
 FramebufferId TextureCache<P>::GetFramebufferId(const RenderTargets& key) {
     const auto [pair, is_new] = framebuffers.try_emplace(key);
@@ -534,12 +636,22 @@ FramebufferId TextureCache<P>::GetFramebufferId(const RenderTargets& key) {
 
 template <class P>
 void TextureCache<P>::WriteMemory(DAddr cpu_addr, size_t size) {
-    ForEachImageInRegion(cpu_addr, size, [this](ImageId image_id, Image& image) {
+    UntrackDescriptorTables(cpu_addr, size);
+    ForEachImageInRegion(cpu_addr, size, [this, cpu_addr, size](ImageId image_id, Image& image) {
         if (True(image.flags & ImageFlagBits::CpuModified)) {
+            if (image.HasPartialCpuModification()) {
+                ExtendCpuModification(image, cpu_addr, size);
+            }
             return;
         }
         image.flags |= ImageFlagBits::CpuModified;
-        if (True(image.flags & ImageFlagBits::Tracked)) {
+        if (False(image.flags & ImageFlagBits::Tracked)) {
+            return;
+        }
+        if (CanUploadPartially(image)) {
+            // Keep watching the rest of the image, only the written pages are uploaded again
+            ExtendCpuModification(image, cpu_addr, size);
+        } else {
             UntrackImage(image, image_id);
         }
     });
@@ -592,7 +704,14 @@ std::optional<VideoCore::RasterizerDownloadArea> TextureCache<P>::GetFlushArea(D
             auto& image_view = slot_image_views[image_view_id];
             image_view.flags |= ImageViewFlagBits::PreemtiveDownload;
         }
-        area->preemtive &= image.info.forced_flushed;
+        // The contents are only downloaded ahead when the download was submitted before this read
+        area->preemtive &=
+            image.info.forced_flushed && False(image.flags & ImageFlagBits::ReadbackQueued);
+        // Learn the images the CPU reads, the ones flushed from their creation are always read
+        if (!image.info.forced_flushed || image.readback_score > 0) {
+            image.readback_score = (std::min)(image.readback_score + 1, MAX_READBACK_SCORE);
+        }
+        image.unread_downloads = 0;
         image.info.forced_flushed = true;
     });
     return area;
@@ -600,6 +719,7 @@ std::optional<VideoCore::RasterizerDownloadArea> TextureCache<P>::GetFlushArea(D
 
 template <class P>
 void TextureCache<P>::UnmapMemory(DAddr cpu_addr, size_t size) {
+    UntrackDescriptorTables(cpu_addr, size);
     boost::container::small_vector<ImageId, 16> deleted_images;
     ForEachImageInRegion(cpu_addr, size, [&](ImageId id, Image&) { deleted_images.push_back(id); });
     for (const ImageId id : deleted_images) {
@@ -614,12 +734,27 @@ void TextureCache<P>::UnmapMemory(DAddr cpu_addr, size_t size) {
 
 template <class P>
 void TextureCache<P>::UnmapGPUMemory(size_t as_id, GPUVAddr gpu_addr, size_t size) {
+    // Remapping moves the descriptor tables to other device memory
+    for (size_t c : active_channel_ids) {
+        auto& channel_info = channel_storage[c];
+        if (channel_info.gpu_memory.GetID() != as_id) {
+            continue;
+        }
+        for (auto* const table :
+             {&channel_info.graphics_image_table, &channel_info.compute_image_table}) {
+            if (gpu_addr < table->Address() + table->SizeBytes() &&
+                table->Address() < gpu_addr + size) {
+                UntrackDescriptorTable(*table);
+            }
+        }
+    }
     boost::container::small_vector<ImageId, 16> deleted_images;
     ForEachImageInRegionGPU(as_id, gpu_addr, size,
                             [&](ImageId id, Image&) { deleted_images.push_back(id); });
     for (const ImageId id : deleted_images) {
         Image& image = slot_images[id];
-        if (False(image.flags & ImageFlagBits::CpuModified)) {
+        if (False(image.flags & ImageFlagBits::CpuModified) ||
+            image.HasPartialCpuModification()) {
             image.flags |= ImageFlagBits::CpuModified;
             if (True(image.flags & ImageFlagBits::Tracked)) {
                 UntrackImage(image, id);
@@ -735,22 +870,20 @@ template <class P>
 std::pair<typename P::ImageView*, bool> TextureCache<P>::TryFindFramebufferImageView(
     const Tegra::FramebufferConfig& config, DAddr cpu_addr) {
     // TODO: Properly implement this
-    const auto it = page_table.find(cpu_addr >> YUZU_PAGEBITS);
-    if (it == page_table.end()) {
-        return {};
-    }
-    const auto& image_map_ids = it->second;
     boost::container::small_vector<ImageId, 4> valid_image_ids;
-    for (const ImageMapId map_id : image_map_ids) {
+    image_map_index.ForEachOverlap(cpu_addr, cpu_addr + 1, [&](ImageMapId map_id) {
         const ImageMapView& map = slot_map_views[map_id];
         const ImageBase& image = slot_images[map.image_id];
         if (image.cpu_addr != cpu_addr) {
-            continue;
+            return;
         }
         if (image.image_view_ids.empty()) {
-            continue;
+            return;
         }
         valid_image_ids.push_back(map.image_id);
+    });
+    if (valid_image_ids.empty()) {
+        return {};
     }
 
     const auto view_format = [&]() {
@@ -831,6 +964,7 @@ void TextureCache<P>::CommitAsyncFlushes() {
                     Image& image = slot_images[download_info.object_id];
                     const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
                     image.DownloadMemory(download_map, copies);
+                    image.flags &= ~ImageFlagBits::ReadbackQueued;
                     download_map.offset += Common::AlignUp(image.unswizzled_size_bytes, 64);
                 }
             }
@@ -839,6 +973,13 @@ void TextureCache<P>::CommitAsyncFlushes() {
 
         async_buffers.emplace_back(std::move(uncommitted_async_buffers));
         uncommitted_async_buffers.clear();
+    } else {
+        // Downloads are recorded when they are popped, after every modification of this fence
+        for (const PendingDownload& download_info : uncommitted_downloads) {
+            if (download_info.is_swizzle) {
+                slot_images[download_info.object_id].flags &= ~ImageFlagBits::ReadbackQueued;
+            }
+        }
     }
     committed_downloads.emplace_back(std::move(uncommitted_downloads));
     uncommitted_downloads.clear();
@@ -861,7 +1002,8 @@ void TextureCache<P>::PopAsyncFlushes() {
             auto& download_info = download_ids[i - 1];
             auto& download_buffer = download_map[download_info.async_buffer_id];
             if (download_info.is_swizzle) {
-                const ImageBase& image = slot_images[download_info.object_id];
+                ImageBase& image = slot_images[download_info.object_id];
+                RecordUnreadDownload(image);
                 const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
                 download_buffer.offset -= Common::AlignUp(image.unswizzled_size_bytes, 64);
                 std::span<u8> download_span =
@@ -912,7 +1054,8 @@ void TextureCache<P>::PopAsyncFlushes() {
             if (!download_info.is_swizzle) {
                 continue;
             }
-            const ImageBase& image = slot_images[download_info.object_id];
+            ImageBase& image = slot_images[download_info.object_id];
+            RecordUnreadDownload(image);
             const auto copies = FixSmallVectorADL(FullDownloadCopies(image.info));
             SwizzleImage(*gpu_memory, image.gpu_addr, image.info, copies, download_span, swizzle_data_buffer);
             download_map.offset += image.unswizzled_size_bytes;
@@ -977,6 +1120,20 @@ bool TextureCache<P>::IsRegionGpuModified(DAddr addr, size_t size) {
     return is_modified;
 }
 
+template <class P>
+bool TextureCache<P>::HasImagesInRegion(GPUVAddr gpu_addr, size_t size) {
+    const std::optional<DAddr> cpu_addr = gpu_memory->GpuToCpuAddress(gpu_addr);
+    if (!cpu_addr) {
+        return false;
+    }
+    bool has_images = false;
+    ForEachImageInRegion(*cpu_addr, size, [&has_images](ImageId, ImageBase&) {
+        has_images = true;
+        return true;
+    });
+    return has_images;
+}
+
 template <class P>
 std::pair<typename TextureCache<P>::Image*, BufferImageCopy> TextureCache<P>::DmaBufferImageCopy(
     const Tegra::DMA::ImageCopy& copy_info, const Tegra::DMA::BufferOperand& buffer_operand,
@@ -1054,7 +1211,15 @@ void TextureCache<P>::RefreshContents(Image& image, ImageId image_id) {
         return;
     }
     image.flags &= ~ImageFlagBits::CpuModified;
-    TrackImage(image, image_id);
+    u32 modified_begin = 0;
+    u32 modified_end = image.guest_size_bytes;
+    if (image.HasPartialCpuModification()) {
+        modified_begin = image.cpu_modified_begin;
+        modified_end = image.cpu_modified_end;
+        RetrackCpuModification(image);
+    } else {
+        TrackImage(image, image_id);
+    }
 
     if (image.info.num_samples > 1 && !runtime.CanUploadMSAA()) {
         LOG_WARNING(HW_GPU, "MSAA image uploads are not implemented");
@@ -1065,14 +1230,22 @@ void TextureCache<P>::RefreshContents(Image& image, ImageId image_id) {
         QueueAsyncDecode(image, image_id);
         return;
     }
+    if constexpr (IMPLEMENTS_HOST_IMAGE_COPY) {
+        if (runtime.CanUploadFromHost(image)) {
+            auto host_buffer = runtime.HostUploadBuffer(MapSizeBytes(image));
+            UploadImageContents(image, host_buffer, modified_begin, modified_end);
+            return;
+        }
+    }
     auto staging = runtime.UploadStagingBuffer(MapSizeBytes(image));
-    UploadImageContents(image, staging);
+    UploadImageContents(image, staging, modified_begin, modified_end);
     runtime.InsertUploadMemoryBarrier();
 }
 
 template <class P>
 template <typename StagingBuffer>
-void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging) {
+void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging,
+                                          u32 modified_begin, u32 modified_end) {
     const std::span<u8> mapped_span = staging.mapped_span;
     const GPUVAddr gpu_addr = image.gpu_addr;
 
@@ -1086,13 +1259,33 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
 
     Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead> swizzle_data(
         *gpu_memory, gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
+    const bool is_partial = modified_begin != 0 || modified_end != image.guest_size_bytes;
+    const auto count_avoided_bytes = [&](std::span<const BufferImageCopy> copies) {
+        if (!is_partial) {
+            return;
+        }
+        size_t uploaded_bytes = 0;
+        for (const BufferImageCopy& copy : copies) {
+            uploaded_bytes += copy.buffer_size;
+        }
+        ++partial_uploads;
+        partial_upload_bytes_avoided += image.unswizzled_size_bytes - uploaded_bytes;
+    };
     if (True(image.flags & ImageFlagBits::Converted)) {
         unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
-        auto copies = FixSmallVectorADL(UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, unswizzle_data_buffer));
+        // Conversions work on whole levels, only levels untouched by the CPU are skipped
+        auto copies = FixSmallVectorADL(
+            UnswizzleImageRange(*gpu_memory, gpu_addr, image.info, swizzle_data,
+                                unswizzle_data_buffer, modified_begin, modified_end, false));
+        count_avoided_bytes(copies);
         ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
         image.UploadMemory(staging, copies);
     } else {
-        const auto copies = FixSmallVectorADL(UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, mapped_span));
+        const auto copies = FixSmallVectorADL(UnswizzleImageRange(*gpu_memory, gpu_addr, image.info,
+                                                                  swizzle_data, mapped_span,
+                                                                  modified_begin, modified_end,
+                                                                  true));
+        count_avoided_bytes(copies);
         image.UploadMemory(staging, copies);
     }
 }
@@ -1342,7 +1535,9 @@ bool TextureCache<P>::ScaleUp(Image& image) {
         return false;
     }
     if (!has_copy) {
-        total_used_memory += GetScaledImageSizeBytes(image);
+        const u64 scaled_size = GetScaledImageSizeBytes(image);
+        total_used_memory += scaled_size;
+        image_memory_usage.fetch_add(scaled_size, std::memory_order_relaxed);
     }
     InvalidateScale(image);
     return true;
@@ -1385,6 +1580,7 @@ ImageId TextureCache<P>::InsertImage(const ImageInfo& info, GPUVAddr gpu_addr,
 
 template <class P>
 ImageId TextureCache<P>::JoinImages(const ImageInfo& info, GPUVAddr gpu_addr, DAddr cpu_addr) {
+    PROFILE_SCOPE("TextureCache::JoinImages");
     ImageInfo new_info = info;
     const size_t size_bytes = CalculateGuestSizeInBytes(new_info);
     const bool broken_views = runtime.HasBrokenTextureViewFormats();
@@ -1735,10 +1931,109 @@ SamplerId TextureCache<P>::FindSampler(const TSCEntry& config) {
         return NULL_SAMPLER_ID;
     }
     const auto [pair, is_new] = channel_state->samplers.try_emplace(config);
-    if (is_new) {
-        pair->second = slot_samplers.insert(runtime, config);
+    if (!is_new) {
+        return pair->second;
+    }
+    // Descriptors that only differ in fields the host ignores share the same sampler
+    const TSCEntry key = CanonicalSampler(config);
+    if (const auto it = canonical_samplers.find(key); it != canonical_samplers.end()) {
+        pair->second = it->second;
+        return it->second;
+    }
+    if (canonical_samplers.size() >= sampler_limit) {
+        EvictSamplers();
+    }
+    const SamplerId sampler_id = slot_samplers.insert(runtime, key);
+    if (sampler_entries.size() <= sampler_id.index) {
+        sampler_entries.resize(sampler_id.index + 1);
+    }
+    sampler_entries[sampler_id.index] = SamplerEntry{
+        .key = key,
+        .lru_index = sampler_lru_cache.Insert(sampler_id, frame_tick),
+        .last_use_tick = frame_tick,
+    };
+    canonical_samplers.emplace(key, sampler_id);
+    ++samplers_created;
+    // Evicting may have invalidated the iterator of the per channel map
+    channel_state->samplers.insert_or_assign(config, sampler_id);
+    return sampler_id;
+}
+
+template <class P>
+void TextureCache<P>::TouchSampler(SamplerId id) {
+    if (id == NULL_SAMPLER_ID) {
+        return;
+    }
+    SamplerEntry& entry = sampler_entries[id.index];
+    if (entry.last_use_tick == frame_tick) {
+        return;
+    }
+    entry.last_use_tick = frame_tick;
+    sampler_lru_cache.Touch(entry.lru_index, frame_tick);
+}
+
+template <class P>
+void TextureCache<P>::EvictSamplers() {
+    // Samplers used in the current frame may still be bound, so they are never evicted
+    if (frame_tick == 0) {
+        return;
+    }
+    const size_t target = (std::max<size_t>)(sampler_limit / 4, 1);
+    boost::container::small_vector<SamplerId, 64> evicted;
+    sampler_lru_cache.ForEachItemBelow(frame_tick - 1, [&](SamplerId id) {
+        if (evicted.size() < target) {
+            evicted.push_back(id);
+        }
+    });
+    if (evicted.empty()) {
+        if (!sampler_limit_reached) {
+            LOG_WARNING(HW_GPU, "More than {} samplers are used in a single frame",
+                        sampler_limit);
+            sampler_limit_reached = true;
+        }
+        return;
+    }
+    for (const SamplerId id : evicted) {
+        const SamplerEntry& entry = sampler_entries[id.index];
+        sampler_lru_cache.Free(entry.lru_index);
+        canonical_samplers.erase(entry.key);
+        sentenced_samplers.Push(std::move(slot_samplers[id]));
+        slot_samplers.erase(id);
+    }
+    samplers_evicted += evicted.size();
+
+    const auto is_evicted = [&evicted](const auto& pair) {
+        return std::ranges::find(evicted, pair.second) != evicted.end();
+    };
+    for (size_t c : active_channel_ids) {
+        auto& channel_info = channel_storage[c];
+        std::erase_if(channel_info.samplers, is_evicted);
+        // Drop the cached sampler ids, they are looked up again on their next use
+        channel_info.graphics_sampler_table.Invalidate();
+        channel_info.compute_sampler_table.Invalidate();
     }
-    return pair->second;
+}
+
+template <class P>
+void TextureCache<P>::ReportSamplerStatistics() {
+    if (samplers_created == 0 && samplers_evicted == 0) {
+        return;
+    }
+    LOG_DEBUG(HW_GPU, "Samplers: {} cached, {} created and {} evicted in the last {} frames",
+              canonical_samplers.size(), samplers_created, samplers_evicted, STATISTICS_PERIOD);
+    samplers_created = 0;
+    samplers_evicted = 0;
+}
+
+template <class P>
+void TextureCache<P>::ReportUploadStatistics() {
+    if (partial_uploads == 0) {
+        return;
+    }
+    LOG_DEBUG(HW_GPU, "Partial image uploads: {} skipped {} bytes in the last {} frames",
+              partial_uploads, partial_upload_bytes_avoided, STATISTICS_PERIOD);
+    partial_uploads = 0;
+    partial_upload_bytes_avoided = 0;
 }
 
 template <class P>
@@ -1809,43 +2104,31 @@ void TextureCache<P>::ForEachImageInRegion(DAddr cpu_addr, size_t size, Func&& f
     static constexpr bool BOOL_BREAK = std::is_same_v<FuncReturn, bool>;
     boost::container::small_vector<ImageId, 32> images;
     boost::container::small_vector<ImageMapId, 32> maps;
-    ForEachCPUPage(cpu_addr, size, [this, &images, &maps, cpu_addr, size, func](u64 page) {
-        const auto it = page_table.find(page);
-        if (it == page_table.end()) {
-            if constexpr (BOOL_BREAK) {
-                return false;
-            } else {
-                return;
-            }
+    // Maps are collected first, the callback may register or unregister images
+    image_map_index.ForEachOverlap(cpu_addr, cpu_addr + size, [this, &maps](ImageMapId map_id) {
+        ImageMapView& map = slot_map_views[map_id];
+        if (map.picked) {
+            return;
         }
-        for (const ImageMapId map_id : it->second) {
-            ImageMapView& map = slot_map_views[map_id];
-            if (map.picked) {
-                continue;
-            }
-            if (!map.Overlaps(cpu_addr, size)) {
-                continue;
-            }
-            map.picked = true;
-            maps.push_back(map_id);
-            Image& image = slot_images[map.image_id];
-            if (True(image.flags & ImageFlagBits::Picked)) {
-                continue;
-            }
-            image.flags |= ImageFlagBits::Picked;
-            images.push_back(map.image_id);
-            if constexpr (BOOL_BREAK) {
-                if (func(map.image_id, image)) {
-                    return true;
-                }
-            } else {
-                func(map.image_id, image);
-            }
+        map.picked = true;
+        maps.push_back(map_id);
+    });
+    for (const ImageMapId map_id : maps) {
+        const ImageId image_id = slot_map_views[map_id].image_id;
+        Image& image = slot_images[image_id];
+        if (True(image.flags & ImageFlagBits::Picked)) {
+            continue;
         }
+        image.flags |= ImageFlagBits::Picked;
+        images.push_back(image_id);
         if constexpr (BOOL_BREAK) {
-            return false;
+            if (func(image_id, image)) {
+                break;
+            }
+        } else {
+            func(image_id, image);
         }
-    });
+    }
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
@@ -1865,39 +2148,24 @@ void TextureCache<P>::ForEachImageInRegionGPU(size_t as_id, GPUVAddr gpu_addr, s
     if (!storage_id) {
         return;
     }
-    auto& gpu_page_table = gpu_page_table_storage[*storage_id * 2];
-    ForEachGPUPage(gpu_addr, size,
-                   [this, &gpu_page_table, &images, gpu_addr, size, func](u64 page) {
-                       const auto it = gpu_page_table.find(page);
-                       if (it == gpu_page_table.end()) {
-                           if constexpr (BOOL_BREAK) {
-                               return false;
-                           } else {
-                               return;
-                           }
-                       }
-                       for (const ImageId image_id : it->second) {
-                           Image& image = slot_images[image_id];
-                           if (True(image.flags & ImageFlagBits::Picked)) {
-                               continue;
-                           }
-                           if (!image.OverlapsGPU(gpu_addr, size)) {
-                               continue;
-                           }
-                           image.flags |= ImageFlagBits::Picked;
-                           images.push_back(image_id);
-                           if constexpr (BOOL_BREAK) {
-                               if (func(image_id, image)) {
-                                   return true;
-                               }
-                           } else {
-                               func(image_id, image);
-                           }
-                       }
-                       if constexpr (BOOL_BREAK) {
-                           return false;
-                       }
-                   });
+    const auto& gpu_image_index = gpu_image_index_storage[*storage_id];
+    gpu_image_index.ForEachOverlap(gpu_addr, gpu_addr + size, [this, &images](ImageId image_id) {
+        Image& image = slot_images[image_id];
+        if (True(image.flags & ImageFlagBits::Picked)) {
+            return;
+        }
+        image.flags |= ImageFlagBits::Picked;
+        images.push_back(image_id);
+    });
+    for (const ImageId image_id : images) {
+        if constexpr (BOOL_BREAK) {
+            if (func(image_id, slot_images[image_id])) {
+                break;
+            }
+        } else {
+            func(image_id, slot_images[image_id]);
+        }
+    }
     for (const ImageId image_id : images) {
         slot_images[image_id].flags &= ~ImageFlagBits::Picked;
     }
@@ -1914,7 +2182,7 @@ void TextureCache<P>::ForEachSparseImageInRegion(size_t as_id, GPUVAddr gpu_addr
     if (!storage_id) {
         return;
     }
-    auto& sparse_page_table = gpu_page_table_storage[*storage_id * 2 + 1];
+    auto& sparse_page_table = sparse_page_table_storage[*storage_id];
     ForEachGPUPage(gpu_addr, size,
                    [this, &sparse_page_table, &images, gpu_addr, size, func](u64 page) {
                        const auto it = sparse_page_table.find(page);
@@ -1996,16 +2264,15 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory += Common::AlignUp(tentative_size, 1024);
+    image_memory_usage.fetch_add(Common::AlignUp(tentative_size, 1024), std::memory_order_relaxed);
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
 
-    ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
-        (*channel_state->gpu_page_table)[page].push_back(image_id);
-    });
+    channel_state->gpu_image_index->Insert(image.gpu_addr, image.gpu_addr + image.guest_size_bytes,
+                                           image_id);
     if (False(image.flags & ImageFlagBits::Sparse)) {
         auto map_id =
             slot_map_views.insert(image.gpu_addr, image.cpu_addr, image.guest_size_bytes, image_id);
-        ForEachCPUPage(image.cpu_addr, image.guest_size_bytes,
-                       [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+        image_map_index.Insert(image.cpu_addr, image.cpu_addr + image.guest_size_bytes, map_id);
         image.map_view_id = map_id;
         return;
     }
@@ -2013,8 +2280,7 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     ForEachSparseSegment(
         image, [this, image_id, &sparse_maps](GPUVAddr gpu_addr, DAddr cpu_addr, size_t size) {
             auto map_id = slot_map_views.insert(gpu_addr, cpu_addr, size, image_id);
-            ForEachCPUPage(cpu_addr, size,
-                           [this, map_id](u64 page) { page_table[page].push_back(map_id); });
+            image_map_index.Insert(cpu_addr, cpu_addr + size, map_id);
             sparse_maps.push_back(map_id);
         });
     sparse_views.emplace(image_id, std::move(sparse_maps));
@@ -2049,26 +2315,17 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
             }
             image_ids.erase(vector_it);
         };
-    ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, &clear_page_table](u64 page) {
-        clear_page_table(page, (*channel_state->gpu_page_table));
-    });
+    if (!channel_state->gpu_image_index->Erase(
+            image.gpu_addr, image.gpu_addr + image.guest_size_bytes, image_id)) {
+        ASSERT_MSG(false, "Unregistering unregistered image at gpu_addr=0x{:x}", image.gpu_addr);
+    }
     if (False(image.flags & ImageFlagBits::Sparse)) {
         const auto map_id = image.map_view_id;
-        ForEachCPUPage(image.cpu_addr, image.guest_size_bytes, [this, map_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            const auto vector_it = std::ranges::find(image_map_ids, map_id);
-            if (vector_it == image_map_ids.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered image in page=0x{:x}",
-                           page << YUZU_PAGEBITS);
-                return;
-            }
-            image_map_ids.erase(vector_it);
-        });
+        if (!image_map_index.Erase(image.cpu_addr, image.cpu_addr + image.guest_size_bytes,
+                                   map_id)) {
+            ASSERT_MSG(false, "Unregistering unregistered image at cpu_addr=0x{:x}",
+                       image.cpu_addr);
+        }
         slot_map_views.erase(map_id);
         return;
     }
@@ -2081,27 +2338,10 @@ void TextureCache<P>::UnregisterImage(ImageId image_id) {
     for (auto& map_view_id : sparse_maps) {
         const auto& map_range = slot_map_views[map_view_id];
         const DAddr cpu_addr = map_range.cpu_addr;
-        const std::size_t size = map_range.size;
-        ForEachCPUPage(cpu_addr, size, [this, image_id](u64 page) {
-            const auto page_it = page_table.find(page);
-            if (page_it == page_table.end()) {
-                ASSERT_MSG(false, "Unregistering unregistered page=0x{:x}", page << YUZU_PAGEBITS);
-                return;
-            }
-            std::vector<ImageMapId>& image_map_ids = page_it->second;
-            auto vector_it = image_map_ids.begin();
-            while (vector_it != image_map_ids.end()) {
-                ImageMapView& map = slot_map_views[*vector_it];
-                if (map.image_id != image_id) {
-                    vector_it++;
-                    continue;
-                }
-                if (!map.picked) {
-                    map.picked = true;
-                }
-                vector_it = image_map_ids.erase(vector_it);
-            }
-        });
+        if (!image_map_index.Erase(cpu_addr, cpu_addr + map_range.size, map_view_id)) {
+            ASSERT_MSG(false, "Unregistering unregistered sparse map at cpu_addr=0x{:x}",
+                       cpu_addr);
+        }
         slot_map_views.erase(map_view_id);
     }
     sparse_views.erase(it);
@@ -2139,6 +2379,20 @@ template <class P>
 void TextureCache<P>::UntrackImage(ImageBase& image, ImageId image_id) {
     ASSERT(True(image.flags & ImageFlagBits::Tracked));
     image.flags &= ~ImageFlagBits::Tracked;
+    if (image.HasPartialCpuModification()) {
+        // The modified pages are already untracked, the image is now modified as a whole
+        if (image.cpu_modified_begin > 0) {
+            device_memory.UpdatePagesCachedCount(image.cpu_addr, image.cpu_modified_begin, -1);
+        }
+        if (image.cpu_modified_end < image.guest_size_bytes) {
+            device_memory.UpdatePagesCachedCount(image.cpu_addr + image.cpu_modified_end,
+                                                 image.guest_size_bytes - image.cpu_modified_end,
+                                                 -1);
+        }
+        image.cpu_modified_begin = 0;
+        image.cpu_modified_end = 0;
+        return;
+    }
     if (False(image.flags & ImageFlagBits::Sparse)) {
         if (image.cpu_addr < ~(1ULL << 40)) {
             device_memory.UpdatePagesCachedCount(image.cpu_addr, image.guest_size_bytes, -1);
@@ -2157,11 +2411,64 @@ void TextureCache<P>::UntrackImage(ImageBase& image, ImageId image_id) {
     }
 }
 
+template <class P>
+bool TextureCache<P>::CanUploadPartially(const ImageBase& image) const noexcept {
+    constexpr ImageFlagBits whole_upload_flags = ImageFlagBits::Sparse |
+                                                 ImageFlagBits::AcceleratedUpload |
+                                                 ImageFlagBits::AsynchronousDecode;
+    return False(image.flags & whole_upload_flags) && image.info.type != ImageType::Linear &&
+           image.info.type != ImageType::Buffer && image.info.num_samples == 1 &&
+           image.cpu_addr < ~(1ULL << 40);
+}
+
+template <class P>
+void TextureCache<P>::ExtendCpuModification(ImageBase& image, DAddr cpu_addr, size_t size) {
+    // Untracked ranges are page aligned so they don't share pages with the tracked ones, unless
+    // they reach the ends of the image
+    const DAddr image_end = image.cpu_addr + image.guest_size_bytes;
+    const DAddr begin = (std::max)(Common::AlignDown(cpu_addr, Core::DEVICE_PAGESIZE),
+                                   image.cpu_addr);
+    const DAddr end = (std::min)(Common::AlignUp(cpu_addr + size, Core::DEVICE_PAGESIZE),
+                                 image_end);
+    if (begin >= end) {
+        return;
+    }
+    const u32 new_begin = static_cast<u32>(begin - image.cpu_addr);
+    const u32 new_end = static_cast<u32>(end - image.cpu_addr);
+    if (!image.HasPartialCpuModification()) {
+        device_memory.UpdatePagesCachedCount(begin, end - begin, -1);
+        image.cpu_modified_begin = new_begin;
+        image.cpu_modified_end = new_end;
+        return;
+    }
+    // Only untrack the pages the range grows by, the range stays contiguous
+    if (new_begin < image.cpu_modified_begin) {
+        device_memory.UpdatePagesCachedCount(begin, image.cpu_modified_begin - new_begin, -1);
+        image.cpu_modified_begin = new_begin;
+    }
+    if (new_end > image.cpu_modified_end) {
+        device_memory.UpdatePagesCachedCount(image.cpu_addr + image.cpu_modified_end,
+                                             new_end - image.cpu_modified_end, -1);
+        image.cpu_modified_end = new_end;
+    }
+}
+
+template <class P>
+void TextureCache<P>::RetrackCpuModification(ImageBase& image) {
+    ASSERT(True(image.flags & ImageFlagBits::Tracked));
+    device_memory.UpdatePagesCachedCount(image.cpu_addr + image.cpu_modified_begin,
+                                         image.cpu_modified_end - image.cpu_modified_begin, 1);
+    image.cpu_modified_begin = 0;
+    image.cpu_modified_end = 0;
+}
+
 template <class P>
 void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
     ImageBase& image = slot_images[image_id];
     if (image.HasScaled()) {
-        total_used_memory -= GetScaledImageSizeBytes(image);
+        const u64 scaled_size = GetScaledImageSizeBytes(image);
+        total_used_memory -= scaled_size;
+        image_memory_usage.fetch_sub(scaled_size, std::memory_order_relaxed);
     }
     u64 tentative_size = (std::max)(image.guest_size_bytes, image.unswizzled_size_bytes);
     if ((IsPixelFormatASTC(image.info.format) &&
@@ -2170,6 +2477,7 @@ void TextureCache<P>::DeleteImage(ImageId image_id, bool immediate_delete) {
         tentative_size = TranscodedAstcSize(tentative_size, image.info.format);
     }
     total_used_memory -= Common::AlignUp(tentative_size, 1024);
+    image_memory_usage.fetch_sub(Common::AlignUp(tentative_size, 1024), std::memory_order_relaxed);
     const GPUVAddr gpu_addr = image.gpu_addr;
     const auto alloc_it = image_allocs_table.find(gpu_addr);
     if (alloc_it == image_allocs_table.end()) {
@@ -2345,7 +2653,9 @@ void TextureCache<P>::PrepareImage(ImageId image_id, bool is_modification, bool
     Image& image = slot_images[image_id];
     if (invalidate) {
         image.flags &= ~(ImageFlagBits::CpuModified | ImageFlagBits::GpuModified);
-        if (False(image.flags & ImageFlagBits::Tracked)) {
+        if (image.HasPartialCpuModification()) {
+            RetrackCpuModification(image);
+        } else if (False(image.flags & ImageFlagBits::Tracked)) {
             TrackImage(image, image_id);
         }
     } else {
@@ -2354,6 +2664,10 @@ void TextureCache<P>::PrepareImage(ImageId image_id, bool is_modification, bool
     }
     if (is_modification) {
         MarkModification(image);
+        // Writes outside of render targets are downloaded ahead as well once the CPU reads them
+        if (image.readback_score > 0) {
+            QueueReadback(image_id);
+        }
     }
     lru_cache.Touch(image.lru_index, frame_tick);
 }
@@ -2467,13 +2781,39 @@ void TextureCache<P>::BindRenderTarget(ImageViewId* old_id, ImageViewId new_id)
     if (new_id) {
         const ImageViewBase& old_view = slot_image_views[new_id];
         if (True(old_view.flags & ImageViewFlagBits::PreemtiveDownload)) {
-            const PendingDownload new_download{true, 0, old_view.image_id};
-            uncommitted_downloads.emplace_back(new_download);
+            QueueReadback(old_view.image_id);
         }
     }
     *old_id = new_id;
 }
 
+template <class P>
+void TextureCache<P>::QueueReadback(ImageId image_id) {
+    ImageBase& image = slot_images[image_id];
+    if (True(image.flags & ImageFlagBits::ReadbackQueued)) {
+        return;
+    }
+    image.flags |= ImageFlagBits::ReadbackQueued;
+    const PendingDownload new_download{true, 0, image_id};
+    uncommitted_downloads.emplace_back(new_download);
+}
+
+template <class P>
+void TextureCache<P>::RecordUnreadDownload(ImageBase& image) {
+    if (image.readback_score == 0 || ++image.unread_downloads < UNREAD_DOWNLOADS_PER_SCORE) {
+        return;
+    }
+    image.unread_downloads = 0;
+    if (--image.readback_score > 0) {
+        return;
+    }
+    // The CPU stopped reading the image, go back to flushing it on demand
+    image.info.forced_flushed = false;
+    for (const ImageViewId image_view_id : image.image_view_ids) {
+        slot_image_views[image_view_id].flags &= ~ImageViewFlagBits::PreemtiveDownload;
+    }
+}
+
 template <class P>
 std::pair<FramebufferId, ImageViewId> TextureCache<P>::RenderTargetFromImage(
     ImageId image_id, const ImageViewInfo& view_info) {
@@ -2531,15 +2871,15 @@ void TextureCache<P>::CreateChannel(struct Tegra::Control::ChannelState& channel
     const auto it = channel_map.find(channel.bind_id);
     auto* this_state = &channel_storage[it->second];
     const auto& this_as_ref = address_spaces[channel.memory_manager->GetID()];
-    this_state->gpu_page_table = &gpu_page_table_storage[this_as_ref.storage_id * 2];
-    this_state->sparse_page_table = &gpu_page_table_storage[this_as_ref.storage_id * 2 + 1];
+    this_state->gpu_image_index = &gpu_image_index_storage[this_as_ref.storage_id];
+    this_state->sparse_page_table = &sparse_page_table_storage[this_as_ref.storage_id];
 }
 
 /// Bind a channel for execution.
 template <class P>
 void TextureCache<P>::OnGPUASRegister([[maybe_unused]] size_t map_id) {
-    gpu_page_table_storage.emplace_back();
-    gpu_page_table_storage.emplace_back();
+    gpu_image_index_storage.emplace_back();
+    sparse_page_table_storage.emplace_back();
 }
 
 } // namespace VideoCommon
@@ -10,6 +10,7 @@
 #include <deque>
 #include <limits>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <type_traits>
 #include <unordered_map>
@@ -20,12 +21,14 @@
 
 #include "common/common_types.h"
 #include "common/hash.h"
+#include "common/interval_index.h"
 #include "common/literals.h"
 #include "common/lru_cache.h"
 #include <ranges>
 #include "common/scratch_buffer.h"
+#include "common/settings.h"
 #include "common/slot_vector.h"
-#include "common/thread_worker.h"
+#include "common/thread_pool.h"
 #include "video_core/compatible_formats.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/delayed_destruction_ring.h"
@@ -35,6 +38,7 @@
 #include "video_core/texture_cache/image_base.h"
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view_base.h"
+#include "video_core/texture_cache/memory_pressure.h"
 #include "video_core/texture_cache/render_targets.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/textures/texture.h"
@@ -67,6 +71,7 @@ struct AsyncDecodeContext {
 };
 
 using TextureCacheGPUMap = std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>;
+using TextureCacheGPUIndex = Common::IntervalIndex<GPUVAddr, ImageId>;
 
 class TextureCacheChannelInfo : public ChannelInfo {
 public:
@@ -88,7 +93,7 @@ public:
     std::unordered_map<TICEntry, ImageViewId> image_views;
     std::unordered_map<TSCEntry, SamplerId> samplers;
 
-    TextureCacheGPUMap* gpu_page_table;
+    TextureCacheGPUIndex* gpu_image_index;
     TextureCacheGPUMap* sparse_page_table;
 };
 
@@ -107,6 +112,8 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     static constexpr bool HAS_DEVICE_MEMORY_INFO = P::HAS_DEVICE_MEMORY_INFO;
     /// True when the API can do asynchronous texture downloads.
     static constexpr bool IMPLEMENTS_ASYNC_DOWNLOADS = P::IMPLEMENTS_ASYNC_DOWNLOADS;
+    /// True when the API can write images directly from host memory.
+    static constexpr bool IMPLEMENTS_HOST_IMAGE_COPY = P::IMPLEMENTS_HOST_IMAGE_COPY;
 
     static constexpr size_t UNSET_CHANNEL{(std::numeric_limits<size_t>::max)()};
 
@@ -120,6 +127,16 @@ class TextureCache : public VideoCommon::ChannelSetupCaches<TextureCacheChannelI
     static constexpr s64 DEFAULT_CRITICAL_MEMORY = 1_GiB + 625_MiB;
     static constexpr size_t GC_EMERGENCY_COUNTS = 2;
 
+    /// Most host samplers kept alive, the least recently used ones are destroyed past it
+    static constexpr size_t MAX_SAMPLERS = 4096;
+    /// Frames between two reports of the cache statistics
+    static constexpr u64 STATISTICS_PERIOD = 600;
+
+    /// Highest confidence in the readbacks of an image
+    static constexpr u32 MAX_READBACK_SCORE = 4;
+    /// Preemptive downloads the CPU does not read that cost a point of confidence
+    static constexpr u32 UNREAD_DOWNLOADS_PER_SCORE = 16;
+
     using Runtime = typename P::Runtime;
     using Image = typename P::Image;
     using ImageAlloc = typename P::ImageAlloc;
@@ -142,6 +159,12 @@ public:
     /// Notify the cache that a new frame has been queued
     void TickFrame();
 
+    /// Evicts the images that weren't used recently, as far as the host pressure allows.
+    void Trim(MemoryPressure pressure);
+
+    /// Destroys the resources waiting for the GPU, once the host is known to be idle.
+    void ReleaseSentencedResources();
+
     /// Return a constant reference to the given image view id
     [[nodiscard]] const ImageView& GetImageView(ImageViewId id) const noexcept;
 
@@ -164,6 +187,11 @@ public:
     /// Handle feedback loops during draws.
     void CheckFeedbackLoop(std::span<const ImageViewInOut> views);
 
+    /// Returns true when the last checked draw sampled one of its render targets.
+    [[nodiscard]] bool HasFeedbackLoop() const noexcept {
+        return has_feedback_loop;
+    }
+
     /// Get the sampler from the graphics descriptor table in the specified index
     Sampler* GetGraphicsSampler(u32 index);
 
@@ -248,8 +276,16 @@ public:
     /// Return true when a CPU region is modified from the GPU
     [[nodiscard]] bool IsRegionGpuModified(DAddr addr, size_t size);
 
+    /// Return true when a GPU region overlaps any cached image
+    [[nodiscard]] bool HasImagesInRegion(GPUVAddr gpu_addr, size_t size);
+
     [[nodiscard]] bool IsRescaling() const noexcept;
 
+    /// Return the memory owned by the cached images, safe to call from any thread
+    [[nodiscard]] u64 GetImageMemoryUsage() const noexcept {
+        return image_memory_usage.load(std::memory_order_relaxed);
+    }
+
     [[nodiscard]] bool IsRescaling(const ImageViewBase& image_view) const noexcept;
 
     /// Create channel state.
@@ -262,21 +298,6 @@ public:
 
 private:
     /// Iterate over all page indices in a range
-    template <typename Func>
-    static void ForEachCPUPage(DAddr addr, size_t size, Func&& func) {
-        static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
-        const u64 page_end = (addr + size - 1) >> YUZU_PAGEBITS;
-        for (u64 page = addr >> YUZU_PAGEBITS; page <= page_end; ++page) {
-            if constexpr (RETURNS_BOOL) {
-                if (func(page)) {
-                    break;
-                }
-            } else {
-                func(page);
-            }
-        }
-    }
-
     template <typename Func>
     static void ForEachGPUPage(GPUVAddr addr, size_t size, Func&& func) {
         static constexpr bool RETURNS_BOOL = std::is_same_v<std::invoke_result<Func, u64>, bool>;
@@ -297,6 +318,12 @@ private:
     /// Runs the Garbage Collector.
     void RunGarbageCollector();
 
+    /// Removes an image from the cache, writing it back to guest memory first if requested.
+    void EvictImage(ImageId image_id, bool must_download);
+
+    /// Copies the thresholds computed by the memory pressure manager
+    void ApplyMemoryThresholds();
+
     /// Fills image_view_ids in the image views in indices
     template <bool has_blacklists>
     void FillImageViews(DescriptorTable<TICEntry>& table,
@@ -307,6 +334,14 @@ private:
     ImageViewId VisitImageView(DescriptorTable<TICEntry>& table,
                                std::span<ImageViewId> cached_image_view_ids, u32 index);
 
+    /// Tracks the memory of an image descriptor table, so its unchanged entries are not read again
+    void TrackDescriptorTable(DescriptorTable<TICEntry>& table);
+
+    void UntrackDescriptorTable(DescriptorTable<TICEntry>& table);
+
+    /// Untracks the image descriptor tables of all channels that overlap the given device region
+    void UntrackDescriptorTables(DAddr cpu_addr, size_t size);
+
     /// Find or create a framebuffer with the given render target parameters
     FramebufferId GetFramebufferId(const RenderTargets& key);
 
@@ -315,7 +350,8 @@ private:
 
     /// Upload data from guest to an image
     template <typename StagingBuffer>
-    void UploadImageContents(Image& image, StagingBuffer& staging_buffer);
+    void UploadImageContents(Image& image, StagingBuffer& staging_buffer, u32 modified_begin,
+                             u32 modified_end);
 
     /// Find or create an image view from a guest descriptor
     [[nodiscard]] ImageViewId FindImageView(const TICEntry& config);
@@ -349,6 +385,18 @@ private:
     /// Find or create a sampler from a guest descriptor sampler
     [[nodiscard]] SamplerId FindSampler(const TSCEntry& config);
 
+    /// Marks a sampler as used in the current frame
+    void TouchSampler(SamplerId id);
+
+    /// Destroys the least recently used samplers not used in the current frame
+    void EvictSamplers();
+
+    /// Logs how many samplers were created and evicted since the last report
+    void ReportSamplerStatistics();
+
+    /// Logs how many bytes partial uploads skipped since the last report
+    void ReportUploadStatistics();
+
     /// Find or create an image view for the given color buffer index
     [[nodiscard]] ImageViewId FindColorBuffer(size_t index);
 
@@ -387,6 +435,15 @@ private:
     /// Stop tracking CPU reads and writes for image
     void UntrackImage(ImageBase& image, ImageId image_id);
 
+    /// Returns true when the CPU writes to an image can be uploaded without the rest of it
+    [[nodiscard]] bool CanUploadPartially(const ImageBase& image) const noexcept;
+
+    /// Adds a written range to the partial CPU modification of an image and untracks its pages
+    void ExtendCpuModification(ImageBase& image, DAddr cpu_addr, size_t size);
+
+    /// Tracks again the pages of the partial CPU modification of an image and clears it
+    void RetrackCpuModification(ImageBase& image);
+
     /// Delete image from the cache
     void DeleteImage(ImageId image, bool immediate_delete = false);
 
@@ -411,6 +468,12 @@ private:
     /// Bind an image view as render target, downloading resources preemtively if needed
     void BindRenderTarget(ImageViewId* old_id, ImageViewId new_id);
 
+    /// Queue a preemptive download of an image for the next fence, once per fence
+    void QueueReadback(ImageId image_id);
+
+    /// Lower the confidence in the readbacks of an image downloaded but not read by the CPU
+    void RecordUnreadDownload(ImageBase& image);
+
     /// Create a render target from a given image and image view parameters
     [[nodiscard]] std::pair<FramebufferId, ImageViewId> RenderTargetFromImage(
         ImageId, const ImageViewInfo& view_info);
@@ -433,23 +496,31 @@ private:
     Runtime& runtime;
 
     Tegra::MaxwellDeviceMemoryManager& device_memory;
-    std::deque<TextureCacheGPUMap> gpu_page_table_storage;
+    /// Images of each address space by their GPU range
+    std::deque<TextureCacheGPUIndex> gpu_image_index_storage;
+    /// Sparse images of each address space by the GPU pages they cover
+    std::deque<TextureCacheGPUMap> sparse_page_table_storage;
 
     RenderTargets render_targets;
 
     std::unordered_map<RenderTargets, FramebufferId> framebuffers;
 
-    std::unordered_map<u64, std::vector<ImageMapId>, Common::IdentityHash<u64>> page_table;
+    /// Image maps by their device memory range
+    Common::IntervalIndex<DAddr, ImageMapId> image_map_index;
     std::unordered_map<ImageId, boost::container::small_vector<ImageViewId, 16>> sparse_views;
 
     DAddr virtual_invalid_space{};
 
     bool has_deleted_images = false;
     bool is_rescaling = false;
+    bool has_feedback_loop = false;
     u64 total_used_memory = 0;
+    /// Estimated size of the images alone, total_used_memory follows the driver when it can
+    std::atomic<u64> image_memory_usage{};
     u64 minimum_memory;
     u64 expected_memory;
     u64 critical_memory;
+    std::optional<MemoryPressureManager> memory_pressure;
 
     struct BufferDownload {
         GPUVAddr address;
@@ -492,6 +563,24 @@ private:
     DelayedDestructionRing<Image, TICKS_TO_DESTROY> sentenced_images;
     DelayedDestructionRing<ImageView, TICKS_TO_DESTROY> sentenced_image_view;
     DelayedDestructionRing<Framebuffer, TICKS_TO_DESTROY> sentenced_framebuffers;
+    DelayedDestructionRing<Sampler, TICKS_TO_DESTROY> sentenced_samplers;
+
+    struct SamplerEntry {
+        TSCEntry key;
+        size_t lru_index;
+        u64 last_use_tick;
+    };
+    /// Samplers by the canonical form of their descriptor, shared by all channels
+    std::unordered_map<TSCEntry, SamplerId> canonical_samplers;
+    /// Bookkeeping of the cached samplers, indexed by their slot
+    std::vector<SamplerEntry> sampler_entries;
+    Common::LeastRecentlyUsedCache<LRUItemParams> sampler_lru_cache;
+    size_t sampler_limit = MAX_SAMPLERS;
+    u64 samplers_created = 0;
+    u64 samplers_evicted = 0;
+    u64 partial_uploads = 0;
+    u64 partial_upload_bytes_avoided = 0;
+    bool sampler_limit_reached = false;
 
     std::unordered_map<GPUVAddr, ImageAllocId> image_allocs_table;
 
@@ -501,7 +590,11 @@ private:
     u64 modification_tick = 0;
     u64 frame_tick = 0;
 
-    Common::ThreadWorker texture_decode_worker{1, "TextureDecoder"};
+    Common::PooledWorker texture_decode_worker{
+        Common::ThreadPool::Shared(Settings::values.core_type_affinity.GetValue()
+                                       ? Common::CoreType::Efficiency
+                                       : Common::CoreType::Any),
+        1};
     std::vector<std::unique_ptr<AsyncDecodeContext>> async_decodes;
 
     // Join caching
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <numeric>
 #include <optional>
 #include <span>
@@ -848,6 +849,14 @@ boost::container::small_vector<BufferImageCopy, 16> UnswizzleImage(Tegra::Memory
                                                                    const ImageInfo& info,
                                                                    std::span<const u8> input,
                                                                    std::span<u8> output) {
+    return UnswizzleImageRange(gpu_memory, gpu_addr, info, input, output, 0,
+                               std::numeric_limits<u32>::max(), true);
+}
+
+boost::container::small_vector<BufferImageCopy, 16> UnswizzleImageRange(
+    Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr, const ImageInfo& info,
+    std::span<const u8> input, std::span<u8> output, u32 guest_begin, u32 guest_end,
+    bool split_layers) {
     const size_t guest_size_bytes = input.size_bytes();
     const u32 bpp_log2 = BytesPerBlockLog2(info.format);
     const Extent2D tile_size = DefaultBlockSize(info.format);
@@ -883,38 +892,59 @@ boost::container::small_vector<BufferImageCopy, 16> UnswizzleImage(Tegra::Memory
                                             info.tile_width_spacing);
     size_t guest_offset = 0;
     u32 host_offset = 0;
-    boost::container::small_vector<BufferImageCopy, 16> copies(num_levels);
+    boost::container::small_vector<BufferImageCopy, 16> copies;
 
+    const auto is_layer_modified = [&](size_t layer_offset, s32 level) {
+        return layer_offset < guest_end && guest_begin < layer_offset + level_sizes[level];
+    };
     for (s32 level = 0; level < num_levels; ++level) {
         const Extent3D level_size = AdjustMipSize(size, level);
         const u32 num_blocks_per_layer = NumBlocks(level_size, tile_size);
         const u32 host_bytes_per_layer = num_blocks_per_layer << bpp_log2;
-        copies[level] = BufferImageCopy{
-            .buffer_offset = host_offset,
-            .buffer_size = static_cast<size_t>(host_bytes_per_layer) * num_layers,
-            .buffer_row_length = Common::AlignUp(level_size.width, tile_size.width),
-            .buffer_image_height = Common::AlignUp(level_size.height, tile_size.height),
-            .image_subresource =
-                {
-                    .base_level = level,
-                    .base_layer = 0,
-                    .num_layers = info.resources.layers,
-                },
-            .image_offset = {0, 0, 0},
-            .image_extent = level_size,
-        };
         const Extent3D num_tiles = AdjustTileSize(level_size, tile_size);
         const Extent3D block =
             AdjustMipBlockSize(num_tiles, level_info.block, level, level_info.num_levels);
         const u32 stride_alignment = StrideAlignment(num_tiles, info.block, gob, bpp_log2);
+        bool is_level_modified = false;
+        for (s32 layer = 0; layer < num_layers && !is_level_modified; ++layer) {
+            is_level_modified = is_layer_modified(guest_offset + static_cast<size_t>(layer) * layer_stride,
+                                                  level);
+        }
         size_t guest_layer_offset = 0;
+        s32 last_layer = -1;
+
+        for (s32 layer = 0; layer < num_layers; ++layer) {
+            const size_t layer_offset = guest_offset + guest_layer_offset;
+            guest_layer_offset += layer_stride;
+            if (split_layers ? !is_layer_modified(layer_offset, level) : !is_level_modified) {
+                continue;
+            }
+            if (last_layer >= 0 && last_layer + 1 == layer) {
+                // Extend the copy of the previous layer, runs of layers are uploaded at once
+                ++copies.back().image_subresource.num_layers;
+                copies.back().buffer_size += host_bytes_per_layer;
+            } else {
+                copies.push_back(BufferImageCopy{
+                    .buffer_offset = host_offset,
+                    .buffer_size = host_bytes_per_layer,
+                    .buffer_row_length = Common::AlignUp(level_size.width, tile_size.width),
+                    .buffer_image_height = Common::AlignUp(level_size.height, tile_size.height),
+                    .image_subresource =
+                        {
+                            .base_level = level,
+                            .base_layer = layer,
+                            .num_layers = 1,
+                        },
+                    .image_offset = {0, 0, 0},
+                    .image_extent = level_size,
+                });
+            }
+            last_layer = layer;
 
-        for (s32 layer = 0; layer < info.resources.layers; ++layer) {
             const std::span<u8> dst = output.subspan(host_offset);
-            const std::span<const u8> src = input.subspan(guest_offset + guest_layer_offset);
+            const std::span<const u8> src = input.subspan(layer_offset);
             UnswizzleTexture(dst, src, 1U << bpp_log2, num_tiles.width, num_tiles.height,
                              num_tiles.depth, block.height, block.depth, stride_alignment);
-            guest_layer_offset += layer_stride;
             host_offset += host_bytes_per_layer;
         }
         guest_offset += level_sizes[level];
@@ -1307,6 +1337,39 @@ u32 MapSizeBytes(const ImageBase& image) {
     }
 }
 
+Tegra::Texture::TSCEntry CanonicalSampler(const Tegra::Texture::TSCEntry& config) noexcept {
+    using Tegra::Texture::WrapMode;
+    const auto uses_border = [](WrapMode wrap) {
+        return wrap == WrapMode::Border || wrap == WrapMode::Clamp ||
+               wrap == WrapMode::MirrorOnceBorder || wrap == WrapMode::MirrorOnceClampOGL;
+    };
+    // Only copy the fields read by the backends, the sRGB border color, the trilinear
+    // optimization, unnormalized coordinates and the reserved bits are left out
+    Tegra::Texture::TSCEntry result{};
+    result.wrap_u.Assign(config.wrap_u);
+    result.wrap_v.Assign(config.wrap_v);
+    result.wrap_p.Assign(config.wrap_p);
+    result.depth_compare_enabled.Assign(config.depth_compare_enabled);
+    if (config.depth_compare_enabled) {
+        result.depth_compare_func.Assign(config.depth_compare_func);
+    }
+    result.max_anisotropy.Assign(config.max_anisotropy);
+    result.mag_filter.Assign(config.mag_filter);
+    result.min_filter.Assign(config.min_filter);
+    result.mipmap_filter.Assign(config.mipmap_filter);
+    result.cubemap_anisotropy.Assign(config.cubemap_anisotropy);
+    result.cubemap_interface_filtering.Assign(config.cubemap_interface_filtering);
+    result.reduction_filter.Assign(config.reduction_filter);
+    result.mip_lod_bias.Assign(config.mip_lod_bias);
+    result.min_lod_clamp.Assign(config.min_lod_clamp);
+    result.max_lod_clamp.Assign(config.max_lod_clamp);
+    if (uses_border(config.wrap_u) || uses_border(config.wrap_v) ||
+        uses_border(config.wrap_p)) {
+        result.border_color = config.border_color;
+    }
+    return result;
+}
+
 static_assert(CalculateLevelSize(LevelInfo{{1920, 1080, 1}, {0, 2, 0}, {1, 1}, 2, 0, 1}, 0) ==
               0x7f8000);
 static_assert(CalculateLevelSize(LevelInfo{{32, 32, 1}, {0, 0, 4}, {1, 1}, 4, 0, 1}, 0) == 0x40000);
@@ -69,6 +69,13 @@ struct OverlapResult {
     Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr, const ImageInfo& info,
     std::span<const u8> input, std::span<u8> output);
 
+/// Unswizzles the subresources overlapping the guest byte range [guest_begin, guest_end) of a
+/// block linear image, packed in the output. Levels are kept whole when layers can't be split.
+[[nodiscard]] boost::container::small_vector<BufferImageCopy, 16> UnswizzleImageRange(
+    Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr, const ImageInfo& info,
+    std::span<const u8> input, std::span<u8> output, u32 guest_begin, u32 guest_end,
+    bool split_layers);
+
 void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
                   std::span<BufferImageCopy> copies);
 
@@ -122,6 +129,13 @@ void DeduceBlitImages(ImageInfo& dst_info, ImageInfo& src_info, const ImageBase*
 
 [[nodiscard]] u32 MapSizeBytes(const ImageBase& image);
 
+/**
+ * Returns the descriptor with the fields no host sampler reads cleared, so equivalent guest
+ * samplers share one host sampler.
+ */
+[[nodiscard]] Tegra::Texture::TSCEntry CanonicalSampler(
+    const Tegra::Texture::TSCEntry& config) noexcept;
+
 // TODO: Remove once Debian STABLE no longer has such outdated boost
 // This is a gcc bug where ADL lookup fails for range niebloids of std::span<T>
 // for any given type of the static_vector/small_vector, etc which makes a whole mess
@@ -16,6 +16,10 @@
 
 #include <boost/container/static_vector.hpp>
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 #include "common/alignment.h"
 #include "common/common_types.h"
 #include <ranges>
@@ -1414,6 +1418,28 @@ static void FillVoidExtentLDR(InputBitStream& strm, std::span<u32> outBuf, u32 b
     }
 }
 
+// Interpolates the 16-bit endpoints of a texel and packs the result, see C.2.19.
+static inline u32 InterpolateTexel(const std::array<u32, 4>& low, const std::array<u32, 4>& high,
+                                   const std::array<u32, 4>& weights) {
+    std::array<u32, 4> values;
+#ifdef __ARM_NEON
+    const uint32x4_t weight = vld1q_u32(weights.data());
+    uint32x4_t color = vmulq_u32(vld1q_u32(low.data()), vsubq_u32(vdupq_n_u32(64), weight));
+    color = vmlaq_u32(color, vld1q_u32(high.data()), weight);
+    color = vshrq_n_u32(vaddq_u32(color, vdupq_n_u32(32)), 6);
+    // Integer form of round(C * 255 / 65536), exact for any 16-bit value
+    color = vshrq_n_u32(vmlaq_u32(vdupq_n_u32(32768), color, vdupq_n_u32(255)), 16);
+    vst1q_u32(values.data(), color);
+#else
+    for (u32 c = 0; c < 4; c++) {
+        const u32 color = (low[c] * (64 - weights[c]) + high[c] * weights[c] + 32) >> 6;
+        values[c] = (color * 255 + 32768) >> 16;
+    }
+#endif
+    // Components are stored as ARGB
+    return (values[0] << 24) | (values[3] << 16) | (values[2] << 8) | values[1];
+}
+
 static void FillError(std::span<u32> outBuf, u32 blockWidth, u32 blockHeight) {
     for (u32 j = 0; j < blockHeight; j++) {
         for (u32 i = 0; i < blockWidth; i++) {
@@ -1620,6 +1646,18 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
     u32 weights[2][144];
     UnquantizeTexelWeights(weights, texelWeightValues, weightParams, blockWidth, blockHeight);
 
+    // Expand the endpoints to 16 bits once per partition instead of once per texel
+    std::array<std::array<u32, 4>, 4> lowEndpoints{};
+    std::array<std::array<u32, 4>, 4> highEndpoints{};
+    for (u32 i = 0; i < nPartitions; i++) {
+        for (u32 c = 0; c < 4; c++) {
+            lowEndpoints[i][c] = ReplicateByteTo16(static_cast<u32>(endpoints[i][0].Component(c)));
+            highEndpoints[i][c] = ReplicateByteTo16(static_cast<u32>(endpoints[i][1].Component(c)));
+        }
+    }
+    // Component reading its weight from the second plane, if there is one
+    const u32 planeComponent = weightParams.m_bDualPlane ? ((planeIdx + 1) & 3) : 4;
+
     // Now that we have endpoints and weights, we can interpolate and generate
     // the proper decoding...
     for (u32 j = 0; j < blockHeight; j++)
@@ -1628,29 +1666,13 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
                                               (blockHeight * blockWidth) < 32);
             assert(partition < nPartitions);
 
-            Pixel p;
+            const u32 texel = j * blockWidth + i;
+            std::array<u32, 4> texelWeights;
             for (u32 c = 0; c < 4; c++) {
-                u32 C0 = endpoints[partition][0].Component(c);
-                C0 = ReplicateByteTo16(C0);
-                u32 C1 = endpoints[partition][1].Component(c);
-                C1 = ReplicateByteTo16(C1);
-
-                u32 plane = 0;
-                if (weightParams.m_bDualPlane && (((planeIdx + 1) & 3) == c)) {
-                    plane = 1;
-                }
-
-                u32 weight = weights[plane][j * blockWidth + i];
-                u32 C = (C0 * (64 - weight) + C1 * weight + 32) / 64;
-                if (C == 65535) {
-                    p.Component(c) = 255;
-                } else {
-                    double Cf = static_cast<double>(C);
-                    p.Component(c) = static_cast<u16>(255.0 * (Cf / 65536.0) + 0.5);
-                }
+                texelWeights[c] = weights[c == planeComponent ? 1 : 0][texel];
             }
-
-            outBuf[j * blockWidth + i] = p.Pack();
+            outBuf[texel] =
+                InterpolateTexel(lowEndpoints[partition], highEndpoints[partition], texelWeights);
         }
 }
 
@@ -1658,39 +1680,52 @@ void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height,
                 uint32_t block_width, uint32_t block_height, std::span<uint8_t> output) {
     const u32 rows = Common::DivideUp(height, block_height);
     const u32 cols = Common::DivideUp(width, block_width);
-
-    Common::ThreadWorker& workers{GetThreadWorkers()};
-
-    for (u32 z = 0; z < depth; ++z) {
-        const u32 depth_offset = z * height * width * 4;
-        for (u32 y_index = 0; y_index < rows; ++y_index) {
-            auto decompress_stride = [data, width, height, block_width, block_height, output, rows,
-                                      cols, z, depth_offset, y_index] {
-                const u32 y = y_index * block_height;
-                for (u32 x_index = 0; x_index < cols; ++x_index) {
-                    const u32 block_index = (z * rows * cols) + (y_index * cols) + x_index;
-                    const u32 x = x_index * block_width;
-
-                    const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
-
-                    // Blocks can be at most 12x12
-                    std::array<u32, 12 * 12> uncompData;
-                    DecompressBlock(blockPtr, block_width, block_height, uncompData);
-
-                    u32 decompWidth = (std::min)(block_width, width - x);
-                    u32 decompHeight = (std::min)(block_height, height - y);
-
-                    const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
-                    for (u32 h = 0; h < decompHeight; ++h) {
-                        std::memcpy(outRow.data() + h * width * 4,
-                                    uncompData.data() + h * block_width, decompWidth * 4);
-                    }
+    const u32 total_rows = rows * depth;
+
+    const auto decompress_rows = [data, width, height, block_width, block_height, output, rows,
+                                  cols](u32 first_row, u32 last_row) {
+        for (u32 row = first_row; row < last_row; ++row) {
+            const u32 z = row / rows;
+            const u32 y_index = row % rows;
+            const u32 depth_offset = z * height * width * 4;
+            const u32 y = y_index * block_height;
+            for (u32 x_index = 0; x_index < cols; ++x_index) {
+                const u32 block_index = (row * cols) + x_index;
+                const u32 x = x_index * block_width;
+
+                const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
+
+                // Blocks can be at most 12x12
+                std::array<u32, 12 * 12> uncompData;
+                DecompressBlock(blockPtr, block_width, block_height, uncompData);
+
+                u32 decompWidth = (std::min)(block_width, width - x);
+                u32 decompHeight = (std::min)(block_height, height - y);
+
+                const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
+                for (u32 h = 0; h < decompHeight; ++h) {
+                    std::memcpy(outRow.data() + h * width * 4,
+                                uncompData.data() + h * block_width, decompWidth * 4);
                 }
-            };
-            workers.QueueWork(std::move(decompress_stride));
+            }
         }
-        workers.WaitForRequests();
+    };
+
+    // Split the image in tasks of a few hundred blocks, rows of every slice share the same pool
+    // of tasks. Images that fit in a single task are decoded on the calling thread.
+    static constexpr u32 MIN_BLOCKS_PER_TASK = 512;
+    const u32 rows_per_task = Common::DivideUp(MIN_BLOCKS_PER_TASK, cols);
+    if (total_rows <= rows_per_task) {
+        decompress_rows(0, total_rows);
+        return;
+    }
+    Common::PooledWorker& workers{GetThreadWorkers()};
+    for (u32 row = 0; row < total_rows; row += rows_per_task) {
+        workers.QueueWork([&decompress_rows, row, rows_per_task, total_rows] {
+            decompress_rows(row, (std::min)(row + rows_per_task, total_rows));
+        }, Common::WorkPriority::High);
     }
+    workers.WaitForRequests();
 }
 
 } // namespace Tegra::Texture::ASTC
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -18,7 +21,7 @@ void CompressBCN(std::span<const uint8_t> data, uint32_t width, uint32_t height,
     constexpr u32 bytes_per_px = 4;
     const u32 plane_dim = width * height;
 
-    Common::ThreadWorker& workers{GetThreadWorkers()};
+    Common::PooledWorker& workers{GetThreadWorkers()};
 
     for (u32 z = 0; z < depth; z++) {
         for (u32 y = 0; y < height; y += 4) {
@@ -60,7 +63,7 @@ void CompressBCN(std::span<const uint8_t> data, uint32_t width, uint32_t height,
                       reinterpret_cast<u8*>(input_colors), any_alpha);
                 }
             };
-            workers.QueueWork(std::move(compress_row));
+            workers.QueueWork(std::move(compress_row), Common::WorkPriority::High);
         }
         workers.WaitForRequests();
     }
@@ -16,6 +16,13 @@
 #include "video_core/gpu.h"
 #include "video_core/textures/decoders.h"
 
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace Tegra::Texture {
 namespace {
 template <u32 mask>
@@ -154,9 +161,153 @@ void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 wid
     }
 }
 
+/// Rows of a GOB are made of 16 byte sectors, each of them stored contiguously.
+constexpr u32 SECTOR_SIZE = 16;
+constexpr u32 SECTORS_PER_GOB_ROW = GOB_SIZE_X / SECTOR_SIZE;
+
+/// Offsets of each sector within a GOB, indexed by row and sector.
+constexpr auto SECTOR_OFFSETS = [] {
+    std::array<std::array<u32, SECTORS_PER_GOB_ROW>, GOB_SIZE_Y> offsets{};
+    for (u32 row = 0; row < GOB_SIZE_Y; ++row) {
+        for (u32 sector = 0; sector < SECTORS_PER_GOB_ROW; ++sector) {
+            offsets[row][sector] =
+                pdep<SWIZZLE_X_BITS>(sector * SECTOR_SIZE) | pdep<SWIZZLE_Y_BITS>(row);
+        }
+    }
+    return offsets;
+}();
+
+#if defined(ARCHITECTURE_x86_64) && (defined(__GNUC__) || defined(__clang__))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+inline void CopySector(u8* dst, const u8* src) {
+#if defined(ARCHITECTURE_x86_64)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+#elif defined(__ARM_NEON)
+    vst1q_u8(dst, vld1q_u8(src));
+#else
+    std::memcpy(dst, src, SECTOR_SIZE);
+#endif
+}
+
+template <bool TO_LINEAR>
+void CopyPartialGob(u8* dst, const u8* src, u32 pitch, u32 num_rows, u32 num_sectors) {
+    for (u32 row = 0; row < num_rows; ++row) {
+        for (u32 sector = 0; sector < num_sectors; ++sector) {
+            const u32 swizzled = SECTOR_OFFSETS[row][sector];
+            const u32 linear = row * pitch + sector * SECTOR_SIZE;
+            if constexpr (TO_LINEAR) {
+                CopySector(dst + swizzled, src + linear);
+            } else {
+                CopySector(dst + linear, src + swizzled);
+            }
+        }
+    }
+}
+
+template <bool TO_LINEAR>
+void CopyGob(u8* dst, const u8* src, u32 pitch) {
+    CopyPartialGob<TO_LINEAR>(dst, src, pitch, GOB_SIZE_Y, SECTORS_PER_GOB_ROW);
+}
+
+#ifdef ARCHITECTURE_x86_64
+template <bool TO_LINEAR>
+AVX2_TARGET void CopyGobAVX2(u8* dst, const u8* src, u32 pitch) {
+    // Every 32 bytes of a GOB hold the same sector of two consecutive rows.
+    for (u32 row = 0; row < GOB_SIZE_Y; row += 2) {
+        for (u32 sector = 0; sector < SECTORS_PER_GOB_ROW; ++sector) {
+            const u32 swizzled = SECTOR_OFFSETS[row][sector];
+            const u32 linear = row * pitch + sector * SECTOR_SIZE;
+            if constexpr (TO_LINEAR) {
+                const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + linear));
+                const __m128i high =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + linear + pitch));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(dst + swizzled),
+                    _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1));
+            } else {
+                const __m256i value =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + swizzled));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + linear),
+                                 _mm256_castsi256_si128(value));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + linear + pitch),
+                                 _mm256_extracti128_si256(value, 1));
+            }
+        }
+    }
+}
+#endif
+
+using CopyGobFunction = void (*)(u8* dst, const u8* src, u32 pitch);
+
+template <bool TO_LINEAR>
+CopyGobFunction SelectCopyGob() {
+#ifdef ARCHITECTURE_x86_64
+    if (Common::GetCPUCaps().avx2) {
+        return &CopyGobAVX2<TO_LINEAR>;
+    }
+#endif
+    return &CopyGob<TO_LINEAR>;
+}
+
+/// Same as SwizzleImpl for textures made of whole sectors, copying a GOB at a time.
+template <bool TO_LINEAR>
+void SwizzleSectorsImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height,
+                        u32 depth, u32 block_height, u32 block_depth, u32 stride) {
+    static const CopyGobFunction copy_gob = SelectCopyGob<TO_LINEAR>();
+
+    const u32 pitch = width * SECTOR_SIZE;
+
+    const u32 gobs_in_x = Common::DivCeilLog2(stride, GOB_SIZE_X_SHIFT);
+    const u32 block_size = gobs_in_x << (GOB_SIZE_SHIFT + block_height + block_depth);
+    const u32 slice_size =
+        Common::DivCeilLog2(height, block_height + GOB_SIZE_Y_SHIFT) * block_size;
+
+    const u32 block_height_mask = (1U << block_height) - 1;
+    const u32 block_depth_mask = (1U << block_depth) - 1;
+    const u32 x_shift = GOB_SIZE_SHIFT + block_height + block_depth;
+
+    const u32 width_in_gobs = Common::DivCeil(width, SECTORS_PER_GOB_ROW);
+    const u32 height_in_gobs = Common::DivCeilLog2(height, GOB_SIZE_Y_SHIFT);
+
+    for (u32 slice = 0; slice < depth; ++slice) {
+        const u32 offset_z = (slice >> block_depth) * slice_size +
+                             ((slice & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
+        for (u32 gob_y = 0; gob_y < height_in_gobs; ++gob_y) {
+            const u32 offset_y = (gob_y >> block_height) * block_size +
+                                 ((gob_y & block_height_mask) << GOB_SIZE_SHIFT);
+            const u32 num_rows = (std::min)(GOB_SIZE_Y, height - gob_y * GOB_SIZE_Y);
+            for (u32 gob_x = 0; gob_x < width_in_gobs; ++gob_x) {
+                const u32 swizzled_offset = offset_z + offset_y + (gob_x << x_shift);
+                const u32 unswizzled_offset =
+                    slice * pitch * height + gob_y * GOB_SIZE_Y * pitch + gob_x * GOB_SIZE_X;
+                const u32 num_sectors =
+                    (std::min)(SECTORS_PER_GOB_ROW, width - gob_x * SECTORS_PER_GOB_ROW);
+
+                u8* const dst = output.data() + (TO_LINEAR ? swizzled_offset : unswizzled_offset);
+                const u8* const src =
+                    input.data() + (TO_LINEAR ? unswizzled_offset : swizzled_offset);
+                if (num_rows == GOB_SIZE_Y && num_sectors == SECTORS_PER_GOB_ROW) {
+                    copy_gob(dst, src, pitch);
+                } else {
+                    CopyPartialGob<TO_LINEAR>(dst, src, pitch, num_rows, num_sectors);
+                }
+            }
+        }
+    }
+}
+
 template <bool TO_LINEAR>
 void Swizzle(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel, u32 width,
              u32 height, u32 depth, u32 block_height, u32 block_depth, u32 stride_alignment) {
+    if (bytes_per_pixel == SECTOR_SIZE) {
+        return SwizzleSectorsImpl<TO_LINEAR>(output, input, width, height, depth, block_height,
+                                             block_depth, stride_alignment);
+    }
     switch (bytes_per_pixel) {
 #define BPP_CASE(x)                                                                                \
     case x:                                                                                        \
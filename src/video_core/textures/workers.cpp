@@ -4,13 +4,17 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/settings.h"
 #include "video_core/textures/workers.h"
 
 namespace Tegra::Texture {
 
-Common::ThreadWorker& GetThreadWorkers() {
-    static Common::ThreadWorker workers{(std::max)(std::thread::hardware_concurrency(), 2U) / 2,
-                                        "ImageTranscode"};
+Common::PooledWorker& GetThreadWorkers() {
+    static Common::PooledWorker workers{
+        Common::ThreadPool::Shared(Settings::values.core_type_affinity.GetValue()
+                                       ? Common::CoreType::Efficiency
+                                       : Common::CoreType::Any),
+        (std::max)(std::thread::hardware_concurrency(), 2U) / 2};
 
     return workers;
 }
@@ -1,12 +1,15 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
-#include "common/thread_worker.h"
+#include "common/thread_pool.h"
 
 namespace Tegra::Texture {
 
-Common::ThreadWorker& GetThreadWorkers();
+Common::PooledWorker& GetThreadWorkers();
 
 }
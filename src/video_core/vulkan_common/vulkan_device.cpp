@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <chrono>
 #include <optional>
@@ -315,6 +316,31 @@ void OverrideBcnFormats(std::unordered_map<VkFormat, VkFormatProperties>& format
 }
 #endif
 
+std::unordered_set<VkFormat> GetHostImageCopyFormats(
+    vk::PhysicalDevice physical,
+    const std::unordered_map<VkFormat, VkFormatProperties>& format_properties) {
+    std::unordered_set<VkFormat> formats;
+    for (const auto& [format, _] : format_properties) {
+        VkFormatProperties3 properties3{
+            .sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3,
+            .pNext = nullptr,
+            .linearTilingFeatures{},
+            .optimalTilingFeatures{},
+            .bufferFeatures{},
+        };
+        VkFormatProperties2 properties2{
+            .sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2,
+            .pNext = &properties3,
+            .formatProperties{},
+        };
+        physical.GetFormatProperties2(format, properties2);
+        if (properties3.optimalTilingFeatures & VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT_EXT) {
+            formats.insert(format);
+        }
+    }
+    return formats;
+}
+
 NvidiaArchitecture GetNvidiaArchitecture(vk::PhysicalDevice physical,
                                         const std::set<std::string, std::less<>>& exts) {
     VkPhysicalDeviceProperties2 physical_properties{};
@@ -477,6 +503,9 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
     is_blit_depth24_stencil8_supported = TestDepthStencilBlits(VK_FORMAT_D24_UNORM_S8_UINT);
     is_blit_depth32_stencil8_supported = TestDepthStencilBlits(VK_FORMAT_D32_SFLOAT_S8_UINT);
     is_optimal_astc_supported = ComputeIsOptimalAstcSupported();
+    if (extensions.host_image_copy) {
+        host_image_copy_formats = GetHostImageCopyFormats(physical, format_properties);
+    }
     is_warp_potentially_bigger = !extensions.subgroup_size_control ||
                                  properties.subgroup_size_control.maxSubgroupSize > GuestWarpSize;
 
@@ -678,6 +707,15 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
 
     graphics_queue = logical.GetQueue(graphics_family);
     present_queue = logical.GetQueue(present_family);
+    if (has_async_compute) {
+        compute_queue = logical.GetQueue(compute_family, compute_queue_index);
+        LOG_INFO(Render_Vulkan, "Async compute queue {} of family {}", compute_queue_index,
+                 compute_family);
+    }
+    if (has_transfer_queue) {
+        transfer_queue = logical.GetQueue(transfer_family);
+        LOG_INFO(Render_Vulkan, "Transfer queue of family {}", transfer_family);
+    }
 
     VmaVulkanFunctions functions{};
     functions.vkGetInstanceProcAddr = dld.vkGetInstanceProcAddr;
@@ -687,6 +725,9 @@ Device::Device(VkInstance instance_, vk::PhysicalDevice physical_, VkSurfaceKHR
     if (extensions.memory_budget) {
         flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
     }
+    if (extensions.descriptor_buffer) {
+        flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+    }
     const VmaAllocatorCreateInfo allocator_info{
             .flags = flags,
             .physicalDevice = physical,
@@ -811,6 +852,34 @@ bool Device::IsFormatSupported(VkFormat wanted_format, VkFormatFeatureFlags want
     return (supported_usage & wanted_usage) == wanted_usage;
 }
 
+bool Device::IsHostImageCopyOptimal(const VkImageCreateInfo& image_ci) const {
+    VkHostImageCopyDevicePerformanceQueryEXT performance{
+        .sType = VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY_EXT,
+        .pNext = nullptr,
+        .optimalDeviceAccess = VK_FALSE,
+        .identicalMemoryLayout = VK_FALSE,
+    };
+    VkImageFormatProperties2 image_format_properties{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2,
+        .pNext = &performance,
+        .imageFormatProperties{},
+    };
+    const VkPhysicalDeviceImageFormatInfo2 image_format_info{
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2,
+        .pNext = nullptr,
+        .format = image_ci.format,
+        .type = image_ci.imageType,
+        .tiling = image_ci.tiling,
+        .usage = image_ci.usage,
+        .flags = image_ci.flags,
+    };
+    if (physical.GetImageFormatProperties2(image_format_info, image_format_properties) !=
+        VK_SUCCESS) {
+        return false;
+    }
+    return performance.optimalDeviceAccess != VK_FALSE;
+}
+
 std::string Device::GetDriverName() const {
     switch (properties.driver.driverID) {
     case VK_DRIVER_ID_AMD_PROPRIETARY:
@@ -1083,6 +1152,21 @@ bool Device::GetSuitability(bool requires_swapchain) {
             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT;
         SetNext(next, properties.transform_feedback);
     }
+    if (extensions.descriptor_buffer) {
+        properties.descriptor_buffer.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        SetNext(next, properties.descriptor_buffer);
+    }
+    if (extensions.graphics_pipeline_library) {
+        properties.graphics_pipeline_library.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        SetNext(next, properties.graphics_pipeline_library);
+    }
+    if (extensions.fragment_shading_rate) {
+        properties.fragment_shading_rate.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR;
+        SetNext(next, properties.fragment_shading_rate);
+    }
 
     // Perform the property fetch.
     physical.GetProperties2(properties2);
@@ -1138,6 +1222,19 @@ void Device::RemoveUnsuitableExtensions() {
     RemoveExtensionFeatureIfUnsuitable(extensions.depth_clip_control, features.depth_clip_control,
                                        VK_EXT_DEPTH_CLIP_CONTROL_EXTENSION_NAME);
 
+    // VK_EXT_descriptor_buffer
+    // Buffer descriptors are written from device addresses, which are only enabled for it.
+    extensions.descriptor_buffer = Settings::values.descriptor_buffer.GetValue() &&
+                                   features.descriptor_buffer.descriptorBuffer &&
+                                   features.buffer_device_address.bufferDeviceAddress;
+    RemoveExtensionFeatureIfUnsuitable(extensions.descriptor_buffer, features.descriptor_buffer,
+                                       VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+    features.descriptor_buffer.descriptorBufferCaptureReplay = false;
+    features.descriptor_buffer.descriptorBufferPushDescriptors = false;
+    features.buffer_device_address.bufferDeviceAddress = extensions.descriptor_buffer;
+    features.buffer_device_address.bufferDeviceAddressCaptureReplay = false;
+    features.buffer_device_address.bufferDeviceAddressMultiDevice = false;
+
     /* */ // VK_EXT_extended_dynamic_state
     extensions.extended_dynamic_state = features.extended_dynamic_state.extendedDynamicState;
     RemoveExtensionFeatureIfUnsuitable(extensions.extended_dynamic_state,
@@ -1158,14 +1255,77 @@ void Device::RemoveUnsuitableExtensions() {
     dynamic_state3_enables =
         features.extended_dynamic_state3.extendedDynamicState3DepthClampEnable &&
         features.extended_dynamic_state3.extendedDynamicState3LogicOpEnable;
+    dynamic_state3_rasterization =
+        features.extended_dynamic_state3.extendedDynamicState3PolygonMode &&
+        features.extended_dynamic_state3.extendedDynamicState3AlphaToCoverageEnable;
 
-    extensions.extended_dynamic_state3 = dynamic_state3_blending || dynamic_state3_enables;
+    extensions.extended_dynamic_state3 =
+        dynamic_state3_blending || dynamic_state3_enables || dynamic_state3_rasterization;
     dynamic_state3_blending = dynamic_state3_blending && extensions.extended_dynamic_state3;
     dynamic_state3_enables = dynamic_state3_enables && extensions.extended_dynamic_state3;
+    dynamic_state3_rasterization =
+        dynamic_state3_rasterization && extensions.extended_dynamic_state3;
     RemoveExtensionFeatureIfUnsuitable(extensions.extended_dynamic_state3,
                                        features.extended_dynamic_state3,
                                        VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
 
+    // VK_KHR_dynamic_rendering
+    if (Settings::values.dynamic_rendering.GetValue()) {
+        extensions.dynamic_rendering = features.dynamic_rendering.dynamicRendering;
+        RemoveExtensionFeatureIfUnsuitable(extensions.dynamic_rendering,
+                                           features.dynamic_rendering,
+                                           VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.dynamic_rendering, features.dynamic_rendering,
+                               VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+    }
+
+    // VK_KHR_fragment_shading_rate
+    // The attachment is only bound to dynamic rendering instances, render pass objects would
+    // have to be created with vkCreateRenderPass2.
+    if (Settings::values.foveated_shading.GetValue()) {
+        extensions.fragment_shading_rate =
+            extensions.dynamic_rendering &&
+            features.fragment_shading_rate.attachmentFragmentShadingRate &&
+            properties.fragment_shading_rate.maxFragmentShadingRateAttachmentTexelSize.width > 0;
+        features.fragment_shading_rate.primitiveFragmentShadingRate = VK_FALSE;
+        RemoveExtensionFeatureIfUnsuitable(extensions.fragment_shading_rate,
+                                           features.fragment_shading_rate,
+                                           VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.fragment_shading_rate, features.fragment_shading_rate,
+                               VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
+    }
+
+    // VK_EXT_graphics_pipeline_library
+    // Without fast linking a linked pipeline costs as much as a monolithic one, skip it.
+    if (Settings::values.graphics_pipeline_library.GetValue()) {
+        extensions.graphics_pipeline_library =
+            extensions.pipeline_library &&
+            features.graphics_pipeline_library.graphicsPipelineLibrary &&
+            properties.graphics_pipeline_library.graphicsPipelineLibraryFastLinking;
+        RemoveExtensionFeatureIfUnsuitable(extensions.graphics_pipeline_library,
+                                           features.graphics_pipeline_library,
+                                           VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.graphics_pipeline_library,
+                               features.graphics_pipeline_library,
+                               VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    }
+
+    // VK_EXT_host_image_copy
+    // Copies from the host only save bandwidth when images live in memory shared with the CPU.
+    if (Settings::values.host_image_copy.GetValue()) {
+        extensions.host_image_copy =
+            features.host_image_copy.hostImageCopy &&
+            properties.properties.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU;
+        RemoveExtensionFeatureIfUnsuitable(extensions.host_image_copy, features.host_image_copy,
+                                           VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME);
+    } else {
+        RemoveExtensionFeature(extensions.host_image_copy, features.host_image_copy,
+                               VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME);
+    }
+
     // VK_EXT_provoking_vertex
     if (Settings::values.provoking_vertex.GetValue()) {
         extensions.provoking_vertex = features.provoking_vertex.provokingVertexLast
@@ -1233,6 +1393,16 @@ void Device::RemoveUnsuitableExtensions() {
                                VK_KHR_PIPELINE_EXECUTABLE_PROPERTIES_EXTENSION_NAME);
     }
 
+    // VK_KHR_present_wait
+    // Waits are made on the ids attached to each present, both extensions are needed together.
+    extensions.present_wait = Settings::values.present_wait.GetValue() &&
+                              features.present_id.presentId && features.present_wait.presentWait;
+    extensions.present_id = extensions.present_wait;
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_id, features.present_id,
+                                       VK_KHR_PRESENT_ID_EXTENSION_NAME);
+    RemoveExtensionFeatureIfUnsuitable(extensions.present_wait, features.present_wait,
+                                       VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
     // VK_KHR_workgroup_memory_explicit_layout
     extensions.workgroup_memory_explicit_layout =
         features.features.shaderInt16 &&
@@ -1274,10 +1444,61 @@ void Device::SetupFamilies(VkSurfaceKHR surface) {
     }
     if (graphics) {
         graphics_family = *graphics;
+        has_sparse_queue = (queue_family_properties[graphics_family].queueFlags &
+                            VK_QUEUE_SPARSE_BINDING_BIT) != 0;
     }
     if (present) {
         present_family = *present;
     }
+    if (!HasTimelineSemaphore()) {
+        // Work on other queues is synchronized with timeline semaphores
+        return;
+    }
+    if (Settings::values.async_compute_queue.GetValue()) {
+        SetupComputeFamily(queue_family_properties);
+    }
+    if (Settings::values.async_transfer_queue.GetValue()) {
+        SetupTransferFamily(queue_family_properties);
+    }
+}
+
+void Device::SetupComputeFamily(std::span<const VkQueueFamilyProperties> queue_family_properties) {
+    for (u32 index = 0; index < static_cast<u32>(queue_family_properties.size()); ++index) {
+        const VkQueueFamilyProperties& queue_family = queue_family_properties[index];
+        if (queue_family.queueCount != 0 && (queue_family.queueFlags & VK_QUEUE_COMPUTE_BIT) &&
+            !(queue_family.queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
+            // Dedicated compute families are the ones executing alongside graphics on hardware
+            compute_family = index;
+            compute_queue_index = 0;
+            has_async_compute = true;
+            return;
+        }
+    }
+    if (queue_family_properties[graphics_family].queueCount > 1) {
+        compute_family = graphics_family;
+        compute_queue_index = 1;
+        has_async_compute = true;
+    }
+}
+
+void Device::SetupTransferFamily(std::span<const VkQueueFamilyProperties> queue_family_properties) {
+    static constexpr VkQueueFlags ENGINE_FLAGS = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+    for (u32 index = 0; index < static_cast<u32>(queue_family_properties.size()); ++index) {
+        const VkQueueFamilyProperties& queue_family = queue_family_properties[index];
+        if (queue_family.queueCount == 0 || !(queue_family.queueFlags & VK_QUEUE_TRANSFER_BIT) ||
+            (queue_family.queueFlags & ENGINE_FLAGS) != 0) {
+            continue;
+        }
+        // Only families backed by a copy engine are worth it, and they have to be able to copy
+        // any texel of an image
+        const VkExtent3D& granularity = queue_family.minImageTransferGranularity;
+        if (granularity.width != 1 || granularity.height != 1 || granularity.depth != 1) {
+            continue;
+        }
+        transfer_family = index;
+        has_transfer_queue = true;
+        return;
+    }
 }
 
 u64 Device::GetDeviceMemoryUsage() const {
@@ -1292,6 +1513,21 @@ u64 Device::GetDeviceMemoryUsage() const {
     return result;
 }
 
+u64 Device::GetDeviceMemoryBudget() const {
+    if (!extensions.memory_budget) {
+        return 0;
+    }
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget;
+    budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    budget.pNext = nullptr;
+    physical.GetMemoryProperties(&budget);
+    u64 result{};
+    for (const size_t heap : valid_heap_memory) {
+        result += budget.heapBudget[heap];
+    }
+    return result;
+}
+
 void Device::CollectPhysicalMemoryInfo() {
     // Calculate limits using memory budget
     VkPhysicalDeviceMemoryBudgetPropertiesEXT budget{};
@@ -1351,22 +1587,29 @@ void Device::CollectToolingInfo() {
 }
 
 std::vector<VkDeviceQueueCreateInfo> Device::GetDeviceQueueCreateInfos() const {
-    static constexpr float QUEUE_PRIORITY = 1.0f;
+    static constexpr std::array QUEUE_PRIORITIES{1.0f, 1.0f};
 
     std::unordered_set<u32> unique_queue_families{graphics_family, present_family};
+    if (has_async_compute) {
+        unique_queue_families.insert(compute_family);
+    }
+    if (has_transfer_queue) {
+        unique_queue_families.insert(transfer_family);
+    }
     std::vector<VkDeviceQueueCreateInfo> queue_cis;
     queue_cis.reserve(unique_queue_families.size());
 
     for (const u32 queue_family : unique_queue_families) {
+        const bool has_compute_queue = has_async_compute && queue_family == compute_family;
         auto& ci = queue_cis.emplace_back(VkDeviceQueueCreateInfo{
             .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
             .pNext = nullptr,
             .flags = 0,
             .queueFamilyIndex = queue_family,
-            .queueCount = 1,
+            .queueCount = has_compute_queue ? compute_queue_index + 1 : 1,
             .pQueuePriorities = nullptr,
         });
-        ci.pQueuePriorities = &QUEUE_PRIORITY;
+        ci.pQueuePriorities = QUEUE_PRIORITIES.data();
     }
 
     return queue_cis;
@@ -10,6 +10,7 @@
 #include <span>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "common/common_types.h"
@@ -32,11 +33,13 @@ VK_DEFINE_HANDLE(VmaAllocator)
     FEATURE(KHR, VariablePointer, VARIABLE_POINTERS, variable_pointer)
 
 #define FOR_EACH_VK_FEATURE_1_2(FEATURE)                                                           \
+    FEATURE(KHR, BufferDeviceAddress, BUFFER_DEVICE_ADDRESS, buffer_device_address)                \
     FEATURE(EXT, HostQueryReset, HOST_QUERY_RESET, host_query_reset)                               \
     FEATURE(KHR, 8BitStorage, 8BIT_STORAGE, bit8_storage)                                          \
     FEATURE(KHR, TimelineSemaphore, TIMELINE_SEMAPHORE, timeline_semaphore)
 
 #define FOR_EACH_VK_FEATURE_1_3(FEATURE)                                                           \
+    FEATURE(KHR, DynamicRendering, DYNAMIC_RENDERING, dynamic_rendering)                           \
     FEATURE(EXT, ShaderDemoteToHelperInvocation, SHADER_DEMOTE_TO_HELPER_INVOCATION,               \
             shader_demote_to_helper_invocation)                                                    \
     FEATURE(EXT, SubgroupSizeControl, SUBGROUP_SIZE_CONTROL, subgroup_size_control)
@@ -46,9 +49,12 @@ VK_DEFINE_HANDLE(VmaAllocator)
     FEATURE(EXT, CustomBorderColor, CUSTOM_BORDER_COLOR, custom_border_color)                      \
     FEATURE(EXT, DepthBiasControl, DEPTH_BIAS_CONTROL, depth_bias_control)                         \
     FEATURE(EXT, DepthClipControl, DEPTH_CLIP_CONTROL, depth_clip_control)                         \
+    FEATURE(EXT, DescriptorBuffer, DESCRIPTOR_BUFFER, descriptor_buffer)                           \
     FEATURE(EXT, ExtendedDynamicState, EXTENDED_DYNAMIC_STATE, extended_dynamic_state)             \
     FEATURE(EXT, ExtendedDynamicState2, EXTENDED_DYNAMIC_STATE_2, extended_dynamic_state2)         \
     FEATURE(EXT, ExtendedDynamicState3, EXTENDED_DYNAMIC_STATE_3, extended_dynamic_state3)         \
+    FEATURE(EXT, GraphicsPipelineLibrary, GRAPHICS_PIPELINE_LIBRARY, graphics_pipeline_library)    \
+    FEATURE(EXT, HostImageCopy, HOST_IMAGE_COPY, host_image_copy)                                  \
     FEATURE(EXT, 4444Formats, 4444_FORMATS, format_a4b4g4r4)                                       \
     FEATURE(EXT, IndexTypeUint8, INDEX_TYPE_UINT8, index_type_uint8)                               \
     FEATURE(EXT, LineRasterization, LINE_RASTERIZATION, line_rasterization)                        \
@@ -58,8 +64,11 @@ VK_DEFINE_HANDLE(VmaAllocator)
     FEATURE(EXT, Robustness2, ROBUSTNESS_2, robustness2)                                           \
     FEATURE(EXT, TransformFeedback, TRANSFORM_FEEDBACK, transform_feedback)                        \
     FEATURE(EXT, VertexInputDynamicState, VERTEX_INPUT_DYNAMIC_STATE, vertex_input_dynamic_state)  \
+    FEATURE(KHR, FragmentShadingRate, FRAGMENT_SHADING_RATE, fragment_shading_rate)                \
     FEATURE(KHR, PipelineExecutableProperties, PIPELINE_EXECUTABLE_PROPERTIES,                     \
             pipeline_executable_properties)                                                        \
+    FEATURE(KHR, PresentId, PRESENT_ID, present_id)                                                \
+    FEATURE(KHR, PresentWait, PRESENT_WAIT, present_wait)                                          \
     FEATURE(KHR, WorkgroupMemoryExplicitLayout, WORKGROUP_MEMORY_EXPLICIT_LAYOUT,                  \
             workgroup_memory_explicit_layout)
 
@@ -77,6 +86,7 @@ VK_DEFINE_HANDLE(VmaAllocator)
     EXTENSION(EXT, VERTEX_ATTRIBUTE_DIVISOR, vertex_attribute_divisor)                             \
     EXTENSION(KHR, DRAW_INDIRECT_COUNT, draw_indirect_count)                                       \
     EXTENSION(KHR, DRIVER_PROPERTIES, driver_properties)                                           \
+    EXTENSION(KHR, PIPELINE_LIBRARY, pipeline_library)                                             \
     EXTENSION(KHR, PUSH_DESCRIPTOR, push_descriptor)                                               \
     EXTENSION(KHR, SAMPLER_MIRROR_CLAMP_TO_EDGE, sampler_mirror_clamp_to_edge)                     \
     EXTENSION(KHR, SHADER_FLOAT_CONTROLS, shader_float_controls)                                   \
@@ -105,10 +115,13 @@ VK_DEFINE_HANDLE(VmaAllocator)
     EXTENSION_NAME(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME)                               \
     EXTENSION_NAME(VK_EXT_DEPTH_BIAS_CONTROL_EXTENSION_NAME)                                       \
     EXTENSION_NAME(VK_EXT_DEPTH_RANGE_UNRESTRICTED_EXTENSION_NAME)                                 \
+    EXTENSION_NAME(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME)                                        \
     EXTENSION_NAME(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)                                   \
     EXTENSION_NAME(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)                                 \
     EXTENSION_NAME(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME)                                 \
     EXTENSION_NAME(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME)                                     \
+    EXTENSION_NAME(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME)                                \
+    EXTENSION_NAME(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME)                                          \
     EXTENSION_NAME(VK_EXT_4444_FORMATS_EXTENSION_NAME)                                             \
     EXTENSION_NAME(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME)                                       \
     EXTENSION_NAME(VK_EXT_ROBUSTNESS_2_EXTENSION_NAME)                                             \
@@ -263,6 +276,36 @@ public:
         return present_family;
     }
 
+    /// Returns true when compute work can be submitted to a queue other than the graphics one.
+    bool HasAsyncComputeQueue() const {
+        return has_async_compute;
+    }
+
+    /// Returns the async compute queue, only valid when HasAsyncComputeQueue() is true.
+    vk::Queue GetComputeQueue() const {
+        return compute_queue;
+    }
+
+    /// Returns the async compute queue family index, it may be the graphics family.
+    u32 GetComputeFamily() const {
+        return compute_family;
+    }
+
+    /// Returns true when uploads can be submitted to a dedicated transfer queue.
+    bool HasTransferQueue() const {
+        return has_transfer_queue;
+    }
+
+    /// Returns the dedicated transfer queue, only valid when HasTransferQueue() is true.
+    vk::Queue GetTransferQueue() const {
+        return transfer_queue;
+    }
+
+    /// Returns the dedicated transfer queue family index.
+    u32 GetTransferFamily() const {
+        return transfer_family;
+    }
+
     /// Returns the current Vulkan API version provided in Vulkan-formatted version numbers.
     u32 ApiVersion() const {
         return properties.properties.apiVersion;
@@ -283,6 +326,21 @@ public:
         return properties.driver.driverID;
     }
 
+    /// Returns the vendor ID of the physical device.
+    u32 GetVendorID() const {
+        return properties.properties.vendorID;
+    }
+
+    /// Returns the device ID of the physical device.
+    u32 GetDeviceID() const {
+        return properties.properties.deviceID;
+    }
+
+    /// Returns the UUID that identifies which pipeline caches are compatible with the driver.
+    std::span<const u8, VK_UUID_SIZE> GetPipelineCacheUUID() const {
+        return properties.properties.pipelineCacheUUID;
+    }
+
     bool ShouldBoostClocks() const;
 
     /// Returns uniform buffer alignment requirement.
@@ -310,6 +368,16 @@ public:
         return properties.properties.limits.maxComputeSharedMemorySize;
     }
 
+    /// Returns true when timestamps can be written on the graphics and compute queues.
+    bool SupportsTimestamps() const {
+        return properties.properties.limits.timestampComputeAndGraphics != VK_FALSE;
+    }
+
+    /// Returns the number of nanoseconds it takes for a timestamp to be incremented by one.
+    float GetTimestampPeriod() const {
+        return properties.properties.limits.timestampPeriod;
+    }
+
     /// Returns float control properties of the device.
     const VkPhysicalDeviceFloatControlsPropertiesKHR& FloatControlProperties() const {
         return properties.float_controls;
@@ -390,6 +458,12 @@ public:
         return features.features.depthBounds;
     }
 
+    /// Returns true when 2D images can be backed by memory bound to the graphics queue on demand.
+    bool IsSparseResidencyImage2DSupported() const {
+        return features.features.sparseBinding && features.features.sparseResidencyImage2D &&
+               has_sparse_queue;
+    }
+
     /// Returns true when blitting from and to D24S8 images is supported.
     bool IsBlitDepth24Stencil8Supported() const {
         return is_blit_depth24_stencil8_supported;
@@ -430,11 +504,21 @@ public:
         return extensions.push_descriptor;
     }
 
+    /// Returns true if the device supports VK_KHR_draw_indirect_count.
+    bool IsKhrDrawIndirectCountSupported() const {
+        return extensions.draw_indirect_count;
+    }
+
     /// Returns true if VK_KHR_pipeline_executable_properties is enabled.
     bool IsKhrPipelineExecutablePropertiesEnabled() const {
         return extensions.pipeline_executable_properties;
     }
 
+    /// Returns true if VK_KHR_present_id and VK_KHR_present_wait are enabled.
+    bool IsKhrPresentWaitSupported() const {
+        return extensions.present_wait;
+    }
+
     /// Returns true if VK_KHR_swapchain_mutable_format is enabled.
     bool IsKhrSwapchainMutableFormatEnabled() const {
         return extensions.swapchain_mutable_format;
@@ -534,6 +618,11 @@ public:
         return features.extended_dynamic_state2.extendedDynamicState2LogicOp;
     }
 
+    /// Returns true if the device is an integrated GPU, sharing its memory with the host.
+    bool IsIntegrated() const {
+        return is_integrated;
+    }
+
     /// Returns true if the device supports VK_EXT_extended_dynamic_state3.
     bool IsExtExtendedDynamicState3Supported() const {
         return extensions.extended_dynamic_state3;
@@ -554,6 +643,12 @@ public:
         return dynamic_state3_enables;
     }
 
+    /// Returns true if the device supports the polygon mode and alpha to coverage dynamic states
+    /// of VK_EXT_extended_dynamic_state3.
+    bool IsExtExtendedDynamicState3RasterizationSupported() const {
+        return dynamic_state3_rasterization;
+    }
+
     /// Returns true if the device supports VK_EXT_filter_cubic
     bool IsExtFilterCubicSupported() const {
         return extensions.filter_cubic;
@@ -574,6 +669,50 @@ public:
         return extensions.vertex_input_dynamic_state;
     }
 
+    /// Returns true if the device supports VK_EXT_descriptor_buffer.
+    bool IsExtDescriptorBufferSupported() const {
+        return extensions.descriptor_buffer;
+    }
+
+    /// Returns the sizes and alignments of descriptors stored in descriptor buffers.
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& DescriptorBufferProperties() const {
+        return properties.descriptor_buffer;
+    }
+
+    /// Returns true if render passes are begun with VK_KHR_dynamic_rendering.
+    bool IsKhrDynamicRenderingSupported() const {
+        return extensions.dynamic_rendering;
+    }
+
+    /// Returns true if upscaled render targets are shaded with a VK_KHR_fragment_shading_rate
+    /// attachment.
+    bool IsKhrFragmentShadingRateSupported() const {
+        return extensions.fragment_shading_rate;
+    }
+
+    /// Returns the attachment texel size limits of VK_KHR_fragment_shading_rate.
+    const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& FragmentShadingRateProperties() const {
+        return properties.fragment_shading_rate;
+    }
+
+    /// Returns true if textures are uploaded from the host with VK_EXT_host_image_copy.
+    bool IsExtHostImageCopySupported() const {
+        return extensions.host_image_copy;
+    }
+
+    /// Returns true if images of the given format can be written from the host.
+    bool IsHostImageCopyFormatSupported(VkFormat format) const {
+        return host_image_copy_formats.contains(format);
+    }
+
+    /// Returns true if adding host transfer usage to an image doesn't slow down device accesses.
+    bool IsHostImageCopyOptimal(const VkImageCreateInfo& image_ci) const;
+
+    /// Returns true if the device supports VK_EXT_graphics_pipeline_library with fast linking.
+    bool IsExtGraphicsPipelineLibrarySupported() const {
+        return extensions.graphics_pipeline_library;
+    }
+
     /// Returns true if the device supports VK_EXT_shader_demote_to_helper_invocation
     bool IsExtShaderDemoteToHelperInvocationSupported() const {
         return extensions.shader_demote_to_helper_invocation;
@@ -651,6 +790,9 @@ public:
 
     u64 GetDeviceMemoryUsage() const;
 
+    /// Returns the current memory budget reported by VK_EXT_memory_budget, or zero without it.
+    u64 GetDeviceMemoryBudget() const;
+
     u32 GetSetsPerPool() const {
         return sets_per_pool;
     }
@@ -687,6 +829,11 @@ public:
         return properties.properties.limits.maxVertexInputBindings;
     }
 
+    /// Returns the maximum number of samplers that can be alive at the same time.
+    u32 GetMaxSamplerAllocationCount() const {
+        return properties.properties.limits.maxSamplerAllocationCount;
+    }
+
     u32 GetMaxViewports() const {
         return properties.properties.limits.maxViewports;
     }
@@ -752,6 +899,12 @@ private:
     /// Sets up queue families.
     void SetupFamilies(VkSurfaceKHR surface);
 
+    /// Picks the family of the async compute queue.
+    void SetupComputeFamily(std::span<const VkQueueFamilyProperties> queue_family_properties);
+
+    /// Picks the family of the dedicated transfer queue.
+    void SetupTransferFamily(std::span<const VkQueueFamilyProperties> queue_family_properties);
+
     /// Collects information about attached tools.
     void CollectToolingInfo();
 
@@ -775,9 +928,17 @@ private:
     vk::Device logical;          ///< Logical device.
     vk::Queue graphics_queue;    ///< Main graphics queue.
     vk::Queue present_queue;     ///< Main present queue.
+    vk::Queue compute_queue;     ///< Async compute queue.
+    vk::Queue transfer_queue;    ///< Dedicated transfer queue.
     u32 instance_version{};      ///< Vulkan instance version.
     u32 graphics_family{};       ///< Main graphics queue family index.
     u32 present_family{};        ///< Main present queue family index.
+    u32 compute_family{};        ///< Async compute queue family index.
+    u32 compute_queue_index{};   ///< Index of the async compute queue in its family.
+    u32 transfer_family{};       ///< Dedicated transfer queue family index.
+    bool has_async_compute{};    ///< Async compute queue has been created.
+    bool has_transfer_queue{};   ///< Dedicated transfer queue has been created.
+    bool has_sparse_queue{};     ///< Graphics queue supports sparse binding.
 
     struct Extensions {
 #define EXTENSION(prefix, macro_name, var_name) bool var_name{};
@@ -817,6 +978,9 @@ private:
         VkPhysicalDevicePushDescriptorPropertiesKHR push_descriptor{};
         VkPhysicalDeviceSubgroupSizeControlProperties subgroup_size_control{};
         VkPhysicalDeviceTransformFeedbackPropertiesEXT transform_feedback{};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT graphics_pipeline_library{};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptor_buffer{};
+        VkPhysicalDeviceFragmentShadingRatePropertiesKHR fragment_shading_rate{};
 
         VkPhysicalDeviceProperties properties{};
     };
@@ -848,6 +1012,7 @@ private:
     bool must_emulate_bgr565{};                ///< Emulates BGR565 by swizzling RGB565 format.
     bool dynamic_state3_blending{};            ///< Has all blending features of dynamic_state3.
     bool dynamic_state3_enables{};             ///< Has all enables features of dynamic_state3.
+    bool dynamic_state3_rasterization{};       ///< Has the rasterization modes of dynamic_state3.
     bool supports_conditional_barriers{};      ///< Allows barriers in conditional control flow.
     u64 device_access_memory{};                ///< Total size of device local memory in bytes.
     u32 sets_per_pool{};                       ///< Sets per Description Pool
@@ -861,6 +1026,9 @@ private:
     /// Format properties dictionary.
     std::unordered_map<VkFormat, VkFormatProperties> format_properties;
 
+    /// Formats supporting VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT_EXT with optimal tiling.
+    std::unordered_set<VkFormat> host_image_copy_formats;
+
     /// Nsight Aftermath GPU crash tracker
     std::unique_ptr<NsightAftermathTracker> nsight_aftermath_tracker;
 };
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <limits>
 #include <optional>
@@ -83,6 +84,26 @@ namespace Vulkan {
             return VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
         }
 
+        [[nodiscard]] VmaAllocationCreateInfo BufferAllocationInfo(MemoryUsage usage,
+                                                                   u32 memory_type_bits) {
+            return VmaAllocationCreateInfo{
+                    .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT | MemoryUsageVmaFlags(usage),
+                    .usage = MemoryUsageVma(usage),
+                    .requiredFlags = 0,
+                    .preferredFlags = MemoryUsagePreferredVmaFlags(usage),
+                    .memoryTypeBits = memory_type_bits,
+                    .pool = VK_NULL_HANDLE,
+                    .pUserData = nullptr,
+                    .priority = 0.f,
+            };
+        }
+
+        constexpr std::array<const char *, 4> POOL_NAMES{
+                "Render target",
+                "Sampled image",
+                "Upload staging",
+                "Download staging",
+        };
 
 // This avoids calling vkGetBufferMemoryRequirements* directly.
         template<typename T>
@@ -199,13 +220,164 @@ namespace Vulkan {
                 }
             });
         }
+        CreatePools();
+    }
+
+    MemoryAllocator::~MemoryAllocator() {
+        for (const VmaPool pool : pools) {
+            if (pool) {
+                vmaDestroyPool(allocator, pool);
+            }
+        }
+    }
+
+    f32 MemoryAllocator::FragmentationRatio() const {
+        VkDeviceSize block_bytes = 0;
+        VkDeviceSize allocation_bytes = 0;
+        for (const VmaPool pool : pools) {
+            if (!pool) {
+                continue;
+            }
+            VmaStatistics stats{};
+            vmaGetPoolStatistics(allocator, pool, &stats);
+            block_bytes += stats.blockBytes;
+            allocation_bytes += stats.allocationBytes;
+        }
+        if (block_bytes == 0) {
+            return 0.0f;
+        }
+        return static_cast<f32>(block_bytes - allocation_bytes) / static_cast<f32>(block_bytes);
+    }
+
+    void MemoryAllocator::LogStatistics() const {
+        for (size_t i = 0; i < NUM_POOL_CLASSES; ++i) {
+            if (!pools[i]) {
+                continue;
+            }
+            VmaStatistics stats{};
+            vmaGetPoolStatistics(allocator, pools[i], &stats);
+            const f32 unused = stats.blockBytes == 0
+                                   ? 0.0f
+                                   : static_cast<f32>(stats.blockBytes - stats.allocationBytes) /
+                                         static_cast<f32>(stats.blockBytes);
+            LOG_INFO(Render_Vulkan, "{} pool: {} blocks, {} of {} MiB allocated, {:.1f}% unused",
+                     POOL_NAMES[i], stats.blockCount, stats.allocationBytes >> 20,
+                     stats.blockBytes >> 20, unused * 100.0f);
+        }
+        LOG_INFO(Render_Vulkan, "Pooled memory fragmentation {:.1f}%",
+                 FragmentationRatio() * 100.0f);
+    }
+
+    void MemoryAllocator::CreatePools() {
+        using namespace Common::Literals;
+        // Pools hold a single memory type, it is picked from a representative resource of the
+        // class. Resources that need another type are allocated from the default pools.
+        const VmaAllocationCreateInfo image_alloc_ci = {
+                .flags = 0,
+                .usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE,
+                .requiredFlags = 0,
+                .preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                .memoryTypeBits = 0,
+                .pool = VK_NULL_HANDLE,
+                .pUserData = nullptr,
+                .priority = 0.f,
+        };
+        const auto image_type = [&](VkImageUsageFlags usage) -> std::optional<u32> {
+            const VkImageCreateInfo image_ci = {
+                    .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                    .pNext = nullptr,
+                    .flags = 0,
+                    .imageType = VK_IMAGE_TYPE_2D,
+                    .format = VK_FORMAT_R8G8B8A8_UNORM,
+                    .extent = {1, 1, 1},
+                    .mipLevels = 1,
+                    .arrayLayers = 1,
+                    .samples = VK_SAMPLE_COUNT_1_BIT,
+                    .tiling = VK_IMAGE_TILING_OPTIMAL,
+                    .usage = usage,
+                    .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                    .queueFamilyIndexCount = 0,
+                    .pQueueFamilyIndices = nullptr,
+                    .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            };
+            u32 type{};
+            if (vmaFindMemoryTypeIndexForImageInfo(allocator, &image_ci, &image_alloc_ci,
+                                                   &type) != VK_SUCCESS) {
+                return std::nullopt;
+            }
+            return type;
+        };
+        const auto buffer_type = [&](MemoryUsage usage) -> std::optional<u32> {
+            const VkBufferCreateInfo buffer_ci = {
+                    .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                    .pNext = nullptr,
+                    .flags = 0,
+                    .size = 64_KiB,
+                    .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                    .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                    .queueFamilyIndexCount = 0,
+                    .pQueueFamilyIndices = nullptr,
+            };
+            const VmaAllocationCreateInfo alloc_ci =
+                    BufferAllocationInfo(usage, valid_memory_types);
+            u32 type{};
+            if (vmaFindMemoryTypeIndexForBufferInfo(allocator, &buffer_ci, &alloc_ci, &type) !=
+                VK_SUCCESS) {
+                return std::nullopt;
+            }
+            return type;
+        };
+        static constexpr VkImageUsageFlags transfer_usage =
+                VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        const std::array<std::optional<u32>, NUM_POOL_CLASSES> types{
+                image_type(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+                           transfer_usage),
+                image_type(VK_IMAGE_USAGE_SAMPLED_BIT | transfer_usage),
+                buffer_type(MemoryUsage::Upload),
+                buffer_type(MemoryUsage::Download),
+        };
+        for (size_t i = 0; i < NUM_POOL_CLASSES; ++i) {
+            if (!types[i]) {
+                continue;
+            }
+            VmaPoolCreateInfo pool_ci{};
+            pool_ci.memoryTypeIndex = *types[i];
+            if (vmaCreatePool(allocator, &pool_ci, &pools[i]) != VK_SUCCESS) {
+                LOG_WARNING(Render_Vulkan, "Failed to create the {} memory pool", POOL_NAMES[i]);
+                pools[i] = VK_NULL_HANDLE;
+                continue;
+            }
+            vmaSetPoolName(allocator, pools[i], POOL_NAMES[i]);
+        }
+    }
+
+    VmaPool MemoryAllocator::ImagePool(const VkImageCreateInfo &ci) const noexcept {
+        static constexpr VkImageUsageFlags attachment_usage =
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        const PoolClass pool_class = (ci.usage & attachment_usage) != 0 ? PoolClass::RenderTarget
+                                                                        : PoolClass::SampledImage;
+        return pools[static_cast<size_t>(pool_class)];
     }
 
-    MemoryAllocator::~MemoryAllocator() = default;
+    VmaPool MemoryAllocator::BufferPool(MemoryUsage usage) const noexcept {
+        switch (usage) {
+            case MemoryUsage::Upload:
+                return pools[static_cast<size_t>(PoolClass::Upload)];
+            case MemoryUsage::Download:
+                return pools[static_cast<size_t>(PoolClass::Download)];
+            case MemoryUsage::DeviceLocal:
+            case MemoryUsage::Stream:
+                break;
+        }
+        return VK_NULL_HANDLE;
+    }
 
     vk::Image MemoryAllocator::CreateImage(const VkImageCreateInfo &ci) const
     {
-        const VmaAllocationCreateInfo alloc_ci = {
+        // Attachments that are never stored only need memory on tilers while they are rendered
+        const bool is_lazy = (ci.usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0 &&
+                             HasLazilyAllocatedMemory();
+        VmaAllocationCreateInfo alloc_ci = {
                 .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT,
                 .usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE,
                 .requiredFlags = 0,
@@ -216,33 +388,73 @@ namespace Vulkan {
                 .priority = 0.f,
         };
 
+        if (is_lazy) {
+            alloc_ci.usage = VMA_MEMORY_USAGE_GPU_LAZILY_ALLOCATED;
+            alloc_ci.preferredFlags = 0;
+        }
+
         VkImage handle{};
         VmaAllocation allocation{};
-        vk::Check(vmaCreateImage(allocator, &ci, &alloc_ci, &handle, &allocation, nullptr));
+        VkResult result = VK_ERROR_FEATURE_NOT_PRESENT;
+        const VmaPool pool = ImagePool(ci);
+        if (!is_lazy && pool) {
+            VmaAllocationCreateInfo pool_alloc_ci = alloc_ci;
+            pool_alloc_ci.pool = pool;
+            result = vmaCreateImage(allocator, &ci, &pool_alloc_ci, &handle, &allocation, nullptr);
+        }
+        if (result != VK_SUCCESS) {
+            result = vmaCreateImage(allocator, &ci, &alloc_ci, &handle, &allocation, nullptr);
+        }
+        if (result != VK_SUCCESS) {
+            LogStatistics();
+        }
+        vk::Check(result);
         return vk::Image(handle, ci.usage, *device.GetLogical(), allocator, allocation,
                          device.GetDispatchLoader());
     }
 
+    vk::Image MemoryAllocator::CreateSparseImage(const VkImageCreateInfo &ci) const
+    {
+        const auto &dld = device.GetDispatchLoader();
+        VkImage handle{};
+        vk::Check(dld.vkCreateImage(*device.GetLogical(), &ci, nullptr, &handle));
+        // Destroying the image through VMA without an allocation only destroys the image
+        return vk::Image(handle, ci.usage, *device.GetLogical(), allocator, VK_NULL_HANDLE, dld);
+    }
+
     vk::Buffer
     MemoryAllocator::CreateBuffer(const VkBufferCreateInfo &ci, MemoryUsage usage) const
     {
-        const VmaAllocationCreateInfo alloc_ci = {
-                .flags = VMA_ALLOCATION_CREATE_WITHIN_BUDGET_BIT | MemoryUsageVmaFlags(usage),
-                .usage = MemoryUsageVma(usage),
-                .requiredFlags = 0,
-                .preferredFlags = MemoryUsagePreferredVmaFlags(usage),
-                .memoryTypeBits = usage == MemoryUsage::Stream ? 0u : valid_memory_types,
-                .pool = VK_NULL_HANDLE,
-                .pUserData = nullptr,
-                .priority = 0.f,
-        };
+        const VmaAllocationCreateInfo alloc_ci = BufferAllocationInfo(
+                usage, usage == MemoryUsage::Stream ? 0u : valid_memory_types);
+
+        // Descriptor buffers reference uniform and storage buffers by their device address
+        VkBufferCreateInfo buffer_ci = ci;
+        if (device.IsExtDescriptorBufferSupported() &&
+            (ci.usage & (VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT))) {
+            buffer_ci.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        }
 
         VkBuffer handle{};
         VmaAllocationInfo alloc_info{};
         VmaAllocation allocation{};
         VkMemoryPropertyFlags property_flags{};
 
-        vk::Check(vmaCreateBuffer(allocator, &ci, &alloc_ci, &handle, &allocation, &alloc_info));
+        VkResult result = VK_ERROR_FEATURE_NOT_PRESENT;
+        if (const VmaPool pool = BufferPool(usage)) {
+            VmaAllocationCreateInfo pool_alloc_ci = alloc_ci;
+            pool_alloc_ci.pool = pool;
+            result = vmaCreateBuffer(allocator, &buffer_ci, &pool_alloc_ci, &handle, &allocation,
+                                     &alloc_info);
+        }
+        if (result != VK_SUCCESS) {
+            result = vmaCreateBuffer(allocator, &buffer_ci, &alloc_ci, &handle, &allocation,
+                                     &alloc_info);
+        }
+        if (result != VK_SUCCESS) {
+            LogStatistics();
+        }
+        vk::Check(result);
         vmaGetAllocationMemoryProperties(allocator, allocation, &property_flags);
 
         u8 *data = reinterpret_cast<u8 *>(alloc_info.pMappedData);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <span>
 #include <vector>
@@ -105,6 +106,9 @@ namespace Vulkan {
 
         vk::Image CreateImage(const VkImageCreateInfo &ci) const;
 
+        /// Creates an image without backing memory, its memory is bound later with sparse binding.
+        vk::Image CreateSparseImage(const VkImageCreateInfo &ci) const;
+
         vk::Buffer CreateBuffer(const VkBufferCreateInfo &ci, MemoryUsage usage) const;
 
         /**
@@ -120,7 +124,41 @@ namespace Vulkan {
         /// Commits memory required by the buffer and binds it (for buffers created outside VMA).
         MemoryCommit Commit(const vk::Buffer &buffer, MemoryUsage usage);
 
+        /// Returns the share of the pooled memory blocks that no allocation uses.
+        [[nodiscard]] f32 FragmentationRatio() const;
+
+        /// Logs the usage and fragmentation of each pool.
+        void LogStatistics() const;
+
+        /// Returns true when the device has memory only backed while an attachment is rendered
+        bool HasLazilyAllocatedMemory() const noexcept {
+            for (u32 i = 0; i < properties.memoryTypeCount; ++i) {
+                if ((properties.memoryTypes[i].propertyFlags &
+                     VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
     private:
+        /// Resource classes allocated from their own pools, so they do not interleave in blocks
+        enum class PoolClass : u32 {
+            RenderTarget, ///< Color and depth stencil attachments
+            SampledImage, ///< Any other image
+            Upload,       ///< Staging buffers written by the CPU
+            Download,     ///< Staging buffers read back by the CPU
+        };
+        static constexpr size_t NUM_POOL_CLASSES = 4;
+
+        void CreatePools();
+
+        /// Returns the pool of the image, or null when it is allocated from the default pools
+        [[nodiscard]] VmaPool ImagePool(const VkImageCreateInfo &ci) const noexcept;
+
+        /// Returns the pool of buffers of the usage, or null for the default pools
+        [[nodiscard]] VmaPool BufferPool(MemoryUsage usage) const noexcept;
+
         static bool IsAutoUsage(VmaMemoryUsage u) noexcept {
             switch (u) {
                 case VMA_MEMORY_USAGE_AUTO:
@@ -137,6 +175,8 @@ namespace Vulkan {
         const VkPhysicalDeviceMemoryProperties properties; ///< Physical device memory properties.
         VkDeviceSize buffer_image_granularity;            ///< Adjacent buffer/image granularity
         u32 valid_memory_types{~0u};
+        /// Pools of each class, null when no memory type fits the class
+        std::array<VmaPool, NUM_POOL_CLASSES> pools{};
     };
 
 } // namespace Vulkan
@@ -92,8 +92,10 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdBeginConditionalRenderingEXT);
     X(vkCmdBeginQuery);
     X(vkCmdBeginRenderPass);
+    X(vkCmdBeginRendering);
     X(vkCmdBeginTransformFeedbackEXT);
     X(vkCmdBeginDebugUtilsLabelEXT);
+    X(vkCmdBindDescriptorBuffersEXT);
     X(vkCmdBindDescriptorSets);
     X(vkCmdBindIndexBuffer);
     X(vkCmdBindPipeline);
@@ -119,6 +121,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdEndConditionalRenderingEXT);
     X(vkCmdEndQuery);
     X(vkCmdEndRenderPass);
+    X(vkCmdEndRendering);
     X(vkCmdResetQueryPool);
     X(vkCmdEndTransformFeedbackEXT);
     X(vkCmdEndDebugUtilsLabelEXT);
@@ -137,12 +140,14 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetStencilWriteMask);
     X(vkCmdSetViewport);
     X(vkCmdWaitEvents);
+    X(vkCmdWriteTimestamp);
     X(vkCmdBindVertexBuffers2EXT);
     X(vkCmdSetCullModeEXT);
     X(vkCmdSetDepthBoundsTestEnableEXT);
     X(vkCmdSetDepthCompareOpEXT);
     X(vkCmdSetDepthTestEnableEXT);
     X(vkCmdSetDepthWriteEnableEXT);
+    X(vkCmdSetDescriptorBufferOffsetsEXT);
     X(vkCmdSetPrimitiveRestartEnableEXT);
     X(vkCmdSetRasterizerDiscardEnableEXT);
     X(vkCmdSetConservativeRasterizationModeEXT);
@@ -151,6 +156,8 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetDepthBiasEnableEXT);
     X(vkCmdSetLogicOpEnableEXT);
     X(vkCmdSetDepthClampEnableEXT);
+    X(vkCmdSetPolygonModeEXT);
+    X(vkCmdSetAlphaToCoverageEnableEXT);
     X(vkCmdSetFrontFaceEXT);
     X(vkCmdSetLogicOpEXT);
     X(vkCmdSetPatchControlPointsEXT);
@@ -163,6 +170,7 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkCmdSetColorBlendEnableEXT);
     X(vkCmdSetColorBlendEquationEXT);
     X(vkCmdResolveImage);
+    X(vkCopyMemoryToImageEXT);
     X(vkCreateBuffer);
     X(vkCreateBufferView);
     X(vkCreateCommandPool);
@@ -209,11 +217,16 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkFreeCommandBuffers);
     X(vkFreeDescriptorSets);
     X(vkFreeMemory);
+    X(vkGetBufferDeviceAddress);
     X(vkGetBufferMemoryRequirements2);
+    X(vkGetDescriptorEXT);
+    X(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    X(vkGetDescriptorSetLayoutSizeEXT);
     X(vkGetDeviceQueue);
     X(vkGetEventStatus);
     X(vkGetFenceStatus);
     X(vkGetImageMemoryRequirements);
+    X(vkGetImageSparseMemoryRequirements);
     X(vkGetPipelineCacheData);
     X(vkGetMemoryFdKHR);
 #ifdef _WIN32
@@ -224,15 +237,18 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
     X(vkGetPipelineExecutableStatisticsKHR);
     X(vkGetSemaphoreCounterValue);
     X(vkMapMemory);
+    X(vkQueueBindSparse);
     X(vkQueueSubmit);
     X(vkResetFences);
     X(vkResetQueryPool);
     X(vkSetDebugUtilsObjectNameEXT);
     X(vkSetDebugUtilsObjectTagEXT);
+    X(vkTransitionImageLayoutEXT);
     X(vkUnmapMemory);
     X(vkUpdateDescriptorSetWithTemplate);
     X(vkUpdateDescriptorSets);
     X(vkWaitForFences);
+    X(vkWaitForPresentKHR);
     X(vkWaitSemaphores);
 
     // Support for timeline semaphores is mandatory in Vulkan 1.2
@@ -246,6 +262,17 @@ void Load(VkDevice device, DeviceDispatch& dld) noexcept {
         Proc(dld.vkResetQueryPool, dld, "vkResetQueryPoolEXT", device);
     }
 
+    // Support for buffer device address is optional in Vulkan 1.2
+    if (!dld.vkGetBufferDeviceAddress) {
+        Proc(dld.vkGetBufferDeviceAddress, dld, "vkGetBufferDeviceAddressKHR", device);
+    }
+
+    // Support for dynamic rendering is mandatory in Vulkan 1.3
+    if (!dld.vkCmdBeginRendering) {
+        Proc(dld.vkCmdBeginRendering, dld, "vkCmdBeginRenderingKHR", device);
+        Proc(dld.vkCmdEndRendering, dld, "vkCmdEndRenderingKHR", device);
+    }
+
     // Support for draw indirect with count is optional in Vulkan 1.2
     if (!dld.vkCmdDrawIndirectCount) {
         Proc(dld.vkCmdDrawIndirectCount, dld, "vkCmdDrawIndirectCountKHR", device);
@@ -288,11 +315,14 @@ bool Load(VkInstance instance, InstanceDispatch& dld) noexcept {
     X(vkDestroyDebugReportCallbackEXT);
     X(vkDestroySurfaceKHR);
     X(vkGetPhysicalDeviceFeatures2);
+    X(vkGetPhysicalDeviceFormatProperties2);
+    X(vkGetPhysicalDeviceImageFormatProperties2);
     X(vkGetPhysicalDeviceProperties2);
     X(vkGetPhysicalDeviceSurfaceCapabilitiesKHR);
     X(vkGetPhysicalDeviceSurfaceFormatsKHR);
     X(vkGetPhysicalDeviceSurfacePresentModesKHR);
     X(vkGetPhysicalDeviceSurfaceSupportKHR);
+    X(vkGetPhysicalDeviceSparseImageFormatProperties);
     X(vkGetPhysicalDeviceToolProperties);
     X(vkGetSwapchainImagesKHR);
     X(vkQueuePresentKHR);
@@ -654,9 +684,9 @@ Device Device::Create(VkPhysicalDevice physical_device, Span<VkDeviceQueueCreate
     return Device(device, dispatch);
 }
 
-Queue Device::GetQueue(u32 family_index) const noexcept {
+Queue Device::GetQueue(u32 family_index, u32 queue_index) const noexcept {
     VkQueue queue;
-    dld->vkGetDeviceQueue(handle, family_index, 0, &queue);
+    dld->vkGetDeviceQueue(handle, family_index, queue_index, &queue);
     return Queue(queue, *dld);
 }
 
@@ -823,12 +853,30 @@ VkMemoryRequirements Device::GetBufferMemoryRequirements(VkBuffer buffer,
     return requirements.memoryRequirements;
 }
 
+VkDeviceAddress Device::GetBufferDeviceAddress(VkBuffer buffer) const noexcept {
+    const VkBufferDeviceAddressInfo info{
+        .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+        .pNext = nullptr,
+        .buffer = buffer,
+    };
+    return dld->vkGetBufferDeviceAddress(handle, &info);
+}
+
 VkMemoryRequirements Device::GetImageMemoryRequirements(VkImage image) const noexcept {
     VkMemoryRequirements requirements;
     dld->vkGetImageMemoryRequirements(handle, image, &requirements);
     return requirements;
 }
 
+std::vector<VkSparseImageMemoryRequirements> Device::GetImageSparseMemoryRequirements(
+    VkImage image) const {
+    u32 num;
+    dld->vkGetImageSparseMemoryRequirements(handle, image, &num, nullptr);
+    std::vector<VkSparseImageMemoryRequirements> requirements(num);
+    dld->vkGetImageSparseMemoryRequirements(handle, image, &num, requirements.data());
+    return requirements;
+}
+
 std::vector<VkPipelineExecutablePropertiesKHR> Device::GetPipelineExecutablePropertiesKHR(
     VkPipeline pipeline) const {
     const VkPipelineInfoKHR info{
@@ -898,6 +946,17 @@ VkFormatProperties PhysicalDevice::GetFormatProperties(VkFormat format) const no
     return properties;
 }
 
+void PhysicalDevice::GetFormatProperties2(VkFormat format,
+                                          VkFormatProperties2& properties) const noexcept {
+    dld->vkGetPhysicalDeviceFormatProperties2(physical_device, format, &properties);
+}
+
+VkResult PhysicalDevice::GetImageFormatProperties2(
+    const VkPhysicalDeviceImageFormatInfo2& info,
+    VkImageFormatProperties2& properties) const noexcept {
+    return dld->vkGetPhysicalDeviceImageFormatProperties2(physical_device, &info, &properties);
+}
+
 std::vector<VkExtensionProperties> PhysicalDevice::EnumerateDeviceExtensionProperties() const {
     u32 num;
     dld->vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &num, nullptr);
@@ -914,6 +973,21 @@ std::vector<VkQueueFamilyProperties> PhysicalDevice::GetQueueFamilyProperties()
     return properties;
 }
 
+std::vector<VkSparseImageFormatProperties> PhysicalDevice::GetSparseImageFormatProperties(
+    VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage,
+    VkImageTiling tiling) const {
+    if (!dld->vkGetPhysicalDeviceSparseImageFormatProperties) {
+        return {};
+    }
+    u32 num;
+    dld->vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, format, type, samples,
+                                                        usage, tiling, &num, nullptr);
+    std::vector<VkSparseImageFormatProperties> properties(num);
+    dld->vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, format, type, samples,
+                                                        usage, tiling, &num, properties.data());
+    return properties;
+}
+
 std::vector<VkPhysicalDeviceToolProperties> PhysicalDevice::GetPhysicalDeviceToolProperties()
     const {
     u32 num = 0;
@@ -38,11 +38,14 @@
 #include <QOpenGLContext>
 #endif
 
+#include "common/fs/file.h"
 #include "common/polyfill_thread.h"
+#include "common/qoi.h"
 #include "common/scm_rev.h"
 #include "common/settings.h"
 #include "common/settings_input.h"
 #include "common/thread.h"
+#include "core/boot_timeline.h"
 #include "core/core.h"
 #include "core/cpu_manager.h"
 #include "core/frontend/framebuffer_layout.h"
@@ -84,6 +87,7 @@ void EmuThread::run() {
 
     emit LoadProgress(VideoCore::LoadCallbackStage::Prepare, 0, 0);
     if (Settings::values.use_disk_shader_cache.GetValue()) {
+        const auto boot_stage = m_system.GetBootTimeline().MeasureStage("Pipeline cache");
         m_system.Renderer().ReadRasterizer()->LoadDiskResources(
             m_system.GetApplicationProcessProgramID(), stop_token,
             [this](VideoCore::LoadCallbackStage stage, std::size_t value, std::size_t total) {
@@ -355,6 +359,18 @@ void GRenderWindow::RestoreGeometry() {
     QWidget::restoreGeometry(geometry);
 }
 
+void GRenderWindow::SetNativePresentation(bool enabled) {
+    is_native_presentation = enabled;
+    // The render widget covers the whole window, there's nothing for Qt to paint under it
+    setAttribute(Qt::WA_NoSystemBackground, enabled);
+    setAttribute(Qt::WA_OpaquePaintEvent, enabled);
+    Settings::values.native_presentation_active.store(enabled, std::memory_order_relaxed);
+}
+
+bool GRenderWindow::IsNativePresentation() const {
+    return is_native_presentation;
+}
+
 void GRenderWindow::restoreGeometry(const QByteArray& geometry_) {
     // Make sure users of this class don't need to deal with backing up the geometry themselves
     QWidget::restoreGeometry(geometry_);
@@ -959,6 +975,19 @@ void GRenderWindow::ReleaseRenderTarget() {
     main_context.reset();
 }
 
+/// Saves a screenshot as QOI when the path asks for it, encoding PNG takes several times longer
+static bool SaveScreenshot(const QImage& image, const std::string& path, bool invert_y) {
+    if (!path.ends_with(".qoi")) {
+        return image.mirrored(false, invert_y).save(QString::fromStdString(path));
+    }
+    const std::vector<u8> encoded = Common::Qoi::EncodeBgra8(
+        std::span{image.constBits(), static_cast<size_t>(image.sizeInBytes())},
+        static_cast<u32>(image.width()), static_cast<u32>(image.height()), invert_y);
+    const Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                                  Common::FS::FileType::BinaryFile};
+    return file.IsOpen() && file.Write(encoded) == encoded.size();
+}
+
 void GRenderWindow::CaptureScreenshot(const QString& screenshot_path) {
     auto& renderer = system.Renderer();
 
@@ -985,7 +1014,7 @@ void GRenderWindow::CaptureScreenshot(const QString& screenshot_path) {
         screenshot_image.bits(),
         [=, this](bool invert_y) {
             const std::string std_screenshot_path = screenshot_path.toStdString();
-            if (screenshot_image.mirrored(false, invert_y).save(screenshot_path)) {
+            if (SaveScreenshot(screenshot_image, std_screenshot_path, invert_y)) {
                 LOG_INFO(Frontend, "Screenshot saved to \"{}\"", std_screenshot_path);
             } else {
                 LOG_ERROR(Frontend, "Failed to save screenshot to \"{}\"", std_screenshot_path);
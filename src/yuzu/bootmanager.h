@@ -161,6 +161,12 @@ public:
 
     void BackupGeometry();
     void RestoreGeometry();
+
+    /// Marks the window as presenting fullscreen on its own, with no Qt painting under the
+    /// render widget and mailbox presentation on Vulkan
+    void SetNativePresentation(bool enabled);
+    bool IsNativePresentation() const;
+
     void restoreGeometry(const QByteArray& geometry_); // overridden
     QByteArray saveGeometry();                         // overridden
 
@@ -262,6 +268,7 @@ private:
     QWidget* child_widget = nullptr;
 
     bool first_frame = false;
+    bool is_native_presentation = false;
     InputCommon::TasInput::TasState last_tas_state;
 
 #if (QT_VERSION < QT_VERSION_CHECK(6, 0, 0)) && YUZU_USE_QT_MULTIMEDIA
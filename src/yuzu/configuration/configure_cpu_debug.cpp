@@ -48,6 +48,15 @@ void ConfigureCpuDebug::SetConfiguration() {
     ui->cpuopt_ignore_memory_aborts->setEnabled(runtime_lock);
     ui->cpuopt_ignore_memory_aborts->setChecked(
         Settings::values.cpuopt_ignore_memory_aborts.GetValue());
+    ui->cpuopt_tiered_compilation->setEnabled(runtime_lock);
+    ui->cpuopt_tiered_compilation->setChecked(
+        Settings::values.cpuopt_tiered_compilation.GetValue());
+    ui->cpuopt_live_range_spilling->setEnabled(runtime_lock);
+    ui->cpuopt_live_range_spilling->setChecked(
+        Settings::values.cpuopt_live_range_spilling.GetValue());
+    ui->cpuopt_background_translation->setEnabled(runtime_lock);
+    ui->cpuopt_background_translation->setChecked(
+        Settings::values.cpuopt_background_translation.GetValue());
 }
 
 void ConfigureCpuDebug::ApplyConfiguration() {
@@ -63,6 +72,10 @@ void ConfigureCpuDebug::ApplyConfiguration() {
     Settings::values.cpuopt_fastmem_exclusives = ui->cpuopt_fastmem_exclusives->isChecked();
     Settings::values.cpuopt_recompile_exclusives = ui->cpuopt_recompile_exclusives->isChecked();
     Settings::values.cpuopt_ignore_memory_aborts = ui->cpuopt_ignore_memory_aborts->isChecked();
+    Settings::values.cpuopt_tiered_compilation = ui->cpuopt_tiered_compilation->isChecked();
+    Settings::values.cpuopt_live_range_spilling = ui->cpuopt_live_range_spilling->isChecked();
+    Settings::values.cpuopt_background_translation =
+        ui->cpuopt_background_translation->isChecked();
 }
 
 void ConfigureCpuDebug::changeEvent(QEvent* event) {
@@ -4,13 +4,18 @@
 // SPDX-FileCopyrightText: 2015 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <numeric>
 #include <QAction>
+#include <QLabel>
 #include <QLayout>
 #include <QString>
+#include <QStringList>
+#include <QTimer>
 #include "common/settings.h"
 #include "hid_core/frontend/emulated_controller.h"
 #include "hid_core/hid_core.h"
 #include "input_common/drivers/tas_input.h"
+#include "input_common/input_engine.h"
 #include "input_common/main.h"
 #include "yuzu/configuration/configure_input_player_widget.h"
 #include "yuzu/debugger/controller.h"
@@ -32,6 +37,14 @@ ControllerDialog::ControllerDialog(Core::HID::HIDCore& hid_core_,
     layout->setContentsMargins(0, 0, 0, 0);
     layout->addWidget(widget);
 
+    report_intervals_label = new QLabel(this);
+    report_intervals_label->setContentsMargins(6, 0, 6, 6);
+    report_intervals_label->setVisible(false);
+    layout->addWidget(report_intervals_label);
+    report_intervals_timer = new QTimer(this);
+    connect(report_intervals_timer, &QTimer::timeout, this,
+            &ControllerDialog::UpdateReportIntervals);
+
     // Configure focus so that widget is focusable and the dialog automatically forwards focus to
     // it.
     setFocusProxy(widget);
@@ -78,6 +91,9 @@ void ControllerDialog::showEvent(QShowEvent* ev) {
     if (toggle_view_action) {
         toggle_view_action->setChecked(isVisible());
     }
+    // Drop what was accumulated while hidden
+    input_subsystem->GetAndResetReportIntervals();
+    report_intervals_timer->start(1000);
     QWidget::showEvent(ev);
 }
 
@@ -85,9 +101,40 @@ void ControllerDialog::hideEvent(QHideEvent* ev) {
     if (toggle_view_action) {
         toggle_view_action->setChecked(isVisible());
     }
+    report_intervals_timer->stop();
     QWidget::hideEvent(ev);
 }
 
+void ControllerDialog::UpdateReportIntervals() {
+    const auto& limits = InputCommon::ReportIntervalHistogram::bucket_limits_ms;
+    QStringList lines;
+    for (const auto& [engine, histogram] : input_subsystem->GetAndResetReportIntervals()) {
+        const u64 total = std::accumulate(histogram.counts.begin(), histogram.counts.end(), u64{0});
+        if (total == 0) {
+            continue;
+        }
+        QStringList buckets;
+        for (std::size_t bucket = 0; bucket < histogram.counts.size(); ++bucket) {
+            QString range;
+            if (bucket == 0) {
+                range = tr("<%1 ms").arg(limits.front());
+            } else if (bucket == limits.size()) {
+                range = tr(">=%1 ms").arg(limits.back());
+            } else {
+                range = tr("%1-%2 ms").arg(limits[bucket - 1]).arg(limits[bucket]);
+            }
+            const double share = static_cast<double>(histogram.counts[bucket]) * 100.0 / total;
+            buckets.append(tr("%1: %2%").arg(range).arg(share, 0, 'f', 0));
+        }
+        lines.append(tr("%1 report interval (%2/s): %3")
+                         .arg(QString::fromStdString(engine))
+                         .arg(total)
+                         .arg(buckets.join(QStringLiteral(", "))));
+    }
+    report_intervals_label->setText(lines.join(QLatin1Char('\n')));
+    report_intervals_label->setVisible(!lines.empty());
+}
+
 void ControllerDialog::ControllerUpdate(Core::HID::ControllerTriggerType type) {
     // TODO(german77): Remove TAS from here
     switch (type) {
@@ -1,3 +1,6 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
 // SPDX-FileCopyrightText: 2015 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,7 +10,9 @@
 
 class QAction;
 class QHideEvent;
+class QLabel;
 class QShowEvent;
+class QTimer;
 class PlayerControlPreview;
 
 namespace InputCommon {
@@ -45,12 +50,17 @@ private:
     /// Redirects input from the widget to the TAS driver
     void ControllerUpdate(Core::HID::ControllerTriggerType type);
 
+    /// Shows how the time between input reports of the threaded drivers was distributed
+    void UpdateReportIntervals();
+
     int callback_key;
     bool is_controller_set{};
     Core::HID::EmulatedController* controller;
 
     QAction* toggle_view_action = nullptr;
     PlayerControlPreview* widget;
+    QLabel* report_intervals_label;
+    QTimer* report_intervals_timer;
     Core::HID::HIDCore& hid_core;
     std::shared_ptr<InputCommon::InputSubsystem> input_subsystem;
 };
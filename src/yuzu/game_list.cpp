@@ -553,6 +553,8 @@ void GameList::AddGamePopup(QMenu& context_menu, u64 program_id, const std::stri
     QAction* open_mod_location = context_menu.addAction(tr("Open Mod Data Location"));
     QAction* open_transferable_shader_cache =
         context_menu.addAction(tr("Open Transferable Pipeline Cache"));
+    QAction* export_shader_cache = context_menu.addAction(tr("Export Pipeline Cache..."));
+    QAction* import_shader_cache = context_menu.addAction(tr("Import Pipeline Cache..."));
     QAction* ryujinx = context_menu.addAction(tr("Link to Ryujinx"));
     context_menu.addSeparator();
     QMenu* remove_menu = context_menu.addMenu(tr("Remove"));
@@ -590,6 +592,8 @@ void GameList::AddGamePopup(QMenu& context_menu, u64 program_id, const std::stri
     open_save_location->setVisible(program_id != 0);
     open_mod_location->setVisible(program_id != 0);
     open_transferable_shader_cache->setVisible(program_id != 0);
+    export_shader_cache->setVisible(program_id != 0);
+    import_shader_cache->setVisible(program_id != 0);
     remove_update->setVisible(program_id != 0);
     remove_dlc->setVisible(program_id != 0);
     remove_gl_shader_cache->setVisible(program_id != 0);
@@ -612,6 +616,10 @@ void GameList::AddGamePopup(QMenu& context_menu, u64 program_id, const std::stri
     });
     connect(open_transferable_shader_cache, &QAction::triggered,
             [this, program_id]() { emit OpenTransferableShaderCacheRequested(program_id); });
+    connect(export_shader_cache, &QAction::triggered,
+            [this, program_id]() { emit ExportShaderCacheRequested(program_id); });
+    connect(import_shader_cache, &QAction::triggered,
+            [this, program_id]() { emit ImportShaderCacheRequested(program_id); });
     connect(remove_all_content, &QAction::triggered, [this, program_id]() {
         emit RemoveInstalledEntryRequested(program_id, QtCommon::Game::InstalledEntryType::Game);
     });
@@ -880,7 +888,8 @@ void GameList::LoadInterfaceLayout() {
 
 const QStringList GameList::supported_file_extensions = {
     QStringLiteral("nso"), QStringLiteral("nro"), QStringLiteral("nca"),
-    QStringLiteral("xci"), QStringLiteral("nsp"), QStringLiteral("kip")};
+    QStringLiteral("xci"), QStringLiteral("nsp"), QStringLiteral("kip"),
+    QStringLiteral("xcz"), QStringLiteral("nsz")};
 
 void GameList::RefreshGameDirectory()
 {
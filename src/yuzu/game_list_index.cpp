@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+
+#include "common/common_funcs.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "yuzu/game_list_index.h"
+
+namespace {
+
+constexpr quint32 INDEX_MAGIC = Common::MakeMagic('I', 'N', 'D', 'X');
+constexpr quint32 INDEX_VERSION = 1;
+
+QString GetIndexPath() {
+    const auto path = Common::FS::GetEdenPath(Common::FS::EdenPath::CacheDir) / "game_list" /
+                      "index.bin";
+    return QString::fromStdString(Common::FS::PathToUTF8String(path));
+}
+
+} // Anonymous namespace
+
+void GameListIndex::Load() {
+    previous.clear();
+    {
+        std::scoped_lock lk{mutex};
+        current.clear();
+    }
+
+    QFile file{GetIndexPath()};
+    if (!file.open(QFile::ReadOnly)) {
+        return;
+    }
+    QDataStream stream{&file};
+    quint32 magic{};
+    quint32 version{};
+    quint32 count{};
+    stream >> magic >> version >> count;
+    if (magic != INDEX_MAGIC || version != INDEX_VERSION) {
+        return;
+    }
+
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString path;
+        quint64 size{};
+        qint64 modified{};
+        Entry entry{};
+        quint32 num_programs{};
+        stream >> path >> size >> modified >> entry.file_type >> num_programs;
+        entry.size = size;
+        entry.modified = modified;
+        for (quint32 j = 0; j < num_programs && stream.status() == QDataStream::Ok; ++j) {
+            quint64 program_id{};
+            QString name;
+            QByteArray icon;
+            stream >> program_id >> name >> icon;
+            Program& program = entry.programs.emplace_back();
+            program.program_id = program_id;
+            program.name = name.toStdString();
+            program.icon.assign(icon.begin(), icon.end());
+        }
+        previous.insert_or_assign(path.toStdString(), std::move(entry));
+    }
+    if (stream.status() != QDataStream::Ok) {
+        LOG_WARNING(Frontend, "Game list index is truncated, rescanning all files");
+        previous.clear();
+    }
+}
+
+void GameListIndex::Save() {
+    const QString path = GetIndexPath();
+    void(Common::FS::CreateParentDirs(path.toStdString()));
+
+    QSaveFile file{path};
+    if (!file.open(QFile::WriteOnly)) {
+        LOG_ERROR(Frontend, "Failed to open the game list index for writing");
+        return;
+    }
+    QDataStream stream{&file};
+
+    std::scoped_lock lk{mutex};
+    stream << INDEX_MAGIC << INDEX_VERSION << static_cast<quint32>(current.size());
+    for (const auto& [file_path, entry] : current) {
+        stream << QString::fromStdString(file_path) << static_cast<quint64>(entry.size)
+               << static_cast<qint64>(entry.modified) << entry.file_type << static_cast<quint32>(entry.programs.size());
+        for (const Program& program : entry.programs) {
+            stream << static_cast<quint64>(program.program_id) << QString::fromStdString(program.name)
+                   << QByteArray(reinterpret_cast<const char*>(program.icon.data()),
+                                 static_cast<qsizetype>(program.icon.size()));
+        }
+    }
+    if (!file.commit()) {
+        LOG_ERROR(Frontend, "Failed to write the game list index");
+    }
+}
+
+std::optional<GameListIndex::Entry> GameListIndex::Find(const std::string& path, u64 size,
+                                                        s64 modified) const {
+    const auto it = previous.find(path);
+    if (it == previous.end() || it->second.size != size || it->second.modified != modified) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void GameListIndex::Insert(const std::string& path, Entry entry) {
+    std::scoped_lock lk{mutex};
+    current.insert_or_assign(path, std::move(entry));
+}
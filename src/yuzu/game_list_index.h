@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+
+/**
+ * Persistent metadata of the game files found by previous scans, keyed by path. An entry is only
+ * reused while the size and modification time of its file are unchanged, so refreshing the game
+ * list doesn't need to parse and decrypt files that didn't change.
+ */
+class GameListIndex {
+public:
+    struct Program {
+        u64 program_id;
+        std::string name;
+        std::vector<u8> icon;
+    };
+
+    struct Entry {
+        u64 size;
+        s64 modified;
+        u32 file_type; ///< Loader::FileType of the file
+        std::vector<Program> programs; ///< Empty for files that aren't games
+    };
+
+    /// Loads the index saved by the previous scan.
+    void Load();
+
+    /// Saves the entries added since Load, dropping the ones of files that weren't seen.
+    void Save();
+
+    /// Finds the entry of a file from the previous scan. Safe to call from several threads.
+    [[nodiscard]] std::optional<Entry> Find(const std::string& path, u64 size,
+                                            s64 modified) const;
+
+    /// Records the entry of a file for the next scan. Safe to call from several threads.
+    void Insert(const std::string& path, Entry entry);
+
+private:
+    std::unordered_map<std::string, Entry> previous;
+
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> current;
+};
@@ -4,11 +4,16 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
@@ -16,6 +21,7 @@
 
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
@@ -198,22 +204,20 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path,
                                         const std::string& name,
                                         const std::size_t size,
                                         const std::vector<u8>& icon,
-                                        Loader::AppLoader& loader,
+                                        Loader::FileType file_type,
                                         u64 program_id,
                                         const CompatibilityList& compatibility_list,
                                         const PlayTime::PlayTimeManager& play_time_manager,
-                                        const FileSys::PatchManager& patch)
+                                        const FileSys::PatchManager& patch,
+                                        const std::function<QString()>& patch_versions_generator)
 {
     auto const it = FindMatchingCompatibilityEntry(compatibility_list, program_id);
     // The game list uses 99 as compatibility number for untested games
     QString compatibility = it != compatibility_list.end() ? it->second.first : QStringLiteral("99");
 
-    auto const file_type = loader.GetFileType();
     auto const file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
 
-    QString patch_versions = GetGameListCachedObject(fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
-        return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
-    });
+    QString patch_versions = GetGameListCachedObject(fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", patch_versions_generator);
     return QList<QStandardItem*>{
         new GameListItemPath(FormatGameName(path), icon, QString::fromStdString(name), file_type_string, program_id),
         new GameListItem(file_type_string),
@@ -223,6 +227,38 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path,
         new GameListItemCompat(compatibility),
     };
 }
+
+QList<QStandardItem*> MakeGameListEntry(const std::string& path,
+                                        const std::string& name,
+                                        const std::size_t size,
+                                        const std::vector<u8>& icon,
+                                        Loader::AppLoader& loader,
+                                        u64 program_id,
+                                        const CompatibilityList& compatibility_list,
+                                        const PlayTime::PlayTimeManager& play_time_manager,
+                                        const FileSys::PatchManager& patch)
+{
+    return MakeGameListEntry(path, name, size, icon, loader.GetFileType(), program_id,
+                             compatibility_list, play_time_manager, patch, [&patch, &loader] {
+                                 return FormatPatchNameVersions(patch, loader,
+                                                                loader.IsRomFSUpdatable());
+                             });
+}
+
+/// NSP and XCI loaders import their tickets into the KeyManager, and may write the title keys
+/// file, when they're created. The KeyManager isn't thread-safe. Identifying a file creates them
+/// too, so files whose name doesn't tell their type are assumed to import keys as well.
+bool ImportsKeys(Loader::FileType file_type) {
+    switch (file_type) {
+    case Loader::FileType::NSP:
+    case Loader::FileType::XCI:
+    case Loader::FileType::Unknown:
+    case Loader::FileType::Error:
+        return true;
+    default:
+        return false;
+    }
+}
 } // Anonymous namespace
 
 GameListWorker::GameListWorker(FileSys::VirtualFilesystem vfs_,
@@ -346,7 +382,8 @@ void GameListWorker::AddTitlesToGameList(GameListDir* parent_dir) {
 
 void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                                     GameListDir* parent_dir) {
-    const auto callback = [this, target, parent_dir](const std::filesystem::path& path) -> bool {
+    std::vector<std::string> game_files;
+    const auto callback = [this, target, &game_files](const std::filesystem::path& path) -> bool {
         if (stop_requested) {
             // Breaks the callback loop.
             return false;
@@ -357,6 +394,12 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
 
         if (!is_dir &&
             (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
+            if (target == ScanTarget::PopulateGameList) {
+                // Files are loaded by the scan workers once the directory has been listed.
+                game_files.push_back(physical_name);
+                return true;
+            }
+
             const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
             if (!file) {
                 return true;
@@ -375,81 +418,22 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
             u64 program_id = 0;
             const auto res2 = loader->ReadProgramId(program_id);
 
-            if (target == ScanTarget::FillManualContentProvider) {
-                if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
-                    provider->AddEntry(FileSys::TitleType::Application,
-                                       FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
-                                       program_id, file);
-                } else if (res2 == Loader::ResultStatus::Success &&
-                           (file_type == Loader::FileType::XCI ||
-                            file_type == Loader::FileType::NSP)) {
-                    const auto nsp = file_type == Loader::FileType::NSP
-                                         ? std::make_shared<FileSys::NSP>(file)
-                                         : FileSys::XCI{file}.GetSecurePartitionNSP();
-                    for (const auto& title : nsp->GetNCAs()) {
-                        for (const auto& entry : title.second) {
-                            provider->AddEntry(entry.first.first, entry.first.second, title.first,
-                                               entry.second->GetBaseFile());
-                        }
+            if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
+                provider->AddEntry(FileSys::TitleType::Application,
+                                   FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
+                                   program_id, file);
+            } else if (res2 == Loader::ResultStatus::Success &&
+                       (file_type == Loader::FileType::XCI ||
+                        file_type == Loader::FileType::NSP)) {
+                const auto nsp = file_type == Loader::FileType::NSP
+                                     ? std::make_shared<FileSys::NSP>(file)
+                                     : FileSys::XCI{file}.GetSecurePartitionNSP();
+                for (const auto& title : nsp->GetNCAs()) {
+                    for (const auto& entry : title.second) {
+                        provider->AddEntry(entry.first.first, entry.first.second, title.first,
+                                           entry.second->GetBaseFile());
                     }
                 }
-            } else {
-                std::vector<u64> program_ids;
-                loader->ReadProgramIds(program_ids);
-
-                if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
-                    (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
-                    for (const auto id : program_ids) {
-                        loader = Loader::GetLoader(system, file, id);
-                        if (!loader) {
-                            continue;
-                        }
-
-                        std::vector<u8> icon;
-                        [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                        std::string name = " ";
-                        [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                        const FileSys::PatchManager patch{id, system.GetFileSystemController(),
-                                                          system.GetContentProvider()};
-
-                        auto entry = MakeGameListEntry(physical_name,
-                                                       name,
-                                                       Common::FS::GetSize(physical_name),
-                                                       icon,
-                                                       *loader,
-                                                       id,
-                                                       compatibility_list,
-                                                       play_time_manager,
-                                                       patch);
-
-                        RecordEvent(
-                            [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                    }
-                } else {
-                    std::vector<u8> icon;
-                    [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                    std::string name = " ";
-                    [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                    const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
-                                                      system.GetContentProvider()};
-
-                    auto entry = MakeGameListEntry(physical_name,
-                                                   name,
-                                                   Common::FS::GetSize(physical_name),
-                                                   icon,
-                                                   *loader,
-                                                   program_id,
-                                                   compatibility_list,
-                                                   play_time_manager,
-                                                   patch);
-
-                    RecordEvent(
-                        [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                }
             }
         } else if (is_dir) {
             watch_list.append(QString::fromStdString(physical_name));
@@ -464,11 +448,157 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
     } else {
         Common::FS::IterateDirEntries(dir_path, callback, Common::FS::DirEntryFilter::File);
     }
+
+    if (game_files.empty()) {
+        return;
+    }
+    // Most of the time goes into decrypting and parsing the files, which is independent for each
+    // of them. The entries are added as they are ready, the game list sorts them.
+    const u32 num_workers = std::clamp(std::thread::hardware_concurrency(), 1U, 4U);
+    Common::ThreadWorker workers{std::min<size_t>(num_workers, game_files.size()),
+                                 "GameListScan"};
+    for (std::string& physical_name : game_files) {
+        workers.QueueWork([this, physical_name = std::move(physical_name), parent_dir] {
+            if (!stop_requested) {
+                AddFileToGameList(physical_name, parent_dir);
+            }
+        });
+    }
+    workers.WaitForRequests();
+}
+
+void GameListWorker::AddFileToGameList(const std::string& physical_name,
+                                       GameListDir* parent_dir) {
+    const QFileInfo file_info{QString::fromStdString(physical_name)};
+    const u64 size = static_cast<u64>(file_info.size());
+    const s64 modified = file_info.lastModified().toMSecsSinceEpoch();
+    const bool use_index = UISettings::values.cache_game_list.GetValue();
+
+    // Files importing keys are parsed alone, every other file reads the keys concurrently
+    std::unique_lock exclusive_keys_lock{keys_mutex, std::defer_lock};
+    std::shared_lock shared_keys_lock{keys_mutex, std::defer_lock};
+    const auto lock_keys = [&](Loader::FileType file_type) {
+        if (ImportsKeys(file_type)) {
+            exclusive_keys_lock.lock();
+        } else {
+            shared_keys_lock.lock();
+        }
+    };
+
+    const auto add_entries = [&](const GameListIndex::Entry& indexed) {
+        const auto file_type = static_cast<Loader::FileType>(indexed.file_type);
+        const bool is_multi_program = indexed.programs.size() > 1;
+        for (const auto& program : indexed.programs) {
+            const FileSys::PatchManager patch{program.program_id, system.GetFileSystemController(),
+                                              system.GetContentProvider()};
+            // Only reached when the patch versions aren't cached either.
+            const auto patch_versions = [&] {
+                const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+                const auto loader = is_multi_program
+                                        ? Loader::GetLoader(system, file, program.program_id)
+                                        : Loader::GetLoader(system, file);
+                if (!loader) {
+                    return QString{};
+                }
+                return FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+            };
+            auto entry = MakeGameListEntry(physical_name,
+                                           program.name,
+                                           size,
+                                           program.icon,
+                                           file_type,
+                                           program.program_id,
+                                           compatibility_list,
+                                           play_time_manager,
+                                           patch,
+                                           patch_versions);
+            RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
+        }
+    };
+
+    if (use_index) {
+        if (const auto indexed = index.Find(physical_name, size, modified)) {
+            lock_keys(static_cast<Loader::FileType>(indexed->file_type));
+            add_entries(*indexed);
+            index.Insert(physical_name, *indexed);
+            return;
+        }
+    }
+
+    const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+    if (!file) {
+        return;
+    }
+
+    lock_keys(Loader::GuessFromFilename(physical_name));
+    auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        return;
+    }
+
+    const auto file_type = loader->GetFileType();
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        return;
+    }
+
+    u64 program_id = 0;
+    const auto res2 = loader->ReadProgramId(program_id);
+
+    std::vector<u64> program_ids;
+    loader->ReadProgramIds(program_ids);
+
+    // Files that didn't load aren't indexed, they might once the keys are available.
+    GameListIndex::Entry indexed{
+        .size = size,
+        .modified = modified,
+        .file_type = static_cast<u32>(file_type),
+        .programs = {},
+    };
+    const auto add_program = [&](Loader::AppLoader& program_loader, u64 id) {
+        auto& program = indexed.programs.emplace_back();
+        program.program_id = id;
+        program.name = " ";
+        [[maybe_unused]] const auto res1 = program_loader.ReadIcon(program.icon);
+        [[maybe_unused]] const auto res3 = program_loader.ReadTitle(program.name);
+
+        const FileSys::PatchManager patch{id, system.GetFileSystemController(),
+                                          system.GetContentProvider()};
+
+        auto entry = MakeGameListEntry(physical_name,
+                                       program.name,
+                                       size,
+                                       program.icon,
+                                       program_loader,
+                                       id,
+                                       compatibility_list,
+                                       play_time_manager,
+                                       patch);
+
+        RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
+    };
+
+    if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
+        (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
+        for (const auto id : program_ids) {
+            loader = Loader::GetLoader(system, file, id);
+            if (!loader) {
+                continue;
+            }
+            add_program(*loader, id);
+        }
+    } else {
+        add_program(*loader, program_id);
+    }
+
+    if (use_index && !indexed.programs.empty()) {
+        index.Insert(physical_name, std::move(indexed));
+    }
 }
 
 void GameListWorker::run() {
     watch_list.clear();
     provider->ClearAllEntries();
+    index.Load();
 
     const auto DirEntryReady = [&](GameListDir* game_list_dir) {
         RecordEvent([=](GameList* game_list) { game_list->AddDirEntry(game_list_dir); });
@@ -502,6 +632,11 @@ void GameListWorker::run() {
         }
     }
 
+    // A cancelled scan didn't see every file, saving it would drop the rest from the index.
+    if (!stop_requested && UISettings::values.cache_game_list) {
+        index.Save();
+    }
+
     RecordEvent([this](GameList* game_list) { game_list->DonePopulating(watch_list); });
     processing_completed.Set();
 }
@@ -9,6 +9,7 @@
 #include <atomic>
 #include <deque>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 
 #include <QList>
@@ -20,6 +21,7 @@
 #include "core/file_sys/registered_cache.h"
 #include "qt_common/config/uisettings.h"
 #include "yuzu/compatibility_list.h"
+#include "yuzu/game_list_index.h"
 #include "frontend_common/play_time_manager.h"
 
 namespace Core {
@@ -82,6 +84,10 @@ private:
     void ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                         GameListDir* parent_dir);
 
+    /// Adds the programs of a file to the game list, reusing the index when it's unchanged.
+    /// Called from several scan workers at once.
+    void AddFileToGameList(const std::string& physical_name, GameListDir* parent_dir);
+
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
     FileSys::ManualContentProvider* provider;
     QVector<UISettings::GameDir>& game_dirs;
@@ -89,6 +95,8 @@ private:
     const PlayTime::PlayTimeManager& play_time_manager;
 
     QStringList watch_list;
+    GameListIndex index;
+    std::shared_mutex keys_mutex; ///< Held exclusively by the scan workers importing keys
 
     std::mutex lock;
     std::condition_variable cv;
@@ -96,6 +96,7 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 }
 
 // Frontend //
+#include "frontend_common/performance_profile.h"
 #include "frontend_common/play_time_manager.h"
 
 #ifdef ENABLE_UPDATE_CHECKER
@@ -140,6 +141,7 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 // Video Core //
 #include "video_core/gpu.h"
 #include "video_core/renderer_base.h"
+#include "video_core/shader_environment.h"
 #include "video_core/shader_notify.h"
 
 #ifdef HAVE_SDL2
@@ -321,6 +323,14 @@ static void RemoveCachedContents() {
     Common::FS::RemoveDirRecursively(offline_system_data);
 }
 
+/// Transferable pipeline cache of a title for the renderer that is selected.
+static std::filesystem::path GetPipelineCachePath(u64 program_id) {
+    const bool is_opengl =
+        Settings::values.renderer_backend.GetValue() == Settings::RendererBackend::OpenGL;
+    return Common::FS::GetEdenPath(Common::FS::EdenPath::ShaderDir) /
+           fmt::format("{:016x}", program_id) / (is_opengl ? "opengl.bin" : "vulkan.bin");
+}
+
 static void LogRuntimes() {
 #ifdef _MSC_VER
     // It is possible that the name of the dll will change.
@@ -452,6 +462,7 @@ MainWindow::MainWindow(bool has_broken_vulkan)
     discord_rpc->Update();
 
     play_time_manager = std::make_unique<PlayTime::PlayTimeManager>();
+    performance_recorder = std::make_unique<PerformanceProfile::Recorder>();
 
     Network::Init();
 
@@ -1136,9 +1147,10 @@ void MainWindow::InitializeWidgets() {
     emu_frametime_label->setToolTip(
         tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
            "full-speed emulation this should be at most 16.67 ms."));
+    memory_usage_label = new QLabel();
 
     for (auto& label : {shader_building_label, res_scale_label, emu_speed_label, game_fps_label,
-                        emu_frametime_label}) {
+                        emu_frametime_label, memory_usage_label}) {
         label->setVisible(false);
         label->setFrameStyle(QFrame::NoFrame);
         label->setContentsMargins(4, 0, 4, 0);
@@ -1563,6 +1575,10 @@ void MainWindow::ConnectWidgetEvents() {
     connect(game_list, &GameList::OpenTransferableShaderCacheRequested, this, [this](u64 program_id) {
         QtCommon::Path::OpenShaderCache(program_id, this);
     });
+    connect(game_list, &GameList::ExportShaderCacheRequested, this,
+            &MainWindow::OnGameListExportShaderCache);
+    connect(game_list, &GameList::ImportShaderCacheRequested, this,
+            &MainWindow::OnGameListImportShaderCache);
     connect(game_list, &GameList::RemoveInstalledEntryRequested, this,
             &MainWindow::OnGameListRemoveInstalledEntry);
     connect(game_list, &GameList::RemoveFileRequested, this, &MainWindow::OnGameListRemoveFile);
@@ -2045,6 +2061,7 @@ void MainWindow::BootGame(const QString& filename, Service::AM::FrontendAppletPa
                                           ? Common::FS::PathToUTF8String(file_path.filename())
                                           : fmt::format("{:016X}", title_id);
         QtConfig per_game_config(config_file_name, Config::ConfigType::PerGameConfig);
+        PerformanceProfile::ApplyLearnedDefaults(title_id);
         QtCommon::system->HIDCore().ReloadInputDevices();
         QtCommon::system->ApplySettings();
     }
@@ -2275,6 +2292,7 @@ void MainWindow::OnEmulationStopped() {
     emu_speed_label->setVisible(false);
     game_fps_label->setVisible(false);
     emu_frametime_label->setVisible(false);
+    memory_usage_label->setVisible(false);
     renderer_status_button->setEnabled(!UISettings::values.has_broken_vulkan);
     refresh_button->setEnabled(true);
 
@@ -2302,6 +2320,7 @@ void MainWindow::ShutdownGame() {
 
     // TODO(crueter): make this common as well (frontend_common?)
     play_time_manager->Stop();
+    performance_recorder->Stop();
     OnShutdownBegin();
     OnEmulationStopTimeExpired();
     OnEmulationStopped();
@@ -2575,6 +2594,50 @@ void MainWindow::OnGameListRemoveFile(u64 program_id, QtCommon::Game::GameListRe
     }
 }
 
+void MainWindow::OnGameListExportShaderCache(u64 program_id) {
+    const auto cache_path = GetPipelineCachePath(program_id);
+    if (!Common::FS::Exists(cache_path)) {
+        QMessageBox::warning(this, tr("Export Pipeline Cache"),
+                             tr("A pipeline cache for this title does not exist."));
+        return;
+    }
+    const QString package_path = QFileDialog::getSaveFileName(
+        this, tr("Export Pipeline Cache"),
+        QStringLiteral("%1.epc").arg(program_id, 16, 16, QLatin1Char{'0'}),
+        tr("Pipeline Cache Package (*.epc)"));
+    if (package_path.isEmpty()) {
+        return;
+    }
+    if (!VideoCommon::ExportPipelineCache(cache_path, package_path.toStdU16String())) {
+        QMessageBox::warning(this, tr("Export Pipeline Cache"),
+                             tr("Failed to export the pipeline cache."));
+    }
+}
+
+void MainWindow::OnGameListImportShaderCache(u64 program_id) {
+    if (emulation_running) {
+        QMessageBox::warning(this, tr("Import Pipeline Cache"),
+                             tr("The pipeline cache can not be imported while a game is running."));
+        return;
+    }
+    const QString package_path =
+        QFileDialog::getOpenFileName(this, tr("Import Pipeline Cache"), QString{},
+                                     tr("Pipeline Cache Package (*.epc)"));
+    if (package_path.isEmpty()) {
+        return;
+    }
+    const auto cache_path = GetPipelineCachePath(program_id);
+    if (!Common::FS::CreateParentDirs(cache_path) ||
+        !VideoCommon::ImportPipelineCache(package_path.toStdU16String(), cache_path)) {
+        QMessageBox::warning(this, tr("Import Pipeline Cache"),
+                             tr("Failed to import the pipeline cache. The package may be "
+                                "corrupted or made for another renderer or version."));
+        return;
+    }
+    QMessageBox::information(this, tr("Import Pipeline Cache"),
+                             tr("Successfully imported the pipeline cache."));
+}
+
 void MainWindow::OnGameListSetPlayTime(u64 program_id) {
     const u64 current_play_time = play_time_manager->GetPlayTime(program_id);
 
@@ -3105,6 +3168,8 @@ void MainWindow::OnStartGame() {
 
     play_time_manager->SetProgramId(QtCommon::system->GetApplicationProcessProgramID());
     play_time_manager->Start();
+    performance_recorder->Start(*QtCommon::system,
+                                QtCommon::system->GetApplicationProcessProgramID());
 
     discord_rpc->Update();
 
@@ -3129,6 +3194,7 @@ void MainWindow::OnRestartGame() {
 void MainWindow::OnPauseGame() {
     emu_thread->SetRunning(false);
     play_time_manager->Stop();
+    performance_recorder->Stop();
     UpdateMenuState();
     AllowOSSleep();
 
@@ -3150,6 +3216,7 @@ void MainWindow::OnPauseContinueGame() {
 void MainWindow::OnStopGame() {
     if (ConfirmShutdownGame()) {
         play_time_manager->Stop();
+    performance_recorder->Stop();
         // Update game list to show new play time
         game_list->PopulateAsync(UISettings::values.game_dirs);
         if (OnShutdownBegin()) {
@@ -3310,7 +3377,32 @@ bool MainWindow::UsingExclusiveFullscreen() {
            QGuiApplication::platformName() == QStringLiteral("wayland-egl");
 }
 
+bool MainWindow::UsingNativePresentation() {
+    return Settings::values.native_presentation.GetValue() &&
+           Settings::values.renderer_backend.GetValue() == Settings::RendererBackend::Vulkan;
+}
+
 void MainWindow::ShowFullscreen() {
+    if (UsingNativePresentation()) {
+        // Give the render window its own top-level window covering the screen. Its native surface
+        // isn't composited with the rest of the main window, so the window system can flip the
+        // swapchain images to the display directly
+        const bool is_single_window = ui->action_Single_Window_Mode->isChecked();
+        QScreen* const screen = GuessCurrentScreen(is_single_window ? this : render_window);
+        if (is_single_window) {
+            ui->horizontalLayout->removeWidget(render_window);
+            render_window->setParent(nullptr);
+        } else {
+            UISettings::values.renderwindow_geometry = render_window->saveGeometry();
+        }
+        render_window->SetNativePresentation(true);
+        render_window->setGeometry(screen->geometry());
+        render_window->showFullScreen();
+        render_window->activateWindow();
+        render_window->setFocus();
+        return;
+    }
+
     const auto show_fullscreen = [this](QWidget* window) {
         if (UsingExclusiveFullscreen()) {
             window->showFullScreen();
@@ -3339,6 +3431,20 @@ void MainWindow::ShowFullscreen() {
 }
 
 void MainWindow::HideFullscreen() {
+    if (render_window->IsNativePresentation()) {
+        render_window->SetNativePresentation(false);
+        render_window->showNormal();
+        if (ui->action_Single_Window_Mode->isChecked()) {
+            ui->horizontalLayout->addWidget(render_window);
+            render_window->setVisible(true);
+            render_window->setFocus();
+            activateWindow();
+        } else {
+            render_window->restoreGeometry(UISettings::values.renderwindow_geometry);
+        }
+        return;
+    }
+
     if (ui->action_Single_Window_Mode->isChecked()) {
         if (UsingExclusiveFullscreen()) {
             showNormal();
@@ -4132,10 +4238,12 @@ void MainWindow::OnCaptureScreenshot() {
         QString::fromStdString(Common::FS::GetEdenPathString(Common::FS::EdenPath::ScreenshotsDir));
     const auto date =
         QDateTime::currentDateTime().toString(QStringLiteral("yyyy-MM-dd_hh-mm-ss-zzz"));
-    QString filename = QStringLiteral("%1/%2_%3.png")
+    const bool is_qoi = UISettings::values.screenshot_qoi.GetValue();
+    QString filename = QStringLiteral("%1/%2_%3.%4")
                            .arg(screenshot_path)
                            .arg(title_id, 16, 16, QLatin1Char{'0'})
-                           .arg(date);
+                           .arg(date)
+                           .arg(is_qoi ? QStringLiteral("qoi") : QStringLiteral("png"));
 
     if (!Common::FS::CreateDir(screenshot_path.toStdString())) {
         return;
@@ -4144,8 +4252,9 @@ void MainWindow::OnCaptureScreenshot() {
 #ifdef _WIN32
     if (UISettings::values.enable_screenshot_save_as) {
         OnPauseGame();
-        filename = QFileDialog::getSaveFileName(this, tr("Capture Screenshot"), filename,
-                                                tr("PNG Image (*.png)"));
+        filename = QFileDialog::getSaveFileName(
+            this, tr("Capture Screenshot"), filename,
+            is_qoi ? tr("QOI Image (*.qoi)") : tr("PNG Image (*.png)"));
         OnStartGame();
         if (filename.isEmpty()) {
             return;
@@ -4326,11 +4435,57 @@ void MainWindow::UpdateStatusBar() {
         tr(Settings::values.use_speed_limit ? "" : " (Unlocked)"));
 
     emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    emu_frametime_label->setToolTip(
+        tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
+           "full-speed emulation this should be at most 16.67 ms.") +
+        QStringLiteral("\n") +
+        tr("Frame time deviation: %1 ms").arg(results.frametime_deviation * 1000.0, 0, 'f', 2) +
+        QStringLiteral("\n") +
+        tr("Frame time p50 / p95 / p99: %1 / %2 / %3 ms")
+            .arg(results.frame_length_p50 * 1000.0, 0, 'f', 1)
+            .arg(results.frame_length_p95 * 1000.0, 0, 'f', 1)
+            .arg(results.frame_length_p99 * 1000.0, 0, 'f', 1) +
+        QStringLiteral("\n") +
+        tr("1% low: %1 FPS, stutters: %2")
+            .arg(results.low_1_percent_fps, 0, 'f', 0)
+            .arg(results.stutters) +
+        QStringLiteral("\n") +
+        tr("Scheduler lock contention: %1 per second")
+            .arg(results.scheduler_lock_contention, 0, 'f', 0) +
+        QStringLiteral("\n") +
+        tr("Audio latency: %1 ms").arg(results.audio_latency * 1000.0, 0, 'f', 1) +
+        QStringLiteral("\n") +
+        tr("Core idle: %1% / %2% / %3% / %4%")
+            .arg(results.core_idle[0] * 100.0, 0, 'f', 0)
+            .arg(results.core_idle[1] * 100.0, 0, 'f', 0)
+            .arg(results.core_idle[2] * 100.0, 0, 'f', 0)
+            .arg(results.core_idle[3] * 100.0, 0, 'f', 0) +
+        QStringLiteral("\n") +
+        tr("Input latency: %1 ms").arg(results.input_latency * 1000.0, 0, 'f', 2));
+
+    const auto memory = QtCommon::system->GetMemoryTelemetry();
+    const auto& texture_cache = memory[Core::MemoryCategory::TextureCache];
+    const auto& buffer_cache = memory[Core::MemoryCategory::BufferCache];
+    const auto usage_text = [](const Core::MemoryUsage& usage) {
+        return tr("%1 (peak %2)")
+            .arg(ReadableByteSize(usage.bytes))
+            .arg(ReadableByteSize(usage.peak_bytes));
+    };
+    memory_usage_label->setText(
+        tr("GPU Caches: %1").arg(ReadableByteSize(texture_cache.bytes + buffer_cache.bytes)));
+    memory_usage_label->setToolTip(
+        tr("Application memory: %1").arg(usage_text(memory[Core::MemoryCategory::GuestMemory])) +
+        QStringLiteral("\n") +
+        tr("GPU device memory: %1")
+            .arg(usage_text(memory[Core::MemoryCategory::GpuDeviceMemory])) +
+        QStringLiteral("\n") + tr("Texture cache: %1").arg(usage_text(texture_cache)) +
+        QStringLiteral("\n") + tr("Buffer cache: %1").arg(usage_text(buffer_cache)));
 
     res_scale_label->setVisible(true);
     emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
+    memory_usage_label->setVisible(true);
     firmware_label->setVisible(false);
 }
 
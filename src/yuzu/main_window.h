@@ -84,6 +84,10 @@ namespace DiscordRPC {
 class DiscordInterface;
 }
 
+namespace PerformanceProfile {
+class Recorder;
+}
+
 namespace PlayTime {
 class PlayTimeManager;
 }
@@ -340,6 +344,8 @@ private slots:
     void OnGameListRemoveInstalledEntry(u64 program_id, QtCommon::Game::InstalledEntryType type);
     void OnGameListRemoveFile(u64 program_id, QtCommon::Game::GameListRemoveTarget target,
                               const std::string& game_path);
+    void OnGameListExportShaderCache(u64 program_id);
+    void OnGameListImportShaderCache(u64 program_id);
     void OnGameListRemovePlayTimeData(u64 program_id);
     void OnGameListSetPlayTime(u64 program_id);
     void OnGameListDumpRomFS(u64 program_id, const std::string& game_path, DumpRomFSTarget target);
@@ -392,6 +398,7 @@ private slots:
     void InitializeHotkeys();
     void ToggleFullscreen();
     bool UsingExclusiveFullscreen();
+    bool UsingNativePresentation();
     void ShowFullscreen();
     void HideFullscreen();
     void ToggleWindowMode();
@@ -473,6 +480,7 @@ private:
 
     std::unique_ptr<DiscordRPC::DiscordInterface> discord_rpc;
     std::unique_ptr<PlayTime::PlayTimeManager> play_time_manager;
+    std::unique_ptr<PerformanceProfile::Recorder> performance_recorder;
     std::shared_ptr<InputCommon::InputSubsystem> input_subsystem;
 
 #ifdef ENABLE_UPDATE_CHECKER
@@ -499,6 +507,7 @@ private:
     QLabel* emu_speed_label = nullptr;
     QLabel* game_fps_label = nullptr;
     QLabel* emu_frametime_label = nullptr;
+    QLabel* memory_usage_label = nullptr;
     QLabel* tas_label = nullptr;
     QLabel* firmware_label = nullptr;
     QPushButton* gpu_accuracy_button = nullptr;
@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "core/core.h"
+#include "core/core_timing.h"
+#include "core/perf_stats.h"
+#include "input_common/drivers/tas_input.h"
+#include "input_common/main.h"
+#include "video_core/gpu.h"
+#include "video_core/renderer_base.h"
+#include "video_core/shader_notify.h"
+#include "yuzu_cmd/benchmark.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+/// Returns the peak resident memory of the process in bytes.
+u64 PeakResidentMemory() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<u64>(usage.ru_maxrss);
+#else
+    // Reported in kilobytes
+    return static_cast<u64>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+/// Returns the nearest rank percentile of a set of values.
+double Percentile(std::vector<double> values, double percentile) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::ranges::sort(values);
+    const auto rank =
+        static_cast<size_t>(std::ceil(percentile * static_cast<double>(values.size())));
+    return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+}
+} // Anonymous namespace
+
+Benchmark::Benchmark(Core::System& system_, InputCommon::InputSubsystem& input_subsystem_,
+                     u32 num_frames_, std::optional<std::filesystem::path> replay_dir)
+    : system{system_}, input_subsystem{input_subsystem_}, num_frames{num_frames_},
+      replay_input{replay_dir.has_value()} {
+    if (replay_dir) {
+        Common::FS::SetEdenPath(Common::FS::EdenPath::TASDir, *replay_dir);
+        Settings::values.tas_enable = true;
+        Settings::values.tas_loop = false;
+    }
+}
+
+void Benchmark::ApplySettings() {
+    Settings::values.use_speed_limit.SetValue(false);
+    Settings::values.vsync_mode.SetValue(Settings::VSyncMode::Immediate);
+}
+
+Benchmark::Sample Benchmark::TakeSample() const {
+    return Sample{
+        .wall_time = std::chrono::steady_clock::now(),
+        .emulated_time = system.CoreTiming().GetGlobalTimeUs(),
+        .system_frame = system.GetPerfStats().GetSystemFrameCount(),
+        .shaders_built = system.GPU().ShaderNotify().ShadersBuilt(),
+    };
+}
+
+void Benchmark::OnFrameDisplayed() {
+    if (IsFinished()) {
+        return;
+    }
+    if (replay_input) {
+        auto* const tas = input_subsystem.GetTas();
+        if (displayed_frames == 0) {
+            // Reload the scripts from the replay directory and play them from this frame
+            tas->Reset();
+            tas->StartStop();
+        }
+        tas->UpdateThread();
+    }
+    if (const auto vram = system.Renderer().GetDeviceMemoryUsage()) {
+        reports_vram = true;
+        peak_vram = (std::max)(peak_vram, *vram);
+    }
+    if (displayed_frames++ == 0) {
+        begin = TakeSample();
+        return;
+    }
+    if (displayed_frames <= num_frames) {
+        return;
+    }
+    end = TakeSample();
+    is_finished.store(true, std::memory_order_release);
+
+    // Wake up the main thread to shut down
+    SDL_Event event{};
+    event.type = SDL_QUIT;
+    SDL_PushEvent(&event);
+}
+
+bool Benchmark::WriteReport(const std::filesystem::path& path) const {
+    const Sample last = IsFinished() ? end : TakeSample();
+    const std::vector<double> frametimes =
+        system.GetPerfStats().GetFrametimes(begin.system_frame, last.system_frame);
+    const double wall_time =
+        std::chrono::duration<double>(last.wall_time - begin.wall_time).count();
+    const double emulated_time =
+        std::chrono::duration<double>(last.emulated_time - begin.emulated_time).count();
+    const double average_frametime =
+        frametimes.empty() ? 0.0
+                           : std::accumulate(frametimes.begin(), frametimes.end(), 0.0) /
+                                 static_cast<double>(frametimes.size());
+    const double max_frametime =
+        frametimes.empty() ? 0.0 : *std::ranges::max_element(frametimes);
+    const double p99_frametime = Percentile(frametimes, 0.99);
+    constexpr double STUTTER_FRAMETIME_MS = 2000.0 / 60.0;
+    const auto stutters = std::ranges::count_if(
+        frametimes, [](double frametime) { return frametime > STUTTER_FRAMETIME_MS; });
+
+    const std::string report = fmt::format(
+        "{{\n"
+        "  \"title_id\": \"{:016X}\",\n"
+        "  \"renderer\": \"{}\",\n"
+        "  \"completed\": {},\n"
+        "  \"frames\": {},\n"
+        "  \"wall_time_s\": {:.3f},\n"
+        "  \"emulated_time_s\": {:.3f},\n"
+        "  \"emulation_speed\": {:.4f},\n"
+        "  \"frametime_ms\": {{\"average\": {:.3f}, \"p50\": {:.3f}, \"p95\": {:.3f}, "
+        "\"p99\": {:.3f}, \"max\": {:.3f}}},\n"
+        "  \"low_1_percent_fps\": {:.2f},\n"
+        "  \"stutters\": {},\n"
+        "  \"shaders_built\": {},\n"
+        "  \"disk_cache_pipelines\": {},\n"
+        "  \"peak_rss_bytes\": {},\n"
+        "  \"peak_vram_bytes\": {}\n"
+        "}}\n",
+        system.GetApplicationProcessProgramID(), system.Renderer().GetDeviceVendor(),
+        IsFinished(), frametimes.size(), wall_time, emulated_time,
+        wall_time > 0.0 ? emulated_time / wall_time : 0.0, average_frametime,
+        Percentile(frametimes, 0.50), Percentile(frametimes, 0.95), p99_frametime, max_frametime,
+        p99_frametime > 0.0 ? 1000.0 / p99_frametime : 0.0, stutters,
+        last.shaders_built - begin.shaders_built, disk_cache_pipelines, PeakResidentMemory(),
+        reports_vram ? std::to_string(peak_vram) : std::string{"null"});
+
+    if (path.empty()) {
+        std::cout << report;
+        return true;
+    }
+    if (!Common::FS::CreateParentDir(path)) {
+        LOG_ERROR(Frontend, "Failed to create the directory of the benchmark report");
+        return false;
+    }
+    Common::FS::IOFile file(path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::TextFile);
+    if (file.WriteString(report) != report.size()) {
+        LOG_ERROR(Frontend, "Failed to write the benchmark report");
+        return false;
+    }
+    return true;
+}
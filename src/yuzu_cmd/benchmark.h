@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2025 Eden Emulator Project
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+namespace InputCommon {
+class InputSubsystem;
+}
+
+/**
+ * Measures a fixed number of displayed frames and reports the performance of the run as JSON.
+ * The run starts on the first displayed frame, so booting and disk cache loading are excluded.
+ */
+class Benchmark {
+public:
+    /// @param replay_dir Directory of TAS scripts to play from the first frame, if any
+    explicit Benchmark(Core::System& system, InputCommon::InputSubsystem& input_subsystem,
+                       u32 num_frames, std::optional<std::filesystem::path> replay_dir);
+
+    /// Disables the frame limits so the run measures how fast frames can be emulated.
+    static void ApplySettings();
+
+    /// Called from the presentation thread after every displayed frame.
+    /// Closes the window once all the frames are displayed.
+    void OnFrameDisplayed();
+
+    /// Records the number of pipelines loaded from the disk cache before the run.
+    void SetDiskCachePipelines(size_t count) {
+        disk_cache_pipelines = count;
+    }
+
+    /// Returns true when all the frames were displayed.
+    [[nodiscard]] bool IsFinished() const {
+        return is_finished.load(std::memory_order_acquire);
+    }
+
+    /// Writes the report to a file, or to stdout when the path is empty.
+    /// It has to be called before the emulated process is shut down.
+    bool WriteReport(const std::filesystem::path& path) const;
+
+private:
+    struct Sample {
+        std::chrono::steady_clock::time_point wall_time;
+        std::chrono::microseconds emulated_time;
+        size_t system_frame;
+        int shaders_built;
+    };
+
+    [[nodiscard]] Sample TakeSample() const;
+
+    Core::System& system;
+    InputCommon::InputSubsystem& input_subsystem;
+    const u32 num_frames;
+    const bool replay_input;
+
+    u32 displayed_frames{};
+    Sample begin{};
+    Sample end{};
+    u64 peak_vram{};
+    bool reports_vram{};
+    size_t disk_cache_pipelines{};
+    std::atomic_bool is_finished{};
+};
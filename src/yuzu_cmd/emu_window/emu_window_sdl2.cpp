@@ -156,6 +156,16 @@ void EmuWindow_SDL2::Fullscreen() {
     }
 }
 
+void EmuWindow_SDL2::SetFrameDisplayedCallback(std::function<void()> callback) {
+    frame_displayed_callback = std::move(callback);
+}
+
+void EmuWindow_SDL2::OnFrameDisplayed() {
+    if (frame_displayed_callback) {
+        frame_displayed_callback();
+    }
+}
+
 void EmuWindow_SDL2::WaitEvent() {
     // Called on main thread
     SDL_Event event;
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <functional>
 #include <tuple>
 #include <utility>
 
@@ -39,6 +40,11 @@ public:
     // Sets the window icon from yuzu.bmp
     void SetWindowIcon();
 
+    /// Sets a function called from the presentation thread after every displayed frame.
+    void SetFrameDisplayedCallback(std::function<void()> callback);
+
+    void OnFrameDisplayed() override;
+
 protected:
     /// Called by WaitEvent when a key is pressed or released.
     void OnKeyEvent(int key, u8 state);
@@ -91,6 +97,9 @@ protected:
     /// Keeps track of how often to update the title bar during gameplay
     u32 last_time = 0;
 
+    /// Called after every displayed frame
+    std::function<void()> frame_displayed_callback;
+
     /// Input subsystem to use with this window.
     InputCommon::InputSubsystem* input_subsystem;
 
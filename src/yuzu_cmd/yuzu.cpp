@@ -4,8 +4,10 @@
 // SPDX-FileCopyrightText: 2014 Citra Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <filesystem>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 
@@ -17,6 +19,7 @@
 #include "common/scm_rev.h"
 #include "common/settings.h"
 #include "common/string_util.h"
+#include "core/boot_timeline.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/cpu_manager.h"
@@ -31,6 +34,7 @@
 #include "network/network.h"
 #include "sdl_config.h"
 #include "video_core/renderer_base.h"
+#include "yuzu_cmd/benchmark.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_gl.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2_null.h"
@@ -67,13 +71,19 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 static void PrintHelp(const char* argv0) {
     std::cout << "Usage: " << argv0
               << " [options] <filename>\n"
+                 "-b, --benchmark=n     Run n frames without frame limits, then print a JSON\n"
+                 "                      performance report and exit\n"
+                 "    --build-pipelines Build the pipelines in the shader cache of the game with\n"
+                 "                      a hidden window, save the driver pipeline cache and exit\n"
                  "-c, --config          Load the specified configuration file\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
                  "-g, --game            File path of the game to load\n"
                  "-h, --help            Display this help and exit\n"
                  "-m, --multiplayer=nick:password@address:port"
                  " Nickname, password, address and port for multiplayer\n"
+                 "-o, --report=path     Write the benchmark report to a file instead\n"
                  "-p, --program         Pass following string as arguments to executable\n"
+                 "-r, --replay=dir      Play the TAS scripts of a directory during the benchmark\n"
                  "-u, --user            Select a specific user profile from 0 to 7\n"
                  "-d, --debug           Run the GDB stub on a port from 1 to 65535\n"
                  "-v, --version         Output version information and exit\n";
@@ -213,9 +223,15 @@ int main(int argc, char** argv) {
     std::string password{};
     std::string address{};
     u16 port = Network::DefaultRoomPort;
+    std::optional<u32> benchmark_frames{};
+    std::optional<std::filesystem::path> replay_dir{};
+    std::filesystem::path report_path{};
+    bool build_pipelines = false;
 
     static struct option long_options[] = {
         // clang-format off
+        {"benchmark", required_argument, 0, 'b'},
+        {"build-pipelines", no_argument, 0, 'P'},
         {"debug", no_argument, 0, 'd'},
         {"config", required_argument, 0, 'c'},
         {"fullscreen", no_argument, 0, 'f'},
@@ -223,6 +239,8 @@ int main(int argc, char** argv) {
         {"game", required_argument, 0, 'g'},
         {"multiplayer", required_argument, 0, 'm'},
         {"program", optional_argument, 0, 'p'},
+        {"replay", required_argument, 0, 'r'},
+        {"report", required_argument, 0, 'o'},
         {"user", required_argument, 0, 'u'},
         {"version", no_argument, 0, 'v'},
         {0, 0, 0, 0},
@@ -230,9 +248,19 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::c:u:d:", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "b:g:fhvo:p::r:c:u:d:", long_options, &option_index);
         if (arg != -1) {
             switch (char(arg)) {
+            case 'b':
+                benchmark_frames = static_cast<u32>(std::strtoul(optarg, nullptr, 0));
+                if (*benchmark_frames == 0) {
+                    std::cout << "The benchmark must run at least one frame.\n";
+                    return -1;
+                }
+                break;
+            case 'P':
+                build_pipelines = true;
+                break;
             case 'd':
                 override_gdb_port = uint16_t(atoi(optarg));
                 break;
@@ -282,10 +310,16 @@ int main(int argc, char** argv) {
                 }
                 break;
             }
+            case 'o':
+                report_path = optarg;
+                break;
             case 'p':
                 program_args = argv[optind];
                 ++optind;
                 break;
+            case 'r':
+                replay_dir = optarg;
+                break;
             case 'u':
                 selected_user = atoi(optarg);
                 break;
@@ -324,6 +358,17 @@ int main(int argc, char** argv) {
         Settings::values.gdbstub_port = *override_gdb_port;
     }
 
+    if (build_pipelines) {
+        // Pipelines are only built ahead of time by the Vulkan pipeline cache
+        Settings::values.renderer_backend.SetValue(Settings::RendererBackend::Vulkan);
+        Settings::values.use_disk_shader_cache.SetValue(true);
+        Settings::values.use_vulkan_driver_pipeline_cache.SetValue(true);
+    } else if (benchmark_frames.has_value()) {
+        Benchmark::ApplySettings();
+    } else if (replay_dir.has_value()) {
+        LOG_WARNING(Frontend, "Input is only replayed in benchmark mode");
+    }
+
 #ifdef _WIN32
     LocalFree(argv_w);
 #endif
@@ -347,13 +392,20 @@ int main(int argc, char** argv) {
         emu_window = std::make_unique<EmuWindow_SDL2_GL>(&input_subsystem, system, fullscreen);
         break;
     case Settings::RendererBackend::Vulkan:
-        emu_window = std::make_unique<EmuWindow_SDL2_VK>(&input_subsystem, system, fullscreen);
+        emu_window = std::make_unique<EmuWindow_SDL2_VK>(&input_subsystem, system, fullscreen,
+                                                         build_pipelines);
         break;
     case Settings::RendererBackend::Null:
         emu_window = std::make_unique<EmuWindow_SDL2_Null>(&input_subsystem, system, fullscreen);
         break;
     }
 
+    std::optional<Benchmark> benchmark;
+    if (benchmark_frames.has_value()) {
+        benchmark.emplace(system, input_subsystem, *benchmark_frames, replay_dir);
+        emu_window->SetFrameDisplayedCallback([&benchmark] { benchmark->OnFrameDisplayed(); });
+    }
+
 #ifdef _WIN32
     Common::Windows::SetCurrentTimerResolutionToMaximum();
     system.CoreTiming().SetTimerResolutionNs(Common::Windows::GetCurrentTimerResolution());
@@ -418,9 +470,28 @@ int main(int argc, char** argv) {
     system.GetCpuManager().OnGpuReady();
 
     if (Settings::values.use_disk_shader_cache.GetValue()) {
+        const auto boot_stage = system.GetBootTimeline().MeasureStage("Pipeline cache");
         system.Renderer().ReadRasterizer()->LoadDiskResources(
             system.GetApplicationProcessProgramID(), std::stop_token{},
-            [](VideoCore::LoadCallbackStage, size_t value, size_t total) {});
+            [&benchmark, build_pipelines](VideoCore::LoadCallbackStage stage, size_t value,
+                                          size_t total) {
+                if (stage != VideoCore::LoadCallbackStage::Build) {
+                    return;
+                }
+                if (benchmark) {
+                    benchmark->SetDiskCachePipelines(total);
+                }
+                if (build_pipelines && (value % 100 == 0 || value == total)) {
+                    std::cout << fmt::format("Built {} of {} pipelines\n", value, total);
+                }
+            });
+    }
+
+    if (build_pipelines) {
+        // The pipelines are built and the driver cache was written by LoadDiskResources
+        system.ShutdownMainProcess();
+        detached_tasks.WaitForAllTasks();
+        return 0;
     }
 
     system.RegisterExitCallback([&] {
@@ -441,6 +512,11 @@ int main(int argc, char** argv) {
     }
     system.DetachDebugger();
     void(system.Pause());
+
+    int exit_code = 0;
+    if (benchmark && (!benchmark->WriteReport(report_path) || !benchmark->IsFinished())) {
+        exit_code = 1;
+    }
     system.ShutdownMainProcess();
 
 #ifdef __linux__
@@ -448,7 +524,7 @@ int main(int argc, char** argv) {
 #endif
 
     detached_tasks.WaitForAllTasks();
-    return 0;
+    return exit_code;
 }
 
 #define VMA_IMPLEMENTATION